@@ -0,0 +1,1074 @@
+// allocbench.m.cpp                                                   -*-C++-*-
+
+//@PURPOSE: Compare the performance of the 'bslma' and 'bdlma' allocators.
+//
+//@DESCRIPTION: This program runs the allocator workloads described in the
+// ISO C++ papers "On Quantifying Memory-Allocation Strategies" (N4468,
+// P0089R0, P0089R1) against the allocators of this repository, and reports
+// the elapsed time of each (workload, allocator) pair in a human-readable
+// table, or in a machine-readable format suitable for regression tracking.
+//
+///Workloads
+///---------
+//: 'churn':
+//:   Repeatedly create a container using a freshly constructed allocator,
+//:   insert elements, and destroy the container.  Allocators that release all
+//:   of their memory on destruction are also measured with the container
+//:   "winked out", i.e., with its destructor never run (variant suffix
+//:   '/wink').
+//:
+//: 'locality':
+//:   Build many long-lived subsystems, each a list supplied its own
+//:   allocator, with their insertions interleaved; churn them by removing
+//:   and inserting elements in randomly chosen subsystems; then measure the
+//:   time taken to traverse every subsystem.  The traversal time measures the
+//:   locality of the memory dispensed by each allocator.
+//:
+//: 'sizes':
+//:   Repeatedly fill a vector with a fixed budget of memory held in
+//:   elements of a single size, for element sizes from 8 to 4096 bytes.
+//:
+//: 'threads':
+//:   Run pairs of threads sharing one allocator, in which a producer allocates
+//:   messages of varying sizes that a consumer deallocates.  Only the
+//:   thread-safe allocators are measured.
+//
+///Allocators
+///----------
+//: 'newdelete':           'bslma::NewDeleteAllocator'
+//: 'sequential':          'bdlma::SequentialAllocator'
+//: 'localsequential':     'bdlma::LocalSequentialAllocator<65536>'
+//: 'multipool':           'bdlma::MultipoolAllocator'
+//: 'concurrentmultipool': 'bdlma::ConcurrentMultipoolAllocator'
+//: 'sizeclassmultipool':  'bdlma::SizeClassMultipoolAllocator'
+//: 'threadcaching':       'bdlma::ThreadCachingAllocator'
+//: 'hugepage':            'bdlma::SequentialAllocator' obtaining its memory
+//:                        from 'bdlma::HugePageAllocator'
+//
+// Every allocator other than 'newdelete' and 'hugepage' obtains its memory
+// from 'bslma::NewDeleteAllocator'.
+//
+///Output
+///------
+// Each measurement is the minimum elapsed time of '--repetitions' runs, and
+// is reported with the number of operations (element insertions, element
+// visits, or messages) it performed.  The 'csv' format writes a header line
+// followed by one line per measurement, and the 'json' format writes one JSON
+// object per line:
+//..
+//  {"workload":"churn","variant":"vector<int>","allocator":"multipool",
+//   "operations":1024000,"seconds":0.004561204,"nsPerOperation":4.454}
+//..
+// (shown here on two lines).  Workload, variant, and allocator names never
+// contain characters requiring escapes.
+//
+///Usage
+///-----
+//..
+//  allocbench [--format=text|csv|json] [--scale=<n>] [--repetitions=<n>]
+//             [--threads=<n>] [--workloads=<name>[,<name>...]]
+//             [--allocators=<name>[,<name>...]]
+//..
+// '--scale' multiplies the number of iterations of every workload (default
+// 1), and '--threads' sets the number of producer-consumer pairs of the
+// 'threads' workload (default 2).
+
+#include <bdlb_random.h>
+
+#include <bdlcc_fixedqueue.h>
+
+#include <bdlma_concurrentmultipoolallocator.h>
+#include <bdlma_hugepageallocator.h>
+#include <bdlma_localsequentialallocator.h>
+#include <bdlma_multipoolallocator.h>
+#include <bdlma_sequentialallocator.h>
+#include <bdlma_sizeclassmultipoolallocator.h>
+#include <bdlma_threadcachingallocator.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_newdeleteallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_objectbuffer.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_list.h>
+#include <bsl_set.h>
+#include <bsl_string.h>
+#include <bsl_unordered_set.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+namespace {
+
+volatile bsl::size_t g_sink = 0;
+    // Accumulates values derived from the benchmarked containers so that
+    // their construction cannot be optimized away.
+
+                               // =============
+                               // struct Config
+                               // =============
+
+struct Config {
+    // This 'struct' holds the options of a benchmark run.
+
+    // TYPES
+    enum Format {
+        e_TEXT,
+        e_CSV,
+        e_JSON
+    };
+
+    // DATA
+    Format      d_format;       // output format
+    int         d_scale;        // multiplier of every iteration count
+    int         d_repetitions;  // runs per measurement; the minimum is kept
+    int         d_numPairs;     // producer-consumer pairs of 'threads'
+    bsl::string d_workloads;    // comma-separated workloads, or empty for all
+    bsl::string d_allocators;   // comma-separated allocators, or empty for
+                                // all
+
+    // CREATORS
+    Config()
+    : d_format(e_TEXT)
+    , d_scale(1)
+    , d_repetitions(3)
+    , d_numPairs(2)
+    {
+    }
+
+    // ACCESSORS
+    bool selectsAllocator(const char *name) const
+        // Return 'true' if the allocator having the specified 'name' is to be
+        // measured, and 'false' otherwise.
+    {
+        return selects(d_allocators, name);
+    }
+
+    bool selectsWorkload(const char *name) const
+        // Return 'true' if the workload having the specified 'name' is to be
+        // run, and 'false' otherwise.
+    {
+        return selects(d_workloads, name);
+    }
+
+    static bool selects(const bsl::string& list, const char *name)
+        // Return 'true' if the specified comma-separated 'list' is empty or
+        // contains the specified 'name', and 'false' otherwise.
+    {
+        if (list.empty()) {
+            return true;                                              // RETURN
+        }
+        const bsl::size_t length = bsl::strlen(name);
+        bsl::size_t       start  = 0;
+        while (start <= list.size()) {
+            bsl::size_t end = list.find(',', start);
+            if (bsl::string::npos == end) {
+                end = list.size();
+            }
+            if (end - start == length
+             && 0 == list.compare(start, length, name)) {
+                return true;                                          // RETURN
+            }
+            start = end + 1;
+        }
+        return false;
+    }
+};
+
+                               // ==============
+                               // class Reporter
+                               // ==============
+
+class Reporter {
+    // This class writes measurements to 'stdout' in the format selected by a
+    // 'Config'.
+
+    // DATA
+    Config::Format d_format;  // output format
+
+  public:
+    // CREATORS
+    explicit Reporter(Config::Format format)
+    : d_format(format)
+    {
+        if (Config::e_CSV == d_format) {
+            bsl::printf("workload,variant,allocator,operations,seconds,"
+                        "nsPerOperation\n");
+        }
+        else if (Config::e_TEXT == d_format) {
+            bsl::printf("%-10s %-28s %-20s %12s %12s %10s\n",
+                        "workload",
+                        "variant",
+                        "allocator",
+                        "operations",
+                        "seconds",
+                        "ns/op");
+        }
+    }
+
+    // MANIPULATORS
+    void report(const char         *workload,
+                const bsl::string&  variant,
+                const char         *allocator,
+                bsls::Types::Int64  numOperations,
+                double              seconds)
+        // Write the measurement of the specified 'numOperations' performed
+        // by the specified 'workload' in the specified 'variant' using the
+        // specified 'allocator' in the specified 'seconds'.
+    {
+        const double nsPerOperation = 0 < numOperations
+                                    ? seconds * 1e9 / numOperations
+                                    : 0;
+        const long long operations = numOperations;
+
+        switch (d_format) {
+          case Config::e_CSV: {
+            bsl::printf("%s,%s,%s,%lld,%.9f,%.3f\n",
+                        workload,
+                        variant.c_str(),
+                        allocator,
+                        operations,
+                        seconds,
+                        nsPerOperation);
+          } break;
+          case Config::e_JSON: {
+            bsl::printf("{\"workload\":\"%s\",\"variant\":\"%s\","
+                        "\"allocator\":\"%s\",\"operations\":%lld,"
+                        "\"seconds\":%.9f,\"nsPerOperation\":%.3f}\n",
+                        workload,
+                        variant.c_str(),
+                        allocator,
+                        operations,
+                        seconds,
+                        nsPerOperation);
+          } break;
+          default: {
+            bsl::printf("%-10s %-28s %-20s %12lld %12.6f %10.3f\n",
+                        workload,
+                        variant.c_str(),
+                        allocator,
+                        operations,
+                        seconds,
+                        nsPerOperation);
+          } break;
+        }
+        bsl::fflush(stdout);
+    }
+};
+
+                         // ========================
+                         // struct AllocatorTraits<>
+                         // ========================
+
+template <class ALLOCATOR>
+struct AllocatorTraits;
+    // This 'struct' template provides the name of the specified 'ALLOCATOR'
+    // and the properties that decide the workloads it is measured by:
+    //: 'k_IS_THREAD_SAFE':      it may be shared by several threads
+    //: 'k_RELEASES_ALL_MEMORY': its destructor releases all outstanding
+    //:                          memory, so that containers may be winked out
+
+template <>
+struct AllocatorTraits<bslma::NewDeleteAllocator> {
+    enum { k_IS_THREAD_SAFE = 1, k_RELEASES_ALL_MEMORY = 0 };
+    static const char *name() { return "newdelete"; }
+};
+
+template <>
+struct AllocatorTraits<bdlma::SequentialAllocator> {
+    enum { k_IS_THREAD_SAFE = 0, k_RELEASES_ALL_MEMORY = 1 };
+    static const char *name() { return "sequential"; }
+};
+
+template <>
+struct AllocatorTraits<bdlma::LocalSequentialAllocator<65536> > {
+    enum { k_IS_THREAD_SAFE = 0, k_RELEASES_ALL_MEMORY = 1 };
+    static const char *name() { return "localsequential"; }
+};
+
+template <>
+struct AllocatorTraits<bdlma::MultipoolAllocator> {
+    enum { k_IS_THREAD_SAFE = 0, k_RELEASES_ALL_MEMORY = 1 };
+    static const char *name() { return "multipool"; }
+};
+
+template <>
+struct AllocatorTraits<bdlma::ConcurrentMultipoolAllocator> {
+    enum { k_IS_THREAD_SAFE = 1, k_RELEASES_ALL_MEMORY = 1 };
+    static const char *name() { return "concurrentmultipool"; }
+};
+
+template <>
+struct AllocatorTraits<bdlma::SizeClassMultipoolAllocator> {
+    enum { k_IS_THREAD_SAFE = 0, k_RELEASES_ALL_MEMORY = 1 };
+    static const char *name() { return "sizeclassmultipool"; }
+};
+
+template <>
+struct AllocatorTraits<bdlma::ThreadCachingAllocator> {
+    enum { k_IS_THREAD_SAFE = 1, k_RELEASES_ALL_MEMORY = 1 };
+    static const char *name() { return "threadcaching"; }
+};
+
+struct HugePageSequentialAllocator {
+    // This empty 'struct' designates a 'bdlma::SequentialAllocator' obtaining
+    // its memory from a 'bdlma::HugePageAllocator'.
+};
+
+template <>
+struct AllocatorTraits<HugePageSequentialAllocator> {
+    enum { k_IS_THREAD_SAFE = 0, k_RELEASES_ALL_MEMORY = 1 };
+    static const char *name() { return "hugepage"; }
+};
+
+                          // ========================
+                          // struct AllocatorHolder<>
+                          // ========================
+
+template <class ALLOCATOR>
+struct AllocatorHolder {
+    // This 'struct' template owns an object of the specified 'ALLOCATOR'
+    // type that obtains its memory from 'bslma::NewDeleteAllocator'.
+
+    // DATA
+    ALLOCATOR d_allocator;
+
+    // CREATORS
+    AllocatorHolder()
+    : d_allocator(&bslma::NewDeleteAllocator::singleton())
+    {
+    }
+
+    // MANIPULATORS
+    bslma::Allocator *allocator() { return &d_allocator; }
+};
+
+template <>
+struct AllocatorHolder<bslma::NewDeleteAllocator> {
+    // This specialization refers to the 'bslma::NewDeleteAllocator'
+    // singleton.
+
+    // MANIPULATORS
+    bslma::Allocator *allocator()
+    {
+        return &bslma::NewDeleteAllocator::singleton();
+    }
+};
+
+template <>
+struct AllocatorHolder<HugePageSequentialAllocator> {
+    // This specialization owns a 'bdlma::SequentialAllocator' obtaining its
+    // memory from an owned 'bdlma::HugePageAllocator'.
+
+    // DATA
+    bdlma::HugePageAllocator   d_upstream;
+    bdlma::SequentialAllocator d_allocator;
+
+    // CREATORS
+    AllocatorHolder()
+    : d_upstream(bdlma::HugePageAllocator::e_TRANSPARENT_HUGE_PAGES,
+                 &bslma::NewDeleteAllocator::singleton())
+    , d_allocator(&d_upstream)
+    {
+    }
+
+    // MANIPULATORS
+    bslma::Allocator *allocator() { return &d_allocator; }
+};
+
+                             // ================
+                             // helper functions
+                             // ================
+
+int scramble(int value)
+    // Return a value that is unique for each distinct specified 'value', and
+    // that varies irregularly with 'value'.
+{
+    return static_cast<int>(static_cast<unsigned int>(value) * 2654435761u);
+}
+
+double elapsedSeconds(bsls::Types::Int64 startTime)
+    // Return the number of seconds elapsed since the specified 'startTime',
+    // as obtained from 'bsls::TimeUtil::getTimer'.
+{
+    return static_cast<double>(bsls::TimeUtil::getTimer() - startTime) / 1e9;
+}
+
+template <class SAMPLE>
+double measure(const SAMPLE& sample, int numRepetitions)
+    // Run the specified 'sample' the specified 'numRepetitions' times, and
+    // return the least number of seconds it reported.
+{
+    double result = sample();
+    for (int i = 1; i < numRepetitions; ++i) {
+        result = bsl::min(result, sample());
+    }
+    return result;
+}
+
+void fill(bsl::vector<int> *container, int numElements)
+    // Append the specified 'numElements' elements to the specified
+    // 'container'.
+{
+    for (int i = 0; i < numElements; ++i) {
+        container->push_back(i);
+    }
+}
+
+void fill(bsl::list<int> *container, int numElements)
+    // Append the specified 'numElements' elements to the specified
+    // 'container'.
+{
+    for (int i = 0; i < numElements; ++i) {
+        container->push_back(i);
+    }
+}
+
+void fill(bsl::set<int> *container, int numElements)
+    // Insert the specified 'numElements' distinct elements into the
+    // specified 'container'.
+{
+    for (int i = 0; i < numElements; ++i) {
+        container->insert(scramble(i));
+    }
+}
+
+void fill(bsl::unordered_set<int> *container, int numElements)
+    // Insert the specified 'numElements' distinct elements into the
+    // specified 'container'.
+{
+    for (int i = 0; i < numElements; ++i) {
+        container->insert(scramble(i));
+    }
+}
+
+void fill(bsl::vector<bsl::string> *container, int numElements)
+    // Append the specified 'numElements' strings, each too long for the
+    // short-string buffer, to the specified 'container'.
+{
+    for (int i = 0; i < numElements; ++i) {
+        container->emplace_back("a string too long for the short buffer");
+    }
+}
+
+                              // ===============
+                              // workload: churn
+                              // ===============
+
+template <class ALLOCATOR, class CONTAINER>
+struct ChurnSample {
+    // This 'struct' template creates, fills, and destroys (or winks out)
+    // containers of the specified 'CONTAINER' type, each using a new object
+    // of the specified 'ALLOCATOR' type.
+
+    // DATA
+    int  d_numIterations;  // containers created
+    int  d_numElements;    // elements inserted into each container
+    bool d_wink;           // if 'true', never destroy the containers
+
+    // ACCESSORS
+    double operator()() const
+        // Run the sample and return its elapsed time in seconds.
+    {
+        const bsls::Types::Int64 startTime = bsls::TimeUtil::getTimer();
+
+        for (int i = 0; i < d_numIterations; ++i) {
+            AllocatorHolder<ALLOCATOR>    holder;
+            bsls::ObjectBuffer<CONTAINER> buffer;
+
+            new (buffer.buffer()) CONTAINER(holder.allocator());
+            fill(&buffer.object(), d_numElements);
+            g_sink = g_sink + buffer.object().size();
+
+            if (!d_wink) {
+                buffer.object().~CONTAINER();
+            }
+        }
+        return elapsedSeconds(startTime);
+    }
+};
+
+template <class ALLOCATOR, class CONTAINER>
+void runChurn(const char     *containerName,
+              const Config&   config,
+              Reporter       *reporter)
+    // Measure the 'churn' workload for the specified 'ALLOCATOR' and
+    // 'CONTAINER' types, named by the specified 'containerName', as
+    // configured by the specified 'config', and report the results to the
+    // specified 'reporter'.
+{
+    typedef AllocatorTraits<ALLOCATOR> Traits;
+
+    ChurnSample<ALLOCATOR, CONTAINER> sample;
+    sample.d_numIterations = 1000 * config.d_scale;
+    sample.d_numElements   = 1024;
+    sample.d_wink          = false;
+
+    const bsls::Types::Int64 numOperations =
+                  static_cast<bsls::Types::Int64>(sample.d_numIterations)
+                                                        * sample.d_numElements;
+
+    reporter->report("churn",
+                     containerName,
+                     Traits::name(),
+                     numOperations,
+                     measure(sample, config.d_repetitions));
+
+    if (Traits::k_RELEASES_ALL_MEMORY) {
+        sample.d_wink = true;
+        reporter->report("churn",
+                         bsl::string(containerName) + "/wink",
+                         Traits::name(),
+                         numOperations,
+                         measure(sample, config.d_repetitions));
+    }
+}
+
+template <class ALLOCATOR>
+void runChurn(const Config& config, Reporter *reporter)
+    // Measure the 'churn' workload for the specified 'ALLOCATOR' type for
+    // every container type, as configured by the specified 'config', and
+    // report the results to the specified 'reporter'.
+{
+    runChurn<ALLOCATOR, bsl::vector<int> >("vector<int>", config, reporter);
+    runChurn<ALLOCATOR, bsl::list<int> >("list<int>", config, reporter);
+    runChurn<ALLOCATOR, bsl::set<int> >("set<int>", config, reporter);
+    runChurn<ALLOCATOR, bsl::unordered_set<int> >("unordered_set<int>",
+                                                  config,
+                                                  reporter);
+    runChurn<ALLOCATOR, bsl::vector<bsl::string> >("vector<string>",
+                                                   config,
+                                                   reporter);
+}
+
+                            // ==================
+                            // workload: locality
+                            // ==================
+
+template <class ALLOCATOR>
+struct LocalitySample {
+    // This 'struct' template builds and churns lists, each using its own
+    // object of the specified 'ALLOCATOR' type, and measures either the churn
+    // or the subsequent traversal of the lists.
+
+    // TYPES
+    typedef AllocatorHolder<ALLOCATOR> Holder;
+    typedef bsl::list<int>             List;
+
+    // DATA
+    int  d_numSubsystems;  // lists, each with its own allocator
+    int  d_numElements;    // initial elements of each list
+    int  d_numChurns;      // element replacements in random lists
+    int  d_numPasses;      // traversals of every list
+    bool d_measureChurn;   // if 'true' measure churn, otherwise traversal
+
+    // ACCESSORS
+    double operator()() const
+        // Run the sample and return its elapsed time in seconds.
+    {
+        bslma::Allocator *da = bslma::Default::allocator();
+
+        bsl::vector<Holder *> holders(da);
+        bsl::vector<List *>   lists(da);
+
+        for (int i = 0; i < d_numSubsystems; ++i) {
+            holders.push_back(new (*da) Holder());
+            lists.push_back(new (*da) List(holders.back()->allocator()));
+        }
+
+        // Interleave the insertions of all subsystems.
+
+        for (int j = 0; j < d_numElements; ++j) {
+            for (int i = 0; i < d_numSubsystems; ++i) {
+                lists[i]->push_back(j);
+            }
+        }
+
+        bsls::Types::Int64 startTime = bsls::TimeUtil::getTimer();
+
+        int seed = 12345;
+        for (int k = 0; k < d_numChurns; ++k) {
+            List *list = lists[bdlb::Random::generate15(&seed)
+                                                           % d_numSubsystems];
+            const int value = list->front();
+            list->pop_front();
+            list->push_back(value + 1);
+        }
+
+        double result = elapsedSeconds(startTime);
+
+        if (!d_measureChurn) {
+            startTime = bsls::TimeUtil::getTimer();
+
+            bsl::size_t sum = 0;
+            for (int pass = 0; pass < d_numPasses; ++pass) {
+                for (int i = 0; i < d_numSubsystems; ++i) {
+                    const List& list = *lists[i];
+                    for (List::const_iterator it = list.begin();
+                         it != list.end();
+                         ++it) {
+                        sum += *it;
+                    }
+                }
+            }
+            g_sink = g_sink + sum;
+
+            result = elapsedSeconds(startTime);
+        }
+
+        for (int i = 0; i < d_numSubsystems; ++i) {
+            da->deleteObject(lists[i]);
+            da->deleteObject(holders[i]);
+        }
+        return result;
+    }
+};
+
+template <class ALLOCATOR>
+void runLocality(const Config& config, Reporter *reporter)
+    // Measure the 'locality' workload for the specified 'ALLOCATOR' type, as
+    // configured by the specified 'config', and report the results to the
+    // specified 'reporter'.
+{
+    typedef AllocatorTraits<ALLOCATOR> Traits;
+
+    LocalitySample<ALLOCATOR> sample;
+    sample.d_numSubsystems = 64;
+    sample.d_numElements   = 2048;
+    sample.d_numChurns     = 4 * 64 * 2048 * config.d_scale;
+    sample.d_numPasses     = 10 * config.d_scale;
+    sample.d_measureChurn  = true;
+
+    reporter->report("locality",
+                     "churn",
+                     Traits::name(),
+                     sample.d_numChurns,
+                     measure(sample, config.d_repetitions));
+
+    sample.d_measureChurn = false;
+
+    reporter->report("locality",
+                     "access",
+                     Traits::name(),
+                     static_cast<bsls::Types::Int64>(sample.d_numPasses)
+                                                    * sample.d_numSubsystems
+                                                    * sample.d_numElements,
+                     measure(sample, config.d_repetitions));
+}
+
+                              // ===============
+                              // workload: sizes
+                              // ===============
+
+template <class ALLOCATOR>
+struct SizesSample {
+    // This 'struct' template repeatedly fills a vector, using a new object of
+    // the specified 'ALLOCATOR' type, with elements each holding a block of
+    // one size.
+
+    // DATA
+    int d_numIterations;  // vectors created
+    int d_numElements;    // elements of each vector
+    int d_elementSize;    // bytes held by each element
+
+    // ACCESSORS
+    double operator()() const
+        // Run the sample and return its elapsed time in seconds.
+    {
+        const bsls::Types::Int64 startTime = bsls::TimeUtil::getTimer();
+
+        for (int i = 0; i < d_numIterations; ++i) {
+            AllocatorHolder<ALLOCATOR> holder;
+
+            bsl::vector<bsl::vector<char> > elements(holder.allocator());
+            for (int j = 0; j < d_numElements; ++j) {
+                elements.resize(elements.size() + 1);
+                elements.back().resize(d_elementSize);
+            }
+            g_sink = g_sink + elements.size();
+        }
+        return elapsedSeconds(startTime);
+    }
+};
+
+template <class ALLOCATOR>
+void runSizes(const Config& config, Reporter *reporter)
+    // Measure the 'sizes' workload for the specified 'ALLOCATOR' type, as
+    // configured by the specified 'config', and report the results to the
+    // specified 'reporter'.
+{
+    typedef AllocatorTraits<ALLOCATOR> Traits;
+
+    const int k_BUDGET = 1 << 20;  // bytes held by the elements of a vector
+
+    for (int size = 8; size <= 4096; size *= 2) {
+        SizesSample<ALLOCATOR> sample;
+        sample.d_numIterations = 20 * config.d_scale;
+        sample.d_numElements   = k_BUDGET / size;
+        sample.d_elementSize   = size;
+
+        const bsls::Types::Int64 numOperations =
+                  static_cast<bsls::Types::Int64>(sample.d_numIterations)
+                                                        * sample.d_numElements;
+
+        char variant[32];
+        bsl::sprintf(variant, "size=%d", size);
+
+        reporter->report("sizes",
+                         variant,
+                         Traits::name(),
+                         numOperations,
+                         measure(sample, config.d_repetitions));
+    }
+}
+
+                             // =================
+                             // workload: threads
+                             // =================
+
+typedef bdlcc::FixedQueue<void *> MessageQueue;
+
+const int k_MESSAGE_SIZES[] = { 16, 24, 40, 64, 96, 200, 512, 1000 };
+const int k_NUM_MESSAGE_SIZES = static_cast<int>(
+                         sizeof k_MESSAGE_SIZES / sizeof *k_MESSAGE_SIZES);
+
+struct Producer {
+    // This 'struct' provides a thread function that allocates messages and
+    // pushes them onto a queue.
+
+    // DATA
+    MessageQueue     *d_queue_p;      // destination of the messages
+    bslma::Allocator *d_allocator_p;  // source of the messages
+    bslmt::Barrier   *d_barrier_p;    // start of the measurement
+    int               d_numMessages;  // messages to produce
+
+    // ACCESSORS
+    void operator()() const
+    {
+        d_barrier_p->wait();
+
+        for (int i = 0; i < d_numMessages; ++i) {
+            const int size = k_MESSAGE_SIZES[i % k_NUM_MESSAGE_SIZES];
+
+            // Each message is accompanied by a short-lived local block.
+
+            void *local = d_allocator_p->allocate(
+                         k_MESSAGE_SIZES[(i + 3) % k_NUM_MESSAGE_SIZES]);
+            *static_cast<int *>(local) = i;
+            d_allocator_p->deallocate(local);
+
+            void *message = d_allocator_p->allocate(size);
+            *static_cast<int *>(message) = i;
+            d_queue_p->pushBack(message);
+        }
+    }
+};
+
+struct Consumer {
+    // This 'struct' provides a thread function that pops messages from a
+    // queue and deallocates them.
+
+    // DATA
+    MessageQueue     *d_queue_p;      // source of the messages
+    bslma::Allocator *d_allocator_p;  // allocator of the messages
+    bslmt::Barrier   *d_barrier_p;    // start of the measurement
+    int               d_numMessages;  // messages to consume
+
+    // ACCESSORS
+    void operator()() const
+    {
+        d_barrier_p->wait();
+
+        bsl::size_t sum = 0;
+        for (int i = 0; i < d_numMessages; ++i) {
+            void *message = d_queue_p->popFront();
+            sum += *static_cast<int *>(message);
+            d_allocator_p->deallocate(message);
+        }
+        g_sink = g_sink + sum;
+    }
+};
+
+template <class ALLOCATOR>
+struct ThreadsSample {
+    // This 'struct' template runs pairs of producer and consumer threads that
+    // share one object of the specified 'ALLOCATOR' type.
+
+    // DATA
+    int d_numPairs;     // producer-consumer pairs
+    int d_numMessages;  // messages sent by each producer
+
+    // ACCESSORS
+    double operator()() const
+        // Run the sample and return its elapsed time in seconds.
+    {
+        bslma::Allocator           *da = bslma::Default::allocator();
+        AllocatorHolder<ALLOCATOR>  holder;
+        bslmt::Barrier              barrier(2 * d_numPairs + 1);
+
+        bsl::vector<MessageQueue *>              queues(da);
+        bsl::vector<bslmt::ThreadUtil::Handle> handles(da);
+
+        for (int i = 0; i < d_numPairs; ++i) {
+            queues.push_back(new (*da) MessageQueue(1024, da));
+
+            Producer producer = { queues.back(),
+                                  holder.allocator(),
+                                  &barrier,
+                                  d_numMessages };
+            Consumer consumer = { queues.back(),
+                                  holder.allocator(),
+                                  &barrier,
+                                  d_numMessages };
+
+            bslmt::ThreadUtil::Handle handle;
+            if (0 != bslmt::ThreadUtil::create(&handle, producer)) {
+                bsl::fprintf(stderr, "Failed to create thread.\n");
+                bsl::exit(1);
+            }
+            handles.push_back(handle);
+            if (0 != bslmt::ThreadUtil::create(&handle, consumer)) {
+                bsl::fprintf(stderr, "Failed to create thread.\n");
+                bsl::exit(1);
+            }
+            handles.push_back(handle);
+        }
+
+        barrier.wait();
+        const bsls::Types::Int64 startTime = bsls::TimeUtil::getTimer();
+
+        for (bsl::size_t i = 0; i < handles.size(); ++i) {
+            bslmt::ThreadUtil::join(handles[i]);
+        }
+
+        const double result = elapsedSeconds(startTime);
+
+        for (bsl::size_t i = 0; i < queues.size(); ++i) {
+            da->deleteObject(queues[i]);
+        }
+        return result;
+    }
+};
+
+template <class ALLOCATOR>
+void runThreads(const Config& config, Reporter *reporter)
+    // Measure the 'threads' workload for the specified 'ALLOCATOR' type, as
+    // configured by the specified 'config', and report the results to the
+    // specified 'reporter'.
+{
+    typedef AllocatorTraits<ALLOCATOR> Traits;
+
+    if (!Traits::k_IS_THREAD_SAFE) {
+        return;                                                       // RETURN
+    }
+
+    ThreadsSample<ALLOCATOR> sample;
+    sample.d_numPairs    = config.d_numPairs;
+    sample.d_numMessages = 100000 * config.d_scale;
+
+    char variant[32];
+    bsl::sprintf(variant, "pairs=%d", sample.d_numPairs);
+
+    reporter->report("threads",
+                     variant,
+                     Traits::name(),
+                     static_cast<bsls::Types::Int64>(sample.d_numPairs)
+                                                        * sample.d_numMessages,
+                     measure(sample, config.d_repetitions));
+}
+
+                               // ============
+                               // dispatching
+                               // ============
+
+enum Workload {
+    e_CHURN,
+    e_LOCALITY,
+    e_SIZES,
+    e_THREADS
+};
+
+const char *const k_WORKLOAD_NAMES[] = {
+    "churn",
+    "locality",
+    "sizes",
+    "threads"
+};
+
+template <class ALLOCATOR>
+void run(Workload workload, const Config& config, Reporter *reporter)
+    // Measure the specified 'workload' for the specified 'ALLOCATOR' type if
+    // it is selected by the specified 'config', and report the results to
+    // the specified 'reporter'.
+{
+    if (!config.selectsAllocator(AllocatorTraits<ALLOCATOR>::name())) {
+        return;                                                       // RETURN
+    }
+
+    switch (workload) {
+      case e_CHURN: {
+        runChurn<ALLOCATOR>(config, reporter);
+      } break;
+      case e_LOCALITY: {
+        runLocality<ALLOCATOR>(config, reporter);
+      } break;
+      case e_SIZES: {
+        runSizes<ALLOCATOR>(config, reporter);
+      } break;
+      case e_THREADS: {
+        runThreads<ALLOCATOR>(config, reporter);
+      } break;
+    }
+}
+
+void usage(const char *program)
+    // Write the usage of the specified 'program' to 'stderr'.
+{
+    bsl::fprintf(stderr,
+                 "usage: %s [--format=text|csv|json] [--scale=<n>]\n"
+                 "       [--repetitions=<n>] [--threads=<n>]\n"
+                 "       [--workloads=<name>[,<name>...]]\n"
+                 "       [--allocators=<name>[,<name>...]]\n"
+                 "workloads:  churn locality sizes threads\n"
+                 "allocators: newdelete sequential localsequential"
+                 " multipool\n"
+                 "            concurrentmultipool sizeclassmultipool"
+                 " threadcaching\n"
+                 "            hugepage\n",
+                 program);
+}
+
+bool parsePositive(int *result, const char *value)
+    // Load into the specified 'result' the positive integer represented by
+    // the specified 'value'.  Return 'true' on success, and 'false' if
+    // 'value' does not represent a positive integer.
+{
+    char *end;
+    long  number = bsl::strtol(value, &end, 10);
+    if (*value == '\0' || *end != '\0' || number < 1 || number > 1000000) {
+        return false;                                                 // RETURN
+    }
+    *result = static_cast<int>(number);
+    return true;
+}
+
+int parse(Config *config, int argc, char *argv[])
+    // Load into the specified 'config' the options specified by 'argc' and
+    // 'argv'.  Return 0 on success, and a non-zero value otherwise.
+{
+    for (int i = 1; i < argc; ++i) {
+        const char *arg   = argv[i];
+        const char *value = bsl::strchr(arg, '=');
+        if (!value) {
+            return -1;                                                // RETURN
+        }
+        const bsl::string option(arg, value);
+        ++value;
+
+        if (option == "--format") {
+            if (0 == bsl::strcmp(value, "text")) {
+                config->d_format = Config::e_TEXT;
+            }
+            else if (0 == bsl::strcmp(value, "csv")) {
+                config->d_format = Config::e_CSV;
+            }
+            else if (0 == bsl::strcmp(value, "json")) {
+                config->d_format = Config::e_JSON;
+            }
+            else {
+                return -1;                                            // RETURN
+            }
+        }
+        else if (option == "--scale") {
+            if (!parsePositive(&config->d_scale, value)) {
+                return -1;                                            // RETURN
+            }
+        }
+        else if (option == "--repetitions") {
+            if (!parsePositive(&config->d_repetitions, value)) {
+                return -1;                                            // RETURN
+            }
+        }
+        else if (option == "--threads") {
+            if (!parsePositive(&config->d_numPairs, value)) {
+                return -1;                                            // RETURN
+            }
+        }
+        else if (option == "--workloads") {
+            config->d_workloads = value;
+        }
+        else if (option == "--allocators") {
+            config->d_allocators = value;
+        }
+        else {
+            return -1;                                                // RETURN
+        }
+    }
+    return 0;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    Config config;
+    if (0 != parse(&config, argc, argv)) {
+        usage(argv[0]);
+        return 1;                                                     // RETURN
+    }
+
+    Reporter reporter(config.d_format);
+
+    const int k_NUM_WORKLOADS = static_cast<int>(
+                        sizeof k_WORKLOAD_NAMES / sizeof *k_WORKLOAD_NAMES);
+
+    for (int i = 0; i < k_NUM_WORKLOADS; ++i) {
+        if (!config.selectsWorkload(k_WORKLOAD_NAMES[i])) {
+            continue;
+        }
+
+        const Workload workload = static_cast<Workload>(i);
+
+        run<bslma::NewDeleteAllocator>(workload, config, &reporter);
+        run<bdlma::SequentialAllocator>(workload, config, &reporter);
+        run<bdlma::LocalSequentialAllocator<65536> >(workload,
+                                                     config,
+                                                     &reporter);
+        run<bdlma::MultipoolAllocator>(workload, config, &reporter);
+        run<bdlma::ConcurrentMultipoolAllocator>(workload, config, &reporter);
+        run<bdlma::SizeClassMultipoolAllocator>(workload, config, &reporter);
+        run<bdlma::ThreadCachingAllocator>(workload, config, &reporter);
+        run<HugePageSequentialAllocator>(workload, config, &reporter);
+    }
+    return 0;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
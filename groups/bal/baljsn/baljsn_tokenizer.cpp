@@ -6,13 +6,24 @@ BSLS_IDENT_RCSID(baljsn_tokenizer_cpp,"$Id$ $CSID$")
 
 #include <baljsn_parserutil.h>                 // for testing only
 
-#include <bdlb_chartype.h>
+#include <bdlb_bitutil.h>
 #include <bdlde_utf8util.h>
 #include <bdlsb_fixedmemoutstreambuf.h>
 
+#include <bsls_platform.h>
+
+#include <bsl_cstdint.h>
 #include <bsl_cstring.h>
 #include <bsl_ios.h>
 
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+#include <emmintrin.h>
+#endif
+
+#if defined(BSLS_PLATFORM_CPU_AVX2)
+#include <immintrin.h>
+#endif
+
 // IMPLEMENTATION NOTES
 // --------------------
 // The following table provides the various transitions that need to be handled
@@ -53,12 +64,273 @@ BSLS_IDENT_RCSID(baljsn_tokenizer_cpp,"$Id$ $CSID$")
 //   END_OBJECT                   '}'         ']'              END_ARRAY
 //   END_ARRAY                    ']'         ']'              END_ARRAY
 //..
+//
+// The characters of the input are not examined one at a time to skip
+// whitespace, to find the end of a string (an unescaped '"'), or to find the
+// end of a non-string value (whitespace or a structural character).  Instead,
+// the 'findFirst' function template loads blocks of 32 (with AVX2) or 16 (with
+// SSE2) characters, compares each block with the characters of interest, and
+// converts the comparison to a bit mask whose lowest set bit, if any, is the
+// position of the character sought, in the manner of the first stage of
+// 'simdjson'.  Strings and whitespace without escapes are thereby skipped a
+// block at a time; only the final characters of the buffer (or, without SIMD
+// support, all of them) are classified one at a time using a table.  The
+// block width is fixed when this component is compiled (see the component
+// documentation in the header for why the kernel is not selected at run
+// time).
 
 namespace BloombergLP {
 namespace {
 
-    static const char *WHITESPACE = " \n\t\v\f\r";
-    static const char *TOKENS     = "{}[]:,";
+enum CharClass {
+    // The classes of the characters of the input.  Note that, for
+    // compatibility, a '\0' character ends a non-string value.
+
+    e_WHITESPACE     = 0x1,  // ' ', '\t', '\n', '\v', '\f', or '\r'
+    e_VALUE_END      = 0x2,  // whitespace, '{', '}', '[', ']', ':', ',', '\0'
+    e_STRING_SPECIAL = 0x4   // '"' or '\\'
+};
+
+static const unsigned char k_CHAR_CLASS[256] = {
+    // The 'CharClass' bits of each character.
+
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0,  // 00
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 10
+    3, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0,  // 20
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0,  // 30
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 40
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 2, 0, 0,  // 50
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 60
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 0, 0,  // 70
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 80
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // 90
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // A0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // B0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // C0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // D0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,  // E0
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0   // F0
+};
+
+inline
+int charClass(char character)
+    // Return the 'CharClass' bits of the specified 'character'.
+{
+    return k_CHAR_CLASS[static_cast<unsigned char>(character)];
+}
+
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+inline
+__m128i whitespaceBytes(__m128i block)
+    // Return a vector whose bytes are all ones for each whitespace character
+    // of the specified 'block', and zero otherwise.
+{
+    // '\t', '\n', '\v', '\f', and '\r' are the contiguous codes 9 to 13.
+
+    const __m128i offset  = _mm_sub_epi8(block, _mm_set1_epi8('\t'));
+    const __m128i inRange = _mm_cmpeq_epi8(
+                                 _mm_min_epu8(offset, _mm_set1_epi8(4)),
+                                 offset);
+
+    return _mm_or_si128(inRange, _mm_cmpeq_epi8(block, _mm_set1_epi8(' ')));
+}
+#endif
+
+#if defined(BSLS_PLATFORM_CPU_AVX2)
+inline
+__m256i whitespaceBytes(__m256i block)
+    // Return a vector whose bytes are all ones for each whitespace character
+    // of the specified 'block', and zero otherwise.
+{
+    const __m256i offset  = _mm256_sub_epi8(block, _mm256_set1_epi8('\t'));
+    const __m256i inRange = _mm256_cmpeq_epi8(
+                              _mm256_min_epu8(offset, _mm256_set1_epi8(4)),
+                              offset);
+
+    return _mm256_or_si256(inRange,
+                           _mm256_cmpeq_epi8(block, _mm256_set1_epi8(' ')));
+}
+#endif
+
+                        // ===========================
+                        // struct NonWhitespaceMatcher
+                        // ===========================
+
+struct NonWhitespaceMatcher {
+    // This 'struct' matches the characters that are not whitespace.
+
+    static bool match(char character)
+        // Return 'true' if the specified 'character' is not whitespace, and
+        // 'false' otherwise.
+    {
+        return 0 == (charClass(character) & e_WHITESPACE);
+    }
+
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+    static bsl::uint32_t match(__m128i block)
+        // Return a mask whose bit 'i' is set if byte 'i' of the specified
+        // 'block' is not whitespace.
+    {
+        return ~static_cast<bsl::uint32_t>(
+                         _mm_movemask_epi8(whitespaceBytes(block))) & 0xFFFF;
+    }
+#endif
+
+#if defined(BSLS_PLATFORM_CPU_AVX2)
+    static bsl::uint32_t match(__m256i block)
+        // Return a mask whose bit 'i' is set if byte 'i' of the specified
+        // 'block' is not whitespace.
+    {
+        return ~static_cast<bsl::uint32_t>(
+                                 _mm256_movemask_epi8(whitespaceBytes(block)));
+    }
+#endif
+};
+
+                           // ======================
+                           // struct ValueEndMatcher
+                           // ======================
+
+struct ValueEndMatcher {
+    // This 'struct' matches the characters that end a non-string value:
+    // whitespace, structural characters, and '\0'.
+
+    static bool match(char character)
+        // Return 'true' if the specified 'character' ends a non-string value,
+        // and 'false' otherwise.
+    {
+        return 0 != (charClass(character) & e_VALUE_END);
+    }
+
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+    static bsl::uint32_t match(__m128i block)
+        // Return a mask whose bit 'i' is set if byte 'i' of the specified
+        // 'block' ends a non-string value.
+    {
+        // Setting bit 5 maps '[' to '{' and ']' to '}' (and no other
+        // character to either).
+
+        const __m128i folded = _mm_or_si128(block, _mm_set1_epi8(0x20));
+
+        __m128i result = whitespaceBytes(block);
+        result = _mm_or_si128(result,
+                              _mm_cmpeq_epi8(folded, _mm_set1_epi8('{')));
+        result = _mm_or_si128(result,
+                              _mm_cmpeq_epi8(folded, _mm_set1_epi8('}')));
+        result = _mm_or_si128(result,
+                              _mm_cmpeq_epi8(block, _mm_set1_epi8(':')));
+        result = _mm_or_si128(result,
+                              _mm_cmpeq_epi8(block, _mm_set1_epi8(',')));
+        result = _mm_or_si128(result,
+                              _mm_cmpeq_epi8(block, _mm_setzero_si128()));
+
+        return static_cast<bsl::uint32_t>(_mm_movemask_epi8(result));
+    }
+#endif
+
+#if defined(BSLS_PLATFORM_CPU_AVX2)
+    static bsl::uint32_t match(__m256i block)
+        // Return a mask whose bit 'i' is set if byte 'i' of the specified
+        // 'block' ends a non-string value.
+    {
+        const __m256i folded = _mm256_or_si256(block,
+                                               _mm256_set1_epi8(0x20));
+
+        __m256i result = whitespaceBytes(block);
+        result = _mm256_or_si256(result,
+                           _mm256_cmpeq_epi8(folded, _mm256_set1_epi8('{')));
+        result = _mm256_or_si256(result,
+                           _mm256_cmpeq_epi8(folded, _mm256_set1_epi8('}')));
+        result = _mm256_or_si256(result,
+                           _mm256_cmpeq_epi8(block, _mm256_set1_epi8(':')));
+        result = _mm256_or_si256(result,
+                           _mm256_cmpeq_epi8(block, _mm256_set1_epi8(',')));
+        result = _mm256_or_si256(result,
+                           _mm256_cmpeq_epi8(block, _mm256_setzero_si256()));
+
+        return static_cast<bsl::uint32_t>(_mm256_movemask_epi8(result));
+    }
+#endif
+};
+
+                        // ===========================
+                        // struct StringSpecialMatcher
+                        // ===========================
+
+struct StringSpecialMatcher {
+    // This 'struct' matches the characters that may end a string: '"' and
+    // '\\'.
+
+    static bool match(char character)
+        // Return 'true' if the specified 'character' is '"' or '\\', and
+        // 'false' otherwise.
+    {
+        return 0 != (charClass(character) & e_STRING_SPECIAL);
+    }
+
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+    static bsl::uint32_t match(__m128i block)
+        // Return a mask whose bit 'i' is set if byte 'i' of the specified
+        // 'block' is '"' or '\\'.
+    {
+        return static_cast<bsl::uint32_t>(_mm_movemask_epi8(_mm_or_si128(
+                              _mm_cmpeq_epi8(block, _mm_set1_epi8('"')),
+                              _mm_cmpeq_epi8(block, _mm_set1_epi8('\\')))));
+    }
+#endif
+
+#if defined(BSLS_PLATFORM_CPU_AVX2)
+    static bsl::uint32_t match(__m256i block)
+        // Return a mask whose bit 'i' is set if byte 'i' of the specified
+        // 'block' is '"' or '\\'.
+    {
+        return static_cast<bsl::uint32_t>(
+                         _mm256_movemask_epi8(_mm256_or_si256(
+                          _mm256_cmpeq_epi8(block, _mm256_set1_epi8('"')),
+                          _mm256_cmpeq_epi8(block, _mm256_set1_epi8('\\')))));
+    }
+#endif
+};
+
+template <class MATCHER>
+inline
+bsl::size_t findFirst(const char *begin, const char *end)
+    // Return the offset, from the specified 'begin', of the first character
+    // in the range '[begin, end)', for the specified 'end', matched by the
+    // (template parameter) 'MATCHER', or 'end - begin' if there is no such
+    // character.
+{
+    const char *current = begin;
+
+#if defined(BSLS_PLATFORM_CPU_AVX2)
+    for (; end - current >= 32; current += 32) {
+        const bsl::uint32_t mask = MATCHER::match(_mm256_loadu_si256(
+                      static_cast<const __m256i *>(
+                                      static_cast<const void *>(current))));
+        if (mask) {
+            return current - begin
+                 + bdlb::BitUtil::numTrailingUnsetBits(mask);         // RETURN
+        }
+    }
+#endif
+
+#if defined(BSLS_PLATFORM_CPU_SSE2)
+    for (; end - current >= 16; current += 16) {
+        const bsl::uint32_t mask = MATCHER::match(_mm_loadu_si128(
+                      static_cast<const __m128i *>(
+                                      static_cast<const void *>(current))));
+        if (mask) {
+            return current - begin
+                 + bdlb::BitUtil::numTrailingUnsetBits(mask);         // RETURN
+        }
+    }
+#endif
+
+    while (current < end && !MATCHER::match(*current)) {
+        ++current;
+    }
+    return current - begin;
+}
 
 }  // close unnamed namespace
 
@@ -205,17 +477,32 @@ int Tokenizer::extractStringValue()
     char previousChar = 0;
 
     while (true) {
-        while (d_valueIter < d_stringBuffer.length()
-            && '"' != d_stringBuffer[d_valueIter]) {
+        const char        *data   = d_stringBuffer.data();
+        const bsl::size_t  length = d_stringBuffer.length();
 
-            if ('\\' == d_stringBuffer[d_valueIter]
-             && '\\' == previousChar) {
+        while (d_valueIter < length) {
+            // Skip, in bulk, the characters that are neither '"' nor '\\'.
+
+            const bsl::size_t next = d_valueIter
+                                   + findFirst<StringSpecialMatcher>(
+                                                        data + d_valueIter,
+                                                        data + length);
+            if (next != d_valueIter) {
                 previousChar = 0;
+                d_valueIter  = next;
+                if (d_valueIter >= length) {
+                    break;
+                }
             }
-            else {
-                previousChar = d_stringBuffer[d_valueIter];
+
+            if ('"' == data[d_valueIter]) {
+                break;
             }
 
+            // A backslash either escapes the next character or is itself
+            // escaped.
+
+            previousChar = '\\' == previousChar ? 0 : '\\';
             ++d_valueIter;
         }
 
@@ -266,10 +553,12 @@ int Tokenizer::skipNonWhitespaceOrTillToken()
     bool firstTime = true;
 
     while (true) {
-        while (d_valueIter < d_stringBuffer.length()
-            && !bdlb::CharType::isSpace(d_stringBuffer[d_valueIter])
-            && !bsl::strchr(TOKENS, d_stringBuffer[d_valueIter])) {
-            ++d_valueIter;
+        if (d_valueIter < d_stringBuffer.length()) {
+            const char *data = d_stringBuffer.data();
+
+            d_valueIter += findFirst<ValueEndMatcher>(
+                                         data + d_valueIter,
+                                         data + d_stringBuffer.length());
         }
 
         if (d_valueIter >= d_stringBuffer.length()) {
@@ -310,11 +599,19 @@ int Tokenizer::skipNonWhitespaceOrTillToken()
 int Tokenizer::skipWhitespace()
 {
     while (true) {
-        bsl::size_t pos = d_stringBuffer.find_first_not_of(WHITESPACE,
-                                                           d_cursor);
-        if (bsl::string::npos != pos) {
-            d_cursor = pos;
-            break;
+        const bsl::size_t length = d_stringBuffer.length();
+
+        if (d_cursor < length) {
+            const char *data = d_stringBuffer.data();
+
+            const bsl::size_t pos = d_cursor
+                                  + findFirst<NonWhitespaceMatcher>(
+                                                           data + d_cursor,
+                                                           data + length);
+            if (pos < length) {
+                d_cursor = pos;
+                break;
+            }
         }
 
         const int numRead = reloadStringBuffer();
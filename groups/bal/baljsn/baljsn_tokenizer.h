@@ -27,6 +27,15 @@ BSLS_IDENT("$Id: $")
 // but not all such errors are detected.  In particular, callers should check
 // that closing brackets and braces match opening ones.
 //
+// On x86 platforms, the tokenizer skips whitespace and string contents 16
+// characters at a time using SSE2, or 32 at a time if the component is built
+// for a target supporting AVX2 (i.e., 'BSLS_PLATFORM_CPU_AVX2' is defined).
+// The choice is made at compile time, not by run-time CPU detection: the
+// scans are inlined into the per-token parsing loop, and typical scans are
+// short enough that an indirect call to a dispatched kernel would cost more
+// than the wider loads save.  SSE2 is part of the x86-64 baseline, so only
+// builds targeting AVX2 use the 32-character scans.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
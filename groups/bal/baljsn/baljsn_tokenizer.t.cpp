@@ -13,6 +13,9 @@
 #include <bslma_defaultallocatorguard.h>
 #include <bslma_testallocator.h>
 
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
 #include <bsl_algorithm.h>
 #include <bsl_cfloat.h>
 #include <bsl_climits.h>
@@ -66,7 +69,9 @@ using bsl::endl;
 // [17] bool allowNonUtf8StringLiterals() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [18] USAGE EXAMPLE
+// [18] BULK SCANNING OF WHITESPACE, STRINGS, AND VALUES
+// [19] USAGE EXAMPLE
+// [-1] PERFORMANCE: TOKENIZING A LARGE DOCUMENT
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -489,7 +494,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 18: {
+      case 19: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -611,6 +616,162 @@ int main(int argc, char *argv[])
     ASSERT(10022           == address.d_zipcode);
 //..
       } break;
+      case 18: {
+        // --------------------------------------------------------------------
+        // BULK SCANNING OF WHITESPACE, STRINGS, AND VALUES
+        //
+        // Concerns:
+        //: 1 Runs of whitespace of any length, and at any offset relative to
+        //:   the blocks scanned at once, are skipped.
+        //:
+        //: 2 A string ends at the first '"' that is not escaped, whatever the
+        //:   length of the string and the positions of its escapes: '\"'
+        //:   does not end a string, and '\\' escapes only itself.
+        //:
+        //: 3 A non-string value ends at the first whitespace or structural
+        //:   character, whatever its length.
+        //:
+        //: 4 Whitespace, strings, and escapes spanning the end of the
+        //:   internal buffer are handled.
+        //
+        // Plan:
+        //: 1 For runs of whitespace (cycling through the six whitespace
+        //:   characters) of lengths 0 to 70, strings of lengths 0 to 70 having
+        //:   no escape or a '\"' or '\\' escape at each position, and numbers
+        //:   of lengths 1 to 70, tokenize an array of the string and the
+        //:   number separated by the whitespace, and verify the tokens and
+        //:   values.  (C-1..3)
+        //:
+        //: 2 Repeat P-1 for a few lengths after prefixing the array with
+        //:   nearly a buffer-full of whitespace.  (C-4)
+        //
+        // Testing:
+        //   BULK SCANNING OF WHITESPACE, STRINGS, AND VALUES
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            cout << "\nBULK SCANNING OF WHITESPACE, STRINGS, AND VALUES"
+                 << "\n================================================"
+                 << endl;
+
+        const char WHITESPACE[] = " \n\t\v\f\r";
+        const char *const ESCAPES[] = { "", "\\\"", "\\\\" };
+
+        enum { k_MAX_LENGTH = 70, k_NUM_ESCAPES = 3 };
+
+        const int BUFFER_SIZE = 8 * 1024 - 1;
+        const int PREFIXES[]  = { 0, BUFFER_SIZE - 40, BUFFER_SIZE - 3 };
+        const int NUM_PREFIXES = static_cast<int>(sizeof PREFIXES /
+                                                  sizeof *PREFIXES);
+
+        for (int pi = 0; pi < NUM_PREFIXES; ++pi) {
+            const int PREFIX = PREFIXES[pi];
+            const int STEP   = 0 == PREFIX ? 1 : 7;
+
+            for (int length = 0; length <= k_MAX_LENGTH; length += STEP) {
+            for (int ei = 0; ei < k_NUM_ESCAPES; ++ei) {
+            for (int position = 0;
+                 position <= (0 == ei ? 0 : length);
+                 position += STEP) {
+                bsl::string whitespace;
+                for (int i = 0; i < length; ++i) {
+                    whitespace += WHITESPACE[(i + position) % 6];
+                }
+
+                bsl::string content(position, 'a');
+                content += ESCAPES[ei];
+                content.append(length - position, 'b');
+
+                bsl::string number(length + 1, '1');
+
+                const bsl::string STRING = '"' + content + '"';
+
+                bsl::string input(PREFIX, ' ');
+                input += '[';
+                input += whitespace;
+                input += STRING;
+                input += whitespace;
+                input += ',';
+                input += whitespace;
+                input += number;
+                input += whitespace;
+                input += ']';
+
+                if (veryVerbose) { T_ P_(PREFIX) P_(length) P(ei) }
+
+                bdlsb::FixedMemInStreamBuf isb(input.data(), input.length());
+
+                Obj mX;  const Obj& X = mX;
+                mX.reset(&isb);
+
+                bsl::string_view value;
+
+                ASSERTV(PREFIX, length, ei, position,
+                        0 == mX.advanceToNextToken());
+                ASSERTV(PREFIX, length, ei, position,
+                        Obj::e_START_ARRAY == X.tokenType());
+
+                ASSERTV(PREFIX, length, ei, position,
+                        0 == mX.advanceToNextToken());
+                ASSERTV(PREFIX, length, ei, position,
+                        Obj::e_ELEMENT_VALUE == X.tokenType());
+                ASSERTV(PREFIX, length, ei, position,
+                        0 == X.value(&value));
+                ASSERTV(PREFIX, length, ei, position, value,
+                        STRING == value);
+
+                ASSERTV(PREFIX, length, ei, position,
+                        0 == mX.advanceToNextToken());
+                ASSERTV(PREFIX, length, ei, position,
+                        Obj::e_ELEMENT_VALUE == X.tokenType());
+                ASSERTV(PREFIX, length, ei, position,
+                        0 == X.value(&value));
+                ASSERTV(PREFIX, length, ei, position, value,
+                        number == value);
+
+                ASSERTV(PREFIX, length, ei, position,
+                        0 == mX.advanceToNextToken());
+                ASSERTV(PREFIX, length, ei, position,
+                        Obj::e_END_ARRAY == X.tokenType());
+            }
+            }
+            }
+        }
+
+        if (verbose) cout << "\tEach character ending a value." << endl;
+        {
+            const char *const ENDS[] = { " ", "\n", "\t", "\v", "\f", "\r",
+                                         ",", "]" };
+            const int NUM_ENDS = static_cast<int>(sizeof ENDS / sizeof *ENDS);
+
+            for (int ni = 0; ni < NUM_ENDS; ++ni) {
+                for (int length = 1; length <= k_MAX_LENGTH; ++length) {
+                    const bsl::string NUMBER(length, '2');
+
+                    bsl::string input("[");
+                    input += NUMBER;
+                    input += ENDS[ni];
+                    if (']' != *ENDS[ni]) {
+                        input += "]";
+                    }
+
+                    bdlsb::FixedMemInStreamBuf isb(input.data(),
+                                                   input.length());
+
+                    Obj mX;  const Obj& X = mX;
+                    mX.reset(&isb);
+
+                    bsl::string_view value;
+
+                    ASSERTV(ni, length, 0 == mX.advanceToNextToken());
+                    ASSERTV(ni, length, 0 == mX.advanceToNextToken());
+                    ASSERTV(ni, length, Obj::e_ELEMENT_VALUE == X.tokenType());
+                    ASSERTV(ni, length, 0 == X.value(&value));
+                    ASSERTV(ni, length, value, NUMBER == value);
+                }
+            }
+        }
+      } break;
       case 17: {
         // --------------------------------------------------------------------
         // TESTING UTF8
@@ -7268,6 +7429,72 @@ int main(int argc, char *argv[])
         Obj mX;  const Obj& X = mX;
         ASSERTV(X.tokenType(), Obj::e_BEGIN == X.tokenType());
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: TOKENIZING A LARGE DOCUMENT
+        //
+        // Concerns:
+        //: 1 Report the throughput of 'advanceToNextToken' on a document
+        //:   having indentation, long strings, and numbers.
+        //
+        // Plan:
+        //: 1 Generate a pretty-printed array of objects of a few megabytes,
+        //:   tokenize it (optionally, the number of times given by the second
+        //:   argument), and report the throughput.
+        //
+        // Testing:
+        //   PERFORMANCE: TOKENIZING A LARGE DOCUMENT
+        // --------------------------------------------------------------------
+
+        cout << "\nPERFORMANCE: TOKENIZING A LARGE DOCUMENT"
+             << "\n========================================" << endl;
+
+        const int NUM_ITERATIONS = argc > 2 ? atoi(argv[2]) : 10;
+
+        bsl::string document("[\n");
+        for (int i = 0; i < 10000; ++i) {
+            bsl::ostringstream oss;
+            oss << (i ? ",\n" : "")
+                << "    {\n"
+                << "        \"name\": \"record number " << i
+                << " with an \\\"escaped\\\" quote\",\n"
+                << "        \"id\": " << 1000000 + i << ",\n"
+                << "        \"values\": [ 1.5, 2.25, 3.125, -4e10 ],\n"
+                << "        \"description\": \""
+                << bsl::string(200, 'x') << "\",\n"
+                << "        \"valid\": true\n"
+                << "    }";
+            document += oss.str();
+        }
+        document += "\n]\n";
+
+        bsls::Types::Int64 numTokens = 0;
+        bsls::Stopwatch    timer;
+
+        timer.start();
+        for (int iteration = 0; iteration < NUM_ITERATIONS; ++iteration) {
+            bdlsb::FixedMemInStreamBuf isb(document.data(),
+                                           document.length());
+
+            Obj mX;
+            mX.reset(&isb);
+
+            // 'advanceToNextToken' fails at the end of the input.
+
+            while (0 == mX.advanceToNextToken()) {
+                ++numTokens;
+            }
+        }
+        timer.stop();
+
+        const double megabytes = 1.0 * NUM_ITERATIONS * document.length()
+                               / (1024 * 1024);
+
+        cout << "Document size:  " << document.length() << " bytes\n"
+             << "Tokens:         " << numTokens / NUM_ITERATIONS << '\n'
+             << "Throughput:     " << megabytes / timer.elapsedTime()
+             << " MB/s" << endl;
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -155,6 +155,26 @@ bool isStopRecord(const AsyncFileObserver_Record& record)
                        // class AsyncFileObserver
                        // -----------------------
 
+void AsyncFileObserver::publishBatch()
+{
+    if (1 == d_batch.size()) {
+        d_fileObserver.publish(d_batch[0].d_record, d_batch[0].d_context);
+    }
+    else if (!d_batch.empty()) {
+        d_batchRecords.clear();
+        for (bsl::size_t i = 0; i < d_batch.size(); ++i) {
+            d_batchRecords.push_back(d_batch[i].d_record.get());
+        }
+        d_fileObserver.publishBatch(d_batchRecords.data(),
+                                    static_cast<int>(d_batchRecords.size()));
+    }
+
+    // Clearing (rather than deallocating) the batch releases the references
+    // to its records, while retaining capacity for the next batch.
+
+    d_batch.clear();
+}
+
 void AsyncFileObserver::publishThreadEntryPoint()
 {
     typedef bdlcc::BoundedQueue<AsyncFileObserver_Record> Status;
@@ -171,6 +191,11 @@ void AsyncFileObserver::publishThreadEntryPoint()
     bool done = false;
 
     while (!done) {
+        // Block until a record is available, then remove (without blocking)
+        // the records already on the queue, up to the maximum batch size.
+
+        const bsl::size_t maxBatchSize = d_maxBatchSize.loadRelaxed();
+
         AsyncFileObserver_Record record;
 
         int rc = d_recordQueue.popFront(&record);
@@ -179,13 +204,20 @@ void AsyncFileObserver::publishThreadEntryPoint()
                  || Status::e_DISABLED == rc
                  || Status::e_FAILED   == rc);
 
-        if (Status::e_SUCCESS == rc && !isStopRecord(record)) {
-            d_fileObserver.publish(record.d_record, record.d_context);
-        }
-        else {
-            done = true;
+        while (Status::e_SUCCESS == rc && !isStopRecord(record)) {
+            d_batch.push_back(record);
+            if (d_batch.size() >= maxBatchSize) {
+                break;
+            }
+            rc = d_recordQueue.tryPopFront(&record);
         }
 
+        done = Status::e_DISABLED == rc
+            || Status::e_FAILED   == rc
+            || (Status::e_SUCCESS == rc && isStopRecord(record));
+
+        publishBatch();
+
         // Publish the count of dropped records.  To avoid repeatedly
         // publishing this information when the record queue is full, we
         // publish the number of dropped records only when the queue becomes
@@ -223,6 +255,7 @@ void AsyncFileObserver::construct()
     d_threadHandle = bslmt::ThreadUtil::invalidHandle();
     d_threadState  = e_NOT_RUNNING;
     d_dropCount    = 0;
+    d_maxBatchSize = 1;
 
     d_publishThreadEntryPoint = bsl::function<void()>(
             bsl::allocator_arg_t(),
@@ -237,6 +270,8 @@ AsyncFileObserver::AsyncFileObserver(bslma::Allocator *basicAllocator)
 , d_recordQueue(k_DEFAULT_FIXED_QUEUE_SIZE, basicAllocator)
 , d_threadState(e_NOT_RUNNING)
 , d_dropRecordsOnFullQueueThreshold(Severity::e_OFF)
+, d_batch(basicAllocator)
+, d_batchRecords(basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     construct();
@@ -248,6 +283,8 @@ AsyncFileObserver::AsyncFileObserver(Severity::Level   stdoutThreshold,
 , d_recordQueue(k_DEFAULT_FIXED_QUEUE_SIZE, basicAllocator)
 , d_threadState(e_NOT_RUNNING)
 , d_dropRecordsOnFullQueueThreshold(Severity::e_OFF)
+, d_batch(basicAllocator)
+, d_batchRecords(basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     construct();
@@ -260,6 +297,8 @@ AsyncFileObserver::AsyncFileObserver(Severity::Level   stdoutThreshold,
 , d_recordQueue(k_DEFAULT_FIXED_QUEUE_SIZE, basicAllocator)
 , d_threadState(e_NOT_RUNNING)
 , d_dropRecordsOnFullQueueThreshold(Severity::e_OFF)
+, d_batch(basicAllocator)
+, d_batchRecords(basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     construct();
@@ -273,6 +312,8 @@ AsyncFileObserver::AsyncFileObserver(Severity::Level   stdoutThreshold,
 , d_recordQueue(maxRecordQueueSize, basicAllocator)
 , d_threadState(e_NOT_RUNNING)
 , d_dropRecordsOnFullQueueThreshold(Severity::e_OFF)
+, d_batch(basicAllocator)
+, d_batchRecords(basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     construct();
@@ -288,6 +329,8 @@ AsyncFileObserver::AsyncFileObserver(
 , d_recordQueue(maxRecordQueueSize, basicAllocator)
 , d_threadState(e_NOT_RUNNING)
 , d_dropRecordsOnFullQueueThreshold(dropRecordsOnFullQueueThreshold)
+, d_batch(basicAllocator)
+, d_batchRecords(basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     construct();
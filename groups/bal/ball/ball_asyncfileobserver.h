@@ -48,6 +48,7 @@ BSLS_IDENT("$Id: $")
 //                         |              rotateOnSize
 //                         |              rotateOnTimeInterval
 //                         |              setLogFormat
+//                         |              setMaxBatchSize
 //                         |              setOnFileRotationCallback
 //                         |              setStdoutThreshold
 //                         |              shutdownPublicationThread
@@ -58,6 +59,7 @@ BSLS_IDENT("$Id: $")
 //                         |              isPublicationThreadRunning
 //                         |              isPublishInLocalTimeEnabled
 //                         |              isStdoutLoggingPrefixEnabled
+//                         |              maxBatchSize
 //                         |              recordQueueLength
 //                         |              rotationLifetime
 //                         |              rotationSize
@@ -122,8 +124,9 @@ BSLS_IDENT("$Id: $")
 // |             | setOnFileRotationCallback   |                              |
 // +-------------+-----------------------------+------------------------------+
 // | Publication | startPublicationThread      | isPublicationThreadRunning   |
-// | Thread      | stopPublicationThread       |                              |
+// | Thread      | stopPublicationThread       | maxBatchSize                 |
 // | Management  | shutdownPublicationThread   |                              |
+// |             | setMaxBatchSize             |                              |
 // +-------------+-----------------------------+------------------------------+
 //..
 // In general, a 'ball::AsyncFileObserver' object can be dynamically configured
@@ -164,6 +167,31 @@ BSLS_IDENT("$Id: $")
 // record count is reset to 0 after each such warning is published, so each
 // dropped record is counted only once.
 //
+///Batched Publication
+///-------------------
+// By default, the publication thread removes one record at a time from the
+// queue, and writes it to the log file (and, depending on its severity, to
+// 'stdout') before removing the next one, which results in (at least) one
+// write to the log file per record.  When records are logged in bursts, the
+// cost of those writes may dominate the cost of logging.  The
+// 'setMaxBatchSize' method configures the publication thread to instead
+// remove, each time it wakes up, up to a specified number of records that are
+// already on the queue, and to publish them as a *batch*: the records of a
+// batch are formatted, in order, into a single buffer that is written to the
+// log file at once (see 'ball::FileObserver2::publishBatch').  Batching never
+// delays the publication of a record: a batch holds only those records that
+// are on the queue when the publication thread wakes up.
+//
+// The storage used to hold and format a batch is owned by the publication
+// thread and reused for each batch, so that, once it has grown to accommodate
+// the largest batch, the publication thread allocates no memory in publishing
+// records to the log file.  The references to the records of a batch are
+// released together once the batch is written, returning the records to the
+// pool from which the logger manager allocates them.  Note that, since the
+// need for log file rotation is determined once for each batch, a log file
+// may exceed the size configured by 'rotateOnSize' by (at most) the size of
+// one batch.
+//
 ///Log Record Formatting
 ///---------------------
 // By default, the output format of published log records (whether to 'stdout'
@@ -482,11 +510,13 @@ BSLS_IDENT("$Id: $")
 
 #include <bslmt_threadutil.h>
 
+#include <bsls_assert.h>
 #include <bsls_atomic.h>
 
 #include <bsl_functional.h>
 #include <bsl_memory.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 
 #ifdef BSLS_LIBRARYFEATURES_HAS_CPP17_PMR
 #include <memory_resource>  // 'std::pmr::polymorphic_allocator'
@@ -560,6 +590,22 @@ class AsyncFileObserver : public Observer {
                                                      // each time drop count is
                                                      // published
 
+    bsls::AtomicInt                d_maxBatchSize;   // maximum number of
+                                                     // records published by
+                                                     // the publication thread
+                                                     // each time it wakes up
+
+    bsl::vector<AsyncFileObserver_Record>
+                                   d_batch;          // records of the batch
+                                                     // being published (used
+                                                     // only by the publication
+                                                     // thread)
+
+    bsl::vector<const Record *>    d_batchRecords;   // addresses of the
+                                                     // records in 'd_batch'
+                                                     // (used only by the
+                                                     // publication thread)
+
     bsl::function<void()>          d_publishThreadEntryPoint;
                                                      // publication thread
                                                      // entry point functor
@@ -580,6 +626,11 @@ class AsyncFileObserver : public Observer {
         // constructor overloads.  Note that this method should be removed when
         // C++11 constructor chaining is available on all supported platforms.
 
+    void publishBatch();
+        // Publish the records in 'd_batch', to the log file and 'stdout', and
+        // release them.  The behavior is undefined unless this method is
+        // invoked from the publication thread.
+
     void publishThreadEntryPoint();
         // Publish records from the record queue, to the log file and 'stdout',
         // until signaled to stop.  The behavior is undefined if this method is
@@ -840,6 +891,14 @@ class AsyncFileObserver : public Observer {
         // received through the 'publish' method as well as those that are
         // currently on the queue.
 
+    void setMaxBatchSize(int value);
+        // Set the maximum number of records that the publication thread
+        // removes from the record queue, and publishes as a single batch, each
+        // time it wakes up to the specified 'value' (see {Batched
+        // Publication}).  A 'value' of 1 disables batched publication.  The
+        // behavior is undefined unless '0 < value'.  Note that this method
+        // takes effect the next time the publication thread wakes up.
+
     void setOnFileRotationCallback(
                              const OnFileRotationCallback& onRotationCallback);
         // Set the specified 'onRotationCallback' to be invoked after each time
@@ -949,6 +1008,12 @@ class AsyncFileObserver : public Observer {
         // !DEPRECATED!: Use 'bdlt::LocalTimeOffset' instead.
 #endif // BDE_OMIT_INTERNAL_DEPRECATED
 
+    int maxBatchSize() const;
+        // Return the maximum number of records that the publication thread
+        // publishes as a single batch each time it wakes up (see {Batched
+        // Publication}).  Note that a value of 1 indicates that batched
+        // publication is disabled, which is the default.
+
     bsl::size_t recordQueueLength() const;
         // Return the number of log records currently on the record queue of
         // this async file observer.
@@ -1061,6 +1126,14 @@ void AsyncFileObserver::setLogFormat(const char *logFileFormat,
     d_fileObserver.setLogFormat(logFileFormat, stdoutFormat);
 }
 
+inline
+void AsyncFileObserver::setMaxBatchSize(int value)
+{
+    BSLS_ASSERT(0 < value);
+
+    d_maxBatchSize.storeRelaxed(value);
+}
+
 inline
 void AsyncFileObserver::setOnFileRotationCallback(
                               const OnFileRotationCallback& onRotationCallback)
@@ -1140,6 +1213,12 @@ bdlt::DatetimeInterval AsyncFileObserver::localTimeOffset() const
 }
 #endif // BDE_OMIT_INTERNAL_DEPRECATED
 
+inline
+int AsyncFileObserver::maxBatchSize() const
+{
+    return d_maxBatchSize.loadRelaxed();
+}
+
 inline
 bsl::size_t AsyncFileObserver::recordQueueLength() const
 {
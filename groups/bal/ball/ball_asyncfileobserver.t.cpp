@@ -26,6 +26,7 @@
 #include <bslmt_barrier.h>
 #include <bslmt_threadutil.h>
 #include <bsls_assert.h>
+#include <bsls_asserttest.h>
 #include <bsls_platform.h>
 #include <bsls_stopwatch.h>
 #include <bsls_systemtime.h>
@@ -38,9 +39,12 @@
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
 #include <bsl_ctime.h>       // 'time_t'
+#include <bsl_fstream.h>
 #include <bsl_iomanip.h>     // 'setfill'
 #include <bsl_iostream.h>
 #include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
 
 #include <bsl_c_stdlib.h>    // 'unsetenv'
 
@@ -106,6 +110,7 @@ using bsl::flush;
 // [ 6] void rotateOnTimeInterval(const DatetimeInterval timeInterval);
 // [ 6] void rotateOnTimeInterval(const DatetimeI&, const Datetime&);
 // [ 1] void setLogFormat(const char* logF, const char* stdoutF);
+// [14] void setMaxBatchSize(int value);
 // [ 8] void setOnFileRotationCallback(const OnFileRotationCallback&);
 // [ 1] void setStdoutThreshold(ball::Severity::Level stdoutThreshold);
 // [ 3] void shutdownPublicationThread();
@@ -120,19 +125,21 @@ using bsl::flush;
 // [ 1] bool isPublishInLocalTimeEnabled() const;
 // [ 1] bool isStdoutLoggingPrefixEnabled() const;
 // [ 1] bool isUserFieldsLoggingEnabled() const;
+// [14] int maxBatchSize() const;
 // [11] int recordQueueLength() const;
 // [ 6] bdlt::DatetimeInterval rotationLifetime() const;
 // [ 6] int rotationSize() const;
 // [ 1] ball::Severity::Level stdoutThreshold() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
+// [14] CONCERN: BATCHED PUBLICATION
 // [13] CONCERN: MEMORY ACCESS AFTER RELEASERECORDS
 // [12] CONCERN: DEADLOCK ON RELEASERECORDS (DRQS 164688087)
 // [10] CONCERN: CONCURRENT PUBLICATION
 // [ 7] CONCERN: LOGGING TO A FAILING STREAM
 // [ 5] CONCERN: LOG MESSAGE DROP
 // [ 9] CONCERN: ROTATION
-// [14] USAGE EXAMPLE
+// [15] USAGE EXAMPLE
 
 // Note assert and debug macros all output to 'cerr' instead of cout, unlike
 // most other test drivers.  This is necessary because test case 2 plays tricks
@@ -697,7 +704,7 @@ int main(int argc, char *argv[])
     bslma::TestAllocator *Z = &allocator;
 
     switch (test) { case 0:
-      case 14: {
+      case 15: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -849,6 +856,140 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 14: {
+        // --------------------------------------------------------------------
+        // CONCERN: BATCHED PUBLICATION
+        //
+        // Concerns:
+        //:  1 The maximum batch size is 1 following construction.
+        //:
+        //:  2 'setMaxBatchSize' sets the value returned by 'maxBatchSize'.
+        //:
+        //:  3 For any maximum batch size, every record on the queue is
+        //:    written to the log file exactly once, in the order in which it
+        //:    was received by 'publish'.
+        //:
+        //:  4 The references to the published records are released once the
+        //:    records are published.
+        //:
+        //:  5 QoI: Asserted precondition violations are detected when
+        //:    enabled.
+        //
+        // Plan:
+        //:  1 Verify the value of 'maxBatchSize' following construction.
+        //:    (C-1)
+        //:
+        //:  2 For a set of maximum batch sizes, set the maximum batch size and
+        //:    verify the value of 'maxBatchSize'.  Publish a sequence of
+        //:    records with distinct messages while the publication thread is
+        //:    not running (so that batches are filled), then start and stop
+        //:    the publication thread, and verify that the log file holds
+        //:    the messages, in order, and that no other references to the
+        //:    records remain.  (C-2..4)
+        //:
+        //:  3 Verify that, in appropriate build modes, defensive checks are
+        //:    triggered for invalid maximum batch sizes (using the
+        //:    'BSLS_ASSERTTEST_*' macros).  (C-5)
+        //
+        // Testing:
+        //   void setMaxBatchSize(int value);
+        //   int maxBatchSize() const;
+        //   CONCERN: BATCHED PUBLICATION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nCONCERN: BATCHED PUBLICATION"
+                          << "\n============================" << endl;
+
+        const int NUM_RECORDS = 500;
+
+        const int BATCH_SIZES[] = { 1, 2, 7, 64, NUM_RECORDS, 8192 };
+        const int NUM_BATCH_SIZES = sizeof BATCH_SIZES / sizeof *BATCH_SIZES;
+
+        bslma::TestAllocator ra("record", veryVeryVeryVerbose);
+
+        bsl::vector<bsl::shared_ptr<ball::Record> > records(&ra);
+        for (int i = 0; i < NUM_RECORDS; ++i) {
+            bsl::ostringstream message;
+            message << "message" << i;
+            records.push_back(createRecord(message.str(),
+                                           ball::Severity::e_WARN,
+                                           &ra));
+        }
+
+        for (int ti = 0; ti < NUM_BATCH_SIZES; ++ti) {
+            const int BATCH_SIZE = BATCH_SIZES[ti];
+
+            if (veryVerbose) { T_ P(BATCH_SIZE) }
+
+            TempDirectoryGuard tempDirGuard;
+
+            bsl::string fileName(tempDirGuard.getTempDirName());
+            bdls::PathUtil::appendRaw(&fileName,
+                                      "asyncfileobserver.t.cpp.case.14");
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Obj mX(ball::Severity::e_OFF, false, NUM_RECORDS, &oa);
+            const Obj& X = mX;
+
+            ASSERTV(BATCH_SIZE, 1 == X.maxBatchSize());
+
+            mX.setMaxBatchSize(BATCH_SIZE);
+            ASSERTV(BATCH_SIZE, BATCH_SIZE == X.maxBatchSize());
+
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+
+            ball::Context context;
+            for (int i = 0; i < NUM_RECORDS; ++i) {
+                mX.publish(records[i], context);
+            }
+            ASSERTV(BATCH_SIZE,
+                    NUM_RECORDS == static_cast<int>(X.recordQueueLength()));
+
+            ASSERT(0 == mX.startPublicationThread());
+            ASSERT(0 == mX.stopPublicationThread());
+
+            ASSERTV(BATCH_SIZE, 0 == X.recordQueueLength());
+
+            mX.disableFileLogging();
+
+            for (int i = 0; i < NUM_RECORDS; ++i) {
+                ASSERTV(BATCH_SIZE, i, 1 == records[i].use_count());
+            }
+
+            bsl::ifstream fs(fileName.c_str());
+            ASSERTV(BATCH_SIZE, fs.is_open());
+
+            bsl::string line;
+            int         numRecords = 0;
+            while (bsl::getline(fs, line)) {
+                if (line.empty()) {
+                    continue;
+                }
+
+                bsl::ostringstream expected;
+                expected << " message" << numRecords << ' ';
+
+                ASSERTV(BATCH_SIZE,
+                        numRecords,
+                        line,
+                        bsl::string::npos != line.find(expected.str()));
+                ++numRecords;
+            }
+            ASSERTV(BATCH_SIZE, numRecords, NUM_RECORDS == numRecords);
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(ball::Severity::e_OFF);
+
+            ASSERT_PASS(mX.setMaxBatchSize(1));
+            ASSERT_FAIL(mX.setMaxBatchSize(0));
+            ASSERT_FAIL(mX.setMaxBatchSize(-1));
+        }
+      } break;
       case 13: {
         // --------------------------------------------------------------------
         // CONCERN: MEMORY ACCESS AFTER RELEASERECORDS
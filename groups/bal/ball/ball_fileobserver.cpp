@@ -13,8 +13,11 @@ BSLS_IDENT_RCSID(ball_fileobserver_cpp,"$Id$ $CSID$")
 
 #include <bslmt_lockguard.h>
 
+#include <bsls_assert.h>
+
 #include <bsl_cstdio.h>
 #include <bsl_cstring.h>                      // for 'bsl::strcmp'
+#include <bsl_ostream.h>
 #include <bsl_sstream.h>
 
 namespace BloombergLP {
@@ -50,6 +53,8 @@ FileObserver::FileObserver()
 , d_userFieldsLoggingFlag(true)
 , d_stdoutLongFormat(k_DEFAULT_LONG_FORMAT)
 , d_stdoutShortFormat(k_DEFAULT_SHORT_FORMAT)
+, d_stdoutStreamBuf()
+, d_stdoutStream(&d_stdoutStreamBuf)
 , d_fileObserver2()
 {
 }
@@ -67,6 +72,8 @@ FileObserver::FileObserver(bslma::Allocator *basicAllocator)
 , d_userFieldsLoggingFlag(true)
 , d_stdoutLongFormat(k_DEFAULT_LONG_FORMAT, basicAllocator)
 , d_stdoutShortFormat(k_DEFAULT_SHORT_FORMAT, basicAllocator)
+, d_stdoutStreamBuf(basicAllocator)
+, d_stdoutStream(&d_stdoutStreamBuf)
 , d_fileObserver2(basicAllocator)
 {
 }
@@ -85,6 +92,8 @@ FileObserver::FileObserver(Severity::Level   stdoutThreshold,
 , d_userFieldsLoggingFlag(true)
 , d_stdoutLongFormat(k_DEFAULT_LONG_FORMAT, basicAllocator)
 , d_stdoutShortFormat(k_DEFAULT_SHORT_FORMAT, basicAllocator)
+, d_stdoutStreamBuf(basicAllocator)
+, d_stdoutStream(&d_stdoutStreamBuf)
 , d_fileObserver2(basicAllocator)
 {
 }
@@ -100,6 +109,8 @@ FileObserver::FileObserver(Severity::Level   stdoutThreshold,
 , d_userFieldsLoggingFlag(true)
 , d_stdoutLongFormat(k_DEFAULT_LONG_FORMAT, basicAllocator)
 , d_stdoutShortFormat(k_DEFAULT_SHORT_FORMAT, basicAllocator)
+, d_stdoutStreamBuf(basicAllocator)
+, d_stdoutStream(&d_stdoutStreamBuf)
 , d_fileObserver2(basicAllocator)
 {
     if (d_publishInLocalTime) {
@@ -236,6 +247,38 @@ void FileObserver::publish(const Record& record, const Context& context)
     d_fileObserver2.publish(record, context);
 }
 
+void FileObserver::publishBatch(const Record *const *records, int numRecords)
+{
+    BSLS_ASSERT(0 <= numRecords);
+    BSLS_ASSERT(records || 0 == numRecords);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    // Rewinding (rather than resetting) the buffer retains its capacity, so
+    // that no memory is allocated once the buffer has grown to fit the
+    // largest batch.
+
+    d_stdoutStreamBuf.pubseekpos(0);
+    for (int i = 0; i < numRecords; ++i) {
+        BSLS_ASSERT(records[i]);
+
+        if (records[i]->fixedFields().severity() <= d_stdoutThreshold) {
+            d_stdoutFormatter(d_stdoutStream, *records[i]);
+        }
+    }
+    d_stdoutStream.clear();
+
+    if (0 < d_stdoutStreamBuf.length()) {
+        bsl::fwrite(d_stdoutStreamBuf.data(),
+                    1,
+                    d_stdoutStreamBuf.length(),
+                    stdout);
+        bsl::fflush(stdout);
+    }
+
+    d_fileObserver2.publishBatch(records, numRecords);
+}
+
 void FileObserver::setLogFormat(const char *logFileFormat,
                                 const char *stdoutFormat)
 {
@@ -30,6 +30,7 @@ BSLS_IDENT("$Id: $")
 //                         |              enableStdoutLoggingPrefix
 //                         |              enablePublishInLocalTime
 //                         |              forceRotation
+//                         |              publishBatch
 //                         |              rotateOnSize
 //                         |              rotateOnTimeInterval
 //                         |              setOnFileRotationCallback
@@ -370,6 +371,8 @@ BSLS_IDENT("$Id: $")
 #include <ball_recordstringformatter.h>
 #include <ball_severity.h>
 
+#include <bdlsb_memoutstreambuf.h>
+
 #include <bdlt_datetimeinterval.h>
 
 #include <bslma_allocator.h>
@@ -382,6 +385,7 @@ BSLS_IDENT("$Id: $")
 #include <bsls_libraryfeatures.h>
 
 #include <bsl_memory.h>
+#include <bsl_ostream.h>
 #include <bsl_string.h>
 
 #ifdef BSLS_LIBRARYFEATURES_HAS_CPP17_PMR
@@ -441,6 +445,17 @@ class FileObserver : public Observer {
     bsl::string           d_stdoutShortFormat;  // default short format for
                                                 // records printed to 'stdout'
 
+    bdlsb::MemOutStreamBuf
+                          d_stdoutStreamBuf;    // stream buffer into which a
+                                                // batch of records is
+                                                // formatted before being
+                                                // written to 'stdout'; reused
+                                                // across batches
+
+    bsl::ostream          d_stdoutStream;       // output stream for formatting
+                                                // a batch of records (bound to
+                                                // 'd_stdoutStreamBuf')
+
     mutable bslmt::Mutex  d_mutex;              // serialize operations
 
     FileObserver2         d_fileObserver2;      // forward most operations to
@@ -633,6 +648,16 @@ class FileObserver : public Observer {
         // 'record' is at least as severe as the value returned by
         // 'stdoutThreshold'.
 
+    void publishBatch(const Record *const *records, int numRecords);
+        // Process the specified 'numRecords' log 'records', in order, by
+        // writing them to the current log file with a single write operation
+        // if file logging is enabled for this file observer (see
+        // 'ball::FileObserver2::publishBatch'), and by writing those records
+        // whose severity is at least as severe as the value returned by
+        // 'stdoutThreshold' to 'stdout' with a single write operation.  The
+        // behavior is undefined unless '0 <= numRecords' and 'records' refers
+        // to an array of at least 'numRecords' non-null pointers.
+
     void releaseRecords();
         // Discard any shared references to 'Record' objects that were supplied
         // to the 'publish' method, and are held by this observer.  Note that
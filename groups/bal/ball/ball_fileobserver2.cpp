@@ -395,6 +395,25 @@ static bdlt::Datetime computeNextRotationTime(
                           // -------------------
 
 // PRIVATE MANIPULATORS
+void FileObserver2::checkLogStream()
+{
+    if (!d_logOutStream) {
+        char errorBuffer[k_ERROR_BUFFER_SIZE];
+
+        snprintf(errorBuffer,
+                 sizeof errorBuffer,
+                 "Error on file stream for %s: %s.",
+                 d_logFileName.c_str(),
+                 bsl::strerror(getErrorCode()));
+        bsls::Log::platformDefaultMessageHandler(bsls::LogSeverity::e_ERROR,
+                                                 __FILE__,
+                                                 __LINE__,
+                                                 errorBuffer);
+
+        d_logStreamBuf.clear();
+    }
+}
+
 void FileObserver2::logRecordDefault(bsl::ostream& stream,
                                      const Record& record)
 
@@ -599,6 +618,8 @@ FileObserver2::FileObserver2(bslma::Allocator *basicAllocator)
                  false,
                  basicAllocator)
 , d_logOutStream(&d_logStreamBuf)
+, d_batchStreamBuf(basicAllocator)
+, d_batchOutStream(&d_batchStreamBuf)
 , d_logFilePattern(basicAllocator)
 , d_logFileName(basicAllocator)
 , d_logFileFunctor(
@@ -746,23 +767,55 @@ void FileObserver2::publish(const Record& record, const Context&)
 
         if (d_logStreamBuf.isOpened()) {
             d_logFileFunctor(d_logOutStream, record);
+            checkLogStream();
+        }
+    }
+
+    if (0 >= rotationStatus) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_rotationCbMutex);
 
-            if (!d_logOutStream) {
-                char errorBuffer[k_ERROR_BUFFER_SIZE];
-
-                snprintf(errorBuffer,
-                         sizeof errorBuffer,
-                         "Error on file stream for %s: %s.",
-                         d_logFileName.c_str(),
-                         bsl::strerror(getErrorCode()));
-                bsls::Log::platformDefaultMessageHandler(
-                                                    bsls::LogSeverity::e_ERROR,
-                                                    __FILE__,
-                                                    __LINE__,
-                                                    errorBuffer);
-
-                d_logStreamBuf.clear();
+        if (d_onRotationCb) {
+            d_onRotationCb(rotationStatus, rotatedFileName);
+        }
+    }
+}
+
+void FileObserver2::publishBatch(const Record *const *records, int numRecords)
+{
+    BSLS_ASSERT(0 <= numRecords);
+    BSLS_ASSERT(records || 0 == numRecords);
+
+    if (0 == numRecords) {
+        return;                                                       // RETURN
+    }
+
+    bsl::string rotatedFileName;
+    int         rotationStatus;
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        rotationStatus = rotateIfNecessary(
+                                        &rotatedFileName,
+                                        records[0]->fixedFields().timestamp());
+
+        if (d_logStreamBuf.isOpened()) {
+            // The formatting functor flushes the stream it is supplied, which
+            // has no effect on 'd_batchOutStream'.  Rewinding (rather than
+            // resetting) the buffer retains its capacity, so that no memory is
+            // allocated once the buffer has grown to fit the largest batch.
+
+            d_batchStreamBuf.pubseekpos(0);
+            for (int i = 0; i < numRecords; ++i) {
+                BSLS_ASSERT(records[i]);
+
+                d_logFileFunctor(d_batchOutStream, *records[i]);
             }
+            d_batchOutStream.clear();
+
+            d_logOutStream.write(d_batchStreamBuf.data(),
+                                 d_batchStreamBuf.length());
+            d_logOutStream.flush();
+            checkLogStream();
         }
     }
 
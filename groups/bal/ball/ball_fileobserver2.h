@@ -30,6 +30,7 @@ BSLS_IDENT("$Id: $")
 //                         |              enableFileLogging
 //                         |              enablePublishInLocalTime
 //                         |              forceRotation
+//                         |              publishBatch
 //                         |              rotateOnSize
 //                         |              rotateOnTimeInterval
 //                         |              setLogFileFunctor
@@ -238,6 +239,19 @@ BSLS_IDENT("$Id: $")
 // in the filename.  In any case, logging resumes to a new, initially empty,
 // file.
 //
+///Batched Publication
+///-------------------
+// Each record received through 'publish' is formatted and then written to the
+// log file, which (since the log file stream is flushed after each record)
+// results in one write to the file per record.  A client that has several
+// records to publish at once (e.g., the publication thread of
+// 'ball::AsyncFileObserver') can instead supply them to 'publishBatch', which
+// formats the records into a single buffer, owned by the observer and reused
+// across calls, that is then written to the log file at once.  The need for
+// file rotation is determined once per batch, from the timestamp of the first
+// record in the batch, so all records of a batch are written to the same log
+// file.
+//
 ///Thread Safety
 ///-------------
 // All methods of 'ball::FileObserver2' are thread-safe, and can be called
@@ -307,6 +321,8 @@ BSLS_IDENT("$Id: $")
 
 #include <bdls_fdstreambuf.h>
 
+#include <bdlsb_memoutstreambuf.h>
+
 #include <bdlt_datetime.h>
 #include <bdlt_datetimeinterval.h>
 
@@ -373,6 +389,15 @@ class FileObserver2 : public Observer {
                                                        // file logging (refers
                                                        // to 'd_logStreamBuf')
 
+    bdlsb::MemOutStreamBuf d_batchStreamBuf;           // stream buffer into
+                                                       // which batches of
+                                                       // records are formatted
+
+    bsl::ostream           d_batchOutStream;           // output stream for
+                                                       // formatting batches
+                                                       // (refers to
+                                                       // 'd_batchStreamBuf')
+
     bsl::string            d_logFilePattern;           // log filename pattern
 
     bsl::string            d_logFileName;              // current log filename
@@ -432,6 +457,11 @@ class FileObserver2 : public Observer {
 
   private:
     // PRIVATE MANIPULATORS
+    void checkLogStream();
+        // Report an error and reset the state of the log file stream of this
+        // file observer if a write to the log file has failed.  The behavior
+        // is undefined unless the caller acquired the lock for this object.
+
     void logRecordDefault(bsl::ostream& stream, const Record& record);
         // Write the specified log 'record' to the specified output 'stream'
         // using the default record format of this file observer.
@@ -579,6 +609,17 @@ class FileObserver2 : public Observer {
         // enabled for this file observer.  The method has no effect if file
         // logging is not enabled, in which case 'record' is dropped.
 
+    void publishBatch(const Record *const *records, int numRecords);
+        // Process the specified 'numRecords' log 'records' by formatting them,
+        // in order, into a single buffer, and writing that buffer to the
+        // current log file if file logging is enabled for this file observer.
+        // The method has no effect if file logging is not enabled, in which
+        // case 'records' are dropped.  The need for log file rotation is
+        // determined once for the batch, using the timestamp of its first
+        // record (see {Batched Publication}).  The behavior is undefined
+        // unless '0 <= numRecords' and 'records' refers to an array of at
+        // least 'numRecords' non-null pointers.
+
     void releaseRecords();
         // Discard any shared references to 'Record' objects that were supplied
         // to the 'publish' method, and are held by this observer.  Note that
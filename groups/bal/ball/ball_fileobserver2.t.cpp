@@ -39,6 +39,7 @@
 #include <bslstl_stringref.h>
 
 #include <bsls_assert.h>
+#include <bsls_asserttest.h>
 #include <bsls_platform.h>
 #include <bsls_timeinterval.h>
 #include <bsls_types.h>
@@ -52,6 +53,7 @@
 #include <bsl_iomanip.h>
 #include <bsl_iostream.h>
 #include <bsl_sstream.h>
+#include <bsl_vector.h>
 
 #ifdef BSLS_PLATFORM_OS_UNIX
 #include <glob.h>
@@ -105,6 +107,7 @@ using bsl::flush;
 // [ 1] void enablePublishInLocalTime();
 // [ 1] void publish(const Record& record, const Context& context);
 // [ 1] void publish(const shared_ptr<Record>&, const Context&);
+// [14] void publishBatch(const Record *const *records, int numRecords);
 // [ 2] void forceRotation();
 // [ 2] void rotateOnSize(int size);
 // [ 2] void rotateOnLifetime(DatetimeInterval& interval);
@@ -122,7 +125,7 @@ using bsl::flush;
 // [ 2] DatetimeInterval rotationLifetime() const;
 // [ 2] int rotationSize() const;
 // ----------------------------------------------------------------------------
-// [13] USAGE EXAMPLE
+// [15] USAGE EXAMPLE
 // [12] CONCERN: CURRENT LOCAL-TIME OFFSET IN TIMESTAMP
 // [11] CONCERN: TIME CALLBACKS ARE CALLED
 // [10] CONCERN: ROTATION CAN BE ENABLED AFTER FILE LOGGING
@@ -193,6 +196,13 @@ void aSsErT2(bool condition, const char *message, int line)
 #define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
 #define L_           BSLIM_TESTUTIL_L_  // current Line number
 
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
 // ============================================================================
 //                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
 // ----------------------------------------------------------------------------
@@ -718,7 +728,7 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:
-      case 14: {
+      case 15: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -794,6 +804,149 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 14: {
+        // --------------------------------------------------------------------
+        // TESTING 'publishBatch'
+        //
+        // Concerns:
+        //: 1 'publishBatch' writes the supplied records, in order, to the log
+        //:   file, formatted exactly as they would be by 'publish'.
+        //:
+        //: 2 'publishBatch' has no effect if supplied no records, or if file
+        //:   logging is not enabled.
+        //:
+        //: 3 Once the buffer used to format batches has grown to hold the
+        //:   largest batch, 'publishBatch' allocates no memory.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when
+        //:   enabled.
+        //
+        // Plan:
+        //: 1 Publish a set of records to one file observer using 'publish',
+        //:   and to another using 'publishBatch', and verify that the
+        //:   contents of their log files are the same.  (C-1)
+        //:
+        //: 2 Call 'publishBatch' with no records, and with file logging
+        //:   disabled, and verify that the log file is unchanged.  (C-2)
+        //:
+        //: 3 Publish the same batch twice using an observer supplied a test
+        //:   allocator, and verify that no memory is allocated by the second
+        //:   call.  (C-3)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments (using the 'BSLS_ASSERTTEST_*'
+        //:   macros).  (C-4)
+        //
+        // Testing:
+        //   void publishBatch(const Record *const *records, int numRecords);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'publishBatch'"
+                          << "\n======================" << endl;
+
+        enum { k_NUM_RECORDS = 100 };
+
+        bsl::vector<ball::Record>         records;
+        bsl::vector<const ball::Record *> recordPtrs;
+
+        records.reserve(k_NUM_RECORDS);
+        for (int i = 0; i < k_NUM_RECORDS; ++i) {
+            bsl::ostringstream message;
+            message << "message " << i;
+
+            ball::RecordAttributes attr(bdlt::CurrentTime::utc(),
+                                        1,
+                                        2,
+                                        "FILENAME",
+                                        i,
+                                        "CATEGORY",
+                                        ball::Severity::e_WARN,
+                                        message.str().c_str());
+
+            records.push_back(ball::Record(attr, ball::UserFields()));
+            recordPtrs.push_back(&records.back());
+        }
+
+        TempDirectoryGuard tempDirGuard;
+
+        bsl::string singleFileName(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&singleFileName, "single.log");
+
+        bsl::string batchFileName(tempDirGuard.getTempDirName());
+        bdls::PathUtil::appendRaw(&batchFileName, "batch.log");
+
+        if (verbose) cout << "\tComparing with 'publish'." << endl;
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Obj mS(&oa);
+            Obj mB(&oa);
+
+            ASSERT(0 == mS.enableFileLogging(singleFileName.c_str()));
+            ASSERT(0 == mB.enableFileLogging(batchFileName.c_str()));
+
+            ball::Context context(ball::Transmission::e_PASSTHROUGH, 0, 1);
+            for (int i = 0; i < k_NUM_RECORDS; ++i) {
+                mS.publish(records[i], context);
+            }
+
+            mB.publishBatch(recordPtrs.data(), 0);
+            ASSERT(0 == FsUtil::getFileSize(batchFileName));
+
+            mB.publishBatch(recordPtrs.data(), 1);
+            mB.publishBatch(recordPtrs.data() + 1, k_NUM_RECORDS - 1);
+
+            if (verbose) cout << "\tTesting allocation." << endl;
+
+            mS.publishBatch(recordPtrs.data(), k_NUM_RECORDS);
+
+            const Int64 NUM_ALLOCATIONS = oa.numAllocations();
+
+            mS.publishBatch(recordPtrs.data(), k_NUM_RECORDS);
+            mS.publishBatch(recordPtrs.data(), 1);
+
+            ASSERTV(NUM_ALLOCATIONS,   oa.numAllocations(),
+                    NUM_ALLOCATIONS == oa.numAllocations());
+
+            mS.disableFileLogging();
+            mB.disableFileLogging();
+
+            if (verbose) cout << "\tTesting with file logging disabled."
+                              << endl;
+
+            mB.publishBatch(recordPtrs.data(), k_NUM_RECORDS);
+        }
+
+        bsl::string singleContent, batchContent;
+
+        // The default format writes two lines for each record.  The first
+        // 'k_NUM_RECORDS' records in the "single" log file were written by
+        // 'publish', and the next 'k_NUM_RECORDS' by 'publishBatch'.
+
+        ASSERT(2 * (3 * k_NUM_RECORDS + 1) ==
+                readFileIntoString(__LINE__, singleFileName, singleContent));
+        ASSERT(2 * k_NUM_RECORDS ==
+                  readFileIntoString(__LINE__, batchFileName, batchContent));
+
+        const bsl::size_t LENGTH = batchContent.size();
+
+        ASSERTV(LENGTH,
+                singleContent.size(),
+                2 * LENGTH < singleContent.size());
+        ASSERT(0 == singleContent.compare(0,      LENGTH, batchContent));
+        ASSERT(0 == singleContent.compare(LENGTH, LENGTH, batchContent));
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX;
+
+            ASSERT_PASS(mX.publishBatch(0, 0));
+            ASSERT_FAIL(mX.publishBatch(0, 1));
+            ASSERT_FAIL(mX.publishBatch(recordPtrs.data(), -1));
+        }
+      } break;
       case 13: {
         // --------------------------------------------------------------------
         // REPRODUCE BUG FROM DRQS 123123158
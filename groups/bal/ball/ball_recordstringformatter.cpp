@@ -8,8 +8,30 @@ BSLS_IDENT_RCSID(ball_recordstringformatter_cpp,"$Id$ $CSID$")
 ///--------------------
 // Using the insertion operator ('operator<<') with an 'ostream' introduces
 // significant performance overhead.  For this reason, the 'operator()' method
-// is implemented by writing the formatted string to a buffer before inserting
-// to a stream.
+// is implemented by writing the formatted string to a buffer (using 'print')
+// before inserting to a stream.  A record that does not fit in the buffer
+// overflows into an allocated string, so that it is formatted only once.
+//
+// The format specification is compiled by 'parseFormatSpecification' into a
+// sequence of 'Op' objects, each having one of the 'OpType' values below.
+// Literal text is copied to 'd_literals' with the escape sequences resolved,
+// so that an 'e_TEXT' operation is a single 'memcpy'.  The fields of a record
+// that have a fixed, simple rendering are written directly into the output
+// buffer by the 'PrintUtil' functions taking an 'OutputBuffer'.  The
+// attribute and user-field conversions, whose rendering is more involved (and
+// which hold caches of their own), are 'FieldStringFormatter' objects that
+// render into a temporary string, and are referred to by 'e_FIELD_FORMATTER'
+// operations.
+//
+// Each timestamp conversion has a 'TimestampCache' holding the rendering of
+// the last second formatted, in the last offset used, with the text preceding
+// and following the fractional seconds stored separately.  A timestamp within
+// that second, in that offset, is rendered by copying the cached text around
+// the fractional seconds, which are computed from the difference between the
+// timestamp and the start of the cached second.  Timestamps that cannot be
+// cached (the default 'bdlt::Datetime' value, whose time is 24:00, and
+// timestamps having an offset that is not a whole number of seconds) are
+// rendered in full.
 
 #include <ball_managedattribute.h>
 #include <ball_record.h>
@@ -24,19 +46,23 @@ BSLS_IDENT_RCSID(ball_recordstringformatter_cpp,"$Id$ $CSID$")
 #include <bdlma_bufferedsequentialallocator.h>
 
 #include <bdlt_datetime.h>
+#include <bdlt_datetimetz.h>
 #include <bdlt_currenttime.h>
 #include <bdlt_localtimeoffset.h>
 #include <bdlt_iso8601util.h>
 #include <bdlt_iso8601utilconfiguration.h>
+#include <bdlt_time.h>
+#include <bdlt_timeunitratio.h>
 
 #include <bdlsb_overflowmemoutstreambuf.h>
 
 #include <bsls_annotation.h>
+#include <bsls_assert.h>
 #include <bsls_platform.h>
 #include <bsls_types.h>
 
 #include <bsl_climits.h>   // for 'INT_MAX'
-#include <bsl_cstring.h>   // for 'bsl::strcmp'
+#include <bsl_cstring.h>   // for 'bsl::strcmp', 'bsl::memcpy'
 #include <bsl_c_stdlib.h>
 #include <bsl_c_stdio.h>   // for 'snprintf'
 
@@ -53,6 +79,173 @@ const char *const DEFAULT_FORMAT_SPEC = "\n%d %p:%t %s %f:%l %c %m %u\n";
 
 namespace BloombergLP {
 namespace ball {
+
+                  // ========================================
+                  // class RecordStringFormatter_OutputBuffer
+                  // ========================================
+
+class RecordStringFormatter_OutputBuffer {
+    // This class implements a mechanism that writes characters to a buffer of
+    // fixed capacity, and counts all the characters written.  The characters
+    // that do not fit in the buffer are discarded, unless an overflow string
+    // is supplied at construction, in which case the content of the buffer,
+    // and all the characters that follow, are written to that string.
+
+    // DATA
+    char        *d_buffer_p;      // start of the buffer
+    char        *d_cursor_p;      // next position to write in the buffer
+    char        *d_end_p;         // end of the buffer
+    int          d_length;        // number of characters written
+    bsl::string *d_overflow_p;    // string receiving the output once the
+                                  // buffer is full, or 0 if the characters
+                                  // that do not fit are discarded
+    bool         d_isOverflowed;  // 'true' if the output is in
+                                  // '*d_overflow_p' rather than the buffer
+
+    // NOT IMPLEMENTED
+    RecordStringFormatter_OutputBuffer(
+                                    const RecordStringFormatter_OutputBuffer&);
+    RecordStringFormatter_OutputBuffer& operator=(
+                                    const RecordStringFormatter_OutputBuffer&);
+
+    // PRIVATE MANIPULATORS
+    void appendOverflow(const char *text, int length);
+        // Write the specified 'text' of the specified 'length', which does
+        // not fit in the buffer, to the overflow string (moving the content of
+        // the buffer to that string first), or, if there is no overflow
+        // string, write as much of 'text' as fits in the buffer.
+
+  public:
+    // CREATORS
+    RecordStringFormatter_OutputBuffer(char        *buffer,
+                                       int          capacity,
+                                       bsl::string *overflow = 0);
+        // Create an output buffer writing to the specified 'buffer' having the
+        // specified 'capacity'.  Optionally specify an 'overflow' string to
+        // which the output is moved if it does not fit in 'buffer'.  If
+        // 'overflow' is 0, the characters that do not fit are discarded.
+
+    // MANIPULATORS
+    void append(char character);
+        // Write the specified 'character' to this output buffer.
+
+    void append(const char *text, int length);
+        // Write the specified 'text' of the specified 'length' to this output
+        // buffer.
+
+    void append(const bsl::string_view& text);
+        // Write the specified 'text' to this output buffer.
+
+    // ACCESSORS
+    char *cursor() const;
+        // Return the address of the next position to write in the buffer.
+        // The behavior is undefined if the output was moved to the overflow
+        // string.
+
+    const char *data() const;
+        // Return the address of the characters written to this output buffer,
+        // which are held by the overflow string if they did not fit in the
+        // buffer supplied at construction, and by that buffer otherwise.
+        // Note that, unless an overflow string was supplied, only the
+        // characters that fit in the buffer are available.
+
+    int length() const;
+        // Return the number of characters written to this output buffer,
+        // including those that did not fit in the buffer.
+};
+
+                  // ----------------------------------------
+                  // class RecordStringFormatter_OutputBuffer
+                  // ----------------------------------------
+
+// PRIVATE MANIPULATORS
+void RecordStringFormatter_OutputBuffer::appendOverflow(const char *text,
+                                                        int         length)
+{
+    if (!d_overflow_p) {
+        const int available = static_cast<int>(d_end_p - d_cursor_p);
+
+        bsl::memcpy(d_cursor_p, text, available);
+        d_cursor_p += available;
+        return;                                                       // RETURN
+    }
+
+    if (!d_isOverflowed) {
+        d_overflow_p->assign(d_buffer_p, d_cursor_p);
+        d_end_p        = d_cursor_p;
+        d_isOverflowed = true;
+    }
+    d_overflow_p->append(text, length);
+}
+
+// CREATORS
+inline
+RecordStringFormatter_OutputBuffer::RecordStringFormatter_OutputBuffer(
+                                                      char        *buffer,
+                                                      int          capacity,
+                                                      bsl::string *overflow)
+: d_buffer_p(buffer)
+, d_cursor_p(buffer)
+, d_end_p(buffer + capacity)
+, d_length(0)
+, d_overflow_p(overflow)
+, d_isOverflowed(false)
+{
+}
+
+// MANIPULATORS
+inline
+void RecordStringFormatter_OutputBuffer::append(char character)
+{
+    if (d_cursor_p != d_end_p) {
+        *d_cursor_p++ = character;
+    }
+    else {
+        appendOverflow(&character, 1);
+    }
+    ++d_length;
+}
+
+inline
+void RecordStringFormatter_OutputBuffer::append(const char *text, int length)
+{
+    if (length <= d_end_p - d_cursor_p) {
+        bsl::memcpy(d_cursor_p, text, length);
+        d_cursor_p += length;
+    }
+    else {
+        appendOverflow(text, length);
+    }
+    d_length += length;
+}
+
+inline
+void RecordStringFormatter_OutputBuffer::append(const bsl::string_view& text)
+{
+    append(text.data(), static_cast<int>(text.length()));
+}
+
+// ACCESSORS
+inline
+char *RecordStringFormatter_OutputBuffer::cursor() const
+{
+    BSLS_ASSERT(!d_isOverflowed);
+
+    return d_cursor_p;
+}
+
+inline
+const char *RecordStringFormatter_OutputBuffer::data() const
+{
+    return d_isOverflowed ? d_overflow_p->data() : d_buffer_p;
+}
+
+inline
+int RecordStringFormatter_OutputBuffer::length() const
+{
+    return d_length;
+}
+
 namespace {
 
                        // ============================
@@ -84,6 +277,43 @@ struct PublishInLocalTimeUtil {
     };
 };
 
+                       // ============
+                       // enum OpType
+                       // ============
+
+enum OpType {
+    // Enumeration of the operations of a compiled format specification.
+
+    e_TEXT,               // literal text
+    e_TIMESTAMP,          // "%d", "%D", "%i", "%I" or "%O"
+    e_PROCESS_ID,         // "%p"
+    e_THREAD_ID,          // "%t"
+    e_THREAD_ID_HEX,      // "%T"
+    e_SEVERITY,           // "%s"
+    e_FILENAME,           // "%f"
+    e_BASENAME,           // "%F"
+    e_LINE_NUMBER,        // "%l"
+    e_CATEGORY,           // "%c"
+    e_MESSAGE,            // "%m"
+    e_MESSAGE_PRINTABLE,  // "%x"
+    e_MESSAGE_HEX,        // "%X"
+    e_FIELD_FORMATTER     // "%a", "%a[name]", "%A" or "%u"
+};
+
+enum TimestampFormatIndex {
+    // Enumeration of the timestamp conversions, used to index
+    // 'k_TIMESTAMP_FORMATS' and the timestamp caches of a record formatter.
+
+    e_TIMESTAMP_D,               // "%d"
+    e_TIMESTAMP_D_MICROSECONDS,  // "%D"
+    e_TIMESTAMP_I,               // "%i"
+    e_TIMESTAMP_I_MILLISECONDS,  // "%I"
+    e_TIMESTAMP_I_MICROSECONDS   // "%O"
+};
+
+typedef RecordStringFormatter_TimestampCache TimestampCache;
+typedef RecordStringFormatter_OutputBuffer   OutputBuffer;
+
                        // ===============
                        // class PrintUtil
                        // ===============
@@ -101,6 +331,37 @@ struct PrintUtil {
         e_FSP_MICROSECONDS = 6
     };
 
+  private:
+    // PRIVATE CLASS METHODS
+    static void appendDatetimeRaw(
+                               OutputBuffer                  *result,
+                               const bdlt::Datetime&          timestamp,
+                               const bdlt::DatetimeInterval&  offset,
+                               bool                           iso8601,
+                               FractionalSecondPrecision      secondPrecision);
+        // Append to the specified 'result' the specified 'timestamp' adjusted
+        // by the specified 'offset', in ISO 8601 format if the specified
+        // 'iso8601' is 'true', having the specified fractional
+        // 'secondPrecision' numbers.
+
+    static bool loadTimestampCache(TimestampCache                *cache,
+                                   const bdlt::Datetime&          timestamp,
+                                   const bdlt::DatetimeInterval&  offset,
+                                   bool                           iso8601);
+        // Load into the specified 'cache' the rendering of the second of the
+        // specified 'timestamp' adjusted by the specified 'offset', in ISO
+        // 8601 format if the specified 'iso8601' is 'true'.  Return 'true' on
+        // success, and 'false', with no effect, if 'timestamp' cannot be
+        // cached.
+
+    static bdlt::DatetimeInterval timestampOffset(
+                                const bdlt::Datetime&         timestamp,
+                                const bdlt::DatetimeInterval& timestampOffset);
+        // Return the offset to add to the specified 'timestamp' according to
+        // the specified 'timestampOffset' of a record formatter, which may
+        // indicate that timestamps are published in local time.
+
+  public:
     // CLASS METHODS
     static void appendAttribute(bsl::string             *result,
                                 const ManagedAttribute&  attribute,
@@ -112,82 +373,103 @@ struct PrintUtil {
         // Note that this method is invoked when processing "%a", "%a[key]" or
         // "%A" specifiers.
 
-    static void appendCategory(bsl::string *result, const Record& record);
+    static void appendCategory(OutputBuffer *result, const Record& record);
         // Append a category provided by the specified 'record' to the
-        // specified 'result' string.  Note that this method is invoked when
+        // specified 'result' buffer.  Note that this method is invoked when
         // processing "%c" specifier.
 
-    static void appendDatetime(bsl::string                  *result,
-                               const Record&                 record,
-                               const bdlt::DatetimeInterval *timestampOffset,
-                               bool                          iso8601,
-                               FractionalSecondPrecision     secondPrecision);
+    static void appendDatetime(
+                             OutputBuffer                  *result,
+                             const Record&                  record,
+                             const bdlt::DatetimeInterval&  timestampOffset,
+                             TimestampCache                *cache,
+                             bool                           iso8601,
+                             FractionalSecondPrecision      secondPrecision);
         // Append to the specified 'result' the datetime provided by the
         // specified 'record' in ISO 8601 format if the specified 'iso8601' is
         // 'true', having the specified fractional 'secondPrecision' numbers,
-        // and the specified 'timestampOffset'.  Note that this method is
-        // invoked when processing "%d", "%D", "%i", "%I" or  "%O" specifiers.
-
-    static void appendFilename(bsl::string   *result,
+        // and the specified 'timestampOffset', using and updating the
+        // specified 'cache'.  Note that this method is invoked when processing
+        // "%d", "%D", "%i", "%I" or  "%O" specifiers.
+
+    static void appendDecimal(OutputBuffer       *result,
+                              bsls::Types::Int64  value);
+    static void appendDecimal(OutputBuffer        *result,
+                              bsls::Types::Uint64  value);
+        // Append the specified 'value' to the specified 'result' buffer in
+        // decimal format.
+
+    static void appendDigits(OutputBuffer *result, int value, int numDigits);
+        // Append the specified 'value' to the specified 'result' buffer as
+        // exactly the specified 'numDigits' decimal digits, padded with
+        // leading zeros.  The behavior is undefined unless '0 <= value' and
+        // 'value' has at most 'numDigits' digits.
+
+    static void appendFilename(OutputBuffer  *result,
                                bool           fullPath,
                                const Record&  record);
         // Append a path to a file-name provided by the specified 'record' to
-        // the specified 'result' string if the specified 'fullPath' is true,
+        // the specified 'result' buffer if the specified 'fullPath' is true,
         // and a base-name only otherwise.  Note that this method is invoked
         // when processing "%f" or "%F" specifiers.
 
-    static void appendHexDump(bsl::string             *result,
+    static void appendHex(OutputBuffer *result, bsls::Types::Uint64 value);
+        // Append the specified 'value' to the specified 'result' buffer in
+        // uppercase hexadecimal format.
+
+    static void appendHexDump(OutputBuffer            *result,
                               const bsl::string_view&  string);
-        // Append to the specified 'result' string the uppercase hex encoding
+        // Append to the specified 'result' buffer the uppercase hex encoding
         // of the byte sequence defined by the specified 'string'.
 
-    static void appendLineNumber(bsl::string *result, const Record& record);
+    static void appendLineNumber(OutputBuffer *result, const Record& record);
         // Append to the specified 'result' a line-number provided by the
         // specified 'record'.  Note that this method is invoked when
         // processing "%l" specifier.
 
-    static void appendMessage(bsl::string *result, const Record& record);
+    static void appendMessage(OutputBuffer *result, const Record& record);
         // Append a message provided by the specified 'record' to the specified
-        // 'result' string.  Note that this method is invoked when processing
+        // 'result' buffer.  Note that this method is invoked when processing
         // "%m" specifier.
 
-    static void appendMessageNonPrintableChars(bsl::string   *result,
+    static void appendMessageNonPrintableChars(OutputBuffer  *result,
                                                const Record&  record);
         // Append a message with non-printable characters in hex provided by
-        // the specified 'record' to the specified 'result' string.  Note that
+        // the specified 'record' to the specified 'result' buffer.  Note that
         // this method is invoked when processing "%x" specifier.
 
-    static void appendMessageAsHex(bsl::string *result, const Record& record);
+    static void appendMessageAsHex(OutputBuffer *result, const Record& record);
         // Append a message provided by the specified 'record' to the specified
-        // 'result' string in hex format.  Note that this method is invoked
+        // 'result' buffer in hex format.  Note that this method is invoked
         // when processing "%X" specifier.
 
-    static void appendProcessId(bsl::string *result, const Record& record);
+    static void appendProcessId(OutputBuffer *result, const Record& record);
         // Append a process ID provided by the specified 'record' to the
-        // specified 'result' string.  Note that this method is invoked when
+        // specified 'result' buffer.  Note that this method is invoked when
         // processing "%p" specifier.
 
-    static void appendString(bsl::string             *result,
+    static void appendString(OutputBuffer            *result,
                              const bsl::string_view&  value,
                              bool                     notPrintable = false);
-        // Append the specified 'value' to the specified 'result' string.  If
+        // Append the specified 'value' to the specified 'result' buffer.  If
         // the optionally specified 'notPrintable' flag is 'true', then all
         // non-printable characters in 'value' will be printed in their
         // hexadecimal representation ('\xHH').
 
-    static void appendThreadId(bsl::string *result, const Record& record);
+    static void appendThreadId(OutputBuffer *result, const Record& record);
         // Append a thread ID provided by the specified 'record' to the
-        // specified 'result' string.  Note that this method is invoked when
+        // specified 'result' buffer.  Note that this method is invoked when
         // processing "%t" specifier.
 
-    static void appendThreadIdAsHex(bsl::string *result, const Record& record);
+    static void appendThreadIdAsHex(OutputBuffer  *result,
+                                    const Record&  record);
         // Append a thread ID provided by the specified 'record' to the
-        // specified 'result' string in hex format.  Note that this method is
+        // specified 'result' buffer in hex format.  Note that this method is
         // invoked when processing "%T" specifier.
 
-    static void appendSeverity(bsl::string *result, const Record& record);
+    static void appendSeverity(OutputBuffer *result, const Record& record);
         // Append a severity provided by the specified 'record' to the
-        // specified 'result' string.  Note that this method is invoked when
+        // specified 'result' buffer.  Note that this method is invoked when
         // processing "%s" specifier.
 
     template <class T>
@@ -207,6 +489,26 @@ struct PrintUtil {
         // processing "%u" specifier.
 };
 
+                       // =====================
+                       // struct TimestampFormat
+                       // =====================
+
+struct TimestampFormat {
+    // This 'struct' describes the rendering of a timestamp conversion.
+
+    bool                                 d_iso8601;          // ISO 8601 format
+    PrintUtil::FractionalSecondPrecision d_secondPrecision;  // fractional
+                                                             // digits
+};
+
+const TimestampFormat k_TIMESTAMP_FORMATS[] = {
+    { false, PrintUtil::e_FSP_MILLISECONDS },  // e_TIMESTAMP_D
+    { false, PrintUtil::e_FSP_MICROSECONDS },  // e_TIMESTAMP_D_MICROSECONDS
+    { true,  PrintUtil::e_FSP_NONE         },  // e_TIMESTAMP_I
+    { true,  PrintUtil::e_FSP_MILLISECONDS },  // e_TIMESTAMP_I_MILLISECONDS
+    { true,  PrintUtil::e_FSP_MICROSECONDS }   // e_TIMESTAMP_I_MICROSECONDS
+};
+
                        // ========================
                        // class AttributeFormatter
                        // ========================
@@ -313,6 +615,135 @@ class AttributesFormatter {
                        // class PrintUtil
                        // ---------------
 
+// PRIVATE CLASS METHODS
+void PrintUtil::appendDatetimeRaw(
+                               OutputBuffer                  *result,
+                               const bdlt::Datetime&          timestamp,
+                               const bdlt::DatetimeInterval&  offset,
+                               bool                           iso8601,
+                               FractionalSecondPrecision      secondPrecision)
+{
+    bdlt::DatetimeTz adjusted(timestamp + offset,
+                              static_cast<int>(offset.totalMinutes()));
+
+    if (iso8601) {
+        bdlt::Iso8601UtilConfiguration config;
+
+        if (secondPrecision) {
+            config.setFractionalSecondPrecision(secondPrecision);
+        }
+        config.setUseZAbbreviationForUtc(true);
+
+        char buffer[bdlt::Iso8601Util::k_DATETIMETZ_STRLEN + 1];
+
+        int outputLength = bdlt::Iso8601Util::generateRaw(buffer,
+                                                          adjusted,
+                                                          config);
+
+        if (e_FSP_NONE == secondPrecision) {
+
+            enum { k_DECIMAL_SIGN_OFFSET = 19,
+                   k_TZINFO_OFFSET       = k_DECIMAL_SIGN_OFFSET + 4 };
+
+            result->append(buffer, k_DECIMAL_SIGN_OFFSET);
+            result->append(buffer + k_TZINFO_OFFSET,
+                           outputLength - k_TZINFO_OFFSET);
+        }
+        else {
+            result->append(buffer, outputLength);
+        }
+    }
+    else {
+        char buffer[32];
+
+        const int outputLength = adjusted.localDatetime().printToBuffer(
+                                                              buffer,
+                                                              sizeof buffer,
+                                                              secondPrecision);
+        result->append(buffer, outputLength);
+    }
+}
+
+bool PrintUtil::loadTimestampCache(TimestampCache                *cache,
+                                   const bdlt::Datetime&          timestamp,
+                                   const bdlt::DatetimeInterval&  offset,
+                                   bool                           iso8601)
+{
+    // A timestamp of 24:00 does not belong to a second following a start
+    // value, and an offset having fractional seconds would not preserve the
+    // fractional seconds of the timestamp.
+
+    if (bdlt::Datetime() == timestamp
+     || 0 != offset.totalMicroseconds() %
+                                  bdlt::TimeUnitRatio::k_US_PER_S) {
+        return false;                                                 // RETURN
+    }
+
+    const bdlt::Datetime   second(timestamp.date(),
+                                  bdlt::Time(timestamp.hour(),
+                                             timestamp.minute(),
+                                             timestamp.second()));
+    const bdlt::DatetimeTz adjusted(second + offset,
+                                    static_cast<int>(offset.totalMinutes()));
+
+    if (iso8601) {
+        bdlt::Iso8601UtilConfiguration config;
+
+        config.setFractionalSecondPrecision(0);
+        config.setUseZAbbreviationForUtc(true);
+
+        char buffer[bdlt::Iso8601Util::k_DATETIMETZ_STRLEN + 1];
+
+        const int outputLength = bdlt::Iso8601Util::generateRaw(buffer,
+                                                                adjusted,
+                                                                config);
+
+        enum { k_TZINFO_OFFSET = 19 };
+
+        bsl::memcpy(cache->d_prefix, buffer, k_TZINFO_OFFSET);
+        cache->d_prefixLength = k_TZINFO_OFFSET;
+
+        bsl::memcpy(cache->d_suffix,
+                    buffer + k_TZINFO_OFFSET,
+                    outputLength - k_TZINFO_OFFSET);
+        cache->d_suffixLength = outputLength - k_TZINFO_OFFSET;
+    }
+    else {
+        cache->d_prefixLength = adjusted.localDatetime().printToBuffer(
+                                                cache->d_prefix,
+                                                TimestampCache::k_MAX_LENGTH,
+                                                0);
+        cache->d_suffixLength = 0;
+    }
+
+    cache->d_second  = second;
+    cache->d_offset  = offset;
+    cache->d_isValid = true;
+
+    return true;
+}
+
+bdlt::DatetimeInterval PrintUtil::timestampOffset(
+                                 const bdlt::Datetime&         timestamp,
+                                 const bdlt::DatetimeInterval& timestampOffset)
+{
+    bdlt::DatetimeInterval offset;
+
+    if (PublishInLocalTimeUtil::k_ENABLE ==
+                                           timestampOffset.totalMilliseconds())
+    {
+        bsls::Types::Int64 localTimeOffsetInSeconds =
+              bdlt::LocalTimeOffset::localTimeOffset(timestamp).totalSeconds();
+        offset.setTotalSeconds(localTimeOffsetInSeconds);
+    } else if (PublishInLocalTimeUtil::k_DISABLE !=
+                                         timestampOffset.totalMilliseconds()) {
+        offset = timestampOffset;
+    }
+
+    return offset;
+}
+
+// CLASS METHODS
 void PrintUtil::appendAttribute(bsl::string             *result,
                                 const ManagedAttribute&  a,
                                 bool                     printKey)
@@ -334,81 +765,114 @@ void PrintUtil::appendAttribute(bsl::string             *result,
     }
 }
 
-void PrintUtil::appendCategory(bsl::string *result, const Record& record)
+void PrintUtil::appendCategory(OutputBuffer *result, const Record& record)
 {
-    *result += record.fixedFields().category();
+    result->append(bsl::string_view(record.fixedFields().category()));
 }
 
-void PrintUtil::appendDatetime(bsl::string                  *result,
-                               const Record&                 record,
-                               const bdlt::DatetimeInterval *timestampOffset,
-                               bool                          iso8601,
-                               FractionalSecondPrecision     secondPrecision)
+void PrintUtil::appendDatetime(
+                              OutputBuffer                  *result,
+                              const Record&                  record,
+                              const bdlt::DatetimeInterval&  timestampOffset,
+                              TimestampCache                *cache,
+                              bool                           iso8601,
+                              FractionalSecondPrecision      secondPrecision)
 {
-    bdlt::DatetimeInterval  offset;
+    const bdlt::Datetime&        timestamp = record.fixedFields().timestamp();
+    const bdlt::DatetimeInterval offset    =
+                              PrintUtil::timestampOffset(timestamp,
+                                                         timestampOffset);
 
-    if (PublishInLocalTimeUtil::k_ENABLE ==
-                                          timestampOffset->totalMilliseconds())
-    {
-        bsls::Types::Int64 localTimeOffsetInSeconds =
-            bdlt::LocalTimeOffset::localTimeOffset(
-                              record.fixedFields().timestamp()).totalSeconds();
-        offset.setTotalSeconds(localTimeOffsetInSeconds);
-    } else if (PublishInLocalTimeUtil::k_DISABLE !=
-                                        timestampOffset->totalMilliseconds()) {
-        offset = *timestampOffset;
+    bsls::Types::Int64 microseconds = -1;  // within the cached second
+
+    if (cache->d_isValid
+     && offset == cache->d_offset
+     && bdlt::Datetime() != timestamp) {
+        microseconds = (timestamp - cache->d_second).totalMicroseconds();
     }
 
-    bdlt::DatetimeTz timestamp(record.fixedFields().timestamp() + offset,
-                               static_cast<int>(offset.totalMinutes()));
+    if (microseconds < 0 || microseconds >= bdlt::TimeUnitRatio::k_US_PER_S) {
+        if (!loadTimestampCache(cache, timestamp, offset, iso8601)) {
+            appendDatetimeRaw(result,
+                              timestamp,
+                              offset,
+                              iso8601,
+                              secondPrecision);
+            return;                                                   // RETURN
+        }
+        microseconds = (timestamp - cache->d_second).totalMicroseconds();
+    }
 
-    if (iso8601) {
-        bdlt::Iso8601UtilConfiguration config;
+    result->append(cache->d_prefix, cache->d_prefixLength);
+
+    switch (secondPrecision) {
+      case e_FSP_MILLISECONDS: {
+        result->append('.');
+        appendDigits(result,
+                     static_cast<int>(microseconds /
+                                             bdlt::TimeUnitRatio::k_US_PER_MS),
+                     e_FSP_MILLISECONDS);
+      } break;
+      case e_FSP_MICROSECONDS: {
+        result->append('.');
+        appendDigits(result,
+                     static_cast<int>(microseconds),
+                     e_FSP_MICROSECONDS);
+      } break;
+      case e_FSP_NONE: {
+      } break;
+    }
 
-        if (secondPrecision) {
-            config.setFractionalSecondPrecision(secondPrecision);
-        }
-        config.setUseZAbbreviationForUtc(true);
+    result->append(cache->d_suffix, cache->d_suffixLength);
+}
 
-        char buffer[bdlt::Iso8601Util::k_DATETIMETZ_STRLEN + 1];
+void PrintUtil::appendDecimal(OutputBuffer *result, bsls::Types::Int64 value)
+{
+    if (value < 0) {
+        result->append('-');
+        appendDecimal(result, 0 - static_cast<bsls::Types::Uint64>(value));
+    }
+    else {
+        appendDecimal(result, static_cast<bsls::Types::Uint64>(value));
+    }
+}
 
-        int outputLength = bdlt::Iso8601Util::generateRaw(buffer,
-                                                          timestamp,
-                                                          config);
+void PrintUtil::appendDecimal(OutputBuffer        *result,
+                              bsls::Types::Uint64  value)
+{
+    char  buffer[24];
+    char *end = buffer + sizeof buffer;
+    char *p   = end;
 
-        if (e_FSP_NONE == secondPrecision) {
+    do {
+        *--p   = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value);
 
-            enum { k_DECIMAL_SIGN_OFFSET = 19,
-                   k_TZINFO_OFFSET       = k_DECIMAL_SIGN_OFFSET + 4 };
+    result->append(p, static_cast<int>(end - p));
+}
 
-            bsl::string_view head(buffer, k_DECIMAL_SIGN_OFFSET);
-            bsl::string_view tail(buffer + k_TZINFO_OFFSET,
-                                  outputLength - k_TZINFO_OFFSET);
-            *result += head;
-            *result += tail;
-        }
-        else {
-            result->append(buffer, outputLength);
-        }
-    }
-    else {
-        char buffer[32];
+void PrintUtil::appendDigits(OutputBuffer *result, int value, int numDigits)
+{
+    char  buffer[16];
+    char *p = buffer + numDigits;
 
-        timestamp.localDatetime().printToBuffer(buffer,
-                                                sizeof buffer,
-                                                secondPrecision);
-        *result += buffer;
+    while (p != buffer) {
+        *--p   = static_cast<char>('0' + value % 10);
+        value /= 10;
     }
+
+    result->append(buffer, numDigits);
 }
 
-void PrintUtil::appendFilename(bsl::string   *result,
+void PrintUtil::appendFilename(OutputBuffer  *result,
                                bool           fullPath,
                                const Record&  record)
 {
     const bsl::string_view filename(record.fixedFields().fileName());
 
     if (fullPath) {
-        *result += filename;
+        result->append(filename);
     }
     else {
         const bsl::string::size_type rightmostSlashIndex =
@@ -419,15 +883,31 @@ void PrintUtil::appendFilename(bsl::string   *result,
 #endif
 
         if (bsl::string::npos == rightmostSlashIndex) {
-            *result += filename;
+            result->append(filename);
         }
         else {
-            *result += filename.substr(rightmostSlashIndex + 1);
+            result->append(filename.substr(rightmostSlashIndex + 1));
         }
     }
 }
 
-void PrintUtil::appendHexDump(bsl::string             *result,
+void PrintUtil::appendHex(OutputBuffer *result, bsls::Types::Uint64 value)
+{
+    static const char HEX[] = "0123456789ABCDEF";
+
+    char  buffer[16];
+    char *end = buffer + sizeof buffer;
+    char *p   = end;
+
+    do {
+        *--p    = HEX[value & 0xF];
+        value >>= 4;
+    } while (value);
+
+    result->append(p, static_cast<int>(end - p));
+}
+
+void PrintUtil::appendHexDump(OutputBuffer            *result,
                               const bsl::string_view&  string)
 {
     static const char HEX[] = "0123456789ABCDEF";
@@ -439,28 +919,30 @@ void PrintUtil::appendHexDump(bsl::string             *result,
 
         const unsigned char c = *i;
 
-        result->push_back(HEX[(c >> 4) & 0xF]);
-        result->push_back(HEX[ c       & 0xF]);
+        result->append(HEX[(c >> 4) & 0xF]);
+        result->append(HEX[ c       & 0xF]);
     }
 }
 
-void PrintUtil::appendLineNumber(bsl::string *result, const Record& record)
+void PrintUtil::appendLineNumber(OutputBuffer *result, const Record& record)
 {
-    appendValue(result, record.fixedFields().lineNumber());
+    appendDecimal(result,
+                  static_cast<bsls::Types::Int64>(
+                                         record.fixedFields().lineNumber()));
 }
 
-void PrintUtil::appendMessage(bsl::string *result, const Record& record)
+void PrintUtil::appendMessage(OutputBuffer *result, const Record& record)
 {
     appendString(result, record.fixedFields().messageRef());
 }
 
-void PrintUtil::appendMessageNonPrintableChars(bsl::string   *result,
+void PrintUtil::appendMessageNonPrintableChars(OutputBuffer  *result,
                                                const Record&  record)
 {
     appendString(result, record.fixedFields().messageRef(), true);
 }
 
-void PrintUtil::appendMessageAsHex(bsl::string *result, const Record& record)
+void PrintUtil::appendMessageAsHex(OutputBuffer *result, const Record& record)
 {
     appendHexDump(result, record.fixedFields().messageRef());
 }
@@ -495,13 +977,15 @@ void PrintUtil::appendValue(bsl::string  *result, bsls::Types::Int64 value)
     appendValue(result, "%lld", value);
 }
 
-void PrintUtil::appendProcessId(bsl::string   *result,
+void PrintUtil::appendProcessId(OutputBuffer  *result,
                                 const Record&  record)
 {
-    appendValue(result, record.fixedFields().processID());
+    appendDecimal(result,
+                  static_cast<bsls::Types::Int64>(
+                                          record.fixedFields().processID()));
 }
 
-void PrintUtil::appendString(bsl::string             *result,
+void PrintUtil::appendString(OutputBuffer            *result,
                              const bsl::string_view&  string,
                              bool                     notPrintable)
 {
@@ -513,14 +997,15 @@ void PrintUtil::appendString(bsl::string             *result,
 
         while (q != end) {
             if (*q < 0x20 || *q > 0x7E) {  // not printable
-                result->append(&*p, bsl::distance(p, q));
+                result->append(&*p, static_cast<int>(bsl::distance(p, q)));
 
                 static const char HEX[] = "0123456789ABCDEF";
                 const char        value = *q;
 
-                *result += "\\x";
-                *result += HEX[(value >> 4) & 0xF];
-                *result += HEX[value        & 0xF];
+                result->append('\\');
+                result->append('x');
+                result->append(HEX[(value >> 4) & 0xF]);
+                result->append(HEX[value        & 0xF]);
 
                 ++q;
                 p = q;
@@ -529,30 +1014,32 @@ void PrintUtil::appendString(bsl::string             *result,
                 ++q;
             }
         }
-        result->append(&*p, bsl::distance(p, q));
+        result->append(&*p, static_cast<int>(bsl::distance(p, q)));
     }
     else {
-        result->append(string.data(), string.length());
+        result->append(string);
     }
 }
 
-void PrintUtil::appendThreadId(bsl::string   *result,
+void PrintUtil::appendThreadId(OutputBuffer  *result,
                                const Record&  record)
 {
-    appendValue(result, "%llu", record.fixedFields().threadID());
+    appendDecimal(result, record.fixedFields().threadID());
 }
 
-void PrintUtil::appendThreadIdAsHex(bsl::string   *result,
+void PrintUtil::appendThreadIdAsHex(OutputBuffer  *result,
                                     const Record&  record)
 {
-    appendValue(result, "%llX", record.fixedFields().threadID());
+    appendHex(result, record.fixedFields().threadID());
 }
 
-void PrintUtil::appendSeverity(bsl::string   *result,
+void PrintUtil::appendSeverity(OutputBuffer  *result,
                                const Record&  record)
 {
-    result->append(Severity::toAscii(static_cast<Severity::Level>(
-                                            record.fixedFields().severity())));
+    const Severity::Level severity = static_cast<Severity::Level>(
+                                             record.fixedFields().severity());
+
+    result->append(bsl::string_view(Severity::toAscii(severity)));
 }
 
 void PrintUtil::appendUserFields(bsl::string *result, const Record& record)
@@ -584,6 +1071,7 @@ void PrintUtil::appendUserFields(bsl::string *result, const Record& record)
     }
 }
 
+
                        // ------------------------
                        // class AttributeFormatter
                        // ------------------------
@@ -710,11 +1198,44 @@ const char *RecordStringFormatter::k_DEFAULT_FORMAT =
 const char *RecordStringFormatter::k_BASIC_ATTRIBUTE_FORMAT =
     "\n%d %p:%t %s %f:%l %c %a %m\n";
 
+
 // PRIVATE MANIPULATORS
+void RecordStringFormatter::addField(int type, int argument)
+{
+    const Op op = { type, argument, 0 };
+
+    d_ops.push_back(op);
+}
+
+void RecordStringFormatter::addText(const char *text, int length)
+{
+    if (0 == length) {
+        return;                                                       // RETURN
+    }
+
+    const int offset = static_cast<int>(d_literals.length());
+
+    d_literals.append(text, length);
+
+    // As the text of the operations is appended to 'd_literals' in order, the
+    // text of a trailing 'e_TEXT' operation ends where 'text' begins.
+
+    if (!d_ops.empty() && e_TEXT == d_ops.back().d_type) {
+        d_ops.back().d_length += length;
+    }
+    else {
+        const Op op = { e_TEXT, offset, length };
+
+        d_ops.push_back(op);
+    }
+}
+
 void RecordStringFormatter::parseFormatSpecification()
 {
     d_fieldFormatters.clear();
     d_skipAttributes.clear();
+    d_literals.clear();
+    d_ops.clear();
 
     bsl::string::iterator i    = d_formatSpec.begin();
     bsl::string::iterator end  = d_formatSpec.end();
@@ -735,37 +1256,19 @@ void RecordStringFormatter::parseFormatSpecification()
             }
             if (text != end) {
                 // append text preceding to 'i'
-                d_fieldFormatters.emplace_back(
-                    bdlf::BindUtil::bind(&PrintUtil::appendString,
-                                         _1,
-                                         bsl::string_view(
-                                                       text,
-                                                       bsl::distance(text, i)),
-                                         false));
+                addText(&*text, static_cast<int>(bsl::distance(text, i)));
                 text = end;
             }
             ++i;
             switch (*i) {
               case 'n': {
-                d_fieldFormatters.emplace_back(
-                                 bdlf::BindUtil::bind(&PrintUtil::appendString,
-                                                      _1,
-                                                      "\n",
-                                                      false));
+                addText("\n", 1);
               } break;
               case 't': {
-                d_fieldFormatters.emplace_back(
-                                bdlf::BindUtil::bind( &PrintUtil::appendString,
-                                                      _1,
-                                                      "\t",
-                                                      false));
+                addText("\t", 1);
               } break;
               case '\\': {
-                d_fieldFormatters.emplace_back(
-                                 bdlf::BindUtil::bind(&PrintUtil::appendString,
-                                                      _1,
-                                                      "\\",
-                                                      false));
+                addText("\\", 1);
               } break;
               default: {
                 // Undefined: we just output the verbatim characters.
@@ -781,13 +1284,7 @@ void RecordStringFormatter::parseFormatSpecification()
 
             if (text != end) {
                 // append text preceding to 'i'
-                d_fieldFormatters.emplace_back(
-                      bdlf::BindUtil::bind(&PrintUtil::appendString,
-                                           _1,
-                                           bsl::string_view(
-                                                       text,
-                                                       bsl::distance(text, i)),
-                                           false));
+                addText(&*text, static_cast<int>(bsl::distance(text, i)));
                 text = end;
             }
 
@@ -798,118 +1295,52 @@ void RecordStringFormatter::parseFormatSpecification()
                 text = i;
               } break;
               case 'd': {  // ---------------- Datetime -----------------------
-                d_fieldFormatters.emplace_back(
-                          bdlf::BindUtil::bind(&PrintUtil::appendDatetime,
-                                               _1,
-                                               _2,
-                                               &d_timestampOffset,
-                                               false,
-                                               PrintUtil::e_FSP_MILLISECONDS));
+                addField(e_TIMESTAMP, e_TIMESTAMP_D);
               } break;
               case 'D': {  // ---------------- Datetime -----------------------
-                d_fieldFormatters.emplace_back(
-                          bdlf::BindUtil::bind(&PrintUtil::appendDatetime,
-                                               _1,
-                                               _2,
-                                               &d_timestampOffset,
-                                               false,
-                                               PrintUtil::e_FSP_MICROSECONDS));
+                addField(e_TIMESTAMP, e_TIMESTAMP_D_MICROSECONDS);
               } break;
               case 'i': {  // ---------------- Datetime ISO 8601 --------------
-                d_fieldFormatters.emplace_back(
-                          bdlf::BindUtil::bind(&PrintUtil::appendDatetime,
-                                               _1,
-                                               _2,
-                                               &d_timestampOffset,
-                                               true,
-                                               PrintUtil::e_FSP_NONE));
+                addField(e_TIMESTAMP, e_TIMESTAMP_I);
               } break;
               case 'I': {  // ---------------- Datetime ISO 8601 --------------
-                d_fieldFormatters.emplace_back(
-                          bdlf::BindUtil::bind(&PrintUtil::appendDatetime,
-                                               _1,
-                                               _2,
-                                               &d_timestampOffset,
-                                               true,
-                                               PrintUtil::e_FSP_MILLISECONDS));
+                addField(e_TIMESTAMP, e_TIMESTAMP_I_MILLISECONDS);
               } break;
               case 'O': {  // ---------------- Datetime ISO 8601 --------------
-                d_fieldFormatters.emplace_back(
-                          bdlf::BindUtil::bind(&PrintUtil::appendDatetime,
-                                               _1,
-                                               _2,
-                                               &d_timestampOffset,
-                                               true,
-                                               PrintUtil::e_FSP_MICROSECONDS));
+                addField(e_TIMESTAMP, e_TIMESTAMP_I_MICROSECONDS);
               } break;
               case 'p': {  // ---------------- Process ID ---------------------
-                d_fieldFormatters.emplace_back(
-                              bdlf::BindUtil::bind(&PrintUtil::appendProcessId,
-                                                   _1,
-                                                   _2));
+                addField(e_PROCESS_ID);
               } break;
               case 't': {  // ---------------- Thread ID ----------------------
-                d_fieldFormatters.emplace_back(
-                               bdlf::BindUtil::bind(&PrintUtil::appendThreadId,
-                                                    _1,
-                                                    _2));
+                addField(e_THREAD_ID);
               } break;
               case 'T': {  // ---------------- Thread ID hex ------------------
-                d_fieldFormatters.emplace_back(
-                          bdlf::BindUtil::bind(&PrintUtil::appendThreadIdAsHex,
-                                               _1,
-                                               _2));
+                addField(e_THREAD_ID_HEX);
               } break;
               case 's': {  // ---------------- Severity -----------------------
-                d_fieldFormatters.emplace_back(
-                               bdlf::BindUtil::bind(&PrintUtil::appendSeverity,
-                                                    _1,
-                                                    _2));
+                addField(e_SEVERITY);
               } break;
               case 'f': {  // ---------------- Filename -----------------------
-                d_fieldFormatters.emplace_back(
-                               bdlf::BindUtil::bind(&PrintUtil::appendFilename,
-                                                    _1,
-                                                    true,
-                                                    _2));
+                addField(e_FILENAME);
               } break;
               case 'F': {  // ---------------- Filename ----------------------
-                d_fieldFormatters.emplace_back(
-                               bdlf::BindUtil::bind(&PrintUtil::appendFilename,
-                                                    _1,
-                                                    false,
-                                                    _2));
+                addField(e_BASENAME);
               } break;
               case 'l': {  // ---------------- Line Number --------------------
-                d_fieldFormatters.emplace_back(
-                             bdlf::BindUtil::bind(&PrintUtil::appendLineNumber,
-                                                  _1,
-                                                  _2));
+                addField(e_LINE_NUMBER);
               } break;
               case 'c': {  // ---------------- Category -----------------------
-                d_fieldFormatters.emplace_back(
-                               bdlf::BindUtil::bind(&PrintUtil::appendCategory,
-                                                    _1,
-                                                    _2));
+                addField(e_CATEGORY);
               } break;
               case 'm': {  // ---------------- Message ------------------------
-                d_fieldFormatters.emplace_back(
-                                bdlf::BindUtil::bind(&PrintUtil::appendMessage,
-                                                     _1,
-                                                     _2));
+                addField(e_MESSAGE);
               } break;
               case 'x': {  // ---------------- Message ------------------------
-                d_fieldFormatters.emplace_back(
-                    bdlf::BindUtil::bind(
-                                    &PrintUtil::appendMessageNonPrintableChars,
-                                    _1,
-                                    _2));
+                addField(e_MESSAGE_PRINTABLE);
               } break;
               case 'X': {  // ---------------- Message as hex -----------------
-                d_fieldFormatters.emplace_back(
-                           bdlf::BindUtil::bind(&PrintUtil::appendMessageAsHex,
-                                                _1,
-                                                _2));
+                addField(e_MESSAGE_HEX);
               } break;
               case 'a': {  // ---------------- Attributes (%a) ----------------
                 bsl::string::iterator j = i + 1;
@@ -920,6 +1351,9 @@ void RecordStringFormatter::parseFormatSpecification()
                                                    bsl::distance(i + 2, j));
                         d_fieldFormatters.emplace_back(
                                                       AttributeFormatter(key));
+                        addField(e_FIELD_FORMATTER,
+                                 static_cast<int>(d_fieldFormatters.size()) -
+                                                                            1);
                         if (d_skipAttributes.end() ==
                             d_skipAttributes.find(key))
                         {
@@ -932,18 +1366,24 @@ void RecordStringFormatter::parseFormatSpecification()
                     d_fieldFormatters.emplace_back(
                         AttributesFormatter(&d_skipAttributes,
                                             d_skipAttributes.get_allocator()));
+                    addField(e_FIELD_FORMATTER,
+                             static_cast<int>(d_fieldFormatters.size()) - 1);
                 }
               } break;
               case 'A': {  // ---------------- Attributes (%A) ----------------
                 d_fieldFormatters.emplace_back(
                         AttributesFormatter(0,
                                             d_skipAttributes.get_allocator()));
+                addField(e_FIELD_FORMATTER,
+                         static_cast<int>(d_fieldFormatters.size()) - 1);
               } break;
               case 'u': {
                 d_fieldFormatters.emplace_back(
                              bdlf::BindUtil::bind(&PrintUtil::appendUserFields,
                                                   _1,
                                                   _2));
+                addField(e_FIELD_FORMATTER,
+                         static_cast<int>(d_fieldFormatters.size()) - 1);
               } break;
               default: {
                 // Undefined: we just output the verbatim characters.
@@ -957,11 +1397,76 @@ void RecordStringFormatter::parseFormatSpecification()
     }
 
     if (text != end) {
-        d_fieldFormatters.emplace_back(
-                                 bdlf::BindUtil::bind(&PrintUtil::appendString,
-                                                      _1,
-                                                      text,
-                                                      false));
+        addText(&*text, static_cast<int>(bsl::distance(text, end)));
+    }
+}
+
+// PRIVATE ACCESSORS
+void RecordStringFormatter::print(OutputBuffer  *output,
+                                  const Record&  record) const
+{
+    for (Ops::const_iterator i = d_ops.cbegin(); i != d_ops.cend(); ++i) {
+        switch (i->d_type) {
+          case e_TEXT: {
+            output->append(d_literals.data() + i->d_offset, i->d_length);
+          } break;
+          case e_TIMESTAMP: {
+            const TimestampFormat& format = k_TIMESTAMP_FORMATS[i->d_offset];
+
+            PrintUtil::appendDatetime(output,
+                                      record,
+                                      d_timestampOffset,
+                                      d_timestampCaches + i->d_offset,
+                                      format.d_iso8601,
+                                      format.d_secondPrecision);
+          } break;
+          case e_PROCESS_ID: {
+            PrintUtil::appendProcessId(output, record);
+          } break;
+          case e_THREAD_ID: {
+            PrintUtil::appendThreadId(output, record);
+          } break;
+          case e_THREAD_ID_HEX: {
+            PrintUtil::appendThreadIdAsHex(output, record);
+          } break;
+          case e_SEVERITY: {
+            PrintUtil::appendSeverity(output, record);
+          } break;
+          case e_FILENAME: {
+            PrintUtil::appendFilename(output, true, record);
+          } break;
+          case e_BASENAME: {
+            PrintUtil::appendFilename(output, false, record);
+          } break;
+          case e_LINE_NUMBER: {
+            PrintUtil::appendLineNumber(output, record);
+          } break;
+          case e_CATEGORY: {
+            PrintUtil::appendCategory(output, record);
+          } break;
+          case e_MESSAGE: {
+            PrintUtil::appendMessage(output, record);
+          } break;
+          case e_MESSAGE_PRINTABLE: {
+            PrintUtil::appendMessageNonPrintableChars(output, record);
+          } break;
+          case e_MESSAGE_HEX: {
+            PrintUtil::appendMessageAsHex(output, record);
+          } break;
+          case e_FIELD_FORMATTER: {
+            const int k_FIELD_BUFFER_SIZE = 256;
+
+            char fixedBuffer[k_FIELD_BUFFER_SIZE];
+            bdlma::BufferedSequentialAllocator stringAllocator(
+                                                          fixedBuffer,
+                                                          k_FIELD_BUFFER_SIZE);
+            bsl::string field(&stringAllocator);
+
+            d_fieldFormatters[i->d_offset](&field, record);
+
+            output->append(field);
+          } break;
+        }
     }
 }
 
@@ -971,6 +1476,8 @@ RecordStringFormatter::RecordStringFormatter(const allocator_type& allocator)
 , d_fieldFormatters(allocator)
 , d_skipAttributes(allocator)
 , d_timestampOffset(0)
+, d_literals(allocator)
+, d_ops(allocator)
 {
     parseFormatSpecification();
 }
@@ -980,6 +1487,8 @@ RecordStringFormatter::RecordStringFormatter(bslma::Allocator *basicAllocator)
 , d_fieldFormatters(basicAllocator)
 , d_skipAttributes(basicAllocator)
 , d_timestampOffset(0)
+, d_literals(basicAllocator)
+, d_ops(basicAllocator)
 {
     parseFormatSpecification();
 }
@@ -990,6 +1499,8 @@ RecordStringFormatter::RecordStringFormatter(const char            *format,
 , d_fieldFormatters(allocator)
 , d_skipAttributes(allocator)
 , d_timestampOffset(0)
+, d_literals(allocator)
+, d_ops(allocator)
 {
     parseFormatSpecification();
 }
@@ -1000,6 +1511,8 @@ RecordStringFormatter::RecordStringFormatter(const char       *format,
 , d_fieldFormatters(basicAllocator)
 , d_skipAttributes(basicAllocator)
 , d_timestampOffset(0)
+, d_literals(basicAllocator)
+, d_ops(basicAllocator)
 {
     parseFormatSpecification();
 }
@@ -1012,6 +1525,8 @@ RecordStringFormatter::RecordStringFormatter(
 , d_fieldFormatters(allocator)
 , d_skipAttributes(allocator)
 , d_timestampOffset(offset)
+, d_literals(allocator)
+, d_ops(allocator)
 {
     parseFormatSpecification();
 }
@@ -1029,6 +1544,8 @@ RecordStringFormatter::RecordStringFormatter(
                     publishInLocalTime
                     ? PublishInLocalTimeUtil::k_ENABLE
                     : PublishInLocalTimeUtil::k_DISABLE)
+, d_literals(allocator)
+, d_ops(allocator)
 {
     parseFormatSpecification();
 }
@@ -1041,6 +1558,8 @@ RecordStringFormatter::RecordStringFormatter(
 , d_fieldFormatters(allocator)
 , d_skipAttributes(allocator)
 , d_timestampOffset(offset)
+, d_literals(allocator)
+, d_ops(allocator)
 {
     parseFormatSpecification();
 }
@@ -1059,6 +1578,8 @@ RecordStringFormatter::RecordStringFormatter(
                     publishInLocalTime
                     ? PublishInLocalTimeUtil::k_ENABLE
                     : PublishInLocalTimeUtil::k_DISABLE)
+, d_literals(allocator)
+, d_ops(allocator)
 {
     parseFormatSpecification();
 }
@@ -1070,6 +1591,8 @@ RecordStringFormatter::RecordStringFormatter(
 , d_fieldFormatters(allocator)
 , d_skipAttributes(allocator)
 , d_timestampOffset(original.d_timestampOffset)
+, d_literals(allocator)
+, d_ops(allocator)
 {
     parseFormatSpecification();
 }
@@ -1095,10 +1618,13 @@ RecordStringFormatter& RecordStringFormatter::operator=(
                                               const RecordStringFormatter& rhs)
 {
     if (this != &rhs) {
+        // The field formatters and the compiled format refer to the format
+        // specification (and to the set of skipped attributes), so they are
+        // rebuilt from the copied specification rather than copied.
+
         d_formatSpec      = rhs.d_formatSpec;
-        d_fieldFormatters = rhs.d_fieldFormatters;
-        d_skipAttributes  = rhs.d_skipAttributes;
         d_timestampOffset = rhs.d_timestampOffset;
+        parseFormatSpecification();
     }
 
     return *this;
@@ -1109,29 +1635,42 @@ void RecordStringFormatter::operator()(bsl::ostream& stream,
                                        const Record& record) const
 
 {
-    const int k_BUFFER_SIZE        = 512;
-    const int k_STRING_RESERVATION = k_BUFFER_SIZE -
-                                     bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
-
-    char fixedBuffer[k_BUFFER_SIZE];
-    bdlma::BufferedSequentialAllocator stringAllocator(fixedBuffer,
-                                                       k_BUFFER_SIZE);
-    bsl::string output(&stringAllocator);
-    output.reserve(k_STRING_RESERVATION);
-
-    for (FieldStringFormatters::const_iterator i = d_fieldFormatters.cbegin();
-         i != d_fieldFormatters.cend();
-         ++i)
-    {
-        (*i)(&output, record);
-    }
+    // The record is formatted once, into 'buffer' or, if it does not fit,
+    // into 'overflow' (temporary memory, supplied by the default allocator),
+    // so that each field formatter is invoked only once.
+
+    const int k_BUFFER_SIZE = 512;
+
+    char         buffer[k_BUFFER_SIZE];
+    bsl::string  overflow;
+    OutputBuffer output(buffer, k_BUFFER_SIZE, &overflow);
+
+    print(&output, record);
 
-    stream.write(output.c_str(), output.size());
+    stream.write(output.data(), output.length());
     stream.flush();
 
     return;
 }
 
+int RecordStringFormatter::printToBuffer(char          *result,
+                                         int            numBytes,
+                                         const Record&  record) const
+{
+    BSLS_ASSERT(result || 0 == numBytes);
+    BSLS_ASSERT(0 <= numBytes);
+
+    OutputBuffer output(result, numBytes ? numBytes - 1 : 0);
+
+    print(&output, record);
+
+    if (numBytes) {
+        *output.cursor() = '\0';
+    }
+
+    return output.length();
+}
+
 }  // close package namespace
 
 // FREE OPERATORS
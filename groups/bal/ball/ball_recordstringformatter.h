@@ -32,6 +32,36 @@ BSLS_IDENT("$Id: $")
 // facilitates the logging of records in local time, if desired, in the event
 // that the timestamp attribute of records are in UTC.
 //
+// The 'printToBuffer' method formats a record in the same way as
+// 'operator()', but writes the result to a caller-supplied character buffer,
+// bypassing the overhead of a stream.  'operator()' is implemented in terms
+// of 'printToBuffer'.
+//
+///Performance
+///-----------
+// A format specification is compiled, when it is set, into a flat sequence
+// of operations, each of which either copies a run of literal text (with the
+// '\'-escape sequences resolved and adjacent runs merged) or renders one field
+// of a record directly into the output buffer.  Formatting a record does not
+// parse the format specification, nor allocate memory unless the formatted
+// record does not fit into the output buffer (or the format specification
+// contains '%a', '%A' or '%u' conversions, whose rendering may allocate if it
+// is unusually long).
+//
+// In addition, the date and time fields of each timestamp conversion ('%d',
+// '%D', '%i', '%I' and '%O') are rendered at most once per second of record
+// timestamps, and reused for the following records within that second (only
+// the fractional seconds are rendered for each record).  The offset applied to
+// a timestamp (including the local time offset when publishing in local time)
+// is still determined for each record.
+//
+///Thread Safety
+///-------------
+// The cache of rendered timestamps, and the caches of the attributes
+// conversions, are updated by 'operator()' and 'printToBuffer'; therefore,
+// those methods must not be invoked concurrently on the same record formatter
+// (distinct record formatters may be used concurrently).
+//
 ///Record Format Specification
 ///---------------------------
 // The following table lists the 'printf'-style ('%'-prefixed) conversion
@@ -128,9 +158,20 @@ BSLS_IDENT("$Id: $")
 //..
 //  6: Hello, World!
 //..
+// Finally, we format the same record into a character buffer, which avoids
+// the overhead of a stream altogether:
+//..
+//  char buffer[64];
+//
+//  const int length = formatter.printToBuffer(buffer, sizeof buffer, record);
+//
+//  assert(length < static_cast<int>(sizeof buffer));
+//  assert(0 == bsl::strcmp("\n6: Hello, World!\n", buffer));
+//..
 
 #include <balscm_version.h>
 
+#include <bdlt_datetime.h>
 #include <bdlt_datetimeinterval.h>
 
 #include <bslma_allocator.h>
@@ -152,6 +193,38 @@ namespace BloombergLP {
 namespace ball {
 
 class Record;
+class RecordStringFormatter_OutputBuffer;
+
+                // ==========================================
+                // struct RecordStringFormatter_TimestampCache
+                // ==========================================
+
+struct RecordStringFormatter_TimestampCache {
+    // PRIVATE STRUCT.  For use by the 'ball::RecordStringFormatter'
+    // implementation only.  This 'struct' holds the rendering of the date and
+    // time fields of the most recently formatted second for one timestamp
+    // conversion, split around the (not cached) fractional seconds.
+
+    // PUBLIC CONSTANTS
+    enum { k_MAX_LENGTH = 32 };  // capacity of the rendered text buffers
+
+    // PUBLIC DATA
+    bdlt::Datetime         d_second;        // start of the cached second (UTC)
+    bdlt::DatetimeInterval d_offset;        // offset applied to the timestamp
+    bool                   d_isValid;       // 'true' if the cache is loaded
+    int                    d_prefixLength;  // length of 'd_prefix'
+    int                    d_suffixLength;  // length of 'd_suffix'
+    char                   d_prefix[k_MAX_LENGTH];
+                                            // text preceding the fractional
+                                            // seconds
+    char                   d_suffix[k_MAX_LENGTH];
+                                            // text following the fractional
+                                            // seconds (time zone designator)
+
+    // CREATORS
+    RecordStringFormatter_TimestampCache();
+        // Create an empty timestamp cache.
+};
 
                         // ===========================
                         // class RecordStringFormatter
@@ -179,6 +252,26 @@ class RecordStringFormatter {
         // 'SkipAttributes' is an alias for a set of keys of attributes that
         // should not be printed as part of a '%a' format specifier.
 
+    struct Op {
+        // This 'struct' describes one operation of a compiled format
+        // specification: the rendering of a field of a record, or the copy of
+        // a run of literal text.
+
+        int d_type;    // type of the operation (see the implementation)
+        int d_offset;  // offset of the text in 'd_literals', or index of the
+                       // field formatter or timestamp cache
+        int d_length;  // length of the text in 'd_literals'
+    };
+
+    typedef bsl::vector<Op>                   Ops;
+        // 'Ops' is an alias for a compiled format specification.
+
+    typedef RecordStringFormatter_TimestampCache TimestampCache;
+        // 'TimestampCache' is an alias for the rendering of the most recently
+        // formatted second of a timestamp conversion.
+
+    enum { k_NUM_TIMESTAMP_FORMATS = 5 };  // number of timestamp conversions
+
   public:
     // TYPES
     typedef bsl::allocator<char>  allocator_type;
@@ -189,11 +282,34 @@ class RecordStringFormatter {
     FieldStringFormatters    d_fieldFormatters;  // field formatter collection
     SkipAttributes           d_skipAttributes;   // set of skipped attributes
     bdlt::DatetimeInterval   d_timestampOffset;  // offset added to timestamps
+    bsl::string              d_literals;         // literal text of 'd_ops'
+    Ops                      d_ops;              // compiled format spec.
+
+    mutable TimestampCache   d_timestampCaches[k_NUM_TIMESTAMP_FORMATS];
+                                                 // rendered timestamps, one
+                                                 // per timestamp conversion
 
     // PRIVATE MANIPULATORS
+    void addField(int type, int argument = 0);
+        // Append to the compiled format specification an operation of the
+        // specified 'type' rendering a field of a record, having the
+        // optionally specified 'argument'.
+
+    void addText(const char *text, int length);
+        // Append to the compiled format specification an operation copying
+        // the specified 'text' of the specified 'length', merging it with the
+        // last operation if that operation also copies text.
+
     void parseFormatSpecification();
         // Parse the format specification.
 
+    // PRIVATE ACCESSORS
+    void print(RecordStringFormatter_OutputBuffer *output,
+               const Record&                       record) const;
+        // Format the specified 'record' according to the format specification
+        // of this record formatter, and write the result to the specified
+        // 'output'.
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(RecordStringFormatter,
@@ -335,6 +451,20 @@ class RecordStringFormatter {
         // 'stream'.  The timestamp offset of this record formatter is added to
         // each timestamp that is output to 'stream'.
 
+    int printToBuffer(char          *result,
+                      int            numBytes,
+                      const Record&  record) const;
+        // Format the specified 'record' according to the format specification
+        // of this record formatter, and write no more than the specified
+        // 'numBytes' of the result to the specified 'result' buffer.  Return
+        // the number of characters (not including the null character) that
+        // would have been written if the limit due to 'numBytes' were not
+        // imposed.  'result' is null-terminated unless 'numBytes' is 0.  The
+        // behavior is undefined unless '0 <= numBytes' and 'result' refers to
+        // at least 'numBytes' contiguous bytes.  Note that the return value is
+        // greater than or equal to 'numBytes' if the output was truncated to
+        // avoid 'result' overrun.
+
     const char *format() const;
         // Return the format specification of this record formatter.
 
@@ -382,6 +512,21 @@ bsl::ostream& operator<<(bsl::ostream&                output,
 //                              INLINE DEFINITIONS
 // ============================================================================
 
+                // ------------------------------------------
+                // struct RecordStringFormatter_TimestampCache
+                // ------------------------------------------
+
+// CREATORS
+inline
+RecordStringFormatter_TimestampCache::RecordStringFormatter_TimestampCache()
+: d_second()
+, d_offset()
+, d_isValid(false)
+, d_prefixLength(0)
+, d_suffixLength(0)
+{
+}
+
                         // ---------------------------
                         // class RecordStringFormatter
                         // ---------------------------
@@ -8,7 +8,9 @@
 #include <ball_userfields.h>
 
 #include <bdlt_currenttime.h>
+#include <bdlsb_memoutstreambuf.h>
 #include <bdlt_datetime.h>
+#include <bdlt_datetimetz.h>
 #include <bdlt_iso8601util.h>
 #include <bdlt_localtimeoffset.h>
 
@@ -23,8 +25,10 @@
 #include <bslmt_threadutil.h>
 
 #include <bsls_platform.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_iostream.h>
 #include <bsl_iomanip.h>
 #include <bsl_ostream.h>
@@ -88,6 +92,7 @@ using bsl::uppercase;
 // [13] bool isPublishInLocalTimeEnabled() const;
 // [ 2] const bdlt::DatetimeInterval& timestampOffset() const;
 // [11] void operator()(bsl::ostream&, const ball::Record&) const;
+// [16] int printToBuffer(char *, int, const ball::Record&) const;
 // FREE OPERATORS
 // [ 6] bool operator==(const ball::RSF& lhs, const ball::RSF& rhs);
 // [ 6] bool operator!=(const ball::RSF& lhs, const ball::RSF& rhs);
@@ -95,6 +100,7 @@ using bsl::uppercase;
 // ----------------------------------------------------------------------------
 // [ 1] breathing test
 // [12] USAGE example
+// [-1] PERFORMANCE: 'operator()' AND 'printToBuffer'
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -282,6 +288,202 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:
+      case 16: {
+        // --------------------------------------------------------------------
+        // TESTING 'printToBuffer'
+        //
+        // Concerns:
+        //: 1 'printToBuffer' writes the same text as 'operator()'.
+        //:
+        //: 2 'printToBuffer' returns the length of the formatted record,
+        //:   writes at most 'numBytes' characters (including the terminating
+        //:   null character), and null-terminates the output unless
+        //:   'numBytes' is 0.
+        //:
+        //: 3 Timestamps are rendered correctly as records of the same second,
+        //:   of the following seconds, and of earlier seconds are formatted,
+        //:   and when the timestamp offset changes between records of the
+        //:   same second.
+        //:
+        //: 4 'printToBuffer' allocates no memory for a record whose fields
+        //:   are rendered into the supplied buffer.
+        //
+        // Plan:
+        //: 1 For a set of format specifications, and records having a
+        //:   sequence of timestamps, compare the output of 'printToBuffer',
+        //:   for each buffer size up to the length of the output, with the
+        //:   output of 'operator()'.  (C-1..2)
+        //:
+        //: 2 Format a sequence of timestamps, moving forward and backward in
+        //:   time, with each timestamp conversion, and compare the output
+        //:   with that of 'bdlt::Datetime::printToBuffer' and
+        //:   'bdlt::Iso8601Util::generateRaw'.  Change the timestamp offset
+        //:   between records of the same second.  (C-3)
+        //:
+        //: 3 Use a test allocator, installed as the default allocator, to
+        //:   verify that no memory is allocated.  (C-4)
+        //
+        // Testing:
+        //   int printToBuffer(char *, int, const ball::Record&) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'printToBuffer'"
+                          << "\n=======================" << endl;
+
+        bslma::TestAllocator         oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        static const bsls::Types::Int64 MICROSECONDS[] = {
+            0, 1, 999, 1000, 999999, 1000000, 1000001, 2500000, 1999999, -1,
+            -1000000, 61000000, 3600000000LL, 86400000000LL, 0
+        };
+        const int NUM_MICROSECONDS =
+                                   sizeof MICROSECONDS / sizeof *MICROSECONDS;
+
+        const bdlt::Datetime BASE(2023, 12, 31, 23, 59, 59, 123, 456);
+
+        if (verbose) cout << "\tComparing with 'operator()'." << endl;
+        {
+            static const char *FORMATS[] = {
+                "\n%d %p:%t %s %f:%l %c %m %u\n",
+                "\n%d %p:%t %s %f:%l %c %a %m\n",
+                "%i %I %O %D %T %F %x %X",
+                "%a[key] %A %a - 100%% \\t\\\\ \\q %q",
+                "",
+                "%m%"
+            };
+            const int NUM_FORMATS = sizeof FORMATS / sizeof *FORMATS;
+
+            for (int ti = 0; ti < NUM_FORMATS; ++ti) {
+                const char *FORMAT = FORMATS[ti];
+
+                Obj mX(FORMAT, &oa);  const Obj& X = mX;
+
+                for (int tj = 0; tj < NUM_MICROSECONDS; ++tj) {
+                    bdlt::Datetime timestamp(BASE);
+                    timestamp.addMicroseconds(MICROSECONDS[tj]);
+
+                    ball::RecordAttributes fixedFields(timestamp,
+                                                       1234,
+                                                       0xABCDEF,
+                                                       "/a/b/c.cpp",
+                                                       tj,
+                                                       "CAT",
+                                                       ball::Severity::e_WARN,
+                                                       "msg\x01",
+                                                       &oa);
+                    ball::UserFields userFields(&oa);
+                    userFields.appendInt64(tj);
+
+                    Rec mR(fixedFields, userFields, &oa);
+                    mR.addAttribute(ball::Attribute("key", tj, &oa));
+
+                    bsl::ostringstream oss(&oa);
+                    X(oss, mR);
+                    const bsl::string EXPECTED(oss.str(), &oa);
+                    const int         LENGTH =
+                                           static_cast<int>(EXPECTED.length());
+
+                    if (veryVerbose) { T_ P_(FORMAT) P(EXPECTED) }
+
+                    for (int numBytes = 0; numBytes <= LENGTH + 2; ++numBytes)
+                    {
+                        char buffer[256];
+                        bsl::memset(buffer, 'X', sizeof buffer);
+
+                        const bsls::Types::Int64 NUM_BLOCKS =
+                                                           da.numBlocksTotal();
+
+                        const int length = X.printToBuffer(buffer,
+                                                           numBytes,
+                                                           mR);
+
+                        ASSERTV(ti, tj, numBytes, length, LENGTH ==  length);
+                        ASSERTV(ti, tj, numBytes,
+                                NUM_BLOCKS == da.numBlocksTotal());
+
+                        if (0 == numBytes) {
+                            ASSERTV(ti, tj, 'X' == buffer[0]);
+                            continue;
+                        }
+
+                        const int numWritten = bsl::min(LENGTH, numBytes - 1);
+
+                        ASSERTV(ti, tj, numBytes,
+                                0 == bsl::memcmp(buffer,
+                                                 EXPECTED.data(),
+                                                 numWritten));
+                        ASSERTV(ti, tj, numBytes, '\0' == buffer[numWritten]);
+                        ASSERTV(ti, tj, numBytes,
+                                'X'  == buffer[numWritten + 1]);
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\tTesting timestamp conversions." << endl;
+        {
+            Obj mX("%d|%D|%i|%I|%O", &oa);  const Obj& X = mX;
+
+            static const int OFFSETS[] = { 0, 0, 90, 90, -30, 0 };
+            const int NUM_OFFSETS = sizeof OFFSETS / sizeof *OFFSETS;
+
+            for (int ti = 0; ti < NUM_OFFSETS; ++ti) {
+                const int OFFSET = OFFSETS[ti];  // in minutes
+
+                mX.setTimestampOffset(bdlt::DatetimeInterval(0, 0, OFFSET));
+
+                for (int tj = 0; tj < NUM_MICROSECONDS; ++tj) {
+                    bdlt::Datetime timestamp(BASE);
+                    timestamp.addMicroseconds(MICROSECONDS[tj]);
+
+                    Rec mR(&oa);
+                    mR.fixedFields().setTimestamp(timestamp);
+
+                    const bdlt::DatetimeInterval OFFSET_INTERVAL(0, 0, OFFSET);
+                    const bdlt::DatetimeTz       TIMESTAMP(
+                                                 timestamp + OFFSET_INTERVAL,
+                                                 OFFSET);
+
+                    char expected[256];
+                    char *p = expected;
+
+                    p += TIMESTAMP.localDatetime().printToBuffer(p, 64, 3);
+                    *p++ = '|';
+                    p += TIMESTAMP.localDatetime().printToBuffer(p, 64, 6);
+
+                    bdlt::Iso8601UtilConfiguration config;
+                    config.setUseZAbbreviationForUtc(true);
+
+                    static const int PRECISIONS[] = { 0, 3, 6 };
+                    for (int tk = 0; tk < 3; ++tk) {
+                        config.setFractionalSecondPrecision(PRECISIONS[tk]);
+                        *p++ = '|';
+                        p += bdlt::Iso8601Util::generateRaw(p,
+                                                            TIMESTAMP,
+                                                            config);
+                    }
+                    *p = '\0';
+
+                    const bsls::Types::Int64 NUM_BLOCKS = da.numBlocksTotal();
+
+                    char buffer[256];
+                    const int length = X.printToBuffer(buffer,
+                                                       sizeof buffer,
+                                                       mR);
+
+                    ASSERTV(ti, tj, NUM_BLOCKS == da.numBlocksTotal());
+
+                    if (veryVerbose) { T_ P_(expected) P(buffer) }
+
+                    ASSERTV(ti, tj, expected, buffer,
+                            0 == bsl::strcmp(expected, buffer));
+                    ASSERTV(ti, tj, static_cast<int>(p - expected) == length);
+                }
+            }
+        }
+      } break;
       case 15: {
         // --------------------------------------------------------------------
         // TESTING: Overload resolution for 'RecordStringFormatter' changed due
@@ -707,6 +909,17 @@ int main(int argc, char *argv[])
         formatter(oss, record);
         if (veryVerbose) cout << oss.str();
 
+// Finally, we format the same record into a character buffer, which avoids
+// the overhead of a stream altogether:
+//..
+    char buffer[64];
+
+    const int length = formatter.printToBuffer(buffer, sizeof buffer, record);
+
+    ASSERT(length < static_cast<int>(sizeof buffer));
+    ASSERT(0 == bsl::strcmp("\n6: Hello, World!\n", buffer));
+//..
+
       } break;
       case 12: {
         // --------------------------------------------------------------------
@@ -2318,6 +2531,100 @@ int main(int argc, char *argv[])
         ASSERT( 0 == (X1 == X3));        ASSERT(1 == (X1 != X3));
         ASSERT( 1 == (X1 == X4));        ASSERT(0 == (X1 != X4));
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: 'operator()' AND 'printToBuffer'
+        //
+        // Concerns:
+        //: 1 Formatting a record into a buffer is faster than formatting it to
+        //:   a stream.
+        //
+        // Plan:
+        //: 1 For the default and the basic attribute format specifications,
+        //:   format a number of records, having increasing timestamps, to a
+        //:   stream using 'operator()', and to a buffer using 'printToBuffer',
+        //:   and report the average time per record.
+        //
+        // Testing:
+        //   PERFORMANCE: 'operator()' AND 'printToBuffer'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout
+                       << "\nPERFORMANCE: 'operator()' AND 'printToBuffer'"
+                       << "\n=============================================="
+                       << endl;
+
+        bslma::TestAllocator         oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        const int NUM_RECORDS = argc > 2 ? bsl::atoi(argv[2]) : 1000000;
+
+        const char *FORMATS[] = {
+            Obj::k_DEFAULT_FORMAT,
+            Obj::k_BASIC_ATTRIBUTE_FORMAT
+        };
+        const int NUM_FORMATS = sizeof FORMATS / sizeof *FORMATS;
+
+        ball::RecordAttributes fixedFields(bdlt::Datetime(2023, 12, 31),
+                                           1234,
+                                           5678,
+                                           "groups/bal/ball/ball_example.cpp",
+                                           123,
+                                           "EXAMPLE.CATEGORY",
+                                           ball::Severity::e_INFO,
+                                           "A typical log message of moderate "
+                                           "length, with a value of 42.",
+                                           &oa);
+        Rec mR(fixedFields, ball::UserFields(&oa), &oa);
+        mR.addAttribute(ball::Attribute("request.id", 987654, &oa));
+
+        bdlsb::MemOutStreamBuf streamBuf(&oa);
+        bsl::ostream           stream(&streamBuf);
+
+        char           buffer[512];
+        bdlt::Datetime timestamp(2023, 12, 31);
+
+        for (int ti = 0; ti < NUM_FORMATS; ++ti) {
+            const char *FORMAT = FORMATS[ti];
+
+            Obj mX(FORMAT, &oa);  const Obj& X = mX;
+
+            bsls::Stopwatch timer;
+            bsls::Types::Int64 total = 0;
+
+            timer.start();
+            for (int i = 0; i < NUM_RECORDS; ++i) {
+                timestamp.addMicroseconds(997);
+                mR.fixedFields().setTimestamp(timestamp);
+                streamBuf.pubseekpos(0);
+                X(stream, mR);
+            }
+            timer.stop();
+
+            const double streamTime = timer.elapsedTime();
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < NUM_RECORDS; ++i) {
+                timestamp.addMicroseconds(997);
+                mR.fixedFields().setTimestamp(timestamp);
+                total += X.printToBuffer(buffer, sizeof buffer, mR);
+            }
+            timer.stop();
+
+            const double bufferTime = timer.elapsedTime();
+
+            ASSERT(0 < total);
+
+            cout << "format: \"" << FORMAT << "\"\n"
+                 << "\toperator():    "
+                 << streamTime * 1e9 / NUM_RECORDS << " ns/record\n"
+                 << "\tprintToBuffer: "
+                 << bufferTime * 1e9 / NUM_RECORDS << " ns/record"
+                 << endl;
+        }
+      } break;
       default:
         {
             cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
@@ -0,0 +1,417 @@
+// ball_ringbufferobserver.cpp                                        -*-C++-*-
+#include <ball_ringbufferobserver.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ball_ringbufferobserver_cpp,"$Id$ $CSID$")
+
+#include <ball_record.h>
+#include <ball_recordattributes.h>
+
+#include <bdlb_bitutil.h>
+
+#include <bdlf_memfn.h>
+
+#include <bslma_default.h>
+
+#include <bslmf_assert.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_threadattributes.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+
+#include <bsl_cstdint.h>
+#include <bsl_new.h>
+
+///Implementation Notes
+///--------------------
+// The ring buffer is a variant of the bounded queue of D. Vyukov, in which
+// each slot holds a sequence number: a slot whose sequence number is '2 * n'
+// is free to hold the 'n'th record published (counting from 0), and it holds
+// that record once its sequence number is '2 * n + 1'.  Once the publication
+// thread has published the record, it sets the sequence number of the slot to
+// '2 * (n + capacity)', making the slot available to the record that follows
+// by 'capacity' records.  (Vyukov's queue uses 'n' and 'n + 1', which does
+// not distinguish a full slot from a free one if 'capacity' is 1.)
+//
+// As in Vyukov's queue, a producer claims the sequence number 'n' held by
+// 'd_nextWriteSequence' by first checking that the slot for 'n' is free
+// (i.e., that its sequence number is '2 * n'), and then incrementing
+// 'd_nextWriteSequence' with a compare-and-swap; this is the only
+// read-modify-write operation performed by an uncontended 'publish'.  A slot
+// whose sequence number is less than '2 * n' still holds the record published
+// 'capacity' records earlier, so the ring buffer is full, and the producer
+// either drops its record or blocks, having claimed nothing.  Note that a
+// fetch-and-add cannot be used to claim the sequence number, as a producer
+// could then not give it back to drop its record when the ring buffer is
+// full.  The number of records in the ring buffer is derived from the write
+// and read sequence numbers, rather than being maintained by a separate
+// counter.
+//
+// Each slot is padded to a multiple of the cache line size, and the slots are
+// aligned on a cache line boundary, so that producers claiming consecutive
+// sequence numbers do not write to the same cache line.
+//
+// The publication thread, and producers blocked on a full ring buffer, wait on
+// conditions (rather than spinning), using the following protocol to avoid
+// lost wake-ups: the waiting thread sets a flag (or increments a count), then
+// checks, with the mutex locked, whether it can proceed, before waiting; the
+// signaling thread changes the state (adding a record, or freeing a slot),
+// then checks the flag (or count), and signals with the mutex locked if it is
+// set.  Since the flag and the state are accessed with sequentially consistent
+// operations, either the waiting thread observes the new state, or the
+// signaling thread observes the flag.
+
+namespace BloombergLP {
+namespace ball {
+
+namespace {
+
+static const char *const k_THREAD_NAME = "ringobserver";
+
+BSLMF_ASSERT(0 == sizeof(RingBufferObserver_Slot)
+                                     % bslmt::Platform::e_CACHE_LINE_SIZE);
+
+RingBufferObserver_Slot *createSlots(void             **buffer,
+                                     int                capacity,
+                                     bslma::Allocator  *allocator)
+    // Return the address of an array of the specified 'capacity' slots,
+    // aligned on a cache line boundary, in which the slot at each index 'i'
+    // has the sequence number 'i', and load into the specified 'buffer' the
+    // address of the memory, allocated using the specified 'allocator',
+    // holding the array.
+{
+    *buffer = allocator->allocate(capacity * sizeof(RingBufferObserver_Slot)
+                                  + bslmt::Platform::e_CACHE_LINE_SIZE);
+
+    char *address = static_cast<char *>(*buffer);
+    address += bsls::AlignmentUtil::calculateAlignmentOffset(
+                                         address,
+                                         bslmt::Platform::e_CACHE_LINE_SIZE);
+
+    RingBufferObserver_Slot *slots =
+                   reinterpret_cast<RingBufferObserver_Slot *>(address);
+
+    for (int i = 0; i < capacity; ++i) {
+        new (slots + i) RingBufferObserver_Slot();
+        slots[i].d_sequence.storeRelaxed(2 * i);
+    }
+    return slots;
+}
+
+int roundUpCapacity(int capacity)
+    // Return the smallest power of two that is not less than the specified
+    // 'capacity'.  The behavior is undefined unless
+    // '0 < capacity <= 2^30'.
+{
+    BSLS_ASSERT(0 < capacity);
+    BSLS_ASSERT(capacity <= (1 << 30));
+
+    return static_cast<int>(bdlb::BitUtil::roundUpToBinaryPower(
+                                       static_cast<bsl::uint32_t>(capacity)));
+}
+
+}  // close unnamed namespace
+
+                          // ------------------------
+                          // class RingBufferObserver
+                          // ------------------------
+
+// PRIVATE MANIPULATORS
+bool RingBufferObserver::claimSlot(bsls::Types::Int64 *sequence)
+{
+    const bsls::Types::Int64 mask = d_capacity - 1;
+
+    bsls::Types::Int64 next = d_nextWriteSequence.loadRelaxed();
+    while (true) {
+        const bsls::Types::Int64 slotSequence =
+                                     d_slots_p[next & mask].d_sequence.load();
+
+        if (slotSequence == 2 * next) {
+            const bsls::Types::Int64 previous =
+                              d_nextWriteSequence.testAndSwap(next, next + 1);
+            if (previous == next) {
+                *sequence = next;
+                return true;                                          // RETURN
+            }
+            next = previous;
+        }
+        else if (slotSequence < 2 * next) {
+            return false;                                             // RETURN
+        }
+        else {
+            // Another producer claimed 'next'.
+
+            next = d_nextWriteSequence.loadRelaxed();
+        }
+    }
+}
+
+void RingBufferObserver::freeSlot(Slot *slot)
+{
+    const bsls::Types::Int64 sequence = d_nextReadSequence.loadRelaxed();
+
+    slot->d_record.reset();
+    slot->d_sequence.store(2 * (sequence + d_capacity));
+    d_nextReadSequence.storeRelaxed(sequence + 1);
+
+    if (0 < d_numProducersWaiting.load()) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_waitMutex);
+        d_producerCondition.broadcast();
+    }
+}
+
+void RingBufferObserver::publishThreadEntryPoint()
+{
+    const bsls::Types::Int64 mask = d_capacity - 1;
+
+    while (true) {
+        const bsls::Types::Int64  next  = d_nextReadSequence.loadRelaxed();
+        Slot                     *slot  = d_slots_p + (next & mask);
+        const bsls::Types::Int64  ready = 2 * next + 1;
+
+        if (ready == slot->d_sequence.loadAcquire()) {
+            if (e_SHUTTING_DOWN == d_threadState.load()) {
+                return;                                               // RETURN
+            }
+            d_observer->publish(slot->d_record, slot->d_context);
+            freeSlot(slot);
+            continue;
+        }
+
+        // The ring buffer is empty, or the next record is being added.
+
+        if (e_RUNNING != d_threadState.load()) {
+            return;                                                   // RETURN
+        }
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_waitMutex);
+
+        d_consumerWaiting.store(1);
+        while (ready != slot->d_sequence.load()
+            && e_RUNNING == d_threadState.load()) {
+            d_consumerCondition.wait(&d_waitMutex);
+        }
+        d_consumerWaiting.store(0);
+    }
+}
+
+void RingBufferObserver::removeAll()
+{
+    const bsls::Types::Int64 mask = d_capacity - 1;
+
+    while (true) {
+        const bsls::Types::Int64  next = d_nextReadSequence.loadRelaxed();
+        Slot                     *slot = d_slots_p + (next & mask);
+
+        if (2 * next + 1 != slot->d_sequence.loadAcquire()) {
+            return;                                                   // RETURN
+        }
+        freeSlot(slot);
+    }
+}
+
+int RingBufferObserver::startThread()
+{
+    if (bslmt::ThreadUtil::invalidHandle() != d_threadHandle) {
+        return 0;                                                     // RETURN
+    }
+
+    d_threadState.store(e_RUNNING);
+
+    bslmt::ThreadAttributes attributes;
+    attributes.setThreadName(k_THREAD_NAME);
+
+    const int rc = bslmt::ThreadUtil::create(
+          &d_threadHandle,
+          attributes,
+          bdlf::MemFnUtil::memFn(&RingBufferObserver::publishThreadEntryPoint,
+                                 this));
+    if (0 != rc) {
+        d_threadHandle = bslmt::ThreadUtil::invalidHandle();
+        d_threadState.store(e_NOT_RUNNING);
+    }
+    return rc;
+}
+
+int RingBufferObserver::stopThread(ThreadState state)
+{
+    if (bslmt::ThreadUtil::invalidHandle() == d_threadHandle) {
+        return 0;                                                     // RETURN
+    }
+
+    d_threadState.store(state);
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_waitMutex);
+        d_consumerCondition.signal();
+    }
+
+    const int rc = bslmt::ThreadUtil::join(d_threadHandle);
+
+    d_threadHandle = bslmt::ThreadUtil::invalidHandle();
+    d_threadState.store(e_NOT_RUNNING);
+
+    return rc;
+}
+
+// CREATORS
+RingBufferObserver::RingBufferObserver(
+                            const bsl::shared_ptr<Observer>&  observer,
+                            int                               capacity,
+                            bslma::Allocator                 *basicAllocator)
+: d_nextWriteSequence(0)
+, d_nextReadSequence(0)
+, d_consumerWaiting(0)
+, d_numProducersWaiting(0)
+, d_numRecordsDropped(0)
+, d_threadState(e_NOT_RUNNING)
+, d_slots_p(0)
+, d_slotsBuffer_p(0)
+, d_capacity(roundUpCapacity(capacity))
+, d_dropRecordsOnFullQueueThreshold(Severity::e_OFF)
+, d_observer(observer)
+, d_threadHandle(bslmt::ThreadUtil::invalidHandle())
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(observer);
+
+    d_slots_p = createSlots(&d_slotsBuffer_p, d_capacity, d_allocator_p);
+}
+
+RingBufferObserver::RingBufferObserver(
+            const bsl::shared_ptr<Observer>&  observer,
+            int                               capacity,
+            Severity::Level                   dropRecordsOnFullQueueThreshold,
+            bslma::Allocator                 *basicAllocator)
+: d_nextWriteSequence(0)
+, d_nextReadSequence(0)
+, d_consumerWaiting(0)
+, d_numProducersWaiting(0)
+, d_numRecordsDropped(0)
+, d_threadState(e_NOT_RUNNING)
+, d_slots_p(0)
+, d_slotsBuffer_p(0)
+, d_capacity(roundUpCapacity(capacity))
+, d_dropRecordsOnFullQueueThreshold(dropRecordsOnFullQueueThreshold)
+, d_observer(observer)
+, d_threadHandle(bslmt::ThreadUtil::invalidHandle())
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(observer);
+
+    d_slots_p = createSlots(&d_slotsBuffer_p, d_capacity, d_allocator_p);
+}
+
+RingBufferObserver::~RingBufferObserver()
+{
+    stopPublicationThread();
+    removeAll();
+
+    for (int i = 0; i < d_capacity; ++i) {
+        d_slots_p[i].~Slot();
+    }
+    d_allocator_p->deallocate(d_slotsBuffer_p);
+}
+
+// MANIPULATORS
+void RingBufferObserver::publish(const bsl::shared_ptr<const Record>& record,
+                                 const Context&                       context)
+{
+    BSLS_ASSERT(record);
+
+    bsls::Types::Int64 sequence;
+    if (!claimSlot(&sequence)) {
+        if (record->fixedFields().severity() >
+                                           d_dropRecordsOnFullQueueThreshold) {
+            d_numRecordsDropped.addRelaxed(1);
+            return;                                                   // RETURN
+        }
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_waitMutex);
+
+        d_numProducersWaiting.add(1);
+        while (!claimSlot(&sequence)) {
+            d_producerCondition.wait(&d_waitMutex);
+        }
+        d_numProducersWaiting.add(-1);
+    }
+
+    Slot *slot = d_slots_p + (sequence & (d_capacity - 1));
+
+    slot->d_record  = record;
+    slot->d_context = context;
+    slot->d_sequence.store(2 * sequence + 1);
+
+    if (d_consumerWaiting.load()) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_waitMutex);
+        d_consumerCondition.signal();
+    }
+}
+
+void RingBufferObserver::releaseRecords()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    const bool wasRunning =
+                      bslmt::ThreadUtil::invalidHandle() != d_threadHandle;
+
+    if (0 != stopThread(e_SHUTTING_DOWN)) {
+        return;                                                       // RETURN
+    }
+
+    removeAll();
+    d_observer->releaseRecords();
+
+    if (wasRunning) {
+        startThread();
+    }
+}
+
+int RingBufferObserver::shutdownPublicationThread()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return stopThread(e_SHUTTING_DOWN);
+}
+
+int RingBufferObserver::startPublicationThread()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return startThread();
+}
+
+int RingBufferObserver::stopPublicationThread()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return stopThread(e_STOPPING);
+}
+
+// ACCESSORS
+bool RingBufferObserver::isPublicationThreadRunning() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return bslmt::ThreadUtil::invalidHandle() != d_threadHandle;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,500 @@
+// ball_ringbufferobserver.h                                          -*-C++-*-
+#ifndef INCLUDED_BALL_RINGBUFFEROBSERVER
+#define INCLUDED_BALL_RINGBUFFEROBSERVER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an observer forwarding records through a lock-free ring.
+//
+//@CLASSES:
+//  ball::RingBufferObserver: asynchronous observer using a bounded ring buffer
+//
+//@SEE_ALSO: ball_observer, ball_asyncfileobserver, bdlcc_boundedqueue
+//
+//@DESCRIPTION: This component provides a concrete implementation of the
+// 'ball::Observer' protocol, 'ball::RingBufferObserver', that *asynchronously*
+// forwards the log records it receives to an inner observer supplied at
+// construction:
+//..
+//              ,------------------------.
+//             ( ball::RingBufferObserver )
+//              `------------------------'
+//                          |              ctor
+//                          |              shutdownPublicationThread
+//                          |              startPublicationThread
+//                          |              stopPublicationThread
+//                          |              capacity
+//                          |              dropRecordsOnFullQueueThreshold
+//                          |              isPublicationThreadRunning
+//                          |              numRecordsDropped
+//                          |              recordQueueLength
+//                          V
+//                   ,--------------.
+//                  ( ball::Observer )
+//                   `--------------'
+//                                         dtor
+//                                         publish
+//                                         releaseRecords
+//..
+// The 'publish' method of a 'ball::RingBufferObserver' stores the supplied
+// record and context in a slot of a fixed-size ring buffer, and returns
+// without waiting for the record to be published.  A publication thread owned
+// by the observer (see 'startPublicationThread') removes the records from the
+// ring buffer, in order, and publishes them to the inner observer.
+//
+// The ring buffer is designed for the case where many threads log
+// concurrently (multiple producers) and a single thread publishes (single
+// consumer).  Its slots are allocated, once, at construction, so that
+// 'publish' allocates no memory (the record is held by copying the supplied
+// shared pointer).  A thread calling 'publish' claims the next slot using a
+// single atomic compare-and-swap, without acquiring any lock, and producers
+// contend only on that operation, rather than on a mutex as in
+// 'bdlcc::BoundedQueue'.  Each slot is padded to a multiple of the cache line
+// size, so that producers writing adjacent slots do not share a cache line.
+// The publication thread sleeps only when the ring buffer is empty, and is
+// then woken by the next call to 'publish'.  Note that the capacity supplied
+// at construction is rounded up to a power of two.
+//
+///Full Ring Buffer
+///----------------
+// The behavior of 'publish' when the ring buffer is full is determined by the
+// 'dropRecordsOnFullQueueThreshold' constructor argument, as for
+// 'ball::AsyncFileObserver': records whose severity is less severe than that
+// threshold are dropped, and 'publish' blocks, until a slot is freed by the
+// publication thread, for records whose severity is at least as severe as the
+// threshold.  In particular:
+//
+//: o If the threshold is 'Severity::e_OFF' (the default), *all* records are
+//:   dropped when the ring buffer is full, and 'publish' never blocks.
+//:
+//: o If the threshold is 'Severity::e_TRACE', 'publish' blocks for *all*
+//:   records when the ring buffer is full, and no record is dropped.
+//:
+//: o Otherwise, only the records that are less severe than the threshold are
+//:   dropped.
+//
+// The number of dropped records is reported by 'numRecordsDropped'.  Note
+// that, since 'publish' blocks until the publication thread frees a slot, a
+// record that is not dropped blocks the calling thread indefinitely if the
+// ring buffer is full and the publication thread is not running.
+//
+///Thread Safety
+///-------------
+// 'ball::RingBufferObserver' is fully *thread-safe*, meaning that all
+// non-creator operations on a given instance can be safely invoked
+// simultaneously from multiple threads.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Publishing Records Asynchronously
+/// - - - - - - - - - - - - - - - - - - - - - -
+// In this example, we publish records to a 'ball::TestObserver' from a
+// publication thread, rather than from the threads that log the records.
+//
+// First, we create the inner observer, and a ring buffer observer, holding up
+// to 1024 records, that forwards the records it receives to it:
+//..
+//  bsl::shared_ptr<ball::TestObserver> innerObserver(
+//                                         new ball::TestObserver(&bsl::cout));
+//
+//  ball::RingBufferObserver observer(innerObserver, 1024);
+//  assert(1024 == observer.capacity());
+//..
+// Then, we start the publication thread:
+//..
+//  int rc = observer.startPublicationThread();
+//  assert(0 == rc);
+//..
+// Next, we publish a number of records:
+//..
+//  const ball::Context context(ball::Transmission::e_PASSTHROUGH, 0, 1);
+//
+//  bsl::shared_ptr<ball::Record> record;
+//  record.createInplace();
+//  record->fixedFields().setSeverity(ball::Severity::e_INFO);
+//
+//  for (int i = 0; i < 10; ++i) {
+//      observer.publish(record, context);
+//  }
+//..
+// Finally, we stop the publication thread, which publishes the records that
+// are in the ring buffer before returning, and verify that the records were
+// published to the inner observer:
+//..
+//  rc = observer.stopPublicationThread();
+//  assert(0 == rc);
+//
+//  assert(10 == innerObserver->numPublishedRecords());
+//  assert( 0 == observer.recordQueueLength());
+//..
+
+#include <balscm_version.h>
+
+#include <ball_context.h>
+#include <ball_observer.h>
+#include <ball_severity.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_condition.h>
+#include <bslmt_mutex.h>
+#include <bslmt_platform.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+#include <bsl_memory.h>
+
+namespace BloombergLP {
+namespace ball {
+
+class Record;
+
+                     // ==================================
+                     // struct RingBufferObserver_SlotData
+                     // ==================================
+
+struct RingBufferObserver_SlotData {
+    // PRIVATE STRUCT.  For use by the 'ball::RingBufferObserver'
+    // implementation only.  This 'struct' holds a log record, its associated
+    // context, and the sequence number identifying the state of the slot.
+
+    // PUBLIC DATA
+    bsls::AtomicInt64             d_sequence;  // '2 * n' if the slot is free
+                                               // for the 'n'th record, and
+                                               // '2 * n + 1' if it holds that
+                                               // record
+
+    bsl::shared_ptr<const Record> d_record;    // log record
+
+    Context                       d_context;   // context of log record
+};
+
+                       // ==============================
+                       // struct RingBufferObserver_Slot
+                       // ==============================
+
+struct RingBufferObserver_Slot : RingBufferObserver_SlotData {
+    // PRIVATE STRUCT.  For use by the 'ball::RingBufferObserver'
+    // implementation only.  This 'struct' pads a 'RingBufferObserver_SlotData'
+    // to a multiple of the cache line size.
+
+    // PUBLIC DATA
+    char d_pad[bslmt::Platform::e_CACHE_LINE_SIZE
+             - sizeof(RingBufferObserver_SlotData)
+                                   % bslmt::Platform::e_CACHE_LINE_SIZE];
+                                               // padding to the end of the
+                                               // cache line
+};
+
+                          // ========================
+                          // class RingBufferObserver
+                          // ========================
+
+class RingBufferObserver : public Observer {
+    // This class implements the 'Observer' protocol.  The 'publish' method of
+    // this class stores the log records it receives in a fixed-size, lock-free
+    // ring buffer, from which they are forwarded, asynchronously, to the
+    // observer supplied at construction by an independent publication thread.
+    // This class is thread-safe; different threads can operate on an object
+    // concurrently.
+
+    // PRIVATE TYPES
+    typedef RingBufferObserver_Slot Slot;
+
+    enum ThreadState {
+        // State of the publication thread, as captured by 'd_threadState'.
+
+        e_RUNNING,         // the publication thread is running
+
+        e_STOPPING,        // the publication thread stops once the ring
+                           // buffer is empty
+
+        e_SHUTTING_DOWN,   // the publication thread stops immediately
+
+        e_NOT_RUNNING      // the publication thread is not running
+    };
+
+    // DATA
+    bsls::AtomicInt64          d_nextWriteSequence;
+                                                  // sequence number of the
+                                                  // next record claimed by
+                                                  // 'publish'
+
+    char                       d_producerPad[bslmt::Platform::
+                                                           e_CACHE_LINE_SIZE];
+                                                  // padding separating the
+                                                  // data modified by
+                                                  // 'publish' from the rest
+
+    bsls::AtomicInt64          d_nextReadSequence;
+                                                  // sequence number of the
+                                                  // next record published
+                                                  // (modified only by the
+                                                  // publication thread, or
+                                                  // while it is not running)
+
+    bsls::AtomicInt            d_consumerWaiting; // 1 if the publication
+                                                  // thread is waiting for a
+                                                  // record, and 0 otherwise
+
+    bsls::AtomicInt            d_numProducersWaiting;
+                                                  // number of threads blocked
+                                                  // in 'publish' waiting for a
+                                                  // free slot
+
+    bsls::AtomicInt            d_numRecordsDropped;
+                                                  // number of records dropped
+                                                  // by 'publish'
+
+    bsls::AtomicInt            d_threadState;     // the publication thread
+                                                  // state, one of the values
+                                                  // of 'ThreadState'
+
+    Slot                      *d_slots_p;         // ring buffer, aligned to
+                                                  // a cache line
+
+    void                      *d_slotsBuffer_p;   // memory holding
+                                                  // 'd_slots_p' (owned)
+
+    int                        d_capacity;        // number of slots in
+                                                  // 'd_slots_p', a power of
+                                                  // two
+
+    Severity::Level            d_dropRecordsOnFullQueueThreshold;
+                                                  // records with severity
+                                                  // below this threshold are
+                                                  // dropped when the ring
+                                                  // buffer is full
+
+    bsl::shared_ptr<Observer>  d_observer;        // inner observer
+
+    bslmt::ThreadUtil::Handle  d_threadHandle;    // handle of the publication
+                                                  // thread
+
+    bslmt::Mutex               d_waitMutex;       // mutex used with the
+                                                  // conditions below
+
+    bslmt::Condition           d_consumerCondition;
+                                                  // signaled when a record is
+                                                  // added to an empty ring
+                                                  // buffer, or the publication
+                                                  // thread must stop
+
+    bslmt::Condition           d_producerCondition;
+                                                  // signaled when a slot is
+                                                  // freed while threads are
+                                                  // blocked in 'publish'
+
+    mutable bslmt::Mutex       d_mutex;           // serialize management of
+                                                  // the publication thread
+
+    bslma::Allocator          *d_allocator_p;     // memory allocator (held,
+                                                  // not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    RingBufferObserver(const RingBufferObserver&);
+    RingBufferObserver& operator=(const RingBufferObserver&);
+
+    // PRIVATE MANIPULATORS
+    bool claimSlot(bsls::Types::Int64 *sequence);
+        // Claim the slot for the next record, and load its sequence number
+        // into the specified 'sequence'.  Return 'true' on success, and
+        // 'false', with no effect, if the ring buffer is full.
+
+    void freeSlot(Slot *slot);
+        // Release the record held by the specified 'slot', which holds the
+        // record having the sequence number 'd_nextReadSequence', make 'slot'
+        // available to 'publish', and increment 'd_nextReadSequence'.  The
+        // behavior is undefined unless this method is invoked by the
+        // publication thread, or while no publication thread is running.
+
+    void publishThreadEntryPoint();
+        // Publish records from the ring buffer to the inner observer until
+        // signaled to stop.  Note that this function is the entry point for
+        // the publication thread.
+
+    void removeAll();
+        // Release the records that are in the ring buffer without publishing
+        // them.  The behavior is undefined unless no publication thread is
+        // running.
+
+    int startThread();
+        // Start a publication thread, unless one is already running.  Return
+        // 0 on success, and a non-zero value if there is an error creating the
+        // publication thread.  The behavior is undefined unless 'd_mutex' is
+        // locked by the calling thread.
+
+    int stopThread(ThreadState state);
+        // Signal the publication thread, if any, to stop by setting its state
+        // to the specified 'state', and join it.  Return 0 on success, and a
+        // non-zero value if there is an error joining the publication thread.
+        // The behavior is undefined unless 'd_mutex' is locked by the calling
+        // thread.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(RingBufferObserver,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    RingBufferObserver(const bsl::shared_ptr<Observer>&  observer,
+                       int                               capacity,
+                       bslma::Allocator                 *basicAllocator = 0);
+    RingBufferObserver(
+             const bsl::shared_ptr<Observer>&  observer,
+             int                               capacity,
+             Severity::Level                   dropRecordsOnFullQueueThreshold,
+             bslma::Allocator                 *basicAllocator = 0);
+        // Create a ring buffer observer that asynchronously forwards the
+        // records it receives to the specified 'observer', using a ring buffer
+        // holding up to the specified 'capacity' records, rounded up to a
+        // power of two.  Optionally specify a
+        // 'dropRecordsOnFullQueueThreshold' indicating the severity threshold
+        // below which records received when the ring buffer is full are
+        // dropped; records received whose severity is at least as severe as
+        // this threshold block the calling thread, if the ring buffer is full,
+        // until space is available.  If
+        // 'dropRecordsOnFullQueueThreshold' is not specified, all records
+        // received while the ring buffer is full are dropped (see {Full Ring
+        // Buffer}).  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  The publication thread is not started (see
+        // 'startPublicationThread').  The behavior is undefined unless
+        // 'observer' is not null, and '0 < capacity <= 2^30'.
+
+    virtual ~RingBufferObserver();
+        // Publish the records that are in the ring buffer if a publication
+        // thread is running, stop the publication thread (if any), and destroy
+        // this observer.
+
+    // MANIPULATORS
+    using Observer::publish;
+
+    virtual void publish(const bsl::shared_ptr<const Record>& record,
+                         const Context&                       context);
+        // Add the specified log 'record', having the specified publishing
+        // 'context', to the ring buffer of this observer, from which it will
+        // be forwarded to the inner observer by the publication thread.  If
+        // the ring buffer is full, drop 'record' if its severity is less
+        // severe than the 'dropRecordsOnFullQueueThreshold' of this observer,
+        // and otherwise block until space is available.  The behavior is
+        // undefined unless 'record' is not null.
+
+    virtual void releaseRecords();
+        // Discard any shared references to 'Record' objects that were supplied
+        // to the 'publish' method, and are held by this observer or by the
+        // inner observer, without publishing them.  If a publication thread is
+        // running, it is stopped before, and restarted after, the records are
+        // discarded.  Note that this operation should be called if resources
+        // underlying the previously provided shared pointers must be released.
+
+    int shutdownPublicationThread();
+        // Stop the publication thread, if any, without publishing the records
+        // that are in the ring buffer.  Return 0 on success, and a non-zero
+        // value if there is an error joining the publication thread.  Note
+        // that records received by 'publish' will continue to be added to the
+        // ring buffer after the publication thread is shut down.
+
+    int startPublicationThread();
+        // Start a publication thread to forward the records in the ring buffer
+        // to the inner observer.  If a publication thread is already running,
+        // this operation has no effect.  Return 0 on success, and a non-zero
+        // value if there is an error creating the publication thread.
+
+    int stopPublicationThread();
+        // Block until the records that were added to the ring buffer before
+        // this call have been published, then stop the publication thread.
+        // If there is no publication thread, this operation has no effect.
+        // Return 0 on success, and a non-zero value if there is an error
+        // joining the publication thread.  Note that records received by
+        // 'publish' will continue to be added to the ring buffer after the
+        // publication thread is stopped.
+
+    // ACCESSORS
+    int capacity() const;
+        // Return the maximum number of records held by the ring buffer of this
+        // observer.
+
+    Severity::Level dropRecordsOnFullQueueThreshold() const;
+        // Return the severity threshold below which records received by
+        // 'publish' while the ring buffer is full are dropped.
+
+    bool isPublicationThreadRunning() const;
+        // Return 'true' if a publication thread is running, and 'false'
+        // otherwise.
+
+    int numRecordsDropped() const;
+        // Return the number of records dropped by 'publish' because the ring
+        // buffer was full.
+
+    int recordQueueLength() const;
+        // Return the number of records that are in, or are being added to, the
+        // ring buffer of this observer.
+};
+
+// ============================================================================
+//                              INLINE DEFINITIONS
+// ============================================================================
+
+                          // ------------------------
+                          // class RingBufferObserver
+                          // ------------------------
+
+// ACCESSORS
+inline
+int RingBufferObserver::capacity() const
+{
+    return d_capacity;
+}
+
+inline
+Severity::Level RingBufferObserver::dropRecordsOnFullQueueThreshold() const
+{
+    return d_dropRecordsOnFullQueueThreshold;
+}
+
+inline
+int RingBufferObserver::numRecordsDropped() const
+{
+    return d_numRecordsDropped.loadRelaxed();
+}
+
+inline
+int RingBufferObserver::recordQueueLength() const
+{
+    // A record is counted from the time its sequence number is claimed, so
+    // the difference is never negative.
+
+    return static_cast<int>(d_nextWriteSequence.loadRelaxed()
+                          - d_nextReadSequence.loadRelaxed());
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1030 @@
+// ball_ringbufferobserver.t.cpp                                      -*-C++-*-
+#include <ball_ringbufferobserver.h>
+
+#include <ball_context.h>
+#include <ball_observer.h>
+#include <ball_record.h>
+#include <ball_recordattributes.h>
+#include <ball_severity.h>
+#include <ball_testobserver.h>
+
+#include <bdlf_bind.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadgroup.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_review.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_functional.h>
+#include <bsl_iostream.h>
+#include <bsl_memory.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is an observer that forwards the records it
+// receives, through a lock-free ring buffer, to an inner observer from a
+// publication thread.  We verify that records are forwarded in order, exactly
+// once, that the ring buffer drops or blocks according to the configured
+// severity threshold when it is full, and that records are forwarded
+// correctly when published concurrently from many threads.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] RingBufferObserver(observer, capacity, allocator);
+// [ 2] RingBufferObserver(observer, capacity, threshold, allocator);
+// [ 2] virtual ~RingBufferObserver();
+//
+// MANIPULATORS
+// [ 3] virtual void publish(const shared_ptr<const Record>&, Context&);
+// [ 5] virtual void releaseRecords();
+// [ 5] int shutdownPublicationThread();
+// [ 3] int startPublicationThread();
+// [ 3] int stopPublicationThread();
+//
+// ACCESSORS
+// [ 2] int capacity() const;
+// [ 2] Severity::Level dropRecordsOnFullQueueThreshold() const;
+// [ 3] bool isPublicationThreadRunning() const;
+// [ 4] int numRecordsDropped() const;
+// [ 3] int recordQueueLength() const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] CONCERN: FULL RING BUFFER
+// [ 6] CONCERN: CONCURRENT PUBLICATION
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE: 'publish'
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef ball::RingBufferObserver Obj;
+
+static bool verbose;
+static bool veryVerbose;
+static bool veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+//=============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+namespace {
+
+class RecordingObserver : public ball::Observer {
+    // This class provides an observer that records the line number of each
+    // record it receives, and counts the calls to 'releaseRecords'.
+
+    // DATA
+    bsl::vector<int>   d_lineNumbers;  // line numbers of published records
+    int                d_numReleases;  // number of calls to 'releaseRecords'
+    mutable bslmt::Mutex d_mutex;      // serialize access to the above
+
+  public:
+    // CREATORS
+    explicit RecordingObserver(bslma::Allocator *basicAllocator = 0)
+    : d_lineNumbers(basicAllocator)
+    , d_numReleases(0)
+    {
+    }
+
+    // MANIPULATORS
+    using ball::Observer::publish;
+
+    void publish(const bsl::shared_ptr<const ball::Record>& record,
+                 const ball::Context&)
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        d_lineNumbers.push_back(record->fixedFields().lineNumber());
+    }
+
+    void releaseRecords()
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        ++d_numReleases;
+    }
+
+    // ACCESSORS
+    bsl::vector<int> lineNumbers() const
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        return d_lineNumbers;
+    }
+
+    int numReleases() const
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        return d_numReleases;
+    }
+};
+
+class CountingObserver : public ball::Observer {
+    // This class provides an observer that counts the records it receives.
+
+    // DATA
+    bsls::AtomicInt64 d_count;  // number of published records
+
+  public:
+    // CREATORS
+    CountingObserver()
+    : d_count(0)
+    {
+    }
+
+    // MANIPULATORS
+    using ball::Observer::publish;
+
+    void publish(const bsl::shared_ptr<const ball::Record>&,
+                 const ball::Context&)
+    {
+        d_count.addRelaxed(1);
+    }
+
+    // ACCESSORS
+    bsls::Types::Int64 count() const
+    {
+        return d_count.loadRelaxed();
+    }
+};
+
+bsl::shared_ptr<ball::Record> createRecord(int                    lineNumber,
+                                           ball::Severity::Level  severity,
+                                           bslma::Allocator      *allocator)
+    // Return a newly created 'ball::Record' having the specified 'lineNumber'
+    // and 'severity', using the specified 'allocator' to supply memory.
+{
+    bsl::shared_ptr<ball::Record> record =
+                                bsl::allocate_shared<ball::Record>(allocator);
+
+    record->fixedFields().setLineNumber(lineNumber);
+    record->fixedFields().setSeverity(severity);
+
+    return record;
+}
+
+void publishRecords(Obj                   *observer,
+                    int                    producerId,
+                    int                    numRecords,
+                    ball::Severity::Level  severity,
+                    bslmt::Barrier        *barrier)
+    // Wait on the specified 'barrier', then publish, to the specified
+    // 'observer', the specified 'numRecords' records having the specified
+    // 'severity', whose line numbers encode the specified 'producerId' and
+    // the index of the record.
+{
+    bslma::Allocator *allocator = bslma::Default::globalAllocator();
+
+    bsl::vector<bsl::shared_ptr<ball::Record> > records(allocator);
+    for (int i = 0; i < numRecords; ++i) {
+        records.push_back(createRecord(producerId * 1000000 + i,
+                                       severity,
+                                       allocator));
+    }
+
+    const ball::Context context(ball::Transmission::e_PASSTHROUGH, 0, 1);
+
+    barrier->wait();
+    for (int i = 0; i < numRecords; ++i) {
+        observer->publish(records[i], context);
+    }
+}
+
+void publishOne(Obj                                   *observer,
+                const bsl::shared_ptr<ball::Record>&   record,
+                bsls::AtomicInt                       *done)
+    // Publish the specified 'record' to the specified 'observer', then set the
+    // specified 'done' flag.
+{
+    const ball::Context context(ball::Transmission::e_PASSTHROUGH, 0, 1);
+
+    observer->publish(record, context);
+    *done = 1;
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int test      = argc > 1 ? atoi(argv[1]) : 0;
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nUSAGE EXAMPLE"
+                          << "\n=============" << endl;
+
+///Example 1: Publishing Records Asynchronously
+/// - - - - - - - - - - - - - - - - - - - - - -
+// In this example, we publish records to a 'ball::TestObserver' from a
+// publication thread, rather than from the threads that log the records.
+//
+// First, we create the inner observer, and a ring buffer observer, holding up
+// to 1024 records, that forwards the records it receives to it:
+//..
+    bsl::shared_ptr<ball::TestObserver> innerObserver(
+                                           new ball::TestObserver(&bsl::cout));
+
+    ball::RingBufferObserver observer(innerObserver, 1024);
+    ASSERT(1024 == observer.capacity());
+//..
+// Then, we start the publication thread:
+//..
+    int rc = observer.startPublicationThread();
+    ASSERT(0 == rc);
+//..
+// Next, we publish a number of records:
+//..
+    const ball::Context context(ball::Transmission::e_PASSTHROUGH, 0, 1);
+
+    bsl::shared_ptr<ball::Record> record;
+    record.createInplace();
+    record->fixedFields().setSeverity(ball::Severity::e_INFO);
+
+    for (int i = 0; i < 10; ++i) {
+        observer.publish(record, context);
+    }
+//..
+// Finally, we stop the publication thread, which publishes the records that
+// are in the ring buffer before returning, and verify that the records were
+// published to the inner observer:
+//..
+    rc = observer.stopPublicationThread();
+    ASSERT(0 == rc);
+
+    ASSERT(10 == innerObserver->numPublishedRecords());
+    ASSERT( 0 == observer.recordQueueLength());
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCERN: CONCURRENT PUBLICATION
+        //
+        // Concerns:
+        //: 1 Records published concurrently from many threads are each
+        //:   forwarded exactly once.
+        //:
+        //: 2 The records published by each thread are forwarded in the order
+        //:   in which that thread published them.
+        //:
+        //: 3 Threads blocked on a full ring buffer are released as the
+        //:   publication thread frees slots.
+        //
+        // Plan:
+        //: 1 For a set of capacities, including capacities much smaller than
+        //:   the number of producers, create an observer that never drops
+        //:   records, and publish a number of records from each of several
+        //:   threads.  Verify that the inner observer received every record,
+        //:   and that the records of each thread are in order.  (C-1..3)
+        //
+        // Testing:
+        //   CONCERN: CONCURRENT PUBLICATION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nCONCERN: CONCURRENT PUBLICATION"
+                          << "\n===============================" << endl;
+
+        const int NUM_THREADS = 8;
+        const int NUM_RECORDS = 20000;
+
+        const int CAPACITIES[] = { 1, 2, 16, 1024 };
+        const int NUM_CAPACITIES = sizeof CAPACITIES / sizeof *CAPACITIES;
+
+        for (int ti = 0; ti < NUM_CAPACITIES; ++ti) {
+            const int CAPACITY = CAPACITIES[ti];
+
+            if (veryVerbose) { T_ P(CAPACITY) }
+
+            bsl::shared_ptr<RecordingObserver> inner =
+                                       bsl::make_shared<RecordingObserver>();
+
+            Obj mX(inner, CAPACITY, ball::Severity::e_TRACE);
+
+            ASSERT(0 == mX.startPublicationThread());
+
+            bslmt::Barrier     barrier(NUM_THREADS);
+            bslmt::ThreadGroup threads;
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                threads.addThread(bdlf::BindUtil::bind(
+                                                      &publishRecords,
+                                                      &mX,
+                                                      i,
+                                                      NUM_RECORDS,
+                                                      ball::Severity::e_DEBUG,
+                                                      &barrier));
+            }
+            threads.joinAll();
+
+            ASSERT(0 == mX.stopPublicationThread());
+
+            ASSERTV(CAPACITY, mX.numRecordsDropped(),
+                    0 == mX.numRecordsDropped());
+            ASSERTV(CAPACITY, mX.recordQueueLength(),
+                    0 == mX.recordQueueLength());
+
+            const bsl::vector<int> lineNumbers = inner->lineNumbers();
+
+            ASSERTV(CAPACITY, lineNumbers.size(),
+                    NUM_THREADS * NUM_RECORDS == lineNumbers.size());
+
+            bsl::vector<int> next(NUM_THREADS, 0);
+            for (bsl::size_t i = 0; i < lineNumbers.size(); ++i) {
+                const int producerId = lineNumbers[i] / 1000000;
+                const int index      = lineNumbers[i] % 1000000;
+
+                ASSERTV(CAPACITY, producerId, 0 <= producerId);
+                ASSERTV(CAPACITY, producerId, producerId < NUM_THREADS);
+
+                if (0 <= producerId && producerId < NUM_THREADS) {
+                    ASSERTV(CAPACITY, producerId, index, next[producerId],
+                            index == next[producerId]);
+                    next[producerId] = index + 1;
+                }
+            }
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'releaseRecords' AND 'shutdownPublicationThread'
+        //
+        // Concerns:
+        //: 1 'shutdownPublicationThread' stops the publication thread without
+        //:   publishing the records in the ring buffer.
+        //:
+        //: 2 'releaseRecords' releases the records in the ring buffer without
+        //:   publishing them, and calls 'releaseRecords' on the inner
+        //:   observer.
+        //:
+        //: 3 'releaseRecords' restarts the publication thread if, and only
+        //:   if, it was running.
+        //
+        // Plan:
+        //: 1 Publish records while the publication thread is not running,
+        //:   call 'releaseRecords', and verify that no reference to the
+        //:   records remains, that no record was published, and that the
+        //:   inner observer was asked to release its records.  Repeat with a
+        //:   running publication thread.  (C-2..3)
+        //:
+        //: 2 Call 'shutdownPublicationThread' and verify that the publication
+        //:   thread is not running.  (C-1)
+        //
+        // Testing:
+        //   virtual void releaseRecords();
+        //   int shutdownPublicationThread();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout
+              << "\nTESTING 'releaseRecords' AND 'shutdownPublicationThread'"
+              << "\n========================================================"
+              << endl;
+
+        bslma::TestAllocator ra("record", veryVeryVeryVerbose);
+
+        const ball::Context context(ball::Transmission::e_PASSTHROUGH, 0, 1);
+
+        bsl::shared_ptr<ball::Record> record =
+                                  createRecord(1, ball::Severity::e_INFO, &ra);
+
+        bsl::shared_ptr<RecordingObserver> inner =
+                                         bsl::make_shared<RecordingObserver>();
+
+        Obj mX(inner, 8);  const Obj& X = mX;
+
+        for (int i = 0; i < 5; ++i) {
+            mX.publish(record, context);
+        }
+        ASSERTV(record.use_count(), 6 == record.use_count());
+        ASSERTV(X.recordQueueLength(), 5 == X.recordQueueLength());
+
+        mX.releaseRecords();
+
+        ASSERTV(record.use_count(), 1 == record.use_count());
+        ASSERTV(X.recordQueueLength(), 0 == X.recordQueueLength());
+        ASSERT(1     == inner->numReleases());
+        ASSERT(0     == inner->lineNumbers().size());
+        ASSERT(false == X.isPublicationThreadRunning());
+
+        ASSERT(0 == mX.startPublicationThread());
+
+        mX.releaseRecords();
+
+        ASSERT(2    == inner->numReleases());
+        ASSERT(true == X.isPublicationThreadRunning());
+
+        ASSERT(0     == mX.shutdownPublicationThread());
+        ASSERT(false == X.isPublicationThreadRunning());
+        ASSERT(0     == mX.shutdownPublicationThread());
+
+        for (int i = 0; i < 3; ++i) {
+            mX.publish(record, context);
+        }
+        ASSERTV(X.recordQueueLength(), 3 == X.recordQueueLength());
+
+        ASSERT(0 == mX.startPublicationThread());
+        ASSERT(0 == mX.stopPublicationThread());
+
+        ASSERTV(inner->lineNumbers().size(),
+                3 == inner->lineNumbers().size());
+        ASSERTV(record.use_count(), 1 == record.use_count());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCERN: FULL RING BUFFER
+        //
+        // Concerns:
+        //: 1 By default, records published while the ring buffer is full are
+        //:   dropped, and counted by 'numRecordsDropped'.
+        //:
+        //: 2 Records less severe than the 'dropRecordsOnFullQueueThreshold'
+        //:   are dropped when the ring buffer is full.
+        //:
+        //: 3 'publish' blocks for records at least as severe as the
+        //:   threshold until a slot is freed by the publication thread.
+        //
+        // Plan:
+        //: 1 Fill an observer having the default threshold, with the
+        //:   publication thread stopped, and verify that further records are
+        //:   dropped.  (C-1)
+        //:
+        //: 2 Fill an observer having the 'e_WARN' threshold, and verify that
+        //:   'e_INFO' records are dropped.  Publish an 'e_ERROR' record from
+        //:   another thread, and verify that it blocks until the publication
+        //:   thread is started, and is then published after the records that
+        //:   filled the ring buffer.  (C-2..3)
+        //
+        // Testing:
+        //   int numRecordsDropped() const;
+        //   CONCERN: FULL RING BUFFER
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nCONCERN: FULL RING BUFFER"
+                          << "\n=========================" << endl;
+
+        bslma::TestAllocator ra("record", veryVeryVeryVerbose);
+
+        const ball::Context context(ball::Transmission::e_PASSTHROUGH, 0, 1);
+
+        if (verbose) cout << "\tTesting the default threshold." << endl;
+        {
+            bsl::shared_ptr<RecordingObserver> inner =
+                                         bsl::make_shared<RecordingObserver>();
+
+            Obj mX(inner, 4);  const Obj& X = mX;
+
+            for (int i = 0; i < 10; ++i) {
+                mX.publish(createRecord(i, ball::Severity::e_FATAL, &ra),
+                           context);
+            }
+            ASSERTV(X.recordQueueLength(), 4 == X.recordQueueLength());
+            ASSERTV(X.numRecordsDropped(), 6 == X.numRecordsDropped());
+
+            ASSERT(0 == mX.startPublicationThread());
+            ASSERT(0 == mX.stopPublicationThread());
+
+            const bsl::vector<int> lineNumbers = inner->lineNumbers();
+            ASSERTV(lineNumbers.size(), 4 == lineNumbers.size());
+            for (bsl::size_t i = 0; i < lineNumbers.size(); ++i) {
+                ASSERTV(i, lineNumbers[i], static_cast<int>(i) ==
+                                                               lineNumbers[i]);
+            }
+        }
+
+        if (verbose) cout << "\tTesting the 'e_WARN' threshold." << endl;
+        {
+            bsl::shared_ptr<RecordingObserver> inner =
+                                         bsl::make_shared<RecordingObserver>();
+
+            Obj mX(inner, 4, ball::Severity::e_WARN);  const Obj& X = mX;
+
+            ASSERT(ball::Severity::e_WARN ==
+                                          X.dropRecordsOnFullQueueThreshold());
+
+            for (int i = 0; i < 4; ++i) {
+                mX.publish(createRecord(i, ball::Severity::e_INFO, &ra),
+                           context);
+            }
+            mX.publish(createRecord(100, ball::Severity::e_INFO, &ra),
+                       context);
+            ASSERTV(X.numRecordsDropped(), 1 == X.numRecordsDropped());
+
+            bsls::AtomicInt           done(0);
+            bslmt::ThreadUtil::Handle handle;
+
+            ASSERT(0 == bslmt::ThreadUtil::createWithAllocator(
+                          &handle,
+                          bdlf::BindUtil::bind(
+                               &publishOne,
+                               &mX,
+                               createRecord(4, ball::Severity::e_ERROR, &ra),
+                               &done),
+                          &ra));
+
+            bslmt::ThreadUtil::microSleep(100000);
+
+            ASSERT(0 == done);
+            ASSERTV(X.numRecordsDropped(), 1 == X.numRecordsDropped());
+
+            ASSERT(0 == mX.startPublicationThread());
+            ASSERT(0 == bslmt::ThreadUtil::join(handle));
+            ASSERT(1 == done);
+            ASSERT(0 == mX.stopPublicationThread());
+
+            const bsl::vector<int> lineNumbers = inner->lineNumbers();
+            ASSERTV(lineNumbers.size(), 5 == lineNumbers.size());
+            for (bsl::size_t i = 0; i < lineNumbers.size(); ++i) {
+                ASSERTV(i, lineNumbers[i], static_cast<int>(i) ==
+                                                               lineNumbers[i]);
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'publish' AND PUBLICATION THREAD MANAGEMENT
+        //
+        // Concerns:
+        //: 1 Records published while the publication thread is not running
+        //:   are held in the ring buffer, and counted by 'recordQueueLength'.
+        //:
+        //: 2 The publication thread forwards the records to the inner
+        //:   observer, in the order in which they were published, including
+        //:   after the ring buffer wraps around.
+        //:
+        //: 3 'stopPublicationThread' publishes the records in the ring buffer
+        //:   before stopping the publication thread.
+        //:
+        //: 4 'startPublicationThread' and 'stopPublicationThread' have no
+        //:   effect if the thread is, respectively, running and not running.
+        //:
+        //: 5 The references to published records are released.
+        //:
+        //: 6 'publish' allocates no memory.
+        //:
+        //: 7 QoI: Asserted precondition violations are detected when
+        //:   enabled.
+        //
+        // Plan:
+        //: 1 Publish records, with the publication thread alternately
+        //:   stopped and running, and verify the records received by the
+        //:   inner observer, and the state of the observer.  (C-1..5)
+        //:
+        //: 2 Use a test allocator installed as the default allocator to
+        //:   verify that 'publish' allocates no memory.  (C-6)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments (using the 'BSLS_ASSERTTEST_*'
+        //:   macros).  (C-7)
+        //
+        // Testing:
+        //   virtual void publish(const shared_ptr<const Record>&, Context&);
+        //   int startPublicationThread();
+        //   int stopPublicationThread();
+        //   bool isPublicationThreadRunning() const;
+        //   int recordQueueLength() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout
+                  << "\nTESTING 'publish' AND PUBLICATION THREAD MANAGEMENT"
+                  << "\n==================================================="
+                  << endl;
+
+        bslma::TestAllocator ra("record", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        const ball::Context context(ball::Transmission::e_PASSTHROUGH, 0, 1);
+
+        bsl::vector<bsl::shared_ptr<ball::Record> > records(&ra);
+        for (int i = 0; i < 100; ++i) {
+            records.push_back(createRecord(i, ball::Severity::e_INFO, &ra));
+        }
+
+        bsl::shared_ptr<RecordingObserver> inner =
+                                         bsl::make_shared<RecordingObserver>();
+
+        // Records are never dropped, so that the records published while the
+        // publication thread starts are not lost if the ring buffer is full.
+
+        Obj mX(inner, 8, ball::Severity::e_TRACE, &oa);  const Obj& X = mX;
+
+        ASSERT(false == X.isPublicationThreadRunning());
+        ASSERT(0     == mX.stopPublicationThread());
+
+        {
+            bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+            bslma::DefaultAllocatorGuard dag(&da);
+
+            const bsls::Types::Int64 NUM_OA = oa.numAllocations();
+
+            for (int i = 0; i < 8; ++i) {
+                mX.publish(records[i], context);
+                ASSERTV(i, X.recordQueueLength(),
+                        i + 1 == X.recordQueueLength());
+            }
+
+            ASSERTV(da.numAllocations(), 0 == da.numAllocations());
+            ASSERTV(oa.numAllocations(), NUM_OA == oa.numAllocations());
+        }
+
+        ASSERT(0 == inner->lineNumbers().size());
+        ASSERTV(records[0].use_count(), 2 == records[0].use_count());
+
+        ASSERT(0    == mX.startPublicationThread());
+        ASSERT(true == X.isPublicationThreadRunning());
+        ASSERT(0    == mX.startPublicationThread());
+        ASSERT(true == X.isPublicationThreadRunning());
+
+        for (int i = 8; i < 100; ++i) {
+            mX.publish(records[i], context);
+        }
+
+        ASSERT(0     == mX.stopPublicationThread());
+        ASSERT(false == X.isPublicationThreadRunning());
+        ASSERTV(X.recordQueueLength(), 0 == X.recordQueueLength());
+
+        const bsl::vector<int> lineNumbers = inner->lineNumbers();
+        ASSERTV(lineNumbers.size(), 100 == lineNumbers.size());
+        for (bsl::size_t i = 0; i < lineNumbers.size(); ++i) {
+            ASSERTV(i, lineNumbers[i], static_cast<int>(i) == lineNumbers[i]);
+        }
+        for (bsl::size_t i = 0; i < records.size(); ++i) {
+            ASSERTV(i, records[i].use_count(), 1 == records[i].use_count());
+        }
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bsl::shared_ptr<const ball::Record> nullRecord;
+
+            ASSERT_FAIL(mX.publish(nullRecord, context));
+            ASSERT_PASS(mX.publish(records[0], context));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 The capacity supplied at construction is rounded up to a power of
+        //:   two.
+        //:
+        //: 2 The threshold is 'e_OFF' unless supplied at construction.
+        //:
+        //: 3 The ring buffer is allocated from the supplied allocator, and
+        //:   released on destruction.
+        //:
+        //: 4 The records in the ring buffer are released on destruction.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when
+        //:   enabled.
+        //
+        // Plan:
+        //: 1 Create observers using each constructor and a set of capacities,
+        //:   and verify their capacity, threshold, and memory use.  (C-1..3)
+        //:
+        //: 2 Destroy an observer holding records, and verify the use count of
+        //:   the records.  (C-4)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments (using the 'BSLS_ASSERTTEST_*'
+        //:   macros).  (C-5)
+        //
+        // Testing:
+        //   RingBufferObserver(observer, capacity, allocator);
+        //   RingBufferObserver(observer, capacity, threshold, allocator);
+        //   virtual ~RingBufferObserver();
+        //   int capacity() const;
+        //   Severity::Level dropRecordsOnFullQueueThreshold() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nCREATORS AND BASIC ACCESSORS"
+                          << "\n============================" << endl;
+
+        static const struct {
+            int d_line;
+            int d_capacity;
+            int d_expected;
+        } DATA[] = {
+            //LINE  CAPACITY     EXPECTED
+            //----  ----------   ----------
+            { L_,            1,          1 },
+            { L_,            2,          2 },
+            { L_,            3,          4 },
+            { L_,         1000,       1024 },
+            { L_,         1024,       1024 },
+            { L_,         1025,       2048 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        bsl::shared_ptr<ball::Observer> inner =
+                                          bsl::make_shared<CountingObserver>();
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE     = DATA[ti].d_line;
+            const int CAPACITY = DATA[ti].d_capacity;
+            const int EXPECTED = DATA[ti].d_expected;
+
+            bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+            bslma::TestAllocator         oa("object",  veryVeryVeryVerbose);
+            bslma::DefaultAllocatorGuard dag(&da);
+
+            {
+                Obj mX(inner, CAPACITY, &oa);  const Obj& X = mX;
+
+                ASSERTV(LINE, EXPECTED == X.capacity());
+                ASSERTV(LINE, ball::Severity::e_OFF ==
+                                          X.dropRecordsOnFullQueueThreshold());
+                ASSERTV(LINE, 0 == X.recordQueueLength());
+                ASSERTV(LINE, 0 == X.numRecordsDropped());
+                ASSERTV(LINE, false == X.isPublicationThreadRunning());
+
+                ASSERTV(LINE, 1 == oa.numBlocksInUse());
+                ASSERTV(LINE, 0 == da.numBlocksTotal());
+            }
+            ASSERTV(LINE, 0 == oa.numBlocksInUse());
+
+            {
+                Obj mX(inner, CAPACITY, ball::Severity::e_ERROR);
+                const Obj& X = mX;
+
+                ASSERTV(LINE, EXPECTED == X.capacity());
+                ASSERTV(LINE, ball::Severity::e_ERROR ==
+                                          X.dropRecordsOnFullQueueThreshold());
+                ASSERTV(LINE, 1 == da.numBlocksInUse());
+            }
+            ASSERTV(LINE, 0 == da.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\tTesting destruction with records." << endl;
+        {
+            bslma::TestAllocator ra("record", veryVeryVeryVerbose);
+
+            bsl::shared_ptr<ball::Record> record =
+                                  createRecord(1, ball::Severity::e_INFO, &ra);
+            {
+                Obj mX(inner, 4);
+
+                const ball::Context context(ball::Transmission::e_PASSTHROUGH,
+                                            0,
+                                            1);
+                mX.publish(record, context);
+                mX.publish(record, context);
+
+                ASSERTV(record.use_count(), 3 == record.use_count());
+            }
+            ASSERTV(record.use_count(), 1 == record.use_count());
+        }
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bsl::shared_ptr<ball::Observer> nullObserver;
+
+            ASSERT_FAIL(Obj(nullObserver, 1));
+            ASSERT_FAIL(Obj(inner,  0));
+            ASSERT_FAIL(Obj(inner, -1));
+            ASSERT_FAIL(Obj(inner, (1 << 30) + 1));
+            ASSERT_PASS(Obj(inner,  1));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an observer, publish records with and without a running
+        //:   publication thread, and verify that they are forwarded to the
+        //:   inner observer.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nBREATHING TEST"
+                          << "\n==============" << endl;
+
+        bsl::shared_ptr<CountingObserver> inner =
+                                          bsl::make_shared<CountingObserver>();
+
+        Obj mX(inner, 16);  const Obj& X = mX;
+
+        ASSERT(16 == X.capacity());
+
+        const ball::Context context(ball::Transmission::e_PASSTHROUGH, 0, 1);
+
+        bsl::shared_ptr<ball::Record> record;
+        record.createInplace();
+
+        mX.publish(record, context);
+        ASSERT(1 == X.recordQueueLength());
+        ASSERT(0 == inner->count());
+
+        ASSERT(0 == mX.startPublicationThread());
+
+        for (int i = 0; i < 1000; ++i) {
+            mX.publish(record, context);
+        }
+
+        ASSERT(0 == mX.stopPublicationThread());
+
+        ASSERTV(inner->count(), 1001 == inner->count());
+        ASSERT(0 == X.numRecordsDropped());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: 'publish'
+        //
+        // Concerns:
+        //: 1 The cost of 'publish' remains low when many threads publish
+        //:   concurrently.
+        //
+        // Plan:
+        //: 1 For an increasing number of threads, publish a number of records
+        //:   from each thread to an observer that never drops records, and
+        //:   report the average time per call to 'publish'.
+        //
+        // Testing:
+        //   PERFORMANCE: 'publish'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nPERFORMANCE: 'publish'"
+                          << "\n======================" << endl;
+
+        const int NUM_RECORDS = 1000000;
+
+        for (int numThreads = 1; numThreads <= 16; numThreads *= 2) {
+            bsl::shared_ptr<CountingObserver> inner =
+                                          bsl::make_shared<CountingObserver>();
+
+            Obj mX(inner, 65536, ball::Severity::e_TRACE);
+
+            ASSERT(0 == mX.startPublicationThread());
+
+            bslmt::Barrier     barrier(numThreads + 1);
+            bslmt::ThreadGroup threads;
+            for (int i = 0; i < numThreads; ++i) {
+                threads.addThread(bdlf::BindUtil::bind(
+                                                      &publishRecords,
+                                                      &mX,
+                                                      i,
+                                                      NUM_RECORDS / numThreads,
+                                                      ball::Severity::e_DEBUG,
+                                                      &barrier));
+            }
+
+            bsls::Stopwatch timer;
+            barrier.wait();
+            timer.start();
+            threads.joinAll();
+            timer.stop();
+
+            ASSERT(0 == mX.stopPublicationThread());
+
+            const int numPublished = NUM_RECORDS / numThreads * numThreads;
+
+            ASSERT(numPublished == inner->count());
+
+            cout << "threads: " << numThreads
+                 << "\tns/publish (per thread): "
+                 << timer.elapsedTime() * 1e9 * numThreads / numPublished
+                 << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
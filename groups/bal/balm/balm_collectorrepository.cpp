@@ -13,12 +13,16 @@
 BSLS_IDENT_RCSID(balm_collectorrepository_cpp,"$Id$ $CSID$")
 
 #include <balm_metricid.h>
+#include <balm_publicationtype.h>
 
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
 #include <bslmt_readlockguard.h>
 #include <bslmt_writelockguard.h>
 
 #include <bslma_allocator.h>
 #include <bslma_default.h>
+#include <bslma_managedptr.h>
 #include <bsls_assert.h>
 
 #include <bsl_algorithm.h>   // for 'bsl::min' and 'bsl::max'
@@ -27,6 +31,7 @@ BSLS_IDENT_RCSID(balm_collectorrepository_cpp,"$Id$ $CSID$")
 #include <bsl_string.h>
 #include <bsl_utility.h>
 
+#include <bsl_climits.h>           // for 'INT_MAX'
 #include <bsl_cstddef.h>           // for 'bsl::size_t'
 
 namespace BloombergLP {
@@ -43,6 +48,48 @@ void combine(balm::MetricRecord *record, const balm::MetricRecord& value)
     record->max()      = bsl::max(record->max(), value.max());
 }
 
+struct PercentileInfo {
+    // This 'struct' describes a percentile published for each histogram
+    // collector.
+
+    double      d_percent;  // percentile, in '[0.0 .. 100.0]'
+    const char *d_suffix;   // suffix appended to the name of the metric
+};
+
+const PercentileInfo k_PERCENTILES[] = {
+    { 50.0, ".p50"  },
+    { 90.0, ".p90"  },
+    { 99.0, ".p99"  },
+    { 99.9, ".p999" }
+};
+
+enum { k_NUM_PERCENTILES = sizeof k_PERCENTILES / sizeof *k_PERCENTILES };
+
+void appendPercentileRecords(bsl::vector<balm::MetricRecord>  *records,
+                             const balm::HistogramCollector&   histogram,
+                             const balm::MetricId             *percentileIds)
+    // Append to the specified 'records' a record for each of the
+    // 'k_NUM_PERCENTILES' percentiles of the specified 'histogram', identified
+    // by the corresponding element of the specified 'percentileIds'.  Each
+    // record holds the percentile as its minimum, maximum, and average.
+    // Append nothing if 'histogram' has no recorded values.
+{
+    const bsls::Types::Int64 count = histogram.count();
+    if (0 == count) {
+        return;                                                       // RETURN
+    }
+    const int recordCount = count > INT_MAX ? INT_MAX
+                                            : static_cast<int>(count);
+    for (int i = 0; i < k_NUM_PERCENTILES; ++i) {
+        const double value = histogram.percentile(k_PERCENTILES[i].d_percent);
+        records->push_back(balm::MetricRecord(percentileIds[i],
+                                              recordCount,
+                                              value * recordCount,
+                                              value,
+                                              value));
+    }
+}
+
 }  // close unnamed namespace
 
 namespace balm {
@@ -259,10 +306,13 @@ class CollectorRepository_MetricCollectors {
     // the 'Collector' and 'IntegerCollector' objects associated with a single
     // metric.  The 'collector' and 'intCollector' methods are provided to
     // access the individual containers for 'Collector' objects and
-    // 'IntegerCollector' objects, respectively.   The 'collectAndReset' method
-    // obtains the aggregate value of all the owned collectors and integer
-    // collectors, and then resets those collectors and integer collectors to
-    // their default state.
+    // 'IntegerCollector' objects, respectively.  A 'StripedCollector' and a
+    // 'StripedIntegerCollector' are created on demand by the
+    // 'defaultStripedCollector' and 'defaultStripedIntCollector' methods,
+    // and a 'HistogramCollector' by the 'defaultHistogramCollector' method.
+    // The 'collectAndReset' method obtains the aggregate value of all the
+    // owned collectors, and the percentiles of the histogram collector, and
+    // then resets those collectors to their default state.
 
     // PRIVATE TYPES
     typedef CollectorRepository_Collectors<Collector>
@@ -271,8 +321,42 @@ class CollectorRepository_MetricCollectors {
                                                         IntCollectors;
 
     // DATA
-    Collectors    d_collectors;     // collector objects
-    IntCollectors d_intCollectors;  // integer collector objects
+    Collectors                                  d_collectors;
+                                              // collector objects
+
+    IntCollectors                               d_intCollectors;
+                                              // integer collector objects
+
+    bslma::ManagedPtr<StripedCollector>         d_stripedCollector_mp;
+                                              // striped collector, or 0 if
+                                              // not yet created
+
+    bslma::ManagedPtr<StripedIntegerCollector>  d_stripedIntCollector_mp;
+                                              // striped integer collector, or
+                                              // 0 if not yet created
+
+    bslma::ManagedPtr<HistogramCollector>       d_histogramCollector_mp;
+                                              // histogram collector, or 0 if
+                                              // not yet created
+
+    bslma::ManagedPtr<HistogramCollector>       d_histogramSnapshot_mp;
+                                              // collector into which the
+                                              // values of the histogram
+                                              // collector are moved by
+                                              // 'collectAndReset', or 0 if
+                                              // not yet created
+
+    bslmt::Mutex                                d_snapshotMutex;
+                                              // serialize use of
+                                              // 'd_histogramSnapshot_mp'
+
+    MetricId                                    d_percentileIds[
+                                                            k_NUM_PERCENTILES];
+                                              // ids of the percentiles of the
+                                              // histogram collector
+
+    bslma::Allocator                           *d_allocator_p;
+                                              // allocator (held, not owned)
 
     // NOT IMPLEMENTED
     CollectorRepository_MetricCollectors(
@@ -306,21 +390,38 @@ class CollectorRepository_MetricCollectors {
         // Return a reference to the modifiable container of
         // 'IntegerCollector' objects.
 
-    void collectAndReset(MetricRecord *record);
-        // Load into the specified 'record' the aggregate value of all the
-        // records collected by the collectors owned by this object; then
+    StripedCollector *defaultStripedCollector();
+        // Return the address of the striped collector for the metric of this
+        // object, creating it if it does not already exist.
+
+    StripedIntegerCollector *defaultStripedIntCollector();
+        // Return the address of the striped integer collector for the metric
+        // of this object, creating it if it does not already exist.
+
+    HistogramCollector *defaultHistogramCollector(
+                                            const MetricId *percentileIds);
+        // Return the address of the histogram collector for the metric of
+        // this object, creating it if it does not already exist, in which
+        // case the percentiles of the histogram are published using the
+        // 'k_NUM_PERCENTILES' ids in the specified 'percentileIds' array.
+
+    void collectAndReset(bsl::vector<MetricRecord> *records);
+        // Append to the specified 'records' the aggregate value of all the
+        // records collected by the collectors owned by this object, followed
+        // by the percentile records of the histogram collector (if any); then
         // reset those collectors to their default values.  Note that all
         // collectors within this object record values for the same metric id,
         // so they can be aggregated into a single record.
 
-    void collect(MetricRecord *record);
-        // Load into the specified 'record' the aggregate value of all the
-        // records collected by the collectors owned by this object.  Note
-        // that all collectors within this object record values for the same
-        // metric id, so they can be aggregated into a single record.  Also
-        // note that because this operation does not reset the collectors,
-        // subsequent 'collect' invocations will effectively re-collect the
-        // current values.
+    void collect(bsl::vector<MetricRecord> *records);
+        // Append to the specified 'records' the aggregate value of all the
+        // records collected by the collectors owned by this object, followed
+        // by the percentile records of the histogram collector (if any).
+        // Note that all collectors within this object record values for the
+        // same metric id, so they can be aggregated into a single record.
+        // Also note that because this operation does not reset the
+        // collectors, subsequent 'collect' invocations will effectively
+        // re-collect the current values.
 
     // ACCESSORS
     const CollectorRepository_Collectors<Collector>& collectors() const;
@@ -332,6 +433,18 @@ class CollectorRepository_MetricCollectors {
         // Return a reference to the non-modifiable container of
         // 'IntegerCollector' objects.
 
+    StripedCollector *stripedCollector() const;
+        // Return the address of the striped collector for the metric of this
+        // object, or 0 if it has not been created.
+
+    StripedIntegerCollector *stripedIntCollector() const;
+        // Return the address of the striped integer collector for the metric
+        // of this object, or 0 if it has not been created.
+
+    HistogramCollector *histogramCollector() const;
+        // Return the address of the histogram collector for the metric of
+        // this object, or 0 if it has not been created.
+
     const MetricId& metricId() const;
         // Return a reference to the non-modifiable 'MetricId' object
         // identifying the metric for which the collectors in this container
@@ -349,6 +462,12 @@ CollectorRepository_MetricCollectors(const MetricId&   id,
                                      bslma::Allocator *basicAllocator)
 : d_collectors(id, basicAllocator)
 , d_intCollectors(id, basicAllocator)
+, d_stripedCollector_mp()
+, d_stripedIntCollector_mp()
+, d_histogramCollector_mp()
+, d_histogramSnapshot_mp()
+, d_snapshotMutex()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
 }
 
@@ -373,21 +492,108 @@ CollectorRepository_MetricCollectors::intCollectors()
     return d_intCollectors;
 }
 
+StripedCollector *
+CollectorRepository_MetricCollectors::defaultStripedCollector()
+{
+    if (!d_stripedCollector_mp) {
+        d_stripedCollector_mp.load(
+                        new (*d_allocator_p) StripedCollector(metricId()),
+                        d_allocator_p);
+    }
+    return d_stripedCollector_mp.get();
+}
+
+StripedIntegerCollector *
+CollectorRepository_MetricCollectors::defaultStripedIntCollector()
+{
+    if (!d_stripedIntCollector_mp) {
+        d_stripedIntCollector_mp.load(
+                   new (*d_allocator_p) StripedIntegerCollector(metricId()),
+                   d_allocator_p);
+    }
+    return d_stripedIntCollector_mp.get();
+}
+
+HistogramCollector *
+CollectorRepository_MetricCollectors::defaultHistogramCollector(
+                                                const MetricId *percentileIds)
+{
+    if (!d_histogramCollector_mp) {
+        for (int i = 0; i < k_NUM_PERCENTILES; ++i) {
+            d_percentileIds[i] = percentileIds[i];
+        }
+        d_histogramSnapshot_mp.load(
+                        new (*d_allocator_p) HistogramCollector(metricId()),
+                        d_allocator_p);
+        d_histogramCollector_mp.load(
+                        new (*d_allocator_p) HistogramCollector(metricId()),
+                        d_allocator_p);
+    }
+    return d_histogramCollector_mp.get();
+}
+
 void CollectorRepository_MetricCollectors::collectAndReset(
-                                                          MetricRecord *record)
+                                            bsl::vector<MetricRecord> *records)
 {
-    d_collectors.collectAndReset(record);
+    MetricRecord record;
+    d_collectors.collectAndReset(&record);
     MetricRecord tempRecord;
     d_intCollectors.collectAndReset(&tempRecord);
-    combine(record, tempRecord);
+    combine(&record, tempRecord);
+    if (d_stripedCollector_mp) {
+        d_stripedCollector_mp->loadAndReset(&tempRecord);
+        combine(&record, tempRecord);
+    }
+    if (d_stripedIntCollector_mp) {
+        d_stripedIntCollector_mp->loadAndReset(&tempRecord);
+        combine(&record, tempRecord);
+    }
+    if (!d_histogramCollector_mp) {
+        records->push_back(record);
+        return;                                                       // RETURN
+    }
+
+    // Move the recorded values into the snapshot (allocated along with the
+    // histogram collector, so that collection does not allocate), so that
+    // the count and the percentiles are computed from the same values.
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_snapshotMutex);
+
+    HistogramCollector *snapshot = d_histogramSnapshot_mp.get();
+    snapshot->reset();
+    snapshot->mergeAndReset(d_histogramCollector_mp.get());
+    snapshot->load(&tempRecord);
+    combine(&record, tempRecord);
+    records->push_back(record);
+    appendPercentileRecords(records, *snapshot, d_percentileIds);
 }
 
-void CollectorRepository_MetricCollectors::collect(MetricRecord *record)
+void CollectorRepository_MetricCollectors::collect(
+                                            bsl::vector<MetricRecord> *records)
 {
-    d_collectors.collect(record);
+    MetricRecord record;
+    d_collectors.collect(&record);
     MetricRecord tempRecord;
     d_intCollectors.collect(&tempRecord);
-    combine(record, tempRecord);
+    combine(&record, tempRecord);
+    if (d_stripedCollector_mp) {
+        d_stripedCollector_mp->load(&tempRecord);
+        combine(&record, tempRecord);
+    }
+    if (d_stripedIntCollector_mp) {
+        d_stripedIntCollector_mp->load(&tempRecord);
+        combine(&record, tempRecord);
+    }
+    if (d_histogramCollector_mp) {
+        d_histogramCollector_mp->load(&tempRecord);
+        combine(&record, tempRecord);
+    }
+    records->push_back(record);
+    if (d_histogramCollector_mp) {
+        appendPercentileRecords(records,
+                                *d_histogramCollector_mp,
+                                d_percentileIds);
+    }
 }
 
 // ACCESSORS
@@ -405,6 +611,27 @@ CollectorRepository_MetricCollectors::intCollectors() const
     return d_intCollectors;
 }
 
+inline
+StripedCollector *
+CollectorRepository_MetricCollectors::stripedCollector() const
+{
+    return d_stripedCollector_mp.get();
+}
+
+inline
+StripedIntegerCollector *
+CollectorRepository_MetricCollectors::stripedIntCollector() const
+{
+    return d_stripedIntCollector_mp.get();
+}
+
+inline
+HistogramCollector *
+CollectorRepository_MetricCollectors::histogramCollector() const
+{
+    return d_histogramCollector_mp.get();
+}
+
 inline
 const MetricId&
 CollectorRepository_MetricCollectors::metricId() const
@@ -463,9 +690,7 @@ void CollectorRepository::collectAndReset(bsl::vector<MetricRecord> *records,
         // Each 'MetricCollectors' object (in the 'd_categories' map) contains
         // the collectors for a single metric.
         for (; metricIt != metricCollectors.end(); ++metricIt) {
-            MetricRecord record;
-            (*metricIt)->collectAndReset(&record);
-            records->push_back(record);
+            (*metricIt)->collectAndReset(records);
         }
     }
 }
@@ -487,9 +712,7 @@ void CollectorRepository::collect(bsl::vector<MetricRecord> *records,
         // Each 'MetricCollectors' object (in the 'd_categories' map) contains
         // the collectors for a single metric.
         for (; metricIt != metricCollectors.end(); ++metricIt) {
-            MetricRecord record;
-            (*metricIt)->collect(&record);
-            records->push_back(record);
+            (*metricIt)->collect(records);
         }
     }
 }
@@ -531,6 +754,80 @@ IntegerCollector *CollectorRepository::getDefaultIntegerCollector(
     return getMetricCollectors(metricId).intCollectors().defaultCollector();
 }
 
+StripedCollector *CollectorRepository::getDefaultStripedCollector(
+                                                      const MetricId& metricId)
+{
+    // First, obtain a read-lock, and test if the striped collector for
+    // 'metricId' already exists.
+    {
+        bslmt::ReadLockGuard<bslmt::RWMutex> guard(&d_rwMutex);
+        Collectors::iterator it = d_collectors.find(metricId);
+        if (it != d_collectors.end() && it->second->stripedCollector()) {
+            return it->second->stripedCollector();                    // RETURN
+        }
+    }
+
+    // Use 'getMetricCollectors' to create the striped collector (if one has
+    // not been created since the read-lock was released).
+    bslmt::WriteLockGuard<bslmt::RWMutex> guard(&d_rwMutex);
+    return getMetricCollectors(metricId).defaultStripedCollector();
+}
+
+StripedIntegerCollector *
+CollectorRepository::getDefaultStripedIntegerCollector(
+                                                      const MetricId& metricId)
+{
+    // First, obtain a read-lock, and test if the striped integer collector
+    // for 'metricId' already exists.
+    {
+        bslmt::ReadLockGuard<bslmt::RWMutex> guard(&d_rwMutex);
+        Collectors::iterator it = d_collectors.find(metricId);
+        if (it != d_collectors.end() && it->second->stripedIntCollector()) {
+            return it->second->stripedIntCollector();                 // RETURN
+        }
+    }
+
+    // Use 'getMetricCollectors' to create the striped integer collector (if
+    // one has not been created since the read-lock was released).
+    bslmt::WriteLockGuard<bslmt::RWMutex> guard(&d_rwMutex);
+    return getMetricCollectors(metricId).defaultStripedIntCollector();
+}
+
+HistogramCollector *CollectorRepository::getDefaultHistogramCollector(
+                                                      const MetricId& metricId)
+{
+    // First, obtain a read-lock, and test if the histogram collector for
+    // 'metricId' already exists.
+    {
+        bslmt::ReadLockGuard<bslmt::RWMutex> guard(&d_rwMutex);
+        Collectors::iterator it = d_collectors.find(metricId);
+        if (it != d_collectors.end() && it->second->histogramCollector()) {
+            return it->second->histogramCollector();                  // RETURN
+        }
+    }
+
+    // Register the metrics for the percentiles of the histogram before
+    // acquiring the write lock, as the registry is independently locked.
+
+    BSLS_ASSERT(metricId.isValid());
+
+    MetricId percentileIds[k_NUM_PERCENTILES];
+    for (int i = 0; i < k_NUM_PERCENTILES; ++i) {
+        bsl::string name(metricId.metricName(), d_allocator_p);
+        name += k_PERCENTILES[i].d_suffix;
+        percentileIds[i] = d_registry_p->getId(metricId.categoryName(),
+                                               name.c_str());
+        d_registry_p->setPreferredPublicationType(percentileIds[i],
+                                                  PublicationType::e_AVG);
+    }
+
+    // Use 'getMetricCollectors' to create the histogram collector (if one has
+    // not been created since the read-lock was released).
+    bslmt::WriteLockGuard<bslmt::RWMutex> guard(&d_rwMutex);
+    return getMetricCollectors(metricId).defaultHistogramCollector(
+                                                                percentileIds);
+}
+
 bsl::shared_ptr<Collector> CollectorRepository::addCollector(
                                                       const MetricId& metricId)
 {
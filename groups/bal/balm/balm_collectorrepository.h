@@ -18,7 +18,8 @@ BSLS_IDENT("$Id: $")
 //@CLASSES:
 //   balm::CollectorRepository: a repository for collectors
 //
-//@SEE_ALSO: balm_collector, balm_integercollector, balm_metricsmanager
+//@SEE_ALSO: balm_collector, balm_integercollector, balm_stripedcollector,
+//           balm_histogramcollector, balm_metricsmanager
 //
 //@DESCRIPTION: This component defines a class, 'balm::CollectorRepository',
 // that serves as a repository for 'balm::Collector' and
@@ -34,10 +35,36 @@ BSLS_IDENT("$Id: $")
 // can safely collect values from multiple threads, however, the collector does
 // use a mutex: Applications anticipating high contention for that lock can use
 // 'addCollector' (and 'addIntegerCollector') to obtain multiple collectors and
-// thereby reduce contention.  Finally, the 'collectAndReset' operation
+// thereby reduce contention, or use 'getDefaultStripedCollector' (and
+// 'getDefaultStripedIntegerCollector') to obtain a collector that accumulates
+// values into per-thread stripes without a mutex (see
+// 'balm_stripedcollector').  Striped collectors are created only on demand,
+// and their values are combined with those of the other collectors for the
+// same metric.  Finally, the 'collectAndReset' operation
 // collects and returns metric records from each of the collectors in the
 // repository.
 //
+///Histogram Collectors
+///--------------------
+// The 'getDefaultHistogramCollector' operation returns a
+// 'balm::HistogramCollector' recording the distribution of the values of a
+// metric (see 'balm_histogramcollector').  The count, total, minimum, and
+// maximum of the values recorded by a histogram collector are combined with
+// those of the other collectors for the same metric.  In addition, the first
+// time a histogram collector is requested for a metric named 'NAME', the
+// metrics 'NAME.p50', 'NAME.p90', 'NAME.p99', and 'NAME.p999' are registered
+// in the same category, with a preferred publication type of
+// 'balm::PublicationType::e_AVG', and each collection produces a record for
+// each of them.  Each such record holds the corresponding percentile ('p'),
+// as its minimum, maximum, and average, and the count of values recorded by
+// the histogram (i.e., its total is 'p * count').  No percentile record is
+// produced for an interval in which no value was recorded.  For example, a
+// histogram of latencies named 'RequestLatency' is published as the five
+// metrics 'RequestLatency', 'RequestLatency.p50', 'RequestLatency.p90',
+// 'RequestLatency.p99', and 'RequestLatency.p999', so that percentiles are
+// published by any 'balm::Publisher' in the same publication cycle as the
+// other metrics.
+//
 ///Alternative Systems for Telemetry
 ///---------------------------------
 // Bloomberg software may alternatively use the GUTS telemetry API, which is
@@ -111,8 +138,10 @@ BSLS_IDENT("$Id: $")
 #include <balm_collector.h>
 #include <balm_integercollector.h>
 #include <balm_metricid.h>
+#include <balm_histogramcollector.h>
 #include <balm_metricrecord.h>
 #include <balm_metricregistry.h>
+#include <balm_stripedcollector.h>
 
 #include <bslmt_rwmutex.h>
 
@@ -208,16 +237,19 @@ class CollectorRepository {
                          const Category            *category);
         // Append to the specified 'records' the collected metric record
         // values from the collectors in this repository belonging to the
-        // specified 'category'; then reset those collectors to their default
-        // values.
+        // specified 'category', including the percentile records of the
+        // histogram collectors (see {Histogram Collectors}); then reset those
+        // collectors to their default values.
 
     void collect(bsl::vector<MetricRecord> *records,
                  const Category            *category);
         // Append to the specified 'records' the collected metric record
         // values from the collectors in this repository belonging to the
-        // specified 'category'.  Note that this operation does not reset the
-        // managed collectors, so subsequent collection operations will
-        // effectively re-collect the current values.
+        // specified 'category', including the percentile records of the
+        // histogram collectors (see {Histogram Collectors}).  Note that this
+        // operation does not reset the managed collectors, so subsequent
+        // collection operations will effectively re-collect the current
+        // values.
 
     Collector *getDefaultCollector(const char *category,
                                    const char *metricName);
@@ -261,6 +293,73 @@ class CollectorRepository {
         // repository, create one, add it to the repository, and return its
         // address.
 
+    StripedCollector *getDefaultStripedCollector(const char *category,
+                                                 const char *metricName);
+        // Return the address of the modifiable striped collector identified
+        // by the specified null-terminated strings 'category' and
+        // 'metricName'.  If a striped collector for the identified metric
+        // does not already exist in the repository, create one, add it to the
+        // repository, and return its address.  In addition, if the identified
+        // metric has not already been registered, add the identified metric
+        // to the 'metricRegistry' supplied at construction.  Note that this
+        // operation is logically equivalent to:
+        //..
+        //  getDefaultStripedCollector(registry().getId(category, metricName))
+        //..
+
+    StripedCollector *getDefaultStripedCollector(const MetricId& metricId);
+        // Return the address of the modifiable striped collector identified
+        // by the specified 'metricId'.  If a striped collector for the
+        // identified metric does not already exist in the repository, create
+        // one, add it to the repository, and return its address.
+
+    StripedIntegerCollector *getDefaultStripedIntegerCollector(
+                                                       const char *category,
+                                                       const char *metricName);
+        // Return the address of the modifiable striped integer collector
+        // identified by the specified null-terminated strings 'category' and
+        // 'metricName'.  If a striped integer collector for the identified
+        // metric does not already exist in the repository, create one, add it
+        // to the repository, and return its address.  In addition, if the
+        // identified metric has not already been registered, add the
+        // identified metric to the 'metricRegistry' supplied at construction.
+        // Note that this operation is logically equivalent to:
+        //..
+        //  getDefaultStripedIntegerCollector(
+        //                            registry().getId(category, metricName))
+        //..
+
+    StripedIntegerCollector *getDefaultStripedIntegerCollector(
+                                                     const MetricId& metricId);
+        // Return the address of the modifiable striped integer collector
+        // identified by the specified 'metricId'.  If a striped integer
+        // collector for the identified metric does not already exist in the
+        // repository, create one, add it to the repository, and return its
+        // address.
+
+    HistogramCollector *getDefaultHistogramCollector(const char *category,
+                                                     const char *metricName);
+        // Return the address of the modifiable histogram collector identified
+        // by the specified null-terminated strings 'category' and
+        // 'metricName'.  If a histogram collector for the identified metric
+        // does not already exist in the repository, create one, add it to the
+        // repository, and return its address.  In addition, if the identified
+        // metric has not already been registered, add the identified metric
+        // to the 'metricRegistry' supplied at construction.  Note that this
+        // operation is logically equivalent to:
+        //..
+        //  getDefaultHistogramCollector(
+        //                            registry().getId(category, metricName))
+        //..
+
+    HistogramCollector *getDefaultHistogramCollector(
+                                                     const MetricId& metricId);
+        // Return the address of the modifiable histogram collector identified
+        // by the specified 'metricId'.  If a histogram collector for the
+        // identified metric does not already exist in the repository, create
+        // one, register the metrics for its percentiles (see {Histogram
+        // Collectors}), add it to the repository, and return its address.
+
     bsl::shared_ptr<Collector> addCollector(const char *category,
                                             const char *metricName);
         // Return a shared pointer to a newly-created modifiable collector
@@ -366,6 +465,33 @@ IntegerCollector *CollectorRepository::getDefaultIntegerCollector(
                                                           metricName));
 }
 
+inline
+StripedCollector *CollectorRepository::getDefaultStripedCollector(
+                                                        const char *category,
+                                                        const char *metricName)
+{
+    return getDefaultStripedCollector(d_registry_p->getId(category,
+                                                          metricName));
+}
+
+inline
+StripedIntegerCollector *
+CollectorRepository::getDefaultStripedIntegerCollector(const char *category,
+                                                       const char *metricName)
+{
+    return getDefaultStripedIntegerCollector(d_registry_p->getId(category,
+                                                                 metricName));
+}
+
+inline
+HistogramCollector *CollectorRepository::getDefaultHistogramCollector(
+                                                        const char *category,
+                                                        const char *metricName)
+{
+    return getDefaultHistogramCollector(d_registry_p->getId(category,
+                                                            metricName));
+}
+
 inline
 bsl::shared_ptr<Collector> CollectorRepository::addCollector(
                                                         const char *category,
@@ -0,0 +1,298 @@
+// balm_histogramcollector.cpp                                        -*-C++-*-
+#include <balm_histogramcollector.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balm_histogramcollector_cpp,"$Id$ $CSID$")
+
+#include <bdlb_bitutil.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_climits.h>
+#include <bsl_cmath.h>
+#include <bsl_cstdint.h>
+
+///Implementation Notes
+///--------------------
+// For a value 'v' of at least '2 * k_NUM_SUB_BUCKETS', let 'm' be the index
+// of the most significant set bit of 'v'.  The 'k_SUB_BUCKET_BITS + 1' most
+// significant bits of 'v', 'v >> (m - k_SUB_BUCKET_BITS)', lie in
+// '[k_NUM_SUB_BUCKETS .. 2 * k_NUM_SUB_BUCKETS - 1]', and identify one of the
+// 'k_NUM_SUB_BUCKETS' buckets of the range '[2^m .. 2^(m+1) - 1]'.  Smaller
+// values are recorded exactly, each in the bucket whose index is the value.
+//
+// The minimum and maximum are held as 64-bit integers initialized to
+// 'LLONG_MAX' and 'LLONG_MIN' respectively, and are converted to the default
+// values of 'balm::MetricRecord' if no value has been recorded.
+
+namespace BloombergLP {
+
+namespace {
+
+typedef bsls::Types::Int64 Int64;
+
+const Int64 k_DEFAULT_MIN = LLONG_MAX;
+const Int64 k_DEFAULT_MAX = LLONG_MIN;
+
+void updateMin(bsls::AtomicInt64 *min, Int64 value)
+    // Set the specified 'min' to the specified 'value' if 'value' is less
+    // than 'min'.
+{
+    Int64 current = min->loadRelaxed();
+    while (value < current) {
+        const Int64 previous = min->testAndSwapAcqRel(current, value);
+        if (previous == current) {
+            return;                                                   // RETURN
+        }
+        current = previous;
+    }
+}
+
+void updateMax(bsls::AtomicInt64 *max, Int64 value)
+    // Set the specified 'max' to the specified 'value' if 'value' is greater
+    // than 'max'.
+{
+    Int64 current = max->loadRelaxed();
+    while (value > current) {
+        const Int64 previous = max->testAndSwapAcqRel(current, value);
+        if (previous == current) {
+            return;                                                   // RETURN
+        }
+        current = previous;
+    }
+}
+
+void loadRecord(balm::MetricRecord   *record,
+                const balm::MetricId&  metricId,
+                Int64                  count,
+                Int64                  total,
+                Int64                  min,
+                Int64                  max)
+    // Load into the specified 'record' the specified 'metricId', 'count',
+    // 'total', 'min', and 'max', converting an unset 'min' and 'max' to the
+    // defaults of 'balm::MetricRecord', and bounding 'count' to the range of
+    // 'int'.
+{
+    record->metricId() = metricId;
+    record->count()    = count > INT_MAX ? INT_MAX : static_cast<int>(count);
+    record->total()    = static_cast<double>(total);
+    record->min()      = k_DEFAULT_MIN == min
+                         ? balm::MetricRecord::k_DEFAULT_MIN
+                         : static_cast<double>(min);
+    record->max()      = k_DEFAULT_MAX == max
+                         ? balm::MetricRecord::k_DEFAULT_MAX
+                         : static_cast<double>(max);
+}
+
+}  // close unnamed namespace
+
+namespace balm {
+
+                          // ------------------------
+                          // class HistogramCollector
+                          // ------------------------
+
+// CLASS METHODS
+int HistogramCollector::bucketIndex(bsls::Types::Int64 value)
+{
+    if (value < 2 * k_NUM_SUB_BUCKETS) {
+        return value < 0 ? 0 : static_cast<int>(value);               // RETURN
+    }
+
+    const bsl::uint64_t bits  = static_cast<bsl::uint64_t>(value);
+    const int           msb   = 63 - bdlb::BitUtil::numLeadingUnsetBits(bits);
+    const int           shift = msb - k_SUB_BUCKET_BITS;
+    const int           top   = static_cast<int>(value >> shift);
+
+    return 2 * k_NUM_SUB_BUCKETS
+         + (shift - 1) * k_NUM_SUB_BUCKETS
+         + (top - k_NUM_SUB_BUCKETS);
+}
+
+bsls::Types::Int64 HistogramCollector::bucketLowerBound(int index)
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index < k_NUM_BUCKETS);
+
+    if (index < 2 * k_NUM_SUB_BUCKETS) {
+        return index;                                                 // RETURN
+    }
+
+    const int offset = index - 2 * k_NUM_SUB_BUCKETS;
+    const int shift  = offset / k_NUM_SUB_BUCKETS + 1;
+    const int top    = offset % k_NUM_SUB_BUCKETS + k_NUM_SUB_BUCKETS;
+
+    return static_cast<Int64>(top) << shift;
+}
+
+bsls::Types::Int64 HistogramCollector::bucketWidth(int index)
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index < k_NUM_BUCKETS);
+
+    if (index < 2 * k_NUM_SUB_BUCKETS) {
+        return 1;                                                     // RETURN
+    }
+
+    const int shift = (index - 2 * k_NUM_SUB_BUCKETS) / k_NUM_SUB_BUCKETS + 1;
+    return static_cast<Int64>(1) << shift;
+}
+
+// CREATORS
+HistogramCollector::HistogramCollector(const MetricId& metricId)
+: d_metricId(metricId)
+, d_count(0)
+, d_total(0)
+, d_min(k_DEFAULT_MIN)
+, d_max(k_DEFAULT_MAX)
+{
+}
+
+// MANIPULATORS
+void HistogramCollector::reset()
+{
+    for (int i = 0; i < k_NUM_BUCKETS; ++i) {
+        d_buckets[i].storeRelaxed(0);
+    }
+    d_count.storeRelaxed(0);
+    d_total.storeRelaxed(0);
+    d_min.storeRelaxed(k_DEFAULT_MIN);
+    d_max.storeRelease(k_DEFAULT_MAX);
+}
+
+void HistogramCollector::update(bsls::Types::Int64 value)
+{
+    if (value < 0) {
+        value = 0;
+    }
+    d_buckets[bucketIndex(value)].addRelaxed(1);
+    d_count.addRelaxed(1);
+    d_total.addRelaxed(value);
+    updateMin(&d_min, value);
+    updateMax(&d_max, value);
+}
+
+void HistogramCollector::merge(const HistogramCollector& other)
+{
+    BSLS_ASSERT(&other != this);
+
+    for (int i = 0; i < k_NUM_BUCKETS; ++i) {
+        const Int64 n = other.d_buckets[i].loadRelaxed();
+        if (n) {
+            d_buckets[i].addRelaxed(n);
+        }
+    }
+    d_count.addRelaxed(other.d_count.loadRelaxed());
+    d_total.addRelaxed(other.d_total.loadRelaxed());
+    updateMin(&d_min, other.d_min.loadRelaxed());
+    updateMax(&d_max, other.d_max.loadRelaxed());
+}
+
+void HistogramCollector::mergeAndReset(HistogramCollector *source)
+{
+    BSLS_ASSERT(source);
+    BSLS_ASSERT(source != this);
+
+    for (int i = 0; i < k_NUM_BUCKETS; ++i) {
+        if (source->d_buckets[i].loadRelaxed()) {
+            d_buckets[i].addRelaxed(source->d_buckets[i].swapAcqRel(0));
+        }
+    }
+    d_count.addRelaxed(source->d_count.swapAcqRel(0));
+    d_total.addRelaxed(source->d_total.swapAcqRel(0));
+    updateMin(&d_min, source->d_min.swapAcqRel(k_DEFAULT_MIN));
+    updateMax(&d_max, source->d_max.swapAcqRel(k_DEFAULT_MAX));
+}
+
+void HistogramCollector::loadAndReset(MetricRecord *record)
+{
+    BSLS_ASSERT(record);
+
+    for (int i = 0; i < k_NUM_BUCKETS; ++i) {
+        if (d_buckets[i].loadRelaxed()) {
+            d_buckets[i].swapAcqRel(0);
+        }
+    }
+    const Int64 count = d_count.swapAcqRel(0);
+    const Int64 total = d_total.swapAcqRel(0);
+    const Int64 min   = d_min.swapAcqRel(k_DEFAULT_MIN);
+    const Int64 max   = d_max.swapAcqRel(k_DEFAULT_MAX);
+
+    loadRecord(record, d_metricId, count, total, min, max);
+}
+
+// ACCESSORS
+void HistogramCollector::load(MetricRecord *record) const
+{
+    BSLS_ASSERT(record);
+
+    loadRecord(record,
+               d_metricId,
+               d_count.loadAcquire(),
+               d_total.loadAcquire(),
+               d_min.loadAcquire(),
+               d_max.loadAcquire());
+}
+
+double HistogramCollector::percentile(double percent) const
+{
+    BSLS_ASSERT(0.0 <= percent);
+    BSLS_ASSERT(percent <= 100.0);
+
+    // The buckets, rather than 'd_count', are summed so that the rank is
+    // consistent with the buckets if values are recorded concurrently.
+
+    Int64 total = 0;
+    for (int i = 0; i < k_NUM_BUCKETS; ++i) {
+        total += d_buckets[i].loadRelaxed();
+    }
+    if (0 == total) {
+        return 0.0;                                                   // RETURN
+    }
+
+    const double exactRank = percent / 100.0 * static_cast<double>(total);
+    Int64        rank      = static_cast<Int64>(bsl::ceil(exactRank));
+    if (rank < 1) {
+        rank = 1;
+    }
+
+    int   index      = 0;
+    Int64 cumulative = 0;
+    for (; index < k_NUM_BUCKETS - 1; ++index) {
+        cumulative += d_buckets[index].loadRelaxed();
+        if (cumulative >= rank) {
+            break;
+        }
+    }
+
+    Int64 value = bucketLowerBound(index) + (bucketWidth(index) - 1) / 2;
+
+    const Int64 min = d_min.loadRelaxed();
+    const Int64 max = d_max.loadRelaxed();
+    if (k_DEFAULT_MIN != min && value < min) {
+        value = min;
+    }
+    if (k_DEFAULT_MAX != max && value > max) {
+        value = max;
+    }
+    return static_cast<double>(value);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,273 @@
+// balm_histogramcollector.h                                          -*-C++-*-
+#ifndef INCLUDED_BALM_HISTOGRAMCOLLECTOR
+#define INCLUDED_BALM_HISTOGRAMCOLLECTOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a lock-free log-linear histogram of integral metric values.
+//
+//@CLASSES:
+//   balm::HistogramCollector: lock-free, mergeable histogram of metric values
+//
+//@SEE_ALSO: balm_integercollector, balm_collectorrepository, balm_metrics
+//
+//@DESCRIPTION: This component provides a class, 'balm::HistogramCollector',
+// that records the distribution of the (non-negative, integral) values of a
+// metric, so that percentiles (e.g., the median or 99th percentile latency)
+// can be reported, in addition to the count, total, minimum, and maximum
+// provided by 'balm::IntegerCollector'.
+//
+// A 'balm::HistogramCollector' uses a fixed, *log-linear* set of buckets,
+// similar to that of an HDR histogram: values in '[0 .. 63]' are each
+// recorded in their own bucket, and every subsequent power-of-two range
+// '[2^n .. 2^(n+1) - 1]' is divided into 'k_NUM_SUB_BUCKETS' (32) buckets of
+// equal width.  The value reported for a bucket is its midpoint, so the
+// relative error of any reported percentile is at most 1/64 (about 1.6%),
+// over the entire range of 'bsls::Types::Int64'.  Negative values are
+// recorded as 0.  The memory used by a collector is fixed ('k_NUM_BUCKETS'
+// 64-bit counters), and no memory is allocated.
+//
+// 'update' is lock-free: it increments the counter of the bucket holding the
+// value and updates the count, total, minimum, and maximum using atomic
+// operations.  Collectors for the same metric are *mergeable*: 'merge' adds
+// the values recorded by one collector to another, and 'mergeAndReset' moves
+// them, which is used to take a snapshot of a collector that is concurrently
+// updated and from which several percentiles are then computed.
+//
+// A 'balm::CollectorRepository' manages a default 'balm::HistogramCollector'
+// for a metric (see 'getDefaultHistogramCollector'), and publishes its
+// percentiles, along with the rest of the metrics, each time the metrics are
+// collected.  The 'BALM_METRICS_HISTOGRAM_*' macros of 'balm_metrics' record
+// values, or elapsed times, into those collectors.
+//
+///Thread Safety
+///-------------
+// 'balm::HistogramCollector' is fully *thread-safe*, meaning that all
+// non-creator operations on a given instance can be safely invoked
+// simultaneously from multiple threads.  Note, however, that 'load',
+// 'loadAndReset', 'merge', and 'mergeAndReset' do not take an atomic snapshot
+// of the collector: a value recorded concurrently with 'mergeAndReset' is
+// reported exactly once, but its contribution to the count and to the
+// buckets may be reported in different collection intervals.
+//
+///Usage
+///-----
+// The following example records the latencies of a set of requests in a
+// 'balm::HistogramCollector' and obtains their percentiles.
+//
+// We start by creating a 'balm::MetricId' object by hand; however, in
+// practice an id should be obtained from a 'balm::MetricRegistry' object (such
+// as the one owned by a 'balm::MetricsManager'):
+//..
+//  balm::Category           myCategory("MyCategory");
+//  balm::MetricDescription  description(&myCategory, "RequestLatency");
+//  balm::MetricId           latencyId(&description);
+//..
+// Then we create a histogram collector and record 1000 latencies, in
+// microseconds, of which 990 are 100us and 10 are 5000us:
+//..
+//  balm::HistogramCollector latencies(latencyId);
+//
+//  for (int i = 0; i < 1000; ++i) {
+//      latencies.update(i % 100 ? 100 : 5000);
+//  }
+//..
+// Next we verify the median and 99.9th percentile latencies, which are
+// reported with a relative error of at most 1/64:
+//..
+//  assert(100 == latencies.percentile(50.0));
+//  assert(4992 <= latencies.percentile(99.9));
+//  assert(5000 >= latencies.percentile(99.9));
+//..
+// Finally, we load a 'balm::MetricRecord' summarizing the recorded values,
+// and reset the collector:
+//..
+//  balm::MetricRecord record;
+//  latencies.loadAndReset(&record);
+//
+//  assert(latencyId         == record.metricId());
+//  assert(1000              == record.count());
+//  assert(990 * 100 + 50000 == record.total());
+//  assert(100               == record.min());
+//  assert(5000              == record.max());
+//  assert(0                 == latencies.count());
+//..
+
+#include <balscm_version.h>
+
+#include <balm_metricid.h>
+#include <balm_metricrecord.h>
+
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace balm {
+
+                          // ========================
+                          // class HistogramCollector
+                          // ========================
+
+class HistogramCollector {
+    // This class provides a mechanism for recording the distribution of the
+    // integral values of a metric into a fixed set of log-linear buckets, and
+    // for reporting the count, total, minimum, maximum, and percentiles of
+    // those values.  Each collector has an associated 'MetricId', supplied at
+    // construction, that identifies the collected metric.
+
+  public:
+    // PUBLIC CONSTANTS
+    enum {
+        k_SUB_BUCKET_BITS = 5,
+            // number of bits of precision retained for each value
+
+        k_NUM_SUB_BUCKETS = 1 << k_SUB_BUCKET_BITS,
+            // number of buckets for each power-of-two range of values
+
+        k_NUM_BUCKETS     = 2 * k_NUM_SUB_BUCKETS
+                          + (62 - k_SUB_BUCKET_BITS) * k_NUM_SUB_BUCKETS
+            // total number of buckets, covering '[0 .. 2^63 - 1]'
+    };
+
+  private:
+    // DATA
+    MetricId           d_metricId;                // metric identifier
+
+    bsls::AtomicInt64  d_count;                   // number of values
+
+    bsls::AtomicInt64  d_total;                   // sum of values
+
+    bsls::AtomicInt64  d_min;                     // minimum value
+
+    bsls::AtomicInt64  d_max;                     // maximum value
+
+    bsls::AtomicInt64  d_buckets[k_NUM_BUCKETS];  // number of values in each
+                                                  // bucket
+
+    // NOT IMPLEMENTED
+    HistogramCollector(const HistogramCollector&);
+    HistogramCollector& operator=(const HistogramCollector&);
+
+  public:
+    // CLASS METHODS
+    static int bucketIndex(bsls::Types::Int64 value);
+        // Return the index of the bucket recording the specified 'value'.
+        // Negative values are recorded in bucket 0.
+
+    static bsls::Types::Int64 bucketLowerBound(int index);
+        // Return the lowest value recorded in the bucket at the specified
+        // 'index'.  The behavior is undefined unless
+        // '0 <= index < k_NUM_BUCKETS'.
+
+    static bsls::Types::Int64 bucketWidth(int index);
+        // Return the number of distinct values recorded in the bucket at the
+        // specified 'index'.  The behavior is undefined unless
+        // '0 <= index < k_NUM_BUCKETS'.
+
+    // CREATORS
+    explicit HistogramCollector(const MetricId& metricId);
+        // Create a histogram collector for the specified 'metricId' having
+        // no recorded values.
+
+    ~HistogramCollector();
+        // Destroy this object.
+
+    // MANIPULATORS
+    void reset();
+        // Reset this collector to its default state, having no recorded
+        // values.
+
+    void update(bsls::Types::Int64 value);
+        // Record the specified 'value' in this collector.  A negative 'value'
+        // is recorded as 0.
+
+    void merge(const HistogramCollector& other);
+        // Add the values recorded by the specified 'other' collector to this
+        // collector.  The behavior is undefined if 'other' is this object.
+
+    void mergeAndReset(HistogramCollector *source);
+        // Add the values recorded by the specified 'source' collector to this
+        // collector, and reset 'source'.  Each value recorded by 'source' is
+        // added to this collector exactly once, even if 'source' is updated
+        // concurrently.  The behavior is undefined if 'source' is this
+        // object.
+
+    void loadAndReset(MetricRecord *record);
+        // Load into the specified 'record' the id of the metric collected by
+        // this object, and the count, total, minimum, and maximum of the
+        // values recorded by this collector; then reset this collector.  If
+        // no values have been recorded, 'record' is loaded with the default
+        // minimum and maximum of 'MetricRecord'.
+
+    // ACCESSORS
+    bsls::Types::Int64 count() const;
+        // Return the number of values recorded by this collector.
+
+    const MetricId& metricId() const;
+        // Return a reference to the non-modifiable 'MetricId' object
+        // identifying the metric for which this object collects values.
+
+    void load(MetricRecord *record) const;
+        // Load into the specified 'record' the id of the metric collected by
+        // this object, and the count, total, minimum, and maximum of the
+        // values recorded by this collector.  If no values have been
+        // recorded, 'record' is loaded with the default minimum and maximum
+        // of 'MetricRecord'.
+
+    double percentile(double percent) const;
+        // Return the value below or at which the specified 'percent' of the
+        // values recorded by this collector fall, or 0 if no values have been
+        // recorded.  The returned value is the midpoint of the bucket holding
+        // the requested value, bounded by the minimum and maximum recorded
+        // values.  The behavior is undefined unless
+        // '0.0 <= percent <= 100.0'.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                          // ------------------------
+                          // class HistogramCollector
+                          // ------------------------
+
+// CREATORS
+inline
+HistogramCollector::~HistogramCollector()
+{
+}
+
+// ACCESSORS
+inline
+bsls::Types::Int64 HistogramCollector::count() const
+{
+    return d_count.loadRelaxed();
+}
+
+inline
+const MetricId& HistogramCollector::metricId() const
+{
+    return d_metricId;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
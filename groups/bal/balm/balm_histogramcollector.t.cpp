@@ -0,0 +1,635 @@
+// balm_histogramcollector.t.cpp                                      -*-C++-*-
+#include <balm_histogramcollector.h>
+
+#include <balm_category.h>
+#include <balm_metricdescription.h>
+
+#include <bslim_testutil.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_climits.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+
+using namespace BloombergLP;
+
+using bsl::cout;
+using bsl::endl;
+using bsl::flush;
+
+// ============================================================================
+//                                 TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// 'balm::HistogramCollector' is a mechanism recording the distribution of
+// metric values into log-linear buckets.  Ensure that the bucket layout covers
+// the range of 'bsls::Types::Int64' with the documented precision, that values
+// are recorded in and reported from the expected buckets, that collectors can
+// be merged, and that no value is lost or reported twice when values are
+// recorded concurrently with 'mergeAndReset'.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] int bucketIndex(bsls::Types::Int64 value);
+// [ 2] bsls::Types::Int64 bucketLowerBound(int index);
+// [ 2] bsls::Types::Int64 bucketWidth(int index);
+//
+// CREATORS
+// [ 3] balm::HistogramCollector(const balm::MetricId& metricId);
+// [ 3] ~balm::HistogramCollector();
+//
+// MANIPULATORS
+// [ 4] void reset();
+// [ 3] void update(bsls::Types::Int64 value);
+// [ 4] void merge(const balm::HistogramCollector& other);
+// [ 4] void mergeAndReset(balm::HistogramCollector *source);
+// [ 4] void loadAndReset(balm::MetricRecord *record);
+//
+// ACCESSORS
+// [ 3] bsls::Types::Int64 count() const;
+// [ 3] const balm::MetricId& metricId() const;
+// [ 3] void load(balm::MetricRecord *record) const;
+// [ 3] double percentile(double percent) const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] CONCURRENCY TEST
+// [ 6] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balm::HistogramCollector Obj;
+typedef balm::MetricRecord       Rec;
+typedef balm::MetricDescription  Desc;
+typedef balm::MetricId           Id;
+typedef bsls::Types::Int64       Int64;
+
+// ============================================================================
+//                      GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+enum {
+    k_NUM_THREADS            = 8,
+    k_NUM_UPDATES_PER_THREAD = 50000
+};
+
+struct ConcurrencyArgs {
+    // Arguments shared by the threads of the concurrency test.
+
+    Obj            *d_collector_p;
+    bslmt::Barrier *d_barrier_p;
+};
+
+extern "C" void *updateCollector(void *arg)
+    // Record the values '1 .. k_NUM_UPDATES_PER_THREAD' in the collector
+    // identified by the specified 'arg', which must be the address of a
+    // 'ConcurrencyArgs' object.
+{
+    ConcurrencyArgs *args = static_cast<ConcurrencyArgs *>(arg);
+
+    args->d_barrier_p->wait();
+
+    for (int i = 1; i <= k_NUM_UPDATES_PER_THREAD; ++i) {
+        args->d_collector_p->update(i);
+    }
+    return 0;
+}
+
+bool isWithinPrecision(double value, Int64 expected)
+    // Return 'true' if the specified 'value' differs from the specified
+    // 'expected' value by at most the documented relative error of 1/64, and
+    // 'false' otherwise.
+{
+    const double error = value - static_cast<double>(expected);
+    return (error < 0 ? -error : error) <= static_cast<double>(expected) / 64;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int            test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    bool        verbose = argc > 2;
+    bool    veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    balm::Category cat_A("A", true);
+    Desc desc_A(&cat_A, "A"); const Desc *DESC_A = &desc_A;
+    Desc desc_B(&cat_A, "B"); const Desc *DESC_B = &desc_B;
+
+    Id metric_A(DESC_A); const Id& METRIC_A = metric_A;
+    Id metric_B(DESC_B); const Id& METRIC_B = metric_B;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        balm::Category           myCategory("MyCategory");
+        balm::MetricDescription  description(&myCategory, "RequestLatency");
+        balm::MetricId           latencyId(&description);
+
+        balm::HistogramCollector latencies(latencyId);
+
+        for (int i = 0; i < 1000; ++i) {
+            latencies.update(i % 100 ? 100 : 5000);
+        }
+
+        ASSERT(100 == latencies.percentile(50.0));
+        ASSERT(4992 <= latencies.percentile(99.9));
+        ASSERT(5000 >= latencies.percentile(99.9));
+
+        balm::MetricRecord record;
+        latencies.loadAndReset(&record);
+
+        ASSERT(latencyId         == record.metricId());
+        ASSERT(1000              == record.count());
+        ASSERT(990 * 100 + 50000 == record.total());
+        ASSERT(100               == record.min());
+        ASSERT(5000              == record.max());
+        ASSERT(0                 == latencies.count());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY TEST
+        //
+        // Concerns:
+        //: 1 Values recorded concurrently by several threads are all
+        //:   recorded.
+        //:
+        //: 2 Each value is moved by exactly one of a series of
+        //:   'mergeAndReset' calls made concurrently with the updates.
+        //
+        // Plan:
+        //: 1 Start several threads recording known values, while the main
+        //:   thread repeatedly moves the recorded values into a second
+        //:   collector using 'mergeAndReset'.  After joining the threads, move
+        //:   the remaining values, and verify the count, total, minimum,
+        //:   maximum, and percentiles of the second collector.  (C-1..2)
+        //
+        // Testing:
+        //   CONCURRENCY TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY TEST" << endl
+                          << "================" << endl;
+
+        Obj mX(METRIC_A);
+        Obj mY(METRIC_A);  const Obj& Y = mY;
+
+        bslmt::Barrier            barrier(k_NUM_THREADS + 1);
+        ConcurrencyArgs           args[k_NUM_THREADS];
+        bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            args[i].d_collector_p = &mX;
+            args[i].d_barrier_p   = &barrier;
+            ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                  updateCollector,
+                                                  &args[i]));
+        }
+
+        barrier.wait();
+
+        for (int i = 0; i < 100; ++i) {
+            mY.mergeAndReset(&mX);
+            bslmt::ThreadUtil::yield();
+        }
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+        }
+        mY.mergeAndReset(&mX);
+
+        const Int64 N = k_NUM_UPDATES_PER_THREAD;
+        const Int64 T = k_NUM_THREADS;
+
+        Rec record;
+        Y.load(&record);
+        ASSERTV(record.count(), T * N                 == record.count());
+        ASSERTV(record.total(), T * (N * (N + 1) / 2) == record.total());
+        ASSERTV(record.min(),   1                     == record.min());
+        ASSERTV(record.max(),   N                     == record.max());
+
+        ASSERTV(Y.percentile(50.0),
+                isWithinPrecision(Y.percentile(50.0), N / 2));
+        ASSERTV(Y.percentile(99.0),
+                isWithinPrecision(Y.percentile(99.0), N * 99 / 100));
+
+        ASSERT(0 == mX.count());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING MANIPULATORS
+        //
+        // Concerns:
+        //: 1 'merge' adds the values of another collector, leaving it
+        //:   unchanged.
+        //:
+        //: 2 'mergeAndReset' adds the values of another collector and resets
+        //:   it.
+        //:
+        //: 3 'loadAndReset' loads the same values as 'load', then resets the
+        //:   collector, and 'reset' resets the collector.
+        //
+        // Plan:
+        //: 1 Record sets of values in two collectors, merge them, and verify
+        //:   the loaded records and percentiles.  Reset the collectors and
+        //:   verify their state.  (C-1..3)
+        //
+        // Testing:
+        //   void reset();
+        //   void merge(const balm::HistogramCollector& other);
+        //   void mergeAndReset(balm::HistogramCollector *source);
+        //   void loadAndReset(balm::MetricRecord *record);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING MANIPULATORS" << endl
+                          << "====================" << endl;
+
+        Obj mX(METRIC_A);  const Obj& X = mX;
+        Obj mY(METRIC_A);  const Obj& Y = mY;
+
+        for (int i = 1; i <= 50; ++i) {
+            mX.update(i);
+            mY.update(i + 50);
+        }
+
+        if (verbose) cout << "\tTesting 'merge'." << endl;
+
+        mX.merge(Y);
+
+        Rec r1, r2;
+        X.load(&r1);
+        Y.load(&r2);
+        ASSERTV(r1, Rec(METRIC_A, 100, 5050, 1, 100) == r1);
+        ASSERTV(r2, Rec(METRIC_A,  50, 3775, 51, 100) == r2);
+        ASSERTV(X.percentile(50.0), 50 == X.percentile(50.0));
+        ASSERTV(X.percentile(100.0), 100 == X.percentile(100.0));
+        ASSERTV(Y.percentile(0.0), 51 == Y.percentile(0.0));
+
+        if (verbose) cout << "\tTesting 'mergeAndReset'." << endl;
+
+        mY.mergeAndReset(&mX);
+
+        X.load(&r1);
+        Y.load(&r2);
+        ASSERTV(r1, Rec(METRIC_A) == r1);
+        ASSERTV(r2, Rec(METRIC_A, 150, 8825, 1, 100) == r2);
+        ASSERT(0   == X.count());
+        ASSERT(0   == X.percentile(50.0));
+        ASSERT(150 == Y.count());
+
+        if (verbose) cout << "\tTesting 'loadAndReset'." << endl;
+
+        mY.loadAndReset(&r2);
+        ASSERTV(r2, Rec(METRIC_A, 150, 8825, 1, 100) == r2);
+        Y.load(&r2);
+        ASSERTV(r2, Rec(METRIC_A) == r2);
+        ASSERT(0 == Y.percentile(99.0));
+
+        if (verbose) cout << "\tTesting 'reset'." << endl;
+
+        mX.update(7);
+        mX.update(1000);
+        mX.reset();
+        X.load(&r1);
+        ASSERTV(r1, Rec(METRIC_A) == r1);
+        ASSERT(0 == X.percentile(50.0));
+
+        mX.update(7);
+        X.load(&r1);
+        ASSERTV(r1, Rec(METRIC_A, 1, 7, 7, 7) == r1);
+        ASSERT(7 == X.percentile(50.0));
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A collector is created with the supplied metric id and no
+        //:   recorded values.
+        //:
+        //: 2 'update' increments the count, adds to the total, and updates
+        //:   the minimum and maximum, recording negative values as 0.
+        //:
+        //: 3 'percentile' reports the value of the requested rank within the
+        //:   documented precision, bounded by the minimum and maximum.
+        //
+        // Plan:
+        //: 1 Record a table of values and verify the loaded record.  (C-1..2)
+        //:
+        //: 2 Record the values '1 .. 10000' and verify a set of percentiles
+        //:   against their exact values.  (C-3)
+        //
+        // Testing:
+        //   balm::HistogramCollector(const balm::MetricId& metricId);
+        //   ~balm::HistogramCollector();
+        //   void update(bsls::Types::Int64 value);
+        //   bsls::Types::Int64 count() const;
+        //   const balm::MetricId& metricId() const;
+        //   void load(balm::MetricRecord *record) const;
+        //   double percentile(double percent) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING PRIMARY MANIPULATORS" << endl
+                          << "============================" << endl;
+
+        static const struct {
+            int    d_line;
+            Int64  d_value;
+            int    d_expCount;
+            double d_expTotal;
+            double d_expMin;
+            double d_expMax;
+        } DATA[] = {
+            //LINE  VALUE     COUNT  TOTAL     MIN    MAX
+            //----  --------  -----  --------  -----  --------
+            { L_,   5,            1,        5,     5,        5 },
+            { L_,   1000,         2,     1005,     5,     1000 },
+            { L_,   -3,           3,     1005,     0,     1000 },
+            { L_,   0,            4,     1005,     0,     1000 },
+            { L_,   1000000,      5,  1001005,     0,  1000000 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        {
+            Obj mX(METRIC_B);  const Obj& X = mX;
+
+            ASSERT(METRIC_B == X.metricId());
+            ASSERT(0        == X.count());
+
+            Rec record;
+            X.load(&record);
+            ASSERT(Rec(METRIC_B) == record);
+            ASSERT(0             == X.percentile(50.0));
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int LINE = DATA[ti].d_line;
+
+                mX.update(DATA[ti].d_value);
+
+                const Rec EXP(METRIC_B,
+                              DATA[ti].d_expCount,
+                              DATA[ti].d_expTotal,
+                              DATA[ti].d_expMin,
+                              DATA[ti].d_expMax);
+
+                X.load(&record);
+                ASSERTV(LINE, record, EXP == record);
+                ASSERTV(LINE, DATA[ti].d_expCount == X.count());
+            }
+        }
+
+        if (verbose) cout << "\tTesting 'percentile'." << endl;
+        {
+            Obj mX(METRIC_A);  const Obj& X = mX;
+
+            for (int i = 1; i <= 10000; ++i) {
+                mX.update(i);
+            }
+
+            static const struct {
+                int    d_line;
+                double d_percent;
+                Int64  d_exact;
+            } PDATA[] = {
+                //LINE  PERCENT  EXACT
+                //----  -------  -----
+                { L_,      0.0,      1 },
+                { L_,      0.5,     50 },
+                { L_,     10.0,   1000 },
+                { L_,     50.0,   5000 },
+                { L_,     90.0,   9000 },
+                { L_,     99.0,   9900 },
+                { L_,     99.9,   9990 },
+                { L_,    100.0,  10000 },
+            };
+            const int NUM_PDATA = sizeof PDATA / sizeof *PDATA;
+
+            for (int ti = 0; ti < NUM_PDATA; ++ti) {
+                const int    LINE    = PDATA[ti].d_line;
+                const double PERCENT = PDATA[ti].d_percent;
+                const Int64  EXACT   = PDATA[ti].d_exact;
+
+                const double VALUE = X.percentile(PERCENT);
+
+                if (veryVerbose) { T_ P_(LINE) P_(PERCENT) P(VALUE) }
+
+                ASSERTV(LINE, VALUE, EXACT, isWithinPrecision(VALUE, EXACT));
+                ASSERTV(LINE, VALUE, 1 <= VALUE && VALUE <= 10000);
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING BUCKET LAYOUT
+        //
+        // Concerns:
+        //: 1 Values below '2 * k_NUM_SUB_BUCKETS' are each recorded in their
+        //:   own bucket.
+        //:
+        //: 2 Every value is recorded in the bucket whose range contains it,
+        //:   and the buckets are contiguous and cover
+        //:   '[0 .. 2^63 - 1]'.
+        //:
+        //: 3 The width of a bucket is at most 1/32 of its lower bound (so that
+        //:   the midpoint is within 1/64 of any value in the bucket).
+        //:
+        //: 4 Negative values are recorded in bucket 0.
+        //
+        // Plan:
+        //: 1 For each bucket, verify that the bucket follows its predecessor
+        //:   contiguously, that its lower bound, upper bound, and values
+        //:   around them map to the expected buckets, and that its width
+        //:   meets the precision bound.  (C-1..3)
+        //:
+        //: 2 Verify the indices of negative values and of the extreme values.
+        //:   (C-2, 4)
+        //
+        // Testing:
+        //   int bucketIndex(bsls::Types::Int64 value);
+        //   bsls::Types::Int64 bucketLowerBound(int index);
+        //   bsls::Types::Int64 bucketWidth(int index);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING BUCKET LAYOUT" << endl
+                          << "=====================" << endl;
+
+        for (int i = 0; i < 2 * Obj::k_NUM_SUB_BUCKETS; ++i) {
+            ASSERTV(i, i == Obj::bucketIndex(i));
+            ASSERTV(i, i == Obj::bucketLowerBound(i));
+            ASSERTV(i, 1 == Obj::bucketWidth(i));
+        }
+
+        Int64 expLower = 0;
+        for (int i = 0; i < Obj::k_NUM_BUCKETS; ++i) {
+            const Int64 LOWER = Obj::bucketLowerBound(i);
+            const Int64 WIDTH = Obj::bucketWidth(i);
+            const Int64 UPPER = LOWER + (WIDTH - 1);
+
+            ASSERTV(i, LOWER, expLower, expLower == LOWER);
+            ASSERTV(i, 0 < WIDTH);
+            ASSERTV(i, WIDTH <= 1 || WIDTH <= LOWER / 32);
+
+            ASSERTV(i, i == Obj::bucketIndex(LOWER));
+            ASSERTV(i, i == Obj::bucketIndex(UPPER));
+            ASSERTV(i, i == Obj::bucketIndex(LOWER + WIDTH / 2));
+            if (0 < i) {
+                ASSERTV(i, i - 1 == Obj::bucketIndex(LOWER - 1));
+            }
+            if (i < Obj::k_NUM_BUCKETS - 1) {
+                ASSERTV(i, i + 1 == Obj::bucketIndex(UPPER + 1));
+            }
+            else {
+                ASSERTV(UPPER, LLONG_MAX == UPPER);
+            }
+            expLower = UPPER + 1;
+        }
+
+        ASSERT(0                      == Obj::bucketIndex(-1));
+        ASSERT(0                      == Obj::bucketIndex(LLONG_MIN));
+        ASSERT(Obj::k_NUM_BUCKETS - 1 == Obj::bucketIndex(LLONG_MAX));
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Perform ad-hoc test of the primary modifiers and accessors.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj mX(METRIC_A);  const Obj& X = mX;
+
+        mX.update(10);
+        mX.update(20);
+        mX.update(30);
+
+        Rec r;
+        X.load(&r);
+        ASSERT(Rec(METRIC_A, 3, 60, 10, 30) == r);
+        ASSERT(20 == X.percentile(50.0));
+        ASSERT(30 == X.percentile(100.0));
+
+        mX.loadAndReset(&r);
+        ASSERT(Rec(METRIC_A, 3, 60, 10, 30) == r);
+        ASSERT(0 == X.count());
+
+        (void)METRIC_B;
+      } break;
+      default: {
+        cout << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cout << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -92,6 +92,13 @@ BSLS_IDENT("$Id: $")
 //       lookup on 'CATEGORY' and 'METRIC' on each invocation, so those values
 //       need *not* be runtime constants.
 //
+//   BALM_METRICS_STRIPED_UPDATE(CATEGORY, METRIC, VALUE)
+//   BALM_METRICS_STRIPED_INT_UPDATE(CATEGORY, METRIC, VALUE)
+//   BALM_METRICS_STRIPED_INCREMENT(CATEGORY, METRIC)
+//       Update (or increment) the identified metric using a collector that
+//       does not lock a mutex (see 'balm_stripedcollector').  'CATEGORY' and
+//       'METRIC' must be *runtime* *constants*.
+//
 //   BALM_METRICS_TIME_BLOCK(CATEGORY, METRIC, TIME_UNITS)
 //   BALM_METRICS_TIME_BLOCK_SECONDS(CATEGORY, METRIC)
 //   BALM_METRICS_TIME_BLOCK_MILLISECONDS(CATEGORY, METRIC)
@@ -112,6 +119,21 @@ BSLS_IDENT("$Id: $")
 //       of the enclosing lexical scope.  This operation performs a lookup on
 //       'CATEGORY' and 'METRIC' on each invocation, so those values need *not*
 //       be runtime constants.
+//
+//   BALM_METRICS_HISTOGRAM_UPDATE(CATEGORY, METRIC, VALUE)
+//       Record the integral value of the identified metric in a histogram,
+//       from which the percentiles of the metric are published (see
+//       'balm_histogramcollector').  'CATEGORY' and 'METRIC' must be
+//       *runtime* *constants*.
+//
+//   BALM_METRICS_HISTOGRAM_TIME_BLOCK(CATEGORY, METRIC, TIME_UNITS)
+//   BALM_METRICS_HISTOGRAM_TIME_BLOCK_MILLISECONDS(CATEGORY, METRIC)
+//   BALM_METRICS_HISTOGRAM_TIME_BLOCK_MICROSECONDS(CATEGORY, METRIC)
+//   BALM_METRICS_HISTOGRAM_TIME_BLOCK_NANOSECONDS(CATEGORY, METRIC)
+//       Record the elapsed (wall) time, in the indicated units, from the
+//       instantiation point of the macro to the end of the enclosing lexical
+//       scope in the histogram of the identified metric.  'CATEGORY' and
+//       'METRIC' must be *runtime* *constants*.
 //..
 //
 ///Macro Reference
@@ -243,6 +265,23 @@ BSLS_IDENT("$Id: $")
 //   BALM_METRICS_TYPED_INCREMENT(CATEGORY, METRIC, PREFERRED_TYPE)
 //       The behavior of this macro is logically equivalent to
 //       'BALM_METRICS_TYPED_UPDATE(CATEGORY, METRIC, 1, PREFERRED_TYPE)'.
+//
+//   BALM_METRICS_STRIPED_UPDATE(CATEGORY, METRIC, VALUE)
+//   BALM_METRICS_STRIPED_INT_UPDATE(CATEGORY, METRIC, VALUE)
+//       The behavior of these macros is logically equivalent to
+//       'BALM_METRICS_UPDATE(CATEGORY, METRIC, VALUE)' and
+//       'BALM_METRICS_INT_UPDATE(CATEGORY, METRIC, VALUE)', respectively,
+//       except that the value is recorded in the 'balm::StripedCollector' (or
+//       'balm::StripedIntegerCollector') for the indicated metric, which
+//       accumulates values into per-thread stripes using atomic operations
+//       rather than a mutex.  These macros are intended for metrics updated
+//       by many threads on performance-critical paths; the values they record
+//       are combined with those recorded by the other macros for the same
+//       metric when the metric is collected.
+//
+//   BALM_METRICS_STRIPED_INCREMENT(CATEGORY, METRIC)
+//       The behavior of this macro is logically equivalent to
+//       'BALM_METRICS_STRIPED_INT_UPDATE(CATEGORY, METRIC, 1)'.
 //..
 //  The following are the dynamic macros provided by this component for
 //  updating a metric's value; these macros do not statically cache the
@@ -379,6 +418,50 @@ BSLS_IDENT("$Id: $")
 //       'BALM_METRICS_DYNAMIC_TIME_BLOCK' called with
 //       'balm::StopwatchScopedGuard::k_NANOSECONDS'.
 //..
+// The following macros record values in the 'balm::HistogramCollector' of a
+// metric, so that, in addition to the count, total, minimum, and maximum of
+// the metric, its 50th, 90th, 99th, and 99.9th percentiles are published as
+// the metrics 'METRIC.p50', 'METRIC.p90', 'METRIC.p99', and 'METRIC.p999'
+// (see 'balm_collectorrepository'):
+//..
+//   BALM_METRICS_HISTOGRAM_UPDATE(CATEGORY, METRIC, VALUE)
+//       Record the specified 'VALUE', which must be of a type convertible to
+//       'bsls::Types::Int64', in the histogram of the indicated metric,
+//       identified by the specified 'CATEGORY' and 'METRIC' names.  Negative
+//       values are recorded as 0.  'CATEGORY' and 'METRIC' must be
+//       null-terminated strings of a type convertible to 'const char *'.
+//       This macro maintains a (function-scope static) cache containing the
+//       identity of the histogram, so that 'CATEGORY' and 'METRIC' must be
+//       *runtime* *constants*.  If the default metrics manager has not been
+//       initialized, or the identified 'CATEGORY' is disabled, this macro has
+//       no effect.
+//
+//   BALM_METRICS_HISTOGRAM_TIME_BLOCK(CATEGORY, METRIC, TIME_UNITS)
+//       Record, in the histogram of the indicated metric, identified by the
+//       specified 'CATEGORY' and 'METRIC' names, the elapsed (wall) time, in
+//       the specified 'TIME_UNITS', from the point of instantiation of the
+//       macro to the end of the enclosing lexical scope.  The elapsed time is
+//       rounded to the nearest integral number of 'TIME_UNITS', so
+//       'TIME_UNITS' should be fine enough (e.g.,
+//       'balm::StopwatchScopedGuard::k_MICROSECONDS') for the percentiles to
+//       be meaningful.  Otherwise, the behavior of this macro is the same as
+//       that of 'BALM_METRICS_TIME_BLOCK'.
+//
+//   BALM_METRICS_HISTOGRAM_TIME_BLOCK_MILLISECONDS(CATEGORY, METRIC)
+//       The behavior of this macro is logically equivalent to
+//       'BALM_METRICS_HISTOGRAM_TIME_BLOCK' called with
+//       'balm::StopwatchScopedGuard::k_MILLISECONDS'.
+//
+//   BALM_METRICS_HISTOGRAM_TIME_BLOCK_MICROSECONDS(CATEGORY, METRIC)
+//       The behavior of this macro is logically equivalent to
+//       'BALM_METRICS_HISTOGRAM_TIME_BLOCK' called with
+//       'balm::StopwatchScopedGuard::k_MICROSECONDS'.
+//
+//   BALM_METRICS_HISTOGRAM_TIME_BLOCK_NANOSECONDS(CATEGORY, METRIC)
+//       The behavior of this macro is logically equivalent to
+//       'BALM_METRICS_HISTOGRAM_TIME_BLOCK' called with
+//       'balm::StopwatchScopedGuard::k_NANOSECONDS'.
+//..
 //
 ///Usage
 ///-----
@@ -505,12 +588,14 @@ BSLS_IDENT("$Id: $")
 #include <balm_collector.h>
 #include <balm_collectorrepository.h>
 #include <balm_defaultmetricsmanager.h>
+#include <balm_histogramcollector.h>
 #include <balm_integercollector.h>
 #include <balm_metricid.h>
 #include <balm_metricregistry.h>
 #include <balm_metricsmanager.h>
 #include <balm_publicationtype.h>
 #include <balm_stopwatchscopedguard.h>
+#include <balm_stripedcollector.h>
 
 #include <bsls_performancehint.h>
 #include <bsls_platform.h>
@@ -996,6 +1081,94 @@ do {                                                                          \
 #define BALM_METRICS_DYNAMIC_INCREMENT(CATEGORY, METRIC)                      \
     BALM_METRICS_DYNAMIC_INT_UPDATE(CATEGORY, METRIC, 1)
 
+                        // ===========================
+                        // BALM_METRICS_STRIPED_UPDATE
+                        // ===========================
+
+#define BALM_METRICS_STRIPED_UPDATE(CATEGORY, METRIC, VALUE) do {             \
+   using namespace BloombergLP;                                               \
+   typedef balm::Metrics_Helper Helper;                                       \
+   static balm::CategoryHolder holder = { false, 0, 0 };                      \
+   static balm::StripedCollector *collector1 = 0;                             \
+   if (0 == holder.category() && balm::DefaultMetricsManager::instance()) {   \
+     Helper::logEmptyName(CATEGORY,Helper::e_TYPE_CATEGORY,__FILE__,__LINE__);\
+     Helper::logEmptyName(METRIC, Helper::e_TYPE_METRIC, __FILE__, __LINE__); \
+       collector1 = Helper::getStripedCollector(CATEGORY, METRIC);            \
+       Helper::initializeCategoryHolder(&holder, CATEGORY);                   \
+   }                                                                          \
+   if (holder.enabled()) {                                                    \
+       collector1->update(VALUE);                                             \
+   }                                                                          \
+ } while (0)
+
+#define BALM_METRICS_STRIPED_INT_UPDATE(CATEGORY, METRIC, VALUE) do {         \
+   using namespace BloombergLP;                                               \
+   typedef balm::Metrics_Helper Helper;                                       \
+   static balm::CategoryHolder holder = { false, 0, 0 };                      \
+   static balm::StripedIntegerCollector *collector1 = 0;                      \
+   if (0 == holder.category() && balm::DefaultMetricsManager::instance()) {   \
+     Helper::logEmptyName(CATEGORY,Helper::e_TYPE_CATEGORY,__FILE__,__LINE__);\
+     Helper::logEmptyName(METRIC, Helper::e_TYPE_METRIC, __FILE__, __LINE__); \
+       collector1 = Helper::getStripedIntegerCollector(CATEGORY, METRIC);     \
+       Helper::initializeCategoryHolder(&holder, CATEGORY);                   \
+   }                                                                          \
+   if (holder.enabled()) {                                                    \
+       collector1->update(VALUE);                                             \
+   }                                                                          \
+ } while (0)
+
+#define BALM_METRICS_STRIPED_INCREMENT(CATEGORY, METRIC)                      \
+    BALM_METRICS_STRIPED_INT_UPDATE(CATEGORY, METRIC, 1)
+
+                        // =============================
+                        // BALM_METRICS_HISTOGRAM_UPDATE
+                        // =============================
+
+#define BALM_METRICS_HISTOGRAM_UPDATE(CATEGORY, METRIC, VALUE) do {           \
+   using namespace BloombergLP;                                               \
+   typedef balm::Metrics_Helper Helper;                                       \
+   static balm::CategoryHolder holder = { false, 0, 0 };                      \
+   static balm::HistogramCollector *collector1 = 0;                           \
+   if (0 == holder.category() && balm::DefaultMetricsManager::instance()) {   \
+     Helper::logEmptyName(CATEGORY,Helper::e_TYPE_CATEGORY,__FILE__,__LINE__);\
+     Helper::logEmptyName(METRIC, Helper::e_TYPE_METRIC, __FILE__, __LINE__); \
+       collector1 = Helper::getHistogramCollector(CATEGORY, METRIC);          \
+       Helper::initializeCategoryHolder(&holder, CATEGORY);                   \
+   }                                                                          \
+   if (holder.enabled()) {                                                    \
+       collector1->update(VALUE);                                             \
+   }                                                                          \
+ } while (0)
+
+                        // =================================
+                        // BALM_METRICS_HISTOGRAM_TIME_BLOCK
+                        // =================================
+
+#define BALM_METRICS_HISTOGRAM_TIME_BLOCK(CATEGORY, METRIC, TIME_UNITS)       \
+  BALM_METRICS_HISTOGRAM_TIME_BLOCK_IMP(                                      \
+                                  (CATEGORY),                                 \
+                                  (METRIC),                                   \
+                                  TIME_UNITS,                                 \
+                                  BALM_METRICS_UNIQUE_NAME(_bAlM_HiStOgRaM))
+
+#define BALM_METRICS_HISTOGRAM_TIME_BLOCK_MILLISECONDS(CATEGORY, METRIC)      \
+  BALM_METRICS_HISTOGRAM_TIME_BLOCK(                                          \
+                      (CATEGORY),                                             \
+                      (METRIC),                                               \
+                      BloombergLP::balm::StopwatchScopedGuard::k_MILLISECONDS);
+
+#define BALM_METRICS_HISTOGRAM_TIME_BLOCK_MICROSECONDS(CATEGORY, METRIC)      \
+  BALM_METRICS_HISTOGRAM_TIME_BLOCK(                                          \
+                      (CATEGORY),                                             \
+                      (METRIC),                                               \
+                      BloombergLP::balm::StopwatchScopedGuard::k_MICROSECONDS);
+
+#define BALM_METRICS_HISTOGRAM_TIME_BLOCK_NANOSECONDS(CATEGORY, METRIC)       \
+  BALM_METRICS_HISTOGRAM_TIME_BLOCK(                                          \
+                       (CATEGORY),                                            \
+                       (METRIC),                                              \
+                       BloombergLP::balm::StopwatchScopedGuard::k_NANOSECONDS);
+
                         // =======================
                         // BALM_METRICS_TIME_BLOCK
                         // =======================
@@ -1120,6 +1293,33 @@ do {                                                                          \
         VARIABLE_NAME = repository.getDefaultCollector((CATEGORY),            \
                                                        (METRIC));             \
     }                                                                         \
+    BloombergLP::balm::StopwatchScopedGuard                                   \
+         BALM_METRICS_UNIQUE_NAME(__bAlM_gUaRd)(VARIABLE_NAME, TIME_UNITS);
+
+// Declare a static pointer to a 'balm::HistogramCollector' with the specified
+// 'VARIABLE_NAME' and an initial value of 0.  If the default metrics manager
+// is available and the declared pointer variable (named 'VARIABLE_NAME') is 0,
+// assign to 'VARIABLE_NAME' the address of the histogram collector for the
+// specified 'CATEGORY' and 'METRIC'.  Finally, declare a
+// 'balm::StopwatchScopedGuard' object with a unique variable name and supply
+// its constructor the histogram collector address held in 'VARIABLE_NAME' and
+// the specified 'TIME_UNITS'.
+#define BALM_METRICS_HISTOGRAM_TIME_BLOCK_IMP(CATEGORY,                       \
+                                              METRIC,                         \
+                                              TIME_UNITS,                     \
+                                              VARIABLE_NAME)                  \
+    static BloombergLP::balm::HistogramCollector *VARIABLE_NAME = 0;          \
+    if (BloombergLP::balm::DefaultMetricsManager::instance()) {               \
+       using namespace BloombergLP;                                           \
+       if (0 == VARIABLE_NAME) {                                              \
+           VARIABLE_NAME = balm::Metrics_Helper::getHistogramCollector(       \
+                                                                (CATEGORY),   \
+                                                                (METRIC));    \
+       }                                                                      \
+    }                                                                         \
+    else {                                                                    \
+       VARIABLE_NAME = 0;                                                     \
+    }                                                                         \
     BloombergLP::balm::StopwatchScopedGuard                                   \
          BALM_METRICS_UNIQUE_NAME(__bAlM_gUaRd)(VARIABLE_NAME, TIME_UNITS);
 
@@ -1202,6 +1402,28 @@ struct Metrics_Helper {
         // The behavior is undefined unless the 'balm' metrics manager
         // singleton is valid.
 
+    static StripedCollector *getStripedCollector(const char *category,
+                                                 const char *metric);
+        // Return the address of the striped metrics collector for the metric
+        // identified by the specified 'category' and 'metric' names.  The
+        // behavior is undefined unless the 'balm' metrics manager singleton is
+        // valid.
+
+    static StripedIntegerCollector *getStripedIntegerCollector(
+                                                       const char *category,
+                                                       const char *metric);
+        // Return the address of the striped integer metrics collector for the
+        // metric identified by the specified 'category' and 'metric' names.
+        // The behavior is undefined unless the 'balm' metrics manager
+        // singleton is valid.
+
+    static HistogramCollector *getHistogramCollector(const char *category,
+                                                     const char *metric);
+        // Return the address of the histogram collector for the metric
+        // identified by the specified 'category' and 'metric' names.  The
+        // behavior is undefined unless the 'balm' metrics manager singleton is
+        // valid.
+
     static void setPublicationType(const MetricId&        id,
                                    PublicationType::Value type);
         // Set the publication type for the metric identified by the specified
@@ -1256,6 +1478,37 @@ IntegerCollector *Metrics_Helper::getIntegerCollector(const char *category,
                                                                      metric);
 }
 
+inline
+StripedCollector *Metrics_Helper::getStripedCollector(const char *category,
+                                                      const char *metric)
+{
+    MetricsManager *manager = DefaultMetricsManager::instance();
+    return manager->collectorRepository().getDefaultStripedCollector(category,
+                                                                     metric);
+}
+
+inline
+StripedIntegerCollector *Metrics_Helper::getStripedIntegerCollector(
+                                                       const char *category,
+                                                       const char *metric)
+{
+    MetricsManager *manager = DefaultMetricsManager::instance();
+    return manager->collectorRepository().getDefaultStripedIntegerCollector(
+                                                                      category,
+                                                                      metric);
+}
+
+inline
+HistogramCollector *Metrics_Helper::getHistogramCollector(
+                                                        const char *category,
+                                                        const char *metric)
+{
+    MetricsManager *manager = DefaultMetricsManager::instance();
+    return manager->collectorRepository().getDefaultHistogramCollector(
+                                                                     category,
+                                                                     metric);
+}
+
 inline
 void Metrics_Helper::setPublicationType(const MetricId&        id,
                                         PublicationType::Value type)
@@ -88,6 +88,14 @@ using bsl::flush;
 // [ 9] BALM_METRICS_DYNAMIC_TIME_BLOCK_MILLISECONDS(CATEGORY, METRIC)
 // [ 9] BALM_METRICS_DYNAMIC_TIME_BLOCK_MICROSECONDS(CATEGORY, METRIC)
 // [ 9] BALM_METRICS_DYNAMIC_TIME_BLOCK_NANOSECONDS(CATEGORY, METRIC)
+// [20] BALM_METRICS_STRIPED_UPDATE(CATEGORY, METRIC, VALUE)
+// [20] BALM_METRICS_STRIPED_INT_UPDATE(CATEGORY, METRIC, VALUE)
+// [20] BALM_METRICS_STRIPED_INCREMENT(CATEGORY, METRIC)
+// [21] BALM_METRICS_HISTOGRAM_UPDATE(CATEGORY, METRIC, VALUE)
+// [21] BALM_METRICS_HISTOGRAM_TIME_BLOCK(CATEGORY, METRIC, TIME_UNITS)
+// [21] BALM_METRICS_HISTOGRAM_TIME_BLOCK_MILLISECONDS(CATEGORY, METRIC)
+// [21] BALM_METRICS_HISTOGRAM_TIME_BLOCK_MICROSECONDS(CATEGORY, METRIC)
+// [21] BALM_METRICS_HISTOGRAM_TIME_BLOCK_NANOSECONDS(CATEGORY, METRIC)
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [11] CONCURRENCY TEST: STANDARD MACROS
@@ -1385,6 +1393,257 @@ int main(int argc, char *argv[])
     Corp::bslma::DefaultAllocatorGuard guard(&defaultAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 21: {
+        // --------------------------------------------------------------------
+        // TESTING: 'BALM_METRICS_HISTOGRAM_UPDATE',
+        //          'BALM_METRICS_HISTOGRAM_TIME_BLOCK'
+        //
+        // Concerns:
+        //    That the histogram macros record values in the histogram
+        //    collector of the appropriate metric, respect the supplied
+        //    category's 'enabled' property, and that the count, total,
+        //    minimum, maximum, and percentiles of the histogram are reported
+        //    by 'collectAndReset'.
+        //
+        // Plan:
+        //   Verify that invoking the macros without a default metrics manager
+        //   has no effect.
+        //
+        //   Invoke 'BALM_METRICS_HISTOGRAM_UPDATE' with known values, enabling
+        //   and disabling the category between invocations, and verify the
+        //   records, including the percentile records, appended by
+        //   'collectAndReset'.  Then time a block with
+        //   'BALM_METRICS_HISTOGRAM_TIME_BLOCK_MICROSECONDS' and verify the
+        //   recorded value.
+        //
+        // Testing:
+        //    BALM_METRICS_HISTOGRAM_UPDATE(CATEGORY, METRIC, VALUE)
+        //    BALM_METRICS_HISTOGRAM_TIME_BLOCK(CATEGORY, METRIC, TIME_UNITS)
+        //    BALM_METRICS_HISTOGRAM_TIME_BLOCK_MILLISECONDS(CATEGORY, METRIC)
+        //    BALM_METRICS_HISTOGRAM_TIME_BLOCK_MICROSECONDS(CATEGORY, METRIC)
+        //    BALM_METRICS_HISTOGRAM_TIME_BLOCK_NANOSECONDS(CATEGORY, METRIC)
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING: HISTOGRAM MACROS\n"
+                          << "=========================\n";
+
+        if (veryVerbose)
+            cout << "\tverify macros are a no-op without a metrics manager.\n";
+        {
+            BALM_METRICS_HISTOGRAM_UPDATE("H", "latency", 10);
+            BALM_METRICS_HISTOGRAM_TIME_BLOCK_MILLISECONDS("H", "ms");
+            BALM_METRICS_HISTOGRAM_TIME_BLOCK_NANOSECONDS("H", "ns");
+        }
+
+        if (veryVerbose)
+            cout << "\tverify macros are applied correctly.\n";
+        {
+            BALM::DefaultMetricsManagerScopedGuard guard(Z);
+            BALM::MetricsManager& mgr = *DefaultManager::instance();
+            Registry&   registry   = mgr.metricRegistry();
+            Repository& repository = mgr.collectorRepository();
+
+            const Id         latencyId(registry.getId("H", "latency"));
+            const Category  *CATEGORY = latencyId.category();
+
+            // Record '1 .. 1000' while the category is enabled, and 5000
+            // while it is disabled.
+
+            for (int i = 1; i <= 1000; ++i) {
+                BALM_METRICS_HISTOGRAM_UPDATE("H", "latency", i);
+                registry.setCategoryEnabled(CATEGORY, false);
+                BALM_METRICS_HISTOGRAM_UPDATE("H", "latency", 5000);
+                registry.setCategoryEnabled(CATEGORY, true);
+            }
+
+            const char *SUFFIXES[] = { ".p50", ".p90", ".p99", ".p999" };
+            const int   EXPECTED[] = {    500,    900,    990,     999 };
+            const int   NUM_SUFFIXES = sizeof SUFFIXES / sizeof *SUFFIXES;
+
+            for (int i = 0; i < NUM_SUFFIXES; ++i) {
+                bsl::string name("latency");
+                name += SUFFIXES[i];
+                const Id PID(registry.getId("H", name.c_str()));
+                ASSERTV(i, Type::e_AVG ==
+                        PID.description()->preferredPublicationType());
+            }
+
+            bsl::vector<BALM::MetricRecord> records(Z);
+            repository.collectAndReset(&records, CATEGORY);
+            ASSERTV(records.size(), 1 + NUM_SUFFIXES == records.size());
+            if (1 + NUM_SUFFIXES == records.size()) {
+                ASSERTV(records[0],
+                        BALM::MetricRecord(latencyId, 1000, 500500, 1, 1000)
+                                                                == records[0]);
+                for (int i = 0; i < NUM_SUFFIXES; ++i) {
+                    const BALM::MetricRecord& R = records[i + 1];
+                    bsl::string name("latency");
+                    name += SUFFIXES[i];
+
+                    ASSERTV(i, name == R.metricId().metricName());
+                    ASSERTV(i, 1000 == R.count());
+                    ASSERTV(i, R.min() == R.max());
+                    ASSERTV(i, R.min() * 1000 == R.total());
+
+                    const double ERROR = R.min() - EXPECTED[i];
+                    ASSERTV(i, R.min(), -EXPECTED[i] / 64.0 <= ERROR
+                                     && ERROR <= EXPECTED[i] / 64.0);
+                }
+            }
+
+            // No values were recorded since the last collection, so no
+            // percentile records are reported.
+
+            records.clear();
+            repository.collectAndReset(&records, CATEGORY);
+            ASSERTV(records.size(), 1 == records.size());
+            ASSERT(BALM::MetricRecord(latencyId) == records[0]);
+
+            if (veryVerbose)
+                cout << "\tverify the time block macros.\n";
+
+            for (int i = 0; i < 3; ++i) {
+                BALM_METRICS_HISTOGRAM_TIME_BLOCK_MICROSECONDS("H", "us");
+                Corp::bslmt::ThreadUtil::sleep(
+                                          Corp::bsls::TimeInterval(50 * .001));
+            }
+            {
+                BALM_METRICS_HISTOGRAM_TIME_BLOCK("H",
+                                                  "ms",
+                                                  SWGuard::k_MILLISECONDS);
+            }
+            {
+                BALM_METRICS_HISTOGRAM_TIME_BLOCK_NANOSECONDS("H", "ns");
+            }
+
+            const Id usId(registry.getId("H", "us"));
+            BALM::MetricRecord record;
+            repository.getDefaultHistogramCollector(usId)->load(&record);
+            ASSERTV(record.count(), 3 == record.count());
+            ASSERTV(record.min(), 50 * 1000 <= record.min());
+
+            const Id msId(registry.getId("H", "ms"));
+            repository.getDefaultHistogramCollector(msId)->load(&record);
+            ASSERTV(record.count(), 1 == record.count());
+
+            const Id nsId(registry.getId("H", "ns"));
+            repository.getDefaultHistogramCollector(nsId)->load(&record);
+            ASSERTV(record.count(), 1 == record.count());
+        }
+      } break;
+      case 20: {
+        // --------------------------------------------------------------------
+        // TESTING: 'BALM_METRICS_STRIPED_UPDATE',
+        //          'BALM_METRICS_STRIPED_INT_UPDATE',
+        //          'BALM_METRICS_STRIPED_INCREMENT'
+        //
+        // Concerns:
+        //    That the striped macros update the default striped collector of
+        //    the appropriate metric, statically cache the identified
+        //    collector, respect the supplied category's 'enabled' property,
+        //    and that the values they record are reported by
+        //    'collectAndReset'.
+        //
+        // Plan:
+        //   Verify that invoking the macros without a default metrics manager
+        //   has no effect.
+        //
+        //   Invoke the macros, enabling and disabling the category between
+        //   invocations, and verify the striped collectors against "oracle"
+        //   collectors.  Then verify that
+        //   'collectAndReset' reports, and resets, the collected values.
+        //
+        // Testing:
+        //    BALM_METRICS_STRIPED_UPDATE(CATEGORY, METRIC, VALUE)
+        //    BALM_METRICS_STRIPED_INT_UPDATE(CATEGORY, METRIC, VALUE)
+        //    BALM_METRICS_STRIPED_INCREMENT(CATEGORY, METRIC)
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING: STRIPED MACROS\n"
+                          << "=======================\n";
+
+        const int UPDATES[] = { 0, 12, -1321123, 2131241, 1321,
+                                43145, 1, -1, INT_MIN + 1, INT_MAX - 1 };
+        const int NUM_UPDATES = sizeof(UPDATES)/sizeof(*UPDATES);
+
+        if (veryVerbose)
+            cout << "\tverify macros are a no-op without a metrics manager.\n";
+        {
+            for (int i = 0; i < NUM_UPDATES; ++i) {
+                BALM_METRICS_STRIPED_UPDATE("S", "update", UPDATES[i]);
+                BALM_METRICS_STRIPED_INT_UPDATE("S", "intUpdate", UPDATES[i]);
+                BALM_METRICS_STRIPED_INCREMENT("S", "increment");
+            }
+        }
+
+        if (veryVerbose)
+            cout << "\tverify macros are applied correctly.\n";
+        {
+            BALM::DefaultMetricsManagerScopedGuard guard(Z);
+            BALM::MetricsManager& mgr = *DefaultManager::instance();
+            Registry&   registry   = mgr.metricRegistry();
+            Repository& repository = mgr.collectorRepository();
+
+            BALM::MetricId updateId(registry.getId("S", "update"));
+            BALM::MetricId intUpdateId(registry.getId("S", "intUpdate"));
+            BALM::MetricId incId(registry.getId("S", "increment"));
+
+            BALM::Collector        expUpdate(updateId);
+            BALM::IntegerCollector expIntUpdate(intUpdateId);
+            BALM::IntegerCollector expIncrement(incId);
+
+            for (int i = 0; i < NUM_UPDATES; ++i) {
+                bool enabled = 0 == i % 3;
+                registry.setCategoryEnabled(updateId.category(), enabled);
+                BALM_METRICS_STRIPED_UPDATE("S", "update", UPDATES[i]);
+                BALM_METRICS_STRIPED_INT_UPDATE("S", "intUpdate", UPDATES[i]);
+                BALM_METRICS_STRIPED_INCREMENT("S", "increment");
+                if (enabled) {
+                    expUpdate.update(UPDATES[i]);
+                    expIntUpdate.update(UPDATES[i]);
+                    expIncrement.update(1);
+                }
+            }
+            registry.setCategoryEnabled(updateId.category(), true);
+
+            BALM::MetricRecord record;
+            repository.getDefaultStripedCollector(updateId)->load(&record);
+            ASSERT(recordVal(&expUpdate) == record);
+
+            repository.getDefaultStripedIntegerCollector(intUpdateId)->load(
+                                                                     &record);
+            ASSERT(recordVal(&expIntUpdate) == record);
+
+            repository.getDefaultStripedIntegerCollector(incId)->load(
+                                                                     &record);
+            ASSERT(recordVal(&expIncrement) == record);
+
+            // Verify the striped values are reported and reset by
+            // 'collectAndReset'.
+
+            bsl::vector<BALM::MetricRecord> records(Z);
+            repository.collectAndReset(&records, updateId.category());
+            ASSERT(3 == records.size());
+            for (bsl::size_t i = 0; i < records.size(); ++i) {
+                const BALM::MetricRecord& R = records[i];
+                if (R.metricId() == updateId) {
+                    ASSERT(recordVal(&expUpdate) == R);
+                }
+                else if (R.metricId() == intUpdateId) {
+                    ASSERT(recordVal(&expIntUpdate) == R);
+                }
+                else {
+                    ASSERT(incId == R.metricId());
+                    ASSERT(recordVal(&expIncrement) == R);
+                }
+            }
+
+            repository.getDefaultStripedCollector(updateId)->load(&record);
+            ASSERT(BALM::MetricRecord(updateId) == record);
+        }
+      } break;
       case 19: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
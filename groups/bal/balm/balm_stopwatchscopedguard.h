@@ -18,7 +18,8 @@ BSLS_IDENT("$Id: $")
 //@CLASSES:
 // balm::StopwatchScopedGuard: guard for recording a metric for elapsed time
 //
-//@SEE_ALSO: balm_metricsmanager, balm_defaultmetricsmanager, balm_metric
+//@SEE_ALSO: balm_metricsmanager, balm_defaultmetricsmanager, balm_metric,
+//           balm_histogramcollector
 //
 //@DESCRIPTION: This component provides a scoped guard class intended to
 // simplify the task of recording (to a metric) the elapsed time of a block of
@@ -27,7 +28,11 @@ BSLS_IDENT("$Id: $")
 // units to report values in (by default, values are reported in seconds).  The
 // guard measures the elapsed time between its construction and destruction,
 // and on destruction records that elapsed time, in the indicated time units,
-// to the supplied metric.
+// to the supplied metric.  A guard may alternatively be supplied a
+// 'balm::HistogramCollector', in which case the elapsed time is rounded to the
+// nearest integral number of the indicated time units, so that the time units
+// should be chosen fine enough (e.g., microseconds) for the distribution of
+// elapsed times to be meaningful.
 //
 ///Alternative Systems for Telemetry
 ///---------------------------------
@@ -159,11 +164,13 @@ BSLS_IDENT("$Id: $")
 #include <balm_collector.h>
 #include <balm_collectorrepository.h>
 #include <balm_defaultmetricsmanager.h>
+#include <balm_histogramcollector.h>
 #include <balm_metric.h>
 #include <balm_metricsmanager.h>
 
 #include <bsls_platform.h>
 #include <bsls_stopwatch.h>
+#include <bsls_types.h>
 
 namespace BloombergLP {
 
@@ -220,6 +227,10 @@ class StopwatchScopedGuard {
     Collector *d_collector_p;  // metric collector (held, not owned); may
                                     // be 0, but cannot be invalid
 
+    HistogramCollector *d_histogram_p;
+                                    // histogram collector (held, not owned);
+                                    // may be 0, but cannot be invalid
+
     // NOT IMPLEMENTED
     StopwatchScopedGuard(const StopwatchScopedGuard&);
     StopwatchScopedGuard& operator=(const StopwatchScopedGuard&);
@@ -250,6 +261,18 @@ class StopwatchScopedGuard {
         // this guard, but does *not* affect the precision of the elapsed time
         // measurement.
 
+    explicit StopwatchScopedGuard(HistogramCollector *histogram,
+                                  Units               timeUnits = k_SECONDS);
+        // Initialize this scoped guard to record elapsed time using the
+        // specified 'histogram'.  Optionally specify the 'timeUnits' in which
+        // to report elapsed time.  If 'histogram' is 0 or
+        // 'histogram->metricId().category()->enabled() == false', this object
+        // will be inactive (i.e., will not record any values).  The behavior
+        // is undefined unless
+        // 'histogram == 0 || histogram->metricId().isValid()'.  Note that the
+        // elapsed time is rounded to the nearest integral number of
+        // 'timeUnits' when it is recorded.
+
     StopwatchScopedGuard(const MetricId&  metricId,
                          MetricsManager  *manager = 0);
     StopwatchScopedGuard(const MetricId&  metricId,
@@ -324,6 +347,7 @@ StopwatchScopedGuard::StopwatchScopedGuard(Metric *metric,
 : d_stopwatch()
 , d_timeUnits(timeUnits)
 , d_collector_p(metric->isActive() ? metric->collector() : 0)
+, d_histogram_p(0)
 {
     if (d_collector_p) {
         d_stopwatch.start();
@@ -338,18 +362,35 @@ StopwatchScopedGuard::StopwatchScopedGuard(Collector *collector,
 , d_collector_p((collector && collector->metricId().category()->enabled())
                 ? collector
                 : 0)
+, d_histogram_p(0)
 {
     if (d_collector_p) {
         d_stopwatch.start();
     }
 }
 
+inline
+StopwatchScopedGuard::StopwatchScopedGuard(HistogramCollector *histogram,
+                                           Units               timeUnits)
+: d_stopwatch()
+, d_timeUnits(timeUnits)
+, d_collector_p(0)
+, d_histogram_p((histogram && histogram->metricId().category()->enabled())
+                ? histogram
+                : 0)
+{
+    if (d_histogram_p) {
+        d_stopwatch.start();
+    }
+}
+
 inline
 StopwatchScopedGuard::StopwatchScopedGuard(const MetricId&  metricId,
                                            MetricsManager  *manager)
 : d_stopwatch()
 , d_timeUnits(k_SECONDS)
 , d_collector_p(0)
+, d_histogram_p(0)
 {
     Collector *collector = Metric::lookupCollector(metricId, manager);
     d_collector_p = (collector &&
@@ -367,6 +408,7 @@ StopwatchScopedGuard::StopwatchScopedGuard(const MetricId&  metricId,
 : d_stopwatch()
 , d_timeUnits(timeUnits)
 , d_collector_p(0)
+, d_histogram_p(0)
 {
     Collector *collector = Metric::lookupCollector(metricId, manager);
     d_collector_p = (collector &&
@@ -384,6 +426,7 @@ StopwatchScopedGuard::StopwatchScopedGuard(const char     *category,
 : d_stopwatch()
 , d_timeUnits(k_SECONDS)
 , d_collector_p(0)
+, d_histogram_p(0)
 {
     Collector *collector = Metric::lookupCollector(category, name, manager);
 
@@ -404,6 +447,7 @@ StopwatchScopedGuard::StopwatchScopedGuard(const char     *category,
 : d_stopwatch()
 , d_timeUnits(timeUnits)
 , d_collector_p(0)
+, d_histogram_p(0)
 {
     Collector *collector = Metric::lookupCollector(category, name, manager);
     d_collector_p = (collector && collector->metricId().category()->enabled())
@@ -417,7 +461,14 @@ inline
 StopwatchScopedGuard::~StopwatchScopedGuard()
 {
     if (isActive()) {
-        d_collector_p->update(d_stopwatch.elapsedTime() * d_timeUnits);
+        const double elapsed = d_stopwatch.elapsedTime() * d_timeUnits;
+        if (d_collector_p) {
+            d_collector_p->update(elapsed);
+        }
+        else {
+            d_histogram_p->update(
+                             static_cast<bsls::Types::Int64>(elapsed + 0.5));
+        }
     }
 }
 
@@ -425,8 +476,11 @@ StopwatchScopedGuard::~StopwatchScopedGuard()
 inline
 bool StopwatchScopedGuard::isActive() const
 {
-    return 0 != d_collector_p
-        && d_collector_p->metricId().category()->enabled();
+    if (d_collector_p) {
+        return d_collector_p->metricId().category()->enabled();       // RETURN
+    }
+    return 0 != d_histogram_p
+        && d_histogram_p->metricId().category()->enabled();
 }
 
 }  // close package namespace
@@ -0,0 +1,379 @@
+// balm_stripedcollector.cpp                                          -*-C++-*-
+#include <balm_stripedcollector.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balm_stripedcollector_cpp,"$Id$ $CSID$")
+
+#include <bslmt_threadlocalvariable.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomicoperations.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_climits.h>
+#include <bsl_cstring.h>
+
+///Implementation Notes
+///--------------------
+// A thread's stripe index is cached in a thread-local variable where the
+// platform supports one, so that 'stripeIndex' costs a single load after the
+// first call on a thread.  Otherwise the index is derived from a hash of the
+// thread id, which distributes threads across stripes without the
+// round-robin guarantee.
+//
+// Floating point values of 'StripedCollector' are stored as bit patterns in
+// 64-bit atomics.  The total is accumulated with a compare-and-swap loop; the
+// loop is uncontended unless more than 'k_NUM_STRIPES' threads update the
+// same collector.
+
+namespace BloombergLP {
+namespace {
+
+typedef bsls::AtomicOperations      AtomicOps;
+typedef balm::StripedCollector_Util Util;
+
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+// The stripe index of the current thread plus one, or 0 if the current thread
+// has not yet been assigned a stripe.
+BSLMT_THREAD_LOCAL_VARIABLE(int, g_stripeIndexPlusOne, 0)
+
+// The number of threads that have been assigned a stripe.
+AtomicOps::AtomicTypes::Int g_numAssignedStripes = { 0 };
+#endif
+
+inline
+void updateMin(bsls::AtomicUint64 *min, double value)
+    // Set the value (represented as a bit pattern) at the specified 'min' to
+    // the specified 'value' if 'value' is less than that value.
+{
+    bsls::Types::Uint64 bits = min->loadRelaxed();
+    while (value < Util::fromBits(bits)) {
+        const bsls::Types::Uint64 prev =
+                             min->testAndSwapAcqRel(bits, Util::toBits(value));
+        if (prev == bits) {
+            break;
+        }
+        bits = prev;
+    }
+}
+
+inline
+void updateMax(bsls::AtomicUint64 *max, double value)
+    // Set the value (represented as a bit pattern) at the specified 'max' to
+    // the specified 'value' if 'value' is greater than that value.
+{
+    bsls::Types::Uint64 bits = max->loadRelaxed();
+    while (value > Util::fromBits(bits)) {
+        const bsls::Types::Uint64 prev =
+                             max->testAndSwapAcqRel(bits, Util::toBits(value));
+        if (prev == bits) {
+            break;
+        }
+        bits = prev;
+    }
+}
+
+}  // close unnamed namespace
+
+namespace balm {
+
+                       // ----------------------------
+                       // struct StripedCollector_Util
+                       // ----------------------------
+
+// CLASS METHODS
+int StripedCollector_Util::stripeIndex()
+{
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+    int indexPlusOne = g_stripeIndexPlusOne;
+    if (0 == indexPlusOne) {
+        const int n = AtomicOps::addIntNvRelaxed(&g_numAssignedStripes, 1);
+        indexPlusOne = ((n - 1) & (k_NUM_STRIPES - 1)) + 1;
+        g_stripeIndexPlusOne = indexPlusOne;
+    }
+    return indexPlusOne - 1;
+#else
+    bsls::Types::Uint64 id = bslmt::ThreadUtil::selfIdAsUint64();
+    id ^= id >> 33;
+    id *= 0xff51afd7ed558ccdULL;
+    id ^= id >> 33;
+    return static_cast<int>(id & (k_NUM_STRIPES - 1));
+#endif
+}
+
+bsls::Types::Uint64 Util::toBits(double value)
+{
+    bsls::Types::Uint64 bits;
+    bsl::memcpy(&bits, &value, sizeof bits);
+    return bits;
+}
+
+double Util::fromBits(bsls::Types::Uint64 bits)
+{
+    double value;
+    bsl::memcpy(&value, &bits, sizeof value);
+    return value;
+}
+
+                           // ----------------------
+                           // class StripedCollector
+                           // ----------------------
+
+// CREATORS
+StripedCollector::StripedCollector(const MetricId& metricId)
+: d_metricId(metricId)
+{
+    reset();
+}
+
+// MANIPULATORS
+void StripedCollector::reset()
+{
+    const bsls::Types::Uint64 zero = Util::toBits(0.0);
+    const bsls::Types::Uint64 defaultMin =
+                                     Util::toBits(MetricRecord::k_DEFAULT_MIN);
+    const bsls::Types::Uint64 defaultMax =
+                                     Util::toBits(MetricRecord::k_DEFAULT_MAX);
+
+    for (int i = 0; i < StripedCollector_Util::k_NUM_STRIPES; ++i) {
+        Stripe& stripe = d_stripes[i];
+        stripe.d_count = 0;
+        stripe.d_total = zero;
+        stripe.d_min   = defaultMin;
+        stripe.d_max   = defaultMax;
+    }
+}
+
+void StripedCollector::loadAndReset(MetricRecord *record)
+{
+    const bsls::Types::Uint64 zero = Util::toBits(0.0);
+    const bsls::Types::Uint64 defaultMin =
+                                     Util::toBits(MetricRecord::k_DEFAULT_MIN);
+    const bsls::Types::Uint64 defaultMax =
+                                     Util::toBits(MetricRecord::k_DEFAULT_MAX);
+
+    int    count = 0;
+    double total = 0.0;
+    double min   = MetricRecord::k_DEFAULT_MIN;
+    double max   = MetricRecord::k_DEFAULT_MAX;
+
+    for (int i = 0; i < StripedCollector_Util::k_NUM_STRIPES; ++i) {
+        Stripe& stripe = d_stripes[i];
+        count += stripe.d_count.swapAcqRel(0);
+        total += Util::fromBits(stripe.d_total.swapAcqRel(zero));
+        min    = bsl::min(min,
+                          Util::fromBits(stripe.d_min.swapAcqRel(defaultMin)));
+        max    = bsl::max(max,
+                          Util::fromBits(stripe.d_max.swapAcqRel(defaultMax)));
+    }
+
+    record->metricId() = d_metricId;
+    record->count()    = count;
+    record->total()    = total;
+    record->min()      = min;
+    record->max()      = max;
+}
+
+void StripedCollector::accumulateCountTotalMinMax(int    count,
+                                                  double total,
+                                                  double min,
+                                                  double max)
+{
+    Stripe& stripe = d_stripes[StripedCollector_Util::stripeIndex()];
+
+    stripe.d_count.addRelaxed(count);
+
+    bsls::Types::Uint64 bits = stripe.d_total.loadRelaxed();
+    while (true) {
+        const bsls::Types::Uint64 sum  = Util::toBits(Util::fromBits(bits)
+                                                                     + total);
+        const bsls::Types::Uint64 prev = stripe.d_total.testAndSwapAcqRel(bits,
+                                                                          sum);
+        if (prev == bits) {
+            break;
+        }
+        bits = prev;
+    }
+
+    updateMin(&stripe.d_min, min);
+    updateMax(&stripe.d_max, max);
+}
+
+void StripedCollector::setCountTotalMinMax(int    count,
+                                           double total,
+                                           double min,
+                                           double max)
+{
+    reset();
+
+    Stripe& stripe = d_stripes[0];
+    stripe.d_count = count;
+    stripe.d_total = Util::toBits(total);
+    stripe.d_min   = Util::toBits(min);
+    stripe.d_max   = Util::toBits(max);
+}
+
+// ACCESSORS
+void StripedCollector::load(MetricRecord *record) const
+{
+    int    count = 0;
+    double total = 0.0;
+    double min   = MetricRecord::k_DEFAULT_MIN;
+    double max   = MetricRecord::k_DEFAULT_MAX;
+
+    for (int i = 0; i < StripedCollector_Util::k_NUM_STRIPES; ++i) {
+        const Stripe& stripe = d_stripes[i];
+        count += stripe.d_count.loadAcquire();
+        total += Util::fromBits(stripe.d_total.loadAcquire());
+        min    = bsl::min(min, Util::fromBits(stripe.d_min.loadAcquire()));
+        max    = bsl::max(max, Util::fromBits(stripe.d_max.loadAcquire()));
+    }
+
+    record->metricId() = d_metricId;
+    record->count()    = count;
+    record->total()    = total;
+    record->min()      = min;
+    record->max()      = max;
+}
+
+                        // -----------------------------
+                        // class StripedIntegerCollector
+                        // -----------------------------
+
+// PUBLIC CONSTANTS
+const int StripedIntegerCollector::k_DEFAULT_MIN = INT_MAX;
+const int StripedIntegerCollector::k_DEFAULT_MAX = INT_MIN;
+
+// CREATORS
+StripedIntegerCollector::StripedIntegerCollector(const MetricId& metricId)
+: d_metricId(metricId)
+{
+    reset();
+}
+
+// MANIPULATORS
+void StripedIntegerCollector::reset()
+{
+    for (int i = 0; i < StripedCollector_Util::k_NUM_STRIPES; ++i) {
+        Stripe& stripe = d_stripes[i];
+        stripe.d_count = 0;
+        stripe.d_total = 0;
+        stripe.d_min   = k_DEFAULT_MIN;
+        stripe.d_max   = k_DEFAULT_MAX;
+    }
+}
+
+void StripedIntegerCollector::loadAndReset(MetricRecord *record)
+{
+    int                count = 0;
+    bsls::Types::Int64 total = 0;
+    int                min   = k_DEFAULT_MIN;
+    int                max   = k_DEFAULT_MAX;
+
+    for (int i = 0; i < StripedCollector_Util::k_NUM_STRIPES; ++i) {
+        Stripe& stripe = d_stripes[i];
+        count += stripe.d_count.swapAcqRel(0);
+        total += stripe.d_total.swapAcqRel(0);
+        min    = bsl::min(min, stripe.d_min.swapAcqRel(k_DEFAULT_MIN));
+        max    = bsl::max(max, stripe.d_max.swapAcqRel(k_DEFAULT_MAX));
+    }
+
+    record->metricId() = d_metricId;
+    record->count()    = count;
+    record->total()    = static_cast<double>(total);
+    record->min()      = (k_DEFAULT_MIN == min)
+                       ? MetricRecord::k_DEFAULT_MIN
+                       : min;
+    record->max()      = (k_DEFAULT_MAX == max)
+                       ? MetricRecord::k_DEFAULT_MAX
+                       : max;
+}
+
+void StripedIntegerCollector::accumulateCountTotalMinMax(int count,
+                                                         int total,
+                                                         int min,
+                                                         int max)
+{
+    Stripe& stripe = d_stripes[StripedCollector_Util::stripeIndex()];
+
+    stripe.d_count.addRelaxed(count);
+    stripe.d_total.addRelaxed(total);
+
+    int current = stripe.d_min.loadRelaxed();
+    while (min < current) {
+        const int prev = stripe.d_min.testAndSwapAcqRel(current, min);
+        if (prev == current) {
+            break;
+        }
+        current = prev;
+    }
+
+    current = stripe.d_max.loadRelaxed();
+    while (max > current) {
+        const int prev = stripe.d_max.testAndSwapAcqRel(current, max);
+        if (prev == current) {
+            break;
+        }
+        current = prev;
+    }
+}
+
+void StripedIntegerCollector::setCountTotalMinMax(int count,
+                                                  int total,
+                                                  int min,
+                                                  int max)
+{
+    reset();
+
+    Stripe& stripe = d_stripes[0];
+    stripe.d_count = count;
+    stripe.d_total = total;
+    stripe.d_min   = min;
+    stripe.d_max   = max;
+}
+
+// ACCESSORS
+void StripedIntegerCollector::load(MetricRecord *record) const
+{
+    int                count = 0;
+    bsls::Types::Int64 total = 0;
+    int                min   = k_DEFAULT_MIN;
+    int                max   = k_DEFAULT_MAX;
+
+    for (int i = 0; i < StripedCollector_Util::k_NUM_STRIPES; ++i) {
+        const Stripe& stripe = d_stripes[i];
+        count += stripe.d_count.loadAcquire();
+        total += stripe.d_total.loadAcquire();
+        min    = bsl::min(min, stripe.d_min.loadAcquire());
+        max    = bsl::max(max, stripe.d_max.loadAcquire());
+    }
+
+    record->metricId() = d_metricId;
+    record->count()    = count;
+    record->total()    = static_cast<double>(total);
+    record->min()      = (k_DEFAULT_MIN == min)
+                       ? MetricRecord::k_DEFAULT_MIN
+                       : min;
+    record->max()      = (k_DEFAULT_MAX == max)
+                       ? MetricRecord::k_DEFAULT_MAX
+                       : max;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,424 @@
+// balm_stripedcollector.h                                            -*-C++-*-
+#ifndef INCLUDED_BALM_STRIPEDCOLLECTOR
+#define INCLUDED_BALM_STRIPEDCOLLECTOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide low-contention collectors using per-thread atomic stripes.
+//
+//@CLASSES:
+//   balm::StripedCollector: low-contention collector of 'double' values
+//   balm::StripedIntegerCollector: low-contention collector of 'int' values
+//
+//@SEE_ALSO: balm_collector, balm_integercollector, balm_collectorrepository,
+//           balm_metrics
+//
+//@DESCRIPTION: This component provides two classes,
+// 'balm::StripedCollector' and 'balm::StripedIntegerCollector', that collect
+// and aggregate the values of a metric in the same way as 'balm::Collector'
+// and 'balm::IntegerCollector' respectively, but without a mutex.  Each
+// collector holds a fixed number of *stripes*, each occupying its own cache
+// line and holding an atomic count, total, minimum, and maximum.  Each thread
+// is assigned a stripe (round-robin, the first time it updates any striped
+// collector), and 'update' modifies only the stripe of the calling thread
+// using relaxed atomic operations.  The stripes are combined only when a
+// 'balm::MetricRecord' is loaded from the collector.
+//
+// Compared to 'balm::Collector' and 'balm::IntegerCollector', an update on a
+// striped collector is considerably cheaper when many threads update the same
+// metric, at the cost of a larger footprint ('k_NUM_STRIPES' cache lines per
+// collector) and a more expensive 'load'.  Striped collectors are therefore
+// intended for a small number of metrics updated on hot paths; the
+// 'BALM_METRICS_STRIPED_*' macros of 'balm_metrics' update the striped
+// collectors managed by a 'balm::CollectorRepository'.
+//
+///Thread Safety
+///-------------
+// 'balm::StripedCollector' and 'balm::StripedIntegerCollector' are fully
+// *thread-safe*, meaning that all non-creator operations on a given instance
+// can be safely invoked simultaneously from multiple threads.  Note, however,
+// that unlike the mutex-based collectors, 'load' and 'loadAndReset' do not
+// take an atomic snapshot of the collector: an update performed concurrently
+// with 'loadAndReset' may have its contribution to the count, total, minimum,
+// and maximum reported in different collection intervals, and
+// 'setCountTotalMinMax' is not atomic with respect to concurrent updates.
+// Every update is reported exactly once.
+//
+///Usage
+///-----
+// The following example creates a 'balm::StripedIntegerCollector', updates
+// it from several threads, then collects a 'balm::MetricRecord'.
+//
+// We start by creating a 'balm::MetricId' object by hand; however, in
+// practice an id should be obtained from a 'balm::MetricRegistry' object (such
+// as the one owned by a 'balm::MetricsManager'):
+//..
+//  balm::Category           myCategory("MyCategory");
+//  balm::MetricDescription  description(&myCategory, "MyMetric");
+//  balm::MetricId           myMetric(&description);
+//..
+// Then we create a 'balm::StripedIntegerCollector' for 'myMetric':
+//..
+//  balm::StripedIntegerCollector collector(myMetric);
+//..
+// Next, we define a function that records a number of events and create a
+// group of threads that call it concurrently:
+//..
+//  extern "C" void *recordEvents(void *arg)
+//  {
+//      typedef balm::StripedIntegerCollector Collector;
+//      Collector *collector = static_cast<Collector *>(arg);
+//      for (int i = 1; i <= 100; ++i) {
+//          collector->update(i);
+//      }
+//      return 0;
+//  }
+//
+//  bslmt::ThreadUtil::Handle handles[4];
+//  for (int i = 0; i < 4; ++i) {
+//      bslmt::ThreadUtil::create(&handles[i], recordEvents, &collector);
+//  }
+//  for (int i = 0; i < 4; ++i) {
+//      bslmt::ThreadUtil::join(handles[i]);
+//  }
+//..
+// Finally, we collect the aggregated values.  Although each thread updated
+// its own stripe, the record combines the values of all the stripes:
+//..
+//  balm::MetricRecord record;
+//  collector.loadAndReset(&record);
+//
+//  assert(myMetric  == record.metricId());
+//  assert(400       == record.count());
+//  assert(4 * 5050  == record.total());
+//  assert(1         == record.min());
+//  assert(100       == record.max());
+//..
+
+#include <balscm_version.h>
+
+#include <balm_metricid.h>
+#include <balm_metricrecord.h>
+
+#include <bslmt_platform.h>
+
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace balm {
+
+                       // ============================
+                       // struct StripedCollector_Util
+                       // ============================
+
+struct StripedCollector_Util {
+    // This component-private 'struct' provides a namespace for utilities
+    // shared by the striped collectors of this component.
+
+    // PUBLIC CONSTANTS
+    enum {
+        k_NUM_STRIPES = 16  // number of stripes in each striped collector
+    };
+
+    // CLASS METHODS
+    static int stripeIndex();
+        // Return the index, in the range '[0 .. k_NUM_STRIPES - 1]', of the
+        // stripe assigned to the calling thread.  Stripes are assigned to
+        // threads in round-robin order the first time this method is called
+        // from a thread.
+
+    static bsls::Types::Uint64 toBits(double value);
+        // Return the bit pattern of the specified 'value'.
+
+    static double fromBits(bsls::Types::Uint64 bits);
+        // Return the 'double' value having the specified 'bits' pattern.
+};
+
+                           // ======================
+                           // class StripedCollector
+                           // ======================
+
+class StripedCollector {
+    // This class provides a mechanism for collecting and aggregating the
+    // value of a metric over a period of time, without a mutex, by
+    // accumulating the values into per-thread stripes.  The default value for
+    // the count is 0, the default value for the total is 0.0, the default
+    // minimum value is 'MetricRecord::k_DEFAULT_MIN', and the default maximum
+    // value is 'MetricRecord::k_DEFAULT_MAX'.
+
+    // PRIVATE TYPES
+    struct Stripe {
+        // The aggregated values updated by the threads assigned to a stripe.
+        // Floating point values are stored as their bit patterns.
+
+        // DATA
+        bsls::AtomicInt    d_count;   // aggregated count of events
+        bsls::AtomicUint64 d_total;   // total of values across events
+        bsls::AtomicUint64 d_min;     // minimum value across events
+        bsls::AtomicUint64 d_max;     // maximum value across events
+        char               d_pad[bslmt::Platform::e_CACHE_LINE_SIZE];
+                                      // padding to prevent false sharing
+    };
+
+    // DATA
+    MetricId d_metricId;                                   // metric id
+    Stripe   d_stripes[StripedCollector_Util::k_NUM_STRIPES];
+                                                           // stripes
+
+    // NOT IMPLEMENTED
+    StripedCollector(const StripedCollector&);
+    StripedCollector& operator=(const StripedCollector&);
+
+  public:
+    // CREATORS
+    explicit StripedCollector(const MetricId& metricId);
+        // Create a striped collector for a metric having the specified
+        // 'metricId', and having an initial count of 0, total of 0.0, min of
+        // 'MetricRecord::k_DEFAULT_MIN', and max of
+        // 'MetricRecord::k_DEFAULT_MAX'.
+
+    ~StripedCollector();
+        // Destroy this object.
+
+    // MANIPULATORS
+    void reset();
+        // Reset the count, total, minimum, and maximum values of the metric
+        // being collected to their default states.
+
+    void loadAndReset(MetricRecord *record);
+        // Load into the specified 'record' the id of the metric being
+        // collected as well as the current count, total, minimum, and maximum
+        // aggregated values for that metric; then reset the count, total,
+        // minimum, and maximum values to their default states.  Each stripe
+        // is read and reset atomically, but stripes are not all read at the
+        // same instant (see {Thread Safety}).
+
+    void update(double value);
+        // Increment the event count by 1, add the specified 'value' to the
+        // total, if 'value' is less than the minimum value, set 'value' to be
+        // the minimum value, and if 'value' is greater than the maximum
+        // value, set 'value' to be the maximum value.
+
+    void accumulateCountTotalMinMax(int    count,
+                                    double total,
+                                    double min,
+                                    double max);
+        // Increment the event count by the specified 'count', add the
+        // specified 'total' to the accumulated total, and if the specified
+        // 'min' is less than the minimum value, set 'min' to be the minimum
+        // value, and if the specified 'max' is greater than the maximum value,
+        // set 'max' to be the maximum value.
+
+    void setCountTotalMinMax(int count, double total, double min, double max);
+        // Set the event count to the specified 'count', the total aggregate to
+        // the specified 'total', the minimum aggregate to the specified 'min'
+        // and the maximum aggregate to the specified 'max'.  Note that this
+        // operation is not atomic with respect to concurrent updates.
+
+    // ACCESSORS
+    const MetricId& metricId() const;
+        // Return a reference to the non-modifiable 'MetricId' object
+        // identifying the metric for which this object collects values.
+
+    void load(MetricRecord *record) const;
+        // Load into the specified 'record' the id of the metric being
+        // collected, as well as the current count, total, minimum, and
+        // maximum aggregated values for the metric.
+};
+
+                        // =============================
+                        // class StripedIntegerCollector
+                        // =============================
+
+class StripedIntegerCollector {
+    // This class provides a mechanism for collecting and aggregating the
+    // value of an integer metric over a period of time, without a mutex, by
+    // accumulating the values into per-thread stripes.  The default value for
+    // the count is 0, the default value for the total is 0, the default value
+    // for the minimum is 'k_DEFAULT_MIN', and the default value for the
+    // maximum is 'k_DEFAULT_MAX'.
+
+    // PRIVATE TYPES
+    struct Stripe {
+        // The aggregated values updated by the threads assigned to a stripe.
+
+        // DATA
+        bsls::AtomicInt   d_count;  // aggregated count of events
+        bsls::AtomicInt   d_min;    // minimum value across events
+        bsls::AtomicInt   d_max;    // maximum value across events
+        bsls::AtomicInt64 d_total;  // total of values across events
+        char              d_pad[bslmt::Platform::e_CACHE_LINE_SIZE];
+                                    // padding to prevent false sharing
+    };
+
+    // DATA
+    MetricId d_metricId;                                   // metric id
+    Stripe   d_stripes[StripedCollector_Util::k_NUM_STRIPES];
+                                                           // stripes
+
+    // NOT IMPLEMENTED
+    StripedIntegerCollector(const StripedIntegerCollector&);
+    StripedIntegerCollector& operator=(const StripedIntegerCollector&);
+
+  public:
+    // PUBLIC CONSTANTS
+    static const int k_DEFAULT_MIN;  // default minimum value (INT_MAX)
+    static const int k_DEFAULT_MAX;  // default maximum value (INT_MIN)
+
+    // CREATORS
+    explicit StripedIntegerCollector(const MetricId& metricId);
+        // Create a striped integer collector for a metric having the
+        // specified 'metricId', and having an initial count of 0, total of 0,
+        // min of 'k_DEFAULT_MIN', and max of 'k_DEFAULT_MAX'.
+
+    ~StripedIntegerCollector();
+        // Destroy this object.
+
+    // MANIPULATORS
+    void reset();
+        // Reset the count, total, minimum, and maximum values of the metric
+        // being collected to their default states.
+
+    void loadAndReset(MetricRecord *record);
+        // Load into the specified 'record' the id of the metric being
+        // collected as well as the current count, total, minimum, and maximum
+        // aggregated values for that metric; then reset the count, total,
+        // minimum, and maximum values to their default states.  Each stripe
+        // is read and reset atomically, but stripes are not all read at the
+        // same instant (see {Thread Safety}).  A minimum value of
+        // 'k_DEFAULT_MIN' will populate a minimum value of
+        // 'MetricRecord::k_DEFAULT_MIN' and a maximum value of
+        // 'k_DEFAULT_MAX' will populate a maximum value of
+        // 'MetricRecord::k_DEFAULT_MAX'.
+
+    void update(int value);
+        // Increment the event count by 1, add the specified 'value' to the
+        // total, if 'value' is less than the minimum value, set 'value' to be
+        // the minimum value, and if 'value' is greater than the maximum
+        // value, set 'value' to be the maximum value.
+
+    void accumulateCountTotalMinMax(int count, int total, int min, int max);
+        // Increment the event count by the specified 'count', add the
+        // specified 'total' to the accumulated total, and if the specified
+        // 'min' is less than the minimum value, set 'min' to be the minimum
+        // value, and if the specified 'max' is greater than the maximum value,
+        // set 'max' to be the maximum value.
+
+    void setCountTotalMinMax(int count, int total, int min, int max);
+        // Set the event count to the specified 'count', the total aggregate to
+        // the specified 'total', the minimum aggregate to the specified 'min'
+        // and the maximum aggregate to the specified 'max'.  Note that this
+        // operation is not atomic with respect to concurrent updates.
+
+    // ACCESSORS
+    const MetricId& metricId() const;
+        // Return a reference to the non-modifiable 'MetricId' object
+        // identifying the metric for which this object collects values.
+
+    void load(MetricRecord *record) const;
+        // Load into the specified 'record' the id of the metric being
+        // collected, as well as the current count, total, minimum, and
+        // maximum aggregated values for the metric.  A minimum value of
+        // 'k_DEFAULT_MIN' will populate a minimum value of
+        // 'MetricRecord::k_DEFAULT_MIN' and a maximum value of
+        // 'k_DEFAULT_MAX' will populate a maximum value of
+        // 'MetricRecord::k_DEFAULT_MAX'.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                           // ----------------------
+                           // class StripedCollector
+                           // ----------------------
+
+// CREATORS
+inline
+StripedCollector::~StripedCollector()
+{
+}
+
+// MANIPULATORS
+inline
+void StripedCollector::update(double value)
+{
+    accumulateCountTotalMinMax(1, value, value, value);
+}
+
+// ACCESSORS
+inline
+const MetricId& StripedCollector::metricId() const
+{
+    return d_metricId;
+}
+
+                        // -----------------------------
+                        // class StripedIntegerCollector
+                        // -----------------------------
+
+// CREATORS
+inline
+StripedIntegerCollector::~StripedIntegerCollector()
+{
+}
+
+// MANIPULATORS
+inline
+void StripedIntegerCollector::update(int value)
+{
+    Stripe& stripe = d_stripes[StripedCollector_Util::stripeIndex()];
+
+    stripe.d_count.addRelaxed(1);
+    stripe.d_total.addRelaxed(value);
+
+    // Avoid writing to the stripe unless the minimum or maximum changes.
+
+    int min = stripe.d_min.loadRelaxed();
+    while (value < min) {
+        const int prev = stripe.d_min.testAndSwapAcqRel(min, value);
+        if (prev == min) {
+            break;
+        }
+        min = prev;
+    }
+
+    int max = stripe.d_max.loadRelaxed();
+    while (value > max) {
+        const int prev = stripe.d_max.testAndSwapAcqRel(max, value);
+        if (prev == max) {
+            break;
+        }
+        max = prev;
+    }
+}
+
+// ACCESSORS
+inline
+const MetricId& StripedIntegerCollector::metricId() const
+{
+    return d_metricId;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,710 @@
+// balm_stripedcollector.t.cpp                                        -*-C++-*-
+#include <balm_stripedcollector.h>
+
+#include <balm_category.h>
+#include <balm_metricdescription.h>
+
+#include <bslim_testutil.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_climits.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+
+using namespace BloombergLP;
+
+using bsl::cout;
+using bsl::endl;
+using bsl::flush;
+
+// ============================================================================
+//                                 TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// 'balm::StripedCollector' and 'balm::StripedIntegerCollector' are mechanisms
+// for collecting and recording aggregated metric values.  Ensure values can
+// be accumulated into and read out of the collectors, that values recorded on
+// different threads (and therefore different stripes) are combined, and that
+// no update is lost or reported twice when collection races with updates.
+// ----------------------------------------------------------------------------
+// balm::StripedCollector_Util
+// [ 2] int stripeIndex();
+//
+// balm::StripedCollector
+// [ 3] balm::StripedCollector(const balm::MetricId& metricId);
+// [ 3] ~balm::StripedCollector();
+// [ 4] void reset();
+// [ 4] void loadAndReset(balm::MetricRecord *record);
+// [ 3] void update(double value);
+// [ 4] void accumulateCountTotalMinMax(int, double, double, double);
+// [ 4] void setCountTotalMinMax(int, double, double, double);
+// [ 3] const balm::MetricId& metricId() const;
+// [ 3] void load(balm::MetricRecord *record) const;
+//
+// balm::StripedIntegerCollector
+// [ 3] balm::StripedIntegerCollector(const balm::MetricId& metricId);
+// [ 3] ~balm::StripedIntegerCollector();
+// [ 4] void reset();
+// [ 4] void loadAndReset(balm::MetricRecord *record);
+// [ 3] void update(int value);
+// [ 4] void accumulateCountTotalMinMax(int, int, int, int);
+// [ 4] void setCountTotalMinMax(int, int, int, int);
+// [ 3] const balm::MetricId& metricId() const;
+// [ 3] void load(balm::MetricRecord *record) const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] CONCURRENCY TEST
+// [ 6] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balm::StripedCollector        Obj;
+typedef balm::StripedIntegerCollector IntObj;
+typedef balm::StripedCollector_Util   Util;
+typedef balm::MetricRecord            Rec;
+typedef balm::MetricDescription       Desc;
+typedef balm::MetricId                Id;
+
+// ============================================================================
+//                      GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+enum {
+    k_NUM_THREADS            = 2 * Util::k_NUM_STRIPES + 3,
+    k_NUM_UPDATES_PER_THREAD = 20000
+};
+
+struct ConcurrencyArgs {
+    // Arguments shared by the threads of the concurrency test.
+
+    Obj             *d_collector_p;
+    IntObj          *d_intCollector_p;
+    bslmt::Barrier  *d_barrier_p;
+    int              d_threadIndex;
+};
+
+extern "C" void *updateCollectors(void *arg)
+    // Update the collectors identified by the specified 'arg', which must be
+    // the address of a 'ConcurrencyArgs' object, with the values
+    // '1 .. k_NUM_UPDATES_PER_THREAD' offset by the thread index.
+{
+    ConcurrencyArgs *args = static_cast<ConcurrencyArgs *>(arg);
+
+    args->d_barrier_p->wait();
+
+    for (int i = 1; i <= k_NUM_UPDATES_PER_THREAD; ++i) {
+        args->d_intCollector_p->update(i + args->d_threadIndex);
+        args->d_collector_p->update(1.0);
+    }
+    return 0;
+}
+
+struct StripeIndexArgs {
+    // Arguments for the threads of the 'stripeIndex' test.
+
+    int            d_index;
+    bslmt::Barrier *d_barrier_p;
+};
+
+extern "C" void *recordStripeIndex(void *arg)
+    // Load the stripe index of the current thread into the object at the
+    // specified 'arg', which must be the address of a 'StripeIndexArgs'
+    // object, and verify that the index does not change.
+{
+    StripeIndexArgs *args = static_cast<StripeIndexArgs *>(arg);
+
+    args->d_index = Util::stripeIndex();
+    ASSERT(args->d_index == Util::stripeIndex());
+
+    // Keep all threads alive until each has obtained an index.
+
+    args->d_barrier_p->wait();
+    return 0;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+extern "C" void *recordEvents(void *arg)
+{
+    typedef balm::StripedIntegerCollector Collector;
+    Collector *collector = static_cast<Collector *>(arg);
+    for (int i = 1; i <= 100; ++i) {
+        collector->update(i);
+    }
+    return 0;
+}
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int            test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    bool        verbose = argc > 2;
+    bool    veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    balm::Category cat_A("A", true);
+    Desc desc_A(&cat_A, "A"); const Desc *DESC_A = &desc_A;
+    Desc desc_B(&cat_A, "B"); const Desc *DESC_B = &desc_B;
+    Desc desc_C(&cat_A, "C"); const Desc *DESC_C = &desc_C;
+
+    Id metric_A(DESC_A); const Id& METRIC_A = metric_A;
+    Id metric_B(DESC_B); const Id& METRIC_B = metric_B;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        balm::Category           myCategory("MyCategory");
+        balm::MetricDescription  description(&myCategory, "MyMetric");
+        balm::MetricId           myMetric(&description);
+
+        balm::StripedIntegerCollector collector(myMetric);
+
+        bslmt::ThreadUtil::Handle handles[4];
+        for (int i = 0; i < 4; ++i) {
+            bslmt::ThreadUtil::create(&handles[i], recordEvents, &collector);
+        }
+        for (int i = 0; i < 4; ++i) {
+            bslmt::ThreadUtil::join(handles[i]);
+        }
+
+        balm::MetricRecord record;
+        collector.loadAndReset(&record);
+
+        ASSERT(myMetric  == record.metricId());
+        ASSERT(400       == record.count());
+        ASSERT(4 * 5050  == record.total());
+        ASSERT(1         == record.min());
+        ASSERT(100       == record.max());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY TEST
+        //
+        // Concerns:
+        //: 1 Values updated concurrently by more threads than there are
+        //:   stripes are all recorded.
+        //:
+        //: 2 Each update is reported by exactly one of a series of
+        //:   'loadAndReset' calls made concurrently with the updates.
+        //
+        // Plan:
+        //: 1 Start more threads than there are stripes, each updating a
+        //:   striped collector and a striped integer collector with known
+        //:   values, while the main thread repeatedly calls 'loadAndReset' and
+        //:   sums the results.  After joining the threads, collect the
+        //:   remaining values and verify the sums against the expected
+        //:   aggregates.  (C-1..2)
+        //
+        // Testing:
+        //   CONCURRENCY TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY TEST" << endl
+                          << "================" << endl;
+
+        Obj    mX(METRIC_A);
+        IntObj mY(METRIC_B);
+
+        bslmt::Barrier            barrier(k_NUM_THREADS + 1);
+        ConcurrencyArgs           args[k_NUM_THREADS];
+        bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            args[i].d_collector_p    = &mX;
+            args[i].d_intCollector_p = &mY;
+            args[i].d_barrier_p      = &barrier;
+            args[i].d_threadIndex    = i;
+            ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                  updateCollectors,
+                                                  &args[i]));
+        }
+
+        bsls::Types::Int64 count    = 0;
+        bsls::Types::Int64 total    = 0;
+        double             dblTotal = 0.0;
+        double             min      = Rec::k_DEFAULT_MIN;
+        double             max      = Rec::k_DEFAULT_MAX;
+
+        barrier.wait();
+
+        for (int i = 0; i < 100; ++i) {
+            Rec r1, r2;
+            mX.loadAndReset(&r1);
+            mY.loadAndReset(&r2);
+            dblTotal += r1.total();
+            count    += r2.count();
+            total    += static_cast<bsls::Types::Int64>(r2.total());
+            min       = bsl::min(min, r2.min());
+            max       = bsl::max(max, r2.max());
+            bslmt::ThreadUtil::yield();
+        }
+
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+        }
+
+        Rec r1, r2;
+        mX.loadAndReset(&r1);
+        mY.loadAndReset(&r2);
+        dblTotal += r1.total();
+        count    += r2.count();
+        total    += static_cast<bsls::Types::Int64>(r2.total());
+        min       = bsl::min(min, r2.min());
+        max       = bsl::max(max, r2.max());
+
+        const bsls::Types::Int64 N = k_NUM_UPDATES_PER_THREAD;
+        const bsls::Types::Int64 T = k_NUM_THREADS;
+
+        bsls::Types::Int64 expectedTotal = T * (N * (N + 1) / 2);
+        expectedTotal += N * (T * (T - 1) / 2);
+
+        ASSERTV(count,    T * N         == count);
+        ASSERTV(total,    expectedTotal == total);
+        ASSERTV(dblTotal, T * N         == dblTotal);
+        ASSERTV(min,      1             == min);
+        ASSERTV(max,      N + T - 1     == max);
+
+        if (veryVerbose) {
+            P_(count) P_(total) P_(dblTotal) P_(min) P(max);
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING MANIPULATORS
+        //
+        // Concerns:
+        //: 1 'setCountTotalMinMax' sets the aggregates as if by a single
+        //:   stripe, discarding values in every other stripe.
+        //:
+        //: 2 'accumulateCountTotalMinMax' combines its arguments with the
+        //:   current aggregates.
+        //:
+        //: 3 'loadAndReset' loads the same values as 'load', then resets the
+        //:   collector, and 'reset' resets the collector.
+        //
+        // Plan:
+        //: 1 Using a table of values, set, accumulate, load, and reset
+        //:   striped collectors and striped integer collectors, verifying the
+        //:   loaded values at each step.  (C-1..3)
+        //
+        // Testing:
+        //   void reset();
+        //   void loadAndReset(balm::MetricRecord *record);
+        //   void accumulateCountTotalMinMax(int, double, double, double);
+        //   void setCountTotalMinMax(int, double, double, double);
+        //   void accumulateCountTotalMinMax(int, int, int, int);
+        //   void setCountTotalMinMax(int, int, int, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING MANIPULATORS" << endl
+                          << "====================" << endl;
+
+        static const struct {
+            int d_line;
+            int d_count;
+            int d_total;
+            int d_min;
+            int d_max;
+        } DATA[] = {
+            //LINE  COUNT    TOTAL        MIN          MAX
+            //----  -------  -------      -----------  -----------
+            { L_,         0,       0,           0,           0 },
+            { L_,         1,       1,           1,           1 },
+            { L_,         1,       2,           3,           4 },
+            { L_,        -1,      -2,          -3,          -4 },
+            { L_,    100000, 2000000,     3000000,     4000000 },
+            { L_,   INT_MAX, INT_MAX, INT_MIN + 1, INT_MAX - 1 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE  = DATA[ti].d_line;
+            const int COUNT = DATA[ti].d_count;
+            const int TOTAL = DATA[ti].d_total;
+            const int MIN   = DATA[ti].d_min;
+            const int MAX   = DATA[ti].d_max;
+
+            if (veryVerbose) {
+                T_ P_(LINE) P_(COUNT) P_(TOTAL) P_(MIN) P(MAX);
+            }
+
+            Obj    mX(METRIC_A);  const Obj&    X = mX;
+            IntObj mY(METRIC_B);  const IntObj& Y = mY;
+
+            // Values in the stripe of this thread are discarded.
+
+            mX.update(-100);
+            mY.update(-100);
+
+            mX.setCountTotalMinMax(COUNT, TOTAL, MIN, MAX);
+            mY.setCountTotalMinMax(COUNT, TOTAL, MIN, MAX);
+
+            Rec r1, r2;
+            X.load(&r1);
+            Y.load(&r2);
+            ASSERTV(LINE, Rec(METRIC_A, COUNT, TOTAL, MIN, MAX) == r1);
+            ASSERTV(LINE, Rec(METRIC_B, COUNT, TOTAL, MIN, MAX) == r2);
+
+            mX.loadAndReset(&r1);
+            mY.loadAndReset(&r2);
+            ASSERTV(LINE, Rec(METRIC_A, COUNT, TOTAL, MIN, MAX) == r1);
+            ASSERTV(LINE, Rec(METRIC_B, COUNT, TOTAL, MIN, MAX) == r2);
+
+            X.load(&r1);
+            Y.load(&r2);
+            ASSERTV(LINE, Rec(METRIC_A) == r1);
+            ASSERTV(LINE, Rec(METRIC_B) == r2);
+
+            mX.accumulateCountTotalMinMax(COUNT, TOTAL, MIN, MAX);
+            mY.accumulateCountTotalMinMax(COUNT, TOTAL, MIN, MAX);
+            mX.accumulateCountTotalMinMax(1, 5, 5, 5);
+            mY.accumulateCountTotalMinMax(1, 5, 5, 5);
+
+            const Rec EXP_X(METRIC_A,
+                            COUNT + 1,
+                            static_cast<double>(TOTAL) + 5,
+                            bsl::min(MIN, 5),
+                            bsl::max(MAX, 5));
+            const Rec EXP_Y(METRIC_B,
+                            COUNT + 1,
+                            static_cast<double>(TOTAL) + 5,
+                            bsl::min(MIN, 5),
+                            bsl::max(MAX, 5));
+            X.load(&r1);
+            Y.load(&r2);
+            ASSERTV(LINE, r1, EXP_X == r1);
+            ASSERTV(LINE, r2, EXP_Y == r2);
+
+            mX.reset();
+            mY.reset();
+            X.load(&r1);
+            Y.load(&r2);
+            ASSERTV(LINE, Rec(METRIC_A) == r1);
+            ASSERTV(LINE, Rec(METRIC_B) == r2);
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A collector is created with the supplied metric id and default
+        //:   aggregates.
+        //:
+        //: 2 'update' increments the count, adds to the total, and updates
+        //:   the minimum and maximum.
+        //:
+        //: 3 'load' does not modify the collector.
+        //
+        // Plan:
+        //: 1 Create collectors, update them with a sequence of values, and
+        //:   verify the loaded record after each update.  (C-1..3)
+        //
+        // Testing:
+        //   balm::StripedCollector(const balm::MetricId& metricId);
+        //   ~balm::StripedCollector();
+        //   void update(double value);
+        //   const balm::MetricId& metricId() const;
+        //   void load(balm::MetricRecord *record) const;
+        //   balm::StripedIntegerCollector(const balm::MetricId& metricId);
+        //   ~balm::StripedIntegerCollector();
+        //   void update(int value);
+        //   const balm::MetricId& metricId() const;
+        //   void load(balm::MetricRecord *record) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING PRIMARY MANIPULATORS" << endl
+                          << "============================" << endl;
+
+        static const struct {
+            int    d_line;
+            double d_value;
+            int    d_expCount;
+            double d_expTotal;
+            double d_expMin;
+            double d_expMax;
+        } DATA[] = {
+            //LINE  VALUE   COUNT  TOTAL   MIN    MAX
+            //----  -----   -----  -----   ----   ---
+            { L_,     1.0,      1,   1.0,   1.0,  1.0 },
+            { L_,     2.0,      2,   3.0,   1.0,  2.0 },
+            { L_,    -5.0,      3,  -2.0,  -5.0,  2.0 },
+            { L_,    10.0,      4,   8.0,  -5.0, 10.0 },
+            { L_,     0.0,      5,   8.0,  -5.0, 10.0 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        Obj    mX(METRIC_A);  const Obj&    X = mX;
+        IntObj mY(METRIC_B);  const IntObj& Y = mY;
+
+        ASSERT(METRIC_A == X.metricId());
+        ASSERT(METRIC_B == Y.metricId());
+
+        Rec r1, r2;
+        X.load(&r1);
+        Y.load(&r2);
+        ASSERT(Rec(METRIC_A) == r1);
+        ASSERT(Rec(METRIC_B) == r2);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int    LINE  = DATA[ti].d_line;
+            const double VALUE = DATA[ti].d_value;
+
+            mX.update(VALUE);
+            mY.update(static_cast<int>(VALUE));
+
+            X.load(&r1);
+            Y.load(&r2);
+
+            const Rec EXP_X(METRIC_A,
+                            DATA[ti].d_expCount,
+                            DATA[ti].d_expTotal,
+                            DATA[ti].d_expMin,
+                            DATA[ti].d_expMax);
+            const Rec EXP_Y(METRIC_B,
+                            DATA[ti].d_expCount,
+                            DATA[ti].d_expTotal,
+                            DATA[ti].d_expMin,
+                            DATA[ti].d_expMax);
+
+            ASSERTV(LINE, r1, EXP_X == r1);
+            ASSERTV(LINE, r2, EXP_Y == r2);
+
+            // 'load' is idempotent.
+
+            X.load(&r1);
+            Y.load(&r2);
+            ASSERTV(LINE, r1, EXP_X == r1);
+            ASSERTV(LINE, r2, EXP_Y == r2);
+        }
+
+        if (verbose) cout << "\tTesting integer limits." << endl;
+        {
+            IntObj mZ(METRIC_B);  const IntObj& Z = mZ;
+
+            mZ.update(INT_MAX);
+            mZ.update(INT_MAX);
+            mZ.update(INT_MIN);
+
+            Z.load(&r2);
+            ASSERT(3                                 == r2.count());
+            ASSERT(static_cast<double>(INT_MAX) - 1  == r2.total());
+            ASSERT(INT_MIN                           == r2.min());
+            ASSERT(INT_MAX                           == r2.max());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'stripeIndex'
+        //
+        // Concerns:
+        //: 1 'stripeIndex' returns a value in '[0 .. k_NUM_STRIPES - 1]'.
+        //:
+        //: 2 The stripe index of a thread does not change.
+        //:
+        //: 3 Threads are spread over all the stripes.
+        //
+        // Plan:
+        //: 1 Start 'k_NUM_STRIPES' threads that are alive at the same time,
+        //:   and record the stripe index of each.  Verify that each index is
+        //:   in range and, on platforms assigning stripes round-robin, that
+        //:   every stripe is used.  (C-1..3)
+        //
+        // Testing:
+        //   int stripeIndex();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'stripeIndex'" << endl
+                          << "=====================" << endl;
+
+        const int index = Util::stripeIndex();
+        ASSERTV(index, 0 <= index && index < Util::k_NUM_STRIPES);
+        ASSERTV(index, index == Util::stripeIndex());
+
+        enum { k_NUM = Util::k_NUM_STRIPES };
+
+        bslmt::Barrier            barrier(k_NUM);
+        StripeIndexArgs           args[k_NUM];
+        bslmt::ThreadUtil::Handle handles[k_NUM];
+
+        for (int i = 0; i < k_NUM; ++i) {
+            args[i].d_index     = -1;
+            args[i].d_barrier_p = &barrier;
+            ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                  recordStripeIndex,
+                                                  &args[i]));
+        }
+        for (int i = 0; i < k_NUM; ++i) {
+            ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+        }
+
+        int used[k_NUM] = { 0 };
+        for (int i = 0; i < k_NUM; ++i) {
+            const int INDEX = args[i].d_index;
+            ASSERTV(i, INDEX, 0 <= INDEX && INDEX < k_NUM);
+            if (0 <= INDEX && INDEX < k_NUM) {
+                ++used[INDEX];
+            }
+        }
+
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+        // Consecutively created threads are assigned distinct stripes.
+
+        for (int i = 0; i < k_NUM; ++i) {
+            ASSERTV(i, used[i], 1 == used[i]);
+        }
+#endif
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Perform ad-hoc test of the primary modifiers and accessors.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        const Id METRIC_C(DESC_C);
+
+        Obj    mX(METRIC_A);  const Obj& X = mX;
+        IntObj mY(METRIC_C);
+
+        Rec r;
+        mX.update(1.5);
+        mX.update(2.5);
+        X.load(&r);
+        ASSERT(Rec(METRIC_A, 2, 4.0, 1.5, 2.5) == r);
+
+        mY.update(3);
+        mY.update(-1);
+        mY.loadAndReset(&r);
+        ASSERT(Rec(METRIC_C, 2, 2, -1, 3) == r);
+
+        mY.load(&r);
+        ASSERT(Rec(METRIC_C) == r);
+
+        (void)METRIC_B;
+      } break;
+      default: {
+        cout << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cout << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,527 @@
+// balst_heapprofileallocator.cpp                                     -*-C++-*-
+#include <balst_heapprofileallocator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balst_heapprofileallocator_cpp,"$Id$ $CSID$")
+
+#include <balst_stacktrace.h>
+#include <balst_stacktraceutil.h>
+
+#include <bslma_mallocfreeallocator.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_exceptionutil.h>
+#include <bsls_performancehint.h>
+#include <bsls_platform.h>
+#include <bsls_stackaddressutil.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cmath.h>
+#include <bsl_fstream.h>
+#include <bsl_ios.h>
+#include <bsl_ostream.h>
+#include <bsl_utility.h>
+
+namespace BloombergLP {
+namespace {
+
+typedef bsls::StackAddressUtil AddressUtil;
+
+const bsls::Types::Uint64 k_GOLDEN_RATIO = 0x9e3779b97f4a7c15ULL;
+    // multiplier spreading the bits of thread identifiers and addresses
+
+const bsls::Types::Uint64 k_RANDOM_SEED = 0x2545f4914f6cdd1dULL;
+    // initial state of the generator of sampling thresholds
+
+enum {
+    k_NUM_SKIPPED_FRAMES = AddressUtil::k_IGNORE_FRAMES + 1
+        // Number of frames gathered by 'AddressUtil::getStackAddresses' that
+        // are not part of a call site: the frame of 'getStackAddresses' on
+        // the platforms where 'AddressUtil::k_IGNORE_FRAMES' is 1, and the
+        // frame of 'HeapProfileAllocator::allocate'.
+};
+
+struct CallSiteRecord {
+    // This 'struct' provides a copy of the statistics of a call site, whose
+    // stack is the sequence of 'd_numFrames' addresses at 'd_offset' in an
+    // array of addresses, taken so that they can be written or printed
+    // without holding the mutex guarding the profile.
+
+    bsl::size_t        d_offset;          // first address of the stack
+    int                d_numFrames;       // number of addresses
+    bsls::Types::Int64 d_numBlocksInUse;  // sampled blocks in use
+    bsls::Types::Int64 d_numBytesInUse;   // bytes of sampled blocks in use
+    bsls::Types::Int64 d_numBlocksTotal;  // sampled blocks ever allocated
+    bsls::Types::Int64 d_numBytesTotal;   // bytes of sampled blocks ever
+                                          // allocated
+};
+
+struct MoreBytesInUse {
+    // This 'struct' provides a functor ordering call site records by
+    // decreasing number of bytes in use, then of bytes in total.
+
+    bool operator()(const CallSiteRecord& lhs,
+                    const CallSiteRecord& rhs) const
+    {
+        if (lhs.d_numBytesInUse != rhs.d_numBytesInUse) {
+            return lhs.d_numBytesInUse > rhs.d_numBytesInUse;         // RETURN
+        }
+        return lhs.d_numBytesTotal > rhs.d_numBytesTotal;
+    }
+};
+
+template <class CALL_SITE_MAP>
+void copyCallSites(bsl::vector<const void *>   *addresses,
+                   bsl::vector<CallSiteRecord> *records,
+                   const CALL_SITE_MAP&         callSites)
+    // Append to the specified 'records' a record of each call site of the
+    // specified 'callSites', and to the specified 'addresses' the stack of
+    // each call site, ordered by decreasing number of bytes in use.
+{
+    records->reserve(records->size() + callSites.size());
+
+    for (typename CALL_SITE_MAP::const_iterator it = callSites.begin();
+                                                callSites.end() != it;
+                                                ++it) {
+        const CallSiteRecord record = {
+            addresses->size(),
+            static_cast<int>(it->first.size()),
+            it->second.d_numBlocksInUse,
+            it->second.d_numBytesInUse,
+            it->second.d_numBlocksTotal,
+            it->second.d_numBytesTotal
+        };
+        records->push_back(record);
+        addresses->insert(addresses->end(),
+                          it->first.begin(),
+                          it->first.end());
+    }
+
+    bsl::sort(records->begin(), records->end(), MoreBytesInUse());
+}
+
+inline
+int counterIndex(int numCounters)
+    // Return the index, in the range '[0 .. numCounters)', of the counter of
+    // bytes until the next sample used by the calling thread.  The behavior
+    // is undefined unless 'numCounters' is a power of two.
+{
+    const bsls::Types::Uint64 id = bslmt::ThreadUtil::selfIdAsUint64();
+    return static_cast<int>((id * k_GOLDEN_RATIO) >> 32) & (numCounters - 1);
+}
+
+double estimatedBytes(bsls::Types::Int64 numBlocks,
+                      bsls::Types::Int64 numBytes,
+                      bsls::Types::Int64 samplingInterval)
+    // Return the number of bytes estimated from the specified 'numBlocks'
+    // sampled blocks of the specified total 'numBytes' (in bytes), sampled
+    // with the specified 'samplingInterval', as estimated by the 'pprof' tool.
+{
+    if (0 == numBlocks) {
+        return 0;                                                     // RETURN
+    }
+    const double averageSize = static_cast<double>(numBytes)
+                             / static_cast<double>(numBlocks);
+    const double probability = 1 - bsl::exp(-averageSize /
+                                    static_cast<double>(samplingInterval));
+    return 0 < probability ? static_cast<double>(numBytes) / probability
+                           : static_cast<double>(numBytes);
+}
+
+void writeAddresses(bsl::ostream&      stream,
+                    const void * const *addresses,
+                    int                 numAddresses)
+    // Write to the specified 'stream' the specified 'numAddresses' addresses
+    // at the specified 'addresses' in hexadecimal, each preceded by a space.
+{
+    const bsl::ios_base::fmtflags flags = stream.flags();
+
+    stream << bsl::hex;
+    for (int i = 0; i < numAddresses; ++i) {
+        stream << " 0x" << reinterpret_cast<bsls::Types::UintPtr>(
+                                                                 addresses[i]);
+    }
+    stream.flags(flags);
+}
+
+}  // close unnamed namespace
+
+namespace balst {
+
+                         // --------------------------
+                         // class HeapProfileAllocator
+                         // --------------------------
+
+// CLASS DATA
+const bsls::Types::Int64 HeapProfileAllocator::k_DEFAULT_SAMPLING_INTERVAL;
+
+// PRIVATE CLASS METHODS
+int HeapProfileAllocator::filterSlot(const void *address)
+{
+    const bsls::Types::Uint64 value = reinterpret_cast<bsls::Types::UintPtr>(
+                                                                      address);
+    return static_cast<int>((value * k_GOLDEN_RATIO) >> 32)
+                                                   & (k_NUM_FILTER_SLOTS - 1);
+}
+
+// PRIVATE MANIPULATORS
+bsls::Types::Int64 HeapProfileAllocator::nextThreshold()
+{
+    if (1 == d_samplingInterval) {
+        return 1;                                                     // RETURN
+    }
+
+    // Draw a uniform variate in '(0 .. 1]' from a xorshift64* generator, and
+    // transform it to an exponential variate.
+
+    d_randomState ^= d_randomState >> 12;
+    d_randomState ^= d_randomState << 25;
+    d_randomState ^= d_randomState >> 27;
+
+    const bsls::Types::Uint64 random = d_randomState * 2685821657736338717ULL;
+
+    const double uniform   = (static_cast<double>(random >> 11) + 1.0)
+                                                        / 9007199254740992.0;
+    const double threshold = -bsl::log(uniform)
+                           * static_cast<double>(d_samplingInterval);
+
+    if (threshold < 1) {
+        return 1;                                                     // RETURN
+    }
+    if (threshold > 4e18) {
+        return 4000000000000000000LL;                                 // RETURN
+    }
+    return static_cast<bsls::Types::Int64>(threshold);
+}
+
+void HeapProfileAllocator::recordSample(void                   *address,
+                                        bsls::Types::size_type  size,
+                                        const void * const     *frames,
+                                        int                     numFrames)
+{
+    CallSite *callSite;
+
+    BSLS_TRY {
+        // Note that 'operator[]' value-initializes the statistics of a new
+        // call site, and copies 'stack' using the allocator of the map.
+
+        const Stack stack(frames, frames + numFrames, d_allocator_p);
+
+        callSite = &d_callSites[stack];
+
+        const Sample sample = { callSite, size };
+        d_samples[address] = sample;
+    }
+    BSLS_CATCH(...) {
+        // The profile is best effort: failing to record a sample does not
+        // fail the allocation.
+
+        return;                                                       // RETURN
+    }
+
+    const bsls::Types::Int64 numBytes = static_cast<bsls::Types::Int64>(size);
+
+    ++callSite->d_numBlocksInUse;
+    callSite->d_numBytesInUse += numBytes;
+    ++callSite->d_numBlocksTotal;
+    callSite->d_numBytesTotal += numBytes;
+
+    ++d_numBlocksTotal;
+    d_numBytesTotal += numBytes;
+    d_numBytesInUse += numBytes;
+
+    d_filter[filterSlot(address)].addRelaxed(1);
+}
+
+// CREATORS
+HeapProfileAllocator::HeapProfileAllocator(
+                                   bsls::Types::Int64  samplingInterval,
+                                   bslma::Allocator   *basicAllocator)
+: d_samplingInterval(samplingInterval)
+, d_randomState(k_RANDOM_SEED)
+, d_callSites(basicAllocator
+              ? basicAllocator
+              : &bslma::MallocFreeAllocator::singleton())
+, d_samples(basicAllocator
+            ? basicAllocator
+            : &bslma::MallocFreeAllocator::singleton())
+, d_numBlocksTotal(0)
+, d_numBytesTotal(0)
+, d_numBytesInUse(0)
+, d_allocator_p(basicAllocator
+                ? basicAllocator
+                : &bslma::MallocFreeAllocator::singleton())
+{
+    BSLS_ASSERT(0 < samplingInterval);
+
+    for (int i = 0; i < k_NUM_COUNTERS; ++i) {
+        d_counters[i].d_bytesUntilSample.storeRelaxed(nextThreshold());
+    }
+}
+
+HeapProfileAllocator::~HeapProfileAllocator()
+{
+}
+
+// MANIPULATORS
+void *HeapProfileAllocator::allocate(bsls::Types::size_type size)
+{
+    if (0 == size) {
+        return 0;                                                     // RETURN
+    }
+
+    void *address = d_allocator_p->allocate(size);
+
+    const bsls::Types::Int64 numBytes = static_cast<bsls::Types::Int64>(size);
+
+    // An allocation is sampled if it brings the count of bytes until the next
+    // sample of its counter from a positive value to a non-positive value.  A
+    // concurrent allocation finding the count not positive, before the
+    // sampling allocation sets the next threshold, is not sampled, unless
+    // every allocation is to be sampled.
+
+    Counter&                 counter   = d_counters[counterIndex(
+                                                              k_NUM_COUNTERS)];
+    const bsls::Types::Int64 remaining =
+                              counter.d_bytesUntilSample.addRelaxed(-numBytes);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(0 < remaining)) {
+        return address;                                               // RETURN
+    }
+
+    BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+    if (remaining + numBytes <= 0 && 1 != d_samplingInterval) {
+        return address;                                               // RETURN
+    }
+
+    void *frames[k_MAX_RECORDED_FRAMES + k_NUM_SKIPPED_FRAMES];
+
+    int numFrames = AddressUtil::getStackAddresses(
+                                frames,
+                                k_MAX_RECORDED_FRAMES + k_NUM_SKIPPED_FRAMES);
+    numFrames = numFrames > k_NUM_SKIPPED_FRAMES
+              ? numFrames - k_NUM_SKIPPED_FRAMES
+              : 0;
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    counter.d_bytesUntilSample.storeRelaxed(nextThreshold());
+
+    recordSample(address, size, frames + k_NUM_SKIPPED_FRAMES, numFrames);
+
+    return address;
+}
+
+void HeapProfileAllocator::deallocate(void *address)
+{
+    if (0 == address) {
+        return;                                                       // RETURN
+    }
+
+    // The block must be removed from the profile before it is deallocated,
+    // as its address may then be returned by a concurrent allocation.
+
+    bsls::AtomicInt& slot = d_filter[filterSlot(address)];
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 != slot.loadRelaxed())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        SampleMap::iterator it = d_samples.find(address);
+        if (d_samples.end() != it) {
+            const bsls::Types::Int64 numBytes =
+                            static_cast<bsls::Types::Int64>(it->second.d_size);
+
+            CallSite *callSite = it->second.d_callSite_p;
+
+            --callSite->d_numBlocksInUse;
+            callSite->d_numBytesInUse -= numBytes;
+            d_numBytesInUse           -= numBytes;
+
+            d_samples.erase(it);
+            slot.addRelaxed(-1);
+        }
+    }
+
+    d_allocator_p->deallocate(address);
+}
+
+// ACCESSORS
+double HeapProfileAllocator::estimatedBytesInUse() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    double result = 0;
+    for (SampleMap::const_iterator it = d_samples.begin();
+                                   d_samples.end() != it;
+                                   ++it) {
+        result += estimatedBytes(
+                            1,
+                            static_cast<bsls::Types::Int64>(it->second.d_size),
+                            d_samplingInterval);
+    }
+    return result;
+}
+
+int HeapProfileAllocator::numCallSites() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return static_cast<int>(d_callSites.size());
+}
+
+bsls::Types::Int64 HeapProfileAllocator::numSampledBlocksInUse() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return static_cast<bsls::Types::Int64>(d_samples.size());
+}
+
+bsls::Types::Int64 HeapProfileAllocator::numSampledBlocksTotal() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_numBlocksTotal;
+}
+
+bsls::Types::Int64 HeapProfileAllocator::numSampledBytesInUse() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_numBytesInUse;
+}
+
+bsls::Types::Int64 HeapProfileAllocator::numSampledBytesTotal() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_numBytesTotal;
+}
+
+void HeapProfileAllocator::printCallSites(bsl::ostream& stream,
+                                          int           maxNumCallSites) const
+{
+    BSLS_ASSERT(0 <= maxNumCallSites);
+
+    // Copy the profile using the underlying allocator, so that no memory is
+    // allocated from this object (which may be the default allocator) while
+    // 'd_mutex' is locked.
+
+    bsl::vector<const void *>   addresses(d_allocator_p);
+    bsl::vector<CallSiteRecord> records(d_allocator_p);
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        copyCallSites(&addresses, &records, d_callSites);
+    }
+
+    const int numCallSites = static_cast<int>(records.size());
+    const int numPrinted   = bsl::min(numCallSites, maxNumCallSites);
+
+    for (int i = 0; i < numPrinted; ++i) {
+        const CallSiteRecord& record = records[i];
+
+        stream << "Call site " << (i + 1) << " of " << numCallSites << ": "
+               << record.d_numBlocksInUse << " sampled block(s) of "
+               << record.d_numBytesInUse << " byte(s) in use (about "
+               << static_cast<bsls::Types::Int64>(
+                                      estimatedBytes(record.d_numBlocksInUse,
+                                                     record.d_numBytesInUse,
+                                                     d_samplingInterval))
+               << " bytes), " << record.d_numBlocksTotal
+               << " sampled block(s) of " << record.d_numBytesTotal
+               << " byte(s) in total\n";
+
+        const void * const *stack = record.d_numFrames
+                                  ? &addresses[record.d_offset]
+                                  : 0;
+
+        StackTrace stackTrace(d_allocator_p);
+        if (0 == StackTraceUtil::loadStackTraceFromAddressArray(
+                                                         &stackTrace,
+                                                         stack,
+                                                         record.d_numFrames)) {
+            StackTraceUtil::printFormatted(stream, stackTrace);
+        }
+        else {
+            stream << "Stack trace:";
+            writeAddresses(stream, stack, record.d_numFrames);
+            stream << '\n';
+        }
+    }
+    stream << bsl::flush;
+}
+
+void HeapProfileAllocator::writeProfile(bsl::ostream& stream) const
+{
+    // Copy the profile using the underlying allocator, so that no memory is
+    // allocated from this object (which may be the default allocator) while
+    // 'd_mutex' is locked.
+
+    bsl::vector<const void *>   addresses(d_allocator_p);
+    bsl::vector<CallSiteRecord> records(d_allocator_p);
+    bsls::Types::Int64          numBlocksInUse;
+    bsls::Types::Int64          numBytesInUse;
+    bsls::Types::Int64          numBlocksTotal;
+    bsls::Types::Int64          numBytesTotal;
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        numBlocksInUse = static_cast<bsls::Types::Int64>(d_samples.size());
+        numBytesInUse  = d_numBytesInUse;
+        numBlocksTotal = d_numBlocksTotal;
+        numBytesTotal  = d_numBytesTotal;
+
+        copyCallSites(&addresses, &records, d_callSites);
+    }
+
+    stream << "heap profile: "
+           << numBlocksInUse << ": " << numBytesInUse << " ["
+           << numBlocksTotal << ": " << numBytesTotal << "] @ heap_v2/"
+           << d_samplingInterval << '\n';
+
+    for (bsl::size_t i = 0; i < records.size(); ++i) {
+        const CallSiteRecord& record = records[i];
+
+        stream << record.d_numBlocksInUse << ": " << record.d_numBytesInUse
+               << " [" << record.d_numBlocksTotal << ": "
+               << record.d_numBytesTotal << "] @";
+        writeAddresses(stream,
+                       record.d_numFrames ? &addresses[record.d_offset] : 0,
+                       record.d_numFrames);
+        stream << '\n';
+    }
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+    bsl::ifstream maps("/proc/self/maps");
+    if (maps) {
+        stream << "\nMAPPED_LIBRARIES:\n" << maps.rdbuf();
+    }
+#endif
+
+    stream << bsl::flush;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,410 @@
+// balst_heapprofileallocator.h                                       -*-C++-*-
+#ifndef INCLUDED_BALST_HEAPPROFILEALLOCATOR
+#define INCLUDED_BALST_HEAPPROFILEALLOCATOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an allocator adapter profiling a sample of allocations.
+//
+//@CLASSES:
+//  balst::HeapProfileAllocator: sampling heap profiler allocator adapter
+//
+//@SEE_ALSO: balst_stacktracetestallocator, balst_stacktraceutil,
+//           bsls_stackaddressutil
+//
+//@DESCRIPTION: This component provides an allocator adapter,
+// 'balst::HeapProfileAllocator', that implements the 'bslma::Allocator'
+// protocol by forwarding every request to an underlying allocator supplied at
+// construction, and that records the call stack of a random sample of the
+// allocations, aggregated by call site:
+//..
+//   ,---------------------------.
+//  ( balst::HeapProfileAllocator )
+//   `---------------------------'
+//                 |         ctor/dtor
+//                 |         estimatedBytesInUse
+//                 |         numCallSites
+//                 |         numSampledBlocksInUse
+//                 |         numSampledBlocksTotal
+//                 |         numSampledBytesInUse
+//                 |         numSampledBytesTotal
+//                 |         printCallSites
+//                 |         samplingInterval
+//                 |         writeProfile
+//                 V
+//         ,----------------.
+//        ( bslma::Allocator )
+//         `----------------'
+//                           allocate
+//                           deallocate
+//..
+// Unlike 'balst::StackTraceTestAllocator', which records the call stack of
+// every allocation, a 'balst::HeapProfileAllocator' records the call stack of
+// roughly one allocation per 'samplingInterval' bytes allocated, so that its
+// overhead is low enough for it to remain installed in a production process.
+// The profile it accumulates can, at any time, be written in the format of
+// the 'pprof' heap profiler ('writeProfile'), or printed with the stack traces
+// resolved to symbols ('printCallSites').
+//
+///Sampling
+///--------
+// The allocations sampled are those during which the number of bytes
+// allocated since the previous sample reaches a threshold drawn from an
+// exponential distribution whose mean is the 'samplingInterval' supplied at
+// construction.  Every byte allocated is therefore equally likely to be
+// sampled, and an allocation of 'size' bytes is sampled with probability
+// '1 - exp(-size / samplingInterval)'.  The expected number of blocks and
+// bytes that a sampled block of 'size' bytes stands for is obtained by
+// dividing by this probability, which is how both 'estimatedBytesInUse' and
+// the 'pprof' tool estimate the profile of all allocations from the sample.
+// A 'samplingInterval' of 1 samples every allocation.
+//
+// Each thread counts the bytes it allocates in one of a small number of
+// counters selected by its thread identifier, so that threads rarely contend
+// on the same counter.  Only sampled allocations, and the deallocation of
+// sampled blocks, acquire the mutex guarding the profile.  The deallocation
+// of a block identifies whether it was sampled through a small table of
+// counters indexed by the address of the block, so that the deallocation of
+// a block that was not sampled acquires the mutex only rarely.
+//
+///Call Sites
+///----------
+// A call site is the sequence of (at most 'k_MAX_RECORDED_FRAMES') return
+// addresses on the stack of the thread calling 'allocate', obtained from
+// 'bsls::StackAddressUtil', excluding the frame of 'allocate' itself.  For
+// each call site, the profile records the number of sampled blocks, and of
+// their bytes, allocated from that call site and in use, and allocated from
+// that call site in total.  Call sites are recorded for the lifetime of the
+// allocator.  Resolving the addresses of a call site to symbols is expensive,
+// and is only done by 'printCallSites'.
+//
+///Profile Format
+///--------------
+// 'writeProfile' writes the profile in the legacy text format of the heap
+// profiles written by 'gperftools', which the 'pprof' tool reads:
+//..
+//  heap profile: <in use blocks>: <in use bytes> [<total blocks>: <total
+//  bytes>] @ heap_v2/<sampling interval>
+//  <in use blocks>: <in use bytes> [<total blocks>: <total bytes>] @ 0x...
+//  ...
+//
+//  MAPPED_LIBRARIES:
+//  <contents of '/proc/self/maps'>
+//..
+// in which the first line summarizes the call sites listed by each following
+// line, and the counts are those of the sampled blocks.  The memory map of
+// the process, which 'pprof' uses to resolve the addresses to symbols, is
+// only available on Linux.
+//
+///Thread Safety
+///-------------
+// 'balst::HeapProfileAllocator' is fully thread-safe, meaning any operation
+// on the same object can be safely invoked from any thread, provided that the
+// underlying allocator is thread-safe.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Profiling the Memory Used by a Service
+///- - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that the memory used by a long-running service grows, and that we
+// want to learn which code holds that memory, without the overhead of
+// recording every allocation.
+//
+// First, we create a heap profile allocator, sampling about one allocation
+// per 64 KiB allocated, and install it as the default allocator:
+//..
+//  balst::HeapProfileAllocator profiler(64 * 1024);
+//
+//  bslma::DefaultAllocatorGuard guard(&profiler);
+//..
+// Then, we run the service, which here caches the results of requests:
+//..
+//  bsl::map<int, bsl::string> cache;
+//
+//  for (int i = 0; i < 10000; ++i) {
+//      cache[i].assign(1000, 'x');
+//  }
+//..
+// Next, we verify that a sample of the allocations of the cache was recorded,
+// and that the in-use memory estimated from the sample is in the vicinity of
+// the memory used by the cache:
+//..
+//  assert(0 < profiler.numSampledBlocksInUse());
+//  assert(0 < profiler.numCallSites());
+//
+//  const double estimate = profiler.estimatedBytesInUse();
+//  assert(5000000 < estimate && estimate < 20000000);
+//..
+// Finally, we write the profile, for example to a file, to be analyzed by
+// the 'pprof' tool:
+//..
+//  bsl::ostringstream profile;
+//  profiler.writeProfile(profile);
+//
+//  assert(0 == profile.str().find("heap profile: "));
+//..
+// The profile may then be analyzed (after writing it to 'service.heap') with a
+// command such as 'pprof -top <executable> service.heap'.
+
+#include <balscm_version.h>
+
+#include <bslma_allocator.h>
+
+#include <bslmt_mutex.h>
+#include <bslmt_platform.h>
+
+#include <bsls_atomic.h>
+#include <bsls_keyword.h>
+#include <bsls_types.h>
+
+#include <bsl_iosfwd.h>
+#include <bsl_map.h>
+#include <bsl_unordered_map.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace balst {
+
+                         // ==========================
+                         // class HeapProfileAllocator
+                         // ==========================
+
+class HeapProfileAllocator : public bslma::Allocator {
+    // This class defines a concrete thread-safe allocator adapter that
+    // implements the 'bslma::Allocator' protocol by forwarding requests to an
+    // underlying allocator, and that records, aggregated by call site, the
+    // call stack of a sample of the allocations, on average one per sampling
+    // interval bytes allocated.
+    //
+    // Note that, like 'StackTraceTestAllocator', this allocator does not rely
+    // on the currently installed default allocator, but instead -- by
+    // default -- uses the 'bslma::MallocFreeAllocator' singleton, so that it
+    // can itself be installed as the default allocator.
+
+  public:
+    // CLASS DATA
+    static const bsls::Types::Int64 k_DEFAULT_SAMPLING_INTERVAL = 512 * 1024;
+        // default mean number of bytes allocated between two samples
+
+    enum { k_MAX_RECORDED_FRAMES = 32 };
+        // maximum number of return addresses recorded for a call site
+
+  private:
+    // PRIVATE TYPES
+    enum {
+        k_NUM_COUNTERS     = 16,    // number of counters of bytes until the
+                                    // next sample (a power of two)
+
+        k_NUM_FILTER_SLOTS = 4096   // number of slots in the table of
+                                    // sampled addresses (a power of two)
+    };
+
+    struct Counter {
+        // This 'struct' provides a counter of the bytes remaining until the
+        // next sample, occupying a cache line of its own.
+
+        bsls::AtomicInt64 d_bytesUntilSample;
+        char              d_pad[bslmt::Platform::e_CACHE_LINE_SIZE -
+                                                    sizeof(bsls::AtomicInt64)];
+    };
+
+    struct CallSite {
+        // This 'struct' provides the statistics of the sampled blocks
+        // allocated from one call site.
+
+        bsls::Types::Int64 d_numBlocksInUse;  // sampled blocks in use
+        bsls::Types::Int64 d_numBytesInUse;   // bytes of sampled blocks in use
+        bsls::Types::Int64 d_numBlocksTotal;  // sampled blocks ever allocated
+        bsls::Types::Int64 d_numBytesTotal;   // bytes of sampled blocks ever
+                                              // allocated
+    };
+
+    typedef bsl::vector<const void *>        Stack;
+        // Return addresses of a call site, innermost first.
+
+    typedef bsl::map<Stack, CallSite>        CallSiteMap;
+        // Map from the stack of a call site to its statistics.
+
+    struct Sample {
+        // This 'struct' describes a sampled block in use.
+
+        CallSite               *d_callSite_p;  // call site of the block
+        bsls::Types::size_type  d_size;        // size (in bytes) of the block
+    };
+
+    typedef bsl::unordered_map<const void *, Sample> SampleMap;
+        // Map from the address of a sampled block in use to its description.
+
+    // DATA
+    Counter                  d_counters[k_NUM_COUNTERS];
+                                                // bytes until the next sample,
+                                                // by thread
+
+    bsls::AtomicInt          d_filter[k_NUM_FILTER_SLOTS];
+                                                // number of sampled blocks in
+                                                // use, by slot of address
+
+    const bsls::Types::Int64 d_samplingInterval;
+                                                // mean number of bytes between
+                                                // two samples
+
+    bsls::Types::Uint64      d_randomState;     // state of the generator of
+                                                // sampling thresholds
+
+    CallSiteMap              d_callSites;       // statistics by call site
+
+    SampleMap                d_samples;         // sampled blocks in use
+
+    bsls::Types::Int64       d_numBlocksTotal;  // sampled blocks ever
+                                                // allocated
+
+    bsls::Types::Int64       d_numBytesTotal;   // bytes of sampled blocks ever
+                                                // allocated
+
+    bsls::Types::Int64       d_numBytesInUse;   // bytes of sampled blocks in
+                                                // use
+
+    mutable bslmt::Mutex     d_mutex;           // guards the profile and
+                                                // 'd_randomState'
+
+    bslma::Allocator        *d_allocator_p;     // underlying allocator (held,
+                                                // not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    HeapProfileAllocator(const HeapProfileAllocator&);
+    HeapProfileAllocator& operator=(const HeapProfileAllocator&);
+
+    // PRIVATE CLASS METHODS
+    static int filterSlot(const void *address);
+        // Return the slot of 'd_filter' of the specified 'address'.
+
+    // PRIVATE MANIPULATORS
+    bsls::Types::Int64 nextThreshold();
+        // Return a number of bytes drawn from the exponential distribution
+        // whose mean is the sampling interval of this allocator.  The behavior
+        // is undefined unless 'd_mutex' is locked.
+
+    void recordSample(void                   *address,
+                      bsls::Types::size_type  size,
+                      const void * const     *frames,
+                      int                     numFrames);
+        // Record the block at the specified 'address' of the specified 'size'
+        // as sampled, allocated from the call site described by the specified
+        // 'numFrames' return addresses at the specified 'frames'.  If memory
+        // can not be obtained to record the sample, the block is not
+        // recorded.  The behavior is undefined unless 'd_mutex' is locked.
+
+  public:
+    // CREATORS
+    explicit
+    HeapProfileAllocator(
+           bsls::Types::Int64  samplingInterval = k_DEFAULT_SAMPLING_INTERVAL,
+           bslma::Allocator   *basicAllocator   = 0);
+        // Create a heap profile allocator.  Optionally specify a
+        // 'samplingInterval', the mean number of bytes allocated between two
+        // sampled allocations.  If 'samplingInterval' is not specified,
+        // 'k_DEFAULT_SAMPLING_INTERVAL' is used.  Optionally specify a
+        // 'basicAllocator' to which requests are forwarded, and that supplies
+        // the memory of the profile.  If 'basicAllocator' is 0, the
+        // 'bslma::MallocFreeAllocator' singleton is used.  The behavior is
+        // undefined unless '0 < samplingInterval'.
+
+    virtual ~HeapProfileAllocator();
+        // Destroy this allocator object.  Note that blocks allocated from this
+        // object and still in use remain allocated from the underlying
+        // allocator.
+
+    // MANIPULATORS
+    virtual void *allocate(bsls::Types::size_type size) BSLS_KEYWORD_OVERRIDE;
+        // Return a newly-allocated block of memory of (at least) the specified
+        // positive 'size' (in bytes), obtained from the underlying allocator,
+        // and, if this allocation is sampled, record it with the call stack of
+        // the caller.  If 'size' is 0, a null pointer is returned with no
+        // other effect.
+
+    virtual void deallocate(void *address) BSLS_KEYWORD_OVERRIDE;
+        // Return the memory block at the specified 'address' back to the
+        // underlying allocator, and, if it was sampled, remove it from the
+        // blocks in use of its call site.  If 'address' is 0, this method has
+        // no effect.  The behavior is undefined unless 'address' was returned
+        // by 'allocate' on this object and has not already been deallocated.
+
+    // ACCESSORS
+    double estimatedBytesInUse() const;
+        // Return the number of bytes in use, allocated from this allocator,
+        // estimated from the sampled blocks in use.
+
+    int numCallSites() const;
+        // Return the number of distinct call sites from which sampled blocks
+        // were allocated.
+
+    bsls::Types::Int64 numSampledBlocksInUse() const;
+        // Return the number of sampled blocks in use.
+
+    bsls::Types::Int64 numSampledBlocksTotal() const;
+        // Return the number of sampled blocks allocated since construction.
+
+    bsls::Types::Int64 numSampledBytesInUse() const;
+        // Return the total size (in bytes) of the sampled blocks in use.
+
+    bsls::Types::Int64 numSampledBytesTotal() const;
+        // Return the total size (in bytes) of the sampled blocks allocated
+        // since construction.
+
+    void printCallSites(bsl::ostream& stream, int maxNumCallSites = 10) const;
+        // Write to the specified 'stream', in a human-readable format, the
+        // statistics and the stack traces, resolved to symbols, of the call
+        // sites having the most bytes of sampled blocks in use, up to the
+        // optionally specified 'maxNumCallSites' call sites.  The behavior is
+        // undefined unless '0 <= maxNumCallSites'.  Note that resolving stack
+        // traces is expensive, and is done without blocking the other
+        // operations of this object.
+
+    bsls::Types::Int64 samplingInterval() const;
+        // Return the mean number of bytes allocated between two sampled
+        // allocations.
+
+    void writeProfile(bsl::ostream& stream) const;
+        // Write to the specified 'stream' the profile of the sampled blocks,
+        // in the legacy heap profile format read by the 'pprof' tool.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                         // --------------------------
+                         // class HeapProfileAllocator
+                         // --------------------------
+
+// ACCESSORS
+inline
+bsls::Types::Int64 HeapProfileAllocator::samplingInterval() const
+{
+    return d_samplingInterval;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1009 @@
+// balst_heapprofileallocator.t.cpp                                   -*-C++-*-
+#include <balst_heapprofileallocator.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_threadutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cmath.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_map.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+// 'getStackAddresses' will not be able to trace through our stack frames if
+// we're optimized on Windows
+
+# pragma optimize("", off)
+
+#endif
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// 'balst::HeapProfileAllocator' forwards every request to an underlying
+// allocator, and records a random sample of the allocations, aggregated by
+// call site.  The primary concerns are that the requests are forwarded, that
+// the sampled blocks are recorded and released with the correct statistics
+// and call sites, that the rate of sampling matches the sampling interval so
+// that the estimate of the bytes in use is unbiased, and that the profile is
+// written in the format read by 'pprof'.  A sampling interval of 1, which
+// samples every allocation, makes most of the concerns testable
+// deterministically.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] HeapProfileAllocator(Int64 samplingInterval, Allocator *ba = 0);
+// [ 2] ~HeapProfileAllocator();
+//
+// MANIPULATORS
+// [ 3] void *allocate(bsls::Types::size_type size);
+// [ 3] void deallocate(void *address);
+//
+// ACCESSORS
+// [ 4] double estimatedBytesInUse() const;
+// [ 3] int numCallSites() const;
+// [ 3] bsls::Types::Int64 numSampledBlocksInUse() const;
+// [ 3] bsls::Types::Int64 numSampledBlocksTotal() const;
+// [ 3] bsls::Types::Int64 numSampledBytesInUse() const;
+// [ 3] bsls::Types::Int64 numSampledBytesTotal() const;
+// [ 5] void printCallSites(bsl::ostream& stream, int max = 10) const;
+// [ 2] bsls::Types::Int64 samplingInterval() const;
+// [ 5] void writeProfile(bsl::ostream& stream) const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] USAGE EXAMPLE
+// [ 4] CONCERN: Allocations are sampled at the rate of the interval.
+// [ 6] CONCERN: The 'allocate' and 'deallocate' methods are thread-safe.
+// [ *] CONCERN: In no case does memory come from the global allocator.
+
+// ============================================================================
+//                    STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL VARIABLES / TYPEDEFS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef balst::HeapProfileAllocator Obj;
+typedef bsls::Types::Int64          Int64;
+
+// ============================================================================
+//                  HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static
+bool parseProfile(Int64              *totals,
+                  Int64              *sums,
+                  int                *numCallSites,
+                  bool               *hasMappedLibraries,
+                  const bsl::string&  profile)
+    // Parse the specified 'profile', written by 'writeProfile', and load the
+    // four counts of its header into the specified 'totals', the sums of the
+    // four counts of its call sites into the specified 'sums', the number of
+    // call sites into the specified 'numCallSites', and whether it lists the
+    // mapped libraries into the specified 'hasMappedLibraries'.  Return
+    // 'true' if 'profile' is well-formed, and 'false' otherwise.
+{
+    bsl::istringstream input(profile);
+    bsl::string        line;
+
+    if (!bsl::getline(input, line)) {
+        return false;                                                 // RETURN
+    }
+
+    long long t[4];
+    long long interval;
+    if (5 != bsl::sscanf(
+                        line.c_str(),
+                        "heap profile: %lld: %lld [%lld: %lld] @ heap_v2/%lld",
+                        &t[0], &t[1], &t[2], &t[3], &interval)) {
+        return false;                                                 // RETURN
+    }
+    for (int i = 0; i < 4; ++i) {
+        totals[i] = t[i];
+        sums[i]   = 0;
+    }
+
+    *numCallSites       = 0;
+    *hasMappedLibraries = false;
+
+    while (bsl::getline(input, line)) {
+        if (line.empty()) {
+            break;
+        }
+
+        long long c[4];
+        int       consumed = 0;
+        if (4 != bsl::sscanf(line.c_str(),
+                             "%lld: %lld [%lld: %lld] @%n",
+                             &c[0], &c[1], &c[2], &c[3], &consumed)
+         || 0 == consumed) {
+            return false;                                             // RETURN
+        }
+
+        // Every address is a hexadecimal number preceded by " 0x".
+
+        bsl::istringstream addresses(line.substr(consumed));
+        bsl::string        address;
+        int                numAddresses = 0;
+        while (addresses >> address) {
+            if (address.size() < 3
+             || 0 != address.compare(0, 2, "0x")
+             || bsl::string::npos != address.find_first_not_of(
+                                                     "0123456789abcdef", 2)) {
+                return false;                                         // RETURN
+            }
+            ++numAddresses;
+        }
+        if (0 == numAddresses) {
+            return false;                                             // RETURN
+        }
+
+        for (int i = 0; i < 4; ++i) {
+            sums[i] += c[i];
+        }
+        ++*numCallSites;
+    }
+
+    if (bsl::getline(input, line)) {
+        if ("MAPPED_LIBRARIES:" != line) {
+            return false;                                             // RETURN
+        }
+        *hasMappedLibraries = true;
+    }
+    return true;
+}
+
+static
+void *allocateFromSiteA(Obj *object, bsls::Types::size_type size)
+    // Return a block of the specified 'size' allocated from the specified
+    // 'object'.
+{
+    return object->allocate(size);
+}
+
+static
+void *allocateFromSiteB(Obj *object, bsls::Types::size_type size)
+    // Return a block of the specified 'size' allocated from the specified
+    // 'object'.
+{
+    void *address = object->allocate(size);
+    return address;
+}
+
+namespace TestCase6 {
+
+struct ThreadArgs {
+    // This 'struct' provides the arguments to 'allocateAndDeallocate'.
+
+    Obj *d_obj_p;  // allocator under test
+    int  d_id;     // distinct identifier of the thread
+};
+
+extern "C" void *allocateAndDeallocate(void *arg)
+    // Allocate and deallocate blocks of varying sizes from the allocator
+    // indicated by the specified 'arg', referring to a 'ThreadArgs' object,
+    // verifying that the blocks are not overwritten.
+{
+    ThreadArgs *args = static_cast<ThreadArgs *>(arg);
+    Obj        *obj  = args->d_obj_p;
+    const char  id   = static_cast<char>(args->d_id);
+
+    enum { k_NUM_BLOCKS = 50 };
+
+    char *blocks[k_NUM_BLOCKS];
+    int   sizes[k_NUM_BLOCKS];
+
+    for (int round = 0; round < 200; ++round) {
+        for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+            sizes[i]  = 1 + (i * 37 + round * 11) % 500;
+            blocks[i] = static_cast<char *>(obj->allocate(sizes[i]));
+            bsl::memset(blocks[i], id, sizes[i]);
+        }
+        for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+            if (id != blocks[i][0] || id != blocks[i][sizes[i] - 1]) {
+                ASSERTV(int(id), i, !"Block overwritten");
+            }
+            obj->deallocate(blocks[i]);
+        }
+    }
+    return 0;
+}
+
+}  // close namespace TestCase6
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Profiling the Memory Used by a Service
+///- - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that the memory used by a long-running service grows, and that we
+// want to learn which code holds that memory, without the overhead of
+// recording every allocation.
+//
+// First, we create a heap profile allocator, sampling about one allocation
+// per 64 KiB allocated, and install it as the default allocator:
+//..
+    balst::HeapProfileAllocator profiler(64 * 1024);
+
+    bslma::DefaultAllocatorGuard guard(&profiler);
+//..
+// Then, we run the service, which here caches the results of requests:
+//..
+    bsl::map<int, bsl::string> cache;
+
+    for (int i = 0; i < 10000; ++i) {
+        cache[i].assign(1000, 'x');
+    }
+//..
+// Next, we verify that a sample of the allocations of the cache was recorded,
+// and that the in-use memory estimated from the sample is in the vicinity of
+// the memory used by the cache:
+//..
+    ASSERT(0 < profiler.numSampledBlocksInUse());
+    ASSERT(0 < profiler.numCallSites());
+
+    const double estimate = profiler.estimatedBytesInUse();
+    ASSERT(5000000 < estimate && estimate < 20000000);
+//..
+// Finally, we write the profile, for example to a file, to be analyzed by
+// the 'pprof' tool:
+//..
+    bsl::ostringstream profile;
+    profiler.writeProfile(profile);
+
+    ASSERT(0 == profile.str().find("heap profile: "));
+//..
+// The profile may then be analyzed (after writing it to 'service.heap') with a
+// command such as 'pprof -top <executable> service.heap'.
+
+        if (veryVerbose) {
+            P_(estimate) P(profiler.numSampledBlocksInUse());
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY TEST
+        //
+        // Concerns:
+        //: 1 Concurrent calls to 'allocate' and 'deallocate' forward every
+        //:   request, and record and release the sampled blocks consistently.
+        //
+        // Plan:
+        //: 1 For sampling intervals sampling every allocation and a fraction
+        //:   of them, in several threads, allocate blocks of varying sizes,
+        //:   fill each block with a value distinct to the thread, then verify
+        //:   the contents of every block and deallocate it.  Once the threads
+        //:   are joined, verify that no sampled block remains in use, and
+        //:   that the upstream allocator has no block in use.  (C-1)
+        //
+        // Testing:
+        //   CONCERN: The 'allocate' and 'deallocate' methods are thread-safe.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY TEST" << endl
+                          << "================" << endl;
+
+        enum { k_NUM_THREADS = 8 };
+
+        const Int64 INTERVALS[] = { 1, 1000, 64 * 1024 };
+        const int   NUM_INTERVALS = static_cast<int>(sizeof  INTERVALS
+                                                   / sizeof *INTERVALS);
+
+        for (int ti = 0; ti < NUM_INTERVALS; ++ti) {
+            const Int64 INTERVAL = INTERVALS[ti];
+
+            bslma::TestAllocator ua("upstream", veryVeryVeryVerbose);
+
+            {
+                Obj mX(INTERVAL, &ua);  const Obj& X = mX;
+
+                bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+                TestCase6::ThreadArgs     args[k_NUM_THREADS];
+
+                for (int i = 0; i < k_NUM_THREADS; ++i) {
+                    args[i].d_obj_p = &mX;
+                    args[i].d_id    = i + 1;
+                    ASSERT(0 == bslmt::ThreadUtil::create(
+                                          &handles[i],
+                                          &TestCase6::allocateAndDeallocate,
+                                          &args[i]));
+                }
+                for (int i = 0; i < k_NUM_THREADS; ++i) {
+                    bslmt::ThreadUtil::join(handles[i]);
+                }
+
+                if (veryVerbose) {
+                    T_ P_(INTERVAL) P_(X.numSampledBlocksTotal())
+                    P(X.numCallSites())
+                }
+
+                ASSERTV(INTERVAL, 0 == X.numSampledBlocksInUse());
+                ASSERTV(INTERVAL, 0 == X.numSampledBytesInUse());
+                ASSERTV(INTERVAL, 0 <  X.numSampledBlocksTotal());
+
+                if (1 == INTERVAL) {
+                    ASSERTV(X.numSampledBlocksTotal(),
+                            k_NUM_THREADS * 200 * 50
+                                                == X.numSampledBlocksTotal());
+                }
+            }
+            ASSERTV(INTERVAL, 0 == ua.numBlocksInUse());
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // WRITING AND PRINTING THE PROFILE
+        //
+        // Concerns:
+        //: 1 'writeProfile' writes a header whose counts are those of the
+        //:   sampled blocks, and equal the sums of the counts of the call
+        //:   sites, each listed on a line with its stack.
+        //:
+        //: 2 On Linux, the profile lists the mapped libraries.
+        //:
+        //: 3 'printCallSites' prints at most the specified number of call
+        //:   sites, the call site having the most bytes in use first.
+        //:
+        //: 4 Neither method allocates from the default allocator while the
+        //:   profile is locked, so that an allocator installed as the default
+        //:   allocator does not deadlock.
+        //
+        // Plan:
+        //: 1 Allocate from two call sites, write the profile, parse it, and
+        //:   verify the counts.  (C-1..2)
+        //:
+        //: 2 Print the call sites with varying maxima, and verify the number
+        //:   of call sites printed, and their order.  (C-3)
+        //:
+        //: 3 Repeat P-1..2 with the allocator installed as the default
+        //:   allocator.  (C-4)
+        //
+        // Testing:
+        //   void printCallSites(bsl::ostream& stream, int max = 10) const;
+        //   void writeProfile(bsl::ostream& stream) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "WRITING AND PRINTING THE PROFILE" << endl
+                          << "================================" << endl;
+
+        {
+            bslma::TestAllocator ua("upstream", veryVeryVeryVerbose);
+
+            Obj mX(1, &ua);  const Obj& X = mX;
+
+            void *a[3];
+            for (int i = 0; i < 3; ++i) {
+                a[i] = allocateFromSiteA(&mX, 100);
+            }
+            void *b = allocateFromSiteB(&mX, 1000);
+
+            ASSERT(4    == X.numSampledBlocksInUse());
+            ASSERT(1300 == X.numSampledBytesInUse());
+            ASSERT(2    == X.numCallSites());
+
+            mX.deallocate(a[0]);
+
+            bsl::ostringstream profile;
+            mX.writeProfile(profile);
+
+            const bsl::string& profileString = profile.str();
+
+            if (veryVeryVerbose) {
+                cout << profileString.substr(0, profileString.find("\n\n"))
+                     << endl;
+            }
+
+            Int64 totals[4];
+            Int64 sums[4];
+            int   numCallSites       = 0;
+            bool  hasMappedLibraries = false;
+
+            ASSERT(parseProfile(totals,
+                                sums,
+                                &numCallSites,
+                                &hasMappedLibraries,
+                                profileString));
+
+            ASSERTV(totals[0], 3    == totals[0]);
+            ASSERTV(totals[1], 1200 == totals[1]);
+            ASSERTV(totals[2], 4    == totals[2]);
+            ASSERTV(totals[3], 1300 == totals[3]);
+            for (int i = 0; i < 4; ++i) {
+                ASSERTV(i, totals[i] == sums[i]);
+            }
+            ASSERTV(numCallSites, 2 == numCallSites);
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+            ASSERT(hasMappedLibraries);
+#endif
+
+            // The call site of 'b' has the most bytes in use, and is listed
+            // first.
+
+            ASSERT(profileString.find('\n') ==
+                               profileString.find("\n1: 1000 [1: 1000] @ "));
+
+            for (int max = 0; max <= 3; ++max) {
+                bsl::ostringstream output;
+                mX.printCallSites(output, max);
+
+                const bsl::string& printed = output.str();
+
+                int numPrinted = 0;
+                for (bsl::size_t pos = printed.find("Call site ");
+                     bsl::string::npos != pos;
+                     pos = printed.find("Call site ", pos + 1)) {
+                    ++numPrinted;
+                }
+                ASSERTV(max, numPrinted, bsl::min(max, 2) == numPrinted);
+
+                if (0 < max) {
+                    ASSERTV(max, printed,
+                            0 == printed.find("Call site 1 of 2: 1 sampled "
+                                              "block(s) of 1000 byte(s)"));
+                }
+                if (veryVeryVerbose && 2 == max) {
+                    cout << printed;
+                }
+            }
+
+            mX.deallocate(a[1]);
+            mX.deallocate(a[2]);
+            mX.deallocate(b);
+
+            ASSERT(0 == X.numSampledBlocksInUse());
+        }
+
+        if (verbose) cout << "\nTesting as the default allocator." << endl;
+        {
+            bslma::TestAllocator ua("upstream", veryVeryVeryVerbose);
+
+            Obj mX(1, &ua);  const Obj& X = mX;
+
+            bslma::DefaultAllocatorGuard dag(&mX);
+
+            void *p = allocateFromSiteA(&mX, 100);
+
+            // The streams, and the strings they return, allocate from 'mX'
+            // while the profile is written and printed.
+
+            bsl::ostringstream profile;
+            mX.writeProfile(profile);
+
+            Int64 totals[4];
+            Int64 sums[4];
+            int   numCallSites       = 0;
+            bool  hasMappedLibraries = false;
+
+            ASSERT(parseProfile(totals,
+                                sums,
+                                &numCallSites,
+                                &hasMappedLibraries,
+                                profile.str()));
+            for (int i = 0; i < 4; ++i) {
+                ASSERTV(i, totals[i] == sums[i]);
+            }
+            ASSERT(0 < numCallSites);
+
+            bsl::ostringstream output;
+            mX.printCallSites(output);
+
+            ASSERT(0 == output.str().find("Call site 1 of "));
+            ASSERT(0 <  X.numSampledBlocksInUse());
+
+            mX.deallocate(p);
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // SAMPLING RATE
+        //
+        // Concerns:
+        //: 1 An allocation of 'size' bytes is sampled with probability
+        //:   '1 - exp(-size / samplingInterval)'.
+        //:
+        //: 2 'estimatedBytesInUse' is an unbiased estimate of the bytes in
+        //:   use.
+        //
+        // Plan:
+        //: 1 For several sizes and sampling intervals, allocate many blocks,
+        //:   and verify that the number of sampled blocks is within five
+        //:   standard deviations of its expected value.  (C-1)
+        //:
+        //: 2 Verify that 'estimatedBytesInUse' is within 15% of the bytes in
+        //:   use when enough blocks are sampled.  (C-2)
+        //
+        // Testing:
+        //   double estimatedBytesInUse() const;
+        //   CONCERN: Allocations are sampled at the rate of the interval.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SAMPLING RATE" << endl
+                          << "=============" << endl;
+
+        static const struct {
+            int   d_line;       // source line number
+            int   d_size;       // size of each block
+            Int64 d_interval;   // sampling interval
+            int   d_numBlocks;  // number of blocks allocated
+        } DATA[] = {
+            //LINE  SIZE    INTERVAL  NUM_BLOCKS
+            //----  ----    --------  ----------
+            { L_,      8,       1024,     200000 },
+            { L_,     64,       4096,     100000 },
+            { L_,    100,      65536,     200000 },
+            { L_,   1000,       4096,      20000 },
+            { L_,   5000,       4096,      10000 },
+            { L_,  40000,       4096,       1000 },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE       = DATA[ti].d_line;
+            const int   SIZE       = DATA[ti].d_size;
+            const Int64 INTERVAL   = DATA[ti].d_interval;
+            const int   NUM_BLOCKS = DATA[ti].d_numBlocks;
+
+            bslma::TestAllocator ua("upstream", veryVeryVeryVerbose);
+
+            Obj mX(INTERVAL, &ua);  const Obj& X = mX;
+
+            bsl::vector<void *> blocks(NUM_BLOCKS, static_cast<void *>(0));
+            for (int i = 0; i < NUM_BLOCKS; ++i) {
+                blocks[i] = mX.allocate(SIZE);
+            }
+
+            const double PROBABILITY = 1 - bsl::exp(-double(SIZE) / INTERVAL);
+            const double EXPECTED    = NUM_BLOCKS * PROBABILITY;
+            const double DEVIATION   = bsl::sqrt(EXPECTED * (1 - PROBABILITY));
+            const double NUM_SAMPLED = double(X.numSampledBlocksInUse());
+
+            const double BYTES_IN_USE = double(SIZE) * NUM_BLOCKS;
+            const double ESTIMATE     = X.estimatedBytesInUse();
+
+            if (veryVerbose) {
+                T_ P_(LINE) P_(EXPECTED) P_(NUM_SAMPLED) P_(BYTES_IN_USE)
+                P(ESTIMATE)
+            }
+
+            ASSERTV(LINE, EXPECTED, NUM_SAMPLED,
+                    bsl::fabs(NUM_SAMPLED - EXPECTED) <= 5 * DEVIATION + 1);
+
+            ASSERTV(LINE, X.numSampledBlocksTotal() == NUM_SAMPLED);
+            ASSERTV(LINE, X.numSampledBytesInUse()  == NUM_SAMPLED * SIZE);
+
+            if (NUM_SAMPLED >= 400) {
+                ASSERTV(LINE, BYTES_IN_USE, ESTIMATE,
+                        bsl::fabs(ESTIMATE - BYTES_IN_USE)
+                                                       <= 0.15 * BYTES_IN_USE);
+            }
+
+            for (int i = 0; i < NUM_BLOCKS; ++i) {
+                mX.deallocate(blocks[i]);
+            }
+
+            ASSERTV(LINE, 0 == X.numSampledBlocksInUse());
+            ASSERTV(LINE, 0 == X.estimatedBytesInUse());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // SAMPLES AND CALL SITES
+        //
+        // Concerns:
+        //: 1 'allocate' forwards the request to the underlying allocator, and
+        //:   'deallocate' returns the block to it.
+        //:
+        //: 2 With a sampling interval of 1, every allocation is sampled.
+        //:
+        //: 3 Allocations from the same call site are aggregated, and those
+        //:   from distinct call sites are not.
+        //:
+        //: 4 Deallocating a sampled block removes it from the blocks in use,
+        //:   but not from the totals, of its call site.
+        //:
+        //: 5 'allocate(0)' returns 0 and samples nothing, and 'deallocate(0)'
+        //:   has no effect.
+        //
+        // Plan:
+        //: 1 Allocate blocks of distinct sizes from two call sites, and
+        //:   verify the accessors and the underlying allocator.  (C-1..3)
+        //:
+        //: 2 Deallocate the blocks, and verify the accessors and the
+        //:   underlying allocator.  (C-4)
+        //:
+        //: 3 Verify 'allocate(0)' and 'deallocate(0)' directly.  (C-5)
+        //
+        // Testing:
+        //   void *allocate(bsls::Types::size_type size);
+        //   void deallocate(void *address);
+        //   int numCallSites() const;
+        //   bsls::Types::Int64 numSampledBlocksInUse() const;
+        //   bsls::Types::Int64 numSampledBlocksTotal() const;
+        //   bsls::Types::Int64 numSampledBytesInUse() const;
+        //   bsls::Types::Int64 numSampledBytesTotal() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SAMPLES AND CALL SITES" << endl
+                          << "======================" << endl;
+
+        bslma::TestAllocator ua("upstream", veryVeryVeryVerbose);
+
+        Obj mX(1, &ua);  const Obj& X = mX;
+
+        ASSERT(0 == X.numCallSites());
+        ASSERT(0 == X.numSampledBlocksInUse());
+        ASSERT(0 == X.numSampledBlocksTotal());
+        ASSERT(0 == X.numSampledBytesInUse());
+        ASSERT(0 == X.numSampledBytesTotal());
+
+        enum { k_NUM_A = 10, k_NUM_B = 5 };
+
+        void  *a[k_NUM_A];
+        void  *b[k_NUM_B];
+        Int64  bytesA = 0;
+        Int64  bytesB = 0;
+
+        for (int i = 0; i < k_NUM_A; ++i) {
+            const Int64 NUM_BLOCKS = ua.numBlocksInUse();
+
+            a[i]    = allocateFromSiteA(&mX, i + 1);
+            bytesA += i + 1;
+
+            ASSERTV(i, ua.numBlocksInUse() > NUM_BLOCKS);
+            ASSERTV(i, 1 == X.numCallSites());
+            ASSERTV(i, i + 1  == X.numSampledBlocksInUse());
+            ASSERTV(i, bytesA == X.numSampledBytesInUse());
+
+            bsl::memset(a[i], 'a', i + 1);
+        }
+
+        for (int i = 0; i < k_NUM_B; ++i) {
+            b[i]    = allocateFromSiteB(&mX, 1000 * (i + 1));
+            bytesB += 1000 * (i + 1);
+
+            ASSERTV(i, 2 == X.numCallSites());
+            bsl::memset(b[i], 'b', 1000 * (i + 1));
+        }
+
+        ASSERT(k_NUM_A + k_NUM_B == X.numSampledBlocksInUse());
+        ASSERT(k_NUM_A + k_NUM_B == X.numSampledBlocksTotal());
+        ASSERT(bytesA + bytesB   == X.numSampledBytesInUse());
+        ASSERT(bytesA + bytesB   == X.numSampledBytesTotal());
+        ASSERT(bytesA + bytesB   <= ua.numBytesInUse());
+
+        for (int i = 0; i < k_NUM_A; ++i) {
+            const Int64 NUM_BLOCKS = ua.numBlocksInUse();
+
+            mX.deallocate(a[i]);
+
+            ASSERTV(i, ua.numBlocksInUse() < NUM_BLOCKS);
+        }
+
+        ASSERT(k_NUM_B         == X.numSampledBlocksInUse());
+        ASSERT(bytesB          == X.numSampledBytesInUse());
+        ASSERT(k_NUM_A + k_NUM_B == X.numSampledBlocksTotal());
+        ASSERT(bytesA + bytesB == X.numSampledBytesTotal());
+        ASSERT(2               == X.numCallSites());
+
+        for (int i = 0; i < k_NUM_B; ++i) {
+            mX.deallocate(b[i]);
+        }
+
+        ASSERT(0               == X.numSampledBlocksInUse());
+        ASSERT(0               == X.numSampledBytesInUse());
+        ASSERT(bytesA + bytesB == X.numSampledBytesTotal());
+
+        if (verbose) cout << "\nTesting 'allocate(0)' and 'deallocate(0)'."
+                          << endl;
+        {
+            const Int64 NUM_BLOCKS = ua.numBlocksTotal();
+
+            ASSERT(0 == mX.allocate(0));
+            mX.deallocate(0);
+
+            ASSERT(NUM_BLOCKS          == ua.numBlocksTotal());
+            ASSERT(k_NUM_A + k_NUM_B == X.numSampledBlocksTotal());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 The constructor creates an allocator having the specified
+        //:   sampling interval, or 'k_DEFAULT_SAMPLING_INTERVAL' if none is
+        //:   specified.
+        //:
+        //: 2 Requests, and the memory of the profile, are supplied by the
+        //:   allocator supplied at construction, or by the
+        //:   'bslma::MallocFreeAllocator' singleton if none is supplied, and
+        //:   never by the default allocator.
+        //:
+        //: 3 The destructor returns the memory of the profile.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create allocators with and without the optional arguments, and
+        //:   verify 'samplingInterval'.  (C-1)
+        //:
+        //: 2 Allocate sampled blocks with and without a supplied allocator,
+        //:   and verify the source of the memory.  (C-2)
+        //:
+        //: 3 Destroy the allocators, and verify that no memory remains in use.
+        //:   (C-3)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   HeapProfileAllocator(Int64 samplingInterval, Allocator *ba = 0);
+        //   ~HeapProfileAllocator();
+        //   bsls::Types::Int64 samplingInterval() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND BASIC ACCESSORS" << endl
+                          << "============================" << endl;
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator ua("upstream", veryVeryVeryVerbose);
+
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(Obj::k_DEFAULT_SAMPLING_INTERVAL == X.samplingInterval());
+            ASSERT(512 * 1024                       == X.samplingInterval());
+
+            void *p = mX.allocate(4 * 1024 * 1024);  // sampled with
+                                                     // probability 99.97%
+            ASSERT(0 != p);
+            mX.deallocate(p);
+        }
+        {
+            Obj mX(1);  const Obj& X = mX;
+
+            ASSERT(1 == X.samplingInterval());
+
+            void *p = mX.allocate(100);
+            ASSERT(1 == X.numSampledBlocksInUse());
+            mX.deallocate(p);
+        }
+        ASSERT(0 == da.numBlocksTotal());
+
+        {
+            Obj mX(1000, &ua);  const Obj& X = mX;
+
+            ASSERT(1000 == X.samplingInterval());
+
+            void *p = mX.allocate(1000 * 1000);
+            ASSERT(1 == X.numSampledBlocksInUse());
+
+            // The block, and the memory of the profile, come from 'ua'.
+
+            ASSERT(1 <  ua.numBlocksInUse());
+            ASSERT(0 == da.numBlocksTotal());
+
+            mX.deallocate(p);
+            ASSERT(0 <  ua.numBlocksInUse());
+        }
+        ASSERT(0 == ua.numBlocksInUse());
+        ASSERT(0 == da.numBlocksTotal());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(Obj(1));
+            ASSERT_FAIL(Obj(0));
+            ASSERT_FAIL(Obj(-1));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Allocate and deallocate blocks, sampling every allocation, and
+        //:   verify the statistics and the profile.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ua("upstream", veryVeryVeryVerbose);
+
+        {
+            Obj mX(1, &ua);  const Obj& X = mX;
+
+            void *p1 = mX.allocate(10);
+            void *p2 = mX.allocate(20);
+
+            ASSERT(2  == X.numSampledBlocksInUse());
+            ASSERT(30 == X.numSampledBytesInUse());
+            ASSERT(0  <  X.numCallSites());
+
+            mX.deallocate(p1);
+
+            ASSERT(1  == X.numSampledBlocksInUse());
+            ASSERT(20 == X.numSampledBytesInUse());
+            ASSERT(2  == X.numSampledBlocksTotal());
+            ASSERT(30 == X.numSampledBytesTotal());
+
+            bsl::ostringstream profile(&ua);
+            X.writeProfile(profile);
+
+            if (veryVerbose) {
+                const bsl::string& s = profile.str();
+                cout << s.substr(0, s.find("\n\n")) << endl;
+            }
+
+            ASSERT(0 == profile.str().find(
+                                 "heap profile: 1: 20 [2: 30] @ heap_v2/1\n"));
+
+            mX.deallocate(p2);
+
+            ASSERT(0  == X.numSampledBlocksInUse());
+        }
+        ASSERT(0 == ua.numBlocksInUse());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------------------------------------------------------
+// ----------------------------- END-OF-FILE ----------------------------------
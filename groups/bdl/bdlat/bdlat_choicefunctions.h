@@ -40,7 +40,12 @@ BSLS_IDENT("$Id: $")
 // through the 'bdlat_ChoiceFunctions' 'namespace'.
 //
 // This component specializes all of these functions for types that have the
-// 'bdlat_TypeTraitBasicChoice' trait.
+// 'bdlat_TypeTraitBasicChoice' trait.  If such a type also declares the
+// 'SELECTION_INFO_ARRAY' and 'NUM_SELECTIONS' members that
+// 'bas_codegen.pl'-generated types declare, the functions taking a selection
+// name find the selection in a 'bdlat_NameLookupTable' built from
+// 'SELECTION_INFO_ARRAY', and then make it by its id.  A name that is not in
+// the table is looked up by the type itself.
 //
 // Types that do not have the 'bdlat_TypeTraitBasicChoice' trait can be plugged
 // into the 'bdlat' framework.  This is done by overloading the 'bdlat_choice*'
@@ -453,6 +458,7 @@ BSLS_IDENT("$Id: $")
 #include <bdlscm_version.h>
 
 #include <bdlat_bdeatoverrides.h>
+#include <bdlat_namelookuptable.h>
 #include <bdlat_selectioninfo.h>
 #include <bdlat_typetraits.h>
 
@@ -476,6 +482,57 @@ BSLS_IDENT("$Id: $")
 
 namespace BloombergLP {
 
+                      // ================================
+                      // struct bdlat_ChoiceFunctions_Imp
+                      // ================================
+
+struct bdlat_ChoiceFunctions_Imp {
+    // [!PRIVATE!] This 'struct' provides a namespace for functions that find a
+    // selection of a choice type by name in a 'bdlat_NameLookupTable' built
+    // from the selection info array of the type.
+
+    // TYPES
+    typedef char YesType;
+    struct NoType { char d_dummy[2]; };
+
+    // CLASS METHODS
+    template <class TYPE>
+    static YesType hasSelectionInfoArray(
+                          char (*)[sizeof(TYPE::SELECTION_INFO_ARRAY[0])
+                                   * (TYPE::NUM_SELECTIONS + 1)]);
+    template <class TYPE>
+    static NoType hasSelectionInfoArray(...);
+        // Return 'YesType' if the (template parameter) 'TYPE' declares the
+        // 'SELECTION_INFO_ARRAY' and 'NUM_SELECTIONS' members, and 'NoType'
+        // otherwise.  Note that these functions are only declared, to be used
+        // in unevaluated contexts.
+
+    template <class TYPE>
+    static const bdlat_SelectionInfo *lookupSelectionInfo(
+                                                const char        *name,
+                                                int                nameLength,
+                                                bslmf::MetaInt<0>);
+    template <class TYPE>
+    static const bdlat_SelectionInfo *lookupSelectionInfo(
+                                                const char        *name,
+                                                int                nameLength,
+                                                bslmf::MetaInt<1>);
+        // Return the address of the element of 'TYPE::SELECTION_INFO_ARRAY'
+        // having the specified 'name' of the specified 'nameLength' if the
+        // (template parameter) 'TYPE' declares the 'SELECTION_INFO_ARRAY' and
+        // 'NUM_SELECTIONS' members, as indicated by the type of the last
+        // argument, and such an element exists, and 0 otherwise.
+
+    template <class TYPE>
+    static const bdlat_SelectionInfo *lookupSelectionInfo(
+                                                       const char *name,
+                                                       int         nameLength);
+        // Return the address of the element of 'TYPE::SELECTION_INFO_ARRAY'
+        // having the specified 'name' of the specified 'nameLength', and 0 if
+        // there is no such element or the (template parameter) 'TYPE' does not
+        // declare the 'SELECTION_INFO_ARRAY' and 'NUM_SELECTIONS' members.
+};
+
                       // ===============================
                       // namespace bdlat_ChoiceFunctions
                       // ===============================
@@ -617,6 +674,49 @@ namespace bdlat_ChoiceFunctions {
 //                        INLINE FUNCTION DEFINITIONS
 // ============================================================================
 
+                      // --------------------------------
+                      // struct bdlat_ChoiceFunctions_Imp
+                      // --------------------------------
+
+// CLASS METHODS
+template <class TYPE>
+inline
+const bdlat_SelectionInfo *bdlat_ChoiceFunctions_Imp::lookupSelectionInfo(
+                                                             const char *,
+                                                             int,
+                                                             bslmf::MetaInt<0>)
+{
+    return 0;
+}
+
+template <class TYPE>
+inline
+const bdlat_SelectionInfo *bdlat_ChoiceFunctions_Imp::lookupSelectionInfo(
+                                                const char        *name,
+                                                int                nameLength,
+                                                bslmf::MetaInt<1>)
+{
+    static bdlat_NameLookupTable<TYPE::NUM_SELECTIONS> lookupTable;
+
+    return lookupTable.lookup(TYPE::SELECTION_INFO_ARRAY, name, nameLength);
+}
+
+template <class TYPE>
+inline
+const bdlat_SelectionInfo *bdlat_ChoiceFunctions_Imp::lookupSelectionInfo(
+                                                       const char *name,
+                                                       int         nameLength)
+{
+    enum {
+        k_HAS_INFO_ARRAY = sizeof(YesType)
+                        == sizeof(hasSelectionInfoArray<TYPE>(0))
+    };
+
+    return lookupSelectionInfo<TYPE>(name,
+                                     nameLength,
+                                     bslmf::MetaInt<k_HAS_INFO_ARRAY>());
+}
+
                       // -------------------------------
                       // namespace bdlat_ChoiceFunctions
                       // -------------------------------
@@ -750,6 +850,14 @@ int bdlat_ChoiceFunctions::bdlat_choiceMakeSelection(
 {
     BSLMF_ASSERT((bslalg::HasTrait<TYPE, bdlat_TypeTraitBasicChoice>::VALUE));
 
+    const bdlat_SelectionInfo *selectionInfo =
+                       bdlat_ChoiceFunctions_Imp::lookupSelectionInfo<TYPE>(
+                                                         selectionName,
+                                                         selectionNameLength);
+    if (selectionInfo) {
+        return object->makeSelection(selectionInfo->d_id);            // RETURN
+    }
+
     return object->makeSelection(selectionName, selectionNameLength);
 }
 
@@ -791,7 +899,10 @@ bool bdlat_ChoiceFunctions::bdlat_choiceHasSelection(
 {
     BSLMF_ASSERT((bslalg::HasTrait<TYPE, bdlat_TypeTraitBasicChoice>::VALUE));
 
-    return 0 != object.lookupSelectionInfo(selectionName, selectionNameLength);
+    return 0 != bdlat_ChoiceFunctions_Imp::lookupSelectionInfo<TYPE>(
+                                                         selectionName,
+                                                         selectionNameLength)
+        || 0 != object.lookupSelectionInfo(selectionName, selectionNameLength);
 }
 
 template <class TYPE>
@@ -42,6 +42,8 @@ using namespace bsl;  // automatically added by script
 // [ 2] bdlat_SelectionInfo Obj::selectionInfo(const TYPE&, int);
 // [ 2] const char *Obj::className(const TYPE&);
 // [ 2] int Obj::numSelections(const TYPE&);
+// [ 5] int makeSelection(TYPE *, const char *, int);
+// [ 5] bool hasSelection(const TYPE&, const char *, int);
 //-----------------------------------------------------------------------------
 // [ 1] METHOD FORWARDING TEST
 // [ 2] INFO ACCESS TEST
@@ -103,6 +105,7 @@ namespace Obj = bdlat_ChoiceFunctions;
 // ----------------------------------------------------------------------------
 
 static int globalFlag = 0;
+static int globalId   = 0;
 
 namespace geom {
 
@@ -196,9 +199,10 @@ class Figure {
         return *this;
     }
 
-    int makeSelection(int)
+    int makeSelection(int id)
     {
         globalFlag = 1;
+        globalId   = id;
         return globalFlag;
     }
 
@@ -673,6 +677,67 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING LOOKUP BY NAME
+        //
+        // Concerns:
+        //: 1 For a type declaring 'SELECTION_INFO_ARRAY' and
+        //:   'NUM_SELECTIONS', the functions taking a selection name find each
+        //:   selection of the info array, and then make it by its id.
+        //:
+        //: 2 Any other name is forwarded to the functions of the type taking
+        //:   a name.
+        //
+        // Plan:
+        //: 1 For each name in the info array of 'geom::Figure', and for some
+        //:   names that are not, call the name-based functions, and verify,
+        //:   using 'globalFlag' and 'globalId', which method of 'Figure' is
+        //:   called, and with which id.  (C-1..2)
+        //
+        // Testing:
+        //   int makeSelection(TYPE *, const char *, int);
+        //   bool hasSelection(const TYPE&, const char *, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING LOOKUP BY NAME"
+                          << "\n======================" << endl;
+
+        static const struct {
+            int         d_line;  // source line number
+            const char *d_name;  // selection name
+            int         d_id;    // selection id, or 0 if not in info array
+        } DATA[] = {
+            //LINE  NAME       ID
+            //----  ---------  ---------------------------------
+            { L_,   "Circle",  geom::Figure::SELECTION_ID_CIRCLE  },
+            { L_,   "Polygon", geom::Figure::SELECTION_ID_POLYGON },
+            { L_,   "",        0                                  },
+            { L_,   "circle",  0                                  },
+            { L_,   "Circles", 0                                  },
+            { L_,   "dummy",   0                                  },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        geom::Figure mX;  const geom::Figure& X = mX;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE   = DATA[ti].d_line;
+            const char *NAME   = DATA[ti].d_name;
+            const int   LENGTH = static_cast<int>(bsl::strlen(NAME));
+            const int   ID     = DATA[ti].d_id;
+
+            if (veryVerbose) { P_(LINE) P_(NAME) P(ID) }
+
+            globalFlag = 0;
+            globalId   = 0;
+            Obj::makeSelection(&mX, NAME, LENGTH);
+            ASSERTV(LINE, globalFlag, (ID ? 1 : 2) == globalFlag);
+            ASSERTV(LINE, globalId,   ID == globalId);
+
+            ASSERTV(LINE, (0 != ID) == Obj::hasSelection(X, NAME, LENGTH));
+        }
+      } break;
       case 4: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
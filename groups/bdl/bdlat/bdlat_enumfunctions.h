@@ -36,7 +36,12 @@ BSLS_IDENT("$Id: $")
 // behavior through the 'bdlat_EnumFunctions' 'namespace'.
 //
 // This component specializes all of these functions for types that have the
-// 'bdlat_TypeTraitBasicEnumeration' trait.
+// 'bdlat_TypeTraitBasicEnumeration' trait.  If the wrapper 'struct' of such a
+// type (see 'bdlat_BasicEnumerationWrapper') also declares the
+// 'ENUMERATOR_INFO_ARRAY' and 'NUM_ENUMERATORS' members that
+// 'bas_codegen.pl'-generated types declare, 'fromString' finds the enumerator
+// in a 'bdlat_NameLookupTable' built from 'ENUMERATOR_INFO_ARRAY'.  A string
+// that is not in the table is looked up by the wrapper itself.
 //
 // Types that do not have the 'bdlat_TypeTraitBasicEnumeration' trait may have
 // the functions in the 'bdlat_EnumFunctions' 'namespace' specialized for them.
@@ -265,6 +270,8 @@ BSLS_IDENT("$Id: $")
 #include <bdlscm_version.h>
 
 #include <bdlat_bdeatoverrides.h>
+#include <bdlat_enumeratorinfo.h>
+#include <bdlat_namelookuptable.h>
 #include <bdlat_typetraits.h>
 
 #include <bslalg_hastrait.h>
@@ -290,6 +297,58 @@ BSLS_IDENT("$Id: $")
 
 namespace BloombergLP {
 
+                       // ==============================
+                       // struct bdlat_EnumFunctions_Imp
+                       // ==============================
+
+struct bdlat_EnumFunctions_Imp {
+    // [!PRIVATE!] This 'struct' provides a namespace for functions that find
+    // an enumerator of an enumeration type by name in a
+    // 'bdlat_NameLookupTable' built from the enumerator info array of the
+    // type.
+
+    // TYPES
+    typedef char YesType;
+    struct NoType { char d_dummy[2]; };
+
+    // CLASS METHODS
+    template <class TYPE>
+    static YesType hasEnumeratorInfoArray(
+                          char (*)[sizeof(TYPE::ENUMERATOR_INFO_ARRAY[0])
+                                   * (TYPE::NUM_ENUMERATORS + 1)]);
+    template <class TYPE>
+    static NoType hasEnumeratorInfoArray(...);
+        // Return 'YesType' if the (template parameter) 'TYPE' declares the
+        // 'ENUMERATOR_INFO_ARRAY' and 'NUM_ENUMERATORS' members, and 'NoType'
+        // otherwise.  Note that these functions are only declared, to be used
+        // in unevaluated contexts.
+
+    template <class TYPE>
+    static const bdlat_EnumeratorInfo *lookupEnumeratorInfo(
+                                                const char        *name,
+                                                int                nameLength,
+                                                bslmf::MetaInt<0>);
+    template <class TYPE>
+    static const bdlat_EnumeratorInfo *lookupEnumeratorInfo(
+                                                const char        *name,
+                                                int                nameLength,
+                                                bslmf::MetaInt<1>);
+        // Return the address of the element of 'TYPE::ENUMERATOR_INFO_ARRAY'
+        // having the specified 'name' of the specified 'nameLength' if the
+        // (template parameter) 'TYPE' declares the 'ENUMERATOR_INFO_ARRAY' and
+        // 'NUM_ENUMERATORS' members, as indicated by the type of the last
+        // argument, and such an element exists, and 0 otherwise.
+
+    template <class TYPE>
+    static const bdlat_EnumeratorInfo *lookupEnumeratorInfo(
+                                                       const char *name,
+                                                       int         nameLength);
+        // Return the address of the element of 'TYPE::ENUMERATOR_INFO_ARRAY'
+        // having the specified 'name' of the specified 'nameLength', and 0 if
+        // there is no such element or the (template parameter) 'TYPE' does not
+        // declare the 'ENUMERATOR_INFO_ARRAY' and 'NUM_ENUMERATORS' members.
+};
+
                       // =============================
                       // namespace bdlat_EnumFunctions
                       // =============================
@@ -384,6 +443,49 @@ namespace bdlat_EnumFunctions {
 //                        INLINE FUNCTION DEFINITIONS
 // ============================================================================
 
+                       // ------------------------------
+                       // struct bdlat_EnumFunctions_Imp
+                       // ------------------------------
+
+// CLASS METHODS
+template <class TYPE>
+inline
+const bdlat_EnumeratorInfo *bdlat_EnumFunctions_Imp::lookupEnumeratorInfo(
+                                                             const char *,
+                                                             int,
+                                                             bslmf::MetaInt<0>)
+{
+    return 0;
+}
+
+template <class TYPE>
+inline
+const bdlat_EnumeratorInfo *bdlat_EnumFunctions_Imp::lookupEnumeratorInfo(
+                                                const char        *name,
+                                                int                nameLength,
+                                                bslmf::MetaInt<1>)
+{
+    static bdlat_NameLookupTable<TYPE::NUM_ENUMERATORS> lookupTable;
+
+    return lookupTable.lookup(TYPE::ENUMERATOR_INFO_ARRAY, name, nameLength);
+}
+
+template <class TYPE>
+inline
+const bdlat_EnumeratorInfo *bdlat_EnumFunctions_Imp::lookupEnumeratorInfo(
+                                                       const char *name,
+                                                       int         nameLength)
+{
+    enum {
+        k_HAS_INFO_ARRAY = sizeof(YesType)
+                        == sizeof(hasEnumeratorInfoArray<TYPE>(0))
+    };
+
+    return lookupEnumeratorInfo<TYPE>(name,
+                                      nameLength,
+                                      bslmf::MetaInt<k_HAS_INFO_ARRAY>());
+}
+
                       // -----------------------------
                       // namespace bdlat_EnumFunctions
                       // -----------------------------
@@ -479,6 +581,16 @@ int bdlat_EnumFunctions::bdlat_enumFromString(TYPE       *result,
              (bslalg::HasTrait<TYPE, bdlat_TypeTraitBasicEnumeration>::VALUE));
 
     typedef typename bdlat_BasicEnumerationWrapper<TYPE>::Wrapper Wrapper;
+
+    const bdlat_EnumeratorInfo *enumeratorInfo =
+                        bdlat_EnumFunctions_Imp::lookupEnumeratorInfo<Wrapper>(
+                                                                string,
+                                                                stringLength);
+    if (enumeratorInfo) {
+        *result = static_cast<TYPE>(enumeratorInfo->d_value);
+        return 0;                                                     // RETURN
+    }
+
     return Wrapper::fromString(result, string, stringLength);
 }
 
@@ -41,6 +41,7 @@ using namespace bsl;  // automatically added by script
 // [ 3] struct IsEnumeration
 // [ 2] const char *className(TYPE);
 // [ 2] int numEnumerators(TYPE);
+// [ 5] int fromString(TYPE *, const char *, int);
 //-----------------------------------------------------------------------------
 // [ 1] METHOD FORWARDING TEST
 // [ 2] TESTING META-FUNCTIONS
@@ -727,6 +728,80 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING LOOKUP BY NAME
+        //
+        // Concerns:
+        //: 1 For an enumeration whose wrapper declares
+        //:   'ENUMERATOR_INFO_ARRAY' and 'NUM_ENUMERATORS', 'fromString'
+        //:   finds each enumerator of the info array.
+        //:
+        //: 2 Any other string is forwarded to the 'fromString' method of the
+        //:   wrapper.
+        //
+        // Plan:
+        //: 1 Convert each name in the info array of 'geom::PolygonType', and
+        //:   some strings that are not, using 'fromString', and verify the
+        //:   result.  Note that 'PolygonType::fromString' loads 'RHOMBUS' for
+        //:   any string.  (C-1..2)
+        //:
+        //: 2 Convert strings that match the names of 'test::PrimaryColor'
+        //:   only without regard to case, which its 'fromString' accepts, and
+        //:   verify the result.  (C-2)
+        //
+        // Testing:
+        //   int fromString(TYPE *, const char *, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING LOOKUP BY NAME"
+                          << "\n======================" << endl;
+
+        static const struct {
+            int                      d_line;   // source line number
+            const char              *d_string; // string to convert
+            geom::PolygonType::Value d_value;  // expected value
+        } DATA[] = {
+            //LINE  STRING       VALUE
+            //----  -----------  ----------------------------
+            { L_,   "Triangle",  geom::PolygonType::TRIANGLE  },
+            { L_,   "Rectangle", geom::PolygonType::RECTANGLE },
+            { L_,   "Rhombus",   geom::PolygonType::RHOMBUS   },
+            { L_,   "",          geom::PolygonType::RHOMBUS   },
+            { L_,   "triangle",  geom::PolygonType::RHOMBUS   },
+            { L_,   "Triangles", geom::PolygonType::RHOMBUS   },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int                      LINE   = DATA[ti].d_line;
+            const char                    *STRING = DATA[ti].d_string;
+            const int                      LENGTH =
+                                       static_cast<int>(bsl::strlen(STRING));
+            const geom::PolygonType::Value VALUE  = DATA[ti].d_value;
+
+            if (veryVerbose) { P_(LINE) P_(STRING) P(VALUE) }
+
+            geom::PolygonType::Value mX = geom::PolygonType::TRIANGLE;
+            if (geom::PolygonType::TRIANGLE == VALUE) {
+                mX = geom::PolygonType::RECTANGLE;
+            }
+
+            ASSERTV(LINE, 0 == Obj::fromString(&mX, STRING, LENGTH));
+            ASSERTV(LINE, mX, VALUE == mX);
+        }
+
+        test::PrimaryColor::Value mX = test::PrimaryColor::BLUE;
+
+        ASSERT(0 == Obj::fromString(&mX, "GREEN", 5));
+        ASSERT(test::PrimaryColor::GREEN == mX);
+
+        ASSERT(0 == Obj::fromString(&mX, "red", 3));
+        ASSERT(test::PrimaryColor::RED   == mX);
+
+        ASSERT(0 != Obj::fromString(&mX, "Purple", 6));
+        ASSERT(test::PrimaryColor::RED   == mX);
+      } break;
         case 4: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
@@ -0,0 +1,446 @@
+// bdlat_namelookuptable.h                                            -*-C++-*-
+#ifndef INCLUDED_BDLAT_NAMELOOKUPTABLE
+#define INCLUDED_BDLAT_NAMELOOKUPTABLE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a hash table to look up attribute info objects by name.
+//
+//@CLASSES:
+//  bdlat_NameLookupTable: statically initialized name-to-info hash table
+//
+//@SEE_ALSO: bdlat_attributeinfo, bdlat_selectioninfo, bdlat_enumeratorinfo
+//
+//@DESCRIPTION: This component provides a class template,
+// 'bdlat_NameLookupTable', that finds, by name, an element of a static array
+// of 'bdlat_AttributeInfo', 'bdlat_SelectionInfo', or 'bdlat_EnumeratorInfo'
+// objects in (expected) constant time.  Decoders such as 'baljsn::Decoder'
+// and 'balxml::Decoder' look up every element that they decode by name,
+// through the name-based functions of 'bdlat_SequenceFunctions',
+// 'bdlat_ChoiceFunctions', and 'bdlat_EnumFunctions'.  The lookup methods of
+// generated types search their info arrays linearly, comparing the name with,
+// on average, half of the names of the type; a 'bdlat_NameLookupTable'
+// compares it with (typically) one name.  The default implementations of
+// those functions (for 'bas_codegen.pl'-generated types) therefore look names
+// up in a 'bdlat_NameLookupTable' built from the 'ATTRIBUTE_INFO_ARRAY',
+// 'SELECTION_INFO_ARRAY', or 'ENUMERATOR_INFO_ARRAY' of the type, so that
+// generated types benefit without being regenerated.  Other types can use a
+// 'bdlat_NameLookupTable' directly, as shown in the usage example below.
+//
+// A 'bdlat_NameLookupTable' is a POD type having no constructor, whose public
+// data members are, by design, zero-initialized when an object is defined
+// with static storage duration (e.g., as a function-scope 'static' variable).
+// Such an object is usable immediately, including during static
+// initialization, and requires no synchronization (or function-scope static
+// guard) to be shared among threads: the table is built from the info array
+// by the first call to 'lookup', and a thread that calls 'lookup' while
+// another thread is building the table searches the info array linearly
+// instead of waiting.  Building the table allocates no memory; the slots of
+// the table are data members of the object, and the number of slots is a
+// power of two chosen at compile time from the 'NUM_NAMES' template parameter.
+//
+// The table uses open addressing with linear probing, filled to at most half
+// of its slots.  When building the table, 'lookup' tries several hash seeds
+// and keeps the seed that minimizes the total displacement of the names from
+// their home slots; for small arrays the chosen seed usually places every name
+// in its home slot, so that the table is a perfect hash of the names.
+//
+// Note that a given 'bdlat_NameLookupTable' object must always be used with
+// the same info array, and that two names in the array having the same value
+// are found as a linear search would: 'lookup' returns the element having the
+// lower index.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Looking Up the Attributes of a Sequence
+/// - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we have a sequence type, 'Employee', that describes its attributes
+// with a static array of 'bdlat_AttributeInfo' objects:
+//..
+//  class Employee {
+//    public:
+//      // TYPES
+//      enum {
+//          ATTRIBUTE_ID_NAME   = 0,
+//          ATTRIBUTE_ID_AGE    = 1,
+//          ATTRIBUTE_ID_SALARY = 2
+//      };
+//
+//      enum { NUM_ATTRIBUTES = 3 };
+//
+//      // CONSTANTS
+//      static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
+//
+//      // CLASS METHODS
+//      static const bdlat_AttributeInfo *lookupAttributeInfo(
+//                                                     const char *name,
+//                                                     int         nameLength);
+//          // Return attribute information for the attribute indicated by
+//          // the specified 'name' of the specified 'nameLength' if the
+//          // attribute exists, and 0 otherwise.
+//
+//      // ...
+//  };
+//
+//  const bdlat_AttributeInfo Employee::ATTRIBUTE_INFO_ARRAY[] = {
+//      { ATTRIBUTE_ID_NAME,   "name",   sizeof("name") - 1,   "", 0 },
+//      { ATTRIBUTE_ID_AGE,    "age",    sizeof("age") - 1,    "", 0 },
+//      { ATTRIBUTE_ID_SALARY, "salary", sizeof("salary") - 1, "", 0 }
+//  };
+//..
+// Rather than comparing 'name' with each element of 'ATTRIBUTE_INFO_ARRAY',
+// 'lookupAttributeInfo' looks the name up in a function-scope static
+// 'bdlat_NameLookupTable', which needs neither an initializer nor a guard:
+//..
+//  const bdlat_AttributeInfo *Employee::lookupAttributeInfo(
+//                                                      const char *name,
+//                                                      int         nameLength)
+//  {
+//      static bdlat_NameLookupTable<NUM_ATTRIBUTES> lookupTable;
+//
+//      return lookupTable.lookup(ATTRIBUTE_INFO_ARRAY, name, nameLength);
+//  }
+//..
+// Finally, we look up some names:
+//..
+//  const bdlat_AttributeInfo *info = Employee::lookupAttributeInfo("age", 3);
+//  assert(info);
+//  assert(Employee::ATTRIBUTE_ID_AGE == info->d_id);
+//
+//  info = Employee::lookupAttributeInfo("salary", 6);
+//  assert(info);
+//  assert(Employee::ATTRIBUTE_ID_SALARY == info->d_id);
+//
+//  assert(0 == Employee::lookupAttributeInfo("sal", 3));
+//  assert(0 == Employee::lookupAttributeInfo("title", 5));
+//..
+
+#include <bdlscm_version.h>
+
+#include <bslmf_assert.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomicoperations.h>
+
+#include <bsl_cstring.h>
+
+namespace BloombergLP {
+
+                     // ================================
+                     // struct bdlat_NameLookupTable_Imp
+                     // ================================
+
+struct bdlat_NameLookupTable_Imp {
+    // [!PRIVATE!] This 'struct' provides a namespace for the non-template
+    // implementation details of 'bdlat_NameLookupTable'.
+
+    // TYPES
+    enum State {
+        // The states of a 'bdlat_NameLookupTable'.  Note that 'e_EMPTY' must
+        // be 0, the state of a zero-initialized table.
+
+        e_EMPTY    = 0,  // the table has not been built
+        e_BUILDING = 1,  // a thread is building the table
+        e_READY    = 2   // the table has been built
+    };
+
+    enum {
+        k_NUM_SEEDS = 8  // number of hash seeds tried when building a table
+    };
+
+    // CLASS METHODS
+    static unsigned int hash(unsigned int  seed,
+                             const char   *name,
+                             int           nameLength);
+        // Return a hash value for the specified 'name' of the specified
+        // 'nameLength', determined by the specified 'seed'.  The behavior is
+        // undefined unless '0 <= nameLength'.
+};
+
+                 // ==========================================
+                 // struct bdlat_NameLookupTable_NumSlots<...>
+                 // ==========================================
+
+template <int  NUM_NAMES,
+          int  NUM_SLOTS = 1,
+          bool DONE      = (NUM_SLOTS >= 2 * NUM_NAMES)>
+struct bdlat_NameLookupTable_NumSlots {
+    // [!PRIVATE!] This meta-function computes, as 'value', the smallest power
+    // of two that is not less than the specified 'NUM_SLOTS' nor than twice
+    // the specified 'NUM_NAMES'.
+
+    enum {
+        value = bdlat_NameLookupTable_NumSlots<NUM_NAMES,
+                                               NUM_SLOTS * 2>::value
+    };
+};
+
+template <int NUM_NAMES, int NUM_SLOTS>
+struct bdlat_NameLookupTable_NumSlots<NUM_NAMES, NUM_SLOTS, true> {
+    // [!PRIVATE!] This partial specialization terminates the recursion of
+    // 'bdlat_NameLookupTable_NumSlots'.
+
+    enum { value = NUM_SLOTS };
+};
+
+                       // ============================
+                       // struct bdlat_NameLookupTable
+                       // ============================
+
+template <int NUM_NAMES>
+struct bdlat_NameLookupTable {
+    // This 'struct' provides a hash table that finds, by name, an element of
+    // an array of the specified 'NUM_NAMES' info objects (such as
+    // 'bdlat_AttributeInfo' objects), each having a 'd_name_p' and a
+    // 'd_nameLength' data member.  The table is built from the array by the
+    // first call to 'lookup'.  This 'struct' is a POD type, and its data
+    // members are 'public' by design so that an object having static storage
+    // duration is zero-initialized, and is then ready for use (from any number
+    // of threads); they must not be accessed directly.
+
+    // TYPES
+    enum {
+        k_NUM_SLOTS = bdlat_NameLookupTable_NumSlots<NUM_NAMES>::value
+            // number of slots in the table
+    };
+
+  private:
+    // PRIVATE TYPES
+    typedef bdlat_NameLookupTable_Imp Imp;
+
+    BSLMF_ASSERT(0 <= NUM_NAMES && NUM_NAMES < 65535);
+
+  public:
+    // PUBLIC DATA
+    bsls::AtomicOperations::AtomicTypes::Int d_state;
+                                           // 'bdlat_NameLookupTable_Imp'
+                                           // state of the table
+
+    unsigned int   d_seed;                 // hash seed of the table
+
+    unsigned short d_slots[k_NUM_SLOTS];   // 1 + the index of the info object
+                                           // whose name is placed in each
+                                           // slot, or 0 if the slot is empty
+
+  private:
+    // PRIVATE MANIPULATORS
+    template <class INFO>
+    bool build(const INFO *infoArray);
+        // Build this table from the specified 'infoArray' unless another
+        // thread has started building it.  Return 'true' if this table is
+        // built, and 'false' if another thread is building it.
+
+    template <class INFO>
+    int place(const INFO *infoArray, unsigned int seed);
+        // Empty the slots of this table, and place in them the indices of the
+        // 'NUM_NAMES' elements of the specified 'infoArray' according to the
+        // specified hash 'seed'.  Return the sum of the displacements of the
+        // indices from the home slots of their names.
+
+    // PRIVATE ACCESSORS
+    template <class INFO>
+    const INFO *linearSearch(const INFO *infoArray,
+                             const char *name,
+                             int         nameLength) const;
+        // Return the address of the first of the 'NUM_NAMES' elements of the
+        // specified 'infoArray' having the specified 'name' of the specified
+        // 'nameLength', and 0 if there is no such element.
+
+  public:
+    // MANIPULATORS
+    template <class INFO>
+    const INFO *lookup(const INFO *infoArray,
+                       const char *name,
+                       int         nameLength);
+        // Return the address of the element of the specified 'infoArray' of
+        // 'NUM_NAMES' info objects having the specified 'name' of the
+        // specified 'nameLength', and 0 if there is no such element.  If
+        // several elements have that name, return the address of the one
+        // having the lowest index.  Build this table from 'infoArray' if it
+        // has not been built.  The behavior is undefined unless this table
+        // has static storage duration (or has been zero-initialized),
+        // 'infoArray' is the address of the same array for every call to
+        // 'lookup' on this table, '0 <= nameLength', and 'name' refers to at
+        // least 'nameLength' characters unless 'nameLength' is 0.  Note that
+        // this method may be called concurrently from multiple threads.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                     // --------------------------------
+                     // struct bdlat_NameLookupTable_Imp
+                     // --------------------------------
+
+// CLASS METHODS
+inline
+unsigned int bdlat_NameLookupTable_Imp::hash(unsigned int  seed,
+                                             const char   *name,
+                                             int           nameLength)
+{
+    BSLS_ASSERT_SAFE(0 <= nameLength);
+
+    // FNV-1a, with an offset basis perturbed by 'seed', followed by a final
+    // mix so that the low-order bits (which select the slot) depend on every
+    // character.
+
+    unsigned int result = 2166136261u + seed * 0x9e3779b9u;
+
+    for (int i = 0; i < nameLength; ++i) {
+        result ^= static_cast<unsigned char>(name[i]);
+        result *= 16777619u;
+    }
+
+    result ^= result >> 15;
+    result *= 0x2c1b3c6du;
+    result ^= result >> 13;
+
+    return result;
+}
+
+                       // ----------------------------
+                       // struct bdlat_NameLookupTable
+                       // ----------------------------
+
+// PRIVATE MANIPULATORS
+template <int NUM_NAMES>
+template <class INFO>
+bool bdlat_NameLookupTable<NUM_NAMES>::build(const INFO *infoArray)
+{
+    const int state = bsls::AtomicOperations::testAndSwapInt(&d_state,
+                                                             Imp::e_EMPTY,
+                                                             Imp::e_BUILDING);
+    if (Imp::e_EMPTY != state) {
+        return Imp::e_READY == state;                                 // RETURN
+    }
+
+    unsigned int bestSeed         = 0;
+    unsigned int lastSeed         = 0;
+    int          bestDisplacement = -1;
+
+    for (unsigned int seed = 0; seed < Imp::k_NUM_SEEDS; ++seed) {
+        const int displacement = place(infoArray, seed);
+
+        lastSeed = seed;
+        if (bestDisplacement < 0 || displacement < bestDisplacement) {
+            bestSeed         = seed;
+            bestDisplacement = displacement;
+        }
+        if (0 == displacement) {
+            break;
+        }
+    }
+
+    if (bestSeed != lastSeed) {
+        place(infoArray, bestSeed);
+    }
+
+    d_seed = bestSeed;
+
+    bsls::AtomicOperations::setIntRelease(&d_state, Imp::e_READY);
+
+    return true;
+}
+
+template <int NUM_NAMES>
+template <class INFO>
+int bdlat_NameLookupTable<NUM_NAMES>::place(const INFO   *infoArray,
+                                            unsigned int  seed)
+{
+    const unsigned int mask = k_NUM_SLOTS - 1;
+
+    bsl::memset(d_slots, 0, sizeof d_slots);
+
+    int displacement = 0;
+
+    for (int i = 0; i < NUM_NAMES; ++i) {
+        unsigned int slot = Imp::hash(seed,
+                                      infoArray[i].d_name_p,
+                                      infoArray[i].d_nameLength) & mask;
+
+        while (0 != d_slots[slot]) {
+            ++displacement;
+            slot = (slot + 1) & mask;
+        }
+        d_slots[slot] = static_cast<unsigned short>(i + 1);
+    }
+
+    return displacement;
+}
+
+// PRIVATE ACCESSORS
+template <int NUM_NAMES>
+template <class INFO>
+const INFO *bdlat_NameLookupTable<NUM_NAMES>::linearSearch(
+                                                const INFO *infoArray,
+                                                const char *name,
+                                                int         nameLength) const
+{
+    for (int i = 0; i < NUM_NAMES; ++i) {
+        const INFO& info = infoArray[i];
+
+        if (nameLength == info.d_nameLength
+         && 0 == bsl::memcmp(info.d_name_p, name, nameLength)) {
+            return &info;                                             // RETURN
+        }
+    }
+
+    return 0;
+}
+
+// MANIPULATORS
+template <int NUM_NAMES>
+template <class INFO>
+const INFO *bdlat_NameLookupTable<NUM_NAMES>::lookup(const INFO *infoArray,
+                                                     const char *name,
+                                                     int         nameLength)
+{
+    BSLS_ASSERT_SAFE(infoArray || 0 == NUM_NAMES);
+    BSLS_ASSERT_SAFE(name || 0 == nameLength);
+    BSLS_ASSERT_SAFE(0 <= nameLength);
+
+    if (Imp::e_READY != bsls::AtomicOperations::getIntAcquire(&d_state)
+     && !build(infoArray)) {
+        return linearSearch(infoArray, name, nameLength);             // RETURN
+    }
+
+    const unsigned int mask = k_NUM_SLOTS - 1;
+
+    unsigned int slot = Imp::hash(d_seed, name, nameLength) & mask;
+
+    while (0 != d_slots[slot]) {
+        const INFO& info = infoArray[d_slots[slot] - 1];
+
+        if (nameLength == info.d_nameLength
+         && 0 == bsl::memcmp(info.d_name_p, name, nameLength)) {
+            return &info;                                             // RETURN
+        }
+        slot = (slot + 1) & mask;
+    }
+
+    return 0;
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
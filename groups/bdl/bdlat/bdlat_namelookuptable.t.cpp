@@ -0,0 +1,758 @@
+// bdlat_namelookuptable.t.cpp                                        -*-C++-*-
+#include <bdlat_namelookuptable.h>
+
+#include <bdlat_attributeinfo.h>
+#include <bdlat_enumeratorinfo.h>
+#include <bdlat_selectioninfo.h>
+
+#include <bslim_testutil.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomicoperations.h>
+#include <bsls_stopwatch.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a POD hash table that is built, by the first
+// call to 'lookup', from an array of info objects.  We verify that 'lookup'
+// agrees with a linear search of the array for arrays of various sizes and
+// contents (including empty names, names that are prefixes of other names,
+// and duplicate names), for each of the three info types, and that a table
+// shared by several threads is built once and is consistent.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] unsigned int bdlat_NameLookupTable_Imp::hash(seed, name, length);
+//
+// MANIPULATORS
+// [ 4] const INFO *lookup(const INFO *, const char *, int);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] bdlat_NameLookupTable_NumSlots
+// [ 5] CONCURRENCY: FIRST LOOKUPS FROM SEVERAL THREADS
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE: 'lookup' VERSUS LINEAR SEARCH
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlat_NameLookupTable_Imp Imp;
+
+enum { k_MAX_NAMES = 100 };
+
+typedef bdlat_NameLookupTable<k_MAX_NAMES> BigTable;
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+template <class INFO>
+const INFO *linearSearch(const INFO *infoArray,
+                         int         numInfos,
+                         const char *name,
+                         int         nameLength)
+    // Return the address of the first of the specified 'numInfos' elements of
+    // the specified 'infoArray' having the specified 'name' of the specified
+    // 'nameLength', and 0 if there is no such element.
+{
+    for (int i = 0; i < numInfos; ++i) {
+        if (nameLength == infoArray[i].d_nameLength
+         && 0 == bsl::memcmp(infoArray[i].d_name_p, name, nameLength)) {
+            return infoArray + i;                                     // RETURN
+        }
+    }
+    return 0;
+}
+
+template <int NUM_NAMES, class INFO>
+void verifyLookups(const INFO                      *infoArray,
+                   const bsl::vector<bsl::string>&  probes,
+                   int                              line)
+    // Verify that a 'bdlat_NameLookupTable<NUM_NAMES>' built from the
+    // specified 'infoArray' finds each of the names of 'infoArray' and each of
+    // the specified 'probes' as a linear search of 'infoArray' does, before
+    // and after the table is built.  Report failures using the specified
+    // 'line'.
+{
+    static bdlat_NameLookupTable<NUM_NAMES> mX;  // zero-initialized
+
+    ASSERTV(line, Imp::e_EMPTY ==
+                            bsls::AtomicOperations::getInt(&mX.d_state));
+
+    for (int pass = 0; pass < 2; ++pass) {
+        for (int i = 0; i < NUM_NAMES; ++i) {
+            const char *NAME   = infoArray[i].d_name_p;
+            const int   LENGTH = infoArray[i].d_nameLength;
+
+            const INFO *EXP = linearSearch(infoArray, NUM_NAMES, NAME, LENGTH);
+
+            ASSERTV(line, pass, i, EXP == mX.lookup(infoArray, NAME, LENGTH));
+        }
+
+        for (bsl::size_t i = 0; i < probes.size(); ++i) {
+            const char *NAME   = probes[i].data();
+            const int   LENGTH = static_cast<int>(probes[i].length());
+
+            const INFO *EXP = linearSearch(infoArray, NUM_NAMES, NAME, LENGTH);
+
+            ASSERTV(line, pass, probes[i],
+                    EXP == mX.lookup(infoArray, NAME, LENGTH));
+        }
+    }
+
+    ASSERTV(line, Imp::e_READY ==
+                            bsls::AtomicOperations::getInt(&mX.d_state));
+}
+
+void makeNames(bsl::vector<bsl::string> *names, int numNames, int style)
+    // Load into the specified 'names' the specified 'numNames' distinct names
+    // formed according to the specified 'style': 0 for names of the form
+    // "fieldN", 1 for names that are successive prefixes of one another, and 2
+    // for short names over a small alphabet.
+{
+    names->clear();
+    for (int i = 0; i < numNames; ++i) {
+        char buffer[32];
+        switch (style) {
+          case 0: {
+            bsl::sprintf(buffer, "field%d", i);
+            names->push_back(buffer);
+          } break;
+          case 1: {
+            names->push_back(bsl::string(i, 'x'));
+          } break;
+          default: {
+            buffer[0] = static_cast<char>('a' + i % 3);
+            buffer[1] = static_cast<char>('a' + i / 3 % 3);
+            buffer[2] = static_cast<char>('a' + i / 9 % 3);
+            buffer[3] = static_cast<char>('a' + i / 27);
+            names->push_back(bsl::string(buffer, 1 + i / 3 % 4));
+            names->back() += static_cast<char>('0' + i % 10);
+            names->back() += static_cast<char>('0' + i / 10);
+          } break;
+        }
+    }
+}
+
+                          // =======================
+                          // struct LookupThreadArgs
+                          // =======================
+
+struct LookupThreadArgs {
+    // This 'struct' holds the arguments of 'lookupThread'.
+
+    BigTable                  *d_table_p;
+    const bdlat_AttributeInfo *d_infoArray_p;
+    bslmt::Barrier            *d_barrier_p;
+    int                        d_numErrors;
+};
+
+extern "C" void *lookupThread(void *arg)
+    // Wait on the barrier of the 'LookupThreadArgs' object at the specified
+    // 'arg', then look up every name of its info array many times, counting
+    // the lookups that do not find the expected element.
+{
+    LookupThreadArgs *args = static_cast<LookupThreadArgs *>(arg);
+
+    args->d_barrier_p->wait();
+
+    for (int iteration = 0; iteration < 100; ++iteration) {
+        for (int i = 0; i < k_MAX_NAMES; ++i) {
+            const bdlat_AttributeInfo& INFO = args->d_infoArray_p[i];
+
+            if (&INFO != args->d_table_p->lookup(args->d_infoArray_p,
+                                                 INFO.d_name_p,
+                                                 INFO.d_nameLength)) {
+                ++args->d_numErrors;
+            }
+        }
+    }
+    return 0;
+}
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Looking Up the Attributes of a Sequence
+/// - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we have a sequence type, 'Employee', that describes its attributes
+// with a static array of 'bdlat_AttributeInfo' objects:
+//..
+    class Employee {
+      public:
+        // TYPES
+        enum {
+            ATTRIBUTE_ID_NAME   = 0,
+            ATTRIBUTE_ID_AGE    = 1,
+            ATTRIBUTE_ID_SALARY = 2
+        };
+
+        enum { NUM_ATTRIBUTES = 3 };
+
+        // CONSTANTS
+        static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
+
+        // CLASS METHODS
+        static const bdlat_AttributeInfo *lookupAttributeInfo(
+                                                       const char *name,
+                                                       int         nameLength);
+            // Return attribute information for the attribute indicated by
+            // the specified 'name' of the specified 'nameLength' if the
+            // attribute exists, and 0 otherwise.
+
+        // ...
+    };
+
+    const bdlat_AttributeInfo Employee::ATTRIBUTE_INFO_ARRAY[] = {
+        { ATTRIBUTE_ID_NAME,   "name",   sizeof("name") - 1,   "", 0 },
+        { ATTRIBUTE_ID_AGE,    "age",    sizeof("age") - 1,    "", 0 },
+        { ATTRIBUTE_ID_SALARY, "salary", sizeof("salary") - 1, "", 0 }
+    };
+//..
+// Rather than comparing 'name' with each element of 'ATTRIBUTE_INFO_ARRAY',
+// 'lookupAttributeInfo' looks the name up in a function-scope static
+// 'bdlat_NameLookupTable', which needs neither an initializer nor a guard:
+//..
+    const bdlat_AttributeInfo *Employee::lookupAttributeInfo(
+                                                        const char *name,
+                                                        int         nameLength)
+    {
+        static bdlat_NameLookupTable<NUM_ATTRIBUTES> lookupTable;
+
+        return lookupTable.lookup(ATTRIBUTE_INFO_ARRAY, name, nameLength);
+    }
+//..
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nUSAGE EXAMPLE"
+                          << "\n=============" << endl;
+
+// Finally, we look up some names:
+//..
+    const bdlat_AttributeInfo *info = Employee::lookupAttributeInfo("age", 3);
+    ASSERT(info);
+    ASSERT(Employee::ATTRIBUTE_ID_AGE == info->d_id);
+
+    info = Employee::lookupAttributeInfo("salary", 6);
+    ASSERT(info);
+    ASSERT(Employee::ATTRIBUTE_ID_SALARY == info->d_id);
+
+    ASSERT(0 == Employee::lookupAttributeInfo("sal", 3));
+    ASSERT(0 == Employee::lookupAttributeInfo("title", 5));
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY: FIRST LOOKUPS FROM SEVERAL THREADS
+        //
+        // Concerns:
+        //: 1 Threads that call 'lookup' on a table that has not been built
+        //:   find the expected elements, whether they build the table,
+        //:   search linearly while another thread builds it, or use the
+        //:   built table.
+        //:
+        //: 2 The table is built.
+        //
+        // Plan:
+        //: 1 For several zero-initialized tables, start several threads that
+        //:   wait on a barrier, then look up every name of an info array of
+        //:   'k_MAX_NAMES' elements many times.  Verify that every lookup
+        //:   finds the expected element, and that the table is then in the
+        //:   'e_READY' state.  (C-1..2)
+        //
+        // Testing:
+        //   CONCURRENCY: FIRST LOOKUPS FROM SEVERAL THREADS
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            cout << "\nCONCURRENCY: FIRST LOOKUPS FROM SEVERAL THREADS"
+                 << "\n==============================================="
+                 << endl;
+
+        enum { k_NUM_THREADS = 4, k_NUM_ROUNDS = 20 };
+
+        bsl::vector<bsl::string> names;
+        makeNames(&names, k_MAX_NAMES, 0);
+
+        bdlat_AttributeInfo infoArray[k_MAX_NAMES];
+        for (int i = 0; i < k_MAX_NAMES; ++i) {
+            bdlat_AttributeInfo info = {
+                i, names[i].c_str(), static_cast<int>(names[i].length()), "", 0
+            };
+            infoArray[i] = info;
+        }
+
+        for (int round = 0; round < k_NUM_ROUNDS; ++round) {
+            static BigTable tables[k_NUM_ROUNDS];  // zero-initialized
+
+            bslmt::Barrier               barrier(k_NUM_THREADS);
+            LookupThreadArgs             args[k_NUM_THREADS];
+            bslmt::ThreadUtil::Handle    handles[k_NUM_THREADS];
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                args[i].d_table_p     = &tables[round];
+                args[i].d_infoArray_p = infoArray;
+                args[i].d_barrier_p   = &barrier;
+                args[i].d_numErrors   = 0;
+
+                ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                      &lookupThread,
+                                                      &args[i]));
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+                ASSERTV(round, i, 0 == args[i].d_numErrors);
+            }
+            ASSERTV(round, Imp::e_READY ==
+                       bsls::AtomicOperations::getInt(&tables[round].d_state));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'lookup'
+        //
+        // Concerns:
+        //: 1 'lookup' returns the address of the element of the info array
+        //:   having the specified name, and 0 if there is none, both when it
+        //:   builds the table and once the table is built.
+        //:
+        //: 2 Names that are empty, that are prefixes of other names, or that
+        //:   differ only in their last character are distinguished.
+        //:
+        //: 3 When several elements have the same name, 'lookup' returns the
+        //:   one having the lowest index.
+        //:
+        //: 4 'lookup' works with 'bdlat_AttributeInfo',
+        //:   'bdlat_SelectionInfo', and 'bdlat_EnumeratorInfo' arrays, and
+        //:   with arrays of 0 elements.
+        //
+        // Plan:
+        //: 1 Using a helper that compares 'lookup' with a linear search for
+        //:   every name of an array and for a set of probe names, both before
+        //:   and after the table is built, test arrays of 0, 1, 2, 3, 7, 50,
+        //:   and 'k_MAX_NAMES' elements whose names follow three styles,
+        //:   including one where names are successive prefixes of one another.
+        //:   (C-1..2)
+        //:
+        //: 2 Test an array having duplicate names.  (C-3)
+        //:
+        //: 3 Repeat P-1 with arrays of selection and enumerator infos.  (C-4)
+        //
+        // Testing:
+        //   const INFO *lookup(const INFO *, const char *, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\n'lookup'"
+                          << "\n========" << endl;
+
+        for (int style = 0; style < 3; ++style) {
+            bsl::vector<bsl::string> names;
+            makeNames(&names, k_MAX_NAMES + 1, style);
+
+            bsl::vector<bsl::string> probes;
+            probes.push_back("");
+            probes.push_back("f");
+            probes.push_back("field");
+            probes.push_back("fieldX");
+            probes.push_back(names.back());  // one past the last name
+            for (int i = 0; i < k_MAX_NAMES; ++i) {
+                probes.push_back(names[i] + "z");
+                if (!names[i].empty()) {
+                    bsl::string probe(names[i]);
+                    probe[probe.length() - 1] ^= 0x20;
+                    probes.push_back(probe);
+                }
+            }
+
+            bdlat_AttributeInfo  attributes[k_MAX_NAMES];
+            bdlat_SelectionInfo  selections[k_MAX_NAMES];
+            bdlat_EnumeratorInfo enumerators[k_MAX_NAMES];
+
+            for (int i = 0; i < k_MAX_NAMES; ++i) {
+                const char *NAME   = names[i].c_str();
+                const int   LENGTH = static_cast<int>(names[i].length());
+
+                bdlat_AttributeInfo  attribute  = { i, NAME, LENGTH, "", 0 };
+                bdlat_SelectionInfo  selection  = { i, NAME, LENGTH, "", 0 };
+                bdlat_EnumeratorInfo enumerator = { i, NAME, LENGTH, "" };
+
+                attributes[i]  = attribute;
+                selections[i]  = selection;
+                enumerators[i] = enumerator;
+            }
+
+            if (veryVerbose) { T_ P(style) }
+
+            // The tables of 'verifyLookups' are static, so each combination
+            // of size and info type must be verified once.
+
+            switch (style) {
+              case 0: {
+                verifyLookups<1>(attributes, probes, L_);
+                verifyLookups<2>(attributes, probes, L_);
+                verifyLookups<3>(attributes, probes, L_);
+                verifyLookups<7>(attributes, probes, L_);
+                verifyLookups<k_MAX_NAMES>(attributes, probes, L_);
+                verifyLookups<0>(selections, probes, L_);
+                verifyLookups<50>(selections, probes, L_);
+              } break;
+              case 1: {
+                verifyLookups<4>(attributes, probes, L_);
+                verifyLookups<9>(attributes, probes, L_);
+                verifyLookups<k_MAX_NAMES - 1>(attributes, probes, L_);
+                verifyLookups<5>(enumerators, probes, L_);
+              } break;
+              default: {
+                verifyLookups<6>(attributes, probes, L_);
+                verifyLookups<k_MAX_NAMES - 2>(attributes, probes, L_);
+                verifyLookups<0>(enumerators, probes, L_);
+                verifyLookups<k_MAX_NAMES>(enumerators, probes, L_);
+              } break;
+            }
+        }
+
+        if (verbose) cout << "\tDuplicate names." << endl;
+        {
+            const bdlat_AttributeInfo DUPLICATES[] = {
+                { 0, "a",   1, "", 0 },
+                { 1, "bc",  2, "", 0 },
+                { 2, "a",   1, "", 0 },
+                { 3, "def", 3, "", 0 },
+                { 4, "bc",  2, "", 0 },
+                { 5, "a",   1, "", 0 }
+            };
+
+            static bdlat_NameLookupTable<6> mX;
+
+            for (int pass = 0; pass < 2; ++pass) {
+                ASSERTV(pass, DUPLICATES     == mX.lookup(DUPLICATES, "a", 1));
+                ASSERTV(pass, DUPLICATES + 1 == mX.lookup(DUPLICATES, "bc",
+                                                          2));
+                ASSERTV(pass, DUPLICATES + 3 == mX.lookup(DUPLICATES, "def",
+                                                          3));
+                ASSERTV(pass, 0 == mX.lookup(DUPLICATES, "b", 1));
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'bdlat_NameLookupTable_NumSlots'
+        //
+        // Concerns:
+        //: 1 The number of slots is the smallest power of two that is not
+        //:   less than twice the number of names (and is at least 1).
+        //
+        // Plan:
+        //: 1 Verify 'k_NUM_SLOTS' for a table of representative sizes.  (C-1)
+        //
+        // Testing:
+        //   bdlat_NameLookupTable_NumSlots
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\n'bdlat_NameLookupTable_NumSlots'"
+                          << "\n================================" << endl;
+
+        ASSERT(  1 == bdlat_NameLookupTable<0>::k_NUM_SLOTS);
+        ASSERT(  2 == bdlat_NameLookupTable<1>::k_NUM_SLOTS);
+        ASSERT(  4 == bdlat_NameLookupTable<2>::k_NUM_SLOTS);
+        ASSERT(  8 == bdlat_NameLookupTable<3>::k_NUM_SLOTS);
+        ASSERT(  8 == bdlat_NameLookupTable<4>::k_NUM_SLOTS);
+        ASSERT( 16 == bdlat_NameLookupTable<5>::k_NUM_SLOTS);
+        ASSERT( 64 == bdlat_NameLookupTable<32>::k_NUM_SLOTS);
+        ASSERT(128 == bdlat_NameLookupTable<33>::k_NUM_SLOTS);
+        ASSERT(256 == BigTable::k_NUM_SLOTS);
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'bdlat_NameLookupTable_Imp::hash'
+        //
+        // Concerns:
+        //: 1 The hash of a name depends only on the seed and on the
+        //:   'nameLength' characters of the name.
+        //:
+        //: 2 Different seeds, and names differing in one character, have
+        //:   (almost always) different hashes.
+        //
+        // Plan:
+        //: 1 Hash names in buffers followed by different characters.  (C-1)
+        //:
+        //: 2 Hash a set of names with several seeds, and verify that the low
+        //:   bits of the hashes of distinct names are distributed over a
+        //:   table of twice as many slots.  (C-2)
+        //
+        // Testing:
+        //   unsigned int bdlat_NameLookupTable_Imp::hash(seed, name, length);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\n'bdlat_NameLookupTable_Imp::hash'"
+                          << "\n=================================" << endl;
+
+        ASSERT(Imp::hash(0, "abcX", 3) == Imp::hash(0, "abcY", 3));
+        ASSERT(Imp::hash(1, "abcX", 3) == Imp::hash(1, "abcZ", 3));
+        ASSERT(Imp::hash(0, "abc",  3) != Imp::hash(1, "abc",  3));
+        ASSERT(Imp::hash(0, "abc",  3) != Imp::hash(0, "abd",  3));
+        ASSERT(Imp::hash(0, "abc",  3) != Imp::hash(0, "abc",  2));
+        ASSERT(Imp::hash(0, "",     0) != Imp::hash(1, "",     0));
+
+        bsl::vector<bsl::string> names;
+        makeNames(&names, k_MAX_NAMES, 0);
+
+        for (unsigned int seed = 0; seed < Imp::k_NUM_SEEDS; ++seed) {
+            const unsigned int mask = 2 * 128 - 1;
+
+            bsl::vector<int> counts(mask + 1, 0);
+            int              numUsed = 0;
+
+            for (int i = 0; i < k_MAX_NAMES; ++i) {
+                const unsigned int slot = Imp::hash(
+                                        seed,
+                                        names[i].data(),
+                                        static_cast<int>(names[i].length()))
+                                        & mask;
+                if (0 == counts[slot]++) {
+                    ++numUsed;
+                }
+            }
+
+            // With 100 names uniformly hashed into 256 slots, about 83 slots
+            // are expected to be used.
+
+            ASSERTV(seed, numUsed, 70 <= numUsed);
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Look up names in a zero-initialized table.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nBREATHING TEST"
+                          << "\n==============" << endl;
+
+        const bdlat_SelectionInfo INFOS[] = {
+            { 10, "red",   3, "", 0 },
+            { 20, "green", 5, "", 0 },
+            { 30, "blue",  4, "", 0 }
+        };
+
+        static bdlat_NameLookupTable<3> mX;
+
+        ASSERT(Imp::e_EMPTY == bsls::AtomicOperations::getInt(&mX.d_state));
+
+        ASSERT(INFOS + 1 == mX.lookup(INFOS, "green", 5));
+
+        ASSERT(Imp::e_READY == bsls::AtomicOperations::getInt(&mX.d_state));
+
+        ASSERT(INFOS     == mX.lookup(INFOS, "red",   3));
+        ASSERT(INFOS + 2 == mX.lookup(INFOS, "blue",  4));
+        ASSERT(0         == mX.lookup(INFOS, "blu",   3));
+        ASSERT(0         == mX.lookup(INFOS, "",      0));
+        ASSERT(0         == mX.lookup(INFOS, "Red",   3));
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: 'lookup' VERSUS LINEAR SEARCH
+        //
+        // Concerns:
+        //: 1 Looking a name up in the table is faster than a linear search of
+        //:   the info array for arrays of more than a few elements.
+        //
+        // Plan:
+        //: 1 For info arrays of 'k_MAX_NAMES' elements, time the lookup of
+        //:   every name with 'lookup' and with a linear search, and report the
+        //:   times.
+        //
+        // Testing:
+        //   PERFORMANCE: 'lookup' VERSUS LINEAR SEARCH
+        // --------------------------------------------------------------------
+
+        cout << "\nPERFORMANCE: 'lookup' VERSUS LINEAR SEARCH"
+             << "\n==========================================" << endl;
+
+        const int NUM_ITERATIONS = argc > 2 ? atoi(argv[2]) : 10000;
+
+        bsl::vector<bsl::string> names;
+        makeNames(&names, k_MAX_NAMES, 0);
+
+        bdlat_AttributeInfo infoArray[k_MAX_NAMES];
+        for (int i = 0; i < k_MAX_NAMES; ++i) {
+            bdlat_AttributeInfo info = {
+                i, names[i].c_str(), static_cast<int>(names[i].length()), "", 0
+            };
+            infoArray[i] = info;
+        }
+
+        static BigTable mX;
+
+        int            numFound = 0;
+        bsls::Stopwatch timer;
+
+        timer.start();
+        for (int iteration = 0; iteration < NUM_ITERATIONS; ++iteration) {
+            for (int i = 0; i < k_MAX_NAMES; ++i) {
+                numFound += 0 != linearSearch(infoArray,
+                                              k_MAX_NAMES,
+                                              names[i].data(),
+                                              static_cast<int>(
+                                                         names[i].length()));
+            }
+        }
+        timer.stop();
+
+        const double linearTime = timer.elapsedTime();
+
+        timer.reset();
+        timer.start();
+        for (int iteration = 0; iteration < NUM_ITERATIONS; ++iteration) {
+            for (int i = 0; i < k_MAX_NAMES; ++i) {
+                numFound += 0 != mX.lookup(infoArray,
+                                           names[i].data(),
+                                           static_cast<int>(
+                                                         names[i].length()));
+            }
+        }
+        timer.stop();
+
+        const double tableTime = timer.elapsedTime();
+
+        ASSERT(2 * NUM_ITERATIONS * k_MAX_NAMES == numFound);
+
+        const double numLookups = 1.0 * NUM_ITERATIONS * k_MAX_NAMES;
+
+        cout << "linear search: " << linearTime / numLookups * 1e9
+             << " ns/lookup\n"
+             << "table lookup:  " << tableTime / numLookups * 1e9
+             << " ns/lookup" << endl;
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
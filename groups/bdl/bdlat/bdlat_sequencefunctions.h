@@ -40,7 +40,15 @@ BSLS_IDENT("$Id: $")
 // behavior through the 'bdlat_SequenceFunctions' 'namespace'.
 //
 // This component specializes all of these functions for types that have the
-// 'bdlat_TypeTraitBasicSequence' trait.
+// 'bdlat_TypeTraitBasicSequence' trait.  If such a type also declares the
+// 'ATTRIBUTE_INFO_ARRAY' and 'NUM_ATTRIBUTES' members that
+// 'bas_codegen.pl'-generated types declare, the functions taking an attribute
+// name find the attribute in a 'bdlat_NameLookupTable' built from
+// 'ATTRIBUTE_INFO_ARRAY', and then manipulate or access it by its id.  A name
+// that is not in the table is looked up by the type itself (which also finds,
+// for example, the selections of an untagged choice attribute).  Decoders,
+// which look up every element they decode by name, thus compare each name
+// with (typically) one attribute name rather than with half of them.
 //
 // Types that do not have the 'bdlat_TypeTraitBasicSequence' trait can be
 // plugged into the 'bdlat' framework.  This is done by overloading the
@@ -582,7 +590,9 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlscm_version.h>
 
+#include <bdlat_attributeinfo.h>
 #include <bdlat_bdeatoverrides.h>
+#include <bdlat_namelookuptable.h>
 #include <bdlat_typetraits.h>
 
 #include <bslalg_hastrait.h>
@@ -607,6 +617,59 @@ BSLS_IDENT("$Id: $")
 
 namespace BloombergLP {
 
+                     // ==================================
+                     // struct bdlat_SequenceFunctions_Imp
+                     // ==================================
+
+struct bdlat_SequenceFunctions_Imp {
+    // [!PRIVATE!] This 'struct' provides a namespace for functions that find
+    // an attribute of a sequence type by name in a 'bdlat_NameLookupTable'
+    // built from the attribute info array of the type.
+
+    // TYPES
+    typedef char YesType;
+    struct NoType { char d_dummy[2]; };
+
+    // CLASS METHODS
+    template <class TYPE>
+    static YesType hasAttributeInfoArray(
+                          char (*)[sizeof(TYPE::ATTRIBUTE_INFO_ARRAY[0])
+                                   * (TYPE::NUM_ATTRIBUTES + 1)]);
+    template <class TYPE>
+    static NoType hasAttributeInfoArray(...);
+        // Return 'YesType' if the (template parameter) 'TYPE' declares the
+        // 'ATTRIBUTE_INFO_ARRAY' and 'NUM_ATTRIBUTES' members, and 'NoType'
+        // otherwise.  Note that these functions are only declared, to be
+        // used in unevaluated contexts.
+
+    template <class TYPE>
+    static const bdlat_AttributeInfo *lookupAttributeInfo(
+                                                const char        *name,
+                                                int                nameLength,
+                                                bslmf::MetaInt<0>);
+    template <class TYPE>
+    static const bdlat_AttributeInfo *lookupAttributeInfo(
+                                                const char        *name,
+                                                int                nameLength,
+                                                bslmf::MetaInt<1>);
+        // Return the address of the element of 'TYPE::ATTRIBUTE_INFO_ARRAY'
+        // having the specified 'name' of the specified 'nameLength' if the
+        // (template parameter) 'TYPE' declares the 'ATTRIBUTE_INFO_ARRAY' and
+        // 'NUM_ATTRIBUTES' members, as indicated by the type of the last
+        // argument, and such an element exists, and 0 otherwise.
+
+    template <class TYPE>
+    static const bdlat_AttributeInfo *lookupAttributeInfo(
+                                                       const char *name,
+                                                       int         nameLength);
+        // Return the address of the element of 'TYPE::ATTRIBUTE_INFO_ARRAY'
+        // having the specified 'name' of the specified 'nameLength', and 0 if
+        // there is no such element or the (template parameter) 'TYPE' does
+        // not declare the 'ATTRIBUTE_INFO_ARRAY' and 'NUM_ATTRIBUTES'
+        // members.  Note that, unlike 'TYPE::lookupAttributeInfo', this
+        // function does not find the selections of untagged attributes.
+};
+
                       // =================================
                       // namespace bdlat_SequenceFunctions
                       // =================================
@@ -776,6 +839,49 @@ namespace bdlat_SequenceFunctions {
 //                        INLINE FUNCTION DEFINITIONS
 // ============================================================================
 
+                     // ----------------------------------
+                     // struct bdlat_SequenceFunctions_Imp
+                     // ----------------------------------
+
+// CLASS METHODS
+template <class TYPE>
+inline
+const bdlat_AttributeInfo *bdlat_SequenceFunctions_Imp::lookupAttributeInfo(
+                                                             const char *,
+                                                             int,
+                                                             bslmf::MetaInt<0>)
+{
+    return 0;
+}
+
+template <class TYPE>
+inline
+const bdlat_AttributeInfo *bdlat_SequenceFunctions_Imp::lookupAttributeInfo(
+                                                const char        *name,
+                                                int                nameLength,
+                                                bslmf::MetaInt<1>)
+{
+    static bdlat_NameLookupTable<TYPE::NUM_ATTRIBUTES> lookupTable;
+
+    return lookupTable.lookup(TYPE::ATTRIBUTE_INFO_ARRAY, name, nameLength);
+}
+
+template <class TYPE>
+inline
+const bdlat_AttributeInfo *bdlat_SequenceFunctions_Imp::lookupAttributeInfo(
+                                                       const char *name,
+                                                       int         nameLength)
+{
+    enum {
+        k_HAS_INFO_ARRAY = sizeof(YesType)
+                        == sizeof(hasAttributeInfoArray<TYPE>(0))
+    };
+
+    return lookupAttributeInfo<TYPE>(name,
+                                     nameLength,
+                                     bslmf::MetaInt<k_HAS_INFO_ARRAY>());
+}
+
                      // ---------------------------------
                      // namespace bdlat_SequenceFunctions
                      // ---------------------------------
@@ -933,6 +1039,15 @@ int bdlat_SequenceFunctions::bdlat_sequenceManipulateAttribute(
     BSLMF_ASSERT(
                 (bslalg::HasTrait<TYPE, bdlat_TypeTraitBasicSequence>::VALUE));
 
+    const bdlat_AttributeInfo *attributeInfo =
+                   bdlat_SequenceFunctions_Imp::lookupAttributeInfo<TYPE>(
+                                                         attributeName,
+                                                         attributeNameLength);
+    if (attributeInfo) {
+        return object->manipulateAttribute(manipulator,
+                                           attributeInfo->d_id);      // RETURN
+    }
+
     return object->manipulateAttribute(manipulator,
                                        attributeName,
                                        attributeNameLength);
@@ -976,6 +1091,15 @@ int bdlat_SequenceFunctions::bdlat_sequenceAccessAttribute(
     BSLMF_ASSERT(
                 (bslalg::HasTrait<TYPE, bdlat_TypeTraitBasicSequence>::VALUE));
 
+    const bdlat_AttributeInfo *attributeInfo =
+                   bdlat_SequenceFunctions_Imp::lookupAttributeInfo<TYPE>(
+                                                         attributeName,
+                                                         attributeNameLength);
+    if (attributeInfo) {
+        return object.accessAttribute(accessor,
+                                      attributeInfo->d_id);           // RETURN
+    }
+
     return object.accessAttribute(accessor,
                                   attributeName,
                                   attributeNameLength);
@@ -1020,7 +1144,10 @@ bool bdlat_SequenceFunctions::bdlat_sequenceHasAttribute(
     BSLMF_ASSERT(
                 (bslalg::HasTrait<TYPE, bdlat_TypeTraitBasicSequence>::VALUE));
 
-    return 0 != object.lookupAttributeInfo(attributeName, attributeNameLength);
+    return 0 != bdlat_SequenceFunctions_Imp::lookupAttributeInfo<TYPE>(
+                                                         attributeName,
+                                                         attributeNameLength)
+        || 0 != object.lookupAttributeInfo(attributeName, attributeNameLength);
 }
 
 template <class TYPE>
@@ -42,6 +42,9 @@ using namespace bsl;  // automatically added by script
 // [ 3] int lookupAttributeInfo(*info, object, *name, nameLength);
 // [ 3] int lookupAttributeInfo(*info, object, id);
 // [ 2] int Obj::numAttributes(const TYPE&);
+// [ 4] int manipulateAttribute(TYPE *, MANIPULATOR&, const char *, int);
+// [ 4] int accessAttribute(const TYPE&, ACCESSOR&, const char *, int);
+// [ 4] bool hasAttribute(const TYPE&, const char *, int);
 //-----------------------------------------------------------------------------
 // [ 1] METHOD FORWARDING TEST
 // [ 2] INFO ACCESS TEST
@@ -102,6 +105,7 @@ namespace Obj = bdlat_SequenceFunctions;
 // ----------------------------------------------------------------------------
 
 static int globalFlag = 0;
+static int globalId   = 0;
 
 namespace geom {
 
@@ -202,10 +206,11 @@ class Point {
     }
 
     template<class MANIPULATOR>
-    int manipulateAttribute(MANIPULATOR&, int)
+    int manipulateAttribute(MANIPULATOR&, int id)
         // visit the modifiable attribute with a given id
     {
         globalFlag = 2;
+        globalId   = id;
         return globalFlag;
     }
 
@@ -239,10 +244,11 @@ class Point {
     }
 
     template<class ACCESSOR>
-    int accessAttribute(ACCESSOR&, int) const
+    int accessAttribute(ACCESSOR&, int id) const
         // visit the non-modifiable attribute with a given id
     {
         globalFlag = 5;
+        globalId   = id;
         return globalFlag;
     }
 
@@ -768,6 +774,76 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING LOOKUP BY NAME
+        //
+        // Concerns:
+        //: 1 For a type declaring 'ATTRIBUTE_INFO_ARRAY' and
+        //:   'NUM_ATTRIBUTES', the functions taking an attribute name find
+        //:   each attribute of the info array, and then manipulate or access
+        //:   it by its id.
+        //:
+        //: 2 Any other name is forwarded to the functions of the type taking
+        //:   a name.
+        //
+        // Plan:
+        //: 1 For each name in the info array of 'geom::Point', and for some
+        //:   names that are not, call the name-based functions, and verify,
+        //:   using 'globalFlag' and 'globalId', which method of 'Point' is
+        //:   called, and with which id.  (C-1..2)
+        //
+        // Testing:
+        //   int manipulateAttribute(TYPE *, MANIPULATOR&, const char *, int);
+        //   int accessAttribute(const TYPE&, ACCESSOR&, const char *, int);
+        //   bool hasAttribute(const TYPE&, const char *, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING LOOKUP BY NAME"
+                          << "\n======================" << endl;
+
+        static const struct {
+            int         d_line;  // source line number
+            const char *d_name;  // attribute name
+            int         d_id;    // attribute id, or 0 if not in info array
+        } DATA[] = {
+            //LINE  NAME   ID
+            //----  -----  --
+            { L_,   "X",   geom::Point::ATTRIBUTE_ID_X },
+            { L_,   "Y",   geom::Point::ATTRIBUTE_ID_Y },
+            { L_,   "",    0                           },
+            { L_,   "x",   0                           },
+            { L_,   "XY",  0                           },
+            { L_,   "foo", 0                           },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        geom::Point mX;  const geom::Point& X = mX;
+        int         dummyVisitor = 0;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE   = DATA[ti].d_line;
+            const char *NAME   = DATA[ti].d_name;
+            const int   LENGTH = static_cast<int>(bsl::strlen(NAME));
+            const int   ID     = DATA[ti].d_id;
+
+            if (veryVerbose) { P_(LINE) P_(NAME) P(ID) }
+
+            globalFlag = 0;
+            globalId   = 0;
+            Obj::manipulateAttribute(&mX, dummyVisitor, NAME, LENGTH);
+            ASSERTV(LINE, globalFlag, (ID ? 2 : 1) == globalFlag);
+            ASSERTV(LINE, globalId,   ID == globalId);
+
+            globalFlag = 0;
+            globalId   = 0;
+            Obj::accessAttribute(X, dummyVisitor, NAME, LENGTH);
+            ASSERTV(LINE, globalFlag, (ID ? 5 : 4) == globalFlag);
+            ASSERTV(LINE, globalId,   ID == globalId);
+
+            ASSERTV(LINE, (0 != ID) == Obj::hasAttribute(X, NAME, LENGTH));
+        }
+      } break;
       case 3: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
@@ -61,6 +61,16 @@ BSLS_IDENT("$Id: $")
 // itself and is not settable (the maximum load factor is implementation
 // defined and fixed).
 //
+///Batched Lookup
+///--------------
+// In addition to 'find', 'bdlc::FlatHashMap' provides 'findMany', which looks
+// up an array of keys at once.  Lookups in a map that does not fit in cache
+// are dominated by memory latency; 'findMany' hashes a batch of keys and
+// prefetches the memory each lookup will touch before resolving any of them,
+// so that the cache misses of the batch overlap.  Clients looking up many
+// independent keys (e.g., when joining two data sets) in a map that does not
+// fit in cache should prefer 'findMany' to repeated calls to 'find'.
+//
 ///Load Factor and Resizing
 ///------------------------
 // An invariant of 'bdlc::FlatHashMap' is that
@@ -598,6 +608,16 @@ class FlatHashMap {
         // having the specified 'key', or 'end()' if no such entry exists in
         // this map.
 
+    void findMany(iterator *results, const KEY *keys, bsl::size_t numKeys);
+        // Load into each of the specified 'numKeys' elements of the specified
+        // 'results' array an iterator referring to the modifiable element in
+        // this map having, as its key, the corresponding element of the
+        // specified 'keys' array, or 'end()' if no such entry exists in this
+        // map.  The behavior is undefined unless 'results' and 'keys' each
+        // have at least 'numKeys' elements.  Note that the result is the same
+        // as invoking 'find' for each key, but this method is typically faster
+        // for large maps (see {Batched Lookup}).
+
 #if defined(BSLS_PLATFORM_CMP_SUN) && BSLS_PLATFORM_CMP_VERSION < 0x5130
     template <class VALUE_TYPE>
     bsl::pair<iterator, bool> insert(
@@ -746,6 +766,18 @@ class FlatHashMap {
         // having the specified 'key', or 'end()' if no such entry exists in
         // this map.
 
+    void findMany(const_iterator *results,
+                  const KEY      *keys,
+                  bsl::size_t     numKeys) const;
+        // Load into each of the specified 'numKeys' elements of the specified
+        // 'results' array a 'const_iterator' referring to the element in this
+        // map having, as its key, the corresponding element of the specified
+        // 'keys' array, or 'end()' if no such entry exists in this map.  The
+        // behavior is undefined unless 'results' and 'keys' each have at least
+        // 'numKeys' elements.  Note that the result is the same as invoking
+        // 'find' for each key, but this method is typically faster for large
+        // maps (see {Batched Lookup}).
+
     HASH hash_function() const;
         // Return (a copy of) the unary hash functor used by this map to
         // generate a hash value (of type 'bsl::size_t') for a 'KEY' object.
@@ -1210,6 +1242,15 @@ FlatHashMap<KEY, VALUE, HASH, EQUAL>::find(const KEY& key)
     return d_impl.find(key);
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::findMany(iterator    *results,
+                                                    const KEY   *keys,
+                                                    bsl::size_t  numKeys)
+{
+    d_impl.findMany(results, keys, numKeys);
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 template <class INPUT_ITERATOR>
 void FlatHashMap<KEY, VALUE, HASH, EQUAL>::insert(INPUT_ITERATOR first,
@@ -1322,6 +1363,16 @@ FlatHashMap<KEY, VALUE, HASH, EQUAL>::find(const KEY& key) const
     return d_impl.find(key);
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::findMany(
+                                               const_iterator *results,
+                                               const KEY      *keys,
+                                               bsl::size_t     numKeys) const
+{
+    d_impl.findMany(results, keys, numKeys);
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 inline
 HASH FlatHashMap<KEY, VALUE, HASH, EQUAL>::hash_function() const
@@ -139,6 +139,7 @@ using namespace bsl;
 // [17] iterator erase(iterator);
 // [18] iterator erase(const_iterator, const_iterator);
 // [24] iterator find(const KEY& key);
+// [29] void findMany(iterator *, const KEY *, size_t);
 // [ 2] bsl::pair<iterator, bool> insert(FORWARD_REF(VALUE_TYPE) entry)
 // [28] iterator insert(const_iterator, FORWARD_REF(VALUE_TYPE) entry)
 // [16] void insert(INPUT_ITERATOR, INPUT_ITERATOR);
@@ -159,6 +160,7 @@ using namespace bsl;
 // [11] bool empty() const;
 // [12] bsl::pair<ci, ci> equal_range(const KEY&) const;
 // [ 4] const_iterator find(const KEY&) const;
+// [29] void findMany(const_iterator *, const KEY *, size_t) const;
 // [ 4] HASH hash_function() const;
 // [ 4] EQUAL key_eq() const;
 // [11] float load_factor() const;
@@ -179,11 +181,13 @@ using namespace bsl;
 // FREE FUNCTIONS
 // [ 8] void swap(FlatHashMap&, FlatHashMap&);
 // ----------------------------------------------------------------------------
-// [29] USAGE EXAMPLE
+// [30] USAGE EXAMPLE
 // [26] CONCERN: 'FlatHashMap' has the necessary type traits
 // [27] DRQS 165583038: 'insert' with conversion can crash
 // [ 1] BREATHING TEST
 // [-1] PERFORMANCE TEST
+// [-2] PERFORMANCE TEST: LOAD FACTOR
+// [-3] PERFORMANCE TEST: BATCHED LOOKUP
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -387,6 +391,13 @@ class EqualAndState {
 //                     GLOBAL FUNCTIONS FOR TESTING
 // ----------------------------------------------------------------------------
 
+bsl::size_t minCapacity(bsl::size_t capacity)
+    // Return the larger of the specified 'capacity' and the minimum non-zero
+    // capacity of a table, '2 * k_SIZE'.
+{
+    return capacity > 2u * k_SIZE ? capacity : 2u * k_SIZE;
+}
+
 template <class KEY>
 void testCase15MoveAssignment(int id, bool allocates)
     // Address the move assignment concerns of test case 15 for the specified
@@ -966,6 +977,131 @@ bsls::TimeInterval performanceFindNotPresent(MAP *map)
     return results[NUM_TRIAL / 2];
 }
 
+template <class MAP>
+double performanceFindAtLoad(MAP *map, bsl::size_t numElements, bool present)
+    // For the specified 'map', insert the specified 'numElements' values and
+    // then invoke 'find()', once per inserted value, with values matching
+    // those inserted if the specified 'present' is 'true', and with values not
+    // matching those inserted otherwise.  Return the median, over several
+    // trials, of the average duration in nanoseconds of one 'find()'.  The
+    // behavior is undefined unless 'numElements' is not a multiple of 7919.
+{
+    const int         NUM_TRIAL = 11;
+    const bsl::size_t STRIDE    = 7919;  // a prime, so that the lookups visit
+                                         // each value once in a scattered
+                                         // order
+
+    for (bsl::size_t i = 0; i < numElements; ++i) {
+        const int key = static_cast<int>(i * 2);
+
+        map->insert(bsl::make_pair(key, key));
+    }
+
+    const int offset = present ? 0 : 1;
+
+    bsl::vector<bsls::TimeInterval> results;
+    for (int trial = 0; trial < NUM_TRIAL; ++trial) {
+        bsls::TimeInterval start = bsls::SystemTime::nowMonotonicClock();
+
+        bsl::size_t j = 0;
+        for (bsl::size_t i = 0; i < numElements; ++i) {
+            if (map->end() != map->find(static_cast<int>(j * 2) + offset)) {
+                ++s_antiOptimization;
+            }
+            j += STRIDE;
+            while (j >= numElements) {
+                j -= numElements;
+            }
+        }
+
+        results.push_back(bsls::SystemTime::nowMonotonicClock() - start);
+    }
+
+    bsl::sort(results.begin(), results.end());
+
+    return static_cast<double>(results[NUM_TRIAL / 2].totalNanoseconds())
+         / static_cast<double>(numElements);
+}
+
+template <class MAP>
+double performanceFindMany(MAP         *map,
+                           bsl::size_t  numElements,
+                           bool         present,
+                           bool         batched)
+    // For the specified 'map', insert the specified 'numElements' values and
+    // then look up, once per inserted value, values matching those inserted if
+    // the specified 'present' is 'true', and values not matching those
+    // inserted otherwise, using 'findMany' on consecutive batches of values if
+    // the specified 'batched' is 'true', and 'find' otherwise.  Return the
+    // median, over several trials, of the average duration in nanoseconds of
+    // one lookup.  The behavior is undefined unless 'numElements' is not a
+    // multiple of 7919.
+{
+    const int         NUM_TRIAL  = 11;
+    const bsl::size_t STRIDE     = 7919;  // see 'performanceFindAtLoad'
+    const bsl::size_t BATCH_SIZE = 256;   // number of keys per 'findMany'
+
+    for (bsl::size_t i = 0; i < numElements; ++i) {
+        const int key = static_cast<int>(i * 2);
+
+        map->insert(bsl::make_pair(key, key));
+    }
+
+    const MAP& X = *map;
+
+    bsl::vector<int> keys(numElements);
+    {
+        const int offset = present ? 0 : 1;
+
+        bsl::size_t j = 0;
+        for (bsl::size_t i = 0; i < numElements; ++i) {
+            keys[i] = static_cast<int>(j * 2) + offset;
+
+            j += STRIDE;
+            while (j >= numElements) {
+                j -= numElements;
+            }
+        }
+    }
+
+    bsl::vector<typename MAP::const_iterator> results(BATCH_SIZE);
+
+    bsl::vector<bsls::TimeInterval> durations;
+    for (int trial = 0; trial < NUM_TRIAL; ++trial) {
+        bsls::TimeInterval start = bsls::SystemTime::nowMonotonicClock();
+
+        if (batched) {
+            for (bsl::size_t i = 0; i < numElements; i += BATCH_SIZE) {
+                const bsl::size_t numKeys = numElements - i < BATCH_SIZE
+                                          ? numElements - i
+                                          : BATCH_SIZE;
+
+                X.findMany(results.data(), keys.data() + i, numKeys);
+
+                for (bsl::size_t k = 0; k < numKeys; ++k) {
+                    if (X.end() != results[k]) {
+                        ++s_antiOptimization;
+                    }
+                }
+            }
+        }
+        else {
+            for (bsl::size_t i = 0; i < numElements; ++i) {
+                if (X.end() != X.find(keys[i])) {
+                    ++s_antiOptimization;
+                }
+            }
+        }
+
+        durations.push_back(bsls::SystemTime::nowMonotonicClock() - start);
+    }
+
+    bsl::sort(durations.begin(), durations.end());
+
+    return static_cast<double>(durations[NUM_TRIAL / 2].totalNanoseconds())
+         / static_cast<double>(numElements);
+}
+
 // ============================================================================
 //                               MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -989,7 +1125,7 @@ int main(int argc, char *argv[])
     bslma::Default::setDefaultAllocatorRaw(&defaultAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 29: {
+      case 30: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -1137,6 +1273,65 @@ int main(int argc, char *argv[])
 //  among         3
 //..
       } break;
+      case 29: {
+        // --------------------------------------------------------------------
+        // 'findMany'
+        //   The 'findMany' methods operate as expected.
+        //
+        // Concerns:
+        //: 1 The methods 'findMany' correctly forward to the implementation
+        //:   class, and load the same iterators as 'find' for keys present in
+        //:   and absent from the map.
+        //
+        // Plan:
+        //: 1 Create a map having the even keys of a range, invoke both
+        //:   overloads of 'findMany' for every key of the range, and compare
+        //:   the results with 'find'.  (C-1)
+        //
+        // Testing:
+        //   void findMany(iterator *, const KEY *, size_t);
+        //   void findMany(const_iterator *, const KEY *, size_t) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'findMany'" << endl
+                          << "==========" << endl;
+
+        typedef bdlc::FlatHashMap<int, int> Obj;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        const int NUM_KEYS = 200;
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        int keys[NUM_KEYS];
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            keys[i] = i;
+            if (0 == i % 2) {
+                mX.insert(bsl::make_pair(i, -i));
+            }
+        }
+
+        Obj::iterator       results[NUM_KEYS];
+        Obj::const_iterator constResults[NUM_KEYS];
+
+        mX.findMany(results, keys, NUM_KEYS);
+        X.findMany(constResults, keys, NUM_KEYS);
+
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            ASSERTV(i, mX.find(i) == results[i]);
+            ASSERTV(i,  X.find(i) == constResults[i]);
+
+            if (0 == i % 2) {
+                ASSERTV(i, mX.end() != results[i]);
+                ASSERTV(i,       -i == results[i]->second);
+            }
+            else {
+                ASSERTV(i, mX.end() == results[i]);
+            }
+        }
+      } break;
       case 28: {
         // --------------------------------------------------------------------
         // HINT INSERT
@@ -1881,15 +2076,15 @@ int main(int argc, char *argv[])
 
                 Obj mX(IDATA, 32);  const Obj& X = mX;
 
-                ASSERT(          32 == X.capacity());
-                ASSERT(           1 == X.size());
-                ASSERT(        true == X.contains(1));
-                ASSERT(ExpHash()(0) == X.hash_function()(0));
-                ASSERT(ExpHash()(1) == X.hash_function()(1));
-                ASSERT(ExpHash()(7) == X.hash_function()(7));
-                ASSERT(        true == X.key_eq()(0, 0));
-                ASSERT(       false == X.key_eq()(0, 1));
-                ASSERT(         &da == X.allocator());
+                ASSERT(minCapacity(32) == X.capacity());
+                ASSERT(              1 == X.size());
+                ASSERT(           true == X.contains(1));
+                ASSERT(   ExpHash()(0) == X.hash_function()(0));
+                ASSERT(   ExpHash()(1) == X.hash_function()(1));
+                ASSERT(   ExpHash()(7) == X.hash_function()(7));
+                ASSERT(           true == X.key_eq()(0, 0));
+                ASSERT(          false == X.key_eq()(0, 1));
+                ASSERT(            &da == X.allocator());
             }
             {
                 typedef bsl::string                               Key;
@@ -1932,15 +2127,15 @@ int main(int argc, char *argv[])
 
                 Obj mX(IDATA, 32, (bslma::Allocator *)0);  const Obj& X = mX;
 
-                ASSERT(          32 == X.capacity());
-                ASSERT(           1 == X.size());
-                ASSERT(        true == X.contains(1));
-                ASSERT(ExpHash()(0) == X.hash_function()(0));
-                ASSERT(ExpHash()(1) == X.hash_function()(1));
-                ASSERT(ExpHash()(7) == X.hash_function()(7));
-                ASSERT(        true == X.key_eq()(0, 0));
-                ASSERT(       false == X.key_eq()(0, 1));
-                ASSERT(         &da == X.allocator());
+                ASSERT(minCapacity(32) == X.capacity());
+                ASSERT(              1 == X.size());
+                ASSERT(           true == X.contains(1));
+                ASSERT(   ExpHash()(0) == X.hash_function()(0));
+                ASSERT(   ExpHash()(1) == X.hash_function()(1));
+                ASSERT(   ExpHash()(7) == X.hash_function()(7));
+                ASSERT(           true == X.key_eq()(0, 0));
+                ASSERT(          false == X.key_eq()(0, 1));
+                ASSERT(            &da == X.allocator());
             }
             {
                 typedef bsl::string                               Key;
@@ -1981,15 +2176,15 @@ int main(int argc, char *argv[])
 
                 Obj mX(IDATA, 32, hasher);  const Obj& X = mX;
 
-                ASSERT(   32 == X.capacity());
-                ASSERT(    1 == X.size());
-                ASSERT( true == X.contains(1));
-                ASSERT(    7 == X.hash_function()(0));
-                ASSERT(    7 == X.hash_function()(1));
-                ASSERT(    7 == X.hash_function()(7));
-                ASSERT( true == X.key_eq()(0, 0));
-                ASSERT(false == X.key_eq()(0, 1));
-                ASSERT(  &da == X.allocator());
+                ASSERT(minCapacity(32) == X.capacity());
+                ASSERT(              1 == X.size());
+                ASSERT(           true == X.contains(1));
+                ASSERT(              7 == X.hash_function()(0));
+                ASSERT(              7 == X.hash_function()(1));
+                ASSERT(              7 == X.hash_function()(7));
+                ASSERT(           true == X.key_eq()(0, 0));
+                ASSERT(          false == X.key_eq()(0, 1));
+                ASSERT(            &da == X.allocator());
             }
             {
                 typedef bsl::string                         Key;
@@ -2032,15 +2227,15 @@ int main(int argc, char *argv[])
 
                 Obj mX(IDATA, 32, hasher, Equal());  const Obj& X = mX;
 
-                ASSERT(   32 == X.capacity());
-                ASSERT(    1 == X.size());
-                ASSERT( true == X.contains(1));
-                ASSERT(    7 == X.hash_function()(0));
-                ASSERT(    7 == X.hash_function()(1));
-                ASSERT(    7 == X.hash_function()(7));
-                ASSERT( true == X.key_eq()(0, 0));
-                ASSERT(false == X.key_eq()(0, 1));
-                ASSERT(  &da == X.allocator());
+                ASSERT(minCapacity(32) == X.capacity());
+                ASSERT(              1 == X.size());
+                ASSERT(           true == X.contains(1));
+                ASSERT(              7 == X.hash_function()(0));
+                ASSERT(              7 == X.hash_function()(1));
+                ASSERT(              7 == X.hash_function()(7));
+                ASSERT(           true == X.key_eq()(0, 0));
+                ASSERT(          false == X.key_eq()(0, 1));
+                ASSERT(            &da == X.allocator());
             }
             {
                 typedef bsl::string                                Key;
@@ -2234,15 +2429,15 @@ int main(int argc, char *argv[])
                 Obj        mX(IDATA.begin(), ++IDATA.begin(), 32);
                 const Obj& X = mX;
 
-                ASSERT(          32 == X.capacity());
-                ASSERT(           1 == X.size());
-                ASSERT(        true == X.contains(1));
-                ASSERT(ExpHash()(0) == X.hash_function()(0));
-                ASSERT(ExpHash()(1) == X.hash_function()(1));
-                ASSERT(ExpHash()(7) == X.hash_function()(7));
-                ASSERT(        true == X.key_eq()(0, 0));
-                ASSERT(       false == X.key_eq()(0, 1));
-                ASSERT(         &da == X.allocator());
+                ASSERT(minCapacity(32) == X.capacity());
+                ASSERT(              1 == X.size());
+                ASSERT(           true == X.contains(1));
+                ASSERT(   ExpHash()(0) == X.hash_function()(0));
+                ASSERT(   ExpHash()(1) == X.hash_function()(1));
+                ASSERT(   ExpHash()(7) == X.hash_function()(7));
+                ASSERT(           true == X.key_eq()(0, 0));
+                ASSERT(          false == X.key_eq()(0, 1));
+                ASSERT(            &da == X.allocator());
             }
             {
                 typedef bsl::string                               Key;
@@ -2290,15 +2485,15 @@ int main(int argc, char *argv[])
                               (bslma::Allocator *)0);
                 const Obj& X = mX;
 
-                ASSERT(          32 == X.capacity());
-                ASSERT(           1 == X.size());
-                ASSERT(        true == X.contains(1));
-                ASSERT(ExpHash()(0) == X.hash_function()(0));
-                ASSERT(ExpHash()(1) == X.hash_function()(1));
-                ASSERT(ExpHash()(7) == X.hash_function()(7));
-                ASSERT(        true == X.key_eq()(0, 0));
-                ASSERT(       false == X.key_eq()(0, 1));
-                ASSERT(         &da == X.allocator());
+                ASSERT(minCapacity(32) == X.capacity());
+                ASSERT(              1 == X.size());
+                ASSERT(           true == X.contains(1));
+                ASSERT(   ExpHash()(0) == X.hash_function()(0));
+                ASSERT(   ExpHash()(1) == X.hash_function()(1));
+                ASSERT(   ExpHash()(7) == X.hash_function()(7));
+                ASSERT(           true == X.key_eq()(0, 0));
+                ASSERT(          false == X.key_eq()(0, 1));
+                ASSERT(            &da == X.allocator());
             }
             {
                 typedef bsl::string                               Key;
@@ -2341,15 +2536,15 @@ int main(int argc, char *argv[])
                 Obj        mX(IDATA.begin(), ++IDATA.begin(), 32, hasher);
                 const Obj& X = mX;
 
-                ASSERT(   32 == X.capacity());
-                ASSERT(    1 == X.size());
-                ASSERT( true == X.contains(1));
-                ASSERT(    7 == X.hash_function()(0));
-                ASSERT(    7 == X.hash_function()(1));
-                ASSERT(    7 == X.hash_function()(7));
-                ASSERT( true == X.key_eq()(0, 0));
-                ASSERT(false == X.key_eq()(0, 1));
-                ASSERT(  &da == X.allocator());
+                ASSERT(minCapacity(32) == X.capacity());
+                ASSERT(              1 == X.size());
+                ASSERT(           true == X.contains(1));
+                ASSERT(              7 == X.hash_function()(0));
+                ASSERT(              7 == X.hash_function()(1));
+                ASSERT(              7 == X.hash_function()(7));
+                ASSERT(           true == X.key_eq()(0, 0));
+                ASSERT(          false == X.key_eq()(0, 1));
+                ASSERT(            &da == X.allocator());
             }
             {
                 typedef bsl::string                         Key;
@@ -2402,15 +2597,15 @@ int main(int argc, char *argv[])
                               Equal());
                 const Obj& X = mX;
 
-                ASSERT(   32 == X.capacity());
-                ASSERT(    1 == X.size());
-                ASSERT( true == X.contains(1));
-                ASSERT(    7 == X.hash_function()(0));
-                ASSERT(    7 == X.hash_function()(1));
-                ASSERT(    7 == X.hash_function()(7));
-                ASSERT( true == X.key_eq()(0, 0));
-                ASSERT(false == X.key_eq()(0, 1));
-                ASSERT(  &da == X.allocator());
+                ASSERT(minCapacity(32) == X.capacity());
+                ASSERT(              1 == X.size());
+                ASSERT(           true == X.contains(1));
+                ASSERT(              7 == X.hash_function()(0));
+                ASSERT(              7 == X.hash_function()(1));
+                ASSERT(              7 == X.hash_function()(7));
+                ASSERT(           true == X.key_eq()(0, 0));
+                ASSERT(          false == X.key_eq()(0, 1));
+                ASSERT(            &da == X.allocator());
             }
             {
                 typedef bsl::string                                Key;
@@ -2478,7 +2673,7 @@ int main(int argc, char *argv[])
 
             mX.rehash(32);
 
-            ASSERT(32 == X.capacity());
+            ASSERT(minCapacity(32) == X.capacity());
 
             mX.rehash(64);
 
@@ -2495,7 +2690,7 @@ int main(int argc, char *argv[])
 
             mX.reserve(28);
 
-            ASSERT(32 == X.capacity());
+            ASSERT(minCapacity(32) == X.capacity());
 
             mX.reserve(56);
 
@@ -4078,12 +4273,12 @@ int main(int argc, char *argv[])
 
                 Obj mX(32, Hash(1), Equal(), &oa);  const Obj& X = mX;
 
-                ASSERT(   32 == X.capacity());
-                ASSERT(    1 == X.hash_function()(0));
-                ASSERT(false == X.key_eq()(0, 0));
-                ASSERT( true == X.key_eq()(0, 1));
-                ASSERT(0.875 == X.max_load_factor());
-                ASSERT(  &oa == X.allocator());
+                ASSERT(minCapacity(32) == X.capacity());
+                ASSERT(              1 == X.hash_function()(0));
+                ASSERT(          false == X.key_eq()(0, 0));
+                ASSERT(           true == X.key_eq()(0, 1));
+                ASSERT(          0.875 == X.max_load_factor());
+                ASSERT(            &oa == X.allocator());
             }
         }
 
@@ -4306,13 +4501,13 @@ int main(int argc, char *argv[])
 
                 Obj mX(32);  const Obj& X = mX;
 
-                ASSERT(          32 == X.capacity());
-                ASSERT(ExpHash()(0) == X.hash_function()(0));
-                ASSERT(ExpHash()(1) == X.hash_function()(1));
-                ASSERT(ExpHash()(7) == X.hash_function()(7));
-                ASSERT(        true == X.key_eq()(0, 0));
-                ASSERT(       false == X.key_eq()(0, 1));
-                ASSERT(         &da == X.allocator());
+                ASSERT(minCapacity(32) == X.capacity());
+                ASSERT(   ExpHash()(0) == X.hash_function()(0));
+                ASSERT(   ExpHash()(1) == X.hash_function()(1));
+                ASSERT(   ExpHash()(7) == X.hash_function()(7));
+                ASSERT(           true == X.key_eq()(0, 0));
+                ASSERT(          false == X.key_eq()(0, 1));
+                ASSERT(            &da == X.allocator());
 
                 ASSERT(2 == da.numAllocations());
             }
@@ -4357,13 +4552,13 @@ int main(int argc, char *argv[])
 
                 Obj mX(32, (bslma::Allocator *)0);  const Obj& X = mX;
 
-                ASSERT(          32 == X.capacity());
-                ASSERT(ExpHash()(0) == X.hash_function()(0));
-                ASSERT(ExpHash()(1) == X.hash_function()(1));
-                ASSERT(ExpHash()(7) == X.hash_function()(7));
-                ASSERT(        true == X.key_eq()(0, 0));
-                ASSERT(       false == X.key_eq()(0, 1));
-                ASSERT(         &da == X.allocator());
+                ASSERT(minCapacity(32) == X.capacity());
+                ASSERT(   ExpHash()(0) == X.hash_function()(0));
+                ASSERT(   ExpHash()(1) == X.hash_function()(1));
+                ASSERT(   ExpHash()(7) == X.hash_function()(7));
+                ASSERT(           true == X.key_eq()(0, 0));
+                ASSERT(          false == X.key_eq()(0, 1));
+                ASSERT(            &da == X.allocator());
 
                 ASSERT(2 == da.numAllocations());
             }
@@ -4406,13 +4601,13 @@ int main(int argc, char *argv[])
 
                 Obj mX(32, hasher);  const Obj& X = mX;
 
-                ASSERT(   32 == X.capacity());
-                ASSERT(    7 == X.hash_function()(0));
-                ASSERT(    7 == X.hash_function()(1));
-                ASSERT(    7 == X.hash_function()(7));
-                ASSERT( true == X.key_eq()(0, 0));
-                ASSERT(false == X.key_eq()(0, 1));
-                ASSERT(  &da == X.allocator());
+                ASSERT(minCapacity(32) == X.capacity());
+                ASSERT(              7 == X.hash_function()(0));
+                ASSERT(              7 == X.hash_function()(1));
+                ASSERT(              7 == X.hash_function()(7));
+                ASSERT(           true == X.key_eq()(0, 0));
+                ASSERT(          false == X.key_eq()(0, 1));
+                ASSERT(            &da == X.allocator());
 
                 ASSERT(2 == da.numAllocations());
             }
@@ -4457,13 +4652,13 @@ int main(int argc, char *argv[])
 
                 Obj mX(32, hasher, Equal());  const Obj& X = mX;
 
-                ASSERT(   32 == X.capacity());
-                ASSERT(    7 == X.hash_function()(0));
-                ASSERT(    7 == X.hash_function()(1));
-                ASSERT(    7 == X.hash_function()(7));
-                ASSERT( true == X.key_eq()(0, 0));
-                ASSERT(false == X.key_eq()(0, 1));
-                ASSERT(  &da == X.allocator());
+                ASSERT(minCapacity(32) == X.capacity());
+                ASSERT(              7 == X.hash_function()(0));
+                ASSERT(              7 == X.hash_function()(1));
+                ASSERT(              7 == X.hash_function()(7));
+                ASSERT(           true == X.key_eq()(0, 0));
+                ASSERT(          false == X.key_eq()(0, 1));
+                ASSERT(            &da == X.allocator());
 
                 ASSERT(2 == da.numAllocations());
             }
@@ -4626,16 +4821,16 @@ int main(int argc, char *argv[])
 
             mX.clear();
 
-            ASSERT( 0 == X.size());
-            ASSERT(32 == X.capacity());
+            ASSERT(              0 == X.size());
+            ASSERT(minCapacity(32) == X.capacity());
 
             mX.insert(bsl::make_pair(1, 1));
             mX.insert(bsl::make_pair(2, 2));
 
             mX.clear();
 
-            ASSERT( 0 == X.size());
-            ASSERT(32 == X.capacity());
+            ASSERT(              0 == X.size());
+            ASSERT(minCapacity(32) == X.capacity());
         }
 
         if (verbose) cout << "Testing 'reset'." << endl;
@@ -4817,6 +5012,190 @@ int main(int argc, char *argv[])
             cout << "anti-optimization: " << s_antiOptimization << endl;
         }
       } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: LOAD FACTOR
+        //    Measure 'find' as the load factor of 'bdlc::FlatHashMap'
+        //    approaches its maximum, relative to 'bsl::unordered_map'.
+        //
+        // Concerns:
+        //: 1 The cost of 'find', both for values present in the map and for
+        //:   values not present, remains low as the probe sequences of
+        //:   'bdlc::FlatHashMap' lengthen with the load factor.
+        //
+        // Plan:
+        //: 1 For tables of a capacity fitting in the level 1 or 2 caches and
+        //:   of a capacity exceeding them, loaded to 50%, 75%, and 87.5% (the
+        //:   maximum load factor), measure the average duration of 'find'
+        //:   with values present and values not present, and report the
+        //:   results next to those of a 'bsl::unordered_map' having the same
+        //:   elements.  Note that no assertion is made on the relative
+        //:   performance as this case is meant for comparing builds (e.g.,
+        //:   with and without wider group controls).  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST: LOAD FACTOR
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST: LOAD FACTOR" << endl
+                          << "=============================" << endl;
+
+        bslma::NewDeleteAllocator oa;
+
+        bslma::DefaultAllocatorGuard dag(&oa);
+
+        static const struct {
+            int         d_line;       // source line number
+            bsl::size_t d_capacity;   // capacity of the flat hash map
+            bsl::size_t d_numerator;  // load factor, in eighths
+        } DATA[] = {
+            //LINE  CAPACITY  NUM
+            //----  --------  ---
+            { L_,   1 << 14,    4 },
+            { L_,   1 << 14,    6 },
+            { L_,   1 << 14,    7 },
+            { L_,   1 << 20,    4 },
+            { L_,   1 << 20,    6 },
+            { L_,   1 << 20,    7 },
+        };
+        const bsl::size_t NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        cout << "group size: " << bdlc::FlatHashTable_GroupControl::k_SIZE
+             << endl
+             << "   capacity   load   flat hit  unord hit"
+             << "  flat miss unord miss  (ns/find)" << endl;
+
+        for (bsl::size_t ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE     = DATA[ti].d_line;
+            const bsl::size_t CAPACITY = DATA[ti].d_capacity;
+            const bsl::size_t NUM      = CAPACITY * DATA[ti].d_numerator / 8;
+
+            double result[4];
+
+            for (int mode = 0; mode < 4; ++mode) {
+                const bool present = mode < 2;
+
+                if (0 == mode % 2) {
+                    bdlc::FlatHashMap<int, int> mX(CAPACITY);
+                    const bdlc::FlatHashMap<int, int>& X = mX;
+
+                    result[mode] = performanceFindAtLoad(&mX, NUM, present);
+
+                    ASSERTV(LINE, X.capacity(), CAPACITY == X.capacity());
+                }
+                else {
+                    bsl::unordered_map<int, int> mY;
+
+                    result[mode] = performanceFindAtLoad(&mY, NUM, present);
+                }
+            }
+
+            cout << setw(11) << CAPACITY
+                 << setw(6) << setprecision(3)
+                 << 100.0 * static_cast<double>(DATA[ti].d_numerator) / 8.0
+                 << '%';
+            for (int mode = 0; mode < 4; ++mode) {
+                cout << setw(11) << setprecision(3) << result[mode];
+            }
+            cout << endl;
+        }
+
+        if (veryVeryVeryVerbose) {
+            cout << "anti-optimization: " << s_antiOptimization << endl;
+        }
+      } break;
+      case -3: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: BATCHED LOOKUP
+        //    Compare 'findMany' with repeated 'find' for 'bdlc::FlatHashMap'
+        //    and 'bsl::unordered_map'.
+        //
+        // Concerns:
+        //: 1 'findMany' is not slower than repeated 'find' for small maps,
+        //:   and is faster for maps exceeding the size of the caches.
+        //
+        // Plan:
+        //: 1 For maps of increasing size, measure the average duration of a
+        //:   lookup, for values present and values not present, performed by
+        //:   'find' and by 'findMany' on batches of values, and report the
+        //:   results for both 'bdlc::FlatHashMap' and 'bsl::unordered_map'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST: BATCHED LOOKUP
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST: BATCHED LOOKUP" << endl
+                          << "================================" << endl;
+
+        bslma::NewDeleteAllocator oa;
+
+        bslma::DefaultAllocatorGuard dag(&oa);
+
+        static const struct {
+            int         d_line;       // source line number
+            bsl::size_t d_capacity;   // capacity of the flat hash map
+            bsl::size_t d_numerator;  // load factor, in eighths
+        } DATA[] = {
+            //LINE  CAPACITY  NUM
+            //----  --------  ---
+            { L_,   1 << 14,    7 },
+            { L_,   1 << 20,    4 },
+            { L_,   1 << 20,    7 },
+            { L_,   1 << 22,    7 },
+        };
+        const bsl::size_t NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        cout << "                      find   findMany"
+             << "       find   findMany  (ns/lookup)" << endl;
+
+        for (bsl::size_t ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE     = DATA[ti].d_line;
+            const bsl::size_t CAPACITY = DATA[ti].d_capacity;
+            const bsl::size_t NUM      = CAPACITY * DATA[ti].d_numerator / 8;
+
+            for (int present = 1; present >= 0; --present) {
+                double flat[2];
+                double unordered[2];
+
+                for (int batched = 0; batched < 2; ++batched) {
+                    {
+                        bdlc::FlatHashMap<int, int> mX(CAPACITY);
+                        const bdlc::FlatHashMap<int, int>& X = mX;
+
+                        flat[batched] = performanceFindMany(&mX,
+                                                            NUM,
+                                                            present,
+                                                            batched);
+
+                        ASSERTV(LINE, X.capacity(), CAPACITY == X.capacity());
+                    }
+                    {
+                        bsl::unordered_map<int, int> mY;
+
+                        unordered[batched] = performanceFindMany(&mY,
+                                                                 NUM,
+                                                                 present,
+                                                                 batched);
+                    }
+                }
+
+                cout << "size " << setw(8) << NUM
+                     << (present ? " hit " : " miss")
+                     << "  flat" << setw(11) << setprecision(3) << flat[0]
+                     << setw(11) << setprecision(3) << flat[1]
+                     << "  unord" << setw(11) << setprecision(3)
+                     << unordered[0]
+                     << setw(11) << setprecision(3) << unordered[1] << endl;
+            }
+        }
+
+        if (veryVeryVeryVerbose) {
+            cout << "anti-optimization: " << s_antiOptimization << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -379,6 +379,13 @@ class EqualAndState {
 //                     GLOBAL FUNCTIONS FOR TESTING
 // ----------------------------------------------------------------------------
 
+bsl::size_t minCapacity(bsl::size_t capacity)
+    // Return the larger of the specified 'capacity' and the minimum non-zero
+    // capacity of a table, '2 * k_SIZE'.
+{
+    return capacity > 2u * k_SIZE ? capacity : 2u * k_SIZE;
+}
+
 template <class KEY>
 void testCase15MoveAssignment(int id, bool allocates)
     // Address the move assignment concerns of test case 15 for the specified
@@ -1787,15 +1794,15 @@ cout << endl
 
                 Obj mX(IDATA, 32);  const Obj& X = mX;
 
-                ASSERT(          32 == X.capacity());
-                ASSERT(           1 == X.size());
-                ASSERT(        true == X.contains(1));
-                ASSERT(ExpHash()(0) == X.hash_function()(0));
-                ASSERT(ExpHash()(1) == X.hash_function()(1));
-                ASSERT(ExpHash()(7) == X.hash_function()(7));
-                ASSERT(        true == X.key_eq()(0, 0));
-                ASSERT(       false == X.key_eq()(0, 1));
-                ASSERT(         &da == X.allocator());
+                ASSERT(minCapacity(32) == X.capacity());
+                ASSERT(              1 == X.size());
+                ASSERT(           true == X.contains(1));
+                ASSERT(   ExpHash()(0) == X.hash_function()(0));
+                ASSERT(   ExpHash()(1) == X.hash_function()(1));
+                ASSERT(   ExpHash()(7) == X.hash_function()(7));
+                ASSERT(           true == X.key_eq()(0, 0));
+                ASSERT(          false == X.key_eq()(0, 1));
+                ASSERT(            &da == X.allocator());
             }
             {
                 typedef bsl::string                               Key;
@@ -1836,15 +1843,15 @@ cout << endl
 
                 Obj mX(IDATA, 32, (bslma::Allocator *)0);  const Obj& X = mX;
 
-                ASSERT(          32 == X.capacity());
-                ASSERT(           1 == X.size());
-                ASSERT(        true == X.contains(1));
-                ASSERT(ExpHash()(0) == X.hash_function()(0));
-                ASSERT(ExpHash()(1) == X.hash_function()(1));
-                ASSERT(ExpHash()(7) == X.hash_function()(7));
-                ASSERT(        true == X.key_eq()(0, 0));
-                ASSERT(       false == X.key_eq()(0, 1));
-                ASSERT(         &da == X.allocator());
+                ASSERT(minCapacity(32) == X.capacity());
+                ASSERT(              1 == X.size());
+                ASSERT(           true == X.contains(1));
+                ASSERT(   ExpHash()(0) == X.hash_function()(0));
+                ASSERT(   ExpHash()(1) == X.hash_function()(1));
+                ASSERT(   ExpHash()(7) == X.hash_function()(7));
+                ASSERT(           true == X.key_eq()(0, 0));
+                ASSERT(          false == X.key_eq()(0, 1));
+                ASSERT(            &da == X.allocator());
             }
             {
                 typedef bsl::string                               Key;
@@ -1883,15 +1890,15 @@ cout << endl
 
                 Obj mX(IDATA, 32, hasher);  const Obj& X = mX;
 
-                ASSERT(   32 == X.capacity());
-                ASSERT(    1 == X.size());
-                ASSERT( true == X.contains(1));
-                ASSERT(    7 == X.hash_function()(0));
-                ASSERT(    7 == X.hash_function()(1));
-                ASSERT(    7 == X.hash_function()(7));
-                ASSERT( true == X.key_eq()(0, 0));
-                ASSERT(false == X.key_eq()(0, 1));
-                ASSERT(  &da == X.allocator());
+                ASSERT(minCapacity(32) == X.capacity());
+                ASSERT(              1 == X.size());
+                ASSERT(           true == X.contains(1));
+                ASSERT(              7 == X.hash_function()(0));
+                ASSERT(              7 == X.hash_function()(1));
+                ASSERT(              7 == X.hash_function()(7));
+                ASSERT(           true == X.key_eq()(0, 0));
+                ASSERT(          false == X.key_eq()(0, 1));
+                ASSERT(            &da == X.allocator());
             }
             {
                 typedef bsl::string                  Key;
@@ -1932,15 +1939,15 @@ cout << endl
 
                 Obj mX(IDATA, 32, hasher, Equal());  const Obj& X = mX;
 
-                ASSERT(   32 == X.capacity());
-                ASSERT(    1 == X.size());
-                ASSERT( true == X.contains(1));
-                ASSERT(    7 == X.hash_function()(0));
-                ASSERT(    7 == X.hash_function()(1));
-                ASSERT(    7 == X.hash_function()(7));
-                ASSERT( true == X.key_eq()(0, 0));
-                ASSERT(false == X.key_eq()(0, 1));
-                ASSERT(  &da == X.allocator());
+                ASSERT(minCapacity(32) == X.capacity());
+                ASSERT(              1 == X.size());
+                ASSERT(           true == X.contains(1));
+                ASSERT(              7 == X.hash_function()(0));
+                ASSERT(              7 == X.hash_function()(1));
+                ASSERT(              7 == X.hash_function()(7));
+                ASSERT(           true == X.key_eq()(0, 0));
+                ASSERT(          false == X.key_eq()(0, 1));
+                ASSERT(            &da == X.allocator());
             }
             {
                 typedef bsl::string                         Key;
@@ -2128,15 +2135,15 @@ cout << endl
                 Obj        mX(IDATA.begin(), IDATA.begin() + 1, 32);
                 const Obj& X = mX;
 
-                ASSERT(          32 == X.capacity());
-                ASSERT(           1 == X.size());
-                ASSERT(        true == X.contains(1));
-                ASSERT(ExpHash()(0) == X.hash_function()(0));
-                ASSERT(ExpHash()(1) == X.hash_function()(1));
-                ASSERT(ExpHash()(7) == X.hash_function()(7));
-                ASSERT(        true == X.key_eq()(0, 0));
-                ASSERT(       false == X.key_eq()(0, 1));
-                ASSERT(         &da == X.allocator());
+                ASSERT(minCapacity(32) == X.capacity());
+                ASSERT(              1 == X.size());
+                ASSERT(           true == X.contains(1));
+                ASSERT(   ExpHash()(0) == X.hash_function()(0));
+                ASSERT(   ExpHash()(1) == X.hash_function()(1));
+                ASSERT(   ExpHash()(7) == X.hash_function()(7));
+                ASSERT(           true == X.key_eq()(0, 0));
+                ASSERT(          false == X.key_eq()(0, 1));
+                ASSERT(            &da == X.allocator());
             }
             {
                 typedef bsl::string                               Key;
@@ -2182,15 +2189,15 @@ cout << endl
                               (bslma::Allocator *)0);
                 const Obj& X = mX;
 
-                ASSERT(          32 == X.capacity());
-                ASSERT(           1 == X.size());
-                ASSERT(        true == X.contains(1));
-                ASSERT(ExpHash()(0) == X.hash_function()(0));
-                ASSERT(ExpHash()(1) == X.hash_function()(1));
-                ASSERT(ExpHash()(7) == X.hash_function()(7));
-                ASSERT(        true == X.key_eq()(0, 0));
-                ASSERT(       false == X.key_eq()(0, 1));
-                ASSERT(         &da == X.allocator());
+                ASSERT(minCapacity(32) == X.capacity());
+                ASSERT(              1 == X.size());
+                ASSERT(           true == X.contains(1));
+                ASSERT(   ExpHash()(0) == X.hash_function()(0));
+                ASSERT(   ExpHash()(1) == X.hash_function()(1));
+                ASSERT(   ExpHash()(7) == X.hash_function()(7));
+                ASSERT(           true == X.key_eq()(0, 0));
+                ASSERT(          false == X.key_eq()(0, 1));
+                ASSERT(            &da == X.allocator());
             }
             {
                 typedef bsl::string                               Key;
@@ -2231,15 +2238,15 @@ cout << endl
                 Obj        mX(IDATA.begin(), IDATA.begin() + 1, 32, hasher);
                 const Obj& X = mX;
 
-                ASSERT(   32 == X.capacity());
-                ASSERT(    1 == X.size());
-                ASSERT( true == X.contains(1));
-                ASSERT(    7 == X.hash_function()(0));
-                ASSERT(    7 == X.hash_function()(1));
-                ASSERT(    7 == X.hash_function()(7));
-                ASSERT( true == X.key_eq()(0, 0));
-                ASSERT(false == X.key_eq()(0, 1));
-                ASSERT(  &da == X.allocator());
+                ASSERT(minCapacity(32) == X.capacity());
+                ASSERT(              1 == X.size());
+                ASSERT(           true == X.contains(1));
+                ASSERT(              7 == X.hash_function()(0));
+                ASSERT(              7 == X.hash_function()(1));
+                ASSERT(              7 == X.hash_function()(7));
+                ASSERT(           true == X.key_eq()(0, 0));
+                ASSERT(          false == X.key_eq()(0, 1));
+                ASSERT(            &da == X.allocator());
             }
             {
                 typedef bsl::string                  Key;
@@ -2290,15 +2297,15 @@ cout << endl
                               Equal());
                 const Obj& X = mX;
 
-                ASSERT(   32 == X.capacity());
-                ASSERT(    1 == X.size());
-                ASSERT( true == X.contains(1));
-                ASSERT(    7 == X.hash_function()(0));
-                ASSERT(    7 == X.hash_function()(1));
-                ASSERT(    7 == X.hash_function()(7));
-                ASSERT( true == X.key_eq()(0, 0));
-                ASSERT(false == X.key_eq()(0, 1));
-                ASSERT(  &da == X.allocator());
+                ASSERT(minCapacity(32) == X.capacity());
+                ASSERT(              1 == X.size());
+                ASSERT(           true == X.contains(1));
+                ASSERT(              7 == X.hash_function()(0));
+                ASSERT(              7 == X.hash_function()(1));
+                ASSERT(              7 == X.hash_function()(7));
+                ASSERT(           true == X.key_eq()(0, 0));
+                ASSERT(          false == X.key_eq()(0, 1));
+                ASSERT(            &da == X.allocator());
             }
             {
                 typedef bsl::string                         Key;
@@ -2366,7 +2373,7 @@ cout << endl
 
             mX.rehash(32);
 
-            ASSERT(32 == X.capacity());
+            ASSERT(minCapacity(32) == X.capacity());
 
             mX.rehash(64);
 
@@ -2383,7 +2390,7 @@ cout << endl
 
             mX.reserve(28);
 
-            ASSERT(32 == X.capacity());
+            ASSERT(minCapacity(32) == X.capacity());
 
             mX.reserve(56);
 
@@ -3709,12 +3716,12 @@ cout << endl
 
                 Obj mX(32, Hash(1), Equal(), &oa);  const Obj& X = mX;
 
-                ASSERT(   32 == X.capacity());
-                ASSERT(    1 == X.hash_function()(0));
-                ASSERT(false == X.key_eq()(0, 0));
-                ASSERT( true == X.key_eq()(0, 1));
-                ASSERT(0.875 == X.max_load_factor());
-                ASSERT(  &oa == X.allocator());
+                ASSERT(minCapacity(32) == X.capacity());
+                ASSERT(              1 == X.hash_function()(0));
+                ASSERT(          false == X.key_eq()(0, 0));
+                ASSERT(           true == X.key_eq()(0, 1));
+                ASSERT(          0.875 == X.max_load_factor());
+                ASSERT(            &oa == X.allocator());
             }
         }
 
@@ -3929,13 +3936,13 @@ cout << endl
 
                 Obj mX(32);  const Obj& X = mX;
 
-                ASSERT(          32 == X.capacity());
-                ASSERT(ExpHash()(0) == X.hash_function()(0));
-                ASSERT(ExpHash()(1) == X.hash_function()(1));
-                ASSERT(ExpHash()(7) == X.hash_function()(7));
-                ASSERT(        true == X.key_eq()(0, 0));
-                ASSERT(       false == X.key_eq()(0, 1));
-                ASSERT(         &da == X.allocator());
+                ASSERT(minCapacity(32) == X.capacity());
+                ASSERT(   ExpHash()(0) == X.hash_function()(0));
+                ASSERT(   ExpHash()(1) == X.hash_function()(1));
+                ASSERT(   ExpHash()(7) == X.hash_function()(7));
+                ASSERT(           true == X.key_eq()(0, 0));
+                ASSERT(          false == X.key_eq()(0, 1));
+                ASSERT(            &da == X.allocator());
 
                 ASSERT(2 == da.numAllocations());
             }
@@ -3978,13 +3985,13 @@ cout << endl
 
                 Obj mX(32, (bslma::Allocator *)0);  const Obj& X = mX;
 
-                ASSERT(          32 == X.capacity());
-                ASSERT(ExpHash()(0) == X.hash_function()(0));
-                ASSERT(ExpHash()(1) == X.hash_function()(1));
-                ASSERT(ExpHash()(7) == X.hash_function()(7));
-                ASSERT(        true == X.key_eq()(0, 0));
-                ASSERT(       false == X.key_eq()(0, 1));
-                ASSERT(         &da == X.allocator());
+                ASSERT(minCapacity(32) == X.capacity());
+                ASSERT(   ExpHash()(0) == X.hash_function()(0));
+                ASSERT(   ExpHash()(1) == X.hash_function()(1));
+                ASSERT(   ExpHash()(7) == X.hash_function()(7));
+                ASSERT(           true == X.key_eq()(0, 0));
+                ASSERT(          false == X.key_eq()(0, 1));
+                ASSERT(            &da == X.allocator());
 
                 ASSERT(2 == da.numAllocations());
             }
@@ -4025,13 +4032,13 @@ cout << endl
 
                 Obj mX(32, hasher);  const Obj& X = mX;
 
-                ASSERT(   32 == X.capacity());
-                ASSERT(    7 == X.hash_function()(0));
-                ASSERT(    7 == X.hash_function()(1));
-                ASSERT(    7 == X.hash_function()(7));
-                ASSERT( true == X.key_eq()(0, 0));
-                ASSERT(false == X.key_eq()(0, 1));
-                ASSERT(  &da == X.allocator());
+                ASSERT(minCapacity(32) == X.capacity());
+                ASSERT(              7 == X.hash_function()(0));
+                ASSERT(              7 == X.hash_function()(1));
+                ASSERT(              7 == X.hash_function()(7));
+                ASSERT(           true == X.key_eq()(0, 0));
+                ASSERT(          false == X.key_eq()(0, 1));
+                ASSERT(            &da == X.allocator());
 
                 ASSERT(2 == da.numAllocations());
             }
@@ -4074,13 +4081,13 @@ cout << endl
 
                 Obj mX(32, hasher, Equal());  const Obj& X = mX;
 
-                ASSERT(   32 == X.capacity());
-                ASSERT(    7 == X.hash_function()(0));
-                ASSERT(    7 == X.hash_function()(1));
-                ASSERT(    7 == X.hash_function()(7));
-                ASSERT( true == X.key_eq()(0, 0));
-                ASSERT(false == X.key_eq()(0, 1));
-                ASSERT(  &da == X.allocator());
+                ASSERT(minCapacity(32) == X.capacity());
+                ASSERT(              7 == X.hash_function()(0));
+                ASSERT(              7 == X.hash_function()(1));
+                ASSERT(              7 == X.hash_function()(7));
+                ASSERT(           true == X.key_eq()(0, 0));
+                ASSERT(          false == X.key_eq()(0, 1));
+                ASSERT(            &da == X.allocator());
 
                 ASSERT(2 == da.numAllocations());
             }
@@ -4240,16 +4247,16 @@ cout << endl
 
             mX.clear();
 
-            ASSERT( 0 == X.size());
-            ASSERT(32 == X.capacity());
+            ASSERT(              0 == X.size());
+            ASSERT(minCapacity(32) == X.capacity());
 
             mX.insert(1);
             mX.insert(2);
 
             mX.clear();
 
-            ASSERT( 0 == X.size());
-            ASSERT(32 == X.capacity());
+            ASSERT(              0 == X.size());
+            ASSERT(minCapacity(32) == X.capacity());
         }
 
         if (verbose) cout << "Testing 'reset'." << endl;
@@ -85,6 +85,20 @@ BSLS_IDENT("$Id: $")
 // If support for 'operator==' is required, the type 'ENTRY' must be
 // equality-comparable.
 //
+///Batched Lookup
+///--------------
+// A lookup in a table that does not fit in cache typically stalls twice on
+// main memory: once loading the group of control values at the start of the
+// probe sequence, and once loading the matching entry.  Since the address of
+// the control values depends only on the hash value of the key, 'findMany'
+// overlaps these stalls across a batch of keys ("group prefetching"): it
+// hashes every key of the batch and prefetches its group of control values,
+// then matches each group against its hashlet and prefetches the first
+// candidate entry, and only then compares keys.  Lookups of many independent
+// keys (e.g., joins) in a table that does not fit in cache should prefer
+// 'findMany' to repeated calls to 'find'; for a cache-resident table the
+// additional passes make 'findMany' somewhat slower than 'find'.
+//
 ///Iterator, Pointer, and Reference Invalidation
 ///---------------------------------------------
 // Any change in capacity of a 'bdlc::FlatHashTable' invalidates all pointers,
@@ -302,6 +316,10 @@ class FlatHashTable
                                              IteratorImp> const_iterator;
 
   private:
+    // PRIVATE CONSTANTS
+    enum { k_FIND_BATCH_SIZE = 16 };  // number of lookups overlapped by
+                                      // 'findKeys'
+
     // DATA
     ENTRY            *d_entries_p;          // entries of this table
     bsl::uint8_t     *d_controls_p;         // control values of this table
@@ -357,6 +375,20 @@ class FlatHashTable
         // 'd_capacity' if the 'key' is not present.  The behavior is undefined
         // unless 'hashValue == d_hasher(key)'.
 
+    void findKeys(bsl::size_t *indices,
+                  const KEY   *keys,
+                  bsl::size_t  numKeys) const;
+        // Load into each of the specified 'numKeys' elements of the specified
+        // 'indices' array the index of the entry within 'd_entries_p'
+        // containing the corresponding element of the specified 'keys' array,
+        // or 'd_capacity' if that key is not present.  The memory accesses of
+        // the lookups are overlapped: every key is hashed and the first group
+        // of control values of its probe sequence prefetched, then the first
+        // candidate entry of each key is prefetched, and only then are the
+        // lookups resolved.  The behavior is undefined unless
+        // '0 < d_capacity', 'numKeys <= k_FIND_BATCH_SIZE', and 'indices' and
+        // 'keys' each have at least 'numKeys' elements.
+
     bsl::size_t minimumCompliantCapacity(bsl::size_t minimumCapacity) const;
         // Return the minimum capacity that satisfies all class invariants, and
         // is at least the specified 'minimumCapacity'.
@@ -504,6 +536,18 @@ class FlatHashTable
         // flat hash table with a key equal to the specified 'key', if such an
         // entry exists, and 'end()' otherwise.
 
+    void findMany(iterator *results, const KEY *keys, bsl::size_t numKeys);
+        // Load into each of the specified 'numKeys' elements of the specified
+        // 'results' array an iterator providing modifiable access to the
+        // object in this flat hash table with a key equal to the
+        // corresponding element of the specified 'keys' array, if such an
+        // entry exists, and 'end()' otherwise.  The behavior is undefined
+        // unless 'results' and 'keys' each have at least 'numKeys' elements.
+        // Note that the result is the same as invoking 'find' for each key,
+        // but the memory accesses of several lookups are overlapped, which is
+        // typically faster for tables that do not fit in cache (see
+        // {Batched Lookup}).
+
 #if defined(BSLS_PLATFORM_CMP_SUN) && BSLS_PLATFORM_CMP_VERSION < 0x5130
     template <class ENTRY_TYPE>
     bsl::pair<iterator, bool> insert(
@@ -658,6 +702,19 @@ class FlatHashTable
         // flat hash table having the specified 'key', or 'end()' if no such
         // entry exists in this table.
 
+    void findMany(const_iterator *results,
+                  const KEY      *keys,
+                  bsl::size_t     numKeys) const;
+        // Load into each of the specified 'numKeys' elements of the specified
+        // 'results' array an iterator representing the position of the entry
+        // in this flat hash table having a key equal to the corresponding
+        // element of the specified 'keys' array, or 'end()' if no such entry
+        // exists in this table.  The behavior is undefined unless 'results'
+        // and 'keys' each have at least 'numKeys' elements.  Note that the
+        // result is the same as invoking 'find' for each key, but the memory
+        // accesses of several lookups are overlapped, which is typically
+        // faster for tables that do not fit in cache (see {Batched Lookup}).
+
     HASH hash_function() const;
         // Return (a copy of) the unary hash functor used by this flat hash
         // table to generate a hash value (of type 'bsl::size_t) for a 'KEY'
@@ -1023,6 +1080,18 @@ bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::findKey(
 
         GroupControl  groupControl(controlStart);
         bsl::uint32_t candidates = groupControl.match(hashlet);
+        const bool    lastGroup  = groupControl.neverFull();
+
+        if (!lastGroup) {
+            // The probe sequence may continue into the next group; start
+            // loading its control values while the candidates of this group
+            // are compared.
+
+            bsls::PerformanceHint::prefetchForReading(
+                  d_controls_p
+                + ((index + GroupControl::k_SIZE) & (d_capacity - 1)));
+        }
+
         while (candidates) {
             int offset = bdlb::BitUtil::numTrailingUnsetBits(candidates);
 
@@ -1034,7 +1103,7 @@ bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::findKey(
             }
             candidates = bdlb::BitUtil::withBitCleared(candidates, offset);
         }
-        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(groupControl.neverFull())) {
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(lastGroup)) {
             break;
         }
 
@@ -1043,6 +1112,46 @@ bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::findKey(
     return d_capacity;
 }
 
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::findKeys(
+                                                  bsl::size_t *indices,
+                                                  const KEY   *keys,
+                                                  bsl::size_t  numKeys) const
+{
+    BSLS_ASSERT_SAFE(0 < d_capacity);
+    BSLS_ASSERT_SAFE(numKeys <= k_FIND_BATCH_SIZE);
+
+    bsl::size_t hashValues[k_FIND_BATCH_SIZE];
+
+    for (bsl::size_t i = 0; i < numKeys; ++i) {
+        hashValues[i] = d_hasher(keys[i]);
+
+        bsl::size_t index = (hashValues[i] >> d_groupControlShift)
+                                                        * GroupControl::k_SIZE;
+
+        bsls::PerformanceHint::prefetchForReading(d_controls_p + index);
+    }
+
+    for (bsl::size_t i = 0; i < numKeys; ++i) {
+        bsl::size_t  index   = (hashValues[i] >> d_groupControlShift)
+                                                        * GroupControl::k_SIZE;
+        bsl::uint8_t hashlet = static_cast<bsl::uint8_t>(
+                                               hashValues[i] & k_HASHLET_MASK);
+
+        GroupControl  groupControl(d_controls_p + index);
+        bsl::uint32_t candidates = groupControl.match(hashlet);
+        if (candidates) {
+            index += bdlb::BitUtil::numTrailingUnsetBits(candidates);
+
+            bsls::PerformanceHint::prefetchForReading(d_entries_p + index);
+        }
+    }
+
+    for (bsl::size_t i = 0; i < numKeys; ++i) {
+        indices[i] = findKey(keys[i], hashValues[i]);
+    }
+}
+
 template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
 bsl::size_t FlatHashTable<KEY,
                           ENTRY,
@@ -1508,6 +1617,45 @@ FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::find(const KEY& key)
     return end();
 }
 
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::findMany(
+                                                     iterator    *results,
+                                                     const KEY   *keys,
+                                                     bsl::size_t  numKeys)
+{
+    if (0 == d_capacity) {
+        for (bsl::size_t i = 0; i < numKeys; ++i) {
+            results[i] = end();
+        }
+        return;                                                       // RETURN
+    }
+
+    bsl::size_t indices[k_FIND_BATCH_SIZE];
+
+    while (numKeys) {
+        const bsl::size_t numBatch =
+                                 numKeys < k_FIND_BATCH_SIZE
+                                 ? numKeys
+                                 : static_cast<bsl::size_t>(k_FIND_BATCH_SIZE);
+
+        findKeys(indices, keys, numBatch);
+
+        for (bsl::size_t i = 0; i < numBatch; ++i) {
+            const bsl::size_t index = indices[i];
+
+            results[i] = index < d_capacity
+                       ? iterator(IteratorImp(d_entries_p  + index,
+                                              d_controls_p + index,
+                                              d_capacity   - index - 1))
+                       : end();
+        }
+
+        results += numBatch;
+        keys    += numBatch;
+        numKeys -= numBatch;
+    }
+}
+
 template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
 template <class INPUT_ITERATOR>
 inline
@@ -1706,6 +1854,45 @@ FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::find(const KEY& key) const
     return end();
 }
 
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::findMany(
+                                               const_iterator *results,
+                                               const KEY      *keys,
+                                               bsl::size_t     numKeys) const
+{
+    if (0 == d_capacity) {
+        for (bsl::size_t i = 0; i < numKeys; ++i) {
+            results[i] = end();
+        }
+        return;                                                       // RETURN
+    }
+
+    bsl::size_t indices[k_FIND_BATCH_SIZE];
+
+    while (numKeys) {
+        const bsl::size_t numBatch =
+                                 numKeys < k_FIND_BATCH_SIZE
+                                 ? numKeys
+                                 : static_cast<bsl::size_t>(k_FIND_BATCH_SIZE);
+
+        findKeys(indices, keys, numBatch);
+
+        for (bsl::size_t i = 0; i < numBatch; ++i) {
+            const bsl::size_t index = indices[i];
+
+            results[i] = index < d_capacity
+                       ? const_iterator(IteratorImp(d_entries_p  + index,
+                                                    d_controls_p + index,
+                                                    d_capacity   - index - 1))
+                       : end();
+        }
+
+        results += numBatch;
+        keys    += numBatch;
+        numKeys -= numBatch;
+    }
+}
+
 template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
 inline
 HASH FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::hash_function() const
@@ -108,6 +108,7 @@ using namespace bsl;
 // [17] iterator erase(iterator);
 // [18] iterator erase(const_iterator, const_iterator);
 // [12] iterator find(const KEY&);
+// [21] void findMany(iterator *, const KEY *, size_t);
 // [ 2] bsl::pair<iterator, bool> insert(FORWARD_REF(ENTRY_TYPE) entry)
 // [16] void insert(INPUT_IT, INPUT_IT);
 // [19] void rehash(size_t);
@@ -128,6 +129,7 @@ using namespace bsl;
 // [ 4] const ENTRY *entries() const;
 // [12] bsl::pair<ci, ci> equal_range(const KEY&) const;
 // [12] const_iterator find(const KEY&) const;
+// [21] void findMany(const_iterator *, const KEY *, size_t) const;
 // [ 4] HASH hash_function() const;
 // [ 4] EQUAL key_eq() const;
 // [11] float load_factor() const;
@@ -606,6 +608,29 @@ class IsValidGuard
 //
 // <ERASED_ELEMENT> ::= 'x'
 //..
+//
+// The specs are written for groups of at most 16 control values.  Each run of
+// 'k_SPEC_GROUP_SIZE' characters describes the first control values of one
+// group; with wider groups, the remaining control values of each group are
+// empty.
+
+const bsl::size_t k_SPEC_GROUP_SIZE = k_SIZE < 16 ? k_SIZE : 16;
+    // number of characters of a spec describing one group
+
+bsl::size_t controlIndex(bsl::size_t specIndex)
+    // Return the index of the control value described by the character at
+    // the specified 'specIndex' of a spec.
+{
+    return specIndex / k_SPEC_GROUP_SIZE * k_SIZE
+                                             + specIndex % k_SPEC_GROUP_SIZE;
+}
+
+bsl::size_t specCapacity(const char *spec)
+    // Return the capacity of a table configured according to the specified
+    // 'spec'.
+{
+    return bsl::strlen(spec) / k_SPEC_GROUP_SIZE * k_SIZE;
+}
 
 enum { e_SUCCESS_EMPTY = -1, e_SUCCESS_ERASED = -2, e_SUCCESS_VALUE = -3 };
 
@@ -656,7 +681,7 @@ int ggg(OBJ *object, const char *spec, int verboseFlag = 1)
 
     bsl::vector<int> toErase(&oa);
 
-    const bsl::size_t capacity = bsl::strlen(spec);
+    const bsl::size_t capacity = specCapacity(spec);
 
     object->reset();
 
@@ -685,7 +710,7 @@ int ggg(OBJ *object, const char *spec, int verboseFlag = 1)
         int hashlet;
         int rv = getValue(&hashlet, spec[i], verboseFlag);
 
-        if (0 == i % k_SIZE) {
+        if (0 == i % k_SPEC_GROUP_SIZE) {
             // since erasing elements will not affect insertion position,
             // process any erasures to ensure the inserts do not cause a rehash
 
@@ -701,7 +726,7 @@ int ggg(OBJ *object, const char *spec, int verboseFlag = 1)
             // insert an entry to this location and track the key for future
             // erasure
 
-            int key = ((i / k_SIZE) << shift) | nextErase;
+            int key = ((i / k_SPEC_GROUP_SIZE) << shift) | nextErase;
 
             ++nextErase;
             toErase.push_back(key);
@@ -715,7 +740,7 @@ int ggg(OBJ *object, const char *spec, int verboseFlag = 1)
             object->insert(entry.object());
         }
         else if (e_SUCCESS_VALUE == rv) {
-            int key = ((i / k_SIZE) << shift) | hashlet;
+            int key = ((i / k_SPEC_GROUP_SIZE) << shift) | hashlet;
 
             bsls::ObjectBuffer<ENTRY> entry;
 
@@ -737,18 +762,20 @@ int ggg(OBJ *object, const char *spec, int verboseFlag = 1)
     const OBJ& X = *object;
 
     for (int i = 0; spec[i]; ++i) {
+        const bsl::uint8_t control = X.controls()[controlIndex(i)];
+
         if ('e' == spec[i]) {
-            if (k_EMPTY != X.controls()[i]) {
+            if (k_EMPTY != control) {
                 return i;                                             // RETURN
             }
         }
         else if ('x' == spec[i]) {
-            if (k_ERASED != X.controls()[i]) {
+            if (k_ERASED != control) {
                 return i;                                             // RETURN
             }
         }
         else {
-            if (static_cast<int>(spec[i] - 'A') != X.controls()[i]) {
+            if (static_cast<int>(spec[i] - 'A') != control) {
                 return i;                                             // RETURN
             }
         }
@@ -770,6 +797,13 @@ OBJ& gg(OBJ *object, const char *spec)
 //                      GLOBAL FUNCTIONS FOR TESTING
 // ----------------------------------------------------------------------------
 
+bsl::size_t minCapacity(bsl::size_t capacity)
+    // Return the larger of the specified 'capacity' and the minimum non-zero
+    // capacity of a table, '2 * k_SIZE'.
+{
+    return capacity > 2u * k_SIZE ? capacity : 2u * k_SIZE;
+}
+
 void printError(const bsl::uint8_t  *controls,
                 const bsl::size_t    capacity,
                 bsl::size_t          index,
@@ -2652,7 +2686,7 @@ void testCase2EraseAndReInsert(int id)
             }
 
             // store 'controls' for later comparison
-            bsl::uint8_t originalControls[128];
+            bsl::uint8_t originalControls[8 * k_SIZE];
             bsl::memcpy(originalControls, X.controls(), X.capacity());
 
             // erase the 'key'
@@ -2715,6 +2749,102 @@ void testCase2EraseAndReInsert(int id)
     }
 }
 
+template <class HASH>
+void testCase21FindMany(int id)
+    // Address the 'findMany' concerns of test case 21 for the specified 'id'
+    // value.  Note that, in case of a test failure, 'id' can be used to
+    // determine 'HASH'.
+{
+    bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+    bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+    typedef TestEntryUtil<int>                                    EntryUtil;
+    typedef bsl::equal_to<int>                                    Equal;
+    typedef bdlc::FlatHashTable<int, int, EntryUtil, HASH, Equal> Obj;
+
+    const int NUM_VALUES[] = { 0, 1, 15, 16, 17, 33, 100, 500 };
+    const int NUM_NUM_VALUES = sizeof NUM_VALUES / sizeof *NUM_VALUES;
+
+    for (int ti = 0; ti < NUM_NUM_VALUES; ++ti) {
+        const int N = NUM_VALUES[ti];
+
+        Obj mX(0, HASH(), Equal(), &oa);  const Obj& X = mX;
+
+        // Insert the even keys in '[0 .. 2 * N)'.
+
+        for (int i = 0; i < N; ++i) {
+            mX.insert(2 * i);
+        }
+
+        // Look up every key in '[-1 .. 2 * N + 1]', present or not, in
+        // batches of varying length.
+
+        bsl::vector<int> keys(&sa);
+        for (int i = -1; i <= 2 * N + 1; ++i) {
+            keys.push_back(i);
+        }
+
+        const bsl::size_t NUM_KEYS = keys.size();
+
+        bsl::vector<typename Obj::iterator>       results(NUM_KEYS + 1,
+                                                          mX.begin(),
+                                                          &sa);
+        bsl::vector<typename Obj::const_iterator> constResults(NUM_KEYS + 1,
+                                                               X.begin(),
+                                                               &sa);
+
+        const bsl::size_t LENGTHS[] = { 0, 1, 2, 15, 16, 17, 31, 32, 33,
+                                        NUM_KEYS };
+        const bsl::size_t NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        for (bsl::size_t li = 0; li < NUM_LENGTHS; ++li) {
+            const bsl::size_t LENGTH = LENGTHS[li] < NUM_KEYS
+                                     ? LENGTHS[li]
+                                     : NUM_KEYS;
+
+            for (bsl::size_t start = 0;
+                 start + LENGTH <= NUM_KEYS;
+                 start += LENGTH ? LENGTH : NUM_KEYS + 1) {
+                const int *KEYS = keys.data() + start;
+
+                mX.findMany(results.data(), KEYS, LENGTH);
+                X.findMany(constResults.data(), KEYS, LENGTH);
+
+                for (bsl::size_t i = 0; i < LENGTH; ++i) {
+                    LOOP4_ASSERT(id, N, LENGTH, KEYS[i],
+                                 mX.find(KEYS[i]) == results[i]);
+                    LOOP4_ASSERT(id, N, LENGTH, KEYS[i],
+                                 X.find(KEYS[i]) == constResults[i]);
+                }
+
+                // Verify elements past 'LENGTH' are not modified.
+
+                LOOP3_ASSERT(id, N, LENGTH, mX.begin() == results[LENGTH]);
+                LOOP3_ASSERT(id, N, LENGTH,
+                             X.begin() == constResults[LENGTH]);
+
+                for (bsl::size_t i = 0; i < LENGTH; ++i) {
+                    results[i]      = mX.begin();
+                    constResults[i] = X.begin();
+                }
+            }
+        }
+
+        // Verify the returned iterators provide modifiable access.
+
+        if (N) {
+            int key = 0;
+
+            typename Obj::iterator result;
+
+            mX.findMany(&result, &key, 1);
+
+            LOOP2_ASSERT(id, N, X.end() != result);
+            LOOP2_ASSERT(id, N,       0 == *result);
+        }
+    }
+}
+
 // ============================================================================
 //                                USAGE EXAMPLE
 // ----------------------------------------------------------------------------
@@ -2747,6 +2877,53 @@ int main(int argc, char *argv[])
     bslma::Default::setDefaultAllocatorRaw(&defaultAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 21: {
+        // --------------------------------------------------------------------
+        // 'findMany'
+        //   Ensure 'findMany' produces the same results as 'find'.
+        //
+        // Concerns:
+        //: 1 'findMany' loads, for each key, an iterator equal to the one
+        //:   returned by 'find', for keys present in and absent from the
+        //:   table.
+        //:
+        //: 2 'findMany' works for any number of keys, including zero, fewer
+        //:   than, equal to, and more than the internal batch size.
+        //:
+        //: 3 'findMany' works for empty tables, including those in the
+        //:   zero-capacity state, and for long probe sequences.
+        //:
+        //: 4 'findMany' does not modify elements of the result array past the
+        //:   specified number of keys.
+        //:
+        //: 5 The non-'const' 'findMany' provides modifiable iterators.
+        //
+        // Plan:
+        //: 1 For tables of varying size, and using hash functors producing
+        //:   distinct, identity, and constant hash values, invoke both
+        //:   overloads of 'findMany' on every contiguous batch, of varying
+        //:   length, of a sequence of keys present in and absent from the
+        //:   table, and compare the results with 'find'.  (C-1..3)
+        //:
+        //: 2 Verify the result array element following each batch retains
+        //:   its initial value.  (C-4)
+        //:
+        //: 3 Verify the non-'const' 'findMany' loads into an array of
+        //:   'iterator' an iterator referring to the expected entry.  (C-5)
+        //
+        // Testing:
+        //   void findMany(iterator *, const KEY *, size_t);
+        //   void findMany(const_iterator *, const KEY *, size_t) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'findMany'" << endl
+                          << "==========" << endl;
+
+        testCase21FindMany<bsl::hash<int> >(0);
+        testCase21FindMany<IntValueIsHash>(1);
+        testCase21FindMany<IntZeroHash>(2);
+      } break;
       case 20: {
         // --------------------------------------------------------------------
         // 'operator[]'
@@ -2978,7 +3155,7 @@ int main(int argc, char *argv[])
 
             mX.reserve(16);
 
-            ASSERT(32 == X.capacity());
+            ASSERT(minCapacity(32) == X.capacity());
 
             mX.insert(0);
 
@@ -4691,9 +4868,9 @@ int main(int argc, char *argv[])
                 {
                     Obj mX(32, Hash(), Equal());  const Obj& X = mX;
 
-                    ASSERT(   32 == X.capacity());
-                    ASSERT(0.875 == X.max_load_factor());
-                    ASSERT(  &da == X.allocator());
+                    ASSERT(minCapacity(32) == X.capacity());
+                    ASSERT(          0.875 == X.max_load_factor());
+                    ASSERT(            &da == X.allocator());
                 }
                 ASSERT(2 == da.numAllocations());
                 ASSERT(0 == da.numBytesInUse());
@@ -4715,9 +4892,9 @@ int main(int argc, char *argv[])
                 {
                     Obj mX(32, Hash(), Equal(), &oa);  const Obj& X = mX;
 
-                    ASSERT(   32 == X.capacity());
-                    ASSERT(0.875 == X.max_load_factor());
-                    ASSERT(  &oa == X.allocator());
+                    ASSERT(minCapacity(32) == X.capacity());
+                    ASSERT(          0.875 == X.max_load_factor());
+                    ASSERT(            &oa == X.allocator());
                 }
                 ASSERT(4 == da.numAllocations());
                 ASSERT(0 == da.numBytesInUse());
@@ -4786,6 +4963,31 @@ int main(int argc, char *argv[])
                     ASSERT(       3 == X.size());
                     ASSERT(k_ERASED == X.controls()[ 1]);
                 }
+                else if (32 == k_SIZE) {
+                    mX.insert(0x0021);
+                    ASSERT(     1 == X.size());
+                    ASSERT(  0x21 == X.controls()[ 0]);
+                    ASSERT(0x0021 == X.entries()[ 0]);
+
+                    mX.insert(0x4022);
+                    ASSERT(     2 == X.size());
+                    ASSERT(  0x22 == X.controls()[ 1]);
+                    ASSERT(0x4022 == X.entries()[ 1]);
+
+                    mX.insert(0x8023);
+                    ASSERT(     3 == X.size());
+                    ASSERT(  0x23 == X.controls()[32]);
+                    ASSERT(0x8023 == X.entries()[32]);
+
+                    mX.insert(0xC024);
+                    ASSERT(     4 == X.size());
+                    ASSERT(  0x24 == X.controls()[33]);
+                    ASSERT(0xC024 == X.entries()[33]);
+
+                    mX.erase(0x4022);
+                    ASSERT(       3 == X.size());
+                    ASSERT(k_ERASED == X.controls()[ 1]);
+                }
                 else {
                     mX.insert(0x0021);
                     ASSERT(     1 == X.size());
@@ -4867,17 +5069,21 @@ int main(int argc, char *argv[])
                     Obj        mX(0, Hash(), Equal(), &oa);
                     const Obj& X = gg(&mX, SPEC);
 
+                    LOOP_ASSERT(LINE, specCapacity(SPEC) == X.capacity());
+
                     for (bsl::size_t i = 0; SPEC[i]; ++i) {
+                        const bsl::uint8_t CONTROL =
+                                                X.controls()[controlIndex(i)];
+
                         if ('e' == SPEC[i]) {
-                            LOOP_ASSERT(LINE, k_EMPTY == X.controls()[i]);
+                            LOOP_ASSERT(LINE, k_EMPTY == CONTROL);
                         }
                         else if ('x' == SPEC[i]) {
-                            LOOP_ASSERT(LINE, k_ERASED == X.controls()[i]);
+                            LOOP_ASSERT(LINE, k_ERASED == CONTROL);
                         }
                         else {
                             LOOP_ASSERT(LINE,
-                                    static_cast<int>(SPEC[i] - 'A') ==
-                                                              X.controls()[i]);
+                                 static_cast<int>(SPEC[i] - 'A') == CONTROL);
                         }
                     }
 
@@ -5203,8 +5409,8 @@ int main(int argc, char *argv[])
 
                 {
                     Obj mX(31, Hash(), Equal());  const Obj& X = mX;
-                    ASSERT( 32 == X.capacity());
-                    ASSERT(&da == X.allocator());
+                    ASSERT(minCapacity(32) == X.capacity());
+                    ASSERT(            &da == X.allocator());
                 }
                 ASSERT(2 == da.numAllocations());
                 ASSERT(0 == da.numBytesInUse());
@@ -5213,8 +5419,8 @@ int main(int argc, char *argv[])
 
                 {
                     Obj mX(32, Hash(), Equal(), 0);  const Obj& X = mX;
-                    ASSERT( 32 == X.capacity());
-                    ASSERT(&da == X.allocator());
+                    ASSERT(minCapacity(32) == X.capacity());
+                    ASSERT(            &da == X.allocator());
                 }
                 ASSERT(4 == da.numAllocations());
                 ASSERT(0 == da.numBytesInUse());
@@ -5244,11 +5450,11 @@ int main(int argc, char *argv[])
 
             Obj mX(32, Hash(), Equal(), &oa);  const Obj& X = mX;
 
-            ASSERT(     32 == X.capacity());
-            ASSERT(k_EMPTY == X.controls()[ 0]);
-            ASSERT(k_EMPTY == X.controls()[ 8]);
-            ASSERT(k_EMPTY == X.controls()[16]);
-            ASSERT(k_EMPTY == X.controls()[24]);
+            ASSERT(minCapacity(32) == X.capacity());
+            ASSERT(        k_EMPTY == X.controls()[ 0]);
+            ASSERT(        k_EMPTY == X.controls()[ 8]);
+            ASSERT(        k_EMPTY == X.controls()[16]);
+            ASSERT(        k_EMPTY == X.controls()[24]);
 
             if (16 == k_SIZE) {
                 mX.insert(0x0021);
@@ -5263,6 +5469,19 @@ int main(int argc, char *argv[])
                 mX.insert(0xC024);
                 ASSERT(0x24 == X.controls()[17]);
             }
+            else if (32 == k_SIZE) {
+                mX.insert(0x0021);
+                ASSERT(0x21 == X.controls()[ 0]);
+
+                mX.insert(0x4022);
+                ASSERT(0x22 == X.controls()[ 1]);
+
+                mX.insert(0x8023);
+                ASSERT(0x23 == X.controls()[32]);
+
+                mX.insert(0xC024);
+                ASSERT(0x24 == X.controls()[33]);
+            }
             else {
                 mX.insert(0x0021);
                 ASSERT(0x21 == X.controls()[ 0]);
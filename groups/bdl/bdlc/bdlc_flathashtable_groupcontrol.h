@@ -15,6 +15,30 @@ BSLS_IDENT("$Id: $")
 // of flat hash table control values.  Note that the number of entries in a
 // group control and the inquiry performance is platform dependant.
 //
+///Group Width
+///-----------
+// The number of control values in a group, 'k_SIZE', is selected at compile
+// time from the instruction sets available to the build:
+//
+//: o 16 on x86 platforms providing SSE2, using '_mm_movemask_epi8'.
+//:
+//: o 16 on 64-bit ARM platforms providing NEON (e.g., aarch64).
+//:
+//: o 8 on all other platforms, using portable 64-bit arithmetic.
+//
+// Additionally, on x86 builds targeting AVX2 (i.e., when
+// 'BSLS_PLATFORM_CPU_AVX2' is defined), 32-entry groups are used if the macro
+// 'BDLC_FLATHASHTABLE_GROUPCONTROL_ENABLE_AVX2' is defined.  Wider groups let
+// a single probe inspect twice as many slots, which reduces the length of
+// probe sequences in tables operating near their maximum load factor, at the
+// cost of a larger minimum capacity.  Since 'k_SIZE' determines the layout of
+// every 'bdlc::FlatHashTable', this macro must be defined consistently for
+// every translation unit in a program.  When building with CMake, configuring
+// with '-DBDLC_FLATHASHTABLE_GROUPCONTROL_ENABLE_AVX2=ON' defines the macro,
+// and enables AVX2 code generation, for 'bdlc', its clients, and the test
+// drivers of 'bdlc', so that the flat hash containers can be tested in this
+// mode.
+//
 // The flat hash map/set/table data structures are inspired by Google's
 // flat_hash_map CppCon presentations (available on youtube).  The
 // implementations draw from Google's open source 'raw_hash_set.h' file at:
@@ -35,9 +59,23 @@ BSLS_IDENT("$Id: $")
 #include <bsl_cstdint.h>
 #include <bsl_cstring.h>
 
-#if defined(BSLS_PLATFORM_CPU_SSE2)
+#if defined(BSLS_PLATFORM_CPU_AVX2)                                          \
+ && defined(BDLC_FLATHASHTABLE_GROUPCONTROL_ENABLE_AVX2)
+#define BDLC_FLATHASHTABLE_GROUPCONTROL_AVX2 1
+#elif defined(BSLS_PLATFORM_CPU_SSE2)
+#define BDLC_FLATHASHTABLE_GROUPCONTROL_SSE2 1
+#elif defined(BSLS_PLATFORM_CPU_ARM)                                          \
+   && defined(BSLS_PLATFORM_CPU_64_BIT)                                       \
+   && defined(__ARM_NEON)
+#define BDLC_FLATHASHTABLE_GROUPCONTROL_NEON 1
+#endif
+
+#if defined(BDLC_FLATHASHTABLE_GROUPCONTROL_AVX2)                             \
+ || defined(BDLC_FLATHASHTABLE_GROUPCONTROL_SSE2)
 #include <immintrin.h>
 #include <emmintrin.h>
+#elif defined(BDLC_FLATHASHTABLE_GROUPCONTROL_NEON)
+#include <arm_neon.h>
 #endif
 
 namespace BloombergLP {
@@ -53,8 +91,12 @@ class FlatHashTable_GroupControl
 {
   public:
     // TYPES
-#if defined(BSLS_PLATFORM_CPU_SSE2)
+#if defined(BDLC_FLATHASHTABLE_GROUPCONTROL_AVX2)
+    typedef __m256i       Storage;
+#elif defined(BDLC_FLATHASHTABLE_GROUPCONTROL_SSE2)
     typedef __m128i       Storage;
+#elif defined(BDLC_FLATHASHTABLE_GROUPCONTROL_NEON)
+    typedef uint8x16_t    Storage;
 #else
     typedef bsl::uint64_t Storage;
 #endif
@@ -69,6 +111,15 @@ class FlatHashTable_GroupControl
     // DATA
     Storage d_value;  // efficiently cached value for inquiries
 
+#if defined(BDLC_FLATHASHTABLE_GROUPCONTROL_NEON)
+    // PRIVATE CLASS METHODS
+    static bsl::uint32_t toBitMask(uint8x16_t lanes);
+        // Return a bit mask having the bit at index 'i' set if and only if
+        // the byte at index 'i' of the specified 'lanes' is non-zero.  The
+        // behavior is undefined unless each byte of 'lanes' is either 0x00 or
+        // 0xFF.
+#endif
+
     // PRIVATE ACCESSORS
     bsl::uint32_t matchRaw(bsl::uint8_t value) const;
         // Return a bit mask of the 'k_SIZE' entries that have the specified
@@ -123,14 +174,37 @@ class FlatHashTable_GroupControl
                      // class FlatHashTable_GroupControl
                      // --------------------------------
 
+#if defined(BDLC_FLATHASHTABLE_GROUPCONTROL_NEON)
+// PRIVATE CLASS METHODS
+inline
+bsl::uint32_t FlatHashTable_GroupControl::toBitMask(uint8x16_t lanes)
+{
+    // NEON lacks an equivalent of '_mm_movemask_epi8'.  Keep one distinct bit
+    // of each byte and sum each half of the vector horizontally; the sums
+    // cannot carry since the bits are distinct.
+
+    const uint8x8_t  weights = vcreate_u8(0x8040201008040201ull);
+    const uint8x16_t bits    = vandq_u8(lanes, vcombine_u8(weights, weights));
+
+    return static_cast<bsl::uint32_t>(vaddv_u8(vget_low_u8(bits)))
+         | static_cast<bsl::uint32_t>(vaddv_u8(vget_high_u8(bits))) << 8;
+}
+#endif
+
 // PRIVATE ACCESSORS
 inline
 bsl::uint32_t FlatHashTable_GroupControl::matchRaw(bsl::uint8_t value) const
 {
-#if defined(BSLS_PLATFORM_CPU_SSE2)
+#if defined(BDLC_FLATHASHTABLE_GROUPCONTROL_AVX2)
+    return static_cast<bsl::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(
+                                    _mm256_set1_epi8(static_cast<char>(value)),
+                                    d_value)));
+#elif defined(BDLC_FLATHASHTABLE_GROUPCONTROL_SSE2)
     return _mm_movemask_epi8(_mm_cmpeq_epi8(
                                        _mm_set1_epi8(static_cast<char>(value)),
                                        d_value));
+#elif defined(BDLC_FLATHASHTABLE_GROUPCONTROL_NEON)
+    return toBitMask(vceqq_u8(vdupq_n_u8(value), d_value));
 #else
     Storage t = d_value ^ (k_MULT * value);
 
@@ -148,9 +222,14 @@ inline
 FlatHashTable_GroupControl::FlatHashTable_GroupControl(
                                                       const bsl::uint8_t *data)
 {
-#if defined(BSLS_PLATFORM_CPU_SSE2)
+#if defined(BDLC_FLATHASHTABLE_GROUPCONTROL_AVX2)
+    d_value = _mm256_loadu_si256(static_cast<const Storage *>(
+                                             static_cast<const void *>(data)));
+#elif defined(BDLC_FLATHASHTABLE_GROUPCONTROL_SSE2)
     d_value = _mm_loadu_si128(static_cast<const Storage *>(
                                              static_cast<const void *>(data)));
+#elif defined(BDLC_FLATHASHTABLE_GROUPCONTROL_NEON)
+    d_value = vld1q_u8(data);
 #else
     bsl::memcpy(&d_value, data, k_SIZE);
     d_value = BSLS_BYTEORDER_HOST_U64_TO_LE(d_value);
@@ -161,8 +240,12 @@ FlatHashTable_GroupControl::FlatHashTable_GroupControl(
 inline
 bsl::uint32_t FlatHashTable_GroupControl::available() const
 {
-#if defined(BSLS_PLATFORM_CPU_SSE2)
+#if defined(BDLC_FLATHASHTABLE_GROUPCONTROL_AVX2)
+    return static_cast<bsl::uint32_t>(_mm256_movemask_epi8(d_value));
+#elif defined(BDLC_FLATHASHTABLE_GROUPCONTROL_SSE2)
     return _mm_movemask_epi8(d_value);
+#elif defined(BDLC_FLATHASHTABLE_GROUPCONTROL_NEON)
+    return toBitMask(vtstq_u8(d_value, vdupq_n_u8(0x80)));
 #else
     return static_cast<bsl::uint32_t>(
                       ((d_value & k_MSB_MASK) * k_DEFLATE) >> k_DEFLATE_SHIFT);
@@ -172,7 +255,10 @@ bsl::uint32_t FlatHashTable_GroupControl::available() const
 inline
 bsl::uint32_t FlatHashTable_GroupControl::inUse() const
 {
-#if defined(BSLS_PLATFORM_CPU_SSE2)
+#if defined(BDLC_FLATHASHTABLE_GROUPCONTROL_AVX2)
+    return ~available();
+#elif defined(BDLC_FLATHASHTABLE_GROUPCONTROL_SSE2)                           \
+   || defined(BDLC_FLATHASHTABLE_GROUPCONTROL_NEON)
     return (~available()) & 0xFFFF;
 #else
     return (~available()) & 0xFF;
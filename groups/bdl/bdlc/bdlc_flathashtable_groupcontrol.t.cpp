@@ -109,6 +109,10 @@ void aSsErT(bool condition, const char *message, int line)
 
 typedef bdlc::FlatHashTable_GroupControl Obj;
 
+const bsl::size_t k_MAX_SIZE = 32;  // largest supported 'Obj::k_SIZE'
+
+BSLMF_ASSERT(Obj::k_SIZE <= k_MAX_SIZE);
+
 const bsl::uint8_t EE = Obj::k_EMPTY;
 const bsl::uint8_t XX = Obj::k_ERASED;
 const bsl::uint8_t VA = 0x00;
@@ -271,10 +275,12 @@ int main(int argc, char *argv[])
         if (verbose) cout << "\nTesting accessors." << endl;
 
         {
-            bsl::uint8_t BACKGROUND[][16] =
+            bsl::uint8_t BACKGROUND[][k_MAX_SIZE] =
                        {
-                           { EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE },
-                           { XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX },
+                           { EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,
+                             EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE },
+                           { XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,
+                             XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX },
                        };
             const bsl::size_t NUM_BACKGROUND
                                       = sizeof BACKGROUND / sizeof *BACKGROUND;
@@ -289,8 +295,8 @@ int main(int argc, char *argv[])
             }
             { // depth 1
                 for (bsl::size_t bi = 0; bi < NUM_BACKGROUND; ++bi) {
-                    bsl::uint8_t data[16];
-                    bsl::memcpy(data, BACKGROUND[bi], 16);
+                    bsl::uint8_t data[k_MAX_SIZE];
+                    bsl::memcpy(data, BACKGROUND[bi], k_MAX_SIZE);
 
                     for (bsl::size_t i = 0; i < Obj::k_SIZE; ++i) {
                         for (bsl::size_t ii = 0; ii < NUM_VALUE; ++ii) {
@@ -303,8 +309,8 @@ int main(int argc, char *argv[])
             }
             { // depth 2
                 for (bsl::size_t bi = 0; bi < NUM_BACKGROUND; ++bi) {
-                    bsl::uint8_t data[16];
-                    bsl::memcpy(data, BACKGROUND[bi], 16);
+                    bsl::uint8_t data[k_MAX_SIZE];
+                    bsl::memcpy(data, BACKGROUND[bi], k_MAX_SIZE);
             //------^
             for (bsl::size_t i = 0; i < Obj::k_SIZE; ++i) {
                 for (bsl::size_t ii = 0; ii < NUM_VALUE; ++ii) {
@@ -324,8 +330,8 @@ int main(int argc, char *argv[])
             }
             { // depth 3
                 for (bsl::size_t bi = 0; bi < NUM_BACKGROUND; ++bi) {
-                    bsl::uint8_t data[16];
-                    bsl::memcpy(data, BACKGROUND[bi], 16);
+                    bsl::uint8_t data[k_MAX_SIZE];
+                    bsl::memcpy(data, BACKGROUND[bi], k_MAX_SIZE);
         //----------^
         for (bsl::size_t i = 0; i < Obj::k_SIZE; ++i) {
             for (bsl::size_t ii = 0; ii < NUM_VALUE; ++ii) {
@@ -351,8 +357,8 @@ int main(int argc, char *argv[])
             }
             { // depth 4
                 for (bsl::size_t bi = 0; bi < NUM_BACKGROUND; ++bi) {
-                    bsl::uint8_t data[16];
-                    bsl::memcpy(data, BACKGROUND[bi], 16);
+                    bsl::uint8_t data[k_MAX_SIZE];
+                    bsl::memcpy(data, BACKGROUND[bi], k_MAX_SIZE);
 //------------------^
 for (bsl::size_t i = 0; i < Obj::k_SIZE; ++i) {
     for (bsl::size_t ii = 0; ii < NUM_VALUE; ++ii) {
@@ -388,8 +394,9 @@ for (bsl::size_t i = 0; i < Obj::k_SIZE; ++i) {
         {
             bsls::AssertTestHandlerGuard hG;
 
-            bsl::uint8_t data[16] =
-                           { XX,VA,XX,VB,VA,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE };
+            bsl::uint8_t data[k_MAX_SIZE] =
+                           { XX,VA,XX,VB,VA,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,
+                             EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE };
 
             Obj mX(data);  const Obj& X = mX;
 
@@ -426,8 +433,9 @@ for (bsl::size_t i = 0; i < Obj::k_SIZE; ++i) {
                           << "========" << endl;
 
         {
-            bsl::uint8_t data[16] =
-                           { XX,VA,XX,VB,VA,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE };
+            bsl::uint8_t data[k_MAX_SIZE] =
+                           { XX,VA,XX,VB,VA,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,
+                             EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE };
 
             Obj mX(data);  const Obj& X = mX;
 
@@ -440,8 +448,9 @@ for (bsl::size_t i = 0; i < Obj::k_SIZE; ++i) {
             ASSERT(true == X.neverFull());
         }
         {
-            bsl::uint8_t data[16] =
-                           { VA,VB,VC,VD,VE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE };
+            bsl::uint8_t data[k_MAX_SIZE] =
+                           { VA,VB,VC,VD,VE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,
+                             EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE };
 
             Obj mX(data);  const Obj& X = mX;
 
@@ -454,8 +463,9 @@ for (bsl::size_t i = 0; i < Obj::k_SIZE; ++i) {
             ASSERT(true == X.neverFull());
         }
         {
-            bsl::uint8_t data[16] =
-                           { XX,VA,XX,VB,VA,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX };
+            bsl::uint8_t data[k_MAX_SIZE] =
+                           { XX,VA,XX,VB,VA,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,
+                             XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX };
 
             Obj mX(data);  const Obj& X = mX;
 
@@ -488,8 +498,9 @@ for (bsl::size_t i = 0; i < Obj::k_SIZE; ++i) {
                           << "BREATHING TEST" << endl
                           << "==============" << endl;
 
-        bsl::uint8_t data[16] =
-                           { XX,VA,XX,VB,VA,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE };
+        bsl::uint8_t data[k_MAX_SIZE] =
+                           { XX,VA,XX,VB,VA,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,
+                             EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE };
 
         Obj mX(data);  const Obj& X = mX;
 
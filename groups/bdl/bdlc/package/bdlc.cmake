@@ -0,0 +1,32 @@
+include(bde_interface_target)
+include(bde_package)
+include(bde_struct)
+
+option(BDLC_FLATHASHTABLE_GROUPCONTROL_ENABLE_AVX2
+       "Build 'bdlc' and its clients with 32-entry flat hash table groups"
+       OFF)
+
+bde_prefixed_override(bdlc process_package)
+function(bdlc_process_package retPackage)
+    process_package_base("" package ${ARGN})
+
+    if(BDLC_FLATHASHTABLE_GROUPCONTROL_ENABLE_AVX2)
+        # The group width determines the layout of every flat hash table, so
+        # the macro is propagated to every target that uses 'bdlc', including
+        # the test drivers of the package.
+        bde_struct_get_field(interfaceTarget ${package} INTERFACE_TARGET)
+        bde_interface_target_compile_definitions(
+            ${interfaceTarget}
+            PUBLIC
+                BDLC_FLATHASHTABLE_GROUPCONTROL_ENABLE_AVX2
+        )
+        bde_interface_target_compile_options(
+            ${interfaceTarget}
+            PUBLIC
+                $<$<CXX_COMPILER_ID:GNU,Clang,AppleClang>:-mavx2>
+                $<$<CXX_COMPILER_ID:MSVC>:/arch:AVX2>
+        )
+    endif()
+
+    bde_return(${package})
+endfunction()
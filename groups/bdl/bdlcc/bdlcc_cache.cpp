@@ -2,6 +2,210 @@
 
 #include <bdlcc_cache.h>
 
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlcc_cache_cpp,"$Id$ $CSID$")
+
+#include <bdlb_bitutil.h>
+
+#include <bslma_default.h>
+
+///Implementation Note
+///===================
+// 'Cache_FrequencySketch' follows the layout used by the TinyLFU literature: a
+// table of 64-bit words, each holding 16 4-bit counters divided into 4 groups
+// of 4, one group per hash function ("row").  A key is mapped to one word per
+// row, and to one counter in that row's group of the word, so a single key
+// never uses the same counter twice.  The estimated frequency of a key is the
+// minimum of its 4 counters.
+//
+// Counters are updated with compare-and-swap so that concurrent calls to
+// 'record' (made by readers of 'Cache' holding only a read lock) never lose
+// the increments of a word.  Aging halves every counter in place, word by
+// word; a 'record' racing with aging may be applied before or after the
+// halving of its word, which only affects the precision of the estimate.
+
+namespace BloombergLP {
+namespace bdlcc {
+namespace {
+
+const bsl::size_t k_MAX_NUM_WORDS = 1 << 20;  // caps the sketch at 8 MiB
+
+const bsls::Types::Uint64 k_SEEDS[] = {
+    0xc3a5c85c97cb3127ULL,
+    0xb492b66fbe98f273ULL,
+    0x9ae16a3b2f90404fULL,
+    0xcbf29ce484222325ULL
+};
+
+inline
+bsls::Types::Uint64 mix(bsls::Types::Uint64 value)
+    // Return a well-distributed 64-bit hash of the specified 'value' (the
+    // finalizer of MurmurHash3).
+{
+    value ^= value >> 33;
+    value *= 0xff51afd7ed558ccdULL;
+    value ^= value >> 33;
+    value *= 0xc4ceb9fe1a85ec53ULL;
+    value ^= value >> 33;
+    return value;
+}
+
+}  // close unnamed namespace
+
+                        // ---------------------------
+                        // class Cache_FrequencySketch
+                        // ---------------------------
+
+// PRIVATE MANIPULATORS
+void Cache_FrequencySketch::age()
+{
+    for (bsl::size_t i = 0; i <= d_mask; ++i) {
+        Uint64 word = AtomicOp::getUint64Relaxed(&d_table_p[i]);
+        while (true) {
+            const Uint64 halved = (word >> 1) & 0x7777777777777777ULL;
+            const Uint64 prior  = AtomicOp::testAndSwapUint64AcqRel(
+                                                               &d_table_p[i],
+                                                               word,
+                                                               halved);
+            if (prior == word) {
+                break;
+            }
+            word = prior;
+        }
+    }
+}
+
+bool Cache_FrequencySketch::incrementAt(bsl::size_t index, int counter)
+{
+    const int shift = counter * 4;
+
+    Uint64 word = AtomicOp::getUint64Relaxed(&d_table_p[index]);
+    while (true) {
+        if (0xf == ((word >> shift) & 0xf)) {
+            return false;                                             // RETURN
+        }
+        const Uint64 incremented = word + (Uint64(1) << shift);
+        const Uint64 prior       = AtomicOp::testAndSwapUint64AcqRel(
+                                                             &d_table_p[index],
+                                                             word,
+                                                             incremented);
+        if (prior == word) {
+            return true;                                              // RETURN
+        }
+        word = prior;
+    }
+}
+
+// PRIVATE ACCESSORS
+int Cache_FrequencySketch::countAt(bsl::size_t index, int counter) const
+{
+    return static_cast<int>(
+               (AtomicOp::getUint64Relaxed(&d_table_p[index]) >> (counter * 4))
+                                                                       & 0xf);
+}
+
+bsl::size_t Cache_FrequencySketch::indexOf(Uint64 hash, int row) const
+{
+    return static_cast<bsl::size_t>(mix(hash + k_SEEDS[row])) & d_mask;
+}
+
+// CREATORS
+Cache_FrequencySketch::Cache_FrequencySketch(
+                                          bsl::size_t       capacity,
+                                          bslma::Allocator *basicAllocator)
+: d_table_p(0)
+, d_mask(0)
+, d_numRecorded(0)
+, d_sampleSize(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    if (0 == capacity) {
+        return;                                                       // RETURN
+    }
+
+    const bsl::size_t numWords =
+                  capacity >= k_MAX_NUM_WORDS
+                  ? k_MAX_NUM_WORDS
+                  : static_cast<bsl::size_t>(
+                        bdlb::BitUtil::roundUpToBinaryPower(
+                            static_cast<bdlb::BitUtil::uint64_t>(capacity)));
+
+    d_table_p = static_cast<AtomicUint64 *>(
+                    d_allocator_p->allocate(numWords * sizeof(AtomicUint64)));
+    d_mask       = numWords - 1;
+    d_sampleSize = 10 * static_cast<bsls::Types::Int64>(numWords);
+
+    for (bsl::size_t i = 0; i < numWords; ++i) {
+        AtomicOp::initUint64(&d_table_p[i], 0);
+    }
+}
+
+Cache_FrequencySketch::~Cache_FrequencySketch()
+{
+    d_allocator_p->deallocate(d_table_p);
+}
+
+// MANIPULATORS
+void Cache_FrequencySketch::clear()
+{
+    if (0 == d_table_p) {
+        return;                                                       // RETURN
+    }
+
+    for (bsl::size_t i = 0; i <= d_mask; ++i) {
+        AtomicOp::setUint64Relaxed(&d_table_p[i], 0);
+    }
+    d_numRecorded.storeRelaxed(0);
+}
+
+void Cache_FrequencySketch::record(bsl::size_t hash)
+{
+    if (0 == d_table_p) {
+        return;                                                       // RETURN
+    }
+
+    const Uint64 spread = mix(hash);
+
+    bool incremented = false;
+    for (int row = 0; row < 4; ++row) {
+        const int counter = row * 4 + static_cast<int>((spread >> (row * 2))
+                                                                       & 0x3);
+        incremented |= incrementAt(indexOf(spread, row), counter);
+    }
+
+    // Exactly one thread observes the sample size being reached, and that
+    // thread ages the sketch.
+
+    if (incremented && d_numRecorded.addRelaxed(1) == d_sampleSize) {
+        age();
+        d_numRecorded.addRelaxed(-d_sampleSize / 2);
+    }
+}
+
+// ACCESSORS
+int Cache_FrequencySketch::frequency(bsl::size_t hash) const
+{
+    if (0 == d_table_p) {
+        return 0;                                                     // RETURN
+    }
+
+    const Uint64 spread = mix(hash);
+
+    int result = 0xf;
+    for (int row = 0; row < 4; ++row) {
+        const int counter = row * 4 + static_cast<int>((spread >> (row * 2))
+                                                                       & 0x3);
+        const int count   = countAt(indexOf(spread, row), counter);
+        if (count < result) {
+            result = count;
+        }
+    }
+    return result;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
 // ----------------------------------------------------------------------------
 // Copyright 2017 Bloomberg Finance L.P.
 //
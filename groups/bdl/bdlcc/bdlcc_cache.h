@@ -27,11 +27,39 @@ BSLS_IDENT("$Id: $")
 // fixed maximum size is obtained by setting the high and low watermarks to the
 // same value.
 //
-// Two eviction policies are supported: LRU (Least Recently Used) and FIFO
-// (First In, First Out).  With LRU, the item that has *not* been accessed for
-// the longest period of time will be evicted first.  With FIFO, the eviction
-// order is based on the order of insertion, with the earliest inserted item
-// being evicted first.
+// Four eviction policies are supported: LRU (Least Recently Used), FIFO
+// (First In, First Out), CLOCK, and W-TinyLFU (Window Tiny Least Frequently
+// Used).  With LRU, the item that has *not* been accessed for the longest
+// period of time will be evicted first.  With FIFO, the eviction order is
+// based on the order of insertion, with the earliest inserted item being
+// evicted first.
+//
+// CLOCK approximates LRU without reordering the eviction queue on every
+// access: an access merely sets a "referenced" flag on the item.  Eviction
+// proceeds from the front of the queue; an item whose flag is set is given a
+// "second chance" (its flag is cleared and it is moved to the back of the
+// queue) instead of being evicted.  Since an access never modifies the queue,
+// 'tryGetValue' never requires a write lock under the CLOCK policy.
+//
+// W-TinyLFU favors items that are accessed frequently over items that are
+// accessed once, which gives a better hit ratio than LRU for workloads mixing
+// a popular working set with scans of rarely reused keys.  The cache keeps an
+// approximate, periodically aged, count of accesses for each key (a
+// "frequency sketch", see 'Cache_FrequencySketch').  New items enter a small
+// admission window (1% of the high watermark) managed in FIFO order; the
+// remaining items are held in a main region managed by CLOCK.  When an item
+// must be evicted and the window is over its share, the oldest window item
+// competes with the next CLOCK victim of the main region and the one with the
+// lower estimated access frequency is evicted, the survivor being (or
+// remaining) part of the main region.  As with CLOCK, accesses update only the
+// frequency sketch and the "referenced" flag (both atomically), so
+// 'tryGetValue' never requires a write lock under the W-TinyLFU policy.  Note
+// that a W-TinyLFU cache is meant to be bounded, and is sized using its high
+// watermark.
+//
+// For read-mostly caches shared by many threads, see also
+// 'bdlcc_shardedcache', which partitions the items among several independently
+// locked caches.
 //
 ///Thread Safety
 ///-------------
@@ -49,10 +77,10 @@ BSLS_IDENT("$Id: $")
 // All of the modifier methods of the cache potentially requires a write lock.
 // Of particular note is the 'tryGetValue' method, which requires a writer lock
 // only if the eviction queue needs to be modified.  This means 'tryGetValue'
-// requires only a read lock if the eviction policy is set to FIFO or the
-// argument 'modifyEvictionQueue' is set to 'false'.  For limited cases where
-// contention is likely, temporarily setting 'modifyEvictionQueue' to 'false'
-// might be of value.
+// requires only a read lock if the eviction policy is set to FIFO, CLOCK, or
+// W-TinyLFU, or the argument 'modifyEvictionQueue' is set to 'false'.  For
+// limited cases where contention is likely, temporarily setting
+// 'modifyEvictionQueue' to 'false' might be of value.
 //
 // The 'visit' method acquires a read lock and calls the supplied visitor
 // function for every item in the cache, or until the visitor function returns
@@ -308,7 +336,10 @@ BSLS_IDENT("$Id: $")
 #include <bslmt_writelockguard.h>
 
 #include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_atomicoperations.h>
 #include <bsls_review.h>
+#include <bsls_types.h>
 
 #include <bsl_memory.h>
 #include <bsl_map.h>
@@ -329,11 +360,134 @@ struct CacheEvictionPolicy {
     enum Enum {
         // Enumeration of supported cache eviction policies.
 
-        e_LRU,  // Least Recently Used
-        e_FIFO  // First In, First Out
+        e_LRU,        // Least Recently Used
+        e_FIFO,       // First In, First Out
+        e_CLOCK,      // second-chance approximation of LRU
+        e_W_TINY_LFU  // frequency-based admission with a recency window
     };
 };
 
+                        // ===========================
+                        // class Cache_FrequencySketch
+                        // ===========================
+
+class Cache_FrequencySketch {
+    // This component-private class implements a thread-safe, fixed-size,
+    // approximate counter of the number of times each of an unbounded set of
+    // keys (identified by their hash values) has been recorded: a count-min
+    // sketch of 4-bit saturating counters.  To favor recent history, the value
+    // of every counter is halved each time the number of recorded accesses
+    // reaches a sample size proportional to the capacity supplied at
+    // construction.  This class is used by 'Cache' to implement the W-TinyLFU
+    // eviction policy.
+
+    // PRIVATE TYPES
+    typedef bsls::AtomicOperations                      AtomicOp;
+    typedef bsls::AtomicOperations::AtomicTypes::Uint64 AtomicUint64;
+    typedef bsls::Types::Uint64                         Uint64;
+
+    // DATA
+    AtomicUint64      *d_table_p;       // counters, 16 per word
+
+    bsl::size_t        d_mask;          // number of words in 'd_table_p' - 1
+
+    bsls::AtomicInt64  d_numRecorded;   // number of counter increments since
+                                        // the last aging
+
+    bsls::Types::Int64 d_sampleSize;    // 'd_numRecorded' value that triggers
+                                        // aging
+
+    bslma::Allocator  *d_allocator_p;   // memory allocator (held, not owned)
+
+    // PRIVATE MANIPULATORS
+    void age();
+        // Halve the value of every counter in this sketch.
+
+    bool incrementAt(bsl::size_t index, int counter);
+        // Increment, unless it is saturated, the specified 'counter' of the
+        // word at the specified 'index'.  Return 'true' if the counter was
+        // incremented, and 'false' otherwise.
+
+    // PRIVATE ACCESSORS
+    int countAt(bsl::size_t index, int counter) const;
+        // Return the value of the specified 'counter' of the word at the
+        // specified 'index'.
+
+    bsl::size_t indexOf(Uint64 hash, int row) const;
+        // Return the index of the word holding the counter of the specified
+        // 'row' for the specified (spread) 'hash'.
+
+    // NOT IMPLEMENTED
+    Cache_FrequencySketch(const Cache_FrequencySketch&);
+    Cache_FrequencySketch& operator=(const Cache_FrequencySketch&);
+
+  public:
+    // CREATORS
+    Cache_FrequencySketch(bsl::size_t       capacity,
+                          bslma::Allocator *basicAllocator = 0);
+        // Create a frequency sketch sized for a cache holding up to the
+        // specified 'capacity' items.  If 'capacity' is 0, the sketch
+        // allocates no memory, 'record' has no effect, and 'frequency'
+        // always returns 0.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.
+
+    ~Cache_FrequencySketch();
+        // Destroy this object.
+
+    // MANIPULATORS
+    void clear();
+        // Reset every counter of this sketch to 0.
+
+    void record(bsl::size_t hash);
+        // Record one access to the key having the specified 'hash'.
+
+    // ACCESSORS
+    int frequency(bsl::size_t hash) const;
+        // Return the estimated number of accesses, in '[0 .. 15]', to the key
+        // having the specified 'hash'.
+};
+
+                           // ====================
+                           // class Cache_MapValue
+                           // ====================
+
+template <class VALUE_PTR, class QUEUE_ITERATOR>
+struct Cache_MapValue {
+    // This component-private struct holds the state associated with a key in
+    // the hash map of a 'Cache'.
+
+    // PUBLIC DATA
+    VALUE_PTR               d_valuePtr;    // shared pointer to the value
+
+    QUEUE_ITERATOR          d_queueIt;     // position of the key in its
+                                           // eviction queue
+
+    mutable bsls::AtomicInt d_referenced;  // non-zero if the item was accessed
+                                           // since the CLOCK hand last passed
+                                           // it (CLOCK and W-TinyLFU only)
+
+    bool                    d_inWindow;    // 'true' if the key is in the
+                                           // admission window (W-TinyLFU
+                                           // only)
+
+    // CREATORS
+    Cache_MapValue(const VALUE_PTR&      valuePtr,
+                   const QUEUE_ITERATOR& queueIt,
+                   bool                  inWindow);
+    Cache_MapValue(bslmf::MovableRef<VALUE_PTR> valuePtr,
+                   const QUEUE_ITERATOR&        queueIt,
+                   bool                         inWindow);
+        // Create a map value holding the specified 'valuePtr', located at the
+        // specified 'queueIt', and in the admission window if the specified
+        // 'inWindow' is 'true'.  The item is initially not referenced.
+
+    Cache_MapValue(const Cache_MapValue& original);
+    Cache_MapValue(bslmf::MovableRef<Cache_MapValue> original);
+        // Create a map value having the same state as the specified
+        // 'original'.
+};
+
 template <class KEY>
 class Cache_QueueProctor {
     // This class implements a proctor that, on destruction, restores the queue
@@ -398,7 +552,8 @@ class Cache {
     typedef bsl::list<KEY>                                        QueueType;
         // Eviction queue type.
 
-    typedef bsl::pair<ValuePtrType, typename QueueType::iterator> MapValue;
+    typedef Cache_MapValue<ValuePtrType, typename QueueType::iterator>
+                                                                  MapValue;
         // Value type of the hash map.
 
     typedef bsl::unordered_map<KEY, MapValue, HASH, EQUAL>        MapType;
@@ -422,6 +577,21 @@ class Cache {
                                                        // evicted is at the
                                                        // front of the queue
 
+    typename QueueType::iterator
+                               d_windowBegin;          // first key of the
+                                                       // admission window, or
+                                                       // 'd_queue.end()' if
+                                                       // the window is empty;
+                                                       // keys before it form
+                                                       // the main region
+                                                       // (W-TinyLFU only)
+
+    bsl::size_t                d_windowSize;           // number of keys in
+                                                       // the admission window
+
+    Cache_FrequencySketch      d_frequencySketch;      // access frequencies
+                                                       // (W-TinyLFU only)
+
     CacheEvictionPolicy::Enum  d_evictionPolicy;       // eviction policy
 
     bsl::size_t                d_lowWatermark;         // the size of this
@@ -433,6 +603,10 @@ class Cache {
                                                        // starts after an
                                                        // insert
 
+    bsl::size_t                d_windowCapacity;       // target size of the
+                                                       // admission window
+                                                       // (W-TinyLFU only)
+
     PostEvictionCallback       d_postEvictionCallback; // the function to call
                                                        // after a value has
                                                        // been evicted from the
@@ -451,6 +625,35 @@ class Cache {
         // Evict the item at the specified 'mapIt' and invoke the post-eviction
         // callback for that item.
 
+    void evictNextItem();
+        // Evict the item selected by the eviction policy of this cache and
+        // invoke the post-eviction callback for that item.  The behavior is
+        // undefined unless this cache is not empty.
+
+    void fillMainRegion();
+        // Move keys from the front of the admission window to the back of the
+        // main region while the window is larger than its target size and
+        // this cache is below its high watermark.  Note that this method has
+        // no effect unless the eviction policy is W-TinyLFU.
+
+    void promoteWindowFront();
+        // Move the key at the front of the admission window to the back of
+        // the main region.  The behavior is undefined unless the admission
+        // window is not empty.
+
+    typename MapType::iterator selectClockVictim();
+        // Return an iterator to the item at the front of 'd_queue' after
+        // giving a second chance to (i.e., clearing the reference flag of,
+        // and moving to the back of the main region) each referenced item
+        // found at the front.  The behavior is undefined unless the main
+        // region is not empty.
+
+    void recordAccess(const KEY& key, const MapValue& mapValue);
+        // Record, for the purpose of the CLOCK and W-TinyLFU eviction
+        // policies, an access to the item having the specified 'key' and
+        // 'mapValue'.  Note that this method modifies only atomic state, and
+        // so requires only a read lock.
+
     bool insertValuePtrMoveImp(KEY          *key_p,
                                bool          moveKey,
                                ValuePtrType *valuePtr_p,
@@ -575,9 +778,11 @@ class Cache {
         // but unspecified state.
 
     int popFront();
-        // Remove the item at the front of the eviction queue.  Invoke the
-        // post-eviction callback for the removed item.  Return 0 on success,
-        // and 1 if this cache is empty.
+        // Remove the item at the front of the eviction queue (i.e., the item
+        // that would be evicted next).  Invoke the post-eviction callback for
+        // the removed item.  Return 0 on success, and 1 if this cache is
+        // empty.  Note that, under the CLOCK and W-TinyLFU eviction policies,
+        // selecting the item may reorder the eviction queue.
 
     void setPostEvictionCallback(
                              const PostEvictionCallback& postEvictionCallback);
@@ -591,9 +796,12 @@ class Cache {
         // Load, into the specified 'value', the value associated with the
         // specified 'key' in this cache.  If the optionally specified
         // 'modifyEvictionQueue' is 'true' and the eviction policy is LRU, then
-        // move the cached item to the back of the eviction queue.  Return 0 on
+        // move the cached item to the back of the eviction queue; if
+        // 'modifyEvictionQueue' is 'true' and the eviction policy is CLOCK or
+        // W-TinyLFU, then record the access to the cached item.  Return 0 on
         // success, and 1 if 'key' does not exist in this cache.  Note that a
-        // write lock is acquired only if this queue is modified.
+        // write lock is acquired only if this queue is modified, which happens
+        // only for the LRU eviction policy.
 
     // ACCESSORS
     EQUAL equalFunction() const;
@@ -623,6 +831,8 @@ class Cache {
     void visit(VISITOR& visitor) const;
         // Call the specified 'visitor' for every item stored in this cache in
         // the order of the eviction queue until 'visitor' returns 'false'.
+        // Note that, under the CLOCK and W-TinyLFU eviction policies, this
+        // order only approximates the order in which items will be evicted.
         // The 'VISITOR' type must be a callable object that can be invoked in
         // the same way as the function 'bool (const KEY&, const VALUE&)'
 };
@@ -704,6 +914,61 @@ void Cache_QueueProctor<KEY>::release()
     d_queue_p = 0;
 }
 
+                           // --------------------
+                           // class Cache_MapValue
+                           // --------------------
+
+// CREATORS
+template <class VALUE_PTR, class QUEUE_ITERATOR>
+inline
+Cache_MapValue<VALUE_PTR, QUEUE_ITERATOR>::Cache_MapValue(
+                                              const VALUE_PTR&      valuePtr,
+                                              const QUEUE_ITERATOR& queueIt,
+                                              bool                  inWindow)
+: d_valuePtr(valuePtr)
+, d_queueIt(queueIt)
+, d_referenced(0)
+, d_inWindow(inWindow)
+{
+}
+
+template <class VALUE_PTR, class QUEUE_ITERATOR>
+inline
+Cache_MapValue<VALUE_PTR, QUEUE_ITERATOR>::Cache_MapValue(
+                                       bslmf::MovableRef<VALUE_PTR> valuePtr,
+                                       const QUEUE_ITERATOR&        queueIt,
+                                       bool                         inWindow)
+: d_valuePtr(bslmf::MovableRefUtil::move(valuePtr))
+, d_queueIt(queueIt)
+, d_referenced(0)
+, d_inWindow(inWindow)
+{
+}
+
+template <class VALUE_PTR, class QUEUE_ITERATOR>
+inline
+Cache_MapValue<VALUE_PTR, QUEUE_ITERATOR>::Cache_MapValue(
+                                               const Cache_MapValue& original)
+: d_valuePtr(original.d_valuePtr)
+, d_queueIt(original.d_queueIt)
+, d_referenced(original.d_referenced.loadRelaxed())
+, d_inWindow(original.d_inWindow)
+{
+}
+
+template <class VALUE_PTR, class QUEUE_ITERATOR>
+inline
+Cache_MapValue<VALUE_PTR, QUEUE_ITERATOR>::Cache_MapValue(
+                                   bslmf::MovableRef<Cache_MapValue> original)
+: d_valuePtr(bslmf::MovableRefUtil::move(
+                        bslmf::MovableRefUtil::access(original).d_valuePtr))
+, d_queueIt(bslmf::MovableRefUtil::access(original).d_queueIt)
+, d_referenced(bslmf::MovableRefUtil::access(original).d_referenced
+                                                              .loadRelaxed())
+, d_inWindow(bslmf::MovableRefUtil::access(original).d_inWindow)
+{
+}
+
                         // -----------
                         // class Cache
                         // -----------
@@ -714,9 +979,13 @@ Cache<KEY, VALUE, HASH, EQUAL>::Cache(bslma::Allocator *basicAllocator)
 : d_allocator_p(bslma::Default::allocator(basicAllocator))
 , d_map(d_allocator_p)
 , d_queue(d_allocator_p)
+, d_windowBegin(d_queue.end())
+, d_windowSize(0)
+, d_frequencySketch(0, d_allocator_p)
 , d_evictionPolicy(CacheEvictionPolicy::e_LRU)
 , d_lowWatermark(bsl::numeric_limits<bsl::size_t>::max())
 , d_highWatermark(bsl::numeric_limits<bsl::size_t>::max())
+, d_windowCapacity(0)
 , d_postEvictionCallback(bsl::allocator_arg, d_allocator_p)
 {
 }
@@ -730,9 +999,16 @@ Cache<KEY, VALUE, HASH, EQUAL>::Cache(
 : d_allocator_p(bslma::Default::allocator(basicAllocator))
 , d_map(d_allocator_p)
 , d_queue(d_allocator_p)
+, d_windowBegin(d_queue.end())
+, d_windowSize(0)
+, d_frequencySketch(CacheEvictionPolicy::e_W_TINY_LFU == evictionPolicy
+                    ? highWatermark
+                    : 0,
+                    d_allocator_p)
 , d_evictionPolicy(evictionPolicy)
 , d_lowWatermark(lowWatermark)
 , d_highWatermark(highWatermark)
+, d_windowCapacity(highWatermark / 100 ? highWatermark / 100 : 1)
 , d_postEvictionCallback(bsl::allocator_arg, d_allocator_p)
 {
     BSLS_REVIEW(lowWatermark <= highWatermark);
@@ -751,9 +1027,16 @@ Cache<KEY, VALUE, HASH, EQUAL>::Cache(
 : d_allocator_p(bslma::Default::allocator(basicAllocator))
 , d_map(0, hashFunction, equalFunction, d_allocator_p)
 , d_queue(d_allocator_p)
+, d_windowBegin(d_queue.end())
+, d_windowSize(0)
+, d_frequencySketch(CacheEvictionPolicy::e_W_TINY_LFU == evictionPolicy
+                    ? highWatermark
+                    : 0,
+                    d_allocator_p)
 , d_evictionPolicy(evictionPolicy)
 , d_lowWatermark(lowWatermark)
 , d_highWatermark(highWatermark)
+, d_windowCapacity(highWatermark / 100 ? highWatermark / 100 : 1)
 , d_postEvictionCallback(bsl::allocator_arg, d_allocator_p)
 {
     BSLS_REVIEW(lowWatermark <= highWatermark);
@@ -770,9 +1053,7 @@ void Cache<KEY, VALUE, HASH, EQUAL>::enforceHighWatermark()
     }
 
     while (d_map.size() >= d_lowWatermark && d_map.size() > 0) {
-        const typename MapType::iterator mapIt = d_map.find(d_queue.front());
-        BSLS_ASSERT(mapIt != d_map.end());
-        evictItem(mapIt);
+        evictNextItem();
     }
 }
 
@@ -780,15 +1061,144 @@ template <class KEY, class VALUE, class HASH, class EQUAL>
 void Cache<KEY, VALUE, HASH, EQUAL>::evictItem(
                                        const typename MapType::iterator& mapIt)
 {
-    ValuePtrType value = mapIt->second.first;
+    ValuePtrType value = mapIt->second.d_valuePtr;
 
-    d_queue.erase(mapIt->second.second);
+    if (mapIt->second.d_inWindow) {
+        if (d_windowBegin == mapIt->second.d_queueIt) {
+            ++d_windowBegin;
+        }
+        --d_windowSize;
+    }
+    d_queue.erase(mapIt->second.d_queueIt);
     d_map.erase(mapIt);
 
     if (d_postEvictionCallback) {
         d_postEvictionCallback(value);
     }
 }
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void Cache<KEY, VALUE, HASH, EQUAL>::evictNextItem()
+{
+    switch (d_evictionPolicy) {
+      case CacheEvictionPolicy::e_CLOCK: {
+        evictItem(selectClockVictim());
+      } break;
+      case CacheEvictionPolicy::e_W_TINY_LFU: {
+        const bool mainIsEmpty = d_queue.begin() == d_windowBegin;
+
+        if (0 == d_windowSize
+         || (d_windowSize <= d_windowCapacity && !mainIsEmpty)) {
+            evictItem(selectClockVictim());
+            return;                                                   // RETURN
+        }
+
+        // The window is over its share: its oldest item must either displace
+        // an item of the main region or be evicted.
+
+        const typename MapType::iterator candidateIt =
+                                                    d_map.find(*d_windowBegin);
+        BSLS_ASSERT(candidateIt != d_map.end());
+
+        if (mainIsEmpty) {
+            evictItem(candidateIt);
+            return;                                                   // RETURN
+        }
+
+        const typename MapType::iterator victimIt = selectClockVictim();
+
+        const HASH& hasher             = d_map.hash_function();
+        const int   candidateFrequency = d_frequencySketch.frequency(
+                                                  hasher(candidateIt->first));
+        const int   victimFrequency    = d_frequencySketch.frequency(
+                                                     hasher(victimIt->first));
+
+        if (candidateFrequency > victimFrequency) {
+            evictItem(victimIt);
+
+            candidateIt->second.d_referenced.storeRelaxed(0);
+            promoteWindowFront();
+        }
+        else {
+            evictItem(candidateIt);
+        }
+      } break;
+      default: {
+        const typename MapType::iterator mapIt = d_map.find(d_queue.front());
+        BSLS_ASSERT(mapIt != d_map.end());
+        evictItem(mapIt);
+      }
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void Cache<KEY, VALUE, HASH, EQUAL>::fillMainRegion()
+{
+    if (CacheEvictionPolicy::e_W_TINY_LFU != d_evictionPolicy) {
+        return;                                                       // RETURN
+    }
+
+    while (d_windowSize > d_windowCapacity
+        && d_map.size() < d_highWatermark) {
+        promoteWindowFront();
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void Cache<KEY, VALUE, HASH, EQUAL>::promoteWindowFront()
+{
+    BSLS_ASSERT(0 < d_windowSize);
+
+    // The main region ends where the window begins, so advancing the boundary
+    // moves the front of the window to the back of the main region.
+
+    const typename MapType::iterator mapIt = d_map.find(*d_windowBegin);
+    BSLS_ASSERT(mapIt != d_map.end());
+
+    mapIt->second.d_inWindow = false;
+    ++d_windowBegin;
+    --d_windowSize;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void Cache<KEY, VALUE, HASH, EQUAL>::recordAccess(
+                                                     const KEY&      key,
+                                                     const MapValue& mapValue)
+{
+    if (CacheEvictionPolicy::e_W_TINY_LFU == d_evictionPolicy) {
+        d_frequencySketch.record(d_map.hash_function()(key));
+    }
+
+    // Avoid writing to the cache line of an already referenced item.
+
+    if (0 == mapValue.d_referenced.loadRelaxed()) {
+        mapValue.d_referenced.storeRelaxed(1);
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+typename Cache<KEY, VALUE, HASH, EQUAL>::MapType::iterator
+Cache<KEY, VALUE, HASH, EQUAL>::selectClockVictim()
+{
+    BSLS_ASSERT(d_queue.begin() != d_windowBegin);
+
+    // Each referenced item is moved to the back of the main region with its
+    // flag cleared, so this loop terminates after at most one pass over the
+    // main region.
+
+    while (true) {
+        const typename MapType::iterator mapIt = d_map.find(d_queue.front());
+        BSLS_ASSERT(mapIt != d_map.end());
+
+        if (0 == mapIt->second.d_referenced.loadRelaxed()) {
+            return mapIt;                                             // RETURN
+        }
+        mapIt->second.d_referenced.storeRelaxed(0);
+        d_queue.splice(d_windowBegin, d_queue, mapIt->second.d_queueIt);
+    }
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 inline
 bool Cache<KEY, VALUE, HASH, EQUAL>::insertValuePtrMoveImp(
@@ -811,21 +1221,34 @@ bool Cache<KEY, VALUE, HASH, EQUAL>::insertValuePtrMoveImp(
     typename MapType::iterator mapIt = d_map.find(key);
     if (mapIt != d_map.end()) {
         if (k_RVALUE_ASSIGN && moveValuePtr) {
-            mapIt->second.first = bslmf::MovableRefUtil::move(valuePtr);
+            mapIt->second.d_valuePtr = bslmf::MovableRefUtil::move(valuePtr);
         }
         else {
-            mapIt->second.first = valuePtr;
+            mapIt->second.d_valuePtr = valuePtr;
         }
 
-        typename QueueType::iterator queueIt = mapIt->second.second;
+        if (CacheEvictionPolicy::e_LRU  == d_evictionPolicy
+         || CacheEvictionPolicy::e_FIFO == d_evictionPolicy) {
+            typename QueueType::iterator queueIt = mapIt->second.d_queueIt;
 
-        // Move 'queueIt' to the back of 'd_queue'.
+            // Move 'queueIt' to the back of 'd_queue'.
 
-        d_queue.splice(d_queue.end(), d_queue, queueIt);
+            d_queue.splice(d_queue.end(), d_queue, queueIt);
+        }
+        else {
+            recordAccess(mapIt->first, mapIt->second);
+        }
 
         return false;                                                 // RETURN
     }
     else {
+        const bool inWindow = CacheEvictionPolicy::e_W_TINY_LFU ==
+                                                              d_evictionPolicy;
+
+        if (inWindow) {
+            d_frequencySketch.record(d_map.hash_function()(key));
+        }
+
         Cache_QueueProctor<KEY>      proctor(&d_queue);
         d_queue.push_back(key);
         typename QueueType::iterator queueIt = d_queue.end();
@@ -837,12 +1260,12 @@ bool Cache<KEY, VALUE, HASH, EQUAL>::insertValuePtrMoveImp(
         if (moveValuePtr) {
             new (mapValue_p) MapValue(bslmf::MovableRefUtil::move(valuePtr),
                                       queueIt,
-                                      d_allocator_p);
+                                      inWindow);
         }
         else {
             new (mapValue_p) MapValue(valuePtr,
                                       queueIt,
-                                      d_allocator_p);
+                                      inWindow);
         }
         bslma::DestructorGuard<MapValue> mapValueGuard(mapValue_p);
 
@@ -857,6 +1280,14 @@ bool Cache<KEY, VALUE, HASH, EQUAL>::insertValuePtrMoveImp(
 
         proctor.release();
 
+        if (inWindow) {
+            if (0 == d_windowSize) {
+                d_windowBegin = queueIt;
+            }
+            ++d_windowSize;
+            fillMainRegion();
+        }
+
         return true;                                                  // RETURN
     }
 }
@@ -909,6 +1340,9 @@ void Cache<KEY, VALUE, HASH, EQUAL>::clear()
     bslmt::WriteLockGuard<LockType> guard(&d_rwlock);
     d_map.clear();
     d_queue.clear();
+    d_windowBegin = d_queue.end();
+    d_windowSize  = 0;
+    d_frequencySketch.clear();
 }
 
 template <class KEY, class VALUE, class HASH, class EQUAL>
@@ -1072,9 +1506,7 @@ int Cache<KEY, VALUE, HASH, EQUAL>::popFront()
     bslmt::WriteLockGuard<LockType> guard(&d_rwlock);
 
     if (d_map.size() > 0) {
-        const typename MapType::iterator mapIt = d_map.find(d_queue.front());
-        BSLS_ASSERT(mapIt != d_map.end());
-        evictItem(mapIt);
+        evictNextItem();
         return 0;                                                     // RETURN
     }
 
@@ -1115,10 +1547,16 @@ int Cache<KEY, VALUE, HASH, EQUAL>::tryGetValue(
         return 1;                                                     // RETURN
     }
 
-    *value = mapIt->second.first;
+    *value = mapIt->second.d_valuePtr;
+
+    if (modifyEvictionQueue
+     && (CacheEvictionPolicy::e_CLOCK      == d_evictionPolicy
+      || CacheEvictionPolicy::e_W_TINY_LFU == d_evictionPolicy)) {
+        recordAccess(mapIt->first, mapIt->second);
+    }
 
     if (writeLock) {
-        typename QueueType::iterator queueIt = mapIt->second.second;
+        typename QueueType::iterator queueIt = mapIt->second.d_queueIt;
         typename QueueType::iterator last = d_queue.end();
         --last;
         if (last != queueIt) {
@@ -1186,7 +1624,7 @@ void Cache<KEY, VALUE, HASH, EQUAL>::visit(VISITOR& visitor) const
         const KEY&                             key = *queueIt;
         const typename MapType::const_iterator mapIt = d_map.find(key);
         BSLS_ASSERT(mapIt != d_map.end());
-        const ValuePtrType& valuePtr = mapIt->second.first;
+        const ValuePtrType& valuePtr = mapIt->second.d_valuePtr;
 
         if (!visitor(key, *valuePtr)) {
             break;
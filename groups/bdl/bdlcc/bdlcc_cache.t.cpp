@@ -128,7 +128,9 @@ using namespace bsl;
 // [15] THREAD SAFETY
 // [16] LOCKING TEST UTIL
 // [17] LOCKING
-// [18] USAGE EXAMPLE
+// [18] REPRODUCE DRQS 134930805
+// [19] CLOCK AND W-TINYLFU EVICTION POLICIES
+// [20] USAGE EXAMPLE
 // [-1] INSERT PERFORMANCE
 // [-2] INSERT BULK PERFORMANCE
 // [-3] READ PERFORMANCE
@@ -1746,6 +1748,246 @@ void threadedTest1()
 
 }  // close namespace threaded
 
+namespace testPolicies {
+
+typedef bdlcc::Cache<int, int> IntCache;
+
+bool contains(IntCache *cache, int key)
+    // Return 'true' if the specified 'cache' contains the specified 'key',
+    // and 'false' otherwise.  Do not record the access.
+{
+    IntCache::ValuePtrType valuePtr;
+    return 0 == cache->tryGetValue(&valuePtr, key, false);
+}
+
+int runHotSetWorkload(bdlcc::CacheEvictionPolicy::Enum policy)
+    // Run, on a cache having a capacity of 100 items and the specified
+    // 'policy', a workload in which a hot set of 50 keys is accessed after
+    // each scan of 200 keys that are never reused, and return the number of
+    // hot-set accesses that hit the cache.
+{
+    const int k_NUM_HOT   = 50;
+    const int k_SCAN_SIZE = 200;
+    const int k_NUM_ROUNDS = 40;
+
+    bslma::TestAllocator ta("workload", veryVeryVeryVerbose);
+    IntCache             cache(policy, 100, 100, &ta);
+
+    int hits    = 0;
+    int scanKey = 1000;
+    for (int round = 0; round < k_NUM_ROUNDS; ++round) {
+        for (int key = 0; key < k_NUM_HOT; ++key) {
+            IntCache::ValuePtrType valuePtr;
+            if (0 == cache.tryGetValue(&valuePtr, key)) {
+                hits += round > 0;
+            }
+            else {
+                cache.insert(key, key);
+            }
+        }
+        for (int i = 0; i < k_SCAN_SIZE; ++i, ++scanKey) {
+            cache.insert(scanKey, scanKey);
+        }
+        ASSERTV(policy, cache.size(), 100 >= cache.size());
+    }
+    return hits;
+}
+
+struct ThreadArg {
+    IntCache *d_cache_p;
+    int       d_seed;
+};
+
+extern "C" void *mixedWorkloadThread(void *v_arg)
+    // Insert and look up random keys in the cache held by the specified
+    // 'v_arg', a 'ThreadArg'.
+{
+    ThreadArg *arg  = static_cast<ThreadArg *>(v_arg);
+    int        seed = arg->d_seed;
+
+    for (int i = 0; i < 20000; ++i) {
+        const int              key = bdlb::Random::generate15(&seed) % 500;
+        IntCache::ValuePtrType valuePtr;
+        if (0 != arg->d_cache_p->tryGetValue(&valuePtr, key)) {
+            arg->d_cache_p->insert(key, key);
+        }
+        else {
+            ASSERTV(key, *valuePtr, key == *valuePtr);
+        }
+    }
+    return v_arg;
+}
+
+void testEvictionPolicies()
+{
+    // ------------------------------------------------------------------------
+    // CLOCK AND W-TINYLFU EVICTION POLICIES
+    //
+    // Concerns:
+    //: 1 Under the CLOCK policy, an item accessed with 'tryGetValue' since
+    //:   the last pass is skipped (once) by eviction, and an item accessed
+    //:   with 'modifyEvictionQueue == false' is not.
+    //:
+    //: 2 'popFront' evicts the item that the CLOCK policy selects.
+    //:
+    //: 3 'Cache_FrequencySketch' counts accesses, saturates at 15, ages its
+    //:   counters, and can be cleared; a sketch of capacity 0 allocates no
+    //:   memory.
+    //:
+    //: 4 Under the W-TinyLFU policy, a frequently accessed set of keys
+    //:   survives scans of keys that are never reused, unlike under LRU.
+    //:
+    //: 5 Both policies are thread-safe and keep the cache within its
+    //:   watermarks.
+    //
+    // Plan:
+    //: 1 Fill a CLOCK cache, access some items, insert more items, and
+    //:   verify which items were evicted.  (C-1..2)
+    //:
+    //: 2 Exercise a sketch directly.  (C-3)
+    //:
+    //: 3 Run the same hot-set-plus-scan workload with LRU and W-TinyLFU and
+    //:   compare the number of hits on the hot set.  (C-4)
+    //:
+    //: 4 Concurrently insert and look up random keys from several threads.
+    //:   (C-5)
+    //
+    // Testing:
+    //   CLOCK AND W-TINYLFU EVICTION POLICIES
+    // ------------------------------------------------------------------------
+
+    bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+    if (verbose) cout << "\nCLOCK second chance." << endl;
+    {
+        IntCache mX(bdlcc::CacheEvictionPolicy::e_CLOCK, 4, 4, &ta);
+        const IntCache& X = mX;
+
+        ASSERT(bdlcc::CacheEvictionPolicy::e_CLOCK == X.evictionPolicy());
+
+        for (int i = 0; i < 4; ++i) {
+            mX.insert(i, i);
+        }
+
+        IntCache::ValuePtrType valuePtr;
+        ASSERT(0 == mX.tryGetValue(&valuePtr, 0));
+        ASSERT(0 == mX.tryGetValue(&valuePtr, 2));
+        ASSERT(0 == mX.tryGetValue(&valuePtr, 3, false));
+
+        // Queue is [0* 1 2* 3]: 0 gets a second chance and 1 is evicted.
+
+        mX.insert(4, 4);
+        ASSERT(4 == X.size());
+        ASSERT( contains(&mX, 0));
+        ASSERT(!contains(&mX, 1));
+        ASSERT( contains(&mX, 2));
+
+        // Queue is [2* 3 0 4]: 2 gets a second chance and 3 is evicted.
+
+        mX.insert(5, 5);
+        ASSERT(4 == X.size());
+        ASSERT( contains(&mX, 2));
+        ASSERT(!contains(&mX, 3));
+
+        // Queue is [0 4 5 2]: re-inserting a key marks it as referenced.
+
+        mX.insert(0, 10);
+        ASSERT(0 == mX.popFront());
+        ASSERT( contains(&mX, 0));
+        ASSERT(!contains(&mX, 4));
+        ASSERT(3 == X.size());
+
+        ASSERT(0 == mX.tryGetValue(&valuePtr, 0));
+        ASSERT(10 == *valuePtr);
+    }
+
+    if (verbose) cout << "\n'Cache_FrequencySketch'." << endl;
+    {
+        const bsls::Types::Int64 NUM_BLOCKS = ta.numBlocksInUse();
+        {
+            bdlcc::Cache_FrequencySketch mX(0, &ta);
+            mX.record(17);
+            ASSERT(0 == mX.frequency(17));
+        }
+        ASSERT(NUM_BLOCKS == ta.numBlocksInUse());
+
+        bdlcc::Cache_FrequencySketch mX(64, &ta);
+        ASSERT(NUM_BLOCKS < ta.numBlocksInUse());
+
+        ASSERT(0 == mX.frequency(17));
+        for (int i = 1; i <= 20; ++i) {
+            mX.record(17);
+            ASSERTV(i,
+                    mX.frequency(17),
+                    (i < 15 ? i : 15) <= mX.frequency(17));
+        }
+        ASSERT(15 == mX.frequency(17));
+
+        // Record distinct keys until the sketch is aged.
+
+        bsl::size_t hash = 1000;
+        while (mX.frequency(17) > 7 && hash < 100000) {
+            mX.record(hash++);
+        }
+        ASSERTV(mX.frequency(17), 7 == mX.frequency(17));
+
+        mX.clear();
+        ASSERT(0 == mX.frequency(17));
+    }
+
+    if (verbose) cout << "\nW-TinyLFU scan resistance." << endl;
+    {
+        const int lruHits = runHotSetWorkload(
+                                           bdlcc::CacheEvictionPolicy::e_LRU);
+        const int lfuHits = runHotSetWorkload(
+                                    bdlcc::CacheEvictionPolicy::e_W_TINY_LFU);
+
+        if (veryVerbose) { P_(lruHits) P(lfuHits) }
+
+        ASSERTV(lruHits, lfuHits, lruHits < lfuHits);
+        ASSERTV(lfuHits, lfuHits >= 39 * 50 * 9 / 10);
+    }
+
+    if (verbose) cout << "\nConcurrent access." << endl;
+    {
+        const bdlcc::CacheEvictionPolicy::Enum POLICIES[] = {
+            bdlcc::CacheEvictionPolicy::e_CLOCK,
+            bdlcc::CacheEvictionPolicy::e_W_TINY_LFU
+        };
+
+        const int NUM_POLICIES = sizeof(POLICIES) / sizeof(*POLICIES);
+        const int k_NUM_THREADS = 4;
+
+        for (int tp = 0; tp < NUM_POLICIES; ++tp) {
+            IntCache mX(POLICIES[tp], 90, 100, &ta);
+
+            bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+            ThreadArg                 args[k_NUM_THREADS];
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                args[i].d_cache_p = &mX;
+                args[i].d_seed    = i + 1;
+                ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                      mixedWorkloadThread,
+                                                      &args[i]));
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                bslmt::ThreadUtil::join(handles[i]);
+            }
+
+            ASSERTV(tp, mX.size(), 0 < mX.size() && 100 >= mX.size());
+
+            bsl::size_t count = 0;
+            while (0 == mX.popFront()) {
+                ++count;
+            }
+            ASSERTV(tp, count, 0 < count && 100 >= count);
+        }
+    }
+}
+
+}  // close namespace testPolicies
+
 // TestDriver template
 namespace {
 
@@ -4163,7 +4405,7 @@ int main(int argc, char *argv[])
 
     // BDE_VERIFY pragma: -TP17 These are defined in the various test functions
     switch (test) { case 0:
-      case 19: {
+      case 20: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -4184,6 +4426,9 @@ int main(int argc, char *argv[])
         usageExample1::example1();
         usageExample2::example2();
       } break;
+      case 19: {
+        testPolicies::testEvictionPolicies();
+      } break;
       // BDE_VERIFY pragma: -TP05 Defined in the various test functions
       case 18: {
         // --------------------------------------------------------------------
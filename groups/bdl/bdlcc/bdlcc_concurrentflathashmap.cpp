@@ -0,0 +1,179 @@
+// bdlcc_concurrentflathashmap.cpp                                    -*-C++-*-
+#include <bdlcc_concurrentflathashmap.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlcc_concurrentflathashmap_cpp,"$Id$ $CSID$")
+
+#include <bslma_deallocatorproctor.h>
+
+namespace BloombergLP {
+namespace bdlcc {
+
+namespace {
+
+// The value of a word of control values all of which are empty.
+
+const bsls::Types::Uint64 k_EMPTY_WORD = 0x8080808080808080ULL;
+
+BSLMF_ASSERT(0x80 == ConcurrentFlatHashMap_Table::k_EMPTY);
+
+void deleteTables(ConcurrentFlatHashMap_Table *list,
+                  bslma::Allocator            *basicAllocator)
+    // Destroy the specified 'list' of tables, linked through their 'd_next_p'
+    // member, and return their memory to the specified 'basicAllocator'.
+{
+    while (list) {
+        ConcurrentFlatHashMap_Table *next = list->d_next_p;
+        ConcurrentFlatHashMap_Table::deleteTable(list, basicAllocator);
+        list = next;
+    }
+}
+
+}  // close unnamed namespace
+
+                     // ----------------------------------
+                     // struct ConcurrentFlatHashMap_Table
+                     // ----------------------------------
+
+// CLASS METHODS
+ConcurrentFlatHashMap_Table *ConcurrentFlatHashMap_Table::create(
+                                              bsl::size_t       capacity,
+                                              bsl::size_t       entryWords,
+                                              bslma::Allocator *basicAllocator)
+{
+    BSLS_ASSERT(basicAllocator);
+    BSLS_ASSERT(0 == (capacity & (capacity - 1)));
+    BSLS_ASSERT(2 * k_GROUP_SIZE <= capacity);
+    BSLS_ASSERT(0 < entryWords);
+
+    const bsl::size_t numControlWords = capacity / k_GROUP_SIZE;
+    const bsl::size_t numEntryWords   = capacity * entryWords;
+
+    ConcurrentFlatHashMap_Table *table =
+                               static_cast<ConcurrentFlatHashMap_Table *>(
+                                   basicAllocator->allocate(sizeof *table));
+    bslma::DeallocatorProctor<bslma::Allocator> tableProctor(table,
+                                                             basicAllocator);
+
+    Word *controls = static_cast<Word *>(
+                     basicAllocator->allocate(numControlWords * sizeof(Word)));
+    bslma::DeallocatorProctor<bslma::Allocator> controlsProctor(
+                                                               controls,
+                                                               basicAllocator);
+
+    Word *entries = static_cast<Word *>(
+                       basicAllocator->allocate(numEntryWords * sizeof(Word)));
+
+    for (bsl::size_t i = 0; i < numControlWords; ++i) {
+        bsls::AtomicOperations::initUint64(controls + i, k_EMPTY_WORD);
+    }
+    for (bsl::size_t i = 0; i < numEntryWords; ++i) {
+        bsls::AtomicOperations::initUint64(entries + i, 0);
+    }
+
+    table->d_controls_p        = controls;
+    table->d_entries_p         = entries;
+    table->d_capacity          = capacity;
+    table->d_entryWords        = entryWords;
+    table->d_groupControlShift = static_cast<int>(
+                   sizeof(bsl::size_t) * 8
+                 - bdlb::BitUtil::log2(
+                      static_cast<bsl::uint64_t>(capacity / k_GROUP_SIZE)));
+    table->d_next_p            = 0;
+
+    controlsProctor.release();
+    tableProctor.release();
+
+    return table;
+}
+
+void ConcurrentFlatHashMap_Table::deleteTable(
+                                   ConcurrentFlatHashMap_Table *table,
+                                   bslma::Allocator            *basicAllocator)
+{
+    BSLS_ASSERT(table);
+    BSLS_ASSERT(basicAllocator);
+
+    basicAllocator->deallocate(table->d_entries_p);
+    basicAllocator->deallocate(table->d_controls_p);
+    basicAllocator->deallocate(table);
+}
+
+// MANIPULATORS
+void ConcurrentFlatHashMap_Table::clear()
+{
+    const bsl::size_t numControlWords = d_capacity / k_GROUP_SIZE;
+
+    for (bsl::size_t i = 0; i < numControlWords; ++i) {
+        bsls::AtomicOperations::setUint64Release(d_controls_p + i,
+                                                 k_EMPTY_WORD);
+    }
+}
+
+                     // ----------------------------------
+                     // struct ConcurrentFlatHashMap_Shard
+                     // ----------------------------------
+
+// CREATORS
+ConcurrentFlatHashMap_Shard::ConcurrentFlatHashMap_Shard(
+                                              bslma::Allocator *basicAllocator)
+: d_sequence(0)
+, d_current(0)
+, d_previous(0)
+, d_size(0)
+, d_mutex()
+, d_numUsed(0)
+, d_numMigrated(0)
+, d_migrationGroups(0)
+, d_retired_p(0)
+, d_allocator_p(basicAllocator)
+{
+    BSLS_ASSERT(basicAllocator);
+}
+
+ConcurrentFlatHashMap_Shard::~ConcurrentFlatHashMap_Shard()
+{
+    if (d_current.loadRelaxed()) {
+        Table::deleteTable(d_current.loadRelaxed(), d_allocator_p);
+    }
+    if (d_previous.loadRelaxed()) {
+        Table::deleteTable(d_previous.loadRelaxed(), d_allocator_p);
+    }
+    deleteTables(d_retired_p, d_allocator_p);
+}
+
+// MANIPULATORS
+void ConcurrentFlatHashMap_Shard::retirePrevious()
+{
+    Table *previous = d_previous.loadRelaxed();
+
+    BSLS_ASSERT(previous);
+
+    // A reader that loaded 'previous' before it is reset may still be
+    // inspecting it, and readers are not tracked, so it is deallocated only
+    // with the shard.
+
+    d_previous.storeRelease(0);
+
+    previous->d_next_p = d_retired_p;
+    d_retired_p        = previous;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
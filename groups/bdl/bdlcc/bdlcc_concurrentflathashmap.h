@@ -0,0 +1,1564 @@
+// bdlcc_concurrentflathashmap.h                                      -*-C++-*-
+#ifndef INCLUDED_BDLCC_CONCURRENTFLATHASHMAP
+#define INCLUDED_BDLCC_CONCURRENTFLATHASHMAP
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a concurrent open-addressing map with lock-free readers.
+//
+//@CLASSES:
+//  bdlcc::ConcurrentFlatHashMap: concurrent flat hash map, optimistic reads
+//
+//@SEE_ALSO: bdlcc_stripedunorderedmap, bdlc_flathashmap
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bdlcc::ConcurrentFlatHashMap', implementing a fully thread-safe mapping
+// from keys to values that is optimized for workloads dominated by lookups
+// (e.g., reference data consulted by many threads and updated occasionally).
+//
+// The elements of the map are partitioned among a fixed number of shards,
+// selected from the hash value of the key.  Each shard is an open-addressing
+// hash table using the layout of 'bdlc::FlatHashTable': an array of entries,
+// and an array of one-byte control values, organized in groups that are
+// matched as a whole against the hash value of a key.  Unlike
+// 'bdlcc::StripedUnorderedMap', whose lookups acquire a reader lock and
+// traverse the nodes of a bucket, a lookup in a 'bdlcc::ConcurrentFlatHashMap'
+// acquires no lock and writes no shared memory, so that lookups scale with the
+// number of threads performing them, and typically inspects one group of
+// control values and one entry.
+//
+///Optimistic Reads
+///----------------
+// Each shard is guarded by a sequence lock ("seqlock"): a counter that a
+// modification of the shard increments before and after changing the shard,
+// so that the counter is odd exactly while the shard is being modified.  A
+// lookup reads the counter, copies the entry it is looking for (if any) out of
+// the shard, and reads the counter again; if the counter changed in between,
+// or was odd, the copy may be inconsistent and the lookup is retried.
+// Modifications of a shard are serialized by a mutex, so that lookups never
+// block each other, and modifications of different shards never contend.
+//
+// Every word of the control values and of the entries is read and written
+// atomically (with acquire and release semantics, respectively), so the
+// speculative reads of a lookup that races with a modification are well
+// defined, and always detected by the second read of the counter.
+//
+///Requirements on 'KEY' and 'VALUE'
+///----------------------------------
+// Since a lookup may copy an entry while it is being overwritten, keys and
+// values are stored as sequences of bytes, and must be trivially copyable
+// (see 'bsl::is_trivially_copyable') with an alignment not exceeding 8.  A key
+// copied inconsistently by a lookup may be compared (using 'EQUAL') with the
+// key being looked up before the lookup is retried, so 'EQUAL' must not have
+// undefined behavior for any bit pattern of a 'KEY' (as is the case for
+// arithmetic types, and arrays of them).  Keys and values having an owned,
+// out-of-place representation (e.g., 'bsl::string') are not supported; such
+// keys can often be replaced by a fixed-size representation (e.g., a
+// fixed-length array of 'char', or an integer identifier).
+//
+///Incremental Resizing
+///--------------------
+// The capacity of a shard is a power of two, and the storage of a shard is
+// reorganized when the number of its slots in use or erased would exceed 7/8
+// of its capacity.  If the current storage could hold twice the number of
+// elements of the shard, the slots filling it are mostly erased ones, and they
+// are purged in place: the elements are copied out of the storage, which is
+// then cleared and refilled while the shard is marked as being modified, so
+// that the concurrent lookups of the shard are retried until the purge
+// completes.  Otherwise, the shard is resized to at least twice its capacity.
+// A resize allocates the new storage of the shard and publishes it, but does
+// not move any element: the elements are migrated from the previous storage a
+// few groups at a time, by the subsequent modifications of the shard.  Until
+// the migration completes, lookups search the new storage and then the
+// previous one.  Resizing a shard therefore never blocks lookups, and it
+// delays other modifications of the same shard only while the new storage is
+// allocated and initialized.  No operation of a 'bdlcc::ConcurrentFlatHashMap'
+// suspends the whole map.
+//
+// Because lookups are not tracked, a lookup may still be reading the previous
+// storage of a shard after its migration completes, so that storage is
+// deallocated only when the map is destroyed.  As storage is retired only by
+// resizes, each of which at least doubles the capacity of the shard, the
+// storage retired by a shard is always smaller than its current storage.
+//
+///Thread Safety
+///-------------
+// 'bdlcc::ConcurrentFlatHashMap' is fully thread-safe, meaning that all
+// non-creator operations on a given object can be safely executed
+// concurrently.  Operations that address a single key (i.e., 'erase',
+// 'getValue', and 'insert') are atomic; operations that address several
+// shards (e.g., 'clear', 'size', and 'visit') are performed one shard at a
+// time, and so are not atomic with respect to the map as a whole.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Reference Data Shared by Many Threads
+/// - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that the request-processing threads of a trading application need
+// the static attributes of securities, identified by an integer, and that
+// these attributes are occasionally updated by a separate thread.
+//
+// First, we define the attributes of a security as a trivially copyable
+// 'struct':
+//..
+//  struct SecurityInfo {
+//      // This 'struct' holds the static attributes of a security.
+//
+//      int d_exchangeId;  // identifier of the listing exchange
+//      int d_lotSize;     // number of shares of a round lot
+//  };
+//..
+// Then, we create a map of security identifiers to their attributes, sized
+// for the expected number of securities:
+//..
+//  typedef bdlcc::ConcurrentFlatHashMap<int, SecurityInfo> SecurityMap;
+//
+//  SecurityMap securities(16, 1000);
+//  assert(16   == securities.numShards());
+//  assert(1000 <= securities.capacity());
+//..
+// Next, the updating thread loads the attributes of a few securities:
+//..
+//  for (int id = 1; id <= 100; ++id) {
+//      SecurityInfo info = { id % 4, 100 * id };
+//      assert(1 == securities.insert(id, info));
+//  }
+//  assert(100 == securities.size());
+//..
+// Then, any number of request-processing threads look up attributes, without
+// acquiring any lock:
+//..
+//  SecurityInfo info;
+//  assert(1    == securities.getValue(&info, 42));
+//  assert(2    == info.d_exchangeId);
+//  assert(4200 == info.d_lotSize);
+//
+//  assert(0 == securities.getValue(&info, 1000));
+//..
+// Now, the updating thread changes the lot size of a security; 'insert'
+// returns 0 as the security is already present:
+//..
+//  SecurityInfo newInfo = { 2, 500 };
+//  assert(0 == securities.insert(42, newInfo));
+//
+//  assert(1   == securities.getValue(&info, 42));
+//  assert(500 == info.d_lotSize);
+//..
+// Finally, a security that is delisted is removed from the map:
+//..
+//  assert(1  == securities.erase(42));
+//  assert(0  == securities.getValue(&info, 42));
+//  assert(99 == securities.size());
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlc_flathashtable_groupcontrol.h>
+
+#include <bdlb_bitutil.h>
+
+#include <bslh_fibonaccibadhashwrapper.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_assert.h>
+#include <bslmf_istriviallycopyable.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_platform.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_alignedbuffer.h>
+#include <bsls_alignmentfromtype.h>
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_atomicoperations.h>
+#include <bsls_performancehint.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdint.h>
+#include <bsl_cstring.h>
+#include <bsl_functional.h>
+#include <bsl_memory.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlcc {
+
+                     // ==================================
+                     // struct ConcurrentFlatHashMap_Table
+                     // ==================================
+
+struct ConcurrentFlatHashMap_Table {
+    // This component-private 'struct' holds one generation of the storage of
+    // a shard of a 'ConcurrentFlatHashMap': an array of control values, and
+    // an array of entries, each occupying a fixed number of words.  Both
+    // arrays are made of words accessed atomically, so that a reader may
+    // inspect them while a writer modifies them.  Readers load words with
+    // acquire semantics, and writers store words with release semantics.
+    //
+    // The control values have the encoding of 'bdlc::FlatHashTable' (see
+    // 'bdlc_flathashtable_groupcontrol'), and each word of control values
+    // forms a group of 'k_GROUP_SIZE' slots, the control value of the slot at
+    // index 'i' in the group being the byte of value '(word >> (8 * i)) &
+    // 0xff'.  A group is inspected by loading its word once, and matching all
+    // of its control values in a register, using the portable arithmetic of
+    // 'bdlc::FlatHashTable_GroupControl'.  The result of a match is a mask
+    // having the most significant bit of each byte of a matching slot set.
+
+    // PUBLIC TYPES
+    typedef bsls::AtomicOperations::AtomicTypes::Uint64 Word;
+        // Type of the words of the arrays.
+
+    typedef bsl::uint64_t                               Group;
+        // Type of the value of a group of control values, or of a mask
+        // resulting from matching them.
+
+    // PUBLIC CLASS DATA
+    static const bsl::size_t  k_BYTES_PER_WORD = 8;
+
+    static const bsl::size_t  k_GROUP_SIZE     = k_BYTES_PER_WORD;
+
+    static const bsl::uint8_t k_EMPTY  = bdlc::FlatHashTable_GroupControl::
+                                                                       k_EMPTY;
+    static const bsl::uint8_t k_ERASED = bdlc::FlatHashTable_GroupControl::
+                                                                      k_ERASED;
+
+    // PUBLIC DATA
+    Word                        *d_controls_p;         // control values,
+                                                       // 'k_GROUP_SIZE' per
+                                                       // word
+
+    Word                        *d_entries_p;          // entries,
+                                                       // 'd_entryWords' words
+                                                       // per slot
+
+    bsl::size_t                  d_capacity;           // number of slots, a
+                                                       // power of two
+
+    bsl::size_t                  d_entryWords;         // number of words of
+                                                       // an entry
+
+    int                          d_groupControlShift;  // shift of a hash
+                                                       // value yielding the
+                                                       // index of its first
+                                                       // group
+
+    ConcurrentFlatHashMap_Table *d_next_p;             // next retired table
+
+    // CLASS METHODS
+    static ConcurrentFlatHashMap_Table *create(
+                                          bsl::size_t       capacity,
+                                          bsl::size_t       entryWords,
+                                          bslma::Allocator *basicAllocator);
+        // Return the address of a newly created table having the specified
+        // 'capacity' slots, all of them empty, and entries of the specified
+        // 'entryWords' words, using the specified 'basicAllocator' to supply
+        // memory.  The behavior is undefined unless 'capacity' is a power of
+        // two that is at least '2 * k_GROUP_SIZE', and '0 < entryWords'.
+
+    static void deleteTable(ConcurrentFlatHashMap_Table *table,
+                            bslma::Allocator            *basicAllocator);
+        // Destroy the specified 'table' and return its memory to the specified
+        // 'basicAllocator', which must have been used to create 'table'.
+
+    static int firstMatch(Group mask);
+        // Return the offset, in its group, of the first slot matched in the
+        // specified 'mask'.  The behavior is undefined unless 'mask' is a
+        // non-zero result of a match.
+
+    static Group matchAvailable(Group group);
+        // Return the mask of the slots of the specified 'group' that are
+        // empty or erased.
+
+    static Group matchEmpty(Group group);
+        // Return the mask of the slots of the specified 'group' that are
+        // empty.
+
+    static Group matchHashlet(Group group, bsl::uint8_t hashlet);
+        // Return the mask of the slots of the specified 'group' that are in
+        // use by elements having the specified 'hashlet'.  The behavior is
+        // undefined unless 'hashlet <= 0x7f'.
+
+    static Group matchInUse(Group group);
+        // Return the mask of the slots of the specified 'group' that are in
+        // use.
+
+    static Group nextMatch(Group mask);
+        // Return the specified 'mask' without its first matched slot.
+
+    // MANIPULATORS
+    void clear();
+        // Mark every slot of this table as empty.
+
+    void setControl(bsl::size_t index, bsl::uint8_t value);
+        // Set the control value of the slot at the specified 'index' to the
+        // specified 'value'.  The behavior is undefined unless
+        // 'index < d_capacity', and the calling thread is the only one
+        // modifying this table.
+
+    void storeEntry(bsl::size_t index, const void *entry);
+        // Store the 'd_entryWords' words at the specified 'entry' into the
+        // slot at the specified 'index'.  The behavior is undefined unless
+        // 'index < d_capacity', 'entry' is aligned to 8 bytes, and the
+        // calling thread is the only one modifying this table.
+
+    // ACCESSORS
+    bsl::uint8_t control(bsl::size_t index) const;
+        // Return the control value of the slot at the specified 'index'.  The
+        // behavior is undefined unless 'index < d_capacity', and the calling
+        // thread is the only one modifying this table.
+
+    bsl::size_t groupIndex(bsl::size_t hashValue) const;
+        // Return the index of the first slot of the first group of the probe
+        // sequence of the specified 'hashValue'.
+
+    void loadEntry(void *entry, bsl::size_t index) const;
+        // Load into the specified 'entry' the 'd_entryWords' words of the
+        // slot at the specified 'index'.  The behavior is undefined unless
+        // 'index < d_capacity', and 'entry' is aligned to 8 bytes.
+
+    Group loadGroup(bsl::size_t index) const;
+        // Return the control values of the group starting at the specified
+        // 'index'.  The behavior is undefined unless 'index' is a multiple of
+        // 'k_GROUP_SIZE' and 'index < d_capacity'.
+};
+
+                     // ==================================
+                     // struct ConcurrentFlatHashMap_Shard
+                     // ==================================
+
+struct ConcurrentFlatHashMap_Shard {
+    // This component-private 'struct' holds one shard of a
+    // 'ConcurrentFlatHashMap': its current table, the previous table from
+    // which elements are being migrated (if any), the sequence lock guarding
+    // both, and the state used by the writers of the shard.
+
+    // PUBLIC TYPES
+    typedef ConcurrentFlatHashMap_Table Table;
+
+    // PUBLIC DATA
+    bsls::AtomicUint           d_sequence;     // odd while the shard is
+                                               // modified
+
+    bsls::AtomicPointer<Table> d_current;      // table receiving new
+                                               // elements, or 0 if the shard
+                                               // has never held an element
+
+    bsls::AtomicPointer<Table> d_previous;     // table being migrated, or 0
+
+    bsls::AtomicUint64         d_size;         // number of elements
+
+    bslmt::Mutex               d_mutex;        // serializes modifications
+
+    bsl::size_t                d_numUsed;      // slots of 'd_current' in use
+                                               // or erased
+
+    bsl::size_t                d_numMigrated;  // groups of 'd_previous'
+                                               // already migrated
+
+    bsl::size_t                d_migrationGroups;
+                                               // groups of 'd_previous'
+                                               // migrated by each
+                                               // modification
+
+    Table                     *d_retired_p;    // tables replaced by larger
+                                               // ones, deallocated with the
+                                               // shard
+
+    bslma::Allocator          *d_allocator_p;  // memory allocator (held, not
+                                               // owned)
+
+    char                       d_pad[bslmt::Platform::e_CACHE_LINE_SIZE];
+                                               // keeps the sequence lock of
+                                               // other shards on a separate
+                                               // cache line
+
+    // CREATORS
+    explicit ConcurrentFlatHashMap_Shard(bslma::Allocator *basicAllocator);
+        // Create an empty shard that uses the specified 'basicAllocator' to
+        // supply memory.
+
+    ~ConcurrentFlatHashMap_Shard();
+        // Destroy this shard and all its tables.
+
+    // MANIPULATORS
+    void beginWrite();
+        // Mark this shard as being modified, so that the concurrent reads of
+        // the shard are retried.  The behavior is undefined unless the
+        // calling thread holds 'd_mutex', and this shard is not already
+        // marked as being modified.
+
+    void endWrite();
+        // Mark this shard as no longer being modified.  The behavior is
+        // undefined unless the calling thread holds 'd_mutex', and this shard
+        // is marked as being modified.
+
+    void retirePrevious();
+        // Retire the previous table of this shard, to be deallocated with
+        // this shard, and reset the previous table to 0.  The behavior is
+        // undefined unless the calling thread holds 'd_mutex', and this shard
+        // is marked as being modified.
+};
+
+                        // ===========================
+                        // class ConcurrentFlatHashMap
+                        // ===========================
+
+template <class KEY,
+          class VALUE,
+          class HASH  = bslh::FibonacciBadHashWrapper<bsl::hash<KEY> >,
+          class EQUAL = bsl::equal_to<KEY> >
+class ConcurrentFlatHashMap {
+    // This class template defines a fully thread-safe container that provides
+    // a mapping from keys (of template parameter type 'KEY') to their
+    // associated mapped values (of template parameter type 'VALUE'), whose
+    // lookups acquire no lock.  'KEY' and 'VALUE' must be trivially copyable,
+    // and have an alignment not exceeding 8 (see
+    // {Requirements on 'KEY' and 'VALUE'}).
+
+#ifdef BSLMF_ISTRIVIALLYCOPYABLE_NATIVE_IMPLEMENTATION
+    // Without native support, 'bsl::is_trivially_copyable' is 'false' for
+    // 'struct' types not declaring the trait, so the requirement is checked
+    // only where it can be detected.
+
+    BSLMF_ASSERT(bsl::is_trivially_copyable<KEY>::value);
+    BSLMF_ASSERT(bsl::is_trivially_copyable<VALUE>::value);
+#endif
+    BSLMF_ASSERT(bsls::AlignmentFromType<KEY>::VALUE   <= 8);
+    BSLMF_ASSERT(bsls::AlignmentFromType<VALUE>::VALUE <= 8);
+
+    // PRIVATE TYPES
+    typedef ConcurrentFlatHashMap_Table Table;
+    typedef ConcurrentFlatHashMap_Shard Shard;
+    typedef Table::Group                Group;
+
+    enum {
+        k_VALUE_ALIGNMENT = bsls::AlignmentFromType<VALUE>::VALUE,
+
+        k_VALUE_OFFSET    = (sizeof(KEY) + k_VALUE_ALIGNMENT - 1)
+                          / k_VALUE_ALIGNMENT
+                          * k_VALUE_ALIGNMENT,
+                                          // offset of the value in an entry
+
+        k_ENTRY_WORDS     = (k_VALUE_OFFSET + sizeof(VALUE)
+                                            + Table::k_BYTES_PER_WORD - 1)
+                          / Table::k_BYTES_PER_WORD
+                                          // number of words of an entry
+    };
+
+    typedef bsls::AlignedBuffer<k_ENTRY_WORDS * Table::k_BYTES_PER_WORD, 8>
+                                        EntryBuffer;
+        // Type of a local copy of an entry: a key followed by a value.
+
+    // PRIVATE CLASS DATA
+    static const bsl::size_t  k_MIN_CAPACITY = 2 * Table::k_GROUP_SIZE;
+        // minimum capacity of a table
+
+    static const bsl::size_t  k_MAX_LOAD_FACTOR_NUMERATOR   = 7;
+    static const bsl::size_t  k_MAX_LOAD_FACTOR_DENOMINATOR = 8;
+        // maximum fraction of the slots of a table that are in use or erased
+
+    static const bsl::size_t  k_MIGRATION_GROUPS = 2;
+        // minimum number of groups migrated from the previous table of a
+        // shard by each modification of the shard
+
+    static const int          k_HASHLET_BITS = 7;
+        // number of low-order bits of a hash value stored in a control value
+
+    static const bsl::uint8_t k_HASHLET_MASK = 0x7f;
+
+    static const int          k_SPINS_BEFORE_YIELD = 64;
+        // number of consecutive retries of a lookup before yielding
+
+    // DATA
+    bslma::Allocator                     *d_allocator_p;  // memory allocator
+                                                          // (held, not owned)
+
+    bsl::vector<bsl::shared_ptr<Shard> >  d_shards;       // shards, the
+                                                          // number of which
+                                                          // is a power of two
+
+    bsl::size_t                           d_shardMask;    // 'd_shards.size()
+                                                          // - 1'
+
+    HASH                                  d_hasher;       // hash functor
+
+    EQUAL                                 d_equal;        // equality functor
+
+    // PRIVATE CLASS METHODS
+    static bsl::size_t capacityForSize(bsl::size_t numElements);
+        // Return the minimum capacity of a table that can hold the specified
+        // 'numElements' without exceeding the maximum load factor.
+
+    static const KEY& entryKey(const EntryBuffer& entry);
+        // Return a reference providing non-modifiable access to the key of
+        // the specified 'entry'.
+
+    static bool insertIntoTable(Table             *table,
+                                const EntryBuffer& entry,
+                                bsl::size_t        hashValue);
+        // Store the specified 'entry', whose key has the specified
+        // 'hashValue', in the first available slot of its probe sequence in
+        // the specified 'table'.  Return 'true' if that slot was empty, and
+        // 'false' if it was erased.  The behavior is undefined unless 'table'
+        // has an available slot, the key of 'entry' is not present in
+        // 'table', and the calling thread is the only one modifying 'table'.
+
+    static void makeEntry(EntryBuffer  *entry,
+                          const KEY&    key,
+                          const VALUE&  value);
+        // Load into the specified 'entry' the specified 'key' and 'value'.
+
+    static bsl::size_t maxLoad(bsl::size_t capacity);
+        // Return the maximum number of slots in use or erased of a table
+        // having the specified 'capacity'.
+
+    // PRIVATE MANIPULATORS
+    void eraseAt(Shard *shard, Table *table, bsl::size_t index);
+        // Erase the element at the specified 'index' of the specified 'table'
+        // of the specified 'shard'.  The behavior is undefined unless the
+        // calling thread holds the mutex of 'shard', 'shard' is marked as
+        // being modified, and the slot at 'index' is in use.
+
+    void grow(Shard *shard, bsl::size_t minimumCapacity);
+        // Complete any migration in progress in the specified 'shard' and, if
+        // the current table of 'shard' has at least the specified
+        // 'minimumCapacity' and can hold twice the number of elements of
+        // 'shard', purge its erased slots (see 'purge').  Otherwise, replace
+        // the current table of 'shard' with a larger empty table having at
+        // least 'minimumCapacity', from which new elements are looked up
+        // before the previous table, and into which the elements of the
+        // previous table are then gradually migrated.  The behavior is
+        // undefined unless the calling thread holds the mutex of 'shard', and
+        // 'shard' is not marked as being modified.
+
+    void migrate(Shard *shard, bsl::size_t numGroups);
+        // Move the elements of up to the specified 'numGroups' groups of the
+        // previous table of the specified 'shard', if any, into its current
+        // table, and retire the previous table if it no longer contains any
+        // element.  The behavior is undefined unless the calling thread holds
+        // the mutex of 'shard', and 'shard' is marked as being modified.
+
+    void purge(Shard *shard);
+        // Remove the erased slots of the current table of the specified
+        // 'shard' by reinserting its elements into the same table, while
+        // 'shard' is marked as being modified.  The behavior is undefined
+        // unless the calling thread holds the mutex of 'shard', 'shard' has a
+        // current table and no previous table, and 'shard' is not marked as
+        // being modified.
+
+    // PRIVATE ACCESSORS
+    bsl::size_t findInTable(EntryBuffer       *entry,
+                            const Table&       table,
+                            const KEY&         key,
+                            bsl::size_t        hashValue) const;
+        // Return the index of the slot of the specified 'table' holding the
+        // specified 'key', having the specified 'hashValue', and load that
+        // slot into the specified 'entry', or return 'table.d_capacity' if
+        // 'key' is not found.  Note that, unless the calling thread holds the
+        // mutex of the shard of 'table', the result is meaningful only if the
+        // shard was not modified during the call.
+
+    Shard& shardForHash(bsl::size_t hashValue) const;
+        // Return a reference providing modifiable access to the shard holding
+        // the keys having the specified 'hashValue'.
+
+    // NOT IMPLEMENTED
+    ConcurrentFlatHashMap(const ConcurrentFlatHashMap&);
+    ConcurrentFlatHashMap& operator=(const ConcurrentFlatHashMap&);
+
+  public:
+    // PUBLIC CONSTANTS
+    enum {
+        k_DEFAULT_NUM_SHARDS = 16  // default number of shards
+    };
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(ConcurrentFlatHashMap,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit ConcurrentFlatHashMap(bslma::Allocator *basicAllocator = 0);
+    explicit ConcurrentFlatHashMap(int               numShards,
+                                   bsl::size_t       capacity = 0,
+                                   bslma::Allocator *basicAllocator = 0);
+    ConcurrentFlatHashMap(int               numShards,
+                          bsl::size_t       capacity,
+                          const HASH&       hash,
+                          const EQUAL&      equal,
+                          bslma::Allocator *basicAllocator = 0);
+        // Create an empty map.  Optionally specify the number of shards,
+        // 'numShards', rounded up to a power of two; if 'numShards' is not
+        // specified, 'k_DEFAULT_NUM_SHARDS' is used.  Optionally specify a
+        // 'capacity' indicating the number of elements the map can hold
+        // without being resized (see 'reserve'); if 'capacity' is not
+        // specified, the map is created without storage.  Optionally specify
+        // the 'hash' functor used to generate the hash values of keys, and
+        // the 'equal' functor used to determine whether two keys have the
+        // same value; if they are not specified, default-constructed 'HASH'
+        // and 'EQUAL' functors are used.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless '1 <= numShards <= 65536'.
+
+    //! ~ConcurrentFlatHashMap() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    void clear();
+        // Remove all elements from this map.  Note that the capacity of the
+        // map is not reduced.
+
+    bsl::size_t erase(const KEY& key);
+        // Erase from this map the element having the specified 'key'.  Return
+        // 1 on success and 0 if 'key' does not exist.  Note that the returned
+        // value equals the number of elements removed.
+
+    bsl::size_t insert(const KEY& key, const VALUE& value);
+        // Insert into this map an element having the specified 'key' and
+        // 'value'.  If 'key' already exists in this map, the value attribute
+        // of that element is set to 'value'.  Return 1 if an element is
+        // inserted, and 0 if an existing element is updated.  Note that the
+        // return value equals the number of elements inserted.
+
+    void reserve(bsl::size_t numElements);
+        // Ensure that each shard of this map can hold its share of the
+        // specified 'numElements' without being resized, and complete any
+        // migration in progress in a shard that is resized.  Note that, as
+        // elements are not distributed exactly evenly among the shards, some
+        // shards may still be resized before this map holds 'numElements'.
+
+    // ACCESSORS
+    bsl::size_t capacity() const;
+        // Return the sum of the capacities of the current tables of the shards
+        // of this map.  Note that the value may be obsolete by the time it is
+        // returned.
+
+    bool empty() const;
+        // Return 'true' if this map contains no elements, and 'false'
+        // otherwise.  Note that the value may be obsolete by the time it is
+        // returned.
+
+    EQUAL equalFunction() const;
+        // Return (a copy of) the key-equality functor used by this map.
+
+    bsl::size_t getValue(VALUE *value, const KEY& key) const;
+        // Load, into the specified '*value', the value attribute of the
+        // element in this map having the specified 'key'.  Return 1 on
+        // success and 0 if 'key' does not exist in this map.  This method
+        // acquires no lock (see {Optimistic Reads}).  Note that the return
+        // value equals the number of values returned.
+
+    HASH hashFunction() const;
+        // Return (a copy of) the hash functor used by this map.
+
+    int numShards() const;
+        // Return the number of shards of this map.
+
+    int shardIndex(const KEY& key) const;
+        // Return the index of the shard that holds, or would hold, the
+        // specified 'key'.
+
+    bsl::size_t size() const;
+        // Return the current number of elements in this map.  Note that the
+        // value may be transiently inaccurate while this map is modified
+        // concurrently.
+
+    template <class VISITOR>
+    void visit(VISITOR& visitor) const;
+        // Call the specified 'visitor' for every element of this map, one
+        // shard after the other, until 'visitor' returns 'false'.  The
+        // 'VISITOR' type must be a callable object that can be invoked in the
+        // same way as the function 'bool (const KEY&, const VALUE&)'.  The
+        // modifications of a shard are blocked while its elements are
+        // visited; lookups are not.  The behavior is undefined if 'visitor'
+        // modifies this map.
+
+                               // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this map to supply memory.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                     // ----------------------------------
+                     // struct ConcurrentFlatHashMap_Table
+                     // ----------------------------------
+
+// CLASS METHODS
+inline
+int ConcurrentFlatHashMap_Table::firstMatch(Group mask)
+{
+    BSLS_ASSERT_SAFE(mask);
+
+    return bdlb::BitUtil::numTrailingUnsetBits(mask) / 8;
+}
+
+inline
+ConcurrentFlatHashMap_Table::Group
+ConcurrentFlatHashMap_Table::matchAvailable(Group group)
+{
+    // The control values of the slots not in use have their most significant
+    // bit set.
+
+    return group & 0x8080808080808080ULL;
+}
+
+inline
+ConcurrentFlatHashMap_Table::Group
+ConcurrentFlatHashMap_Table::matchEmpty(Group group)
+{
+    return matchHashlet(group ^ 0x8080808080808080ULL, 0);
+}
+
+inline
+ConcurrentFlatHashMap_Table::Group
+ConcurrentFlatHashMap_Table::matchHashlet(Group group, bsl::uint8_t hashlet)
+{
+    BSLS_ASSERT_SAFE(hashlet <= 0x7f);
+
+    // The bytes of 'value' are 0 for the matching slots.  Adding 0x7f to the
+    // low 7 bits of a byte sets its most significant bit unless they are 0,
+    // so that the most significant bit of a byte of the result is set if and
+    // only if that byte of 'value' is 0.  No carry crosses a byte.
+
+    const Group value = group ^ (0x0101010101010101ULL * hashlet);
+    const Group low   = 0x7f7f7f7f7f7f7f7fULL;
+
+    return ~(((value & low) + low) | value | low);
+}
+
+inline
+ConcurrentFlatHashMap_Table::Group
+ConcurrentFlatHashMap_Table::matchInUse(Group group)
+{
+    return ~group & 0x8080808080808080ULL;
+}
+
+inline
+ConcurrentFlatHashMap_Table::Group
+ConcurrentFlatHashMap_Table::nextMatch(Group mask)
+{
+    return mask & (mask - 1);
+}
+
+// MANIPULATORS
+inline
+void ConcurrentFlatHashMap_Table::setControl(bsl::size_t  index,
+                                             bsl::uint8_t value)
+{
+    BSLS_ASSERT_SAFE(index < d_capacity);
+
+    Word      *word  = d_controls_p + index / k_GROUP_SIZE;
+    const int  shift = static_cast<int>(index % k_GROUP_SIZE) * 8;
+
+    const Group group = bsls::AtomicOperations::getUint64Relaxed(word);
+    const Group mask  = static_cast<Group>(0xff) << shift;
+
+    bsls::AtomicOperations::setUint64Release(
+                                     word,
+                                     (group & ~mask)
+                                   | (static_cast<Group>(value) << shift));
+}
+
+inline
+void ConcurrentFlatHashMap_Table::storeEntry(bsl::size_t  index,
+                                             const void  *entry)
+{
+    BSLS_ASSERT_SAFE(index < d_capacity);
+
+    Word                      *words = d_entries_p + index * d_entryWords;
+    const bsls::Types::Uint64 *bits  =
+                               static_cast<const bsls::Types::Uint64 *>(entry);
+
+    for (bsl::size_t i = 0; i < d_entryWords; ++i) {
+        bsls::AtomicOperations::setUint64Release(words + i, bits[i]);
+    }
+}
+
+// ACCESSORS
+inline
+bsl::uint8_t ConcurrentFlatHashMap_Table::control(bsl::size_t index) const
+{
+    BSLS_ASSERT_SAFE(index < d_capacity);
+
+    const Group group = bsls::AtomicOperations::getUint64Relaxed(
+                                          d_controls_p + index / k_GROUP_SIZE);
+
+    return static_cast<bsl::uint8_t>(group >> (index % k_GROUP_SIZE * 8));
+}
+
+inline
+bsl::size_t ConcurrentFlatHashMap_Table::groupIndex(
+                                                  bsl::size_t hashValue) const
+{
+    return (hashValue >> d_groupControlShift) * k_GROUP_SIZE;
+}
+
+inline
+void ConcurrentFlatHashMap_Table::loadEntry(void        *entry,
+                                            bsl::size_t  index) const
+{
+    BSLS_ASSERT_SAFE(index < d_capacity);
+
+    const Word          *words = d_entries_p + index * d_entryWords;
+    bsls::Types::Uint64 *bits  = static_cast<bsls::Types::Uint64 *>(entry);
+
+    for (bsl::size_t i = 0; i < d_entryWords; ++i) {
+        bits[i] = bsls::AtomicOperations::getUint64Acquire(words + i);
+    }
+}
+
+inline
+ConcurrentFlatHashMap_Table::Group
+ConcurrentFlatHashMap_Table::loadGroup(bsl::size_t index) const
+{
+    BSLS_ASSERT_SAFE(0 == index % k_GROUP_SIZE);
+    BSLS_ASSERT_SAFE(index < d_capacity);
+
+    return bsls::AtomicOperations::getUint64Acquire(
+                                          d_controls_p + index / k_GROUP_SIZE);
+}
+
+                     // ----------------------------------
+                     // struct ConcurrentFlatHashMap_Shard
+                     // ----------------------------------
+
+// MANIPULATORS
+inline
+void ConcurrentFlatHashMap_Shard::beginWrite()
+{
+    BSLS_ASSERT_SAFE(0 == (d_sequence.loadRelaxed() & 1));
+
+    // The words subsequently modified are stored with release semantics,
+    // which orders this store before them; release semantics are not needed
+    // here, but cost nothing on common platforms.
+
+    d_sequence.storeRelease(d_sequence.loadRelaxed() + 1);
+}
+
+inline
+void ConcurrentFlatHashMap_Shard::endWrite()
+{
+    BSLS_ASSERT_SAFE(1 == (d_sequence.loadRelaxed() & 1));
+
+    d_sequence.storeRelease(d_sequence.loadRelaxed() + 1);
+}
+
+                        // ---------------------------
+                        // class ConcurrentFlatHashMap
+                        // ---------------------------
+
+// PRIVATE CLASS METHODS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t ConcurrentFlatHashMap<KEY, VALUE, HASH, EQUAL>::capacityForSize(
+                                                       bsl::size_t numElements)
+{
+    const bsl::size_t minimum = (numElements * k_MAX_LOAD_FACTOR_DENOMINATOR
+                                             + k_MAX_LOAD_FACTOR_NUMERATOR - 1)
+                              / k_MAX_LOAD_FACTOR_NUMERATOR;
+
+    return minimum > k_MIN_CAPACITY
+           ? static_cast<bsl::size_t>(bdlb::BitUtil::roundUpToBinaryPower(
+                                          static_cast<bsl::uint64_t>(minimum)))
+           : k_MIN_CAPACITY;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+const KEY& ConcurrentFlatHashMap<KEY, VALUE, HASH, EQUAL>::entryKey(
+                                                    const EntryBuffer& entry)
+{
+    return *reinterpret_cast<const KEY *>(entry.buffer());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bool ConcurrentFlatHashMap<KEY, VALUE, HASH, EQUAL>::insertIntoTable(
+                                                 Table             *table,
+                                                 const EntryBuffer& entry,
+                                                 bsl::size_t        hashValue)
+{
+    bsl::size_t index = table->groupIndex(hashValue);
+
+    for (bsl::size_t i = 0; i < table->d_capacity; i += Table::k_GROUP_SIZE) {
+        const Group available = Table::matchAvailable(table->loadGroup(index));
+        if (available) {
+            index += Table::firstMatch(available);
+            break;
+        }
+
+        index = (index + Table::k_GROUP_SIZE) & (table->d_capacity - 1);
+    }
+
+    BSLS_ASSERT(Table::k_EMPTY  == table->control(index)
+             || Table::k_ERASED == table->control(index));
+
+    const bool wasEmpty = Table::k_EMPTY == table->control(index);
+
+    table->storeEntry(index, entry.buffer());
+    table->setControl(index,
+                      static_cast<bsl::uint8_t>(hashValue & k_HASHLET_MASK));
+
+    return wasEmpty;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void ConcurrentFlatHashMap<KEY, VALUE, HASH, EQUAL>::makeEntry(
+                                                      EntryBuffer  *entry,
+                                                      const KEY&    key,
+                                                      const VALUE&  value)
+{
+    bsl::memset(entry->buffer(), 0, sizeof(EntryBuffer));
+    bsl::memcpy(entry->buffer(), &key, sizeof(KEY));
+    bsl::memcpy(entry->buffer() + k_VALUE_OFFSET, &value, sizeof(VALUE));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t ConcurrentFlatHashMap<KEY, VALUE, HASH, EQUAL>::maxLoad(
+                                                          bsl::size_t capacity)
+{
+    return capacity / k_MAX_LOAD_FACTOR_DENOMINATOR
+                    * k_MAX_LOAD_FACTOR_NUMERATOR;
+}
+
+// PRIVATE MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ConcurrentFlatHashMap<KEY, VALUE, HASH, EQUAL>::eraseAt(
+                                                        Shard       *shard,
+                                                        Table       *table,
+                                                        bsl::size_t  index)
+{
+    // A group that has an empty slot has always had one, so no probe sequence
+    // continues past it, and the erased slot can be made empty.
+
+    const bsl::size_t groupStart = index - index % Table::k_GROUP_SIZE;
+
+    if (Table::matchEmpty(table->loadGroup(groupStart))) {
+        table->setControl(index, Table::k_EMPTY);
+        if (table == shard->d_current.loadRelaxed()) {
+            --shard->d_numUsed;
+        }
+    }
+    else {
+        table->setControl(index, Table::k_ERASED);
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ConcurrentFlatHashMap<KEY, VALUE, HASH, EQUAL>::grow(
+                                           Shard       *shard,
+                                           bsl::size_t  minimumCapacity)
+{
+    if (shard->d_previous.loadRelaxed()) {
+        shard->beginWrite();
+        migrate(shard, shard->d_previous.loadRelaxed()->d_capacity);
+        shard->endWrite();
+    }
+
+    const bsl::size_t size     = shard->d_size.loadRelaxed();
+    bsl::size_t       capacity = capacityForSize(2 * size);
+    if (capacity < minimumCapacity) {
+        capacity = minimumCapacity;
+    }
+
+    // Capacities are powers of two, so a table replacing the current one is
+    // at least twice as large, which bounds the storage retired by growth.
+
+    Table *current = shard->d_current.loadRelaxed();
+    if (current && capacity <= current->d_capacity) {
+        purge(shard);
+        return;                                                       // RETURN
+    }
+
+    // The new table is allocated and initialized before the shard is marked
+    // as being modified, so that lookups proceed in the meantime.
+
+    Table *table = Table::create(capacity, k_ENTRY_WORDS, d_allocator_p);
+
+    shard->beginWrite();
+    shard->d_previous.storeRelease(current);
+    shard->d_current.storeRelease(table);
+    shard->endWrite();
+
+    // The elements of the previous table are migrated at a rate ensuring
+    // that the migration completes within 'size / 2 + 1' modifications of the
+    // shard, so that the new table, which can hold '2 * size' elements, does
+    // not reach its maximum load before the migration completes.
+
+    shard->d_numUsed         = 0;
+    shard->d_numMigrated     = 0;
+    shard->d_migrationGroups = k_MIGRATION_GROUPS;
+
+    Table *previous = shard->d_previous.loadRelaxed();
+    if (previous) {
+        const bsl::size_t numSteps    = size / 2 + 1;
+        const bsl::size_t totalGroups = previous->d_capacity
+                                      / Table::k_GROUP_SIZE;
+        const bsl::size_t rate        = (totalGroups + numSteps - 1)
+                                      / numSteps;
+
+        if (rate > shard->d_migrationGroups) {
+            shard->d_migrationGroups = rate;
+        }
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ConcurrentFlatHashMap<KEY, VALUE, HASH, EQUAL>::migrate(
+                                                Shard       *shard,
+                                                bsl::size_t  numGroups)
+{
+    Table *previous = shard->d_previous.loadRelaxed();
+    if (!previous) {
+        return;                                                       // RETURN
+    }
+
+    Table             *current     = shard->d_current.loadRelaxed();
+    const bsl::size_t  totalGroups = previous->d_capacity
+                                   / Table::k_GROUP_SIZE;
+    const bsl::size_t  endGroup    =
+                        numGroups < totalGroups - shard->d_numMigrated
+                        ? shard->d_numMigrated + numGroups
+                        : totalGroups;
+
+    for (bsl::size_t group = shard->d_numMigrated;
+         group < endGroup;
+         ++group) {
+        const bsl::size_t index      = group * Table::k_GROUP_SIZE;
+        Group             candidates = Table::matchInUse(
+                                                   previous->loadGroup(index));
+
+        while (candidates) {
+            const int offset = Table::firstMatch(candidates);
+
+            EntryBuffer entry;
+            previous->loadEntry(entry.buffer(), index + offset);
+
+            BSLS_ASSERT(shard->d_numUsed < current->d_capacity);
+
+            if (insertIntoTable(current, entry, d_hasher(entryKey(entry)))) {
+                ++shard->d_numUsed;
+            }
+            previous->setControl(index + offset, Table::k_ERASED);
+
+            candidates = Table::nextMatch(candidates);
+        }
+    }
+
+    shard->d_numMigrated = endGroup;
+
+    if (endGroup == totalGroups) {
+        shard->retirePrevious();
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ConcurrentFlatHashMap<KEY, VALUE, HASH, EQUAL>::purge(Shard *shard)
+{
+    Table *current = shard->d_current.loadRelaxed();
+
+    BSLS_ASSERT(current);
+    BSLS_ASSERT(!shard->d_previous.loadRelaxed());
+
+    // The elements and their hash values are collected before the shard is
+    // marked as being modified, so that lookups are retried only while the
+    // table is cleared and refilled.
+
+    bsl::vector<EntryBuffer> entries(d_allocator_p);
+    bsl::vector<bsl::size_t> hashValues(d_allocator_p);
+    entries.reserve(static_cast<bsl::size_t>(shard->d_size.loadRelaxed()));
+    hashValues.reserve(entries.capacity());
+
+    for (bsl::size_t index = 0;
+         index < current->d_capacity;
+         index += Table::k_GROUP_SIZE) {
+        Group candidates = Table::matchInUse(current->loadGroup(index));
+
+        while (candidates) {
+            EntryBuffer entry;
+            current->loadEntry(entry.buffer(),
+                               index + Table::firstMatch(candidates));
+
+            entries.push_back(entry);
+            hashValues.push_back(d_hasher(entryKey(entry)));
+
+            candidates = Table::nextMatch(candidates);
+        }
+    }
+
+    shard->beginWrite();
+    current->clear();
+    for (bsl::size_t i = 0; i < entries.size(); ++i) {
+        insertIntoTable(current, entries[i], hashValues[i]);
+    }
+    shard->endWrite();
+
+    shard->d_numUsed = entries.size();
+}
+
+// PRIVATE ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t ConcurrentFlatHashMap<KEY, VALUE, HASH, EQUAL>::findInTable(
+                                            EntryBuffer       *entry,
+                                            const Table&       table,
+                                            const KEY&         key,
+                                            bsl::size_t        hashValue) const
+{
+    bsl::size_t        index   = table.groupIndex(hashValue);
+    const bsl::uint8_t hashlet = static_cast<bsl::uint8_t>(
+                                                   hashValue & k_HASHLET_MASK);
+
+    for (bsl::size_t i = 0; i < table.d_capacity; i += Table::k_GROUP_SIZE) {
+        const Group group      = table.loadGroup(index);
+        Group       candidates = Table::matchHashlet(group, hashlet);
+
+        while (candidates) {
+            const int offset = Table::firstMatch(candidates);
+
+            table.loadEntry(entry->buffer(), index + offset);
+
+            if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                                             d_equal(entryKey(*entry), key))) {
+                return index + offset;                                // RETURN
+            }
+            candidates = Table::nextMatch(candidates);
+        }
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(Table::matchEmpty(group))) {
+            break;
+        }
+
+        index = (index + Table::k_GROUP_SIZE) & (table.d_capacity - 1);
+    }
+    return table.d_capacity;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename ConcurrentFlatHashMap<KEY, VALUE, HASH, EQUAL>::Shard&
+ConcurrentFlatHashMap<KEY, VALUE, HASH, EQUAL>::shardForHash(
+                                                   bsl::size_t hashValue) const
+{
+    // The low-order bits of the hash value form the hashlet, and its
+    // high-order bits select the first group of the probe sequence; the
+    // shard is selected from the bits just above the hashlet.
+
+    return *d_shards[(hashValue >> k_HASHLET_BITS) & d_shardMask];
+}
+
+// CREATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+ConcurrentFlatHashMap<KEY, VALUE, HASH, EQUAL>::ConcurrentFlatHashMap(
+                                              bslma::Allocator *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_shards(d_allocator_p)
+, d_shardMask(k_DEFAULT_NUM_SHARDS - 1)
+, d_hasher()
+, d_equal()
+{
+    d_shards.reserve(k_DEFAULT_NUM_SHARDS);
+    for (int i = 0; i < k_DEFAULT_NUM_SHARDS; ++i) {
+        bsl::shared_ptr<Shard> shard;
+        shard.createInplace(d_allocator_p, d_allocator_p);
+        d_shards.push_back(shard);
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+ConcurrentFlatHashMap<KEY, VALUE, HASH, EQUAL>::ConcurrentFlatHashMap(
+                                              int               numShards,
+                                              bsl::size_t       capacity,
+                                              bslma::Allocator *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_shards(d_allocator_p)
+, d_shardMask(0)
+, d_hasher()
+, d_equal()
+{
+    BSLS_ASSERT(1 <= numShards);
+    BSLS_ASSERT(numShards <= 65536);
+
+    const bsl::size_t count = bdlb::BitUtil::roundUpToBinaryPower(
+                                   static_cast<bdlb::BitUtil::uint32_t>(
+                                                                  numShards));
+
+    d_shards.reserve(count);
+    for (bsl::size_t i = 0; i < count; ++i) {
+        bsl::shared_ptr<Shard> shard;
+        shard.createInplace(d_allocator_p, d_allocator_p);
+        d_shards.push_back(shard);
+    }
+    d_shardMask = count - 1;
+
+    if (capacity) {
+        reserve(capacity);
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+ConcurrentFlatHashMap<KEY, VALUE, HASH, EQUAL>::ConcurrentFlatHashMap(
+                                              int               numShards,
+                                              bsl::size_t       capacity,
+                                              const HASH&       hash,
+                                              const EQUAL&      equal,
+                                              bslma::Allocator *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_shards(d_allocator_p)
+, d_shardMask(0)
+, d_hasher(hash)
+, d_equal(equal)
+{
+    BSLS_ASSERT(1 <= numShards);
+    BSLS_ASSERT(numShards <= 65536);
+
+    const bsl::size_t count = bdlb::BitUtil::roundUpToBinaryPower(
+                                   static_cast<bdlb::BitUtil::uint32_t>(
+                                                                  numShards));
+
+    d_shards.reserve(count);
+    for (bsl::size_t i = 0; i < count; ++i) {
+        bsl::shared_ptr<Shard> shard;
+        shard.createInplace(d_allocator_p, d_allocator_p);
+        d_shards.push_back(shard);
+    }
+    d_shardMask = count - 1;
+
+    if (capacity) {
+        reserve(capacity);
+    }
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ConcurrentFlatHashMap<KEY, VALUE, HASH, EQUAL>::clear()
+{
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        Shard& shard = *d_shards[i];
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&shard.d_mutex);
+
+        Table *current = shard.d_current.loadRelaxed();
+        if (!current) {
+            continue;                                               // CONTINUE
+        }
+
+        shard.beginWrite();
+        if (shard.d_previous.loadRelaxed()) {
+            shard.retirePrevious();
+        }
+        current->clear();
+        shard.endWrite();
+
+        shard.d_numUsed     = 0;
+        shard.d_numMigrated = 0;
+        shard.d_size.storeRelaxed(0);
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t ConcurrentFlatHashMap<KEY, VALUE, HASH, EQUAL>::erase(
+                                                                const KEY& key)
+{
+    const bsl::size_t hashValue = d_hasher(key);
+    Shard&            shard     = shardForHash(hashValue);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&shard.d_mutex);
+
+    Table *tables[2] = { shard.d_current.loadRelaxed(),
+                         shard.d_previous.loadRelaxed() };
+
+    for (int i = 0; i < 2 && tables[i]; ++i) {
+        EntryBuffer       entry;
+        const bsl::size_t index = findInTable(&entry,
+                                              *tables[i],
+                                              key,
+                                              hashValue);
+        if (index != tables[i]->d_capacity) {
+            shard.beginWrite();
+            eraseAt(&shard, tables[i], index);
+            migrate(&shard, shard.d_migrationGroups);
+            shard.endWrite();
+
+            shard.d_size.storeRelaxed(shard.d_size.loadRelaxed() - 1);
+            return 1;                                                 // RETURN
+        }
+    }
+    return 0;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t ConcurrentFlatHashMap<KEY, VALUE, HASH, EQUAL>::insert(
+                                                          const KEY&   key,
+                                                          const VALUE& value)
+{
+    const bsl::size_t hashValue = d_hasher(key);
+    Shard&            shard     = shardForHash(hashValue);
+
+    EntryBuffer newEntry;
+    makeEntry(&newEntry, key, value);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&shard.d_mutex);
+
+    Table *tables[2] = { shard.d_current.loadRelaxed(),
+                         shard.d_previous.loadRelaxed() };
+
+    for (int i = 0; i < 2 && tables[i]; ++i) {
+        EntryBuffer       entry;
+        const bsl::size_t index = findInTable(&entry,
+                                              *tables[i],
+                                              key,
+                                              hashValue);
+        if (index != tables[i]->d_capacity) {
+            shard.beginWrite();
+            tables[i]->storeEntry(index, newEntry.buffer());
+            migrate(&shard, shard.d_migrationGroups);
+            shard.endWrite();
+
+            return 0;                                                 // RETURN
+        }
+    }
+
+    if (!tables[0] || shard.d_numUsed >= maxLoad(tables[0]->d_capacity)) {
+        grow(&shard, 0);
+    }
+
+    shard.beginWrite();
+    migrate(&shard, shard.d_migrationGroups);
+
+    Table *current = shard.d_current.loadRelaxed();
+
+    BSLS_ASSERT(shard.d_numUsed < current->d_capacity);
+
+    if (insertIntoTable(current, newEntry, hashValue)) {
+        ++shard.d_numUsed;
+    }
+    shard.endWrite();
+
+    shard.d_size.storeRelaxed(shard.d_size.loadRelaxed() + 1);
+    return 1;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ConcurrentFlatHashMap<KEY, VALUE, HASH, EQUAL>::reserve(
+                                                       bsl::size_t numElements)
+{
+    const bsl::size_t numPerShard = (numElements + d_shardMask)
+                                  / (d_shardMask + 1);
+    const bsl::size_t capacity    = capacityForSize(numPerShard);
+
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        Shard& shard = *d_shards[i];
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&shard.d_mutex);
+
+        Table *current = shard.d_current.loadRelaxed();
+        if (!current || current->d_capacity < capacity) {
+            grow(&shard, capacity);
+        }
+    }
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t ConcurrentFlatHashMap<KEY, VALUE, HASH, EQUAL>::capacity() const
+{
+    bsl::size_t result = 0;
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        const Table *current = d_shards[i]->d_current.loadAcquire();
+        if (current) {
+            result += current->d_capacity;
+        }
+    }
+    return result;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool ConcurrentFlatHashMap<KEY, VALUE, HASH, EQUAL>::empty() const
+{
+    return 0 == size();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+EQUAL ConcurrentFlatHashMap<KEY, VALUE, HASH, EQUAL>::equalFunction() const
+{
+    return d_equal;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t ConcurrentFlatHashMap<KEY, VALUE, HASH, EQUAL>::getValue(
+                                                        VALUE      *value,
+                                                        const KEY&  key) const
+{
+    BSLS_ASSERT(value);
+
+    const bsl::size_t hashValue = d_hasher(key);
+    Shard&            shard     = shardForHash(hashValue);
+
+    EntryBuffer entry;
+    bool        found = false;
+
+    for (int numAttempts = 1; ; ++numAttempts) {
+        const unsigned int sequence = shard.d_sequence.loadAcquire();
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(sequence & 1)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+            if (0 == numAttempts % k_SPINS_BEFORE_YIELD) {
+                bslmt::ThreadUtil::yield();
+            }
+            continue;                                               // CONTINUE
+        }
+
+        const Table *table = shard.d_current.loadAcquire();
+
+        found = false;
+        if (table) {
+            found = findInTable(&entry, *table, key, hashValue)
+                                                         != table->d_capacity;
+            if (!found) {
+                table = shard.d_previous.loadAcquire();
+                if (table) {
+                    found = findInTable(&entry, *table, key, hashValue)
+                                                         != table->d_capacity;
+                }
+            }
+        }
+
+        // The words of the shard are loaded with acquire semantics, so this
+        // load cannot be performed before them; its own acquire semantics
+        // are not needed, but cost nothing on common platforms.
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                                 sequence == shard.d_sequence.loadAcquire())) {
+            break;
+        }
+
+        if (0 == numAttempts % k_SPINS_BEFORE_YIELD) {
+            bslmt::ThreadUtil::yield();
+        }
+    }
+
+    if (found) {
+        bsl::memcpy(static_cast<void *>(value),
+                    entry.buffer() + k_VALUE_OFFSET,
+                    sizeof(VALUE));
+    }
+    return found ? 1 : 0;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+HASH ConcurrentFlatHashMap<KEY, VALUE, HASH, EQUAL>::hashFunction() const
+{
+    return d_hasher;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+int ConcurrentFlatHashMap<KEY, VALUE, HASH, EQUAL>::numShards() const
+{
+    return static_cast<int>(d_shards.size());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+int ConcurrentFlatHashMap<KEY, VALUE, HASH, EQUAL>::shardIndex(
+                                                          const KEY& key) const
+{
+    return static_cast<int>((d_hasher(key) >> k_HASHLET_BITS) & d_shardMask);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t ConcurrentFlatHashMap<KEY, VALUE, HASH, EQUAL>::size() const
+{
+    bsl::size_t result = 0;
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        result += static_cast<bsl::size_t>(d_shards[i]->d_size.loadRelaxed());
+    }
+    return result;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class VISITOR>
+void ConcurrentFlatHashMap<KEY, VALUE, HASH, EQUAL>::visit(
+                                                        VISITOR& visitor) const
+{
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        Shard& shard = *d_shards[i];
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&shard.d_mutex);
+
+        const Table *tables[2] = { shard.d_current.loadRelaxed(),
+                                   shard.d_previous.loadRelaxed() };
+
+        for (int t = 0; t < 2 && tables[t]; ++t) {
+            const Table& table = *tables[t];
+
+            for (bsl::size_t index = 0;
+                 index < table.d_capacity;
+                 index += Table::k_GROUP_SIZE) {
+                Group candidates = Table::matchInUse(table.loadGroup(index));
+
+                while (candidates) {
+                    const int offset = Table::firstMatch(candidates);
+
+                    EntryBuffer entry;
+                    table.loadEntry(entry.buffer(), index + offset);
+
+                    if (!visitor(entryKey(entry),
+                                 *reinterpret_cast<const VALUE *>(
+                                          entry.buffer() + k_VALUE_OFFSET))) {
+                        return;                                       // RETURN
+                    }
+                    candidates = Table::nextMatch(candidates);
+                }
+            }
+        }
+    }
+}
+
+                               // Aspects
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bslma::Allocator *
+ConcurrentFlatHashMap<KEY, VALUE, HASH, EQUAL>::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
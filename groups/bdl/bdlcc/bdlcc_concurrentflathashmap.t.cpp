@@ -0,0 +1,1451 @@
+// bdlcc_concurrentflathashmap.t.cpp                                  -*-C++-*-
+#include <bdlcc_concurrentflathashmap.h>
+
+#include <bdlcc_stripedunorderedmap.h>
+
+#include <bdlb_random.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bslmt_threadutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_review.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_map.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test defines a container,
+// 'bdlcc::ConcurrentFlatHashMap', whose lookups are optimistic, and whose
+// shards are resized incrementally.
+// We first verify the single-threaded behavior of the map against an oracle
+// ('bsl::map'), for entries of various sizes, with well-distributed and
+// colliding hash values, and at every step of the migration of a resized
+// shard.  We then verify that lookups concurrent with modifications never
+// observe a torn value, and always find the keys that are not modified.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] ConcurrentFlatHashMap(bslma::Allocator *basicAllocator = 0);
+// [ 2] ConcurrentFlatHashMap(int numShards, size_t capacity = 0, alloc = 0);
+// [ 2] ConcurrentFlatHashMap(numShards, capacity, hash, equal, alloc = 0);
+// [ 2] ~ConcurrentFlatHashMap();
+//
+// MANIPULATORS
+// [ 6] void clear();
+// [ 3] bsl::size_t erase(const KEY& key);
+// [ 3] bsl::size_t insert(const KEY& key, const VALUE& value);
+// [ 6] void reserve(bsl::size_t numElements);
+//
+// ACCESSORS
+// [ 2] bsl::size_t capacity() const;
+// [ 3] bool empty() const;
+// [ 2] EQUAL equalFunction() const;
+// [ 3] bsl::size_t getValue(VALUE *value, const KEY& key) const;
+// [ 2] HASH hashFunction() const;
+// [ 2] int numShards() const;
+// [ 2] int shardIndex(const KEY& key) const;
+// [ 3] bsl::size_t size() const;
+// [ 6] void visit(VISITOR& visitor) const;
+// [ 2] bslma::Allocator *allocator() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] INCREMENTAL RESIZING
+// [ 5] COLLIDING HASH VALUES
+// [ 7] CONCURRENCY
+// [ 8] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST: CONCURRENT LOOKUPS
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+bool             verbose;
+bool         veryVerbose;
+bool     veryVeryVerbose;
+bool veryVeryVeryVerbose;
+
+typedef bdlcc::ConcurrentFlatHashMap<int, int> Obj;
+
+typedef bslh::FibonacciBadHashWrapper<bsl::hash<int> > IntHash;
+
+// ============================================================================
+//                       HELPER FUNCTIONS AND CLASSES
+// ----------------------------------------------------------------------------
+
+struct Symbol {
+    // This 'struct' provides a key of 12 bytes, so that an entry holding it
+    // spans several words.
+
+    // DATA
+    char d_name[12];
+};
+
+struct SymbolHash {
+    // This 'struct' provides a hash functor for 'Symbol' objects.
+
+    // ACCESSORS
+    bsl::size_t operator()(const Symbol& key) const
+        // Return a hash value for the specified 'key'.
+    {
+        bsls::Types::Uint64 result = 14695981039346656037ULL;
+        for (int i = 0; i < 12; ++i) {
+            result = (result ^ static_cast<unsigned char>(key.d_name[i]))
+                   * 1099511628211ULL;
+        }
+        return static_cast<bsl::size_t>(result ^ (result >> 29));
+    }
+};
+
+struct SymbolEqual {
+    // This 'struct' provides an equality functor for 'Symbol' objects.
+
+    // ACCESSORS
+    bool operator()(const Symbol& lhs, const Symbol& rhs) const
+        // Return 'true' if the specified 'lhs' and 'rhs' have the same value,
+        // and 'false' otherwise.
+    {
+        return 0 == bsl::memcmp(lhs.d_name, rhs.d_name, sizeof lhs.d_name);
+    }
+};
+
+struct Checked {
+    // This 'struct' provides a value spanning two words, the second of which
+    // is the complement of the first, so that a torn copy can be detected.
+
+    // DATA
+    bsls::Types::Uint64 d_value;
+    bsls::Types::Uint64 d_check;
+};
+
+Checked makeChecked(bsls::Types::Uint64 value)
+    // Return a 'Checked' object having the specified 'value'.
+{
+    Checked result = { value, ~value };
+    return result;
+}
+
+Symbol makeSymbol(int id)
+    // Return a 'Symbol' object whose name is derived from the specified 'id'.
+{
+    Symbol result;
+    bsl::memset(result.d_name, 0, sizeof result.d_name);
+    for (int i = 0; i < 11 && id; ++i, id /= 10) {
+        result.d_name[i] = static_cast<char>('A' + id % 10);
+    }
+    return result;
+}
+
+template <class KEY>
+struct KeyMaker;
+    // This 'struct' template provides a namespace for a function mapping an
+    // integer to a key of the (template parameter) type 'KEY'.
+
+template <>
+struct KeyMaker<int> {
+    static int make(int id)
+        // Return the key corresponding to the specified 'id'.
+    {
+        return id;
+    }
+};
+
+template <>
+struct KeyMaker<Symbol> {
+    static Symbol make(int id)
+        // Return the key corresponding to the specified 'id'.
+    {
+        return makeSymbol(id);
+    }
+};
+
+template <class VALUE>
+struct ValueMaker;
+    // This 'struct' template provides namespace for functions mapping an
+    // integer to a value of the (template parameter) type 'VALUE', and back.
+
+template <>
+struct ValueMaker<int> {
+    static int make(int id)
+        // Return the value corresponding to the specified 'id'.
+    {
+        return id;
+    }
+
+    static int id(int value)
+        // Return the identifier of the specified 'value'.
+    {
+        return value;
+    }
+};
+
+template <>
+struct ValueMaker<Checked> {
+    static Checked make(int id)
+        // Return the value corresponding to the specified 'id'.
+    {
+        return makeChecked(static_cast<bsls::Types::Uint64>(id));
+    }
+
+    static int id(const Checked& value)
+        // Return the identifier of the specified 'value'.
+    {
+        ASSERT(~value.d_value == value.d_check);
+        return static_cast<int>(value.d_value);
+    }
+};
+
+struct ConstantHash {
+    // This 'struct' provides a hash functor whose value is the same for every
+    // key, so that all keys collide.
+
+    // ACCESSORS
+    bsl::size_t operator()(int) const
+        // Return a constant hash value.
+    {
+        return 0x5a;
+    }
+};
+
+struct QuarterHash {
+    // This 'struct' provides a hash functor placing the keys in four classes,
+    // by the value of 'key % 4', whose probe sequences start in different
+    // quarters of a table.  The keys of a class collide.
+
+    // ACCESSORS
+    bsl::size_t operator()(int key) const
+        // Return a hash value for the specified 'key'.
+    {
+        return static_cast<bsl::size_t>(key % 4) << (sizeof(bsl::size_t) * 8
+                                                                         - 2);
+    }
+};
+
+struct SummingVisitor {
+    // This 'struct' provides a visitor summing the values it visits, and
+    // stopping after a limit.
+
+    // DATA
+    bsls::Types::Int64 d_sum;
+    int                d_count;
+    int                d_limit;
+
+    // MANIPULATORS
+    bool operator()(int, int value)
+        // Add the specified 'value' to the sum and return 'true' unless the
+        // limit of visited items is reached.
+    {
+        d_sum += value;
+        return ++d_count < d_limit;
+    }
+};
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void testRandomOperations(int numShards, int numKeys, int numOperations)
+    // Apply the specified 'numOperations' random insertions, updates, and
+    // erasures of keys in the range '[0 .. numKeys)' to a
+    // 'ConcurrentFlatHashMap<KEY, VALUE, HASH, EQUAL>' having the specified
+    // 'numShards', and verify after each operation that the map agrees with a
+    // 'bsl::map' oracle.
+{
+    typedef bdlcc::ConcurrentFlatHashMap<KEY, VALUE, HASH, EQUAL> Map;
+
+    bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+    {
+        Map mX(numShards, 0, HASH(), EQUAL(), &ta);  const Map& X = mX;
+
+        bsl::map<int, int> oracle(&ta);
+
+        int seed = numShards * 7 + numKeys;
+
+        for (int i = 0; i < numOperations; ++i) {
+            const int r  = bdlb::Random::generate15(&seed);
+            const int id = (r * 32768 + bdlb::Random::generate15(&seed))
+                         % numKeys;
+            const KEY key = KeyMaker<KEY>::make(id);
+
+            if (r % 3) {
+                const int          version = i;
+                const bsl::size_t  rc      = mX.insert(
+                                          key,
+                                          ValueMaker<VALUE>::make(version));
+                const bool         isNew   = oracle.find(id) == oracle.end();
+
+                ASSERTV(i, id, rc, isNew, (isNew ? 1u : 0u) == rc);
+                oracle[id] = version;
+            }
+            else {
+                const bsl::size_t rc   = mX.erase(key);
+                const bool        had  = oracle.erase(id) != 0;
+
+                ASSERTV(i, id, rc, had, (had ? 1u : 0u) == rc);
+            }
+
+            ASSERTV(i, oracle.size(), X.size(), oracle.size() == X.size());
+            ASSERTV(i, oracle.empty() == X.empty());
+
+            // Verify a few keys after each operation, and all of them
+            // periodically.
+
+            const int numChecks = 0 == i % 997 ? numKeys : 4;
+            for (int j = 0; j < numChecks; ++j) {
+                const int checkId = numChecks == numKeys
+                                  ? j
+                                  : (id + j * 7919) % numKeys;
+
+                VALUE             value;
+                const bsl::size_t rc = X.getValue(
+                                            &value,
+                                            KeyMaker<KEY>::make(checkId));
+
+                bsl::map<int, int>::const_iterator it = oracle.find(checkId);
+                if (it == oracle.end()) {
+                    ASSERTV(i, checkId, rc, 0 == rc);
+                }
+                else {
+                    ASSERTV(i, checkId, rc, 1 == rc);
+                    if (1 == rc) {
+                        ASSERTV(i, checkId, it->second,
+                                it->second == ValueMaker<VALUE>::id(value));
+                    }
+                }
+            }
+        }
+    }
+    ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+}
+
+                            // ================
+                            // Concurrency Test
+                            // ================
+
+typedef bdlcc::ConcurrentFlatHashMap<int, Checked> CheckedMap;
+
+enum {
+    k_NUM_STABLE_KEYS   = 200,   // keys that are never erased or updated
+    k_NUM_VOLATILE_KEYS = 5000   // keys that writers insert and erase
+};
+
+struct ConcurrencyArg {
+    CheckedMap      *d_map_p;
+    int              d_seed;
+    bsls::AtomicInt *d_done_p;
+    int              d_numLookups;
+};
+
+bsls::Types::Uint64 checkedValue(int key, int version)
+    // Return the value of the element having the specified 'key' and
+    // 'version'.
+{
+    return (static_cast<bsls::Types::Uint64>(key) << 32)
+         | static_cast<unsigned int>(version);
+}
+
+extern "C" void *writerThread(void *v_arg)
+    // Insert, update, and erase random volatile keys in the map held by the
+    // specified 'v_arg', a 'ConcurrencyArg', causing the shards to be
+    // resized.
+{
+    ConcurrencyArg *arg  = static_cast<ConcurrencyArg *>(v_arg);
+    int             seed = arg->d_seed;
+
+    for (int i = 0; i < 60000; ++i) {
+        const int key = k_NUM_STABLE_KEYS
+                      + bdlb::Random::generate15(&seed) % k_NUM_VOLATILE_KEYS;
+
+        if (i % 4) {
+            arg->d_map_p->insert(key, makeChecked(checkedValue(key, i)));
+        }
+        else {
+            arg->d_map_p->erase(key);
+        }
+    }
+    return v_arg;
+}
+
+extern "C" void *readerThread(void *v_arg)
+    // Look up random keys in the map held by the specified 'v_arg', a
+    // 'ConcurrencyArg', until the writers are done, verifying that stable
+    // keys are always found, and that no value found is torn or belongs to
+    // another key.
+{
+    ConcurrencyArg *arg  = static_cast<ConcurrencyArg *>(v_arg);
+    int             seed = arg->d_seed;
+    int             numLookups = 0;
+
+    while (0 == arg->d_done_p->loadAcquire() || numLookups < 1000) {
+        const int key = bdlb::Random::generate15(&seed)
+                      % (k_NUM_STABLE_KEYS + k_NUM_VOLATILE_KEYS);
+
+        Checked           value;
+        const bsl::size_t rc = arg->d_map_p->getValue(&value, key);
+
+        if (key < k_NUM_STABLE_KEYS) {
+            ASSERTV(key, rc, 1 == rc);
+        }
+        if (rc) {
+            ASSERTV(key, ~value.d_value == value.d_check);
+            ASSERTV(key, value.d_value,
+                    static_cast<bsls::Types::Uint64>(key)
+                                                 == (value.d_value >> 32));
+        }
+        ++numLookups;
+    }
+    arg->d_numLookups = numLookups;
+    return v_arg;
+}
+
+                            // ================
+                            // Performance Test
+                            // ================
+
+template <class MAP>
+struct LookupArg {
+    const MAP           *d_map_p;
+    int                  d_numKeys;
+    int                  d_numLookups;
+    int                  d_seed;
+    bsls::Types::Int64   d_sum;
+};
+
+template <class MAP>
+void *lookupThread(void *v_arg)
+    // Look up random keys in the map held by the specified 'v_arg', a
+    // 'LookupArg<MAP>'.
+{
+    LookupArg<MAP>     *arg = static_cast<LookupArg<MAP> *>(v_arg);
+    bsls::Types::Int64  sum = 0;
+    unsigned int        key = static_cast<unsigned int>(arg->d_seed);
+
+    for (int i = 0; i < arg->d_numLookups; ++i) {
+        key = key * 1664525u + 1013904223u;
+
+        int value = 0;
+        arg->d_map_p->getValue(&value,
+                               static_cast<int>((key >> 8) % arg->d_numKeys));
+        sum += value;
+    }
+    arg->d_sum = sum;
+    return v_arg;
+}
+
+extern "C" void *concurrentLookupThread(void *v_arg)
+    // Call 'lookupThread' for a 'ConcurrentFlatHashMap'.
+{
+    return lookupThread<Obj>(v_arg);
+}
+
+typedef bdlcc::StripedUnorderedMap<int, int> StripedMap;
+
+extern "C" void *stripedLookupThread(void *v_arg)
+    // Call 'lookupThread' for a 'StripedUnorderedMap'.
+{
+    return lookupThread<StripedMap>(v_arg);
+}
+
+template <class MAP>
+double timeLookups(const MAP                         *map,
+                   int                                numThreads,
+                   int                                numKeys,
+                   int                                numLookups,
+                   bslmt::ThreadUtil::ThreadFunction  function,
+                   bslma::Allocator                  *allocator)
+    // Return the number of lookups per microsecond performed by the specified
+    // 'numThreads' threads each running the specified 'function' to perform
+    // the specified 'numLookups' in the specified 'map' holding the specified
+    // 'numKeys', using the specified 'allocator' to supply memory.
+{
+    bsl::vector<LookupArg<MAP> >           args(numThreads,
+                                                LookupArg<MAP>(),
+                                                allocator);
+    bsl::vector<bslmt::ThreadUtil::Handle> handles(numThreads,
+                                                   bslmt::ThreadUtil::Handle(),
+                                                   allocator);
+
+    const bsls::Types::Int64 start = bsls::TimeUtil::getTimer();
+
+    for (int i = 0; i < numThreads; ++i) {
+        LookupArg<MAP> arg = { map, numKeys, numLookups, i * 7 + 1, 0 };
+        args[i] = arg;
+        ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                              function,
+                                              &args[i]));
+    }
+    for (int i = 0; i < numThreads; ++i) {
+        ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+    }
+
+    const bsls::Types::Int64 elapsed = bsls::TimeUtil::getTimer() - start;
+
+    return static_cast<double>(numThreads) * numLookups * 1000.0
+         / static_cast<double>(elapsed);
+}
+
+// ============================================================================
+//                             USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace usageExample {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Reference Data Shared by Many Threads
+/// - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that the request-processing threads of a trading application need
+// the static attributes of securities, identified by an integer, and that
+// these attributes are occasionally updated by a separate thread.
+//
+// First, we define the attributes of a security as a trivially copyable
+// 'struct':
+//..
+    struct SecurityInfo {
+        // This 'struct' holds the static attributes of a security.
+
+        int d_exchangeId;  // identifier of the listing exchange
+        int d_lotSize;     // number of shares of a round lot
+    };
+//..
+
+void example()
+{
+    bslma::TestAllocator         ta("usage", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&ta);
+
+//..
+// Then, we create a map of security identifiers to their attributes, sized
+// for the expected number of securities:
+//..
+    typedef bdlcc::ConcurrentFlatHashMap<int, SecurityInfo> SecurityMap;
+
+    SecurityMap securities(16, 1000);
+    ASSERT(16   == securities.numShards());
+    ASSERT(1000 <= securities.capacity());
+//..
+// Next, the updating thread loads the attributes of a few securities:
+//..
+    for (int id = 1; id <= 100; ++id) {
+        SecurityInfo info = { id % 4, 100 * id };
+        ASSERT(1 == securities.insert(id, info));
+    }
+    ASSERT(100 == securities.size());
+//..
+// Then, any number of request-processing threads look up attributes, without
+// acquiring any lock:
+//..
+    SecurityInfo info;
+    ASSERT(1    == securities.getValue(&info, 42));
+    ASSERT(2    == info.d_exchangeId);
+    ASSERT(4200 == info.d_lotSize);
+
+    ASSERT(0 == securities.getValue(&info, 1000));
+//..
+// Now, the updating thread changes the lot size of a security; 'insert'
+// returns 0 as the security is already present:
+//..
+    SecurityInfo newInfo = { 2, 500 };
+    ASSERT(0 == securities.insert(42, newInfo));
+
+    ASSERT(1   == securities.getValue(&info, 42));
+    ASSERT(500 == info.d_lotSize);
+//..
+// Finally, a security that is delisted is removed from the map:
+//..
+    ASSERT(1  == securities.erase(42));
+    ASSERT(0  == securities.getValue(&info, 42));
+    ASSERT(99 == securities.size());
+//..
+}
+
+}  // close namespace usageExample
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test            = argc > 1 ? atoi(argv[1]) : 0;
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    // CONCERN: In no case does memory come from the default allocator.
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+    bslma::TestAllocatorMonitor dam(&defaultAllocator);
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+    bslma::TestAllocatorMonitor gam(&globalAllocator);
+
+    switch (test) { case 0:
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        usageExample::example();
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY
+        //
+        // Concerns:
+        //: 1 A lookup concurrent with modifications of the same shard, and
+        //:   with its resizing, never returns a torn value, nor the value of
+        //:   another key.
+        //:
+        //: 2 A key that is not modified is always found, including while its
+        //:   shard is resized and its elements are migrated.
+        //:
+        //: 3 Concurrent modifications do not corrupt the map.
+        //
+        // Plan:
+        //: 1 Insert stable keys in a map having few shards, and no reserved
+        //:   capacity.  Then run writer threads inserting, updating, and
+        //:   erasing random volatile keys, which repeatedly resizes the
+        //:   shards, and reader threads looking up random keys, verifying
+        //:   each value found.  (C-1..2)
+        //:
+        //: 2 After the threads complete, verify that the size of the map
+        //:   matches the number of elements visited, and that every visited
+        //:   value is consistent.  (C-3)
+        //
+        // Testing:
+        //   CONCURRENCY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY" << endl
+                          << "===========" << endl;
+
+        enum { k_NUM_WRITERS = 3, k_NUM_READERS = 5 };
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+        {
+            CheckedMap mX(2, 0, &ta);  const CheckedMap& X = mX;
+
+            for (int key = 0; key < k_NUM_STABLE_KEYS; ++key) {
+                ASSERT(1 == mX.insert(key, makeChecked(checkedValue(key, 0))));
+            }
+
+            bsls::AtomicInt            done(0);
+            ConcurrencyArg             args[k_NUM_WRITERS + k_NUM_READERS];
+            bslmt::ThreadUtil::Handle  handles[k_NUM_WRITERS + k_NUM_READERS];
+
+            for (int i = 0; i < k_NUM_WRITERS + k_NUM_READERS; ++i) {
+                ConcurrencyArg arg = { &mX, i * 101 + 1, &done, 0 };
+                args[i] = arg;
+                ASSERT(0 == bslmt::ThreadUtil::create(
+                                      &handles[i],
+                                      i < k_NUM_WRITERS ? &writerThread
+                                                        : &readerThread,
+                                      &args[i]));
+            }
+            for (int i = 0; i < k_NUM_WRITERS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+            }
+            done.storeRelease(1);
+            for (int i = k_NUM_WRITERS;
+                 i < k_NUM_WRITERS + k_NUM_READERS;
+                 ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+                if (veryVerbose) {
+                    T_ P_(i) P(args[i].d_numLookups)
+                }
+            }
+
+            bsl::size_t count = 0;
+            for (int key = 0;
+                 key < k_NUM_STABLE_KEYS + k_NUM_VOLATILE_KEYS;
+                 ++key) {
+                Checked value;
+                if (X.getValue(&value, key)) {
+                    ++count;
+                    ASSERTV(key, ~value.d_value == value.d_check);
+                }
+            }
+            ASSERTV(count, X.size(), count == X.size());
+
+            if (verbose) {
+                P_(X.size()) P(X.capacity())
+            }
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CLEAR, RESERVE, AND VISIT
+        //
+        // Concerns:
+        //: 1 'clear' removes all elements and retains the capacity, and the
+        //:   map is usable afterwards, including when a migration was in
+        //:   progress.
+        //:
+        //: 2 After 'reserve(n)', inserting 'n' evenly distributed elements
+        //:   does not allocate memory.
+        //:
+        //: 3 'visit' visits every element exactly once, including elements
+        //:   not yet migrated, and stops when the visitor returns 'false'.
+        //
+        // Plan:
+        //: 1 Reserve capacity, then insert elements and verify, using a test
+        //:   allocator monitor, that no memory is allocated.  (C-2)
+        //:
+        //: 2 Insert enough elements to resize the shards, and visit them with
+        //:   a visitor summing the values, with and without a limit.  (C-3)
+        //:
+        //: 3 Clear the map, verify that it is empty and that its capacity is
+        //:   unchanged, then insert elements again.  (C-1)
+        //
+        // Testing:
+        //   void clear();
+        //   void reserve(bsl::size_t numElements);
+        //   void visit(VISITOR& visitor) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CLEAR, RESERVE, AND VISIT" << endl
+                          << "=========================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+        {
+            Obj mX(1, 0, &ta);  const Obj& X = mX;
+
+            mX.reserve(1000);
+            ASSERTV(X.capacity(), 1000 <= X.capacity() * 7 / 8);
+
+            bslma::TestAllocatorMonitor tam(&ta);
+            for (int i = 0; i < 1000; ++i) {
+                ASSERT(1 == mX.insert(i, i));
+            }
+            ASSERT(tam.isTotalSame());
+            ASSERT(1000 == X.size());
+
+            mX.reserve(100);
+            ASSERT(tam.isTotalSame());
+        }
+        {
+            Obj mX(4, 0, &ta);  const Obj& X = mX;
+
+            bsls::Types::Int64 expected = 0;
+            for (int i = 0; i < 3000; ++i) {
+                ASSERT(1 == mX.insert(i, i));
+                expected += i;
+            }
+
+            SummingVisitor visitor = { 0, 0, 1 << 30 };
+            X.visit(visitor);
+            ASSERTV(visitor.d_count, 3000 == visitor.d_count);
+            ASSERTV(visitor.d_sum, expected == visitor.d_sum);
+
+            SummingVisitor limited = { 0, 0, 10 };
+            X.visit(limited);
+            ASSERTV(limited.d_count, 10 == limited.d_count);
+
+            const bsl::size_t capacity = X.capacity();
+
+            mX.clear();
+            ASSERT(0        == X.size());
+            ASSERT(true     == X.empty());
+            ASSERT(capacity == X.capacity());
+
+            int value;
+            for (int i = 0; i < 3000; ++i) {
+                ASSERTV(i, 0 == X.getValue(&value, i));
+            }
+
+            SummingVisitor empty = { 0, 0, 1 << 30 };
+            X.visit(empty);
+            ASSERT(0 == empty.d_count);
+
+            for (int i = 0; i < 3000; ++i) {
+                ASSERT(1 == mX.insert(i, -i));
+            }
+            ASSERT(3000 == X.size());
+            for (int i = 0; i < 3000; ++i) {
+                ASSERTV(i, 1  == X.getValue(&value, i));
+                ASSERTV(i, -i == value);
+            }
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // COLLIDING HASH VALUES
+        //
+        // Concerns:
+        //: 1 Keys having the same hash value are found by probing successive
+        //:   groups, including across the end of the table.
+        //:
+        //: 2 Erasing a key from a full group does not hide the keys probed
+        //:   past that group, and the erased slot is reused.
+        //:
+        //: 3 Resizing a shard whose keys all collide preserves them.
+        //
+        // Plan:
+        //: 1 Using a hash functor returning a constant value, insert, erase,
+        //:   and reinsert keys, verifying after each step that every key is
+        //:   found if and only if it was inserted and not erased.  (C-1..3)
+        //
+        // Testing:
+        //   COLLIDING HASH VALUES
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "COLLIDING HASH VALUES" << endl
+                          << "=====================" << endl;
+
+        typedef bdlcc::ConcurrentFlatHashMap<int,
+                                             int,
+                                             ConstantHash,
+                                             bsl::equal_to<int> > CollidingMap;
+
+        enum { k_NUM_KEYS = 300 };
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+        {
+            CollidingMap mX(1, 0, &ta);  const CollidingMap& X = mX;
+
+            bool present[k_NUM_KEYS] = { false };
+
+            for (int round = 0; round < 3; ++round) {
+                for (int i = 0; i < k_NUM_KEYS; ++i) {
+                    if (0 == (i + round) % 3 && present[i]) {
+                        ASSERTV(round, i, 1 == mX.erase(i));
+                        present[i] = false;
+                    }
+                    else if (!present[i]) {
+                        ASSERTV(round, i, 1 == mX.insert(i, i * 10 + round));
+                        present[i] = true;
+                    }
+                }
+
+                bsl::size_t count = 0;
+                for (int i = 0; i < k_NUM_KEYS; ++i) {
+                    int value;
+                    ASSERTV(round, i, (present[i] ? 1u : 0u)
+                                                   == X.getValue(&value, i));
+                    if (present[i]) {
+                        ++count;
+                        ASSERTV(round, i, value, i == value / 10);
+                    }
+                }
+                ASSERTV(round, count, X.size(), count == X.size());
+            }
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // INCREMENTAL RESIZING
+        //
+        // Concerns:
+        //: 1 While the elements of a resized shard are migrated, every
+        //:   element remains visible, whether it has been migrated or not.
+        //:
+        //: 2 Elements that are not yet migrated can be updated and erased.
+        //:
+        //: 3 The capacity grows geometrically, and the storage retained for
+        //:   concurrent lookups is released on destruction.
+        //:
+        //: 4 Erasing and inserting many distinct keys in a way that fills a
+        //:   shard with erased slots, but not with elements, purges the table
+        //:   of the shard in place and allocates no further table, so that
+        //:   the memory used remains bounded.
+        //
+        // Plan:
+        //: 1 Using a single shard, insert keys one at a time and verify after
+        //:   each insertion that every key inserted is found with its value.
+        //:   (C-1)
+        //:
+        //: 2 Immediately after the capacity grows, update and erase keys
+        //:   inserted before the resize, and verify the results.  (C-2)
+        //:
+        //: 3 Verify that the capacity is a power of two at least 8/7 times the
+        //:   size, and that all memory is released.  (C-3)
+        //:
+        //: 4 Using a single shard and 'QuarterHash', repeatedly erase the
+        //:   elements of one class of keys and insert as many elements of the
+        //:   next class, so that the erased elements leave full groups of
+        //:   erased slots, and verify that the elements are found, and that
+        //:   the capacity and the memory in use do not change, but for the two
+        //:   temporary blocks of a purge.  (C-4)
+        //
+        // Testing:
+        //   INCREMENTAL RESIZING
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "INCREMENTAL RESIZING" << endl
+                          << "====================" << endl;
+
+        enum { k_NUM_KEYS = 2000 };
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+        {
+            Obj mX(1, 0, &ta);  const Obj& X = mX;
+
+            ASSERT(0 == X.capacity());
+
+            bool        present[k_NUM_KEYS] = { false };
+            bsl::size_t size                = 0;
+            int         numResizes          = 0;
+
+            for (int i = 0; i < k_NUM_KEYS; ++i) {
+                const bsl::size_t capacity = X.capacity();
+
+                ASSERTV(i, 1 == mX.insert(i, i));
+                present[i] = true;
+                ++size;
+
+                if (X.capacity() != capacity) {
+                    ++numResizes;
+                    if (veryVerbose) {
+                        T_ P_(i) P(X.capacity())
+                    }
+
+                    // Update and erase keys inserted before the resize, most
+                    // of which are not yet migrated.
+
+                    for (int j = i / 2; j < i && j < i / 2 + 4; ++j) {
+                        if (present[j]) {
+                            ASSERTV(i, j, 0 == mX.insert(j, -j));
+                        }
+                    }
+                    for (int j = i - 1; j >= 0 && j > i - 4; --j) {
+                        if (present[j]) {
+                            ASSERTV(i, j, 1 == mX.erase(j));
+                            present[j] = false;
+                            --size;
+                        }
+                    }
+                }
+
+                const bsl::size_t newCapacity = X.capacity();
+                ASSERTV(i, newCapacity,
+                        0 == (newCapacity & (newCapacity - 1)));
+                ASSERTV(i, newCapacity, size * 8 <= newCapacity * 7);
+                ASSERTV(i, size, X.size(), size == X.size());
+
+                for (int j = 0; j <= i; ++j) {
+                    int               value;
+                    const bsl::size_t rc = X.getValue(&value, j);
+
+                    ASSERTV(i, j, rc, (present[j] ? 1u : 0u) == rc);
+                    if (rc) {
+                        ASSERTV(i, j, value, j == value || -j == value);
+                    }
+                }
+            }
+            ASSERTV(numResizes, 5 < numResizes);
+
+            for (int j = 0; j < k_NUM_KEYS; ++j) {
+                ASSERTV(j, (present[j] ? 1u : 0u) == mX.erase(j));
+            }
+            ASSERT(0 == X.size());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        {
+            // Each round erases the elements of the previous round, and
+            // inserts as many elements of the next class of 'QuarterHash',
+            // which fill the groups of the next quarter of the table, so that
+            // the groups of the previous quarter are left full of erased
+            // slots.  The table is purged every few rounds.
+
+            typedef bdlcc::ConcurrentFlatHashMap<int,
+                                                 int,
+                                                 QuarterHash,
+                                                 bsl::equal_to<int> >
+                                                                     ChurnMap;
+
+            enum { k_CAPACITY = 128, k_NUM_LIVE = 32, k_NUM_ROUNDS = 1000 };
+
+            bslma::TestAllocator sa("churn", veryVeryVeryVerbose);
+
+            ChurnMap mX(1, k_CAPACITY / 2, &sa);  const ChurnMap& X = mX;
+
+            ASSERTV(X.capacity(), k_CAPACITY == X.capacity());
+
+            const bsls::Types::Int64 NUM_BLOCKS = sa.numBlocksInUse();
+            const bsls::Types::Int64 NUM_BYTES  = sa.numBytesInUse();
+
+            for (int round = 0; round < k_NUM_ROUNDS; ++round) {
+                for (int j = 0; j < k_NUM_LIVE; ++j) {
+                    const int key = 4 * (round * k_NUM_LIVE + j) + round % 4;
+
+                    if (round) {
+                        const int previousRound = round - 1;
+                        const int oldKey        =
+                                      4 * (previousRound * k_NUM_LIVE + j)
+                                    + previousRound % 4;
+
+                        ASSERTV(round, j, 1 == mX.erase(oldKey));
+                    }
+                    ASSERTV(round, j, 1 == mX.insert(key, round));
+                }
+                ASSERTV(round, X.size(), k_NUM_LIVE == X.size());
+                ASSERTV(round, X.capacity(), k_CAPACITY == X.capacity());
+
+                for (int j = 0; j < k_NUM_LIVE; ++j) {
+                    const int key = 4 * (round * k_NUM_LIVE + j) + round % 4;
+
+                    int value;
+                    ASSERTV(round, j, 1 == X.getValue(&value, key));
+                    ASSERTV(round, j, value, round == value);
+                }
+            }
+
+            if (verbose) {
+                P_(NUM_BLOCKS) P(sa.numBlocksMax())
+            }
+
+            // No table is allocated after the map is created, and a purge
+            // allocates, and releases, two vectors.
+
+            ASSERTV(NUM_BLOCKS, sa.numBlocksInUse(),
+                    NUM_BLOCKS == sa.numBlocksInUse());
+            ASSERTV(NUM_BYTES, sa.numBytesInUse(),
+                    NUM_BYTES == sa.numBytesInUse());
+            ASSERTV(NUM_BLOCKS, sa.numBlocksMax(),
+                    NUM_BLOCKS + 2 == sa.numBlocksMax());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // INSERT, GETVALUE, AND ERASE
+        //
+        // Concerns:
+        //: 1 'insert' inserts absent keys and returns 1, and updates present
+        //:   keys and returns 0.
+        //:
+        //: 2 'erase' removes present keys and returns 1, and returns 0 for
+        //:   absent keys.
+        //:
+        //: 3 'getValue' finds exactly the present keys, with their latest
+        //:   value.
+        //:
+        //: 4 'size' and 'empty' reflect the number of elements.
+        //:
+        //: 5 The above hold for entries spanning one or several words, and
+        //:   for any number of shards.
+        //
+        // Plan:
+        //: 1 For several combinations of key and value types, and numbers of
+        //:   shards, apply random operations to a map and to an oracle, and
+        //:   verify that they agree after each operation.  (C-1..5)
+        //
+        // Testing:
+        //   bsl::size_t erase(const KEY& key);
+        //   bsl::size_t insert(const KEY& key, const VALUE& value);
+        //   bool empty() const;
+        //   bsl::size_t getValue(VALUE *value, const KEY& key) const;
+        //   bsl::size_t size() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "INSERT, GETVALUE, AND ERASE" << endl
+                          << "===========================" << endl;
+
+        const int SHARDS[] = { 1, 2, 16 };
+        const int NUM_SHARDS = sizeof SHARDS / sizeof *SHARDS;
+
+        for (int i = 0; i < NUM_SHARDS; ++i) {
+            if (veryVerbose) {
+                T_ P(SHARDS[i])
+            }
+
+            testRandomOperations<int, int, IntHash, bsl::equal_to<int> >(
+                                                                     SHARDS[i],
+                                                                     3000,
+                                                                     20000);
+
+            testRandomOperations<int, Checked, IntHash, bsl::equal_to<int> >(
+                                                                     SHARDS[i],
+                                                                     3000,
+                                                                     20000);
+
+            testRandomOperations<Symbol, int, SymbolHash, SymbolEqual>(
+                                                                     SHARDS[i],
+                                                                     3000,
+                                                                     20000);
+
+            testRandomOperations<Symbol, Checked, SymbolHash, SymbolEqual>(
+                                                                     SHARDS[i],
+                                                                     3000,
+                                                                     20000);
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CONSTRUCTORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 The number of shards is rounded up to a power of two, and
+        //:   defaults to 'k_DEFAULT_NUM_SHARDS'.
+        //:
+        //: 2 A map created without capacity allocates no memory, and a map
+        //:   created with a capacity has at least that capacity.
+        //:
+        //: 3 The hash and equality functors are the ones supplied.
+        //:
+        //: 4 'shardIndex' is in range and consistent.
+        //:
+        //: 5 Memory comes from the supplied allocator, or the default
+        //:   allocator if none is supplied, and is released on destruction.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create maps using each constructor and verify their attributes.
+        //:   (C-1..5)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid numbers of shards.  (C-6)
+        //
+        // Testing:
+        //   ConcurrentFlatHashMap(bslma::Allocator *basicAllocator = 0);
+        //   ConcurrentFlatHashMap(int numShards, size_t capacity = 0, a = 0);
+        //   ConcurrentFlatHashMap(numShards, capacity, hash, equal, a = 0);
+        //   ~ConcurrentFlatHashMap();
+        //   bsl::size_t capacity() const;
+        //   EQUAL equalFunction() const;
+        //   HASH hashFunction() const;
+        //   int numShards() const;
+        //   int shardIndex(const KEY& key) const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONSTRUCTORS AND BASIC ACCESSORS" << endl
+                          << "================================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        {
+            bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+            bslma::DefaultAllocatorGuard guard(&da);
+
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(Obj::k_DEFAULT_NUM_SHARDS == X.numShards());
+            ASSERT(0                         == X.capacity());
+            ASSERT(0                         == X.size());
+            ASSERT(&da                       == X.allocator());
+
+            const bsls::Types::Int64 numBlocks = da.numBlocksTotal();
+
+            ASSERT(1 == mX.insert(1, 1));
+            ASSERT(numBlocks < da.numBlocksTotal());
+        }
+
+        const struct {
+            int d_line;
+            int d_numShards;
+            int d_expected;
+        } DATA[] = {
+            { L_,     1,     1 },
+            { L_,     2,     2 },
+            { L_,     3,     4 },
+            { L_,    16,    16 },
+            { L_,    17,    32 },
+            { L_, 65536, 65536 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE     = DATA[ti].d_line;
+            const int SHARDS   = DATA[ti].d_numShards;
+            const int EXPECTED = DATA[ti].d_expected;
+
+            {
+                bslma::TestAllocatorMonitor tam(&ta);
+
+                Obj mX(SHARDS, 0, &ta);  const Obj& X = mX;
+
+                ASSERTV(LINE, X.numShards(), EXPECTED == X.numShards());
+                ASSERTV(LINE, 0   == X.capacity());
+                ASSERTV(LINE, &ta == X.allocator());
+                ASSERTV(LINE, X.empty());
+
+                for (int key = 0; key < 100; ++key) {
+                    const int index = X.shardIndex(key);
+                    ASSERTV(LINE, key, 0 <= index);
+                    ASSERTV(LINE, key, index < X.numShards());
+                    ASSERTV(LINE, key, index == X.shardIndex(key));
+                }
+            }
+            {
+                Obj mX(SHARDS, 10000, &ta);  const Obj& X = mX;
+
+                ASSERTV(LINE, X.capacity(), 10000 <= X.capacity() * 7 / 8);
+            }
+            {
+                const ConstantHash       HASH  = ConstantHash();
+                const bsl::equal_to<int> EQUAL = bsl::equal_to<int>();
+
+                bdlcc::ConcurrentFlatHashMap<int,
+                                             int,
+                                             ConstantHash,
+                                             bsl::equal_to<int> >
+                    mX(SHARDS, 100, HASH, EQUAL, &ta);
+
+                ASSERTV(LINE, 0x5a  == mX.hashFunction()(17));
+                ASSERTV(LINE, true  == mX.equalFunction()(3, 3));
+                ASSERTV(LINE, false == mX.equalFunction()(3, 4));
+                ASSERTV(LINE, 100   <= mX.capacity());
+                ASSERTV(LINE, mX.shardIndex(1) == mX.shardIndex(2));
+            }
+            ASSERTV(LINE, 0 == ta.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_FAIL(Obj(0, 0, &ta));
+            ASSERT_PASS(Obj(1, 0, &ta));
+            ASSERT_PASS(Obj(65536, 0, &ta));
+            ASSERT_FAIL(Obj(65537, 0, &ta));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert, look up, update, and erase a few elements.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+
+        Obj mX(4, 0, &ta);  const Obj& X = mX;
+
+        ASSERT(4 == X.numShards());
+        ASSERT(0 == X.size());
+
+        for (int i = 0; i < 100; ++i) {
+            ASSERT(1 == mX.insert(i, i * i));
+        }
+        ASSERT(100 == X.size());
+
+        int value;
+        ASSERT(1 == X.getValue(&value, 3));
+        ASSERT(9 == value);
+        ASSERT(0 == X.getValue(&value, 100));
+
+        ASSERT(0  == mX.insert(3, 10));
+        ASSERT(1  == X.getValue(&value, 3));
+        ASSERT(10 == value);
+
+        ASSERT(1  == mX.erase(3));
+        ASSERT(0  == mX.erase(3));
+        ASSERT(0  == X.getValue(&value, 3));
+        ASSERT(99 == X.size());
+
+        mX.clear();
+        ASSERT(0 == X.size());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: CONCURRENT LOOKUPS
+        //
+        // Concerns:
+        //: 1 Lookups in a 'bdlcc::ConcurrentFlatHashMap' scale with the number
+        //:   of reading threads, and are faster than lookups in a
+        //:   'bdlcc::StripedUnorderedMap'.
+        //
+        // Plan:
+        //: 1 For increasing numbers of threads, time random lookups of keys in
+        //:   both maps holding the same elements, and report the number of
+        //:   lookups per microsecond.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST: CONCURRENT LOOKUPS
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE TEST: CONCURRENT LOOKUPS" << endl
+             << "====================================" << endl;
+
+        const int NUM_KEYS    = argc > 2 ? atoi(argv[2]) : 1 << 20;
+        const int NUM_LOOKUPS = 2000000;
+
+        bslma::TestAllocator ta("object", veryVeryVeryVerbose);
+        {
+            Obj        concurrent(Obj::k_DEFAULT_NUM_SHARDS, NUM_KEYS, &ta);
+            StripedMap striped(NUM_KEYS, 16, &ta);
+
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                concurrent.insert(i, i);
+                striped.insert(i, i);
+            }
+
+            const int THREADS[] = { 1, 2, 4, 8, 16, 32, 64 };
+            const int NUM_THREADS = sizeof THREADS / sizeof *THREADS;
+
+            cout << "keys: " << NUM_KEYS << ", lookups per microsecond"
+                 << endl;
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                const double rateConcurrent = timeLookups(
+                                                     &concurrent,
+                                                     THREADS[i],
+                                                     NUM_KEYS,
+                                                     NUM_LOOKUPS,
+                                                     &concurrentLookupThread,
+                                                     &ta);
+                const double rateStriped    = timeLookups(
+                                                     &striped,
+                                                     THREADS[i],
+                                                     NUM_KEYS,
+                                                     NUM_LOOKUPS,
+                                                     &stripedLookupThread,
+                                                     &ta);
+
+                cout << "threads: " << THREADS[i]
+                     << "\tConcurrentFlatHashMap: " << rateConcurrent
+                     << "\tStripedUnorderedMap: "   << rateStriped
+                     << endl;
+            }
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the default allocator.
+
+    ASSERTV(dam.isTotalSame());
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(gam.isTotalSame());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
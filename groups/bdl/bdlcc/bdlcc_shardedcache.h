@@ -0,0 +1,1079 @@
+// bdlcc_shardedcache.h                                               -*-C++-*-
+#ifndef INCLUDED_BDLCC_SHARDEDCACHE
+#define INCLUDED_BDLCC_SHARDEDCACHE
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an in-process cache partitioned into independent shards.
+//
+//@CLASSES:
+//  bdlcc::ShardedCache: key-value cache made of independently locked shards
+//
+//@SEE_ALSO: bdlcc_cache
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bdlcc::ShardedCache', implementing a thread-safe in-memory key-value cache
+// that partitions its items among a fixed number of 'bdlcc::Cache' objects
+// ("shards"), each protected by its own reader-writer lock.  The shard of an
+// item is selected from the hash value of its key, so operations on keys that
+// fall into different shards never contend for the same lock.  A sharded cache
+// is appropriate when many threads access a cache concurrently, particularly
+// when the eviction policy (e.g., LRU) requires 'tryGetValue' to take a write
+// lock.
+//
+// 'bdlcc::ShardedCache' has the same template parameters and essentially the
+// same interface as 'bdlcc::Cache'; the number of shards is supplied at
+// construction and rounded up to a power of two.  All of the eviction policies
+// of 'bdlcc::Cache' (see 'bdlcc::CacheEvictionPolicy') are supported.  Note
+// that eviction is performed independently in each shard: the low and high
+// watermarks supplied at construction are divided evenly among the shards
+// (rounding up), and an item is evicted when the shard holding it reaches its
+// share of the high watermark, even if other shards have room.  Also note that
+// the eviction order across shards is not defined; in particular,
+// 'bdlcc::ShardedCache' does not provide 'popFront', and 'visit' visits the
+// shards one after the other.
+//
+// To make it possible to monitor the effectiveness of a cache in production,
+// each shard maintains counters of the hits and misses of 'tryGetValue', and
+// of the items evicted (not erased) from the shard.  The counters of a shard
+// are kept apart from those of other shards (on a separate cache line) so that
+// updating them does not introduce contention between shards.
+//
+///Thread Safety
+///-------------
+// 'bdlcc::ShardedCache' is fully thread-safe, meaning that all non-creator
+// operations on a given object can be safely executed concurrently.  The
+// post-eviction callback is invoked while the lock of the shard holding the
+// evicted item is held and, as for 'bdlcc::Cache', must not call back into
+// the cache.  Operations that address a single key (e.g., 'insert', 'erase',
+// and 'tryGetValue') are atomic; operations that address several shards
+// (e.g., 'clear', 'insertBulk', 'size', and 'visit') are performed one shard
+// at a time, and so are not atomic with respect to the cache as a whole.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: A Shared Cache of Lookups
+/// - - - - - - - - - - - - - - - - - -
+// Suppose that many request-processing threads need to look up the name of a
+// user from their identifier, and that the lookup is expensive (e.g., it
+// requires a database query).  We cache the results using a sharded cache, so
+// that threads looking up different users rarely contend.
+//
+// First, we define a function that performs the expensive lookup:
+//..
+//  bsl::string lookupUserName(int userId)
+//      // Return the name of the user having the specified 'userId'.
+//  {
+//      bsl::ostringstream oss;
+//      oss << "user" << userId;
+//      return oss.str();
+//  }
+//..
+// Then, we create a cache of 4 shards holding up to 1000 users and using the
+// W-TinyLFU eviction policy, so that a scan of rarely used identifiers does
+// not evict the names of frequently active users:
+//..
+//  typedef bdlcc::ShardedCache<int, bsl::string> UserNameCache;
+//
+//  UserNameCache cache(4,
+//                      bdlcc::CacheEvictionPolicy::e_W_TINY_LFU,
+//                      1000,
+//                      1000);
+//  assert(4    == cache.numShards());
+//  assert(1000 == cache.highWatermark());
+//..
+// Next, we write a function that returns the name of a user, using the cache
+// when possible:
+//..
+//  bsl::string userName(UserNameCache *cache, int userId)
+//      // Return the name of the user having the specified 'userId', using
+//      // the specified 'cache' to avoid repeated lookups.
+//  {
+//      UserNameCache::ValuePtrType name;
+//      if (0 == cache->tryGetValue(&name, userId)) {
+//          return *name;                                             // RETURN
+//      }
+//
+//      bsl::string result = lookupUserName(userId);
+//      cache->insert(userId, result);
+//      return result;
+//  }
+//..
+// Now, we look up a few users, some of them several times:
+//..
+//  for (int i = 0; i < 10; ++i) {
+//      assert("user7"  == userName(&cache, 7));
+//      assert("user42" == userName(&cache, 42));
+//  }
+//  assert("user3" == userName(&cache, 3));
+//..
+// Finally, we observe the statistics of the cache: the first lookup of each
+// user missed, and all of the others hit:
+//..
+//  assert(3  == cache.size());
+//  assert(3  == cache.numMisses());
+//  assert(18 == cache.numHits());
+//  assert(0  == cache.numEvictions());
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlcc_cache.h>
+
+#include <bdlb_bitutil.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_platform.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_functional.h>
+#include <bsl_memory.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdlcc {
+
+                        // =========================
+                        // struct ShardedCache_Shard
+                        // =========================
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+struct ShardedCache_Shard {
+    // This component-private struct holds one shard of a 'ShardedCache': a
+    // 'Cache' and the usage statistics of that cache.
+
+    // PUBLIC DATA
+    Cache<KEY, VALUE, HASH, EQUAL> d_cache;         // items of the shard
+
+    bsls::AtomicInt64              d_numHits;       // successful lookups
+
+    bsls::AtomicInt64              d_numMisses;     // failed lookups
+
+    bsls::AtomicInt64              d_numRemovals;   // invocations of the
+                                                    // post-eviction callback
+
+    bsls::AtomicInt64              d_numErasures;   // items removed by 'erase'
+                                                    // and 'eraseBulk'
+
+    const char                     d_pad[bslmt::Platform::e_CACHE_LINE_SIZE];
+                                                    // keeps the counters of
+                                                    // other shards on
+                                                    // separate cache lines
+
+    // CREATORS
+    ShardedCache_Shard(CacheEvictionPolicy::Enum  evictionPolicy,
+                       bsl::size_t                lowWatermark,
+                       bsl::size_t                highWatermark,
+                       const HASH&                hashFunction,
+                       const EQUAL&               equalFunction,
+                       bslma::Allocator          *basicAllocator);
+        // Create a shard holding an empty cache having the specified
+        // 'evictionPolicy', 'lowWatermark', 'highWatermark', 'hashFunction',
+        // and 'equalFunction', and using the specified 'basicAllocator' to
+        // supply memory.
+};
+
+                   // ==================================
+                   // class ShardedCache_EvictionCounter
+                   // ==================================
+
+template <class VALUE_PTR>
+class ShardedCache_EvictionCounter {
+    // This component-private class implements the post-eviction callback
+    // installed in each shard of a 'ShardedCache': a functor that counts its
+    // invocations and then invokes the post-eviction callback supplied by the
+    // user, if any.
+
+  public:
+    // PUBLIC TYPES
+    typedef bsl::function<void(const VALUE_PTR&)> Callback;
+        // Type of the post-eviction callback supplied by the user.
+
+  private:
+    // DATA
+    bsls::AtomicInt64 *d_counter_p;  // number of invocations (held, not
+                                     // owned)
+
+    Callback           d_callback;   // user-supplied callback (may be empty)
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(ShardedCache_EvictionCounter,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    ShardedCache_EvictionCounter(bsls::AtomicInt64 *counter,
+                                 const Callback&    callback,
+                                 bslma::Allocator  *basicAllocator = 0);
+        // Create a functor that increments the specified 'counter' and then
+        // invokes the specified 'callback', unless it is empty, each time it
+        // is called.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.
+
+    ShardedCache_EvictionCounter(
+                      const ShardedCache_EvictionCounter&  original,
+                      bslma::Allocator                    *basicAllocator = 0);
+        // Create a functor having the same counter and callback as the
+        // specified 'original'.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.
+
+    // ACCESSORS
+    void operator()(const VALUE_PTR& value) const;
+        // Increment the counter of this functor and invoke its callback, if
+        // any, with the specified 'value'.
+};
+
+                       // ==========================
+                       // class ShardedCache_Visitor
+                       // ==========================
+
+template <class VISITOR>
+class ShardedCache_Visitor {
+    // This component-private class implements a visitor that forwards to a
+    // user-supplied visitor and records whether that visitor requested the
+    // traversal to stop.
+
+    // DATA
+    VISITOR *d_visitor_p;  // user-supplied visitor (held, not owned)
+
+    bool    *d_stopped_p;  // set to 'true' when 'd_visitor_p' returns 'false'
+                           // (held, not owned)
+
+  public:
+    // CREATORS
+    ShardedCache_Visitor(VISITOR *visitor, bool *stopped);
+        // Create a visitor forwarding to the specified 'visitor' and setting
+        // the specified 'stopped' flag to 'true' when 'visitor' returns
+        // 'false'.
+
+    // MANIPULATORS
+    template <class KEY, class VALUE>
+    bool operator()(const KEY& key, const VALUE& value);
+        // Invoke the user-supplied visitor with the specified 'key' and
+        // 'value', and return its result.
+};
+
+                           // ==================
+                           // class ShardedCache
+                           // ==================
+
+template <class KEY,
+          class VALUE,
+          class HASH  = bsl::hash<KEY>,
+          class EQUAL = bsl::equal_to<KEY> >
+class ShardedCache {
+    // This class represents an in-process key-value store, supporting the
+    // eviction policies of 'Cache', whose items are partitioned among a fixed
+    // number of independently locked 'Cache' objects.
+
+  public:
+    // PUBLIC TYPES
+    typedef Cache<KEY, VALUE, HASH, EQUAL>             CacheType;
+        // Type of a shard.
+
+    typedef typename CacheType::ValuePtrType           ValuePtrType;
+        // Shared pointer type pointing to value type.
+
+    typedef typename CacheType::PostEvictionCallback   PostEvictionCallback;
+        // Type of function to call after an item has been evicted from the
+        // cache.
+
+    typedef typename CacheType::KVType                 KVType;
+        // Value type of a bulk insert entry.
+
+  private:
+    // PRIVATE TYPES
+    typedef ShardedCache_Shard<KEY, VALUE, HASH, EQUAL> Shard;
+    typedef ShardedCache_EvictionCounter<ValuePtrType>  EvictionCounter;
+
+    // DATA
+    bslma::Allocator                  *d_allocator_p;  // memory allocator
+                                                       // (held, not owned)
+
+    bsl::vector<bsl::shared_ptr<Shard> >
+                                       d_shards;       // shards, the number
+                                                       // of which is a power
+                                                       // of two
+
+    bsl::size_t                        d_shardMask;    // 'd_shards.size() - 1'
+
+    HASH                               d_hashFunction; // hash functor used to
+                                                       // select the shard of
+                                                       // a key
+
+    // PRIVATE MANIPULATORS
+    void initialize(int                        numShards,
+                    CacheEvictionPolicy::Enum  evictionPolicy,
+                    bsl::size_t                lowWatermark,
+                    bsl::size_t                highWatermark,
+                    const EQUAL&               equalFunction);
+        // Create the shards of this cache.  Round the specified 'numShards' up
+        // to a power of two, and give each shard an empty cache having the
+        // specified 'evictionPolicy', an even share of the specified
+        // 'lowWatermark' and 'highWatermark', and the specified
+        // 'equalFunction'.
+
+    // PRIVATE ACCESSORS
+    Shard& shardFor(const KEY& key) const;
+        // Return a reference providing modifiable access to the shard holding
+        // the specified 'key'.
+
+  private:
+    // NOT IMPLEMENTED
+    ShardedCache(const ShardedCache&);
+    ShardedCache& operator=(const ShardedCache&);
+
+  public:
+    // CREATORS
+    ShardedCache(int                        numShards,
+                 CacheEvictionPolicy::Enum  evictionPolicy,
+                 bsl::size_t                lowWatermark,
+                 bsl::size_t                highWatermark,
+                 bslma::Allocator          *basicAllocator = 0);
+        // Create an empty cache made of the specified 'numShards', rounded up
+        // to a power of two, and using the specified 'evictionPolicy', and
+        // the specified 'lowWatermark' and 'highWatermark' (divided evenly
+        // among the shards, rounding up).  Optionally specify the
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless '1 <= numShards <= 65536',
+        // 'lowWatermark <= highWatermark', and '1 <= lowWatermark'.
+
+    ShardedCache(int                        numShards,
+                 CacheEvictionPolicy::Enum  evictionPolicy,
+                 bsl::size_t                lowWatermark,
+                 bsl::size_t                highWatermark,
+                 const HASH&                hashFunction,
+                 const EQUAL&               equalFunction,
+                 bslma::Allocator          *basicAllocator = 0);
+        // Create an empty cache made of the specified 'numShards', rounded up
+        // to a power of two, and using the specified 'evictionPolicy', and
+        // the specified 'lowWatermark' and 'highWatermark' (divided evenly
+        // among the shards, rounding up).  The specified 'hashFunction' is
+        // used to generate the hash values for a given key (both to select
+        // the shard of the key and within the shard), and the specified
+        // 'equalFunction' is used to determine whether two keys have the same
+        // value.  Optionally specify the 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  The behavior is undefined unless
+        // '1 <= numShards <= 65536', 'lowWatermark <= highWatermark', and
+        // '1 <= lowWatermark'.
+
+    //! ~ShardedCache() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    void clear();
+        // Remove all items from this cache.  Do *not* invoke the post-eviction
+        // callback.
+
+    int erase(const KEY& key);
+        // Remove the item having the specified 'key' from this cache.  Invoke
+        // the post-eviction callback for the removed item.  Return 0 on
+        // success and 1 if 'key' does not exist.
+
+    int eraseBulk(const bsl::vector<KEY>& keys);
+        // Remove the items having the specified 'keys' from this cache.
+        // Invoke the post-eviction callback for each removed item.  Return
+        // the number of items successfully removed.
+
+    void insert(const KEY& key, const VALUE& value);
+    void insert(const KEY& key, bslmf::MovableRef<VALUE> value);
+    void insert(bslmf::MovableRef<KEY> key, const VALUE& value);
+    void insert(bslmf::MovableRef<KEY> key, bslmf::MovableRef<VALUE> value);
+        // Move the specified 'key' and its associated 'value' into this cache.
+        // If 'key' already exists, then its value will be replaced with
+        // 'value'.  Note that all the methods that take moved objects provide
+        // the 'basic' but not the 'strong' exception guarantee.  Also note
+        // that 'key' must be copyable, even if it is moved.
+
+    void insert(const KEY& key, const ValuePtrType& valuePtr);
+    void insert(bslmf::MovableRef<KEY> key, const ValuePtrType& valuePtr);
+        // Insert the specified 'key' and its associated 'valuePtr' into this
+        // cache.  If 'key' already exists, then its value will be replaced
+        // with 'value'.  Note that the method with 'key' moved provides the
+        // 'basic' but not the 'strong' exception guarantee.  Also note that
+        // 'key' must be copyable, even if it is moved.
+
+    int insertBulk(const bsl::vector<KVType>& data);
+        // Insert the specified 'data' (composed of Key-Value pairs) into this
+        // cache.  If a key already exists, then its value will be replaced
+        // with the value.  Return the number of items successfully inserted.
+
+    int insertBulk(bslmf::MovableRef<bsl::vector<KVType> > data);
+        // Insert the specified 'data' (composed of Key-Value pairs) into this
+        // cache.  If a key already exists, then its value will be replaced
+        // with the value.  Return the number of items successfully inserted.
+        // If an exception occurs during this action, we provide only the
+        // basic guarantee - both this cache and 'data' will be in some valid
+        // but unspecified state.
+
+    void setPostEvictionCallback(
+                             const PostEvictionCallback& postEvictionCallback);
+        // Set the post-eviction callback to the specified
+        // 'postEvictionCallback'.  The post-eviction callback is invoked for
+        // each item evicted or removed from this cache.
+
+    int tryGetValue(bsl::shared_ptr<VALUE> *value,
+                    const KEY&              key,
+                    bool                    modifyEvictionQueue = true);
+        // Load, into the specified 'value', the value associated with the
+        // specified 'key' in this cache, and record a hit for the shard of
+        // 'key'.  If the optionally specified 'modifyEvictionQueue' is 'true',
+        // then update the eviction state of the item as 'Cache::tryGetValue'
+        // does.  Return 0 on success, and 1 (recording a miss) if 'key' does
+        // not exist in this cache.
+
+    // ACCESSORS
+    EQUAL equalFunction() const;
+        // Return (a copy of) the key-equality functor used by this cache.
+
+    CacheEvictionPolicy::Enum evictionPolicy() const;
+        // Return the eviction policy used by this cache.
+
+    HASH hashFunction() const;
+        // Return (a copy of) the unary hash functor used by this cache.
+
+    bsl::size_t highWatermark() const;
+        // Return the high watermark of this cache, which is the sum of the
+        // high watermarks of its shards.
+
+    bsl::size_t lowWatermark() const;
+        // Return the low watermark of this cache, which is the sum of the low
+        // watermarks of its shards.
+
+    bsls::Types::Int64 numEvictions() const;
+    bsls::Types::Int64 numEvictions(int shard) const;
+        // Return the number of items evicted (i.e., removed by the eviction
+        // policy or by 'popFront', but not by 'erase', 'eraseBulk', or
+        // 'clear') from this cache, or from the specified 'shard' of this
+        // cache.  The behavior is undefined unless
+        // '0 <= shard < numShards()'.  Note that the value may be transiently
+        // inaccurate while items are erased concurrently.
+
+    bsls::Types::Int64 numHits() const;
+    bsls::Types::Int64 numHits(int shard) const;
+        // Return the number of successful calls to 'tryGetValue' on this
+        // cache, or on the specified 'shard' of this cache.  The behavior is
+        // undefined unless '0 <= shard < numShards()'.
+
+    bsls::Types::Int64 numMisses() const;
+    bsls::Types::Int64 numMisses(int shard) const;
+        // Return the number of unsuccessful calls to 'tryGetValue' on this
+        // cache, or on the specified 'shard' of this cache.  The behavior is
+        // undefined unless '0 <= shard < numShards()'.
+
+    int numShards() const;
+        // Return the number of shards of this cache.
+
+    int shardIndex(const KEY& key) const;
+        // Return the index of the shard that holds, or would hold, the
+        // specified 'key'.
+
+    bsl::size_t size() const;
+        // Return the current size of this cache.  Note that the value may be
+        // transiently inaccurate while this cache is modified concurrently.
+
+    template <class VISITOR>
+    void visit(VISITOR& visitor) const;
+        // Call the specified 'visitor' for every item stored in this cache,
+        // one shard after the other, and within a shard in the order of its
+        // eviction queue, until 'visitor' returns 'false'.  The 'VISITOR'
+        // type must be a callable object that can be invoked in the same way
+        // as the function 'bool (const KEY&, const VALUE&)'.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                        // -------------------------
+                        // struct ShardedCache_Shard
+                        // -------------------------
+
+// CREATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+ShardedCache_Shard<KEY, VALUE, HASH, EQUAL>::ShardedCache_Shard(
+                                 CacheEvictionPolicy::Enum  evictionPolicy,
+                                 bsl::size_t                lowWatermark,
+                                 bsl::size_t                highWatermark,
+                                 const HASH&                hashFunction,
+                                 const EQUAL&               equalFunction,
+                                 bslma::Allocator          *basicAllocator)
+: d_cache(evictionPolicy,
+          lowWatermark,
+          highWatermark,
+          hashFunction,
+          equalFunction,
+          basicAllocator)
+, d_numHits(0)
+, d_numMisses(0)
+, d_numRemovals(0)
+, d_numErasures(0)
+, d_pad()
+{
+}
+
+                   // ----------------------------------
+                   // class ShardedCache_EvictionCounter
+                   // ----------------------------------
+
+// CREATORS
+template <class VALUE_PTR>
+inline
+ShardedCache_EvictionCounter<VALUE_PTR>::ShardedCache_EvictionCounter(
+                                           bsls::AtomicInt64 *counter,
+                                           const Callback&    callback,
+                                           bslma::Allocator  *basicAllocator)
+: d_counter_p(counter)
+, d_callback(bsl::allocator_arg, basicAllocator, callback)
+{
+    BSLS_ASSERT(counter);
+}
+
+template <class VALUE_PTR>
+inline
+ShardedCache_EvictionCounter<VALUE_PTR>::ShardedCache_EvictionCounter(
+                        const ShardedCache_EvictionCounter&  original,
+                        bslma::Allocator                    *basicAllocator)
+: d_counter_p(original.d_counter_p)
+, d_callback(bsl::allocator_arg, basicAllocator, original.d_callback)
+{
+}
+
+// ACCESSORS
+template <class VALUE_PTR>
+inline
+void ShardedCache_EvictionCounter<VALUE_PTR>::operator()(
+                                                  const VALUE_PTR& value) const
+{
+    d_counter_p->addRelaxed(1);
+    if (d_callback) {
+        d_callback(value);
+    }
+}
+
+                       // --------------------------
+                       // class ShardedCache_Visitor
+                       // --------------------------
+
+// CREATORS
+template <class VISITOR>
+inline
+ShardedCache_Visitor<VISITOR>::ShardedCache_Visitor(VISITOR *visitor,
+                                                    bool    *stopped)
+: d_visitor_p(visitor)
+, d_stopped_p(stopped)
+{
+}
+
+// MANIPULATORS
+template <class VISITOR>
+template <class KEY, class VALUE>
+inline
+bool ShardedCache_Visitor<VISITOR>::operator()(const KEY&   key,
+                                               const VALUE& value)
+{
+    if (!(*d_visitor_p)(key, value)) {
+        *d_stopped_p = true;
+        return false;                                                 // RETURN
+    }
+    return true;
+}
+
+                           // ------------------
+                           // class ShardedCache
+                           // ------------------
+
+// PRIVATE MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::initialize(
+                                    int                        numShards,
+                                    CacheEvictionPolicy::Enum  evictionPolicy,
+                                    bsl::size_t                lowWatermark,
+                                    bsl::size_t                highWatermark,
+                                    const EQUAL&               equalFunction)
+{
+    BSLS_ASSERT(1 <= numShards);
+    BSLS_ASSERT(numShards <= 65536);
+    BSLS_ASSERT(lowWatermark <= highWatermark);
+    BSLS_ASSERT(1 <= lowWatermark);
+
+    const bsl::size_t count = bdlb::BitUtil::roundUpToBinaryPower(
+                                   static_cast<bdlb::BitUtil::uint32_t>(
+                                                                  numShards));
+
+    const bsl::size_t shardLowWatermark  = (lowWatermark  - 1) / count + 1;
+    const bsl::size_t shardHighWatermark = (highWatermark - 1) / count + 1;
+
+    d_shards.reserve(count);
+    for (bsl::size_t i = 0; i < count; ++i) {
+        bsl::shared_ptr<Shard> shard;
+        shard.createInplace(d_allocator_p,
+                            evictionPolicy,
+                            shardLowWatermark,
+                            shardHighWatermark,
+                            d_hashFunction,
+                            equalFunction,
+                            d_allocator_p);
+
+        PostEvictionCallback callback(
+                    bsl::allocator_arg,
+                    d_allocator_p,
+                    EvictionCounter(&shard->d_numRemovals,
+                                    PostEvictionCallback(),
+                                    d_allocator_p));
+        shard->d_cache.setPostEvictionCallback(callback);
+
+        d_shards.push_back(shard);
+    }
+    d_shardMask = count - 1;
+}
+
+// PRIVATE ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename ShardedCache<KEY, VALUE, HASH, EQUAL>::Shard&
+ShardedCache<KEY, VALUE, HASH, EQUAL>::shardFor(const KEY& key) const
+{
+    return *d_shards[shardIndex(key)];
+}
+
+// CREATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+ShardedCache<KEY, VALUE, HASH, EQUAL>::ShardedCache(
+                                  int                        numShards,
+                                  CacheEvictionPolicy::Enum  evictionPolicy,
+                                  bsl::size_t                lowWatermark,
+                                  bsl::size_t                highWatermark,
+                                  bslma::Allocator          *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_shards(d_allocator_p)
+, d_shardMask(0)
+, d_hashFunction()
+{
+    initialize(numShards,
+               evictionPolicy,
+               lowWatermark,
+               highWatermark,
+               EQUAL());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+ShardedCache<KEY, VALUE, HASH, EQUAL>::ShardedCache(
+                                  int                        numShards,
+                                  CacheEvictionPolicy::Enum  evictionPolicy,
+                                  bsl::size_t                lowWatermark,
+                                  bsl::size_t                highWatermark,
+                                  const HASH&                hashFunction,
+                                  const EQUAL&               equalFunction,
+                                  bslma::Allocator          *basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_shards(d_allocator_p)
+, d_shardMask(0)
+, d_hashFunction(hashFunction)
+{
+    initialize(numShards,
+               evictionPolicy,
+               lowWatermark,
+               highWatermark,
+               equalFunction);
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::clear()
+{
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        d_shards[i]->d_cache.clear();
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+int ShardedCache<KEY, VALUE, HASH, EQUAL>::erase(const KEY& key)
+{
+    Shard& shard = shardFor(key);
+
+    // Count the erasure first, so that the item is never seen as evicted.
+
+    shard.d_numErasures.addRelaxed(1);
+    const int rc = shard.d_cache.erase(key);
+    if (0 != rc) {
+        shard.d_numErasures.addRelaxed(-1);
+    }
+    return rc;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int ShardedCache<KEY, VALUE, HASH, EQUAL>::eraseBulk(
+                                                const bsl::vector<KEY>& keys)
+{
+    bsl::vector<bsl::vector<KEY> > keysByShard(d_shards.size(),
+                                               bsl::vector<KEY>(),
+                                               d_allocator_p);
+    for (bsl::size_t i = 0; i < keys.size(); ++i) {
+        keysByShard[shardIndex(keys[i])].push_back(keys[i]);
+    }
+
+    int count = 0;
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        const bsl::vector<KEY>& shardKeys = keysByShard[i];
+        if (shardKeys.empty()) {
+            continue;
+        }
+
+        Shard&                   shard     = *d_shards[i];
+        const bsls::Types::Int64 numKeys   =
+                                   static_cast<bsls::Types::Int64>(
+                                                            shardKeys.size());
+
+        shard.d_numErasures.addRelaxed(numKeys);
+        const int numErased = shard.d_cache.eraseBulk(shardKeys);
+        shard.d_numErasures.addRelaxed(numErased - numKeys);
+
+        count += numErased;
+    }
+    return count;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::insert(const KEY&   key,
+                                                   const VALUE& value)
+{
+    shardFor(key).d_cache.insert(key, value);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                              const KEY&               key,
+                                              bslmf::MovableRef<VALUE> value)
+{
+    shardFor(key).d_cache.insert(key, bslmf::MovableRefUtil::move(value));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                                bslmf::MovableRef<KEY> key,
+                                                const VALUE&           value)
+{
+    Shard& shard = shardFor(bslmf::MovableRefUtil::access(key));
+    shard.d_cache.insert(bslmf::MovableRefUtil::move(key), value);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                              bslmf::MovableRef<KEY>   key,
+                                              bslmf::MovableRef<VALUE> value)
+{
+    Shard& shard = shardFor(bslmf::MovableRefUtil::access(key));
+    shard.d_cache.insert(bslmf::MovableRefUtil::move(key),
+                         bslmf::MovableRefUtil::move(value));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                                const KEY&          key,
+                                                const ValuePtrType& valuePtr)
+{
+    shardFor(key).d_cache.insert(key, valuePtr);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::insert(
+                                         bslmf::MovableRef<KEY> key,
+                                         const ValuePtrType&    valuePtr)
+{
+    Shard& shard = shardFor(bslmf::MovableRefUtil::access(key));
+    shard.d_cache.insert(bslmf::MovableRefUtil::move(key), valuePtr);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int ShardedCache<KEY, VALUE, HASH, EQUAL>::insertBulk(
+                                               const bsl::vector<KVType>& data)
+{
+    bsl::vector<bsl::vector<KVType> > dataByShard(d_shards.size(),
+                                                  bsl::vector<KVType>(),
+                                                  d_allocator_p);
+    for (bsl::size_t i = 0; i < data.size(); ++i) {
+        dataByShard[shardIndex(data[i].first)].push_back(data[i]);
+    }
+
+    int count = 0;
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        if (!dataByShard[i].empty()) {
+            count += d_shards[i]->d_cache.insertBulk(
+                               bslmf::MovableRefUtil::move(dataByShard[i]));
+        }
+    }
+    return count;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+int ShardedCache<KEY, VALUE, HASH, EQUAL>::insertBulk(
+                                  bslmf::MovableRef<bsl::vector<KVType> > data)
+{
+    bsl::vector<KVType>& localData = data;
+
+    bsl::vector<bsl::vector<KVType> > dataByShard(d_shards.size(),
+                                                  bsl::vector<KVType>(),
+                                                  d_allocator_p);
+    for (bsl::size_t i = 0; i < localData.size(); ++i) {
+        dataByShard[shardIndex(localData[i].first)].push_back(
+                                 bslmf::MovableRefUtil::move(localData[i]));
+    }
+
+    int count = 0;
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        if (!dataByShard[i].empty()) {
+            count += d_shards[i]->d_cache.insertBulk(
+                               bslmf::MovableRefUtil::move(dataByShard[i]));
+        }
+    }
+    return count;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::setPostEvictionCallback(
+                              const PostEvictionCallback& postEvictionCallback)
+{
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        Shard& shard = *d_shards[i];
+
+        PostEvictionCallback callback(
+                    bsl::allocator_arg,
+                    d_allocator_p,
+                    EvictionCounter(&shard.d_numRemovals,
+                                    postEvictionCallback,
+                                    d_allocator_p));
+        shard.d_cache.setPostEvictionCallback(callback);
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+int ShardedCache<KEY, VALUE, HASH, EQUAL>::tryGetValue(
+                                   bsl::shared_ptr<VALUE> *value,
+                                   const KEY&              key,
+                                   bool                    modifyEvictionQueue)
+{
+    Shard& shard = shardFor(key);
+
+    const int rc = shard.d_cache.tryGetValue(value, key, modifyEvictionQueue);
+    if (0 == rc) {
+        shard.d_numHits.addRelaxed(1);
+    }
+    else {
+        shard.d_numMisses.addRelaxed(1);
+    }
+    return rc;
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+EQUAL ShardedCache<KEY, VALUE, HASH, EQUAL>::equalFunction() const
+{
+    return d_shards[0]->d_cache.equalFunction();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+CacheEvictionPolicy::Enum
+ShardedCache<KEY, VALUE, HASH, EQUAL>::evictionPolicy() const
+{
+    return d_shards[0]->d_cache.evictionPolicy();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+HASH ShardedCache<KEY, VALUE, HASH, EQUAL>::hashFunction() const
+{
+    return d_hashFunction;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t ShardedCache<KEY, VALUE, HASH, EQUAL>::highWatermark() const
+{
+    return d_shards[0]->d_cache.highWatermark() * d_shards.size();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t ShardedCache<KEY, VALUE, HASH, EQUAL>::lowWatermark() const
+{
+    return d_shards[0]->d_cache.lowWatermark() * d_shards.size();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsls::Types::Int64 ShardedCache<KEY, VALUE, HASH, EQUAL>::numEvictions() const
+{
+    bsls::Types::Int64 result = 0;
+    for (int i = 0; i < numShards(); ++i) {
+        result += numEvictions(i);
+    }
+    return result;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsls::Types::Int64
+ShardedCache<KEY, VALUE, HASH, EQUAL>::numEvictions(int shard) const
+{
+    BSLS_ASSERT(0 <= shard);
+    BSLS_ASSERT(shard < numShards());
+
+    const Shard& s = *d_shards[shard];
+
+    // Load the erasures first: an erasure is counted before its removal.
+
+    const bsls::Types::Int64 numErasures = s.d_numErasures.loadRelaxed();
+    const bsls::Types::Int64 result      = s.d_numRemovals.loadRelaxed()
+                                         - numErasures;
+    return result < 0 ? 0 : result;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsls::Types::Int64 ShardedCache<KEY, VALUE, HASH, EQUAL>::numHits() const
+{
+    bsls::Types::Int64 result = 0;
+    for (int i = 0; i < numShards(); ++i) {
+        result += numHits(i);
+    }
+    return result;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsls::Types::Int64
+ShardedCache<KEY, VALUE, HASH, EQUAL>::numHits(int shard) const
+{
+    BSLS_ASSERT(0 <= shard);
+    BSLS_ASSERT(shard < numShards());
+
+    return d_shards[shard]->d_numHits.loadRelaxed();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsls::Types::Int64 ShardedCache<KEY, VALUE, HASH, EQUAL>::numMisses() const
+{
+    bsls::Types::Int64 result = 0;
+    for (int i = 0; i < numShards(); ++i) {
+        result += numMisses(i);
+    }
+    return result;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsls::Types::Int64
+ShardedCache<KEY, VALUE, HASH, EQUAL>::numMisses(int shard) const
+{
+    BSLS_ASSERT(0 <= shard);
+    BSLS_ASSERT(shard < numShards());
+
+    return d_shards[shard]->d_numMisses.loadRelaxed();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+int ShardedCache<KEY, VALUE, HASH, EQUAL>::numShards() const
+{
+    return static_cast<int>(d_shards.size());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+int ShardedCache<KEY, VALUE, HASH, EQUAL>::shardIndex(const KEY& key) const
+{
+    // Use the high bits of a multiplicative spreading of the hash value: the
+    // low bits of the hash value select the bucket within the shard, and
+    // identity hashes (e.g., 'bsl::hash<int>') would otherwise map sequential
+    // keys to sequential shards and buckets alike.
+
+    const bsls::Types::Uint64 hash = static_cast<bsls::Types::Uint64>(
+                                                          d_hashFunction(key));
+
+    return static_cast<int>(((hash * 0x9e3779b97f4a7c15ULL) >> 40)
+                                                                & d_shardMask);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t ShardedCache<KEY, VALUE, HASH, EQUAL>::size() const
+{
+    bsl::size_t result = 0;
+    for (bsl::size_t i = 0; i < d_shards.size(); ++i) {
+        result += d_shards[i]->d_cache.size();
+    }
+    return result;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class VISITOR>
+void ShardedCache<KEY, VALUE, HASH, EQUAL>::visit(VISITOR& visitor) const
+{
+    // 'Cache::visit' does not report whether the visitor stopped the
+    // traversal, so the visitor is wrapped to record it.
+
+    bool                            stopped = false;
+    ShardedCache_Visitor<VISITOR>   wrapper(&visitor, &stopped);
+
+    for (bsl::size_t i = 0; i < d_shards.size() && !stopped; ++i) {
+        d_shards[i]->d_cache.visit(wrapper);
+    }
+}
+
+}  // close package namespace
+
+namespace bslma {
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+struct UsesBslmaAllocator<bdlcc::ShardedCache<KEY, VALUE, HASH, EQUAL> >
+    : bsl::true_type
+{
+};
+
+}  // close namespace bslma
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,948 @@
+// bdlcc_shardedcache.t.cpp                                           -*-C++-*-
+#include <bdlcc_shardedcache.h>
+
+#include <bdlb_random.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bslmf_movableref.h>
+
+#include <bslmt_threadutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_review.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test defines a mechanism, 'bdlcc::ShardedCache', that
+// forwards each operation to one of several 'bdlcc::Cache' objects selected
+// from the hash value of the key, and that maintains per-shard usage
+// statistics.  The behavior of each shard is tested by the test driver of
+// 'bdlcc_cache'; we therefore concentrate on the distribution of keys among
+// shards, the division of the watermarks, the statistics, the aggregation of
+// the results of multi-shard operations, and thread safety.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] ShardedCache(numShards, policy, lowWat, highWat, alloc);
+// [ 2] ShardedCache(numShards, policy, lowWat, highWat, hash, equal, alloc);
+//
+// MANIPULATORS
+// [ 4] void clear();
+// [ 4] int erase(const KEY& key);
+// [ 4] int eraseBulk(const bsl::vector<KEY>& keys);
+// [ 4] void insert(const KEY& key, const VALUE& value);
+// [ 4] void insert(const KEY& key, MovableRef<VALUE> value);
+// [ 4] void insert(MovableRef<KEY> key, const VALUE& value);
+// [ 4] void insert(MovableRef<KEY> key, MovableRef<VALUE> value);
+// [ 4] void insert(const KEY& key, const ValuePtrType& valuePtr);
+// [ 4] void insert(MovableRef<KEY> key, const ValuePtrType& valuePtr);
+// [ 4] int insertBulk(const bsl::vector<KVType>& data);
+// [ 4] int insertBulk(MovableRef<bsl::vector<KVType> > data);
+// [ 3] void setPostEvictionCallback(postEvictionCallback);
+// [ 5] int tryGetValue(value, key, modifyEvictionQueue);
+//
+// ACCESSORS
+// [ 2] EQUAL equalFunction() const;
+// [ 2] CacheEvictionPolicy::Enum evictionPolicy() const;
+// [ 2] HASH hashFunction() const;
+// [ 2] bsl::size_t highWatermark() const;
+// [ 2] bsl::size_t lowWatermark() const;
+// [ 3] bsls::Types::Int64 numEvictions() const;
+// [ 3] bsls::Types::Int64 numEvictions(int shard) const;
+// [ 5] bsls::Types::Int64 numHits() const;
+// [ 5] bsls::Types::Int64 numHits(int shard) const;
+// [ 5] bsls::Types::Int64 numMisses() const;
+// [ 5] bsls::Types::Int64 numMisses(int shard) const;
+// [ 2] int numShards() const;
+// [ 3] int shardIndex(const KEY& key) const;
+// [ 3] bsl::size_t size() const;
+// [ 4] void visit(VISITOR& visitor) const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] CONCURRENCY
+// [ 7] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+bool             verbose;
+bool         veryVerbose;
+bool     veryVeryVerbose;
+bool veryVeryVeryVerbose;
+
+typedef bdlcc::ShardedCache<int, int> Obj;
+
+const bdlcc::CacheEvictionPolicy::Enum POLICIES[] = {
+    bdlcc::CacheEvictionPolicy::e_LRU,
+    bdlcc::CacheEvictionPolicy::e_FIFO,
+    bdlcc::CacheEvictionPolicy::e_CLOCK,
+    bdlcc::CacheEvictionPolicy::e_W_TINY_LFU
+};
+
+const int NUM_POLICIES = sizeof(POLICIES) / sizeof(*POLICIES);
+
+// ============================================================================
+//                       HELPER FUNCTIONS AND CLASSES
+// ----------------------------------------------------------------------------
+
+struct ModuloHash {
+    // This 'struct' provides a hash functor whose value depends only on the
+    // residue of the key modulo 2.
+
+    // ACCESSORS
+    bsl::size_t operator()(int key) const
+        // Return a hash value for the specified 'key'.
+    {
+        return static_cast<bsl::size_t>(key % 2);
+    }
+};
+
+struct ModuloEqual {
+    // This 'struct' provides an equality functor that compares keys for
+    // equality modulo 1000.
+
+    // ACCESSORS
+    bool operator()(int lhs, int rhs) const
+        // Return 'true' if the specified 'lhs' and 'rhs' are equal modulo
+        // 1000, and 'false' otherwise.
+    {
+        return lhs % 1000 == rhs % 1000;
+    }
+};
+
+struct CountingCallback {
+    // This 'struct' provides a post-eviction callback counting its
+    // invocations.
+
+    // DATA
+    bsls::AtomicInt *d_count_p;
+
+    // ACCESSORS
+    template <class VALUE_PTR>
+    void operator()(const VALUE_PTR&) const
+        // Increment the counter of this callback.
+    {
+        ++*d_count_p;
+    }
+};
+
+struct SummingVisitor {
+    // This 'struct' provides a visitor summing the values it visits, and
+    // stopping after a limit.
+
+    // DATA
+    int d_sum;
+    int d_count;
+    int d_limit;
+
+    // MANIPULATORS
+    bool operator()(int, int value)
+        // Add the specified 'value' to the sum and return 'true' unless the
+        // limit of visited items is reached.
+    {
+        d_sum += value;
+        return ++d_count < d_limit;
+    }
+};
+
+struct ThreadArg {
+    Obj *d_cache_p;
+    int  d_seed;
+};
+
+extern "C" void *workerThread(void *v_arg)
+    // Insert and look up random keys in the cache held by the specified
+    // 'v_arg', a 'ThreadArg', checking that values found match their keys.
+{
+    ThreadArg *arg  = static_cast<ThreadArg *>(v_arg);
+    int        seed = arg->d_seed;
+
+    for (int i = 0; i < 20000; ++i) {
+        const int          key = bdlb::Random::generate15(&seed) % 2000;
+        Obj::ValuePtrType  valuePtr;
+        if (0 != arg->d_cache_p->tryGetValue(&valuePtr, key)) {
+            arg->d_cache_p->insert(key, key);
+        }
+        else {
+            ASSERTV(key, *valuePtr, key == *valuePtr);
+        }
+        if (0 == i % 1000) {
+            arg->d_cache_p->erase(key);
+        }
+    }
+    return v_arg;
+}
+
+// ============================================================================
+//                             USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace usageExample {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: A Shared Cache of Lookups
+/// - - - - - - - - - - - - - - - - - -
+// Suppose that many request-processing threads need to look up the name of a
+// user from their identifier, and that the lookup is expensive (e.g., it
+// requires a database query).  We cache the results using a sharded cache, so
+// that threads looking up different users rarely contend.
+//
+// First, we define a function that performs the expensive lookup:
+//..
+    bsl::string lookupUserName(int userId)
+        // Return the name of the user having the specified 'userId'.
+    {
+        bsl::ostringstream oss;
+        oss << "user" << userId;
+        return oss.str();
+    }
+//..
+// Then, we create a cache of 4 shards holding up to 1000 users and using the
+// W-TinyLFU eviction policy, so that a scan of rarely used identifiers does
+// not evict the names of frequently active users:
+//..
+    typedef bdlcc::ShardedCache<int, bsl::string> UserNameCache;
+//..
+// Next, we write a function that returns the name of a user, using the cache
+// when possible:
+//..
+    bsl::string userName(UserNameCache *cache, int userId)
+        // Return the name of the user having the specified 'userId', using
+        // the specified 'cache' to avoid repeated lookups.
+    {
+        UserNameCache::ValuePtrType name;
+        if (0 == cache->tryGetValue(&name, userId)) {
+            return *name;                                             // RETURN
+        }
+
+        bsl::string result = lookupUserName(userId);
+        cache->insert(userId, result);
+        return result;
+    }
+//..
+
+void example()
+{
+    bslma::TestAllocator         ta("usage", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&ta);
+
+    UserNameCache cache(4,
+                        bdlcc::CacheEvictionPolicy::e_W_TINY_LFU,
+                        1000,
+                        1000);
+    ASSERT(4    == cache.numShards());
+    ASSERT(1000 == cache.highWatermark());
+//..
+// Now, we look up a few users, some of them several times:
+//..
+    for (int i = 0; i < 10; ++i) {
+        ASSERT("user7"  == userName(&cache, 7));
+        ASSERT("user42" == userName(&cache, 42));
+    }
+    ASSERT("user3" == userName(&cache, 3));
+//..
+// Finally, we observe the statistics of the cache: the first lookup of each
+// user missed, and all of the others hit:
+//..
+    ASSERT(3  == cache.size());
+    ASSERT(3  == cache.numMisses());
+    ASSERT(18 == cache.numHits());
+    ASSERT(0  == cache.numEvictions());
+//..
+}
+
+}  // close namespace usageExample
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test            = argc > 1 ? atoi(argv[1]) : 0;
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: 'BSLS_REVIEW' failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    // CONCERN: In no case does memory come from the default allocator.
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+    bslma::TestAllocatorMonitor dam(&defaultAllocator);
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+    bslma::TestAllocatorMonitor gam(&globalAllocator);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        usageExample::example();
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY
+        //
+        // Concerns:
+        //: 1 Concurrent inserts, lookups, and erasures do not corrupt the
+        //:   cache, and values found are the values inserted.
+        //:
+        //: 2 The statistics account for every lookup.
+        //:
+        //: 3 Each shard stays within its share of the high watermark.
+        //
+        // Plan:
+        //: 1 For each eviction policy, run several threads inserting, looking
+        //:   up, and erasing random keys, then verify the statistics and the
+        //:   size.  (C-1..3)
+        //
+        // Testing:
+        //   CONCURRENCY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY" << endl
+                          << "===========" << endl;
+
+        const int k_NUM_THREADS = 8;
+
+        for (int tp = 0; tp < NUM_POLICIES; ++tp) {
+            bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+            Obj mX(8, POLICIES[tp], 400, 500, &ta);  const Obj& X = mX;
+
+            bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+            ThreadArg                 args[k_NUM_THREADS];
+
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                args[i].d_cache_p = &mX;
+                args[i].d_seed    = i + 1;
+                ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                      workerThread,
+                                                      &args[i]));
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+            }
+
+            ASSERTV(tp, X.numHits() + X.numMisses(),
+                    k_NUM_THREADS * 20000 == X.numHits() + X.numMisses());
+            ASSERTV(tp, X.size(), X.size() <= 8 * 63);
+            ASSERTV(tp, X.numEvictions(), 0 < X.numEvictions());
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // 'tryGetValue' AND HIT STATISTICS
+        //
+        // Concerns:
+        //: 1 'tryGetValue' finds the items inserted, and only those.
+        //:
+        //: 2 Each successful lookup increments the hit count of the shard of
+        //:   the key, and each failed lookup its miss count.
+        //:
+        //: 3 The totals are the sums of the per-shard counts.
+        //
+        // Plan:
+        //: 1 Insert some keys, look up present and absent keys, and compare
+        //:   the per-shard and total counts against counts computed using
+        //:   'shardIndex'.  (C-1..3)
+        //
+        // Testing:
+        //   int tryGetValue(value, key, modifyEvictionQueue);
+        //   bsls::Types::Int64 numHits() const;
+        //   bsls::Types::Int64 numHits(int shard) const;
+        //   bsls::Types::Int64 numMisses() const;
+        //   bsls::Types::Int64 numMisses(int shard) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'tryGetValue' AND HIT STATISTICS" << endl
+                          << "================================" << endl;
+
+        for (int tp = 0; tp < NUM_POLICIES; ++tp) {
+            bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+            Obj mX(4, POLICIES[tp], 1000, 1000, &ta);  const Obj& X = mX;
+
+            for (int i = 0; i < 100; i += 2) {
+                mX.insert(i, i * 10);
+            }
+
+            bsls::Types::Int64 hits[4]   = { 0, 0, 0, 0 };
+            bsls::Types::Int64 misses[4] = { 0, 0, 0, 0 };
+
+            for (int i = 0; i < 100; ++i) {
+                Obj::ValuePtrType valuePtr;
+                const int         rc = mX.tryGetValue(&valuePtr, i, i % 3);
+                if (i % 2) {
+                    ASSERTV(tp, i, 1 == rc);
+                    ++misses[X.shardIndex(i)];
+                }
+                else {
+                    ASSERTV(tp, i, 0 == rc);
+                    ASSERTV(tp, i, i * 10 == *valuePtr);
+                    ++hits[X.shardIndex(i)];
+                }
+            }
+
+            for (int s = 0; s < 4; ++s) {
+                ASSERTV(tp, s, hits[s]   == X.numHits(s));
+                ASSERTV(tp, s, misses[s] == X.numMisses(s));
+                ASSERTV(tp, s, 0         <  X.numHits(s));
+            }
+            ASSERTV(tp, 50 == X.numHits());
+            ASSERTV(tp, 50 == X.numMisses());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+            Obj mX(4, bdlcc::CacheEvictionPolicy::e_LRU, 10, 10, &ta);
+            const Obj& X = mX;
+
+            ASSERT_PASS(X.numHits(0));
+            ASSERT_PASS(X.numHits(3));
+            ASSERT_FAIL(X.numHits(-1));
+            ASSERT_FAIL(X.numHits(4));
+            ASSERT_FAIL(X.numMisses(4));
+            ASSERT_FAIL(X.numEvictions(4));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // MANIPULATORS
+        //
+        // Concerns:
+        //: 1 Every 'insert' overload stores the item in the shard of its key.
+        //:
+        //: 2 The bulk operations return the total number of items inserted or
+        //:   removed across all shards.
+        //:
+        //: 3 'erase' and 'eraseBulk' invoke the post-eviction callback but
+        //:   are not counted as evictions.
+        //:
+        //: 4 'clear' removes all items without invoking the callback.
+        //:
+        //: 5 'visit' visits every item, and stops when the visitor returns
+        //:   'false'.
+        //
+        // Plan:
+        //: 1 Exercise each manipulator and verify the contents, the return
+        //:   values, the callback invocations, and the eviction counts.
+        //:   (C-1..5)
+        //
+        // Testing:
+        //   void clear();
+        //   int erase(const KEY& key);
+        //   int eraseBulk(const bsl::vector<KEY>& keys);
+        //   void insert(const KEY& key, const VALUE& value);
+        //   void insert(const KEY& key, MovableRef<VALUE> value);
+        //   void insert(MovableRef<KEY> key, const VALUE& value);
+        //   void insert(MovableRef<KEY> key, MovableRef<VALUE> value);
+        //   void insert(const KEY& key, const ValuePtrType& valuePtr);
+        //   void insert(MovableRef<KEY> key, const ValuePtrType& valuePtr);
+        //   int insertBulk(const bsl::vector<KVType>& data);
+        //   int insertBulk(MovableRef<bsl::vector<KVType> > data);
+        //   void visit(VISITOR& visitor) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "MANIPULATORS" << endl
+                          << "============" << endl;
+
+        typedef bdlcc::ShardedCache<bsl::string, bsl::string> StrObj;
+
+        for (int tp = 0; tp < NUM_POLICIES; ++tp) {
+            bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+            bsls::AtomicInt  count(0);
+            CountingCallback callback = { &count };
+
+            StrObj mX(4, POLICIES[tp], 100, 100, &ta);  const StrObj& X = mX;
+            mX.setPostEvictionCallback(
+                   StrObj::PostEvictionCallback(bsl::allocator_arg,
+                                                &ta,
+                                                callback));
+
+            const bsl::string KEYS[] = {
+                bsl::string("a",                                   &ta),
+                bsl::string("b-a-string-longer-than-short-string", &ta),
+                bsl::string("c",                                   &ta),
+                bsl::string("d-a-string-longer-than-short-string", &ta),
+                bsl::string("e",                                   &ta),
+                bsl::string("f",                                   &ta)
+            };
+
+            bsl::string v0("0", &ta);
+            bsl::string v1("1", &ta);
+            bsl::string k2(KEYS[2], &ta), v2("2", &ta);
+            bsl::string k3(KEYS[3], &ta), v3("3", &ta);
+            bsl::string k5(KEYS[5], &ta);
+
+            StrObj::ValuePtrType valuePtr;
+            valuePtr.createInplace(&ta, "5", &ta);
+
+            mX.insert(KEYS[0], v0);
+            mX.insert(KEYS[1], bslmf::MovableRefUtil::move(v1));
+            mX.insert(bslmf::MovableRefUtil::move(k2), v2);
+            mX.insert(bslmf::MovableRefUtil::move(k3),
+                      bslmf::MovableRefUtil::move(v3));
+            mX.insert(KEYS[4], valuePtr);
+            mX.insert(bslmf::MovableRefUtil::move(k5), valuePtr);
+            ASSERTV(tp, 6 == X.size());
+
+            for (int i = 0; i < 6; ++i) {
+                StrObj::ValuePtrType value;
+                ASSERTV(tp, i, 0 == mX.tryGetValue(&value, KEYS[i]));
+                const char EXP[] = { static_cast<char>(
+                                            '0' + (i == 4 ? 5 : i)), '\0' };
+                ASSERTV(tp, i, *value, EXP == *value);
+            }
+
+            ASSERTV(tp, 0 == mX.erase(KEYS[0]));
+            ASSERTV(tp, 1 == mX.erase(KEYS[0]));
+            ASSERTV(tp, 1 == count);
+
+            bsl::vector<bsl::string> keys(&ta);
+            keys.push_back(KEYS[0]);
+            keys.push_back(KEYS[1]);
+            keys.push_back(KEYS[2]);
+            keys.push_back(KEYS[3]);
+            ASSERTV(tp, 3 == mX.eraseBulk(keys));
+            ASSERTV(tp, 4 == count);
+            ASSERTV(tp, 2 == X.size());
+            ASSERTV(tp, 0 == X.numEvictions());
+
+            mX.clear();
+            ASSERTV(tp, 0 == X.size());
+            ASSERTV(tp, 4 == count);
+
+            bsl::vector<StrObj::KVType> data(&ta);
+            for (int i = 0; i < 6; ++i) {
+                data.push_back(StrObj::KVType(KEYS[i], valuePtr, &ta));
+            }
+            ASSERTV(tp, 6 == mX.insertBulk(data));
+            ASSERTV(tp, 0 == mX.insertBulk(data));
+            ASSERTV(tp, 0 == mX.insertBulk(bslmf::MovableRefUtil::move(data)));
+            mX.clear();
+
+            bsl::vector<StrObj::KVType> data2(&ta);
+            for (int i = 0; i < 6; ++i) {
+                data2.push_back(StrObj::KVType(KEYS[i], valuePtr, &ta));
+            }
+            ASSERTV(tp, 6 == mX.insertBulk(
+                                       bslmf::MovableRefUtil::move(data2)));
+            ASSERTV(tp, 6 == X.size());
+        }
+
+        for (int tp = 0; tp < NUM_POLICIES; ++tp) {
+            bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+            Obj mX(8, POLICIES[tp], 1000, 1000, &ta);  const Obj& X = mX;
+
+            for (int i = 1; i <= 100; ++i) {
+                mX.insert(i, i);
+            }
+
+            SummingVisitor all = { 0, 0, 1000 };
+            X.visit(all);
+            ASSERTV(tp, all.d_count, 100  == all.d_count);
+            ASSERTV(tp, all.d_sum,   5050 == all.d_sum);
+
+            SummingVisitor some = { 0, 0, 30 };
+            X.visit(some);
+            ASSERTV(tp, some.d_count, 30 == some.d_count);
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // SHARD SELECTION AND EVICTION
+        //
+        // Concerns:
+        //: 1 'shardIndex' is in '[0 .. numShards())' and spreads sequential
+        //:   keys over all shards.
+        //:
+        //: 2 Each shard evicts items when it reaches its share of the high
+        //:   watermark, so the total size never exceeds 'highWatermark()'.
+        //:
+        //: 3 'numEvictions' counts the evicted items, per shard and in total,
+        //:   and the user post-eviction callback is invoked for each of them.
+        //
+        // Plan:
+        //: 1 Insert many sequential keys into caches of each policy, and
+        //:   verify the shard indices, the size, the per-shard sizes derived
+        //:   from the evictions, and the callback count.  (C-1..3)
+        //
+        // Testing:
+        //   int shardIndex(const KEY& key) const;
+        //   bsl::size_t size() const;
+        //   void setPostEvictionCallback(postEvictionCallback);
+        //   bsls::Types::Int64 numEvictions() const;
+        //   bsls::Types::Int64 numEvictions(int shard) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SHARD SELECTION AND EVICTION" << endl
+                          << "============================" << endl;
+
+        for (int tp = 0; tp < NUM_POLICIES; ++tp) {
+            bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+            bsls::AtomicInt  count(0);
+            CountingCallback callback = { &count };
+
+            Obj mX(8, POLICIES[tp], 400, 400, &ta);  const Obj& X = mX;
+            mX.setPostEvictionCallback(
+                      Obj::PostEvictionCallback(bsl::allocator_arg,
+                                                &ta,
+                                                callback));
+
+            int inserted[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+
+            const int k_NUM_KEYS = 10000;
+            for (int i = 0; i < k_NUM_KEYS; ++i) {
+                const int shard = X.shardIndex(i);
+                ASSERTV(tp, i, shard, 0 <= shard && shard < 8);
+                ++inserted[shard];
+
+                mX.insert(i, i);
+                ASSERTV(tp, i, X.size() <= X.highWatermark());
+            }
+
+            for (int s = 0; s < 8; ++s) {
+                ASSERTV(tp, s, inserted[s], k_NUM_KEYS / 16 < inserted[s]);
+
+                // Each shard is full: it holds its share of the high
+                // watermark (50) and has evicted every other item.
+
+                ASSERTV(tp, s, X.numEvictions(s),
+                        inserted[s] - 50 == X.numEvictions(s));
+            }
+
+            ASSERTV(tp, X.size(), 400 == X.size());
+            ASSERTV(tp,
+                    X.numEvictions(),
+                    k_NUM_KEYS - 400 == X.numEvictions());
+            ASSERTV(tp, count, k_NUM_KEYS - 400 == count);
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 The number of shards is rounded up to a power of two.
+        //:
+        //: 2 The watermarks are divided evenly among the shards, rounding up,
+        //:   and the accessors report the sums of the shard watermarks.
+        //:
+        //: 3 The hash and equality functors are used, and reported by the
+        //:   accessors.
+        //:
+        //: 4 All memory comes from the supplied allocator, and is released on
+        //:   destruction.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create caches with various parameters and verify the accessors.
+        //:   (C-1..4)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   ShardedCache(numShards, policy, lowWat, highWat, alloc);
+        //   ShardedCache(numShards, policy, lowWat, highWat, hash, eq, alloc);
+        //   EQUAL equalFunction() const;
+        //   CacheEvictionPolicy::Enum evictionPolicy() const;
+        //   HASH hashFunction() const;
+        //   bsl::size_t highWatermark() const;
+        //   bsl::size_t lowWatermark() const;
+        //   int numShards() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND BASIC ACCESSORS" << endl
+                          << "============================" << endl;
+
+        static const struct {
+            int         d_line;
+            int         d_numShards;
+            bsl::size_t d_low;
+            bsl::size_t d_high;
+            int         d_expNumShards;
+            bsl::size_t d_expLow;
+            bsl::size_t d_expHigh;
+        } DATA[] = {
+            // LINE  SHARDS  LOW  HIGH  EXP_SHARDS  EXP_LOW  EXP_HIGH
+            // ----  ------  ---  ----  ----------  -------  --------
+            {  L_,       1,   1,    1,          1,       1,        1 },
+            {  L_,       1,  90,  100,          1,      90,      100 },
+            {  L_,       2,  90,  100,          2,      90,      100 },
+            {  L_,       3,  90,  100,          4,      92,      100 },
+            {  L_,       4,   1,    1,          4,       4,        4 },
+            {  L_,      16, 100,  100,         16,     112,      112 },
+            {  L_,      17, 100,  200,         32,     128,      224 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE = DATA[ti].d_line;
+
+            for (int tp = 0; tp < NUM_POLICIES; ++tp) {
+                bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+                {
+                    Obj mX(DATA[ti].d_numShards,
+                           POLICIES[tp],
+                           DATA[ti].d_low,
+                           DATA[ti].d_high,
+                           &ta);
+                    const Obj& X = mX;
+
+                    ASSERTV(LINE, X.numShards(),
+                            DATA[ti].d_expNumShards == X.numShards());
+                    ASSERTV(LINE, X.lowWatermark(),
+                            DATA[ti].d_expLow == X.lowWatermark());
+                    ASSERTV(LINE, X.highWatermark(),
+                            DATA[ti].d_expHigh == X.highWatermark());
+                    ASSERTV(LINE, POLICIES[tp] == X.evictionPolicy());
+                    ASSERTV(LINE, 0 == X.size());
+                    ASSERTV(LINE, 0 == X.numHits());
+                    ASSERTV(LINE, 0 == X.numMisses());
+                    ASSERTV(LINE, 0 == X.numEvictions());
+                    ASSERTV(LINE, 0 < ta.numBlocksInUse());
+                }
+                ASSERTV(LINE, 0 == ta.numBlocksInUse());
+            }
+        }
+
+        if (verbose) cout << "\nUser-supplied functors." << endl;
+        {
+            typedef bdlcc::ShardedCache<int, int, ModuloHash, ModuloEqual>
+                                                                      FuncObj;
+
+            bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+            FuncObj mX(4,
+                       bdlcc::CacheEvictionPolicy::e_LRU,
+                       100,
+                       100,
+                       ModuloHash(),
+                       ModuloEqual(),
+                       &ta);
+            const FuncObj& X = mX;
+
+            ASSERT(1 == X.hashFunction()(3));
+            ASSERT(X.equalFunction()(5, 1005));
+
+            // Keys equal modulo 1000 have equal hashes, hence the same shard,
+            // and are the same key.
+
+            mX.insert(5, 1);
+            mX.insert(1005, 2);
+            ASSERT(1 == X.size());
+
+            FuncObj::ValuePtrType valuePtr;
+            ASSERT(0 == mX.tryGetValue(&valuePtr, 2005));
+            ASSERT(2 == *valuePtr);
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+            const bdlcc::CacheEvictionPolicy::Enum LRU =
+                                             bdlcc::CacheEvictionPolicy::e_LRU;
+
+            ASSERT_PASS(Obj(1, LRU, 1, 1, &ta));
+            ASSERT_FAIL(Obj(0, LRU, 1, 1, &ta));
+            ASSERT_FAIL(Obj(1, LRU, 0, 1, &ta));
+            ASSERT_FAIL(Obj(1, LRU, 2, 1, &ta));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a cache, insert, look up, and erase a few items.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        Obj mX(4, bdlcc::CacheEvictionPolicy::e_LRU, 10, 10, &ta);
+        const Obj& X = mX;
+
+        ASSERT(4 == X.numShards());
+        ASSERT(0 == X.size());
+
+        for (int i = 0; i < 8; ++i) {
+            mX.insert(i, i * i);
+        }
+        ASSERT(8 == X.size());
+
+        Obj::ValuePtrType valuePtr;
+        ASSERT(0 == mX.tryGetValue(&valuePtr, 3));
+        ASSERT(9 == *valuePtr);
+        ASSERT(1 == mX.tryGetValue(&valuePtr, 8));
+        ASSERT(1 == X.numHits());
+        ASSERT(1 == X.numMisses());
+
+        ASSERT(0 == mX.erase(3));
+        ASSERT(7 == X.size());
+        ASSERT(0 == X.numEvictions());
+
+        mX.clear();
+        ASSERT(0 == X.size());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the default allocator.
+
+    ASSERTV(dam.isTotalSame());
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(gam.isTotalSame());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
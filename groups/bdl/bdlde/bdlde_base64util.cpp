@@ -0,0 +1,596 @@
+// bdlde_base64util.cpp                                               -*-C++-*-
+#include <bdlde_base64util.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlde_base64util_cpp,"$Id$ $CSID$")
+
+#include <bdlde_base64decoder.h>
+#include <bdlde_simd_cpufeatures.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomicoperations.h>
+#include <bsls_performancehint.h>
+#include <bsls_platform.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_climits.h>
+#include <bsl_cstring.h>
+
+#if defined(BSLS_PLATFORM_CPU_X86_64)                                         \
+ && (defined(BSLS_PLATFORM_CMP_CLANG)                                         \
+  || (defined(BSLS_PLATFORM_CMP_GNU) && BSLS_PLATFORM_CMP_VERSION >= 40900))
+#define U_VECTORIZED_KERNELS
+    // Vectorized encoding and decoding kernels, selected at run time, are
+    // available.
+#include <immintrin.h>
+#endif
+
+///Implementation Notes
+///--------------------
+// Encoding processes the input in 3-byte groups, each producing 4
+// characters.  The vectorized kernels (see Mula and Lemire, cited in the
+// component documentation) shuffle each group into a 32-bit lane, extract the
+// four 6-bit indices using two multiplications, and translate the indices to
+// characters by adding an offset looked up, with 'pshufb', from a 16-entry
+// table indexed by the range into which each index falls.
+//
+// Decoding validates and translates characters using two 16-entry tables
+// indexed by the low and high nibbles of each character; a character is
+// outside the alphabet exactly when the two looked-up bit sets intersect.  A
+// vector block is decoded only if all of its characters are in the alphabet,
+// so a block containing whitespace, padding, or an invalid character, and
+// any input too short to fill a block, is left to the portable code, which
+// decodes one 4-character quantum at a time, skipping whitespace.  The
+// portable code returns to the vectorized kernel after each quantum, and hands
+// the input over to a 'Base64Decoder' at the first quantum it cannot decode
+// (i.e., one that contains padding or an invalid character, or that is
+// incomplete).  Since every quantum decoded so far is complete, the state of
+// a newly created 'Base64Decoder' is exactly the state that the streaming
+// decoder would have at that point, and so the bulk decoder applies exactly
+// the same rules, and reports exactly the same errors, as the streaming one.
+
+namespace BloombergLP {
+namespace {
+
+const char k_ENCODING[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+                          "abcdefghijklmnopqrstuvwxyz"
+                          "0123456789+/";
+    // Map from 6-bit values to Base64 characters.
+
+const unsigned char xx = 0xff;  // not part of Base64
+const unsigned char ws = 0x40;  // whitespace
+
+const unsigned char k_DECODING[256] = {
+    // Map from characters to 6-bit values, 'ws' for whitespace, or 'xx' for
+    // any other character (including '=').
+
+    //  0   1   2   3   4   5   6   7   8   9   A   B   C   D   E   F
+    // --  --  --  --  --  --  --  --  --  --  --  --  --  --  --  --
+       xx, xx, xx, xx, xx, xx, xx, xx, xx, ws, ws, ws, ws, ws, xx, xx,  // 00
+       xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx,  // 10
+       ws, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, 62, xx, xx, xx, 63,  // 20
+       52, 53, 54, 55, 56, 57, 58, 59, 60, 61, xx, xx, xx, xx, xx, xx,  // 30
+       xx,  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14,  // 40
+       15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, xx, xx, xx, xx, xx,  // 50
+       xx, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,  // 60
+       41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, xx, xx, xx, xx, xx,  // 70
+       xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx,  // 80
+       xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx,  // 90
+       xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx,  // A0
+       xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx,  // B0
+       xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx,  // C0
+       xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx,  // D0
+       xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx,  // E0
+       xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx, xx,  // F0
+};
+
+enum {
+    k_KERNEL_UNKNOWN  = 0,  // kernel not yet selected
+    k_KERNEL_PORTABLE = 1,  // no vectorized kernel available
+    k_KERNEL_SSSE3    = 2,  // 16 characters per iteration
+    k_KERNEL_AVX2     = 3   // 32 characters per iteration
+};
+
+bsls::AtomicOperations::AtomicTypes::Int s_kernel;
+    // The kernel used by 'Base64Util', or 'k_KERNEL_UNKNOWN' if it has not
+    // been selected yet.  Note that, as selection is idempotent, concurrent
+    // first calls may race to set this value without harm.
+
+int selectKernel()
+    // Return the fastest kernel supported by the CPU on which this process is
+    // running.
+{
+#if defined(U_VECTORIZED_KERNELS)
+    typedef bdlde::Simd_CpuFeatures Features;
+
+    if (!Features::isSupported(Features::e_SSSE3)) {
+        return k_KERNEL_PORTABLE;                                     // RETURN
+    }
+
+    return Features::isSupported(Features::e_AVX2) ? k_KERNEL_AVX2
+                                                   : k_KERNEL_SSSE3;
+#else
+    return k_KERNEL_PORTABLE;
+#endif
+}
+
+int kernel()
+    // Return the kernel to be used on the CPU on which this process is
+    // running.
+{
+    int result = bsls::AtomicOperations::getIntRelaxed(&s_kernel);
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(k_KERNEL_UNKNOWN == result)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        result = selectKernel();
+        bsls::AtomicOperations::setIntRelaxed(&s_kernel, result);
+    }
+    return result;
+}
+
+#if defined(U_VECTORIZED_KERNELS)
+__attribute__((target("ssse3")))
+inline
+__m128i encodeVector(__m128i input)
+    // Return the 16 Base64 characters encoding the 12 bytes in the low 12
+    // bytes of the specified 'input'.
+{
+    // Place bytes '[b1 b0 b2 b1]' of each group of 3 in a 32-bit lane, then
+    // move each 6-bit index into its own byte using multiplications in place
+    // of variable shifts.
+
+    const __m128i shuffled = _mm_shuffle_epi8(
+                                  input,
+                                  _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4,
+                                                7, 6, 8, 7, 10, 9, 11, 10));
+    const __m128i t0 = _mm_and_si128(shuffled, _mm_set1_epi32(0x0fc0fc00));
+    const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+    const __m128i t2 = _mm_and_si128(shuffled, _mm_set1_epi32(0x003f03f0));
+    const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+    const __m128i indices = _mm_or_si128(t1, t3);
+
+    // Map 0..25 to 13, 26..51 to 0, 52..61 to 1..10, 62 to 11, and 63 to 12,
+    // and look up the offset from each index to its character.
+
+    __m128i range = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+    range = _mm_or_si128(range,
+                         _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26),
+                                                      indices),
+                                       _mm_set1_epi8(13)));
+    const __m128i offsets = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52,
+                                          '0' - 52, '0' - 52, '0' - 52,
+                                          '0' - 52, '0' - 52, '0' - 52,
+                                          '0' - 52, '0' - 52, '+' - 62,
+                                          '/' - 63, 'A', 0, 0);
+    return _mm_add_epi8(indices, _mm_shuffle_epi8(offsets, range));
+}
+
+__attribute__((target("ssse3")))
+bsl::size_t encodeSsse3(char *output, const char *input, bsl::size_t length)
+    // Load into the specified 'output' the Base64 encoding of a prefix of the
+    // specified 'input' having the specified 'length' bytes, and return the
+    // length of the prefix, which is a multiple of 3.
+{
+    bsl::size_t consumed = 0;
+    for (; length - consumed >= 16; consumed += 12, output += 16) {
+        const __m128i in = _mm_loadu_si128(
+                          reinterpret_cast<const __m128i *>(input + consumed));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(output),
+                         encodeVector(in));
+    }
+    return consumed;
+}
+
+__attribute__((target("avx2")))
+bsl::size_t encodeAvx2(char *output, const char *input, bsl::size_t length)
+    // Load into the specified 'output' the Base64 encoding of a prefix of the
+    // specified 'input' having the specified 'length' bytes, and return the
+    // length of the prefix, which is a multiple of 3.
+{
+    const __m256i shuffle = _mm256_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4,
+                                             7, 6, 8, 7, 10, 9, 11, 10,
+                                             1, 0, 2, 1, 4, 3, 5, 4,
+                                             7, 6, 8, 7, 10, 9, 11, 10);
+    const __m256i offsets = _mm256_setr_epi8('a' - 26, '0' - 52, '0' - 52,
+                                             '0' - 52, '0' - 52, '0' - 52,
+                                             '0' - 52, '0' - 52, '0' - 52,
+                                             '0' - 52, '0' - 52, '+' - 62,
+                                             '/' - 63, 'A', 0, 0,
+                                             'a' - 26, '0' - 52, '0' - 52,
+                                             '0' - 52, '0' - 52, '0' - 52,
+                                             '0' - 52, '0' - 52, '0' - 52,
+                                             '0' - 52, '0' - 52, '+' - 62,
+                                             '/' - 63, 'A', 0, 0);
+
+    bsl::size_t consumed = 0;
+    for (; length - consumed >= 28; consumed += 24, output += 32) {
+        const __m128i *in = reinterpret_cast<const __m128i *>(input
+                                                              + consumed);
+        const __m256i bytes = _mm256_inserti128_si256(
+               _mm256_castsi128_si256(_mm_loadu_si128(in)),
+               _mm_loadu_si128(reinterpret_cast<const __m128i *>(input
+                                                                 + consumed
+                                                                 + 12)),
+               1);
+
+        const __m256i shuffled = _mm256_shuffle_epi8(bytes, shuffle);
+        const __m256i t0 = _mm256_and_si256(shuffled,
+                                            _mm256_set1_epi32(0x0fc0fc00));
+        const __m256i t1 = _mm256_mulhi_epu16(t0,
+                                              _mm256_set1_epi32(0x04000040));
+        const __m256i t2 = _mm256_and_si256(shuffled,
+                                            _mm256_set1_epi32(0x003f03f0));
+        const __m256i t3 = _mm256_mullo_epi16(t2,
+                                              _mm256_set1_epi32(0x01000010));
+        const __m256i indices = _mm256_or_si256(t1, t3);
+
+        __m256i range = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+        range = _mm256_or_si256(
+                     range,
+                     _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(26),
+                                                        indices),
+                                      _mm256_set1_epi8(13)));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(output),
+                            _mm256_add_epi8(indices,
+                                            _mm256_shuffle_epi8(offsets,
+                                                                range)));
+    }
+
+    // Avoid the penalty for mixing AVX and SSE instructions.
+
+    _mm256_zeroupper();
+    return consumed + encodeSsse3(output, input + consumed, length - consumed);
+}
+
+__attribute__((target("ssse3")))
+bsl::size_t decodeSsse3(char *output, const char *input, bsl::size_t length)
+    // Decode into the specified 'output' the longest prefix of the specified
+    // 'input' having the specified 'length' characters that consists of
+    // whole 16-character blocks containing only characters of the Base64
+    // alphabet, and return the length of the prefix.
+{
+    const __m128i lowBits   = _mm_setr_epi8(0x15, 0x11, 0x11, 0x11,
+                                            0x11, 0x11, 0x11, 0x11,
+                                            0x11, 0x11, 0x13, 0x1a,
+                                            0x1b, 0x1b, 0x1b, 0x1a);
+    const __m128i highBits  = _mm_setr_epi8(0x10, 0x10, 0x01, 0x02,
+                                            0x04, 0x08, 0x04, 0x08,
+                                            0x10, 0x10, 0x10, 0x10,
+                                            0x10, 0x10, 0x10, 0x10);
+    const __m128i offsets   = _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71,
+                                            0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i nibble    = _mm_set1_epi8(0x0f);
+    const __m128i pack      = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8,
+                                            14, 13, 12, -1, -1, -1, -1);
+
+    bsl::size_t consumed = 0;
+    for (; length - consumed >= 16; consumed += 16, output += 12) {
+        const __m128i in = _mm_loadu_si128(
+                          reinterpret_cast<const __m128i *>(input + consumed));
+        const __m128i high = _mm_and_si128(_mm_srli_epi32(in, 4), nibble);
+        const __m128i low  = _mm_and_si128(in, nibble);
+
+        const __m128i invalid = _mm_and_si128(_mm_shuffle_epi8(lowBits, low),
+                                              _mm_shuffle_epi8(highBits,
+                                                               high));
+        if (0xffff != _mm_movemask_epi8(
+                              _mm_cmpeq_epi8(invalid, _mm_setzero_si128()))) {
+            break;
+        }
+
+        // '+' and '/' share the high nibble 2; distinguish '/' by adjusting
+        // its index into 'offsets'.
+
+        const __m128i slash  = _mm_cmpeq_epi8(in, _mm_set1_epi8('/'));
+        const __m128i values = _mm_add_epi8(
+                                    in,
+                                    _mm_shuffle_epi8(offsets,
+                                                     _mm_add_epi8(slash,
+                                                                  high)));
+
+        // Pack the four 6-bit values of each 32-bit lane into 3 bytes.
+
+        const __m128i pairs = _mm_maddubs_epi16(values,
+                                                _mm_set1_epi32(0x01400140));
+        const __m128i words = _mm_madd_epi16(pairs,
+                                             _mm_set1_epi32(0x00011000));
+        const __m128i bytes = _mm_shuffle_epi8(words, pack);
+
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(output), bytes);
+        const int last = _mm_cvtsi128_si32(_mm_srli_si128(bytes, 8));
+        bsl::memcpy(output + 8, &last, 4);
+    }
+    return consumed;
+}
+
+__attribute__((target("avx2")))
+bsl::size_t decodeAvx2(char *output, const char *input, bsl::size_t length)
+    // Decode into the specified 'output' the longest prefix of the specified
+    // 'input' having the specified 'length' characters that consists of
+    // whole 32-character blocks, followed by at most one 16-character block,
+    // containing only characters of the Base64 alphabet, and return the
+    // length of the prefix.
+{
+    const __m256i lowBits  = _mm256_setr_epi8(0x15, 0x11, 0x11, 0x11,
+                                              0x11, 0x11, 0x11, 0x11,
+                                              0x11, 0x11, 0x13, 0x1a,
+                                              0x1b, 0x1b, 0x1b, 0x1a,
+                                              0x15, 0x11, 0x11, 0x11,
+                                              0x11, 0x11, 0x11, 0x11,
+                                              0x11, 0x11, 0x13, 0x1a,
+                                              0x1b, 0x1b, 0x1b, 0x1a);
+    const __m256i highBits = _mm256_setr_epi8(0x10, 0x10, 0x01, 0x02,
+                                              0x04, 0x08, 0x04, 0x08,
+                                              0x10, 0x10, 0x10, 0x10,
+                                              0x10, 0x10, 0x10, 0x10,
+                                              0x10, 0x10, 0x01, 0x02,
+                                              0x04, 0x08, 0x04, 0x08,
+                                              0x10, 0x10, 0x10, 0x10,
+                                              0x10, 0x10, 0x10, 0x10);
+    const __m256i offsets  = _mm256_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71,
+                                              0, 0, 0, 0, 0, 0, 0, 0,
+                                              0, 16, 19, 4, -65, -65, -71, -71,
+                                              0, 0, 0, 0, 0, 0, 0, 0);
+    const __m256i nibble   = _mm256_set1_epi8(0x0f);
+    const __m256i pack     = _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8,
+                                              14, 13, 12, -1, -1, -1, -1,
+                                              2, 1, 0, 6, 5, 4, 10, 9, 8,
+                                              14, 13, 12, -1, -1, -1, -1);
+    const __m256i compact  = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7);
+
+    bsl::size_t consumed = 0;
+    for (; length - consumed >= 32; consumed += 32, output += 24) {
+        const __m256i in = _mm256_loadu_si256(
+                          reinterpret_cast<const __m256i *>(input + consumed));
+        const __m256i high = _mm256_and_si256(_mm256_srli_epi32(in, 4),
+                                              nibble);
+        const __m256i low  = _mm256_and_si256(in, nibble);
+
+        const __m256i invalid = _mm256_and_si256(
+                                      _mm256_shuffle_epi8(lowBits, low),
+                                      _mm256_shuffle_epi8(highBits, high));
+        if (!_mm256_testz_si256(invalid, invalid)) {
+            break;
+        }
+
+        const __m256i slash  = _mm256_cmpeq_epi8(in, _mm256_set1_epi8('/'));
+        const __m256i values = _mm256_add_epi8(
+                                 in,
+                                 _mm256_shuffle_epi8(offsets,
+                                                     _mm256_add_epi8(slash,
+                                                                     high)));
+
+        const __m256i pairs = _mm256_maddubs_epi16(
+                                            values,
+                                            _mm256_set1_epi32(0x01400140));
+        const __m256i words = _mm256_madd_epi16(pairs,
+                                                _mm256_set1_epi32(0x00011000));
+        const __m256i bytes = _mm256_permutevar8x32_epi32(
+                                      _mm256_shuffle_epi8(words, pack),
+                                      compact);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(output),
+                         _mm256_castsi256_si128(bytes));
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(output + 16),
+                         _mm256_extracti128_si256(bytes, 1));
+    }
+
+    // Avoid the penalty for mixing AVX and SSE instructions.
+
+    _mm256_zeroupper();
+    return consumed + decodeSsse3(output, input + consumed, length - consumed);
+}
+#endif
+
+void encodeImpl(char        *output,
+                const char  *input,
+                bsl::size_t  length,
+                int          kernel)
+    // Load into the specified 'output' the Base64 encoding of the specified
+    // 'input' having the specified 'length' bytes, using the specified
+    // 'kernel'.
+{
+#if defined(U_VECTORIZED_KERNELS)
+    bsl::size_t consumed = 0;
+    switch (kernel) {
+      case k_KERNEL_AVX2: {
+        consumed = encodeAvx2(output, input, length);
+      } break;
+      case k_KERNEL_SSSE3: {
+        consumed = encodeSsse3(output, input, length);
+      } break;
+    }
+    output += consumed / 3 * 4;
+    input  += consumed;
+    length -= consumed;
+#else
+    (void)kernel;
+#endif
+
+    const unsigned char *in  = reinterpret_cast<const unsigned char *>(input);
+    const unsigned char *end = in + length / 3 * 3;
+    for (; in != end; in += 3, output += 4) {
+        const unsigned int group = in[0] << 16 | in[1] << 8 | in[2];
+        output[0] = k_ENCODING[group >> 18];
+        output[1] = k_ENCODING[group >> 12 & 0x3f];
+        output[2] = k_ENCODING[group >>  6 & 0x3f];
+        output[3] = k_ENCODING[group       & 0x3f];
+    }
+
+    switch (length % 3) {
+      case 1: {
+        output[0] = k_ENCODING[in[0] >> 2];
+        output[1] = k_ENCODING[(in[0] & 0x03) << 4];
+        output[2] = '=';
+        output[3] = '=';
+      } break;
+      case 2: {
+        output[0] = k_ENCODING[in[0] >> 2];
+        output[1] = k_ENCODING[(in[0] & 0x03) << 4 | in[1] >> 4];
+        output[2] = k_ENCODING[(in[1] & 0x0f) << 2];
+        output[3] = '=';
+      } break;
+    }
+}
+
+int decodeImpl(char        *output,
+               bsl::size_t *numOut,
+               const char  *input,
+               bsl::size_t  length,
+               int          kernel)
+    // Decode the Base64 representation in the specified 'input' having the
+    // specified 'length' characters into the specified 'output', using the
+    // specified 'kernel', and load into the specified 'numOut' the number of
+    // bytes written.  Return 0 on success, and a non-zero value otherwise.
+{
+    char       *out = output;
+    const char *end = input + length;
+
+    for (;;) {
+#if defined(U_VECTORIZED_KERNELS)
+        bsl::size_t consumed = 0;
+        switch (kernel) {
+          case k_KERNEL_AVX2: {
+            consumed = decodeAvx2(out, input, end - input);
+          } break;
+          case k_KERNEL_SSSE3: {
+            consumed = decodeSsse3(out, input, end - input);
+          } break;
+        }
+        out   += consumed / 4 * 3;
+        input += consumed;
+#else
+        (void)kernel;
+#endif
+
+        // Decode one quantum, skipping whitespace.
+
+        const char   *next    = input;
+        unsigned int  quantum = 0;
+        int           count   = 0;
+        while (count != 4 && next != end) {
+            const unsigned char value =
+                            k_DECODING[static_cast<unsigned char>(*next)];
+            if (value < 64) {
+                quantum = quantum << 6 | value;
+                ++count;
+            }
+            else if (ws != value) {
+                break;
+            }
+            ++next;
+        }
+        if (4 != count) {
+            break;
+        }
+        out[0] = static_cast<char>(quantum >> 16);
+        out[1] = static_cast<char>(quantum >>  8);
+        out[2] = static_cast<char>(quantum);
+        out   += 3;
+        input  = next;
+    }
+
+    // Let the streaming decoder apply the rules for padding, errors, and
+    // incomplete input to the remainder, starting from a quantum boundary.
+
+    bdlde::Base64Decoder decoder(true);
+    while (input != end) {
+        const int chunk = static_cast<int>(
+                 bsl::min<bsl::size_t>(end - input, INT_MAX / 4 * 3));
+        int       chunkOut;
+        int       chunkIn;
+        if (0 > decoder.convert(out,
+                                &chunkOut,
+                                &chunkIn,
+                                input,
+                                input + chunk)) {
+            return -1;                                                // RETURN
+        }
+        out   += chunkOut;
+        input += chunk;
+    }
+
+    int endOut;
+    if (0 != decoder.endConvert(out, &endOut)) {
+        return -1;                                                    // RETURN
+    }
+    out += endOut;
+
+    *numOut = out - output;
+    return 0;
+}
+
+}  // close unnamed namespace
+
+namespace bdlde {
+
+                              // -----------------
+                              // struct Base64Util
+                              // -----------------
+
+// CLASS METHODS
+void Base64Util::encode(char        *output,
+                        const char  *input,
+                        bsl::size_t  inputLength)
+{
+    BSLS_ASSERT(output || 0 == inputLength);
+    BSLS_ASSERT(input  || 0 == inputLength);
+
+    encodeImpl(output, input, inputLength, kernel());
+}
+
+int Base64Util::decode(char        *output,
+                       bsl::size_t *numOut,
+                       const char  *input,
+                       bsl::size_t  inputLength)
+{
+    BSLS_ASSERT(numOut);
+    BSLS_ASSERT(input  || 0 == inputLength);
+
+    return decodeImpl(output, numOut, input, inputLength, kernel());
+}
+
+                           // ----------------------
+                           // struct Base64Util_Impl
+                           // ----------------------
+
+// CLASS METHODS
+void Base64Util_Impl::encodePortable(char        *output,
+                                     const char  *input,
+                                     bsl::size_t  inputLength)
+{
+    BSLS_ASSERT(output || 0 == inputLength);
+    BSLS_ASSERT(input  || 0 == inputLength);
+
+    encodeImpl(output, input, inputLength, k_KERNEL_PORTABLE);
+}
+
+int Base64Util_Impl::decodePortable(char        *output,
+                                    bsl::size_t *numOut,
+                                    const char  *input,
+                                    bsl::size_t  inputLength)
+{
+    BSLS_ASSERT(numOut);
+    BSLS_ASSERT(input  || 0 == inputLength);
+
+    return decodeImpl(output, numOut, input, inputLength, k_KERNEL_PORTABLE);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
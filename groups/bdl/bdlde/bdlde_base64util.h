@@ -0,0 +1,220 @@
+// bdlde_base64util.h                                                 -*-C++-*-
+#ifndef INCLUDED_BDLDE_BASE64UTIL
+#define INCLUDED_BDLDE_BASE64UTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$")
+
+//@PURPOSE: Provide bulk Base64 encoding and decoding of contiguous buffers.
+//
+//@CLASSES:
+//  bdlde::Base64Util     : bulk Base64 encoding and decoding utilities
+//  bdlde::Base64Util_Impl: portable implementations for testing/benchmarking
+//
+//@SEE_ALSO: bdlde_base64encoder, bdlde_base64decoder
+//
+//@DESCRIPTION: This component provides a 'struct', 'bdlde::Base64Util', that
+// encodes a contiguous buffer of bytes into its Base64 representation, and
+// decodes such a representation back into bytes, in a single call.  The
+// encoding and the rules applied when decoding are those of
+// 'bdlde::Base64Encoder' (having a maximum line length of 0) and of
+// 'bdlde::Base64Decoder' (configured to report unrecognized characters as
+// errors), respectively, and the results are identical: encoded output is
+// padded with '=' and contains no line breaks, and decoding ignores
+// whitespace, rejects any other character outside the Base64 alphabet, and
+// validates the padding.
+//
+// Where the input is available as a contiguous buffer and the output can be
+// pre-sized, 'bdlde::Base64Util' is substantially faster than the streaming
+// 'bdlde::Base64Encoder' and 'bdlde::Base64Decoder' mechanisms, which remain
+// the appropriate tools for segmented input, line-wrapped output, and
+// arbitrary iterators.  The 'encodedLength' and 'maxDecodedLength' class
+// methods give the size of the output buffer to supply.
+//
+// 'bdlde::Base64Util_Impl' exposes the portable implementations used on
+// platforms lacking vector instructions; it should not be used other than to
+// test and benchmark.
+//
+///Thread Safety
+///-------------
+// Thread safe.
+//
+///Support for Hardware Acceleration
+///---------------------------------
+// On x86-64 CPUs, the bulk of the input is processed using the vectorized
+// algorithms of Wojciech Mula and Daniel Lemire, "Faster Base64 Encoding and
+// Decoding Using AVX2 Instructions" (ACM TOWEB, 2018): a kernel using AVX2
+// encodes 24 bytes, or decodes 32 characters, per iteration, and a kernel
+// using SSSE3 half as many.  The kernel is selected at run time based on the
+// capabilities of the CPU; the remainder of the input, and the entire input
+// on other platforms, is processed by portable code.  Decoding falls back to
+// portable code at the first whitespace, padding, or invalid character, and
+// resumes vectorized processing once the input is again aligned on a 4-char
+// quantum.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Round-Tripping a Binary Value
+/// - - - - - - - - - - - - - - - - - - - -
+// Suppose we need to embed a binary value in a text document and later
+// retrieve it.  First, we size a string using 'encodedLength' and encode the
+// value into it:
+//..
+//  const char        binary[] = { 'a', 'b', 'c', 'd', '\0', '\xff' };
+//  const bsl::size_t length   = sizeof binary;
+//
+//  bsl::string encoded(bdlde::Base64Util::encodedLength(length), '\0');
+//  bdlde::Base64Util::encode(&encoded[0], binary, length);
+//
+//  assert("YWJjZAD/" == encoded);
+//..
+// Then, we size a buffer using 'maxDecodedLength', decode the text, and trim
+// the buffer to the number of bytes actually decoded:
+//..
+//  bsl::vector<char> decoded(
+//                   bdlde::Base64Util::maxDecodedLength(encoded.length()));
+//  bsl::size_t numOut;
+//
+//  int rc = bdlde::Base64Util::decode(decoded.data(),
+//                                     &numOut,
+//                                     encoded.data(),
+//                                     encoded.length());
+//  assert(0 == rc);
+//
+//  decoded.resize(numOut);
+//  assert(length == decoded.size());
+//  assert(bsl::equal(binary, binary + length, decoded.begin()));
+//..
+// Finally, we observe that malformed input is reported as an error:
+//..
+//  rc = bdlde::Base64Util::decode(decoded.data(), &numOut, "YW*j", 4);
+//  assert(0 != rc);
+//..
+
+#include <bdlscm_version.h>
+
+#include <bsl_cstddef.h>
+
+namespace BloombergLP {
+namespace bdlde {
+
+                              // =================
+                              // struct Base64Util
+                              // =================
+
+struct Base64Util {
+    // This 'struct' provides a namespace for utility functions that encode
+    // and decode contiguous buffers to and from their Base64 representation.
+
+    // CLASS METHODS
+    static bsl::size_t encodedLength(bsl::size_t inputLength);
+        // Return the exact number of characters produced by 'encode' for an
+        // input of the specified 'inputLength' bytes.
+
+    static bsl::size_t maxDecodedLength(bsl::size_t inputLength);
+        // Return the maximum number of bytes produced by 'decode' for an
+        // input of the specified 'inputLength' characters.  Note that the
+        // value returned is exact for unpadded input containing no
+        // whitespace.
+
+    static void encode(char        *output,
+                       const char  *input,
+                       bsl::size_t  inputLength);
+        // Load into the specified 'output' the padded Base64 encoding,
+        // containing no line breaks, of the specified 'input' having the
+        // specified 'inputLength' bytes.  The behavior is undefined unless
+        // 'output' can hold 'encodedLength(inputLength)' characters, and the
+        // output and input ranges do not overlap.  Note that the result is
+        // identical to that of 'Base64Encoder', having a maximum line length
+        // of 0, applied to the same input.
+
+    static int decode(char        *output,
+                      bsl::size_t *numOut,
+                      const char  *input,
+                      bsl::size_t  inputLength);
+        // Decode the Base64 representation in the specified 'input' having
+        // the specified 'inputLength' characters into the specified 'output',
+        // and load into the specified 'numOut' the number of bytes written.
+        // Whitespace characters in 'input' are ignored.  Return 0 on
+        // success, and a non-zero value if 'input' contains a character that
+        // is neither whitespace nor part of the Base64 alphabet, has invalid
+        // padding, or does not end on a complete quantum, in which case the
+        // contents of 'output' and 'numOut' are unspecified.  The behavior is
+        // undefined unless 'output' can hold 'maxDecodedLength(inputLength)'
+        // bytes, and the output and input ranges do not overlap.  Note that
+        // the result is identical to that of 'Base64Decoder', configured to
+        // treat unrecognized characters as errors, applied to the same input
+        // followed by 'endConvert'.
+};
+
+                           // ======================
+                           // struct Base64Util_Impl
+                           // ======================
+
+struct Base64Util_Impl {
+    // This 'struct' provides the portable implementations of the utility
+    // functions in 'Base64Util'.  It should not be used other than to test
+    // and benchmark.
+
+    // CLASS METHODS
+    static void encodePortable(char        *output,
+                               const char  *input,
+                               bsl::size_t  inputLength);
+        // Load into the specified 'output' the Base64 encoding of the
+        // specified 'input' having the specified 'inputLength' bytes, as
+        // 'Base64Util::encode' does, without using vector instructions.
+
+    static int decodePortable(char        *output,
+                              bsl::size_t *numOut,
+                              const char  *input,
+                              bsl::size_t  inputLength);
+        // Decode the Base64 representation in the specified 'input' having
+        // the specified 'inputLength' characters into the specified 'output',
+        // loading into the specified 'numOut' the number of bytes written, as
+        // 'Base64Util::decode' does, without using vector instructions.
+        // Return 0 on success, and a non-zero value otherwise.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                              // -----------------
+                              // struct Base64Util
+                              // -----------------
+
+// CLASS METHODS
+inline
+bsl::size_t Base64Util::encodedLength(bsl::size_t inputLength)
+{
+    return (inputLength + 2) / 3 * 4;
+}
+
+inline
+bsl::size_t Base64Util::maxDecodedLength(bsl::size_t inputLength)
+{
+    return inputLength / 4 * 3 + (inputLength % 4) * 3 / 4;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,784 @@
+// bdlde_base64util.t.cpp                                             -*-C++-*-
+#include <bdlde_base64util.h>
+
+#include <bdlde_base64decoder.h>
+#include <bdlde_base64encoder.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                 TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test provides utility functions that encode and decode
+// contiguous buffers to and from Base64 in a single call, using vectorized
+// kernels selected at run time where available.  The results must be
+// identical to those of the streaming 'bdlde::Base64Encoder' (with no line
+// breaks) and 'bdlde::Base64Decoder' (reporting unrecognized characters as
+// errors), which serve as oracles.  Since the vectorized kernels process the
+// input in blocks, and hand over to portable code at block boundaries and at
+// the first character outside the alphabet, we must test inputs of every
+// length around the block sizes, and characters to be skipped or rejected at
+// every position.  'bdlde::Base64Util_Impl' exposes the portable
+// implementations, which must produce the same results.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] bsl::size_t Base64Util::encodedLength(bsl::size_t);
+// [ 2] bsl::size_t Base64Util::maxDecodedLength(bsl::size_t);
+// [ 3] void Base64Util::encode(char *, const char *, bsl::size_t);
+// [ 4] int Base64Util::decode(char *, size_t *, const char *, size_t);
+// [ 3] void Base64Util_Impl::encodePortable(char *, const char *, size_t);
+// [ 4] int Base64Util_Impl::decodePortable(char*, size_t*, const char*, n)
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlde::Base64Util      Util;
+typedef bdlde::Base64Util_Impl Impl;
+
+// ============================================================================
+//                    GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+bsl::string streamEncode(const bsl::string& input)
+    // Return the Base64 encoding of the specified 'input' produced by a
+    // 'bdlde::Base64Encoder' having a maximum line length of 0.
+{
+    const int length = static_cast<int>(input.size());
+
+    bdlde::Base64Encoder encoder(0);
+    bsl::string output(bdlde::Base64Encoder::encodedLength(length, 0), '\0');
+
+    int numOut;
+    int numIn;
+    encoder.convert(output.begin(),
+                    &numOut,
+                    &numIn,
+                    input.begin(),
+                    input.end());
+    encoder.endConvert(output.begin() + numOut);
+    return output;
+}
+
+int streamDecode(bsl::string *output, const bsl::string& input)
+    // Load into the specified 'output' the decoding of the specified 'input'
+    // produced by a 'bdlde::Base64Decoder' reporting unrecognized characters
+    // as errors.  Return 0 on success, and a non-zero value otherwise.
+{
+    bdlde::Base64Decoder decoder(true);
+    output->clear();
+
+    bsl::back_insert_iterator<bsl::string> out(*output);
+    if (0 > decoder.convert(out, input.begin(), input.end())) {
+        return -1;                                                    // RETURN
+    }
+    return decoder.endConvert(out);
+}
+
+bsl::string makeBytes(bsl::size_t length, unsigned int seed)
+    // Return a string of the specified 'length' bytes generated from the
+    // specified 'seed'.
+{
+    bsl::string result(length, '\0');
+    for (bsl::size_t i = 0; i != length; ++i) {
+        seed      = seed * 1103515245 + 12345;
+        result[i] = static_cast<char>(seed >> 16);
+    }
+    return result;
+}
+
+void verifyDecode(int line, const bsl::string& input)
+    // Verify that 'Base64Util::decode' and 'Base64Util_Impl::decodePortable'
+    // both agree with 'streamDecode' on the specified 'input', reporting
+    // failures against the specified 'line', and do not write beyond the
+    // buffer size given by 'maxDecodedLength'.
+{
+    bsl::string expected;
+    const int   expectedRc = streamDecode(&expected, input);
+
+    for (int portable = 0; portable != 2; ++portable) {
+        const bsl::size_t size = Util::maxDecodedLength(input.size());
+        bsl::vector<char> output(size + 1, '#');
+        bsl::size_t       numOut = 0;
+
+        const int rc = portable
+                     ? Impl::decodePortable(output.data(),
+                                            &numOut,
+                                            input.data(),
+                                            input.size())
+                     : Util::decode(output.data(),
+                                    &numOut,
+                                    input.data(),
+                                    input.size());
+
+        ASSERTV(line, portable, input, expectedRc, rc,
+                (0 == expectedRc) == (0 == rc));
+        ASSERTV(line, portable, '#' == output[size]);
+        if (0 == rc && 0 == expectedRc) {
+            ASSERTV(line, portable, input, expected.size(), numOut,
+                    expected == bsl::string(output.data(), numOut));
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Round-Tripping a Binary Value
+/// - - - - - - - - - - - - - - - - - - - -
+// Suppose we need to embed a binary value in a text document and later
+// retrieve it.  First, we size a string using 'encodedLength' and encode the
+// value into it:
+//..
+    const char        binary[] = { 'a', 'b', 'c', 'd', '\0', '\xff' };
+    const bsl::size_t length   = sizeof binary;
+
+    bsl::string encoded(bdlde::Base64Util::encodedLength(length), '\0');
+    bdlde::Base64Util::encode(&encoded[0], binary, length);
+
+    ASSERT("YWJjZAD/" == encoded);
+//..
+// Then, we size a buffer using 'maxDecodedLength', decode the text, and trim
+// the buffer to the number of bytes actually decoded:
+//..
+    bsl::vector<char> decoded(
+                     bdlde::Base64Util::maxDecodedLength(encoded.length()));
+    bsl::size_t numOut;
+
+    int rc = bdlde::Base64Util::decode(decoded.data(),
+                                       &numOut,
+                                       encoded.data(),
+                                       encoded.length());
+    ASSERT(0 == rc);
+
+    decoded.resize(numOut);
+    ASSERT(length == decoded.size());
+    ASSERT(bsl::equal(binary, binary + length, decoded.begin()));
+//..
+// Finally, we observe that malformed input is reported as an error:
+//..
+    rc = bdlde::Base64Util::decode(decoded.data(), &numOut, "YW*j", 4);
+    ASSERT(0 != rc);
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'decode'
+        //
+        // Concerns:
+        //: 1 Valid input of every length, around and across the block sizes
+        //:   of the vectorized kernels, is decoded as by 'Base64Decoder'.
+        //:
+        //: 2 Whitespace is skipped at every position, including within a
+        //:   quantum and in the padding, and decoding continues correctly
+        //:   after it, including for line-wrapped input.
+        //:
+        //: 3 A character outside the alphabet, misplaced or excess padding,
+        //:   non-zero padding bits, and incomplete input are reported as
+        //:   errors at every position.
+        //:
+        //: 4 Nothing is written beyond 'maxDecodedLength(inputLength)' bytes.
+        //:
+        //: 5 The portable implementation behaves identically.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using a table of representative inputs, verify the return code
+        //:   and output of 'decode' and 'decodePortable'.  (C-2..3, 5)
+        //:
+        //: 2 For every length from 0 to 200 bytes, encode a generated input
+        //:   and verify the decoding of the encoding, of the encoding with
+        //:   line breaks every 76 characters, of every prefix of the
+        //:   encoding, and of the encoding with each of several characters
+        //:   inserted at, or substituted for, every position, against
+        //:   'streamDecode' and, for unmodified input, against the original
+        //:   bytes.  A sentinel byte verifies that no excess output is
+        //:   written.  (C-1..5)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for null pointers.  (C-6)
+        //
+        // Testing:
+        //   int Base64Util::decode(char *, size_t *, const char *, size_t);
+        //   Base64Util_Impl::decodePortable(char*, size_t*, const char*, n)
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'decode'" << endl
+                          << "================" << endl;
+
+        if (verbose) cout << "\nTable-driven inputs." << endl;
+        {
+            static const struct {
+                int         d_line;
+                const char *d_input;
+                int         d_valid;
+                const char *d_output;
+            } DATA[] = {
+                //LN  INPUT                      VALID  OUTPUT
+                //--  -------------------------  -----  ----------
+                { L_, "",                        1,     ""          },
+                { L_, "   \r\n\t",               1,     ""          },
+                { L_, "YQ==",                    1,     "a"         },
+                { L_, "YWI=",                    1,     "ab"        },
+                { L_, "YWJj",                    1,     "abc"       },
+                { L_, "Y W\nJ j",                1,     "abc"       },
+                { L_, "YQ= =",                   1,     "a"         },
+                { L_, "YWJjZA==  \n",            1,     "abcd"      },
+                { L_, "YWJjZGVm",                1,     "abcdef"    },
+                { L_, "YQ",                      0,     ""          },
+                { L_, "YWI",                     0,     ""          },
+                { L_, "Y",                       0,     ""          },
+                { L_, "YQ=",                     0,     ""          },
+                { L_, "YR==",                    0,     ""          },
+                { L_, "YWJ=",                    0,     ""          },
+                { L_, "YQ===",                   0,     ""          },
+                { L_, "YQ==YQ==",                0,     ""          },
+                { L_, "=",                       0,     ""          },
+                { L_, "YW*j",                    0,     ""          },
+                { L_, "YWJj\x80",                0,     ""          },
+                { L_, "YWJj-_",                  0,     ""          },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE   = DATA[ti].d_line;
+                const bsl::string INPUT  = DATA[ti].d_input;
+                const bool        VALID  = DATA[ti].d_valid;
+                const bsl::string OUTPUT = DATA[ti].d_output;
+
+                if (veryVerbose) { T_ P_(LINE) P(INPUT) }
+
+                for (int portable = 0; portable != 2; ++portable) {
+                    char        output[16];
+                    bsl::size_t numOut = 0;
+
+                    const int rc = portable
+                                 ? Impl::decodePortable(output,
+                                                        &numOut,
+                                                        INPUT.data(),
+                                                        INPUT.size())
+                                 : Util::decode(output,
+                                                &numOut,
+                                                INPUT.data(),
+                                                INPUT.size());
+                    ASSERTV(LINE, portable, VALID == (0 == rc));
+                    if (VALID) {
+                        ASSERTV(LINE, portable,
+                                OUTPUT == bsl::string(output, numOut));
+                    }
+                }
+                verifyDecode(LINE, INPUT);
+            }
+        }
+
+        if (verbose) cout << "\nGenerated inputs." << endl;
+        {
+            const char INSERTED[] = { ' ', '\n', '\r', '=', '*', 'A', '\x80' };
+            const int  NUM_INSERTED = sizeof INSERTED;
+
+            for (bsl::size_t length = 0; length <= 200; ++length) {
+                const bsl::string BYTES   = makeBytes(length,
+                                                static_cast<unsigned>(length));
+                const bsl::string ENCODED = streamEncode(BYTES);
+
+                if (veryVerbose) { T_ P_(length) P(ENCODED) }
+
+                {
+                    bsl::vector<char> output(Util::maxDecodedLength(
+                                                             ENCODED.size()));
+                    bsl::size_t       numOut = 0;
+                    ASSERTV(length, 0 == Util::decode(output.data(),
+                                                      &numOut,
+                                                      ENCODED.data(),
+                                                      ENCODED.size()));
+                    ASSERTV(length, BYTES == bsl::string(output.data(),
+                                                         numOut));
+                }
+
+                verifyDecode(L_, ENCODED);
+
+                bsl::string wrapped;
+                for (bsl::size_t i = 0; i != ENCODED.size(); ++i) {
+                    wrapped.push_back(ENCODED[i]);
+                    if (75 == i % 76) {
+                        wrapped.append("\r\n");
+                    }
+                }
+                verifyDecode(L_, wrapped);
+
+                for (bsl::size_t i = 0; i < ENCODED.size(); ++i) {
+                    verifyDecode(L_, ENCODED.substr(0, i));
+
+                    for (int k = 0; k != NUM_INSERTED; ++k) {
+                        bsl::string inserted(ENCODED);
+                        inserted.insert(i, 1, INSERTED[k]);
+                        verifyDecode(L_, inserted);
+
+                        bsl::string substituted(ENCODED);
+                        substituted[i] = INSERTED[k];
+                        verifyDecode(L_, substituted);
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\nNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            char        output[4];
+            bsl::size_t numOut;
+
+            ASSERT_PASS(Util::decode(output, &numOut, "YWJj", 4));
+            ASSERT_FAIL(Util::decode(output,       0, "YWJj", 4));
+            ASSERT_FAIL(Util::decode(output, &numOut,      0, 4));
+            ASSERT_PASS(Util::decode(output, &numOut,      0, 0));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'encode'
+        //
+        // Concerns:
+        //: 1 Input of every length, around and across the block sizes of the
+        //:   vectorized kernels, and containing every byte value, is encoded
+        //:   as by 'Base64Encoder' having a maximum line length of 0.
+        //:
+        //: 2 Exactly 'encodedLength(inputLength)' characters are written.
+        //:
+        //: 3 The result does not depend on the alignment of the input or the
+        //:   output.
+        //:
+        //: 4 The portable implementation behaves identically.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Verify the encodings of the RFC 4648 test vectors.  (C-1)
+        //:
+        //: 2 For every length from 0 to 300 bytes and every alignment of the
+        //:   input and output modulo 4, compare the output of 'encode' and
+        //:   'encodePortable' with that of 'streamEncode', and verify that a
+        //:   sentinel following the output is unchanged.  (C-1..4)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for null pointers.  (C-5)
+        //
+        // Testing:
+        //   void Base64Util::encode(char *, const char *, bsl::size_t);
+        //   void Base64Util_Impl::encodePortable(char *, const char *, size_t)
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'encode'" << endl
+                          << "================" << endl;
+
+        if (verbose) cout << "\nRFC 4648 test vectors." << endl;
+        {
+            static const struct {
+                int         d_line;
+                const char *d_input;
+                const char *d_output;
+            } DATA[] = {
+                //LN  INPUT      OUTPUT
+                //--  --------   ----------
+                { L_, "",        ""         },
+                { L_, "f",       "Zg=="     },
+                { L_, "fo",      "Zm8="     },
+                { L_, "foo",     "Zm9v"     },
+                { L_, "foob",    "Zm9vYg==" },
+                { L_, "fooba",   "Zm9vYmE=" },
+                { L_, "foobar",  "Zm9vYmFy" },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE   = DATA[ti].d_line;
+                const char       *INPUT  = DATA[ti].d_input;
+                const bsl::size_t LENGTH = bsl::strlen(INPUT);
+                const bsl::string OUTPUT = DATA[ti].d_output;
+
+                bsl::string output(Util::encodedLength(LENGTH), '\0');
+                Util::encode(&output[0], INPUT, LENGTH);
+                ASSERTV(LINE, output, OUTPUT == output);
+
+                Impl::encodePortable(&output[0], INPUT, LENGTH);
+                ASSERTV(LINE, output, OUTPUT == output);
+            }
+        }
+
+        if (verbose) cout << "\nGenerated inputs." << endl;
+        {
+            for (bsl::size_t length = 0; length <= 300; ++length) {
+                const bsl::string BYTES    = makeBytes(length + 4,
+                                                static_cast<unsigned>(length));
+                const bsl::size_t SIZE     = Util::encodedLength(length);
+
+                for (bsl::size_t inOffset = 0; inOffset != 4; ++inOffset) {
+                    const bsl::string INPUT    = BYTES.substr(inOffset,
+                                                              length);
+                    const bsl::string EXPECTED = streamEncode(INPUT);
+                    ASSERTV(length, SIZE == EXPECTED.size());
+
+                    for (bsl::size_t outOffset = 0; outOffset != 4;
+                                                               ++outOffset) {
+                        for (int portable = 0; portable != 2; ++portable) {
+                            bsl::string output(SIZE + 5, '#');
+                            if (portable) {
+                                Impl::encodePortable(&output[outOffset],
+                                                     BYTES.data() + inOffset,
+                                                     length);
+                            }
+                            else {
+                                Util::encode(&output[outOffset],
+                                             BYTES.data() + inOffset,
+                                             length);
+                            }
+                            ASSERTV(length, inOffset, outOffset, portable,
+                                    EXPECTED == output.substr(outOffset,
+                                                              SIZE));
+                            ASSERTV(length, inOffset, outOffset, portable,
+                                    '#' == output[outOffset + SIZE]);
+                        }
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\nNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            char output[4];
+
+            ASSERT_PASS(Util::encode(output, "abc", 3));
+            ASSERT_FAIL(Util::encode(     0, "abc", 3));
+            ASSERT_FAIL(Util::encode(output,     0, 3));
+            ASSERT_PASS(Util::encode(     0,     0, 0));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'encodedLength' AND 'maxDecodedLength'
+        //
+        // Concerns:
+        //: 1 'encodedLength' returns the exact length of the encoding.
+        //:
+        //: 2 'maxDecodedLength' returns the exact length of the decoding of
+        //:   unpadded input containing no whitespace, and an upper bound
+        //:   otherwise.
+        //
+        // Plan:
+        //: 1 For lengths from 0 to 1000, compare 'encodedLength' with
+        //:   'Base64Encoder::encodedLength' having a maximum line length of 0,
+        //:   and verify that 'maxDecodedLength' of the encoded length is at
+        //:   least the original length, and exceeds it by at most 2.  (C-1..2)
+        //:
+        //: 2 Verify 'maxDecodedLength' for input lengths not divisible by 4,
+        //:   and for large lengths.  (C-2)
+        //
+        // Testing:
+        //   bsl::size_t Base64Util::encodedLength(bsl::size_t);
+        //   bsl::size_t Base64Util::maxDecodedLength(bsl::size_t);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                  << "TESTING 'encodedLength' AND 'maxDecodedLength'" << endl
+                  << "==============================================" << endl;
+
+        for (int length = 0; length <= 1000; ++length) {
+            const bsl::size_t LENGTH  = length;
+            const bsl::size_t ENCODED = Util::encodedLength(LENGTH);
+
+            ASSERTV(length, static_cast<bsl::size_t>(
+                         bdlde::Base64Encoder::encodedLength(length, 0)) ==
+                                                                     ENCODED);
+            ASSERTV(length, LENGTH     <= Util::maxDecodedLength(ENCODED));
+            ASSERTV(length, LENGTH + 2 >= Util::maxDecodedLength(ENCODED));
+        }
+
+        ASSERT(0 == Util::maxDecodedLength(0));
+        ASSERT(0 == Util::maxDecodedLength(1));
+        ASSERT(1 == Util::maxDecodedLength(2));
+        ASSERT(2 == Util::maxDecodedLength(3));
+        ASSERT(3 == Util::maxDecodedLength(4));
+        ASSERT(3 == Util::maxDecodedLength(5));
+
+        const bsl::size_t LARGE = static_cast<bsl::size_t>(1) << 40;
+        ASSERT(LARGE / 3 * 4 + 4 == Util::encodedLength(LARGE));
+        ASSERT(LARGE / 4 * 3     == Util::maxDecodedLength(LARGE));
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Encode and decode a short message.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        const char  INPUT[] = "Many hands make light work.";
+        const char  OUTPUT[] = "TWFueSBoYW5kcyBtYWtlIGxpZ2h0IHdvcmsu";
+        char        encoded[sizeof OUTPUT];
+        char        decoded[sizeof INPUT];
+        bsl::size_t numOut;
+
+        ASSERT(sizeof OUTPUT - 1 == Util::encodedLength(sizeof INPUT - 1));
+
+        Util::encode(encoded, INPUT, sizeof INPUT - 1);
+        ASSERT(0 == bsl::memcmp(OUTPUT, encoded, sizeof OUTPUT - 1));
+
+        ASSERT(0 == Util::decode(decoded, &numOut, OUTPUT, sizeof OUTPUT - 1));
+        ASSERT(sizeof INPUT - 1 == numOut);
+        ASSERT(0 == bsl::memcmp(INPUT, decoded, numOut));
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 Report the throughput of 'encode' and 'decode', of their
+        //:   portable implementations, and of the streaming encoder and
+        //:   decoder, for a 1 MB input.
+        //
+        // Plan:
+        //: 1 Time each operation over a 1 MB input, and over the same input
+        //:   encoded with line breaks every 76 characters, and print the
+        //:   throughputs in MB of binary data per second.
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE TEST" << endl
+             << "================" << endl;
+
+        const bsl::size_t k_SIZE = 1024 * 1024;
+        const int         k_REPS = 100;
+        const bsl::string BYTES  = makeBytes(k_SIZE, 1);
+
+        bsl::string encoded(Util::encodedLength(k_SIZE), '\0');
+        bsl::string wrapped;
+        bsl::vector<char> decoded(k_SIZE);
+        bsl::size_t       numOut;
+
+        bsls::Stopwatch timer;
+
+        timer.start();
+        for (int i = 0; i != k_REPS; ++i) {
+            Util::encode(&encoded[0], BYTES.data(), k_SIZE);
+        }
+        timer.stop();
+        cout << "encode:                 "
+             << k_REPS / timer.accumulatedWallTime() << " MB/s" << endl;
+
+        timer.reset();
+        timer.start();
+        for (int i = 0; i != k_REPS; ++i) {
+            Impl::encodePortable(&encoded[0], BYTES.data(), k_SIZE);
+        }
+        timer.stop();
+        cout << "encodePortable:         "
+             << k_REPS / timer.accumulatedWallTime() << " MB/s" << endl;
+
+        timer.reset();
+        timer.start();
+        for (int i = 0; i != k_REPS / 10; ++i) {
+            ASSERT(encoded == streamEncode(BYTES));
+        }
+        timer.stop();
+        cout << "Base64Encoder:          "
+             << k_REPS / 10 / timer.accumulatedWallTime() << " MB/s" << endl;
+
+        timer.reset();
+        timer.start();
+        for (int i = 0; i != k_REPS; ++i) {
+            Util::decode(decoded.data(), &numOut, encoded.data(),
+                         encoded.size());
+        }
+        timer.stop();
+        cout << "decode:                 "
+             << k_REPS / timer.accumulatedWallTime() << " MB/s" << endl;
+
+        timer.reset();
+        timer.start();
+        for (int i = 0; i != k_REPS; ++i) {
+            Impl::decodePortable(decoded.data(), &numOut, encoded.data(),
+                                 encoded.size());
+        }
+        timer.stop();
+        cout << "decodePortable:         "
+             << k_REPS / timer.accumulatedWallTime() << " MB/s" << endl;
+
+        timer.reset();
+        timer.start();
+        for (int i = 0; i != k_REPS / 10; ++i) {
+            bsl::string output;
+            ASSERT(0 == streamDecode(&output, encoded));
+        }
+        timer.stop();
+        cout << "Base64Decoder:          "
+             << k_REPS / 10 / timer.accumulatedWallTime() << " MB/s" << endl;
+
+        for (bsl::size_t i = 0; i != encoded.size(); ++i) {
+            wrapped.push_back(encoded[i]);
+            if (75 == i % 76) {
+                wrapped.append("\r\n");
+            }
+        }
+        timer.reset();
+        timer.start();
+        for (int i = 0; i != k_REPS; ++i) {
+            Util::decode(decoded.data(), &numOut, wrapped.data(),
+                         wrapped.size());
+        }
+        timer.stop();
+        cout << "decode (76-char lines): "
+             << k_REPS / timer.accumulatedWallTime() << " MB/s" << endl;
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,734 @@
+// bdlde_charconvertascii.cpp                                         -*-C++-*-
+#include <bdlde_charconvertascii.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlde_charconvertascii_cpp,"$Id$ $CSID$")
+
+#include <bdlde_simd_cpufeatures.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomicoperations.h>
+#include <bsls_performancehint.h>
+#include <bsls_platform.h>
+
+#if defined(BSLS_PLATFORM_CPU_X86_64)                                         \
+ && (defined(BSLS_PLATFORM_CMP_CLANG)                                         \
+  || (defined(BSLS_PLATFORM_CMP_GNU) && BSLS_PLATFORM_CMP_VERSION >= 40900))
+#define U_VECTORIZED_KERNELS
+    // Vectorized conversion kernels, selected at run time, are available.
+#include <immintrin.h>
+#endif
+
+///Implementation Notes
+///--------------------
+// Each vectorized kernel processes whole blocks of 16 (SSE2) or 32 (AVX2)
+// code units, and stops at the first block containing a non-ASCII code unit,
+// or when fewer code units than a block remain.  The portable loop then
+// converts the ASCII characters, if any, at the start of the rest of the
+// input.  Hence no code unit beyond the end of the run is ever written.
+//
+// A block is ASCII if the bitwise and of each of its code units with a mask
+// is 0.  The mask has every bit set except the low 7 bits of the low-order
+// byte (e.g., '0xff80' for 16-bit code units) or, if bytes are swapped, of
+// the high-order byte (e.g., '0x80ff').  Widening zero-extends each byte to
+// the width of the output, and then, if bytes are swapped, shifts it into the
+// high-order byte; narrowing is the reverse, followed by a saturating pack,
+// which cannot saturate as every value is less than 128.  The AVX2 packing
+// instructions operate on each 128-bit lane separately, so their results are
+// permuted back into order before being stored.
+
+namespace BloombergLP {
+namespace {
+
+enum {
+    k_KERNEL_UNKNOWN  = 0,  // kernel not yet selected
+    k_KERNEL_PORTABLE = 1,  // no vectorized kernel available
+    k_KERNEL_SSE2     = 2,  // 16 code units per iteration
+    k_KERNEL_AVX2     = 3   // 32 code units per iteration
+};
+
+bsls::AtomicOperations::AtomicTypes::Int s_kernel;
+    // The kernel used by 'CharConvertAscii', or 'k_KERNEL_UNKNOWN' if it has
+    // not been selected yet.  Note that, as selection is idempotent,
+    // concurrent first calls may race to set this value without harm.
+
+int selectKernel()
+    // Return the fastest kernel supported by the CPU on which this process is
+    // running.
+{
+#if defined(U_VECTORIZED_KERNELS)
+    typedef bdlde::Simd_CpuFeatures Features;
+
+    // SSE2 is part of the x86-64 architecture.
+
+    return Features::isSupported(Features::e_AVX2) ? k_KERNEL_AVX2
+                                                   : k_KERNEL_SSE2;
+#else
+    return k_KERNEL_PORTABLE;
+#endif
+}
+
+int kernel()
+    // Return the kernel to be used on the CPU on which this process is
+    // running.
+{
+    int result = bsls::AtomicOperations::getIntRelaxed(&s_kernel);
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(k_KERNEL_UNKNOWN == result)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        result = selectKernel();
+        bsls::AtomicOperations::setIntRelaxed(&s_kernel, result);
+    }
+    return result;
+}
+
+                              // ===============
+                              // struct CodeUnit
+                              // ===============
+
+template <class UNIT>
+struct CodeUnit {
+    // This 'struct' provides constants describing ASCII characters stored in
+    // code units of type 'UNIT'.
+
+    enum {
+        k_SWAP_SHIFT = 8 * (sizeof(UNIT) - 1)
+            // Shift moving the low-order byte to the high-order byte.
+    };
+
+    static const unsigned int k_MASK         = ~0x7fu;
+    static const unsigned int k_SWAPPED_MASK = ~(0x7fu << k_SWAP_SHIFT);
+        // Masks having a bit set where an ASCII character stored in host, or
+        // swapped, byte order has a 0 bit.
+};
+
+template <class UNIT>
+const unsigned int CodeUnit<UNIT>::k_MASK;
+template <class UNIT>
+const unsigned int CodeUnit<UNIT>::k_SWAPPED_MASK;
+
+                          // ------------------------
+                          // Portable implementations
+                          // ------------------------
+
+template <class UNIT>
+bsl::size_t narrowPortable(char        *output,
+                           const UNIT  *input,
+                           bsl::size_t  numCodeUnits,
+                           bool         swapBytes)
+    // Load into the specified 'output' the longest run of ASCII characters at
+    // the start of the specified 'input' having the specified 'numCodeUnits'
+    // code units, swapping the bytes of each code unit first if the specified
+    // 'swapBytes' is 'true', and return the length of the run.
+{
+    const unsigned int mask  = swapBytes ? CodeUnit<UNIT>::k_SWAPPED_MASK
+                                         : CodeUnit<UNIT>::k_MASK;
+    const int          shift = swapBytes ? CodeUnit<UNIT>::k_SWAP_SHIFT : 0;
+
+    bsl::size_t i = 0;
+    for (; i < numCodeUnits && 0 == (input[i] & mask); ++i) {
+        output[i] = static_cast<char>(input[i] >> shift);
+    }
+    return i;
+}
+
+template <class UNIT>
+bsl::size_t widenPortable(UNIT                *output,
+                          const unsigned char *input,
+                          bsl::size_t          numCodeUnits,
+                          bool                 swapBytes)
+    // Load into the specified 'output' the longest run of ASCII characters at
+    // the start of the specified 'input' having the specified 'numCodeUnits'
+    // code units, swapping the bytes of each code unit written if the
+    // specified 'swapBytes' is 'true', and return the length of the run.
+{
+    const int shift = swapBytes ? CodeUnit<UNIT>::k_SWAP_SHIFT : 0;
+
+    bsl::size_t i = 0;
+    for (; i < numCodeUnits && input[i] < 0x80; ++i) {
+        output[i] = static_cast<UNIT>(static_cast<UNIT>(input[i]) << shift);
+    }
+    return i;
+}
+
+template <class UNIT>
+bsl::size_t prefixLengthPortable(const UNIT  *input,
+                                 bsl::size_t  numCodeUnits,
+                                 unsigned int mask)
+    // Return the length of the longest run of code units at the start of the
+    // specified 'input' having the specified 'numCodeUnits' code units whose
+    // bitwise and with the specified 'mask' is 0.
+{
+    bsl::size_t i = 0;
+    while (i < numCodeUnits && 0 == (input[i] & mask)) {
+        ++i;
+    }
+    return i;
+}
+
+#if defined(U_VECTORIZED_KERNELS)
+
+                              // ------------
+                              // SSE2 kernels
+                              // ------------
+
+bsl::size_t narrow16Sse2(char                 *output,
+                         const unsigned short *input,
+                         bsl::size_t           numCodeUnits,
+                         bool                  swapBytes)
+    // Narrow the blocks of 16 ASCII characters at the start of the specified
+    // 'input' having the specified 'numCodeUnits' code units into the
+    // specified 'output', swapping bytes first if the specified 'swapBytes'
+    // is 'true', and return the number of code units narrowed.
+{
+    typedef CodeUnit<unsigned short> Unit;
+
+    const __m128i zero  = _mm_setzero_si128();
+    const __m128i mask  = _mm_set1_epi16(static_cast<short>(
+                               swapBytes ? Unit::k_SWAPPED_MASK
+                                         : Unit::k_MASK));
+    const __m128i shift = _mm_cvtsi32_si128(swapBytes ? Unit::k_SWAP_SHIFT
+                                                      : 0);
+
+    bsl::size_t i = 0;
+    for (; numCodeUnits - i >= 16; i += 16) {
+        __m128i a = _mm_loadu_si128(
+                             reinterpret_cast<const __m128i *>(input + i));
+        __m128i b = _mm_loadu_si128(
+                             reinterpret_cast<const __m128i *>(input + i + 8));
+
+        const __m128i bits = _mm_and_si128(_mm_or_si128(a, b), mask);
+        if (0xffff != _mm_movemask_epi8(_mm_cmpeq_epi8(bits, zero))) {
+            break;
+        }
+
+        a = _mm_srl_epi16(a, shift);
+        b = _mm_srl_epi16(b, shift);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(output + i),
+                         _mm_packus_epi16(a, b));
+    }
+    return i;
+}
+
+bsl::size_t narrow32Sse2(char               *output,
+                         const unsigned int *input,
+                         bsl::size_t         numCodeUnits,
+                         bool                swapBytes)
+    // Narrow the blocks of 16 ASCII characters at the start of the specified
+    // 'input' having the specified 'numCodeUnits' code units into the
+    // specified 'output', swapping bytes first if the specified 'swapBytes'
+    // is 'true', and return the number of code units narrowed.
+{
+    typedef CodeUnit<unsigned int> Unit;
+
+    const __m128i zero  = _mm_setzero_si128();
+    const __m128i mask  = _mm_set1_epi32(static_cast<int>(
+                               swapBytes ? Unit::k_SWAPPED_MASK
+                                         : Unit::k_MASK));
+    const __m128i shift = _mm_cvtsi32_si128(swapBytes ? Unit::k_SWAP_SHIFT
+                                                      : 0);
+
+    bsl::size_t i = 0;
+    for (; numCodeUnits - i >= 16; i += 16) {
+        const __m128i *in = reinterpret_cast<const __m128i *>(input + i);
+
+        __m128i a = _mm_loadu_si128(in);
+        __m128i b = _mm_loadu_si128(in + 1);
+        __m128i c = _mm_loadu_si128(in + 2);
+        __m128i d = _mm_loadu_si128(in + 3);
+
+        const __m128i bits = _mm_and_si128(
+                          _mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d)),
+                          mask);
+        if (0xffff != _mm_movemask_epi8(_mm_cmpeq_epi8(bits, zero))) {
+            break;
+        }
+
+        a = _mm_srl_epi32(a, shift);
+        b = _mm_srl_epi32(b, shift);
+        c = _mm_srl_epi32(c, shift);
+        d = _mm_srl_epi32(d, shift);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(output + i),
+                         _mm_packus_epi16(_mm_packs_epi32(a, b),
+                                          _mm_packs_epi32(c, d)));
+    }
+    return i;
+}
+
+bsl::size_t widen16Sse2(unsigned short      *output,
+                        const unsigned char *input,
+                        bsl::size_t          numCodeUnits,
+                        bool                 swapBytes)
+    // Widen the blocks of 16 ASCII characters at the start of the specified
+    // 'input' having the specified 'numCodeUnits' code units into the
+    // specified 'output', swapping bytes if the specified 'swapBytes' is
+    // 'true', and return the number of code units widened.
+{
+    const __m128i zero  = _mm_setzero_si128();
+    const __m128i shift = _mm_cvtsi32_si128(
+                      swapBytes ? CodeUnit<unsigned short>::k_SWAP_SHIFT : 0);
+
+    bsl::size_t i = 0;
+    for (; numCodeUnits - i >= 16; i += 16) {
+        const __m128i v = _mm_loadu_si128(
+                                 reinterpret_cast<const __m128i *>(input + i));
+        if (_mm_movemask_epi8(v)) {
+            break;
+        }
+
+        __m128i *out = reinterpret_cast<__m128i *>(output + i);
+        _mm_storeu_si128(out,     _mm_sll_epi16(_mm_unpacklo_epi8(v, zero),
+                                                shift));
+        _mm_storeu_si128(out + 1, _mm_sll_epi16(_mm_unpackhi_epi8(v, zero),
+                                                shift));
+    }
+    return i;
+}
+
+bsl::size_t widen32Sse2(unsigned int        *output,
+                        const unsigned char *input,
+                        bsl::size_t          numCodeUnits,
+                        bool                 swapBytes)
+    // Widen the blocks of 16 ASCII characters at the start of the specified
+    // 'input' having the specified 'numCodeUnits' code units into the
+    // specified 'output', swapping bytes if the specified 'swapBytes' is
+    // 'true', and return the number of code units widened.
+{
+    const __m128i zero  = _mm_setzero_si128();
+    const __m128i shift = _mm_cvtsi32_si128(
+                        swapBytes ? CodeUnit<unsigned int>::k_SWAP_SHIFT : 0);
+
+    bsl::size_t i = 0;
+    for (; numCodeUnits - i >= 16; i += 16) {
+        const __m128i v = _mm_loadu_si128(
+                                 reinterpret_cast<const __m128i *>(input + i));
+        if (_mm_movemask_epi8(v)) {
+            break;
+        }
+
+        const __m128i lo = _mm_unpacklo_epi8(v, zero);
+        const __m128i hi = _mm_unpackhi_epi8(v, zero);
+
+        __m128i *out = reinterpret_cast<__m128i *>(output + i);
+        _mm_storeu_si128(out,     _mm_sll_epi32(_mm_unpacklo_epi16(lo, zero),
+                                                shift));
+        _mm_storeu_si128(out + 1, _mm_sll_epi32(_mm_unpackhi_epi16(lo, zero),
+                                                shift));
+        _mm_storeu_si128(out + 2, _mm_sll_epi32(_mm_unpacklo_epi16(hi, zero),
+                                                shift));
+        _mm_storeu_si128(out + 3, _mm_sll_epi32(_mm_unpackhi_epi16(hi, zero),
+                                                shift));
+    }
+    return i;
+}
+
+bsl::size_t prefixLengthSse2(const void  *input,
+                             bsl::size_t  numBytes,
+                             __m128i      mask)
+    // Return the number of bytes in the blocks of 16 bytes at the start of the
+    // specified 'input' having the specified 'numBytes' bytes whose bitwise
+    // and with the specified 'mask' is 0.
+{
+    const unsigned char *in   = static_cast<const unsigned char *>(input);
+    const __m128i        zero = _mm_setzero_si128();
+
+    bsl::size_t i = 0;
+    for (; numBytes - i >= 16; i += 16) {
+        const __m128i bits = _mm_and_si128(
+                   _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i)),
+                   mask);
+        if (0xffff != _mm_movemask_epi8(_mm_cmpeq_epi8(bits, zero))) {
+            break;
+        }
+    }
+    return i;
+}
+
+                              // ------------
+                              // AVX2 kernels
+                              // ------------
+
+__attribute__((target("avx2")))
+bsl::size_t narrow16Avx2(char                 *output,
+                         const unsigned short *input,
+                         bsl::size_t           numCodeUnits,
+                         bool                  swapBytes)
+    // Narrow the blocks of 32 ASCII characters at the start of the specified
+    // 'input' having the specified 'numCodeUnits' code units into the
+    // specified 'output', swapping bytes first if the specified 'swapBytes'
+    // is 'true', and return the number of code units narrowed.
+{
+    typedef CodeUnit<unsigned short> Unit;
+
+    const __m256i mask  = _mm256_set1_epi16(static_cast<short>(
+                               swapBytes ? Unit::k_SWAPPED_MASK
+                                         : Unit::k_MASK));
+    const __m128i shift = _mm_cvtsi32_si128(swapBytes ? Unit::k_SWAP_SHIFT
+                                                      : 0);
+
+    bsl::size_t i = 0;
+    for (; numCodeUnits - i >= 32; i += 32) {
+        const __m256i *in = reinterpret_cast<const __m256i *>(input + i);
+
+        __m256i a = _mm256_loadu_si256(in);
+        __m256i b = _mm256_loadu_si256(in + 1);
+        if (!_mm256_testz_si256(_mm256_or_si256(a, b), mask)) {
+            break;
+        }
+
+        a = _mm256_srl_epi16(a, shift);
+        b = _mm256_srl_epi16(b, shift);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(output + i),
+                            _mm256_permute4x64_epi64(_mm256_packus_epi16(a, b),
+                                                     0xd8));
+    }
+    return i;
+}
+
+__attribute__((target("avx2")))
+bsl::size_t narrow32Avx2(char               *output,
+                         const unsigned int *input,
+                         bsl::size_t         numCodeUnits,
+                         bool                swapBytes)
+    // Narrow the blocks of 32 ASCII characters at the start of the specified
+    // 'input' having the specified 'numCodeUnits' code units into the
+    // specified 'output', swapping bytes first if the specified 'swapBytes'
+    // is 'true', and return the number of code units narrowed.
+{
+    typedef CodeUnit<unsigned int> Unit;
+
+    const __m256i mask  = _mm256_set1_epi32(static_cast<int>(
+                               swapBytes ? Unit::k_SWAPPED_MASK
+                                         : Unit::k_MASK));
+    const __m128i shift = _mm_cvtsi32_si128(swapBytes ? Unit::k_SWAP_SHIFT
+                                                      : 0);
+    const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
+    bsl::size_t i = 0;
+    for (; numCodeUnits - i >= 32; i += 32) {
+        const __m256i *in = reinterpret_cast<const __m256i *>(input + i);
+
+        __m256i a = _mm256_loadu_si256(in);
+        __m256i b = _mm256_loadu_si256(in + 1);
+        __m256i c = _mm256_loadu_si256(in + 2);
+        __m256i d = _mm256_loadu_si256(in + 3);
+        if (!_mm256_testz_si256(_mm256_or_si256(_mm256_or_si256(a, b),
+                                                _mm256_or_si256(c, d)),
+                                mask)) {
+            break;
+        }
+
+        a = _mm256_srl_epi32(a, shift);
+        b = _mm256_srl_epi32(b, shift);
+        c = _mm256_srl_epi32(c, shift);
+        d = _mm256_srl_epi32(d, shift);
+
+        const __m256i packed = _mm256_packus_epi16(_mm256_packs_epi32(a, b),
+                                                   _mm256_packs_epi32(c, d));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(output + i),
+                            _mm256_permutevar8x32_epi32(packed, order));
+    }
+    return i;
+}
+
+__attribute__((target("avx2")))
+bsl::size_t widen16Avx2(unsigned short      *output,
+                        const unsigned char *input,
+                        bsl::size_t          numCodeUnits,
+                        bool                 swapBytes)
+    // Widen the blocks of 32 ASCII characters at the start of the specified
+    // 'input' having the specified 'numCodeUnits' code units into the
+    // specified 'output', swapping bytes if the specified 'swapBytes' is
+    // 'true', and return the number of code units widened.
+{
+    const __m128i shift = _mm_cvtsi32_si128(
+                      swapBytes ? CodeUnit<unsigned short>::k_SWAP_SHIFT : 0);
+
+    bsl::size_t i = 0;
+    for (; numCodeUnits - i >= 32; i += 32) {
+        const __m256i v = _mm256_loadu_si256(
+                                 reinterpret_cast<const __m256i *>(input + i));
+        if (_mm256_movemask_epi8(v)) {
+            break;
+        }
+
+        const __m128i lo = _mm256_castsi256_si128(v);
+        const __m128i hi = _mm256_extracti128_si256(v, 1);
+
+        __m256i *out = reinterpret_cast<__m256i *>(output + i);
+        _mm256_storeu_si256(out,     _mm256_sll_epi16(_mm256_cvtepu8_epi16(lo),
+                                                      shift));
+        _mm256_storeu_si256(out + 1, _mm256_sll_epi16(_mm256_cvtepu8_epi16(hi),
+                                                      shift));
+    }
+    return i;
+}
+
+__attribute__((target("avx2")))
+bsl::size_t widen32Avx2(unsigned int        *output,
+                        const unsigned char *input,
+                        bsl::size_t          numCodeUnits,
+                        bool                 swapBytes)
+    // Widen the blocks of 32 ASCII characters at the start of the specified
+    // 'input' having the specified 'numCodeUnits' code units into the
+    // specified 'output', swapping bytes if the specified 'swapBytes' is
+    // 'true', and return the number of code units widened.
+{
+    const __m128i shift = _mm_cvtsi32_si128(
+                        swapBytes ? CodeUnit<unsigned int>::k_SWAP_SHIFT : 0);
+
+    bsl::size_t i = 0;
+    for (; numCodeUnits - i >= 32; i += 32) {
+        const __m256i v = _mm256_loadu_si256(
+                                 reinterpret_cast<const __m256i *>(input + i));
+        if (_mm256_movemask_epi8(v)) {
+            break;
+        }
+
+        const __m128i lo = _mm256_castsi256_si128(v);
+        const __m128i hi = _mm256_extracti128_si256(v, 1);
+
+        __m256i *out = reinterpret_cast<__m256i *>(output + i);
+        _mm256_storeu_si256(out,
+                            _mm256_sll_epi32(_mm256_cvtepu8_epi32(lo), shift));
+        _mm256_storeu_si256(out + 1,
+                            _mm256_sll_epi32(
+                                   _mm256_cvtepu8_epi32(_mm_srli_si128(lo, 8)),
+                                   shift));
+        _mm256_storeu_si256(out + 2,
+                            _mm256_sll_epi32(_mm256_cvtepu8_epi32(hi), shift));
+        _mm256_storeu_si256(out + 3,
+                            _mm256_sll_epi32(
+                                   _mm256_cvtepu8_epi32(_mm_srli_si128(hi, 8)),
+                                   shift));
+    }
+    return i;
+}
+
+__attribute__((target("avx2")))
+bsl::size_t prefixLengthAvx2(const void   *input,
+                             bsl::size_t   numBytes,
+                             unsigned int  mask)
+    // Return the number of bytes in the blocks of 32 bytes at the start of the
+    // specified 'input' having the specified 'numBytes' bytes whose bitwise
+    // and with the specified 'mask', replicated in each 32-bit lane, is 0.
+{
+    const unsigned char *in   = static_cast<const unsigned char *>(input);
+    const __m256i        bits = _mm256_set1_epi32(static_cast<int>(mask));
+
+    bsl::size_t i = 0;
+    for (; numBytes - i >= 32; i += 32) {
+        if (!_mm256_testz_si256(
+                 _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in + i)),
+                 bits)) {
+            break;
+        }
+    }
+    return i;
+}
+
+#endif  // U_VECTORIZED_KERNELS
+
+template <class UNIT>
+bsl::size_t prefixLengthImpl(const UNIT   *input,
+                             bsl::size_t   numCodeUnits,
+                             unsigned int  mask)
+    // Return the length of the longest run of code units at the start of the
+    // specified 'input' having the specified 'numCodeUnits' code units whose
+    // bitwise and with the specified 'mask' is 0.  The behavior is undefined
+    // unless 'mask' is the same in every byte-sized, or 'UNIT'-sized, part of
+    // an 'unsigned int'.
+{
+    bsl::size_t i = 0;
+
+    switch (kernel()) {
+#if defined(U_VECTORIZED_KERNELS)
+      case k_KERNEL_AVX2: {
+        i = prefixLengthAvx2(input, numCodeUnits * sizeof(UNIT), mask)
+                                                               / sizeof(UNIT);
+      } break;
+      case k_KERNEL_SSE2: {
+        i = prefixLengthSse2(input,
+                             numCodeUnits * sizeof(UNIT),
+                             _mm_set1_epi32(static_cast<int>(mask)))
+                                                               / sizeof(UNIT);
+      } break;
+#endif
+      default: break;
+    }
+
+    return i + prefixLengthPortable(input + i, numCodeUnits - i, mask);
+}
+
+}  // close unnamed namespace
+
+namespace bdlde {
+
+                           // -----------------------
+                           // struct CharConvertAscii
+                           // -----------------------
+
+// CLASS METHODS
+bsl::size_t CharConvertAscii::narrow(char                 *output,
+                                     const unsigned short *input,
+                                     bsl::size_t           numCodeUnits,
+                                     bool                  swapBytes)
+{
+    BSLS_ASSERT(output || 0 == numCodeUnits);
+    BSLS_ASSERT(input  || 0 == numCodeUnits);
+
+    bsl::size_t i = 0;
+
+    switch (kernel()) {
+#if defined(U_VECTORIZED_KERNELS)
+      case k_KERNEL_AVX2: {
+        i = narrow16Avx2(output, input, numCodeUnits, swapBytes);
+      } break;
+      case k_KERNEL_SSE2: {
+        i = narrow16Sse2(output, input, numCodeUnits, swapBytes);
+      } break;
+#endif
+      default: break;
+    }
+
+    return i + narrowPortable(output + i,
+                              input + i,
+                              numCodeUnits - i,
+                              swapBytes);
+}
+
+bsl::size_t CharConvertAscii::narrow(char                 *output,
+                                     const unsigned int   *input,
+                                     bsl::size_t           numCodeUnits,
+                                     bool                  swapBytes)
+{
+    BSLS_ASSERT(output || 0 == numCodeUnits);
+    BSLS_ASSERT(input  || 0 == numCodeUnits);
+
+    bsl::size_t i = 0;
+
+    switch (kernel()) {
+#if defined(U_VECTORIZED_KERNELS)
+      case k_KERNEL_AVX2: {
+        i = narrow32Avx2(output, input, numCodeUnits, swapBytes);
+      } break;
+      case k_KERNEL_SSE2: {
+        i = narrow32Sse2(output, input, numCodeUnits, swapBytes);
+      } break;
+#endif
+      default: break;
+    }
+
+    return i + narrowPortable(output + i,
+                              input + i,
+                              numCodeUnits - i,
+                              swapBytes);
+}
+
+bsl::size_t CharConvertAscii::widen(unsigned short *output,
+                                    const char     *input,
+                                    bsl::size_t     numCodeUnits,
+                                    bool            swapBytes)
+{
+    BSLS_ASSERT(output || 0 == numCodeUnits);
+    BSLS_ASSERT(input  || 0 == numCodeUnits);
+
+    const unsigned char *in = reinterpret_cast<const unsigned char *>(input);
+    bsl::size_t          i  = 0;
+
+    switch (kernel()) {
+#if defined(U_VECTORIZED_KERNELS)
+      case k_KERNEL_AVX2: {
+        i = widen16Avx2(output, in, numCodeUnits, swapBytes);
+      } break;
+      case k_KERNEL_SSE2: {
+        i = widen16Sse2(output, in, numCodeUnits, swapBytes);
+      } break;
+#endif
+      default: break;
+    }
+
+    return i + widenPortable(output + i, in + i, numCodeUnits - i, swapBytes);
+}
+
+bsl::size_t CharConvertAscii::widen(unsigned int   *output,
+                                    const char     *input,
+                                    bsl::size_t     numCodeUnits,
+                                    bool            swapBytes)
+{
+    BSLS_ASSERT(output || 0 == numCodeUnits);
+    BSLS_ASSERT(input  || 0 == numCodeUnits);
+
+    const unsigned char *in = reinterpret_cast<const unsigned char *>(input);
+    bsl::size_t          i  = 0;
+
+    switch (kernel()) {
+#if defined(U_VECTORIZED_KERNELS)
+      case k_KERNEL_AVX2: {
+        i = widen32Avx2(output, in, numCodeUnits, swapBytes);
+      } break;
+      case k_KERNEL_SSE2: {
+        i = widen32Sse2(output, in, numCodeUnits, swapBytes);
+      } break;
+#endif
+      default: break;
+    }
+
+    return i + widenPortable(output + i, in + i, numCodeUnits - i, swapBytes);
+}
+
+bsl::size_t CharConvertAscii::prefixLength(const char  *input,
+                                           bsl::size_t  numCodeUnits)
+{
+    BSLS_ASSERT(input || 0 == numCodeUnits);
+
+    return prefixLengthImpl(reinterpret_cast<const unsigned char *>(input),
+                            numCodeUnits,
+                            0x80808080u);
+}
+
+bsl::size_t CharConvertAscii::prefixLength(const unsigned short *input,
+                                           bsl::size_t           numCodeUnits,
+                                           bool                  swapBytes)
+{
+    BSLS_ASSERT(input || 0 == numCodeUnits);
+
+    typedef CodeUnit<unsigned short> Unit;
+
+    const unsigned int mask = swapBytes ? Unit::k_SWAPPED_MASK : Unit::k_MASK;
+    return prefixLengthImpl(input,
+                            numCodeUnits,
+                            (mask & 0xffff) | (mask << 16));
+}
+
+bsl::size_t CharConvertAscii::prefixLength(const unsigned int *input,
+                                           bsl::size_t         numCodeUnits,
+                                           bool                swapBytes)
+{
+    BSLS_ASSERT(input || 0 == numCodeUnits);
+
+    typedef CodeUnit<unsigned int> Unit;
+
+    return prefixLengthImpl(input,
+                            numCodeUnits,
+                            swapBytes ? Unit::k_SWAPPED_MASK : Unit::k_MASK);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,167 @@
+// bdlde_charconvertascii.h                                           -*-C++-*-
+#ifndef INCLUDED_BDLDE_CHARCONVERTASCII
+#define INCLUDED_BDLDE_CHARCONVERTASCII
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$")
+
+//@PURPOSE: Provide vectorized conversion of runs of ASCII between code units.
+//
+//@CLASSES:
+//  bdlde::CharConvertAscii: namespace for ASCII run conversion functions
+//
+//@SEE_ALSO: bdlde_charconvertutf16, bdlde_charconvertutf32
+//
+//@DESCRIPTION: This component provides a 'struct', 'bdlde::CharConvertAscii',
+// containing functions that convert the longest run of ASCII characters at the
+// start of a sequence of 8-bit code units (UTF-8) into 16- or 32-bit code
+// units (UTF-16 or UTF-32), or the reverse, and that measure the length of
+// such a run.  An ASCII character has the same value in every one of these
+// encodings, so such runs can be converted without decoding, and, as they
+// make up most of the text encountered in practice, converting them many
+// characters at a time substantially speeds up transcoding.  The functions of
+// this component are intended as the fast path of transcoders such as
+// 'bdlde::CharConvertUtf16' and 'bdlde::CharConvertUtf32', which handle the
+// non-ASCII characters, and any errors, that end each run.
+//
+// A 16- or 32-bit code unit is considered an ASCII character if its value, in
+// host byte order or, if so requested, with its bytes swapped, is less than
+// 128.  Note that the null character is considered an ASCII character:
+// callers processing null-terminated input must supply its length.
+//
+///Thread Safety
+///-------------
+// Thread safe.
+//
+///Support for Hardware Acceleration
+///---------------------------------
+// On x86-64 CPUs, the functions of this component process 32 code units per
+// iteration using AVX2 instructions, if the CPU supports them, and 16 code
+// units per iteration using SSE2 instructions otherwise.  On other platforms,
+// and for the remainder of a run shorter than one iteration, a portable loop
+// processes one code unit at a time.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Converting the ASCII Prefix of a UTF-8 String
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we are writing a UTF-8 to UTF-16 transcoder, and want to convert
+// runs of ASCII characters without decoding them.  First, we prepare a UTF-8
+// string whose first 6 characters are ASCII, and an output buffer:
+//..
+//  const char     utf8[] = "Hello \xe4\xb8\x96\xe7\x95\x8c";
+//  unsigned short utf16[sizeof utf8];
+//..
+// Then, we convert the leading ASCII characters:
+//..
+//  bsl::size_t numConverted = bdlde::CharConvertAscii::widen(
+//                                                          utf16,
+//                                                          utf8,
+//                                                          sizeof utf8 - 1);
+//  assert(6   == numConverted);
+//  assert('H' == utf16[0]);
+//  assert(' ' == utf16[5]);
+//..
+// Now, the transcoder decodes the multi-byte sequence at 'utf8 + 6' and
+// encodes it into 'utf16 + 6', and then resumes with 'widen'.
+//
+// Finally, we convert the UTF-16 text back to UTF-8, observing that the
+// conversion stops at the first non-ASCII character:
+//..
+//  utf16[6] = 0x4e16;
+//  char backToUtf8[sizeof utf8];
+//  numConverted = bdlde::CharConvertAscii::narrow(backToUtf8, utf16, 7);
+//  assert(6 == numConverted);
+//  assert(0 == bsl::memcmp(utf8, backToUtf8, 6));
+//..
+
+#include <bdlscm_version.h>
+
+#include <bsl_cstddef.h>
+
+namespace BloombergLP {
+namespace bdlde {
+
+                           // =======================
+                           // struct CharConvertAscii
+                           // =======================
+
+struct CharConvertAscii {
+    // This 'struct' provides a namespace for functions that convert, or
+    // measure, the longest run of ASCII characters at the start of a
+    // sequence of code units.
+
+    // CLASS METHODS
+    static bsl::size_t narrow(char                 *output,
+                              const unsigned short *input,
+                              bsl::size_t           numCodeUnits,
+                              bool                  swapBytes = false);
+    static bsl::size_t narrow(char                 *output,
+                              const unsigned int   *input,
+                              bsl::size_t           numCodeUnits,
+                              bool                  swapBytes = false);
+        // Load into the specified 'output' the 8-bit code units having the
+        // same values as the ASCII characters in the longest run of such
+        // characters at the start of the specified 'input' having the
+        // specified 'numCodeUnits' code units, and return the length of that
+        // run.  Optionally specify 'swapBytes'; if 'swapBytes' is 'true', the
+        // bytes of each code unit in 'input' are swapped before it is
+        // examined.  The behavior is undefined unless 'output' can hold
+        // 'numCodeUnits' code units.  Note that no more code units are
+        // written to 'output' than the value returned.
+
+    static bsl::size_t widen(unsigned short *output,
+                             const char     *input,
+                             bsl::size_t     numCodeUnits,
+                             bool            swapBytes = false);
+    static bsl::size_t widen(unsigned int   *output,
+                             const char     *input,
+                             bsl::size_t     numCodeUnits,
+                             bool            swapBytes = false);
+        // Load into the specified 'output' the code units having the same
+        // values as the ASCII characters in the longest run of such
+        // characters at the start of the specified 'input' having the
+        // specified 'numCodeUnits' 8-bit code units, and return the length of
+        // that run.  Optionally specify 'swapBytes'; if 'swapBytes' is
+        // 'true', the bytes of each code unit written to 'output' are swapped.
+        // The behavior is undefined unless 'output' can hold 'numCodeUnits'
+        // code units.  Note that no more code units are written to 'output'
+        // than the value returned.
+
+    static bsl::size_t prefixLength(const char           *input,
+                                    bsl::size_t           numCodeUnits);
+    static bsl::size_t prefixLength(const unsigned short *input,
+                                    bsl::size_t           numCodeUnits,
+                                    bool                  swapBytes = false);
+    static bsl::size_t prefixLength(const unsigned int   *input,
+                                    bsl::size_t           numCodeUnits,
+                                    bool                  swapBytes = false);
+        // Return the length of the longest run of ASCII characters at the
+        // start of the specified 'input' having the specified 'numCodeUnits'
+        // code units.  Optionally specify 'swapBytes'; if 'swapBytes' is
+        // 'true', the bytes of each code unit in 'input' are swapped before
+        // it is examined.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
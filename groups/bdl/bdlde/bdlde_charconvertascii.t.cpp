@@ -0,0 +1,590 @@
+// bdlde_charconvertascii.t.cpp                                       -*-C++-*-
+#include <bdlde_charconvertascii.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                 TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test provides functions that convert, or measure, the
+// run of ASCII characters at the start of a sequence of code units.  The
+// vectorized kernels process whole blocks, and hand over to a portable loop
+// at the first block containing a non-ASCII code unit, so we must verify
+// inputs of every length around the block sizes having a non-ASCII code unit
+// (of several kinds) at every position, with and without byte swapping, and
+// verify that nothing is written beyond the end of the run.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 3] size_t narrow(char *, const unsigned short *, size_t, bool);
+// [ 3] size_t narrow(char *, const unsigned int *, size_t, bool);
+// [ 2] size_t widen(unsigned short *, const char *, size_t, bool);
+// [ 2] size_t widen(unsigned int *, const char *, size_t, bool);
+// [ 4] size_t prefixLength(const char *, size_t);
+// [ 4] size_t prefixLength(const unsigned short *, size_t, bool);
+// [ 4] size_t prefixLength(const unsigned int *, size_t, bool);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlde::CharConvertAscii Util;
+
+const bsl::size_t k_MAX_LENGTH = 100;
+    // Inputs of every length up to this value are tested; it spans several
+    // blocks of the widest kernel.
+
+// ============================================================================
+//                    GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+template <class UNIT>
+UNIT swapIf(UNIT value, bool swapBytes)
+    // Return the specified 'value' with its bytes reversed if the specified
+    // 'swapBytes' is 'true', and 'value' otherwise.
+{
+    if (!swapBytes) {
+        return value;                                                 // RETURN
+    }
+
+    UNIT result = 0;
+    for (bsl::size_t i = 0; i != sizeof(UNIT); ++i) {
+        result = static_cast<UNIT>((result << 8) | (value & 0xff));
+        value  = static_cast<UNIT>(value >> 8);
+    }
+    return result;
+}
+
+char asciiChar(bsl::size_t i)
+    // Return an ASCII character, including the null character, determined by
+    // the specified 'i'.
+{
+    return static_cast<char>((i * 37 + 11) % 128);
+}
+
+template <class UNIT>
+void testWiden(bool swapBytes)
+    // Verify 'widen' into code units of type 'UNIT' for all input lengths up
+    // to 'k_MAX_LENGTH', having an ASCII run ending at every position, and
+    // swapping bytes if the specified 'swapBytes' is 'true'.
+{
+    const char NON_ASCII[] = { '\x80', '\xc3', '\xff' };
+
+    for (bsl::size_t length = 0; length <= k_MAX_LENGTH; ++length) {
+        for (bsl::size_t runLength = 0; runLength <= length; ++runLength) {
+            for (int k = 0; k != 3; ++k) {
+                bsl::vector<char> input(length + 1);
+                for (bsl::size_t i = 0; i != length; ++i) {
+                    input[i] = i == runLength ? NON_ASCII[k] : asciiChar(i);
+                }
+
+                const UNIT        SENTINEL = static_cast<UNIT>(0xabcd);
+                bsl::vector<UNIT> output(length + 1, SENTINEL);
+
+                const bsl::size_t result = Util::widen(output.data(),
+                                                       input.data(),
+                                                       length,
+                                                       swapBytes);
+                ASSERTV(length, runLength, k, result, runLength == result);
+
+                for (bsl::size_t i = 0; i != length + 1; ++i) {
+                    const UNIT EXP = i < runLength
+                           ? swapIf(static_cast<UNIT>(input[i]), swapBytes)
+                           : SENTINEL;
+                    ASSERTV(length, runLength, i, EXP == output[i]);
+                }
+            }
+        }
+    }
+}
+
+template <class UNIT>
+void testNarrow(bool swapBytes)
+    // Verify 'narrow' from code units of type 'UNIT' for all input lengths up
+    // to 'k_MAX_LENGTH', having an ASCII run ending at every position with
+    // several kinds of non-ASCII code unit, and swapping bytes if the
+    // specified 'swapBytes' is 'true'.
+{
+    const UNIT NON_ASCII[] = {
+                              0x80,
+                              0x100,
+                              static_cast<UNIT>(0x4100),
+                              static_cast<UNIT>(~0u),
+                              static_cast<UNIT>(0x41u << (sizeof(UNIT) * 4)) };
+    const int  NUM_NON_ASCII = sizeof NON_ASCII / sizeof *NON_ASCII;
+
+    for (bsl::size_t length = 0; length <= k_MAX_LENGTH; ++length) {
+        for (bsl::size_t runLength = 0; runLength <= length; ++runLength) {
+            for (int k = 0; k != NUM_NON_ASCII; ++k) {
+                bsl::vector<UNIT> input(length + 1);
+                for (bsl::size_t i = 0; i != length; ++i) {
+                    const UNIT value = i == runLength
+                                     ? NON_ASCII[k]
+                                     : static_cast<UNIT>(asciiChar(i));
+                    input[i] = swapIf(value, swapBytes);
+                }
+
+                bsl::vector<char> output(length + 1, '#');
+
+                const bsl::size_t result = Util::narrow(output.data(),
+                                                        input.data(),
+                                                        length,
+                                                        swapBytes);
+                ASSERTV(length, runLength, k, result, runLength == result);
+
+                ASSERTV(length, runLength, k, result == Util::prefixLength(
+                                                                 input.data(),
+                                                                 length,
+                                                                 swapBytes));
+
+                for (bsl::size_t i = 0; i != length + 1; ++i) {
+                    const char EXP = i < runLength ? asciiChar(i) : '#';
+                    ASSERTV(length, runLength, i, EXP == output[i]);
+                }
+            }
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+
+    (void)veryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Converting the ASCII Prefix of a UTF-8 String
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we are writing a UTF-8 to UTF-16 transcoder, and want to convert
+// runs of ASCII characters without decoding them.  First, we prepare a UTF-8
+// string whose first 6 characters are ASCII, and an output buffer:
+//..
+    const char     utf8[] = "Hello \xe4\xb8\x96\xe7\x95\x8c";
+    unsigned short utf16[sizeof utf8];
+//..
+// Then, we convert the leading ASCII characters:
+//..
+    bsl::size_t numConverted = bdlde::CharConvertAscii::widen(
+                                                            utf16,
+                                                            utf8,
+                                                            sizeof utf8 - 1);
+    ASSERT(6   == numConverted);
+    ASSERT('H' == utf16[0]);
+    ASSERT(' ' == utf16[5]);
+//..
+// Now, the transcoder decodes the multi-byte sequence at 'utf8 + 6' and
+// encodes it into 'utf16 + 6', and then resumes with 'widen'.
+//
+// Finally, we convert the UTF-16 text back to UTF-8, observing that the
+// conversion stops at the first non-ASCII character:
+//..
+    utf16[6] = 0x4e16;
+    char backToUtf8[sizeof utf8];
+    numConverted = bdlde::CharConvertAscii::narrow(backToUtf8, utf16, 7);
+    ASSERT(6 == numConverted);
+    ASSERT(0 == bsl::memcmp(utf8, backToUtf8, 6));
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'prefixLength'
+        //
+        // Concerns:
+        //: 1 'prefixLength' returns the length of the ASCII run at the start
+        //:   of the input for every input length and run length.
+        //:
+        //: 2 For 16- and 32-bit code units, 'prefixLength' agrees with
+        //:   'narrow', with and without byte swapping.
+        //:
+        //: 3 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For every length up to 'k_MAX_LENGTH', and every position of a
+        //:   non-ASCII byte, verify the result of 'prefixLength' for 8-bit
+        //:   code units.  (C-1)
+        //:
+        //: 2 Verify agreement with 'narrow' in the 'testNarrow' helper, used
+        //:   in case 3.  (C-2)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for a null pointer.  (C-3)
+        //
+        // Testing:
+        //   size_t prefixLength(const char *, size_t);
+        //   size_t prefixLength(const unsigned short *, size_t, bool);
+        //   size_t prefixLength(const unsigned int *, size_t, bool);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'prefixLength'" << endl
+                          << "======================" << endl;
+
+        for (bsl::size_t length = 0; length <= k_MAX_LENGTH; ++length) {
+            for (bsl::size_t runLength = 0; runLength <= length;
+                                                                ++runLength) {
+                bsl::vector<char> input(length + 1);
+                for (bsl::size_t i = 0; i != length; ++i) {
+                    input[i] = i == runLength ? '\x9f' : asciiChar(i);
+                }
+                ASSERTV(length, runLength,
+                        runLength == Util::prefixLength(input.data(),
+                                                        length));
+            }
+        }
+
+        if (verbose) cout << "\nNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const unsigned short *NULL16 = 0;
+            const unsigned int   *NULL32 = 0;
+
+            ASSERT_PASS(Util::prefixLength("a", 1));
+            ASSERT_FAIL(Util::prefixLength(static_cast<const char *>(0), 1));
+            ASSERT_PASS(Util::prefixLength(static_cast<const char *>(0), 0));
+            ASSERT_FAIL(Util::prefixLength(NULL16, 1));
+            ASSERT_PASS(Util::prefixLength(NULL16, 0));
+            ASSERT_FAIL(Util::prefixLength(NULL32, 1));
+            ASSERT_PASS(Util::prefixLength(NULL32, 0));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'narrow'
+        //
+        // Concerns:
+        //: 1 'narrow' converts exactly the ASCII run at the start of the
+        //:   input, and returns its length, for every input length and run
+        //:   length.
+        //:
+        //: 2 A code unit is ASCII only if its value, after swapping bytes if
+        //:   requested, is less than 128; in particular, a code unit whose
+        //:   low-order byte is ASCII but whose other bytes are not all 0 ends
+        //:   the run.
+        //:
+        //: 3 Nothing is written beyond the end of the run.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using the 'testNarrow' helper, for 16- and 32-bit code units,
+        //:   with and without byte swapping, for every length up to
+        //:   'k_MAX_LENGTH' and every position of each of several non-ASCII
+        //:   code units, verify the result and the output, and that a
+        //:   sentinel following the run is unchanged.  (C-1..3)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for null pointers.  (C-4)
+        //
+        // Testing:
+        //   size_t narrow(char *, const unsigned short *, size_t, bool);
+        //   size_t narrow(char *, const unsigned int *, size_t, bool);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'narrow'" << endl
+                          << "================" << endl;
+
+        for (int swapBytes = 0; swapBytes != 2; ++swapBytes) {
+            testNarrow<unsigned short>(swapBytes);
+            testNarrow<unsigned int>(swapBytes);
+        }
+
+        if (verbose) cout << "\nNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            char                 output[1];
+            const unsigned short INPUT16[] = { 'a' };
+            const unsigned int   INPUT32[] = { 'a' };
+
+            ASSERT_PASS(Util::narrow(output, INPUT16, 1));
+            ASSERT_FAIL(Util::narrow(     0, INPUT16, 1));
+            ASSERT_PASS(Util::narrow(     0, INPUT16, 0));
+            ASSERT_PASS(Util::narrow(output, INPUT32, 1));
+            ASSERT_FAIL(Util::narrow(     0, INPUT32, 1));
+            ASSERT_PASS(Util::narrow(     0, INPUT32, 0));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'widen'
+        //
+        // Concerns:
+        //: 1 'widen' converts exactly the ASCII run at the start of the input,
+        //:   and returns its length, for every input length and run length.
+        //:
+        //: 2 The bytes of each code unit written are swapped if requested.
+        //:
+        //: 3 Nothing is written beyond the end of the run.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using the 'testWiden' helper, for 16- and 32-bit code units, with
+        //:   and without byte swapping, for every length up to 'k_MAX_LENGTH'
+        //:   and every position of each of several non-ASCII bytes, verify
+        //:   the result and the output, and that a sentinel following the run
+        //:   is unchanged.  (C-1..3)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for null pointers.  (C-4)
+        //
+        // Testing:
+        //   size_t widen(unsigned short *, const char *, size_t, bool);
+        //   size_t widen(unsigned int *, const char *, size_t, bool);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'widen'" << endl
+                          << "===============" << endl;
+
+        for (int swapBytes = 0; swapBytes != 2; ++swapBytes) {
+            testWiden<unsigned short>(swapBytes);
+            testWiden<unsigned int>(swapBytes);
+        }
+
+        if (verbose) cout << "\nNegative testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            unsigned short output16[1];
+            unsigned int   output32[1];
+
+            ASSERT_PASS(Util::widen(output16, "a", 1));
+            ASSERT_FAIL(Util::widen(output16,   0, 1));
+            ASSERT_PASS(Util::widen(output16,   0, 0));
+            ASSERT_PASS(Util::widen(output32, "a", 1));
+            ASSERT_FAIL(Util::widen(output32,   0, 1));
+            ASSERT_PASS(Util::widen(output32,   0, 0));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Widen a string to UTF-16 and UTF-32, and narrow it back.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        const char        INPUT[] = "The quick brown fox jumps over the lazy"
+                                    " dog\xc3\xa9";
+        const bsl::size_t LENGTH  = sizeof INPUT - 1;
+        const bsl::size_t RUN     = LENGTH - 2;
+
+        unsigned short utf16[LENGTH];
+        unsigned int   utf32[LENGTH];
+        char           utf8[LENGTH];
+
+        ASSERT(RUN == Util::prefixLength(INPUT, LENGTH));
+
+        ASSERT(RUN == Util::widen(utf16, INPUT, LENGTH));
+        ASSERT('T' == utf16[0]);
+        ASSERT(RUN == Util::prefixLength(utf16, RUN));
+        ASSERT(RUN == Util::narrow(utf8, utf16, RUN));
+        ASSERT(0 == bsl::memcmp(INPUT, utf8, RUN));
+
+        ASSERT(RUN == Util::widen(utf32, INPUT, LENGTH, true));
+        ASSERT(0x54000000u == utf32[0]);
+        ASSERT(0 == Util::prefixLength(utf32, RUN));
+        ASSERT(RUN == Util::prefixLength(utf32, RUN, true));
+        ASSERT(RUN == Util::narrow(utf8, utf32, RUN, true));
+        ASSERT(0 == bsl::memcmp(INPUT, utf8, RUN));
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 Report the throughput of each function on a 1 MB ASCII input.
+        //
+        // Plan:
+        //: 1 Time each function over a 1 MB ASCII input, and print the
+        //:   throughputs in millions of code units per second.
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE TEST" << endl
+             << "================" << endl;
+
+        const bsl::size_t k_SIZE = 1024 * 1024;
+        const int         k_REPS = 200;
+
+        bsl::vector<char>           utf8(k_SIZE);
+        bsl::vector<unsigned short> utf16(k_SIZE);
+        bsl::vector<unsigned int>   utf32(k_SIZE);
+        for (bsl::size_t i = 0; i != k_SIZE; ++i) {
+            utf8[i] = static_cast<char>(' ' + i % 95);
+        }
+
+        bsls::Stopwatch timer;
+        bsl::size_t     total = 0;
+
+#define U_TIME(NAME, EXPRESSION)                                              \
+        timer.reset();                                                        \
+        timer.start();                                                        \
+        for (int i = 0; i != k_REPS; ++i) {                                   \
+            total += (EXPRESSION);                                            \
+        }                                                                     \
+        timer.stop();                                                         \
+        cout << NAME << k_REPS / timer.accumulatedWallTime()                  \
+             << " M code units/s" << endl;
+
+        U_TIME("widen   (16): ", Util::widen(utf16.data(),
+                                             utf8.data(),
+                                             k_SIZE))
+        U_TIME("widen   (32): ", Util::widen(utf32.data(),
+                                             utf8.data(),
+                                             k_SIZE))
+        U_TIME("narrow  (16): ", Util::narrow(utf8.data(),
+                                              utf16.data(),
+                                              k_SIZE))
+        U_TIME("narrow  (32): ", Util::narrow(utf8.data(),
+                                              utf32.data(),
+                                              k_SIZE))
+        U_TIME("prefix   (8): ", Util::prefixLength(utf8.data(), k_SIZE))
+        U_TIME("prefix  (16): ", Util::prefixLength(utf16.data(), k_SIZE))
+        U_TIME("prefix  (32): ", Util::prefixLength(utf32.data(), k_SIZE))
+
+#undef U_TIME
+
+        ASSERT(7 * k_REPS * k_SIZE == total);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
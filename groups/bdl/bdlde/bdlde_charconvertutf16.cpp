@@ -12,6 +12,7 @@
 #include <bsls_ident.h>
 BSLS_IDENT("$Id$ $CSID$")
 
+#include <bdlde_charconvertascii.h>
 #include <bdlde_charconvertstatus.h>
 
 #include <bsla_maybeunused.h>
@@ -201,8 +202,9 @@ namespace {
 
 // TYPES
 
-typedef BloombergLP::bdlde::CharConvertUtf16 Util;
-typedef BloombergLP::bslstl::StringRef      StringRef;
+typedef BloombergLP::bdlde::CharConvertUtf16  Util;
+typedef BloombergLP::bdlde::CharConvertAscii  Ascii;
+typedef BloombergLP::bslstl::StringRef       StringRef;
 
 enum {
     INVALID_INPUT_BIT =
@@ -325,13 +327,16 @@ struct Capacity {
     void operator--() { --d_capacity; }
         // Decrement 'd_capacity'.
 
-    void operator-=(int delta) { d_capacity -= delta; }
+    void operator-=(bsl::size_t delta) { d_capacity -= delta; }
         // Decrement 'd_capacity' by the specified 'delta'.
 
     // ACCESSORS
     bool operator<(bsl::size_t rhs) const { return d_capacity < rhs; }
         // Return 'true' if 'd_capacity' is less than the specified 'rhs', and
         // 'false' otherwise.
+
+    bsl::size_t value() const { return d_capacity; }
+        // Return 'd_capacity'.
 };
 
 struct NoOpCapacity {
@@ -345,12 +350,15 @@ struct NoOpCapacity {
     void operator--() {}
         // No-op.
 
-    void operator-=(int) {}
+    void operator-=(bsl::size_t) {}
         // No-op.
 
     // ACCESSORS
     bool operator<(bsl::size_t) const { return false; }
         // Return 'false'.
+
+    bsl::size_t value() const { return ~bsl::size_t(0); }
+        // Return the maximum value of 'bsl::size_t'.
 };
 
 // LOCAL HELPER STRUCT
@@ -418,6 +426,14 @@ struct Utf8 {
             }
         }
 
+        bsl::size_t numAvailable(const OctetType *position) const
+            // Return the number of octets from the specified 'position' to
+            // the end of input.  The behavior is undefined unless
+            // 'position <= d_end'.
+        {
+            return d_end - position;
+        }
+
         const OctetType *skipContinuations(const OctetType *octets) const
             // Return a pointer to after all the consecutive continuation
             // bytes following the specified 'octets' that are prior to
@@ -479,6 +495,13 @@ struct Utf8 {
             return 0 == *position;
         }
 
+        bsl::size_t numAvailable(const OctetType *) const
+            // Return 0.  Note that the number of octets to the end of input
+            // is not known without scanning for the terminating null.
+        {
+            return 0;
+        }
+
         const OctetType *skipContinuations(const OctetType *octets) const
             // Return a pointer to after all the consecutive continuation
             // bytes following the specified 'octets'.  The behavior is
@@ -752,6 +775,13 @@ struct Utf16 {
                 return true;                                          // RETURN
             }
         }
+
+        bsl::size_t numAvailable(const UTF16_WORD *utf16Buf) const
+            // Return the number of words from the specified 'utf16Buf' to the
+            // end of input.
+        {
+            return d_end - utf16Buf;
+        }
     };
 
     template <class UTF16_WORD>
@@ -772,6 +802,13 @@ struct Utf16 {
         {
             return !*u16Buf;
         }
+
+        bsl::size_t numAvailable(const UTF16_WORD *) const
+            // Return 0.  Note that the number of words to the end of input is
+            // not known without scanning for the terminating null.
+        {
+            return 0;
+        }
     };
 
     // CLASS METHODS
@@ -908,6 +945,8 @@ struct Swapper {
 
     enum { k_SIZE = sizeof(UTF16_WORD) };
 
+    enum { k_SWAPS_BYTES = true };
+
     // CLASS METHODS
     static
     UnicodeCodePoint decodeSingleWord(const UTF16_WORD *u16Buf)
@@ -962,6 +1001,8 @@ struct NoOpSwapper {
     // byte order -- the UTF-16 data that is being input or output is assumed
     // to be in host byte order.
 
+    enum { k_SWAPS_BYTES = false };
+
     // CLASS METHODS
     static
     UnicodeCodePoint decodeSingleWord(const UTF16_WORD *u16Buf)
@@ -1012,6 +1053,141 @@ struct NoOpSwapper {
 BSLMF_ASSERT(sizeof(wchar_t)                  >= sizeof(unsigned short));
 BSLMF_ASSERT(sizeof(bsl::wstring::value_type) >= sizeof(unsigned short));
 
+// The following templates forward runs of ASCII characters to
+// 'bdlde::CharConvertAscii', which converts them many at a time.  The first
+// 'k_MIN_BULK_LENGTH' characters of each run are handled inline, so that the
+// short runs found between non-ASCII characters do not pay for a call.  UTF-16
+// words stored in a 'wchar_t' are passed as the unsigned integral type of the
+// same size.
+
+enum { k_MIN_BULK_LENGTH = 16 };
+
+template <int SIZE>
+struct AsciiCodeUnit;
+    // This 'struct' provides a 'Type' that is the unsigned integral type
+    // having the (template parameter) 'SIZE'.
+
+template <>
+struct AsciiCodeUnit<2> {
+    typedef unsigned short Type;
+};
+
+template <>
+struct AsciiCodeUnit<4> {
+    typedef unsigned int Type;
+};
+
+inline
+bsl::size_t asciiPrefixLength(const Utf8::OctetType *octets,
+                              bsl::size_t            numOctets)
+    // Return the length of the run of ASCII characters at the start of the
+    // specified 'octets' having the specified 'numOctets' octets.
+{
+    const bsl::size_t numShort = bsl::min<bsl::size_t>(numOctets,
+                                                       k_MIN_BULK_LENGTH);
+    for (bsl::size_t i = 0; i < numShort; ++i) {
+        if (!Utf8::isSingleOctet(octets[i])) {
+            return i;                                                 // RETURN
+        }
+    }
+    if (numShort == numOctets) {
+        return numShort;                                              // RETURN
+    }
+
+    return numShort + Ascii::prefixLength(
+                        reinterpret_cast<const char *>(octets) + numShort,
+                        numOctets - numShort);
+}
+
+template <class UTF16_WORD, class SWAPPER>
+bsl::size_t asciiPrefixLength(const UTF16_WORD *words,
+                              bsl::size_t       numWords,
+                              SWAPPER)
+    // Return the length of the run of ASCII characters at the start of the
+    // specified 'words' having the specified 'numWords' words, swapped as
+    // specified by 'SWAPPER'.
+{
+    typedef typename AsciiCodeUnit<sizeof(UTF16_WORD)>::Type CodeUnit;
+
+    const bsl::size_t numShort = bsl::min<bsl::size_t>(numWords,
+                                                       k_MIN_BULK_LENGTH);
+    for (bsl::size_t i = 0; i < numShort; ++i) {
+        if (!Utf16::isSingleUtf8(SWAPPER::decodeSingleWord(words + i))) {
+            return i;                                                 // RETURN
+        }
+    }
+    if (numShort == numWords) {
+        return numShort;                                              // RETURN
+    }
+
+    const CodeUnit *input = reinterpret_cast<const CodeUnit *>(words);
+    return numShort + Ascii::prefixLength(input + numShort,
+                                          numWords - numShort,
+                                          SWAPPER::k_SWAPS_BYTES);
+}
+
+template <class UTF16_WORD, class SWAPPER>
+bsl::size_t narrowAscii(char             *dstBuffer,
+                        const UTF16_WORD *words,
+                        bsl::size_t       numWords,
+                        SWAPPER)
+    // Translate the run of ASCII characters at the start of the specified
+    // 'words' having the specified 'numWords' words, swapped as specified by
+    // 'SWAPPER', to the specified 'dstBuffer', and return its length.
+{
+    typedef typename AsciiCodeUnit<sizeof(UTF16_WORD)>::Type CodeUnit;
+
+    const bsl::size_t numShort = bsl::min<bsl::size_t>(numWords,
+                                                       k_MIN_BULK_LENGTH);
+    for (bsl::size_t i = 0; i < numShort; ++i) {
+        const UnicodeCodePoint word = SWAPPER::decodeSingleWord(words + i);
+        if (!Utf16::isSingleUtf8(word)) {
+            return i;                                                 // RETURN
+        }
+        dstBuffer[i] = static_cast<char>(word);
+    }
+    if (numShort == numWords) {
+        return numShort;                                              // RETURN
+    }
+
+    const CodeUnit *input = reinterpret_cast<const CodeUnit *>(words);
+    return numShort + Ascii::narrow(dstBuffer + numShort,
+                                    input + numShort,
+                                    numWords - numShort,
+                                    SWAPPER::k_SWAPS_BYTES);
+}
+
+template <class UTF16_WORD, class SWAPPER>
+bsl::size_t widenAscii(UTF16_WORD            *dstBuffer,
+                       const Utf8::OctetType *octets,
+                       bsl::size_t            numOctets,
+                       SWAPPER)
+    // Translate the run of ASCII characters at the start of the specified
+    // 'octets' having the specified 'numOctets' octets to the specified
+    // 'dstBuffer', swapped as specified by 'SWAPPER', and return its length.
+{
+    typedef typename AsciiCodeUnit<sizeof(UTF16_WORD)>::Type CodeUnit;
+
+    const bsl::size_t numShort = bsl::min<bsl::size_t>(numOctets,
+                                                       k_MIN_BULK_LENGTH);
+    for (bsl::size_t i = 0; i < numShort; ++i) {
+        if (!Utf8::isSingleOctet(octets[i])) {
+            return i;                                                 // RETURN
+        }
+        dstBuffer[i] = SWAPPER::encodeSingleWord(octets[i]);
+    }
+    if (numShort == numOctets) {
+        return numShort;                                              // RETURN
+    }
+
+    CodeUnit *output = reinterpret_cast<CodeUnit *>(dstBuffer);
+    return numShort + Ascii::widen(
+                            output + numShort,
+                            reinterpret_cast<const char *>(octets) + numShort,
+                            numOctets - numShort,
+                            SWAPPER::k_SWAPS_BYTES);
+}
+
 // These template functions should be in the unnamed namespace, because if they
 // are declared static, you have to fully specialize them every time you call
 // them.
@@ -1041,8 +1217,13 @@ bsl::size_t utf16BufferLength(const char  *srcBuffer,
                                           static_cast<const void*>(srcBuffer));
     while (!endFunctor.isFinished(octets)) {
         if      (Utf8::isSingleOctet(     *octets)) {
-            ++octets;
-            ++wordsNeeded;
+            const bsl::size_t numAvailable = endFunctor.numAvailable(octets);
+            const bsl::size_t numAscii     = numAvailable > 1
+                                         ? asciiPrefixLength(octets,
+                                                             numAvailable)
+                                         : 1;
+            octets      += numAscii;
+            wordsNeeded += numAscii;
         }
         else if (Utf8::isTwoOctetHeader(  *octets)) {
             octets += endFunctor.verifyContinuations(octets + 1, 1) ? 2 : 1;
@@ -1177,6 +1358,24 @@ int localUtf8ToUtf16(UTF16_WORD       *dstBuffer,
                 break;
             }
 
+            // Translate the run of ASCII characters starting here many at a
+            // time if its length can be bounded, leaving room for the null.
+
+            const bsl::size_t numAvailable = bsl::min(
+                                              endFunctor.numAvailable(octets),
+                                              dstCapacity.value() - 1);
+            if (numAvailable > 1) {
+                const bsl::size_t numAscii = widenAscii(dstBuffer,
+                                                        octets,
+                                                        numAvailable,
+                                                        swapper);
+                octets      += numAscii;
+                dstBuffer   += numAscii;
+                dstCapacity -= numAscii;
+                nCodePoints += numAscii;
+                continue;
+            }
+
             *dstBuffer = SWAPPER::encodeSingleWord(*octets);
             ++octets;
             ++dstBuffer;
@@ -1385,8 +1584,19 @@ bsl::size_t utf8BufferLength(const UTF16_WORD *srcBuffer,
         word0 = SWAPPER::decodeSingleWord(srcBuffer);
 
         if      (Utf16::isSingleUtf8(word0)) {
-            ++srcBuffer;
-            ++bytesNeeded;
+            const bsl::size_t numAvailable =
+                                            endFunctor.numAvailable(srcBuffer);
+            const bsl::size_t numAscii     = numAvailable > 1
+                                           ? asciiPrefixLength(srcBuffer,
+                                                               numAvailable,
+                                                               swapper)
+                                           : 0;
+
+            // A word that decodes to ASCII may still have bits set that
+            // 'asciiPrefixLength' does not ignore (see 'swappedToHost').
+
+            srcBuffer   += numAscii ? numAscii : 1;
+            bytesNeeded += numAscii ? numAscii : 1;
         }
         else if (Utf16::isSingleWord(word0)) {
             ++srcBuffer;
@@ -1475,6 +1685,30 @@ int localUtf16ToUtf8(char             *dstBuffer,
                 returnStatus |= OUT_OF_SPACE_BIT;
                 break;
             }
+
+            // Translate the run of ASCII characters starting here many at a
+            // time if its length can be bounded, leaving room for the null.
+            // Note that a word that decodes to ASCII may still have bits set
+            // that 'narrowAscii' does not ignore (see 'swappedToHost'), in
+            // which case it is translated below.
+
+            const bsl::size_t numAvailable = bsl::min(
+                                           endFunctor.numAvailable(srcBuffer),
+                                           dstCapacity.value() - 1);
+            const bsl::size_t numAscii     = numAvailable > 1
+                                           ? narrowAscii(dstBuffer,
+                                                         srcBuffer,
+                                                         numAvailable,
+                                                         swapper)
+                                           : 0;
+            if (numAscii) {
+                srcBuffer   += numAscii;
+                dstBuffer   += numAscii;
+                dstCapacity -= numAscii;
+                nCodePoints += numAscii;
+                continue;
+            }
+
             *dstBuffer = Utf16::getUtf8Value(word0);
             ++srcBuffer;
             ++dstBuffer;
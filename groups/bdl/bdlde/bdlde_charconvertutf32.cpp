@@ -8,6 +8,7 @@
 // ----------------------------------------------------------------------------
 
 #include <bdlde_charconvertutf32.h>
+#include <bdlde_charconvertascii.h>
 #include <bdlde_utf8util.h>    // for testing only
 
 #include <bsls_ident.h>
@@ -182,7 +183,7 @@ struct Capacity {
     void operator--();
         // Decrement 'd_capacity'.
 
-    void operator-=(int delta);
+    void operator-=(bsl::size_t delta);
         // Decrement 'd_capacity' by the specified 'delta'.
 
     // ACCESSORS
@@ -193,6 +194,9 @@ struct Capacity {
     bool operator>=(bsl::size_t rhs) const;
         // Return 'true' if 'd_capacity' is greater than or equal to the
         // specified 'rhs', and 'false' otherwise.
+
+    bsl::size_t value() const;
+        // Return 'd_capacity'.
 };
 
                            // ---------------------
@@ -214,7 +218,7 @@ void Capacity::operator--()
 }
 
 inline
-void Capacity::operator-=(int delta)
+void Capacity::operator-=(bsl::size_t delta)
     // Decrement 'd_capacity' by 'delta'.
 {
     d_capacity -= delta;
@@ -237,6 +241,13 @@ bool Capacity::operator>=(bsl::size_t rhs) const
     return d_capacity >= rhs;
 }
 
+inline
+bsl::size_t Capacity::value() const
+    // Return 'd_capacity'.
+{
+    return d_capacity;
+}
+
                          // =========================
                          // local struct NoopCapacity
                          // =========================
@@ -257,7 +268,7 @@ struct NoopCapacity {
     void operator--();
         // No-op.
 
-    void operator-=(int);
+    void operator-=(bsl::size_t);
         // No-op.
 
     // ACCESSORS
@@ -266,6 +277,9 @@ struct NoopCapacity {
 
     bool operator>=(bsl::size_t) const;
         // Return 'true'.
+
+    bsl::size_t value() const;
+        // Return the maximum value of 'bsl::size_t'.
 };
 
                          // -------------------------
@@ -285,7 +299,7 @@ void NoopCapacity::operator--()
 {}
 
 inline
-void NoopCapacity::operator-=(int)
+void NoopCapacity::operator-=(bsl::size_t)
     // No-op.
 {}
 
@@ -304,6 +318,13 @@ bool NoopCapacity::operator>=(bsl::size_t) const
     return true;
 }
 
+inline
+bsl::size_t NoopCapacity::value() const
+    // Return the maximum value of 'bsl::size_t'.
+{
+    return ~bsl::size_t(0);
+}
+
                             // ====================
                             // local struct Swapper
                             // ====================
@@ -312,6 +333,8 @@ struct Swapper {
     // This 'struct' serves as a template argument.  The type is used for
     // reversing the byte order of 'unsigned int' values passed to 'swapBytes'.
 
+    enum { k_SWAPS_BYTES = true };
+
     // CLASS METHODS
     static unsigned int swapBytes(unsigned int x);
         // Return the specified 'x' with its byte order reversed;
@@ -334,6 +357,8 @@ struct NoopSwapper {
     // function name and signature must match that of the function in
     // 'Swapper'.
 
+    enum { k_SWAPS_BYTES = false };
+
     // CLASS METHODS
     static unsigned int swapBytes(unsigned int x);
         // Return the specified 'x' without modification.
@@ -370,6 +395,11 @@ class Utf8PtrBasedEnd {
         // 'false' otherwise.  The behavior is undefined unless
         // 'position <= d_end'.
 
+    bsl::size_t numAvailable(const OctetType *position) const;
+        // Return the number of octets from the specified 'position' to the
+        // end of input.  The behavior is undefined unless
+        // 'position <= d_end'.
+
     const OctetType *skipContinuations(const OctetType *octets,
                                        int              skipBy) const;
         // Return a pointer to after the specified 'skipBy' consecutive
@@ -406,6 +436,14 @@ bool Utf8PtrBasedEnd::isFinished(const OctetType *position) const
     }
 }
 
+inline
+bsl::size_t Utf8PtrBasedEnd::numAvailable(const OctetType *position) const
+{
+    BSLS_ASSERT(d_end >= position);
+
+    return d_end - position;
+}
+
 inline
 const OctetType *Utf8PtrBasedEnd::skipContinuations(
                                                  const OctetType *octets,
@@ -462,6 +500,11 @@ struct Utf8ZeroBasedEnd {
         // Return 'true' if the specified 'position' is at the end of input,
         // and 'false' otherwise.
 
+    bsl::size_t numAvailable(const OctetType *position) const;
+        // Return 0.  Note that the number of octets from the specified
+        // 'position' to the end of input is not known without scanning for
+        // the terminating null.
+
     const OctetType *skipContinuations(const OctetType *octets,
                                        int              skipBy) const;
         // Return a pointer to after up to the specified 'skipBy' consecutive
@@ -493,6 +536,12 @@ bool Utf8ZeroBasedEnd::isFinished(const OctetType *position) const
     return 0 == *position;
 }
 
+inline
+bsl::size_t Utf8ZeroBasedEnd::numAvailable(const OctetType *) const
+{
+    return 0;
+}
+
 inline
 const OctetType *Utf8ZeroBasedEnd::skipContinuations(
                                                  const OctetType *octets,
@@ -554,6 +603,10 @@ class Utf32PtrBasedEnd {
         // Return 'true' if the specified 'position' is at the end of input and
         // 'false' otherwise.  The behavior is undefined unless
         // 'position <= d_end'.
+
+    bsl::size_t numAvailable(const unsigned int *position) const;
+        // Return the number of words from the specified 'position' to the end
+        // of input.  The behavior is undefined unless 'position <= d_end'.
 };
 
                         // ---------------------------
@@ -579,6 +632,14 @@ bool Utf32PtrBasedEnd::isFinished(const unsigned int *position) const
     }
 }
 
+inline
+bsl::size_t Utf32PtrBasedEnd::numAvailable(const unsigned int *position) const
+{
+    BSLS_ASSERT(d_end_p >= position);
+
+    return d_end_p - position;
+}
+
                        // ==============================
                        // local struct Utf32ZeroBasedEnd
                        // ==============================
@@ -592,6 +653,11 @@ struct Utf32ZeroBasedEnd {
     bool isFinished(const unsigned int *position) const;
         // Return 'true' if the specified 'position' is at the end of input,
         // and 'false' otherwise.
+
+    bsl::size_t numAvailable(const unsigned int *position) const;
+        // Return 0.  Note that the number of words from the specified
+        // 'position' to the end of input is not known without scanning for
+        // the terminating null.
 };
 
                        // ------------------------------
@@ -611,6 +677,12 @@ bool Utf32ZeroBasedEnd::isFinished(const unsigned int *position) const
     return 0 == *position;
 }
 
+inline
+bsl::size_t Utf32ZeroBasedEnd::numAvailable(const unsigned int *) const
+{
+    return 0;
+}
+
 }  // close unnamed namespace
 
 static inline
@@ -841,6 +913,116 @@ const OctetType *skipUtf8CodePoint(const OctetType *input)
     return input + lookaheadContinuations(input, expected);
 }
 
+// The following functions forward runs of ASCII characters to
+// 'bdlde::CharConvertAscii', which translates them many at a time.  The first
+// 'k_MIN_BULK_LENGTH' characters of each run are handled inline, so that the
+// short runs found between non-ASCII characters do not pay for a call.
+
+enum { k_MIN_BULK_LENGTH = 16 };
+
+static inline
+bsl::size_t asciiPrefixLength(const OctetType *input, bsl::size_t numOctets)
+    // Return the length of the run of ASCII characters at the start of the
+    // specified 'input' having the specified 'numOctets' octets.
+{
+    const bsl::size_t numShort = bsl::min<bsl::size_t>(numOctets,
+                                                       k_MIN_BULK_LENGTH);
+    for (bsl::size_t i = 0; i < numShort; ++i) {
+        if (!isSingleOctet(input[i])) {
+            return i;                                                 // RETURN
+        }
+    }
+    if (numShort == numOctets) {
+        return numShort;                                              // RETURN
+    }
+
+    return numShort + BloombergLP::bdlde::CharConvertAscii::prefixLength(
+                            reinterpret_cast<const char *>(input) + numShort,
+                            numOctets - numShort);
+}
+
+template <class SWAPPER>
+static inline
+bsl::size_t asciiPrefixLength(const unsigned int *input,
+                              bsl::size_t         numWords)
+    // Return the length of the run of ASCII characters at the start of the
+    // specified 'input' having the specified 'numWords' words, swapped as
+    // specified by 'SWAPPER'.
+{
+    const bsl::size_t numShort = bsl::min<bsl::size_t>(numWords,
+                                                       k_MIN_BULK_LENGTH);
+    for (bsl::size_t i = 0; i < numShort; ++i) {
+        if (!fitsInSingleOctet(SWAPPER::swapBytes(input[i]))) {
+            return i;                                                 // RETURN
+        }
+    }
+    if (numShort == numWords) {
+        return numShort;                                              // RETURN
+    }
+
+    return numShort + BloombergLP::bdlde::CharConvertAscii::prefixLength(
+                                                      input + numShort,
+                                                      numWords - numShort,
+                                                      SWAPPER::k_SWAPS_BYTES);
+}
+
+template <class SWAPPER>
+static inline
+bsl::size_t narrowAscii(OctetType          *output,
+                        const unsigned int *input,
+                        bsl::size_t         numWords)
+    // Translate the run of ASCII characters at the start of the specified
+    // 'input' having the specified 'numWords' words, swapped as specified by
+    // 'SWAPPER', to the specified 'output', and return its length.
+{
+    const bsl::size_t numShort = bsl::min<bsl::size_t>(numWords,
+                                                       k_MIN_BULK_LENGTH);
+    for (bsl::size_t i = 0; i < numShort; ++i) {
+        const unsigned int uc = SWAPPER::swapBytes(input[i]);
+        if (!fitsInSingleOctet(uc)) {
+            return i;                                                 // RETURN
+        }
+        output[i] = static_cast<OctetType>(uc);
+    }
+    if (numShort == numWords) {
+        return numShort;                                              // RETURN
+    }
+
+    return numShort + BloombergLP::bdlde::CharConvertAscii::narrow(
+                                   reinterpret_cast<char *>(output) + numShort,
+                                   input + numShort,
+                                   numWords - numShort,
+                                   SWAPPER::k_SWAPS_BYTES);
+}
+
+template <class SWAPPER>
+static inline
+bsl::size_t widenAscii(unsigned int    *output,
+                       const OctetType *input,
+                       bsl::size_t      numOctets)
+    // Translate the run of ASCII characters at the start of the specified
+    // 'input' having the specified 'numOctets' octets to the specified
+    // 'output', swapped as specified by 'SWAPPER', and return its length.
+{
+    const bsl::size_t numShort = bsl::min<bsl::size_t>(numOctets,
+                                                       k_MIN_BULK_LENGTH);
+    for (bsl::size_t i = 0; i < numShort; ++i) {
+        if (!isSingleOctet(input[i])) {
+            return i;                                                 // RETURN
+        }
+        output[i] = SWAPPER::swapBytes(input[i]);
+    }
+    if (numShort == numOctets) {
+        return numShort;                                              // RETURN
+    }
+
+    return numShort + BloombergLP::bdlde::CharConvertAscii::widen(
+                            output + numShort,
+                            reinterpret_cast<const char *>(input) + numShort,
+                            numOctets - numShort,
+                            SWAPPER::k_SWAPS_BYTES);
+}
+
 template <class END_FUNCTOR>
 static
 bsl::size_t utf32BufferLengthNeeded(const char  *input,
@@ -867,8 +1049,20 @@ bsl::size_t utf32BufferLengthNeeded(const char  *input,
     const OctetType *octets = constOctetCast(input);
 
     bsl::size_t ret = 0;
-    for (; ! endFunctor.isFinished(octets); ++ret) {
-        octets = skipUtf8CodePoint(octets);
+    while (! endFunctor.isFinished(octets)) {
+        const bsl::size_t numAscii = isSingleOctet(*octets)
+                                   ? asciiPrefixLength(
+                                               octets,
+                                               endFunctor.numAvailable(octets))
+                                   : 0;
+        if (numAscii) {
+            octets += numAscii;
+            ret    += numAscii;
+        }
+        else {
+            octets = skipUtf8CodePoint(octets);
+            ++ret;
+        }
     }
 
     return ret + 1;
@@ -900,6 +1094,17 @@ bsl::size_t utf8BufferLengthNeeded(const unsigned int *input,
     bsl::size_t ret = 0;
     for (; !endFunctor.isFinished(input); ++input) {
         uc = SWAPPER::swapBytes(*input);
+        if (fitsInSingleOctet(uc)) {
+            const bsl::size_t numAscii = asciiPrefixLength<SWAPPER>(
+                                               input,
+                                               endFunctor.numAvailable(input));
+            if (numAscii) {
+                input += numAscii - 1;
+                ret   += numAscii;
+                continue;
+            }
+        }
+
         ret += fitsInSingleOctet(uc)
                ? 1
                : fitsInTwoOctets(uc)
@@ -1159,6 +1364,23 @@ int Utf8ToUtf32Translator<CAPACITY, END_FUNCTOR, SWAPPER>::translate(
 
     int ret = 0;
     while (!endFunctor.isFinished(translator.d_input)) {
+        // Translate the run of ASCII characters starting here many at a time
+        // if its length can be bounded, leaving room for the null.
+
+        const bsl::size_t numAscii = isSingleOctet(*translator.d_input)
+                  ? widenAscii<SWAPPER>(
+                        translator.d_output,
+                        translator.d_input,
+                        bsl::min(endFunctor.numAvailable(translator.d_input),
+                                 translator.d_capacity.value() - 1))
+                  : 0;
+        if (numAscii) {
+            translator.d_input    += numAscii;
+            translator.d_output   += numAscii;
+            translator.d_capacity -= numAscii;
+            continue;
+        }
+
         if (0 != translator.decodeCodePoint()) {
             BSLS_ASSERT((bsl::is_same<CAPACITY, Capacity>::value));
             ret = k_OUT_OF_SPACE_BIT;
@@ -1432,7 +1654,27 @@ int Utf32ToUtf8Translator<CAPACITY, END_FUNCTOR, SWAPPER>::translate(
     int          ret = 0;
     unsigned int uc;
     while (!endFunctor.isFinished(translator.d_input)) {
-        uc = SWAPPER::swapBytes(*translator.d_input++);
+        // Translate the run of ASCII characters starting here many at a time
+        // if its length can be bounded, leaving room for the null.
+
+        uc = SWAPPER::swapBytes(*translator.d_input);
+
+        const bsl::size_t numAscii = fitsInSingleOctet(uc)
+                  ? narrowAscii<SWAPPER>(
+                        translator.d_output,
+                        translator.d_input,
+                        bsl::min(endFunctor.numAvailable(translator.d_input),
+                                 translator.d_capacity.value() - 1))
+                  : 0;
+        if (numAscii) {
+            translator.d_input                += numAscii;
+            translator.d_output               += numAscii;
+            translator.d_capacity             -= numAscii;
+            translator.d_numCodePointsWritten += numAscii;
+            continue;
+        }
+
+        ++translator.d_input;
         if (0 != translator.decodeCodePoint(uc)) {
             BSLS_ASSERT((bsl::is_same<CAPACITY, Capacity>::value));
             ret |= k_OUT_OF_SPACE_BIT;
@@ -12,9 +12,22 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(bdlde_crc32_cpp,"$Id$ $CSID$")
 
+#include <bdlde_simd_cpufeatures.h>
+
 #include <bslmf_assert.h>
 
 #include <bsls_annotation.h>
+#include <bsls_atomicoperations.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#if defined(BSLS_PLATFORM_CPU_X86_64)                                         \
+ && (defined(BSLS_PLATFORM_CMP_CLANG)                                         \
+  || (defined(BSLS_PLATFORM_CMP_GNU) && BSLS_PLATFORM_CMP_VERSION >= 40900))
+#define U_PCLMUL_KERNEL
+    // A carry-less multiplication kernel, selected at run time, is available.
+#include <immintrin.h>
+#endif
 
 ///IMPLEMENTATION NOTES
 ///--------------------
@@ -93,6 +106,29 @@ BSLS_IDENT_RCSID(bdlde_crc32_cpp,"$Id$ $CSID$")
 //..
 //  http://ravenphpscripts.com/modules.php?name=Forums&file=viewtopic&t=614
 //..
+//
+// On x86-64 CPUs supporting the 'PCLMULQDQ' instruction, 'update' processes
+// buffers of at least 64 bytes by "folding", as described in Gopal et al.,
+// "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction"
+// (Intel, 2009).  With the running CRC exclusive-or'ed into the first bytes
+// of the input, the CRC of a message 'M' is 'M(x) * x^32 mod P(x)', where the
+// first bit of the message is its highest-order coefficient.  A 128-bit block
+// 'A = H * x^64 + L' that is followed by 'D' further bits of the message
+// contributes 'H * x^(64 + D) + L * x^D' to 'M(x)', which is congruent modulo
+// 'P(x)' to the 128-bit value 'H * K1 + L * K2' (with 'K1 = x^(64 + D) mod P'
+// and 'K2 = x^D mod P') exclusive-or'ed into the block that is 'D' bits later.
+// Four 128-bit accumulators are folded across 512 bits at a time, then into
+// one another, and the last 16 bytes of accumulated state are reduced using
+// the table.  As the bits of each byte are reflected, carry-less products
+// are one bit short of the required alignment, which the constants below
+// compensate for by using 'x^(63 + D) mod P' and 'x^(D - 1) mod P', each
+// stored with its highest-order coefficient in bit 0.
+//
+// 'combine' relies on the CRC being linear: the CRC of 'A' followed by 'B' is
+// the CRC of 'A' followed by 'lengthB' zero bytes, exclusive-or'ed with the
+// CRC of 'B' (the pre- and post-conditioning terms cancel), and appending
+// 'n' zero bytes amounts to multiplying by 'x^(8 * n) mod P(x)', which is
+// computed by repeated squaring.
 
 #include <bsls_assert.h>
 #include <bsl_ostream.h>
@@ -158,21 +194,36 @@ static const unsigned int CRC_TABLE[256] = {
     0x2d02ef8d
 };
 
-namespace bdlde {
-                                // -----------
-                                // class Crc32
-                                // -----------
+namespace {
 
-// MANIPULATORS
-void Crc32::update(const void *data, bsl::size_t length)
-{
-    BSLS_ASSERT(data || !length);
+enum {
+    k_KERNEL_UNKNOWN = 0,  // kernel not yet selected
+    k_KERNEL_TABLE   = 1,  // table lookup only
+    k_KERNEL_PCLMUL  = 2   // carry-less multiplication
+};
+
+enum { k_MIN_PCLMUL_LENGTH = 64 };  // shortest input using 'PCLMULQDQ'
 
+const unsigned int k_POLYNOMIAL = 0xedb88320;
+    // The CRC-32 polynomial with its highest-order coefficient in bit 0.
+
+bsls::AtomicOperations::AtomicTypes::Int s_kernel;
+    // The kernel used by 'update', or 'k_KERNEL_UNKNOWN' if it has not been
+    // selected yet.  Note that, as selection is idempotent, concurrent first
+    // calls may race to set this value without harm.
+
+unsigned int updateTable(unsigned int         crc,
+                         const unsigned char *data,
+                         bsl::size_t          length)
+    // Return the result of updating the specified running (pre-conditioned)
+    // 'crc' with the specified 'data' having the specified 'length', using
+    // table lookup.
+{
     // The following is a Duff's Device-based implementation of a common
     // algorithm (see end of RFC 1952).
 
-    const unsigned char *d   = (const unsigned char *)data;
-    unsigned int         tmp = d_crc;
+    const unsigned char *d   = data;
+    unsigned int         tmp = crc;
 
     switch (length % 4) {
       case 3: tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
@@ -193,7 +244,169 @@ void Crc32::update(const void *data, bsl::size_t length)
         --n;
     }
 
-    d_crc = tmp;
+    return tmp;
+}
+
+#if defined(U_PCLMUL_KERNEL)
+
+const bsls::Types::Uint64 k_FOLD_512_HIGH = 0x653d982200000000ULL;
+const bsls::Types::Uint64 k_FOLD_512_LOW  = 0xcad38e8f00000000ULL;
+const bsls::Types::Uint64 k_FOLD_128_HIGH = 0x65673b4600000000ULL;
+const bsls::Types::Uint64 k_FOLD_128_LOW  = 0x9ba54c6f00000000ULL;
+    // Constants folding a 128-bit block across 512 and 128 bits.  The 'HIGH'
+    // constants are 'x^(63 + D) mod P' and the 'LOW' constants 'x^(D - 1) mod
+    // P', where 'D' is the folding distance (see the IMPLEMENTATION NOTES).
+
+__attribute__((target("pclmul")))
+inline
+__m128i fold(__m128i block, __m128i constants, __m128i next)
+    // Return the specified 'next' block of input exclusive-or'ed with the
+    // specified 'block' folded using the specified 'constants'.
+{
+    const __m128i high = _mm_clmulepi64_si128(block, constants, 0x00);
+    const __m128i low  = _mm_clmulepi64_si128(block, constants, 0x11);
+
+    return _mm_xor_si128(_mm_xor_si128(high, low), next);
+}
+
+__attribute__((target("pclmul")))
+unsigned int updatePclmul(unsigned int         crc,
+                          const unsigned char *data,
+                          bsl::size_t          length)
+    // Return the result of updating the specified running (pre-conditioned)
+    // 'crc' with the specified 'data' having the specified 'length', using
+    // carry-less multiplication.  The behavior is undefined unless
+    // 'k_MIN_PCLMUL_LENGTH <= length'.
+{
+    const __m128i fold512 = _mm_set_epi64x(
+                                   static_cast<long long>(k_FOLD_512_LOW),
+                                   static_cast<long long>(k_FOLD_512_HIGH));
+    const __m128i fold128 = _mm_set_epi64x(
+                                   static_cast<long long>(k_FOLD_128_LOW),
+                                   static_cast<long long>(k_FOLD_128_HIGH));
+
+    const __m128i *p = reinterpret_cast<const __m128i *>(data);
+
+    __m128i x0 = _mm_xor_si128(_mm_loadu_si128(p),
+                               _mm_cvtsi32_si128(static_cast<int>(crc)));
+    __m128i x1 = _mm_loadu_si128(p + 1);
+    __m128i x2 = _mm_loadu_si128(p + 2);
+    __m128i x3 = _mm_loadu_si128(p + 3);
+    p      += 4;
+    length -= 64;
+
+    for (; length >= 64; p += 4, length -= 64) {
+        x0 = fold(x0, fold512, _mm_loadu_si128(p));
+        x1 = fold(x1, fold512, _mm_loadu_si128(p + 1));
+        x2 = fold(x2, fold512, _mm_loadu_si128(p + 2));
+        x3 = fold(x3, fold512, _mm_loadu_si128(p + 3));
+    }
+
+    x1 = fold(x0, fold128, x1);
+    x2 = fold(x1, fold128, x2);
+    x3 = fold(x2, fold128, x3);
+
+    for (; length >= 16; ++p, length -= 16) {
+        x3 = fold(x3, fold128, _mm_loadu_si128(p));
+    }
+
+    unsigned char remainder[16];
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(remainder), x3);
+
+    return updateTable(updateTable(0, remainder, 16),
+                       reinterpret_cast<const unsigned char *>(p),
+                       length);
+}
+
+#endif  // U_PCLMUL_KERNEL
+
+int selectKernel()
+    // Return the fastest kernel supported by the CPU on which this process is
+    // running.
+{
+#if defined(U_PCLMUL_KERNEL)
+    typedef bdlde::Simd_CpuFeatures Features;
+
+    if (Features::isSupported(Features::e_PCLMUL)) {
+        return k_KERNEL_PCLMUL;                                       // RETURN
+    }
+#endif
+
+    return k_KERNEL_TABLE;
+}
+
+unsigned int multiplyModP(unsigned int a, unsigned int b)
+    // Return the product, modulo the CRC-32 polynomial, of the specified 'a'
+    // and 'b', each having its highest-order coefficient in bit 0.  The
+    // behavior is undefined unless '0 != a'.
+{
+    unsigned int mask    = 0x80000000;
+    unsigned int product = 0;
+
+    for (;;) {
+        if (a & mask) {
+            product ^= b;
+            if (0 == (a & (mask - 1))) {
+                break;
+            }
+        }
+        mask >>= 1;
+        b     = b & 1 ? (b >> 1) ^ k_POLYNOMIAL : b >> 1;
+    }
+
+    return product;
+}
+
+}  // close unnamed namespace
+
+namespace bdlde {
+                                // -----------
+                                // class Crc32
+                                // -----------
+
+// CLASS METHODS
+unsigned int Crc32::combine(unsigned int crcA,
+                            unsigned int crcB,
+                            bsl::size_t  lengthB)
+{
+    // Compute 'x^(8 * lengthB) mod P' by repeated squaring, starting from
+    // 'x^8', and multiply 'crcA' by it.
+
+    unsigned int power = 0x00800000;  // x^8
+
+    for (; lengthB; lengthB >>= 1) {
+        if (lengthB & 1) {
+            crcA = multiplyModP(power, crcA);
+        }
+        power = multiplyModP(power, power);
+    }
+
+    return crcA ^ crcB;
+}
+
+// MANIPULATORS
+void Crc32::update(const void *data, bsl::size_t length)
+{
+    BSLS_ASSERT(data || !length);
+
+    const unsigned char *d = static_cast<const unsigned char *>(data);
+
+    if (length >= k_MIN_PCLMUL_LENGTH) {
+        int kernel = bsls::AtomicOperations::getIntRelaxed(&s_kernel);
+        if (k_KERNEL_UNKNOWN == kernel) {
+            kernel = selectKernel();
+            bsls::AtomicOperations::setIntRelaxed(&s_kernel, kernel);
+        }
+
+#if defined(U_PCLMUL_KERNEL)
+        if (k_KERNEL_PCLMUL == kernel) {
+            d_crc = updatePclmul(d_crc, d, length);
+            return;                                                   // RETURN
+        }
+#endif
+    }
+
+    d_crc = updateTable(d_crc, d, length);
 }
 
 // ACCESSORS
@@ -29,6 +29,13 @@ BSLS_IDENT("$Id: $")
 // SHA-256, it is relatively easy to find alternate texts with identical
 // checksum.
 //
+// On x86-64 platforms supporting carry-less multiplication (the 'PCLMULQDQ'
+// instruction), which is detected at run time, 'update' processes large
+// buffers many times faster than the portable table-driven implementation
+// used otherwise.  The class method 'combine' computes the checksum of the
+// concatenation of two buffers from the checksums of each, so that a large
+// buffer can be divided into parts whose checksums are computed concurrently.
+//
 ///Usage
 ///-----
 // The following snippets of code illustrate a typical use of the
@@ -83,6 +90,27 @@ BSLS_IDENT("$Id: $")
 //      assert(crcLocal == crc);
 //  }
 //..
+// Finally, the 'combineExample' function below computes the checksum of a
+// buffer from the checksums of its two halves, as would be done if the
+// halves were checksummed by different threads:
+//..
+//  void combineExample(const char *data, bsl::size_t length)
+//      // Verify that combining the checksums of the two halves of the
+//      // specified 'data' having the specified 'length' yields the checksum
+//      // of 'data'.
+//  {
+//      const bsl::size_t half = length / 2;
+//
+//      bdlde::Crc32 crcA(data,        half);
+//      bdlde::Crc32 crcB(data + half, length - half);
+//
+//      const unsigned int combined = bdlde::Crc32::combine(crcA.checksum(),
+//                                                          crcB.checksum(),
+//                                                          length - half);
+//
+//      assert(bdlde::Crc32(data, length).checksum() == combined);
+//  }
+//..
 
 #include <bdlscm_version.h>
 
@@ -122,6 +150,17 @@ class Crc32 {
 
   public:
     // CLASS METHODS
+    static unsigned int combine(unsigned int crcA,
+                                unsigned int crcB,
+                                bsl::size_t  lengthB);
+        // Return the CRC-32 checksum of the concatenation of a sequence of
+        // bytes 'A' followed by a sequence of bytes 'B', given the specified
+        // 'crcA', the checksum of 'A', the specified 'crcB', the checksum of
+        // 'B', and the specified 'lengthB', the length (in bytes) of 'B'.
+        // Note that this allows the checksum of a large buffer to be computed
+        // from the checksums of its parts, which may be computed
+        // independently (e.g., concurrently).
+
     static int maxSupportedBdexVersion(int versionSelector);
         // Return the maximum valid BDEX format version, as indicated by the
         // specified 'versionSelector', to be passed to the 'bdexStreamOut'
@@ -72,6 +72,7 @@ using namespace bsl;  // automatically added by script
 //
 //-----------------------------------------------------------------------------
 // CLASS METHODS
+// [16] static unsigned int combine(unsigned int, unsigned int, size_t);
 // [10] static int maxSupportedBdexVersion(int);
 //
 // CREATORS
@@ -86,6 +87,7 @@ using namespace bsl;  // automatically added by script
 // [ 4] unsigned int checksumAndReset();
 // [13] void reset();
 // [11] void update(const void *data, int length);
+// [15] void update(const void *data, int length);
 //
 // ACCESSORS
 // [10] STREAM& bdexStreamOut(STREAM& stream, int version) const;
@@ -98,7 +100,7 @@ using namespace bsl;  // automatically added by script
 // [ 5] bsl::ostream& operator<<(bsl::ostream& stream, const bdlde::Crc32&);
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [15] USAGE EXAMPLE
+// [17] USAGE EXAMPLE
 // [ 2] BOOTSTRAP: void update(const void *data, int length);
 // [14] CRC_TABLE TEST
 // [-1] PERFORMANCE TEST
@@ -228,6 +230,27 @@ void receiverExample(In& input)
     // verify that the received and locally-computed checksums match
     ASSERT(crcLocal == crc);
 }
+//..
+// Finally, the 'combineExample' function below computes the checksum of a
+// buffer from the checksums of its two halves, as would be done if the
+// halves were checksummed by different threads:
+//..
+void combineExample(const char *data, bsl::size_t length)
+    // Verify that combining the checksums of the two halves of the specified
+    // 'data' having the specified 'length' yields the checksum of 'data'.
+{
+    const bsl::size_t half = length / 2;
+
+    bdlde::Crc32 crcA(data,        half);
+    bdlde::Crc32 crcB(data + half, length - half);
+
+    const unsigned int combined = bdlde::Crc32::combine(crcA.checksum(),
+                                                        crcB.checksum(),
+                                                        length - half);
+
+    ASSERT(bdlde::Crc32(data, length).checksum() == combined);
+}
+//..
 
 // ============================================================================
 //                    GLOBAL HELPER FUNCTIONS FOR TESTING
@@ -516,7 +539,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 15: {
+      case 17: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   This will test the usage example provided in the component header
@@ -527,8 +550,8 @@ int main(int argc, char *argv[])
         //   compile, link, and run on all platforms as shown.
         //
         // Plan:
-        //   Run the usage example functions 'senderExample' and
-        //   'receiverExample'.
+        //   Run the usage example functions 'senderExample',
+        //   'receiverExample', and 'combineExample'.
         //
         // Testing:
         //   Usage example.
@@ -546,6 +569,141 @@ int main(int argc, char *argv[])
 
         receiverExample(in);
 
+        static const char MESSAGE[] = "The quick brown fox jumps over the "
+                                      "lazy dog, again and again and again.";
+        combineExample(MESSAGE, sizeof MESSAGE - 1);
+
+      } break;
+      case 16: {
+        // --------------------------------------------------------------------
+        // TESTING 'combine'
+        //
+        // Concerns:
+        //: 1 'combine' returns the checksum of the concatenation of two
+        //:   sequences of bytes given the checksums of each and the length of
+        //:   the second.
+        //:
+        //: 2 Either sequence may be empty.
+        //:
+        //: 3 Checksums of many consecutive parts can be combined in turn.
+        //
+        // Plan:
+        //: 1 For a pseudo-random buffer and for a set of lengths of each of
+        //:   two consecutive sequences, including 0, compare the result of
+        //:   'combine' against the oracle applied to the concatenation.
+        //:   (C-1..2)
+        //:
+        //: 2 Split the buffer into parts of varying lengths, combine their
+        //:   checksums in order, and compare with the checksum of the
+        //:   buffer.  (C-3)
+        //
+        // Testing:
+        //   static unsigned int combine(unsigned int, unsigned int, size_t);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'combine'"
+                          << "\n=================" << endl;
+
+        enum { k_BUFFER_SIZE = 8192 };
+        char         buffer[k_BUFFER_SIZE];
+        unsigned int seed = 12345;
+        for (int i = 0; i < k_BUFFER_SIZE; ++i) {
+            seed      = seed * 1103515245 + 12345;
+            buffer[i] = static_cast<char>(seed >> 16);
+        }
+
+        static const int LENGTHS[] = {
+            0, 1, 2, 3, 7, 8, 15, 16, 17, 63, 64, 65, 127, 128, 255, 1000, 4000
+        };
+        const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        for (int i = 0; i < NUM_LENGTHS; ++i) {
+            const int LENGTH_A = LENGTHS[i];
+
+            for (int j = 0; j < NUM_LENGTHS; ++j) {
+                const int LENGTH_B = LENGTHS[j];
+
+                const unsigned int CRC_A = crc(buffer, LENGTH_A);
+                const unsigned int CRC_B = crc(buffer + LENGTH_A, LENGTH_B);
+                const unsigned int EXP   = crc(buffer, LENGTH_A + LENGTH_B);
+
+                if (veryVerbose) { T_ P_(LENGTH_A) P(LENGTH_B) }
+
+                LOOP2_ASSERT(LENGTH_A, LENGTH_B,
+                             EXP == Obj::combine(CRC_A, CRC_B, LENGTH_B));
+            }
+        }
+
+        for (int step = 1; step < 700; step += 37) {
+            unsigned int combined = crc(buffer, 0);
+            int offset   = 0;
+            for (int length = step; offset < k_BUFFER_SIZE; length += 11) {
+                const int LENGTH = bsl::min(length, k_BUFFER_SIZE - offset);
+
+                combined = Obj::combine(combined,
+                                        crc(buffer + offset, LENGTH),
+                                        LENGTH);
+                offset  += LENGTH;
+            }
+            LOOP_ASSERT(step, crc(buffer, k_BUFFER_SIZE) == combined);
+        }
+      } break;
+      case 15: {
+        // --------------------------------------------------------------------
+        // TESTING 'update' ON LARGE BUFFERS
+        //
+        // Concerns:
+        //: 1 'update' computes the correct checksum whether or not the
+        //:   buffer is long enough to be processed by the hardware-accelerated
+        //:   implementation (if available), whatever the remainder of its
+        //:   length modulo the block sizes of that implementation.
+        //:
+        //: 2 The result does not depend on the alignment of the buffer.
+        //:
+        //: 3 Updating with consecutive parts of a buffer yields the checksum
+        //:   of the whole buffer.
+        //
+        // Plan:
+        //: 1 For a pseudo-random buffer, and for every length up to a few
+        //:   hundred bytes beyond several multiples of 64 and for several
+        //:   offsets, compare the checksum with that of the oracle.
+        //:   (C-1..2)
+        //:
+        //: 2 Split the buffer at various points, update with each part in
+        //:   turn, and compare with the oracle.  (C-3)
+        //
+        // Testing:
+        //   void update(const void *data, int length);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'update' ON LARGE BUFFERS"
+                          << "\n=================================" << endl;
+
+        enum { k_BUFFER_SIZE = 4096 };
+        char         buffer[k_BUFFER_SIZE];
+        unsigned int seed = 54321;
+        for (int i = 0; i < k_BUFFER_SIZE; ++i) {
+            seed      = seed * 1103515245 + 12345;
+            buffer[i] = static_cast<char>(seed >> 16);
+        }
+
+        for (int length = 0; length < k_BUFFER_SIZE - 8;
+                                      length += length < 600 ? 1 : 61) {
+            for (int offset = 0; offset < 8; offset += 3) {
+                Obj mX(buffer + offset, length);  const Obj& X = mX;
+
+                LOOP2_ASSERT(length, offset,
+                             crc(buffer + offset, length) == X.checksum());
+            }
+        }
+
+        for (int split = 0; split < 1000; split += 13) {
+            Obj mX;  const Obj& X = mX;
+            mX.update(buffer, split);
+            mX.update(buffer + split, k_BUFFER_SIZE - split);
+
+            LOOP_ASSERT(split, crc(buffer, k_BUFFER_SIZE) == X.checksum());
+        }
       } break;
       case 14: {
         // --------------------------------------------------------------------
@@ -2679,6 +2837,29 @@ int main(int argc, char *argv[])
                       << bsl::endl;
         }
 
+        {
+            bsl::cout << "BDE crc32 large buffer run" << bsl::endl;
+
+            enum { k_BUFFER_SIZE = 1 << 20, k_NUM_RUNS = 1000 };
+            bsl::vector<char> buffer(k_BUFFER_SIZE);
+            for (int i = 0; i < k_BUFFER_SIZE; ++i) {
+                buffer[i] = static_cast<char>(i * 7 + (i >> 8));
+            }
+
+            Obj mX;
+
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int i = 0; i < k_NUM_RUNS; ++i) {
+                mX.update(buffer.data(), buffer.size());
+            }
+            timer.stop();
+
+            bsl::cout << "BDE CRC32 on 1 MB buffers: "
+                      << k_NUM_RUNS / timer.elapsedTime() << " MB/sec."
+                      << bsl::endl;
+        }
+
       } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
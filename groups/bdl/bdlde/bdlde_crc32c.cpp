@@ -5,6 +5,8 @@
 BSLS_IDENT_RCSID(bdlde_crc32c_cpp,"$Id$ $CSID$")
 
 // BDE
+#include <bdlde_simd_cpufeatures.h>
+
 #include <bsl_algorithm.h>
 #include <bsl_cstddef.h>
 #include <bsl_iostream.h>
@@ -29,10 +31,6 @@ BSLS_IDENT_RCSID(bdlde_crc32c_cpp,"$Id$ $CSID$")
 #endif
 #endif
 
-#if defined(LIKE_X86_GCC)
-#include <cpuid.h>
-#endif
-
 // #define BDLDE_SUPPORT_SPARC_HARDWARE_OPTIMIZATION
     // The Sparc hardware optimization is implemented in a third-party library
     // provided by Oracle.  For the time being we remove optimized crc32
@@ -1215,17 +1213,9 @@ Crc32cCalculator::Crc32cCalculator()
 {
 #if defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64)
 
-#if defined(BSLS_PLATFORM_CMP_CLANG)
-#    define BDLDE_SSE4_2 bit_SSE42
-#elif defined(BSLS_PLATFORM_CMP_GNU)
-#    define BDLDE_SSE4_2 bit_SSE4_2
-#endif
-
-#ifdef BDLDE_SSE4_2
-    unsigned int eax, ebx, ecx, edx;
-    __cpuid(1, eax, ebx, ecx, edx);
-
-    if (ecx & BDLDE_SSE4_2) { // SSE 4.2 Support for CRC32-C
+#if defined(LIKE_X86_GCC)
+    if (Simd_CpuFeatures::isSupported(Simd_CpuFeatures::e_SSE4_2)) {
+        // SSE 4.2 Support for CRC32-C
 
 #ifdef BSLS_PLATFORM_CPU_64_BIT
         BSLS_LOG_INFO("Using hardware version for CRC32-C computation "
@@ -1238,14 +1228,13 @@ Crc32cCalculator::Crc32cCalculator()
                       "32-bit mode)");
         s_crc32cFn = crc32cHardwareSerial;
 #endif  // BSLS_PLATFORM_CPU_64_BIT
-#undef BDLDE_SSE4_2
     }
     else {
         BSLS_LOG_INFO("Using software version for CRC32-C computation "
                       "(SSE4.2 instructions not available)");
         s_crc32cFn = crc32cSoftware;
     }
-#else  // BDLDE_SSE4_2.  Unsupported compiler.  Note that Windows hardware
+#else  // LIKE_X86_GCC.  Unsupported compiler.  Note that Windows hardware
        // implementation will be chosen here when supported.
     BSLS_LOG_INFO("Using software version for CRC32-C computation "
                   "(unsupported compiler)");
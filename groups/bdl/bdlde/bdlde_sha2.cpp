@@ -1,10 +1,44 @@
 // bdlde_sha2.cpp                                                     -*-C++-*-
 #include <bdlde_sha2.h>
 
+#include <bdlde_simd_cpufeatures.h>
+
+#include <bsls_platform.h>
+
 #include <bsl_algorithm.h>
 #include <bsl_climits.h>
+#include <bsl_cstring.h>
 #include <bsl_ostream.h>
 
+#if defined(BSLS_PLATFORM_CPU_X86_64)                                         \
+ && (defined(BSLS_PLATFORM_CMP_CLANG)                                         \
+  || (defined(BSLS_PLATFORM_CMP_GNU) && BSLS_PLATFORM_CMP_VERSION >= 50000))
+#define U_SHA256_KERNELS
+    // Hardware SHA-256 kernels, selected at run time, are available.
+#include <immintrin.h>
+#endif
+
+///Implementation Notes
+///--------------------
+// The SHA-224 and SHA-256 compression function is implemented three ways:
+//
+//: o A portable implementation, 'transform', shared with SHA-384 and SHA-512.
+//:
+//: o A kernel using the x86 SHA extensions ('sha256rnds2', 'sha256msg1', and
+//:   'sha256msg2'), which performs two rounds per instruction and computes
+//:   the message schedule in hardware.  When available, it is used for every
+//:   SHA-224 and SHA-256 block, including the blocks of 'loadDigests'.
+//:
+//: o An AVX2 kernel that compresses one block from each of 8 independent
+//:   messages at once, each message occupying one 32-bit lane of the 'ymm'
+//:   registers.  SHA-256 is strictly sequential within a message, so AVX2
+//:   cannot usefully accelerate a single message; it is used only by
+//:   'loadDigests' on CPUs lacking the SHA extensions.
+//
+// The kernels are selected on first use based on the capabilities of the
+// CPU, and all of them produce results identical to the portable
+// implementation.
+
 namespace BloombergLP {
 namespace bdlde {
 namespace {
@@ -247,6 +281,367 @@ void transform(INTEGER             *state,
     }
 }
 
+enum {
+    k_FEATURE_SHA  = 1,  // SHA extensions (with SSE4.1)
+    k_FEATURE_AVX2 = 2   // AVX2, with OS support for 'ymm' registers
+};
+
+int features()
+    // Return the combination of 'k_FEATURE_*' flags supported by the CPU on
+    // which this process is running.
+{
+    int result = 0;
+#if defined(U_SHA256_KERNELS)
+    typedef bdlde::Simd_CpuFeatures Features;
+
+    const int available = Features::features();
+
+    if ((available & Features::e_SSE4_1) && (available & Features::e_SHA)) {
+        result |= k_FEATURE_SHA;
+    }
+    if (available & Features::e_AVX2) {
+        result |= k_FEATURE_AVX2;
+    }
+#endif
+    return result;
+}
+
+#if defined(U_SHA256_KERNELS)
+__attribute__((target("sha,sse4.1")))
+inline
+void shaRounds(__m128i *abef, __m128i *cdgh, __m128i w, const bsl::uint32_t *k)
+    // Perform four rounds of SHA-256 on the specified 'abef' and 'cdgh'
+    // halves of the working variables, using the message schedule words in
+    // the specified 'w' and the four round constants at the specified 'k'.
+{
+    const __m128i *constants = reinterpret_cast<const __m128i *>(k);
+
+    __m128i wk = _mm_add_epi32(w, _mm_loadu_si128(constants));
+    *cdgh = _mm_sha256rnds2_epu32(*cdgh, *abef, wk);
+    wk    = _mm_shuffle_epi32(wk, 0x0e);
+    *abef = _mm_sha256rnds2_epu32(*abef, *cdgh, wk);
+}
+
+__attribute__((target("sha,sse4.1")))
+inline
+void shaSchedule(__m128i *next, __m128i *previous, __m128i current)
+    // Advance the message schedule by four words: complete the specified
+    // 'next' group of words from the specified 'current' and 'previous'
+    // groups, and start the computation of the group after 'next' in
+    // 'previous'.
+{
+    *next     = _mm_add_epi32(*next, _mm_alignr_epi8(current, *previous, 4));
+    *next     = _mm_sha256msg2_epu32(*next, current);
+    *previous = _mm_sha256msg1_epu32(*previous, current);
+}
+
+__attribute__((target("sha,sse4.1")))
+void transformSha(bsl::uint32_t        *state,
+                  const unsigned char  *message,
+                  bsl::uint64_t         numberOfBuffers,
+                  const bsl::uint32_t (&constants)[64])
+    // Update the specified SHA-256 'state' with the hashed contents of the
+    // specified 'message' having a length of 64 bytes times the specified
+    // 'numberOfBuffers', using the specified 'constants'.  The behavior is
+    // undefined unless the CPU supports the SHA extensions and SSE4.1.
+{
+    const __m128i byteSwap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL,
+                                            0x0405060700010203ULL);
+    const bsl::uint32_t *k = constants;
+
+    // The 'sha256rnds2' instruction operates on the working variables
+    // arranged as 'ABEF' and 'CDGH'.
+
+    __m128i dcba = _mm_loadu_si128(reinterpret_cast<const __m128i *>(state));
+    __m128i hgfe = _mm_loadu_si128(
+                                reinterpret_cast<const __m128i *>(state + 4));
+    __m128i cdab = _mm_shuffle_epi32(dcba, 0xb1);
+    __m128i efgh = _mm_shuffle_epi32(hgfe, 0x1b);
+    __m128i abef = _mm_alignr_epi8(cdab, efgh, 8);
+    __m128i cdgh = _mm_blend_epi16(efgh, cdab, 0xf0);
+
+    for (; numberOfBuffers; --numberOfBuffers, message += 64) {
+        const __m128i *words = reinterpret_cast<const __m128i *>(message);
+        const __m128i  abefSave = abef;
+        const __m128i  cdghSave = cdgh;
+
+        __m128i w0 = _mm_shuffle_epi8(_mm_loadu_si128(words + 0), byteSwap);
+        __m128i w1 = _mm_shuffle_epi8(_mm_loadu_si128(words + 1), byteSwap);
+        __m128i w2 = _mm_shuffle_epi8(_mm_loadu_si128(words + 2), byteSwap);
+        __m128i w3 = _mm_shuffle_epi8(_mm_loadu_si128(words + 3), byteSwap);
+
+        shaRounds(&abef, &cdgh, w0, k +  0);
+        shaRounds(&abef, &cdgh, w1, k +  4);
+        w0 = _mm_sha256msg1_epu32(w0, w1);
+        shaRounds(&abef, &cdgh, w2, k +  8);
+        w1 = _mm_sha256msg1_epu32(w1, w2);
+        shaRounds(&abef, &cdgh, w3, k + 12);
+        shaSchedule(&w0, &w2, w3);
+
+        for (int index = 16; index != 48; index += 16) {
+            shaRounds(&abef, &cdgh, w0, k + index +  0);
+            shaSchedule(&w1, &w3, w0);
+            shaRounds(&abef, &cdgh, w1, k + index +  4);
+            shaSchedule(&w2, &w0, w1);
+            shaRounds(&abef, &cdgh, w2, k + index +  8);
+            shaSchedule(&w3, &w1, w2);
+            shaRounds(&abef, &cdgh, w3, k + index + 12);
+            shaSchedule(&w0, &w2, w3);
+        }
+
+        shaRounds(&abef, &cdgh, w0, k + 48);
+        shaSchedule(&w1, &w3, w0);
+        shaRounds(&abef, &cdgh, w1, k + 52);
+        w2 = _mm_add_epi32(w2, _mm_alignr_epi8(w1, w0, 4));
+        w2 = _mm_sha256msg2_epu32(w2, w1);
+        shaRounds(&abef, &cdgh, w2, k + 56);
+        w3 = _mm_add_epi32(w3, _mm_alignr_epi8(w2, w1, 4));
+        w3 = _mm_sha256msg2_epu32(w3, w2);
+        shaRounds(&abef, &cdgh, w3, k + 60);
+
+        abef = _mm_add_epi32(abef, abefSave);
+        cdgh = _mm_add_epi32(cdgh, cdghSave);
+    }
+
+    const __m128i feba = _mm_shuffle_epi32(abef, 0x1b);
+    const __m128i dchg = _mm_shuffle_epi32(cdgh, 0xb1);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(state),
+                     _mm_blend_epi16(feba, dchg, 0xf0));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(state + 4),
+                     _mm_alignr_epi8(dchg, feba, 8));
+}
+
+__attribute__((target("avx2")))
+inline
+__m256i rotateRight8(__m256i value, int shift)
+    // Return the specified 'value' with each of its 32-bit lanes rotated
+    // right by the specified 'shift' bits.
+{
+    return _mm256_or_si256(_mm256_srli_epi32(value, shift),
+                           _mm256_slli_epi32(value, 32 - shift));
+}
+
+__attribute__((target("avx2")))
+void transformAvx2(__m256i              *state,
+                   const unsigned char *(&messages)[8],
+                   __m256i               active,
+                   const bsl::uint32_t (&constants)[64])
+    // Update the specified 8-lane SHA-256 'state', whose 8 elements each
+    // hold one working variable of 8 independent messages, with the hashed
+    // contents of the 64-byte blocks at the specified 'messages', using the
+    // specified 'constants'.  Lanes of 'state' whose bits are clear in the
+    // specified 'active' mask are left unchanged.  The behavior is undefined
+    // unless the CPU supports AVX2.
+{
+    const __m256i byteSwap = _mm256_set_epi64x(0x0c0d0e0f08090a0bULL,
+                                               0x0405060700010203ULL,
+                                               0x0c0d0e0f08090a0bULL,
+                                               0x0405060700010203ULL);
+    __m256i w[64];
+
+    // Transpose two 8x8 matrices of 32-bit words so that 'w[t]' holds word
+    // 't' of each of the 8 blocks.
+
+    for (int half = 0; half != 2; ++half) {
+        __m256i r[8];
+        for (int lane = 0; lane != 8; ++lane) {
+            r[lane] = _mm256_loadu_si256(
+                              reinterpret_cast<const __m256i *>(messages[lane])
+                            + half);
+        }
+        __m256i t[8];
+        for (int i = 0; i != 8; i += 2) {
+            t[i]     = _mm256_unpacklo_epi32(r[i], r[i + 1]);
+            t[i + 1] = _mm256_unpackhi_epi32(r[i], r[i + 1]);
+        }
+        __m256i u[8];
+        for (int i = 0; i != 8; i += 4) {
+            u[i]     = _mm256_unpacklo_epi64(t[i],     t[i + 2]);
+            u[i + 1] = _mm256_unpackhi_epi64(t[i],     t[i + 2]);
+            u[i + 2] = _mm256_unpacklo_epi64(t[i + 1], t[i + 3]);
+            u[i + 3] = _mm256_unpackhi_epi64(t[i + 1], t[i + 3]);
+        }
+        __m256i *out = w + 8 * half;
+        for (int i = 0; i != 4; ++i) {
+            out[i]     = _mm256_shuffle_epi8(
+                             _mm256_permute2x128_si256(u[i], u[i + 4], 0x20),
+                             byteSwap);
+            out[i + 4] = _mm256_shuffle_epi8(
+                             _mm256_permute2x128_si256(u[i], u[i + 4], 0x31),
+                             byteSwap);
+        }
+    }
+
+    for (int index = 16; index != 64; ++index) {
+        const __m256i w2  = w[index - 2];
+        const __m256i w15 = w[index - 15];
+        const __m256i s1  = _mm256_xor_si256(
+                                 _mm256_xor_si256(rotateRight8(w2, 17),
+                                                  rotateRight8(w2, 19)),
+                                 _mm256_srli_epi32(w2, 10));
+        const __m256i s0  = _mm256_xor_si256(
+                                 _mm256_xor_si256(rotateRight8(w15, 7),
+                                                  rotateRight8(w15, 18)),
+                                 _mm256_srli_epi32(w15, 3));
+        w[index] = _mm256_add_epi32(_mm256_add_epi32(s1, w[index - 7]),
+                                    _mm256_add_epi32(s0, w[index - 16]));
+    }
+
+    __m256i a = state[0], b = state[1], c = state[2], d = state[3];
+    __m256i e = state[4], f = state[5], g = state[6], h = state[7];
+
+    for (int index = 0; index != 64; ++index) {
+        const __m256i sigma1 = _mm256_xor_si256(
+                                  _mm256_xor_si256(rotateRight8(e, 6),
+                                                   rotateRight8(e, 11)),
+                                  rotateRight8(e, 25));
+        const __m256i ch     = _mm256_xor_si256(_mm256_and_si256(e, f),
+                                                _mm256_andnot_si256(e, g));
+        const __m256i t1     = _mm256_add_epi32(
+                           _mm256_add_epi32(_mm256_add_epi32(h, sigma1),
+                                            _mm256_add_epi32(ch, w[index])),
+                           _mm256_set1_epi32(static_cast<int>(
+                                                         constants[index])));
+        const __m256i sigma0 = _mm256_xor_si256(
+                                  _mm256_xor_si256(rotateRight8(a, 2),
+                                                   rotateRight8(a, 13)),
+                                  rotateRight8(a, 22));
+        const __m256i maj    = _mm256_or_si256(
+                                  _mm256_and_si256(a, b),
+                                  _mm256_and_si256(_mm256_or_si256(a, b), c));
+        h = g;
+        g = f;
+        f = e;
+        e = _mm256_add_epi32(d, t1);
+        d = c;
+        c = b;
+        b = a;
+        a = _mm256_add_epi32(t1, _mm256_add_epi32(sigma0, maj));
+    }
+
+    const __m256i result[8] = { a, b, c, d, e, f, g, h };
+    for (int index = 0; index != 8; ++index) {
+        state[index] = _mm256_add_epi32(state[index],
+                                        _mm256_and_si256(result[index],
+                                                         active));
+    }
+}
+
+__attribute__((target("avx2")))
+void loadDigestsAvx2(unsigned char       *results,
+                     bsl::size_t          digestSize,
+                     const bsl::uint32_t *initialState,
+                     const void *const   *data,
+                     const bsl::size_t   *lengths,
+                     bsl::size_t          numMessages)
+    // Load into the specified 'results' the digests, each having the
+    // specified 'digestSize', of the specified 'numMessages' messages
+    // described by the specified 'data' and 'lengths', hashing from the
+    // specified 'initialState' up to 8 messages at a time in lockstep.  The
+    // behavior is undefined unless 'numMessages <= 8' and the CPU supports
+    // AVX2.
+{
+    // Each message is hashed as its whole blocks, read in place, followed by
+    // one or two padded blocks built in 'tails'.  Lanes that run out of
+    // blocks, including lanes beyond 'numMessages', are fed an arbitrary
+    // block and masked out of the state update.
+
+    unsigned char        tails[8][128];
+    const unsigned char *starts[8];
+    bsl::uint64_t        numFull[8];
+    bsl::uint64_t        numBlocks[8];
+    bsl::uint64_t        maxBlocks = 0;
+
+    bsl::memset(tails, 0, sizeof tails);
+    for (bsl::size_t lane = 0; lane != 8; ++lane) {
+        if (lane >= numMessages) {
+            starts[lane]    = tails[0];
+            numFull[lane]   = 0;
+            numBlocks[lane] = 0;
+            continue;
+        }
+        const bsl::uint64_t length = lengths[lane];
+        const bsl::uint64_t tail   = length % 64;
+
+        starts[lane]    = static_cast<const unsigned char *>(data[lane]);
+        numFull[lane]   = length / 64;
+        numBlocks[lane] = numFull[lane] + (tail + 9 <= 64 ? 1 : 2);
+        maxBlocks       = bsl::max(maxBlocks, numBlocks[lane]);
+
+        if (tail) {
+            bsl::memcpy(tails[lane], starts[lane] + length - tail, tail);
+        }
+        tails[lane][tail] = 1 << 7;
+        unpack(length * 8,
+               tails[lane] + (numBlocks[lane] - numFull[lane]) * 64 - 8);
+    }
+
+    __m256i state[8];
+    for (int index = 0; index != 8; ++index) {
+        state[index] = _mm256_set1_epi32(
+                                      static_cast<int>(initialState[index]));
+    }
+
+    for (bsl::uint64_t block = 0; block != maxBlocks; ++block) {
+        const unsigned char *messages[8];
+        int                  active[8];
+        for (int lane = 0; lane != 8; ++lane) {
+            if (block < numFull[lane]) {
+                messages[lane] = starts[lane] + block * 64;
+            }
+            else if (block < numBlocks[lane]) {
+                messages[lane] = tails[lane] + (block - numFull[lane]) * 64;
+            }
+            else {
+                messages[lane] = tails[0];
+            }
+            active[lane] = block < numBlocks[lane] ? -1 : 0;
+        }
+        transformAvx2(state,
+                      messages,
+                      _mm256_loadu_si256(
+                                   reinterpret_cast<const __m256i *>(active)),
+                      sha256Constants);
+    }
+
+    bsl::uint32_t words[8][8];
+    for (int index = 0; index != 8; ++index) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(words[index]),
+                            state[index]);
+    }
+    for (bsl::size_t lane = 0; lane != numMessages; ++lane) {
+        for (bsl::size_t index = 0; index != digestSize / 4; ++index) {
+            unpack(words[index][lane],
+                   results + lane * digestSize + index * 4);
+        }
+    }
+}
+#endif
+
+void transform(bsl::uint32_t        *state,
+               const unsigned char  *message,
+               bsl::uint64_t         numberOfBuffers,
+               bsl::uint64_t         bufferSize,
+               const bsl::uint32_t (&constants)[64])
+    // Update the specified SHA-256 'state' with the hashed contents of the
+    // specified 'message' having a length equal to the specified 'bufferSize'
+    // times the specified 'numberOfBuffers', mixing it with the values in the
+    // specified 'constants'.  Use the SHA extensions if the CPU supports
+    // them, and the portable implementation otherwise.
+{
+#if defined(U_SHA256_KERNELS)
+    if (features() & k_FEATURE_SHA) {
+        transformSha(state, message, numberOfBuffers, constants);
+        return;                                                       // RETURN
+    }
+#endif
+    transform<bsl::uint32_t, 64>(state,
+                                 message,
+                                 numberOfBuffers,
+                                 bufferSize,
+                                 constants);
+}
+
 template<bsl::size_t BUFFER_CAPACITY, class INTEGER, bsl::size_t ARRAY_SIZE>
 void updateImpl(INTEGER             *state,
                 bsl::uint64_t       *totalSize,
@@ -331,6 +726,58 @@ void finalize(unsigned char        *result,
     }
 }
 
+template<bsl::size_t DIGEST_SIZE>
+void loadDigestsImpl(unsigned char       *results,
+                     const bsl::uint32_t *initialState,
+                     const void *const   *data,
+                     const bsl::size_t   *lengths,
+                     bsl::size_t          numMessages)
+    // Load into the specified 'results' the 'DIGEST_SIZE'-byte digests of the
+    // specified 'numMessages' messages, where message 'i' is the 'lengths[i]'
+    // bytes at 'data[i]', hashing each message from the specified
+    // 'initialState'.
+{
+#if defined(U_SHA256_KERNELS)
+    // One message at a time using the SHA extensions is faster than 8
+    // messages in lockstep using AVX2.
+
+    const int available = features();
+    if (!(available & k_FEATURE_SHA) && (available & k_FEATURE_AVX2)) {
+        for (bsl::size_t index = 0; index < numMessages; index += 8) {
+            loadDigestsAvx2(results + index * DIGEST_SIZE,
+                            DIGEST_SIZE,
+                            initialState,
+                            data + index,
+                            lengths + index,
+                            bsl::min<bsl::size_t>(numMessages - index, 8));
+        }
+        return;                                                       // RETURN
+    }
+#endif
+    for (bsl::size_t index = 0; index != numMessages; ++index) {
+        bsl::uint32_t state[8];
+        bsl::uint64_t totalSize  = 0;
+        bsl::uint64_t bufferSize = 0;
+        unsigned char buffer[64];
+
+        bsl::copy(initialState, initialState + 8, state);
+        updateImpl(state,
+                   &totalSize,
+                   &bufferSize,
+                   buffer,
+                   static_cast<const unsigned char *>(data[index]),
+                   lengths[index],
+                   sha256Constants);
+        finalize(results + index * DIGEST_SIZE,
+                 DIGEST_SIZE,
+                 state,
+                 totalSize,
+                 bufferSize,
+                 buffer,
+                 sha256Constants);
+    }
+}
+
 template<bsl::size_t SIZE>
 void toHex(char *output, const unsigned char (&input)[SIZE])
     // Store into the specified 'output' the hex representation of the bytes in
@@ -346,6 +793,33 @@ void toHex(char *output, const unsigned char (&input)[SIZE])
 
 } // close unnamed namespace
 
+// CLASS METHODS
+void Sha224::loadDigests(unsigned char     *results,
+                         const void *const *data,
+                         const bsl::size_t *lengths,
+                         bsl::size_t        numMessages)
+{
+    const Sha224 initial;
+    loadDigestsImpl<k_DIGEST_SIZE>(results,
+                                   initial.d_state,
+                                   data,
+                                   lengths,
+                                   numMessages);
+}
+
+void Sha256::loadDigests(unsigned char     *results,
+                         const void *const *data,
+                         const bsl::size_t *lengths,
+                         bsl::size_t        numMessages)
+{
+    const Sha256 initial;
+    loadDigestsImpl<k_DIGEST_SIZE>(results,
+                                   initial.d_state,
+                                   data,
+                                   lengths,
+                                   numMessages);
+}
+
 Sha224::Sha224()
 {
     reset();
@@ -25,6 +25,31 @@ BSLS_IDENT("$Id$ $CSID$")
 //
 // Note that a SHA-2 digest does not aid in error correction.
 //
+///Performance
+///-----------
+// On x86-64 CPUs supporting the SHA extensions, 'Sha224' and 'Sha256' use
+// those instructions to compress each 64-byte block, which is several times
+// faster than the portable implementation.  In addition, 'Sha224' and
+// 'Sha256' provide the class method 'loadDigests', which computes the digests
+// of many independent messages in one call.  On CPUs supporting AVX2 but not
+// the SHA extensions, 'loadDigests' hashes up to 8 messages in lockstep, one
+// message per vector lane.  Hashing many short messages, such as keys or
+// records, is therefore best done with a single call to 'loadDigests':
+//..
+//  const char        *keys[]    = { "alpha", "beta", "gamma", "delta" };
+//  const void        *data[4];
+//  bsl::size_t        lengths[4];
+//  for (int i = 0; i != 4; ++i) {
+//      data[i]    = keys[i];
+//      lengths[i] = bsl::strlen(keys[i]);
+//  }
+//
+//  unsigned char digests[4][bdlde::Sha256::k_DIGEST_SIZE];
+//  bdlde::Sha256::loadDigests(digests[0], data, lengths, 4);
+//..
+// The results are identical to those of the 'update' and 'loadDigest'
+// interface on every platform.
+//
 ///Usage
 ///-----
 // In this section we show intended usage of this component.  The
@@ -121,6 +146,24 @@ class Sha224 {
     static const bsl::size_t k_DIGEST_SIZE = 224 / 8;
         // The size (in bytes) of the output
 
+    // CLASS METHODS
+    static void loadDigests(unsigned char     *results,
+                            const void *const *data,
+                            const bsl::size_t *lengths,
+                            bsl::size_t        numMessages);
+        // Load into the specified 'results' the SHA-224 digests of the
+        // specified 'numMessages' independent messages, where message 'i' is
+        // the 'lengths[i]' bytes starting at 'data[i]', and its digest is
+        // stored at 'results + i * k_DIGEST_SIZE'.  The behavior is undefined
+        // unless '[results, results + numMessages * k_DIGEST_SIZE)',
+        // '[data, data + numMessages)', '[lengths, lengths + numMessages)',
+        // and each '[data[i], data[i] + lengths[i])' are valid ranges.  Note
+        // that if 'data[i]' is 0, then 'lengths[i]' also must be 0.  Also
+        // note that this function may hash several messages in lockstep, and
+        // is substantially faster than hashing them one at a time on CPUs
+        // lacking the SHA extensions, particularly when the messages have
+        // similar lengths.
+
     // CREATORS
     Sha224();
         // Construct a SHA-2 digest having the value corresponding to no data
@@ -201,6 +244,24 @@ class Sha256 {
     static const bsl::size_t k_DIGEST_SIZE = 256 / 8;
         // The size (in bytes) of the output
 
+    // CLASS METHODS
+    static void loadDigests(unsigned char     *results,
+                            const void *const *data,
+                            const bsl::size_t *lengths,
+                            bsl::size_t        numMessages);
+        // Load into the specified 'results' the SHA-256 digests of the
+        // specified 'numMessages' independent messages, where message 'i' is
+        // the 'lengths[i]' bytes starting at 'data[i]', and its digest is
+        // stored at 'results + i * k_DIGEST_SIZE'.  The behavior is undefined
+        // unless '[results, results + numMessages * k_DIGEST_SIZE)',
+        // '[data, data + numMessages)', '[lengths, lengths + numMessages)',
+        // and each '[data[i], data[i] + lengths[i])' are valid ranges.  Note
+        // that if 'data[i]' is 0, then 'lengths[i]' also must be 0.  Also
+        // note that this function may hash several messages in lockstep, and
+        // is substantially faster than hashing them one at a time on CPUs
+        // lacking the SHA extensions, particularly when the messages have
+        // similar lengths.
+
     // CREATORS
     Sha256();
         // Construct a SHA-2 digest having the value corresponding to no data
@@ -5,6 +5,7 @@
 
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <bsl_algorithm.h>
@@ -86,6 +87,10 @@ using namespace bsl;
 //    o void loadDigest(unsigned char *result) const;
 //
 //-----------------------------------------------------------------------------
+// CLASS METHODS
+// [27] void Sha224::loadDigests(uchar*, const void*const*, size_t*, n);
+// [27] void Sha256::loadDigests(uchar*, const void*const*, size_t*, n);
+//
 // CREATORS
 // [ 2] Sha224::Sha224();
 // [ 3] Sha256::Sha256();
@@ -135,7 +140,9 @@ using namespace bsl;
 // [25] bsl::ostream& operator<<(bsl::ostream& stream, const Sha512& digest);
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [26] USAGE EXAMPLE
+// [26] CONCERN: SHA-224/256 kernels match the portable algorithm.
+// [28] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
 // [ *] CONCERN: This test driver is reusable w/other, similar components.
 // [ *] CONCERN: In no case does memory come from the global allocator.
 // [  ] CONCERN: All memory allocation is from the object's allocator.
@@ -495,6 +502,195 @@ void testTwoArgumentConstructor(const char (&message)[LENGTH])
     ASSERT(digest1 == digest2);
 }
 
+
+const bsl::uint32_t sha224InitialState[8] = {
+    0xc1059ed8, 0x367cd507, 0x3070dd17, 0xf70e5939,
+    0xffc00b31, 0x68581511, 0x64f98fa7, 0xbefa4fa4
+};
+
+const bsl::uint32_t sha256InitialState[8] = {
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+    0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
+
+bsl::uint32_t rotr(bsl::uint32_t value, int shift)
+    // Return the specified 'value' rotated right by the specified 'shift'
+    // bits.  The behavior is undefined unless '0 < shift < 32'.
+{
+    return (value >> shift) | (value << (32 - shift));
+}
+
+void referenceSha256(unsigned char       *result,
+                     bsl::size_t          digestSize,
+                     const bsl::uint32_t *initialState,
+                     const unsigned char *message,
+                     bsl::size_t          length)
+    // Load into the specified 'result' the specified 'digestSize' leading
+    // bytes of the SHA-256 digest, computed from the specified
+    // 'initialState', of the specified 'message' having the specified
+    // 'length'.  This straightforward transcription of FIPS 180-4 serves as
+    // an oracle for the kernels selected by the component.
+{
+    static const bsl::uint32_t k[64] = {
+        0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b,
+        0x59f111f1, 0x923f82a4, 0xab1c5ed5, 0xd807aa98, 0x12835b01,
+        0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7,
+        0xc19bf174, 0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
+        0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da, 0x983e5152,
+        0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147,
+        0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc,
+        0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+        0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819,
+        0xd6990624, 0xf40e3585, 0x106aa070, 0x19a4c116, 0x1e376c08,
+        0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f,
+        0x682e6ff3, 0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+        0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+    };
+
+    bsl::vector<unsigned char> padded(message, message + length);
+    padded.push_back(0x80);
+    while (padded.size() % 64 != 56) {
+        padded.push_back(0);
+    }
+    for (int shift = 56; shift >= 0; shift -= 8) {
+        const bsl::uint64_t bits = static_cast<bsl::uint64_t>(length) * 8;
+        padded.push_back(static_cast<unsigned char>(bits >> shift));
+    }
+
+    bsl::uint32_t h[8];
+    bsl::copy(initialState, initialState + 8, h);
+    for (bsl::size_t block = 0; block != padded.size(); block += 64) {
+        bsl::uint32_t w[64];
+        for (int t = 0; t != 16; ++t) {
+            const unsigned char *p = &padded[block + 4 * t];
+            w[t] = bsl::uint32_t(p[0]) << 24 | bsl::uint32_t(p[1]) << 16
+                 | bsl::uint32_t(p[2]) <<  8 | bsl::uint32_t(p[3]);
+        }
+        for (int t = 16; t != 64; ++t) {
+            const bsl::uint32_t s0 = rotr(w[t - 15],  7)
+                                   ^ rotr(w[t - 15], 18) ^ (w[t - 15] >>  3);
+            const bsl::uint32_t s1 = rotr(w[t -  2], 17)
+                                   ^ rotr(w[t -  2], 19) ^ (w[t -  2] >> 10);
+            w[t] = w[t - 16] + s0 + w[t - 7] + s1;
+        }
+        bsl::uint32_t v[8];
+        bsl::copy(h, h + 8, v);
+        for (int t = 0; t != 64; ++t) {
+            const bsl::uint32_t t1 = v[7]
+                                   + (rotr(v[4], 6) ^ rotr(v[4], 11)
+                                                    ^ rotr(v[4], 25))
+                                   + ((v[4] & v[5]) ^ (~v[4] & v[6]))
+                                   + k[t] + w[t];
+            const bsl::uint32_t t2 = (rotr(v[0], 2) ^ rotr(v[0], 13)
+                                                    ^ rotr(v[0], 22))
+                                   + ((v[0] & v[1]) ^ (v[0] & v[2])
+                                                    ^ (v[1] & v[2]));
+            bsl::copy_backward(v, v + 7, v + 8);
+            v[4] += t1;
+            v[0]  = t1 + t2;
+        }
+        for (int i = 0; i != 8; ++i) {
+            h[i] += v[i];
+        }
+    }
+
+    for (bsl::size_t i = 0; i != digestSize; ++i) {
+        result[i] = static_cast<unsigned char>(h[i / 4] >> (24 - 8 * (i % 4)));
+    }
+}
+
+template<class HASHER>
+void testAgainstReference(const bsl::uint32_t *initialState)
+    // Verify that 'HASHER' produces the same digests as 'referenceSha256'
+    // computed from the specified 'initialState' for messages of every
+    // length up to several blocks, at every alignment, and supplied whole or
+    // in two pieces.
+{
+    const bsl::size_t digestSize = HASHER::k_DIGEST_SIZE;
+
+    bsl::vector<unsigned char> data(4 * 64 * 5 + 8);
+    for (bsl::size_t i = 0; i != data.size(); ++i) {
+        data[i] = static_cast<unsigned char>(i * 167 + 13);
+    }
+
+    for (bsl::size_t length = 0; length <= 4 * 64 * 5; ++length) {
+        for (bsl::size_t offset = 0; offset != 4; ++offset) {
+            const unsigned char *message = &data[offset];
+
+            unsigned char expected[digestSize];
+            referenceSha256(expected,
+                            digestSize,
+                            initialState,
+                            message,
+                            length);
+
+            unsigned char digest[digestSize];
+            HASHER(message, length).loadDigest(digest);
+            ASSERTV(length, offset, bsl::equal(expected,
+                                               expected + digestSize,
+                                               digest));
+
+            const bsl::size_t split = (length * (offset + 1)) / 5;
+            HASHER            hasher;
+            hasher.update(message, split);
+            hasher.update(message + split, length - split);
+            hasher.loadDigestAndReset(digest);
+            ASSERTV(length, offset, bsl::equal(expected,
+                                               expected + digestSize,
+                                               digest));
+        }
+    }
+}
+
+template<class HASHER>
+void testLoadDigests()
+    // Verify that 'HASHER::loadDigests' produces, for every message, the
+    // digest produced by 'update' and 'loadDigest', for batches of every size
+    // up to several times the number of messages hashed in lockstep, having
+    // both equal and widely different message lengths.
+{
+    const bsl::size_t digestSize = HASHER::k_DIGEST_SIZE;
+
+    bsl::vector<unsigned char> data(4096);
+    for (bsl::size_t i = 0; i != data.size(); ++i) {
+        data[i] = static_cast<unsigned char>(i * 31 + 7);
+    }
+
+    for (int equalLengths = 0; equalLengths != 2; ++equalLengths) {
+        for (bsl::size_t count = 0; count <= 20; ++count) {
+            bsl::vector<const void *>  messages(count + 1);
+            bsl::vector<bsl::size_t>   lengths(count + 1);
+            bsl::vector<unsigned char> results((count + 1) * digestSize,
+                                               0xa5);
+
+            for (bsl::size_t i = 0; i != count; ++i) {
+                lengths[i]  = equalLengths
+                            ? 55 + count
+                            : (i * 977 + count * 131) % 1200;
+                messages[i] = lengths[i] ? &data[(i * 61) % 512] : 0;
+            }
+
+            HASHER::loadDigests(results.data(),
+                                messages.data(),
+                                lengths.data(),
+                                count);
+
+            for (bsl::size_t i = 0; i != count; ++i) {
+                unsigned char expected[digestSize];
+                HASHER(messages[i], lengths[i]).loadDigest(expected);
+                ASSERTV(equalLengths, count, i,
+                        bsl::equal(expected,
+                                   expected + digestSize,
+                                   results.data() + i * digestSize));
+            }
+
+            // Nothing is written past the last digest.
+
+            ASSERTV(count, 0xa5 == results[count * digestSize]);
+        }
+    }
+}
+
 }  // close unnamed namespace
 
 //=============================================================================
@@ -509,7 +705,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << '\n';
 
     switch (test) { case 0:
-      case 26: {
+      case 28: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   This will test the usage example provided in the component header
@@ -531,6 +727,74 @@ int main(int argc, char *argv[])
 
         assertPasswordIsExpected();
       } break;
+      case 27: {
+        // --------------------------------------------------------------------
+        // TESTING 'loadDigests'
+        //
+        // Concerns:
+        //: 1 'loadDigests' loads, for each message, the same digest as
+        //:   'update' followed by 'loadDigest'.
+        //:
+        //: 2 Batches smaller than, equal to, and larger than the number of
+        //:   messages hashed in lockstep, including an empty batch, are
+        //:   handled.
+        //:
+        //: 3 Messages of widely different lengths, including empty messages,
+        //:   in the same batch are handled.
+        //:
+        //: 4 Nothing is written past the last digest.
+        //
+        // Plan:
+        //: 1 For batches of 0 to 20 messages having equal lengths, and
+        //:   having lengths from 0 to 1200 bytes, compare the digests loaded
+        //:   by 'loadDigests' with those of the two-argument constructor
+        //:   followed by 'loadDigest', and verify that a sentinel byte
+        //:   following the last digest is unchanged.  (C-1..4)
+        //
+        // Testing:
+        //   void Sha224::loadDigests(uchar*, const void*const*, size_t*, n);
+        //   void Sha256::loadDigests(uchar*, const void*const*, size_t*, n);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING 'loadDigests'" "\n"
+                             "=====================" "\n";
+
+        testLoadDigests<bdlde::Sha224>();
+        testLoadDigests<bdlde::Sha256>();
+      } break;
+      case 26: {
+        // --------------------------------------------------------------------
+        // SHA-224/256 KERNELS MATCH THE PORTABLE ALGORITHM
+        //
+        // Concerns:
+        //: 1 The compression kernel selected for the CPU (using the SHA
+        //:   extensions where available) produces the digests specified by
+        //:   FIPS 180-4 for messages of every length, including lengths near
+        //:   multiples of the block size where padding spills into an
+        //:   additional block.
+        //:
+        //: 2 The digest does not depend on the alignment of the message or on
+        //:   how it is split across calls to 'update'.
+        //
+        // Plan:
+        //: 1 For every message length from 0 to 1280 bytes at four
+        //:   alignments, compare the digests of 'Sha224' and 'Sha256', both
+        //:   for the whole message and for the message supplied in two
+        //:   pieces, with those of a straightforward reference
+        //:   implementation in this test driver.  (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: SHA-224/256 kernels match the portable algorithm.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "SHA-224/256 KERNELS MATCH THE PORTABLE ALGORITHM"
+                             "\n"
+                             "================================================"
+                             "\n";
+
+        testAgainstReference<bdlde::Sha224>(sha224InitialState);
+        testAgainstReference<bdlde::Sha256>(sha256InitialState);
+      } break;
       case 25: {
         // --------------------------------------------------------------------
         // TESTING PRINTING AND OUTPUT (<<) OPERATOR FOR SHA-512
@@ -1250,6 +1514,94 @@ int main(int argc, char *argv[])
             ASSERT(hasher == hasher);
         }
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 Report the throughput of hashing a single large message with
+        //:   each digest type, and of hashing batches of messages of various
+        //:   sizes with 'Sha256::loadDigests' and with 'Sha256' one at a
+        //:   time.
+        //
+        // Plan:
+        //: 1 Time the hashing of a 1 MB message, and of batches of 64
+        //:   messages of 64 bytes to 16 KB, and print the throughputs.
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        cout << "PERFORMANCE TEST" "\n"
+                "================" "\n";
+
+        const bsl::size_t          k_SIZE = 1024 * 1024;
+        bsl::vector<unsigned char> data(k_SIZE);
+        for (bsl::size_t i = 0; i != data.size(); ++i) {
+            data[i] = static_cast<unsigned char>(i * 167 + 13);
+        }
+
+        unsigned char  digest[bdlde::Sha512::k_DIGEST_SIZE];
+        bsls::Stopwatch timer;
+
+        timer.start();
+        for (int i = 0; i != 100; ++i) {
+            bdlde::Sha256(data.data(), k_SIZE).loadDigest(digest);
+        }
+        timer.stop();
+        cout << "Sha256, 1 MB:  "
+             << 100.0 / timer.accumulatedWallTime() << " MB/s\n";
+
+        timer.reset();
+        timer.start();
+        for (int i = 0; i != 100; ++i) {
+            bdlde::Sha512(data.data(), k_SIZE).loadDigest(digest);
+        }
+        timer.stop();
+        cout << "Sha512, 1 MB:  "
+             << 100.0 / timer.accumulatedWallTime() << " MB/s\n";
+
+        const bsl::size_t k_NUM_MESSAGES = 64;
+        for (bsl::size_t length = 64; length <= 16384; length *= 16) {
+            bsl::vector<const void *>  messages(k_NUM_MESSAGES);
+            bsl::vector<bsl::size_t>   lengths(k_NUM_MESSAGES, length);
+            bsl::vector<unsigned char> results(
+                              k_NUM_MESSAGES * bdlde::Sha256::k_DIGEST_SIZE);
+            for (bsl::size_t i = 0; i != k_NUM_MESSAGES; ++i) {
+                messages[i] = &data[(i * length) % (k_SIZE - length)];
+            }
+            const bsl::size_t iterations = (64 * k_SIZE)
+                                         / (k_NUM_MESSAGES * length);
+            const double      megabytes  = static_cast<double>(iterations)
+                                         * k_NUM_MESSAGES
+                                         * static_cast<double>(length)
+                                         / k_SIZE;
+
+            timer.reset();
+            timer.start();
+            for (bsl::size_t i = 0; i != iterations; ++i) {
+                bdlde::Sha256::loadDigests(results.data(),
+                                           messages.data(),
+                                           lengths.data(),
+                                           k_NUM_MESSAGES);
+            }
+            timer.stop();
+            const double many = megabytes / timer.accumulatedWallTime();
+
+            timer.reset();
+            timer.start();
+            for (bsl::size_t i = 0; i != iterations; ++i) {
+                for (bsl::size_t j = 0; j != k_NUM_MESSAGES; ++j) {
+                    bdlde::Sha256(messages[j], length).loadDigest(digest);
+                }
+            }
+            timer.stop();
+            const double single = megabytes / timer.accumulatedWallTime();
+
+            cout << "Sha256, 64 x " << length << " bytes:  loadDigests "
+                 << many << " MB/s, one at a time " << single << " MB/s\n";
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." "\n";
         testStatus = -1;
@@ -0,0 +1,163 @@
+// bdlde_simd_cpufeatures.cpp                                         -*-C++-*-
+#include <bdlde_simd_cpufeatures.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlde_simd_cpufeatures_cpp,"$Id$ $CSID$")
+
+#include <bsls_atomicoperations.h>
+#include <bsls_performancehint.h>
+#include <bsls_platform.h>
+
+#if (defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64))     \
+ && (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG))
+#define U_CPUID
+    // The 'cpuid' and 'xgetbv' instructions are available.
+#include <cpuid.h>
+#endif
+
+///Implementation Notes
+///--------------------
+// The feature bits of 'cpuid' are tested using the bit positions documented
+// by Intel rather than the 'bit_*' macros of '<cpuid.h>', whose names differ
+// between compilers and versions (e.g., 'bit_SSE4_2' and 'bit_SSE42').
+
+namespace BloombergLP {
+namespace {
+
+enum {
+    // Bits of the 'ecx' register returned by 'cpuid' leaf 1.
+
+    k_LEAF1_ECX_PCLMUL  = 1u << 1,
+    k_LEAF1_ECX_SSSE3   = 1u << 9,
+    k_LEAF1_ECX_SSE4_1  = 1u << 19,
+    k_LEAF1_ECX_SSE4_2  = 1u << 20,
+    k_LEAF1_ECX_POPCNT  = 1u << 23,
+    k_LEAF1_ECX_OSXSAVE = 1u << 27,
+    k_LEAF1_ECX_AVX     = 1u << 28
+};
+
+enum {
+    // Bits of the 'ebx' register returned by 'cpuid' leaf 7, sub-leaf 0.
+
+    k_LEAF7_EBX_AVX2 = 1u << 5,
+    k_LEAF7_EBX_SHA  = 1u << 29
+};
+
+enum {
+    // Bits of the 'XCR0' register, read by 'xgetbv', set if the operating
+    // system saves the 'xmm' and 'ymm' registers, respectively.
+
+    k_XCR0_SSE_AND_AVX = 0x6
+};
+
+enum {
+    k_FEATURES_KNOWN = 0x10000  // set, with the 'Feature' flags, once the
+                                // features have been detected
+};
+
+bsls::AtomicOperations::AtomicTypes::Int s_features;
+    // The 'Feature' flags of the CPU, together with 'k_FEATURES_KNOWN', or 0
+    // if they have not been detected yet.  Note that, as detection is
+    // idempotent, concurrent first calls may race to set this value without
+    // harm.
+
+int detectFeatures()
+    // Return the combination of 'bdlde::Simd_CpuFeatures::Feature' values
+    // supported by the CPU on which this process is running.
+{
+    typedef bdlde::Simd_CpuFeatures Features;
+
+    int result = 0;
+
+#if defined(U_CPUID)
+    unsigned int eax, ebx, ecx, edx;
+
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+        return result;                                                // RETURN
+    }
+
+    const unsigned int ecx1 = ecx;
+
+    if (ecx1 & k_LEAF1_ECX_PCLMUL) {
+        result |= Features::e_PCLMUL;
+    }
+    if (ecx1 & k_LEAF1_ECX_SSSE3) {
+        result |= Features::e_SSSE3;
+    }
+    if (ecx1 & k_LEAF1_ECX_SSE4_1) {
+        result |= Features::e_SSE4_1;
+    }
+    if (ecx1 & k_LEAF1_ECX_SSE4_2) {
+        result |= Features::e_SSE4_2;
+    }
+    if (ecx1 & k_LEAF1_ECX_POPCNT) {
+        result |= Features::e_POPCNT;
+    }
+
+    if (__get_cpuid_max(0, 0) < 7) {
+        return result;                                                // RETURN
+    }
+
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+
+    if (ebx & k_LEAF7_EBX_SHA) {
+        result |= Features::e_SHA;
+    }
+
+    // AVX2 additionally requires that the operating system saves the 'ymm'
+    // registers on context switches.
+
+    if ((ecx1 & k_LEAF1_ECX_OSXSAVE)
+     && (ecx1 & k_LEAF1_ECX_AVX)
+     && (ebx  & k_LEAF7_EBX_AVX2)) {
+        unsigned int xcr0Low, xcr0High;
+        __asm__ ("xgetbv" : "=a"(xcr0Low), "=d"(xcr0High) : "c"(0));
+
+        if (k_XCR0_SSE_AND_AVX == (xcr0Low & k_XCR0_SSE_AND_AVX)) {
+            result |= Features::e_AVX2;
+        }
+    }
+#endif
+
+    return result;
+}
+
+}  // close unnamed namespace
+
+namespace bdlde {
+
+                          // -----------------------
+                          // struct Simd_CpuFeatures
+                          // -----------------------
+
+// CLASS METHODS
+int Simd_CpuFeatures::features()
+{
+    int result = bsls::AtomicOperations::getIntRelaxed(&s_features);
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == result)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        result = detectFeatures() | k_FEATURES_KNOWN;
+        bsls::AtomicOperations::setIntRelaxed(&s_features, result);
+    }
+    return result & ~k_FEATURES_KNOWN;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,121 @@
+// bdlde_simd_cpufeatures.h                                           -*-C++-*-
+#ifndef INCLUDED_BDLDE_SIMD_CPUFEATURES
+#define INCLUDED_BDLDE_SIMD_CPUFEATURES
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$")
+
+//@PURPOSE: Provide run-time detection of the CPU features of 'bdlde' kernels.
+//
+//@CLASSES:
+//  bdlde::Simd_CpuFeatures: namespace for detecting x86 instruction sets
+//
+//@SEE_ALSO: bdlde_base64util, bdlde_charconvertascii, bdlde_crc32,
+//           bdlde_crc32c, bdlde_crc64, bdlde_sha2, bdlde_utf8util
+//
+//@DESCRIPTION: This component provides a 'struct', 'bdlde::Simd_CpuFeatures',
+// containing functions that report which of the instruction set extensions
+// used by the hardware-accelerated kernels of the 'bdlde' package are
+// supported by the CPU on which the process is running.  The components of
+// 'bdlde' use it to select, on first use, the fastest kernel that may safely
+// be executed, so that a single binary runs everywhere yet takes advantage of
+// newer CPUs.  This component is private to the 'bdlde' package, and must not
+// be used outside it.
+//
+// The features are detected, once per process, using the 'cpuid' instruction
+// on x86 and x86-64 CPUs when building with GCC or Clang.  AVX2 is reported as
+// supported only if, in addition, the operating system saves the 'ymm'
+// registers on context switches, as reported by the 'xgetbv' instruction.  On
+// other platforms, no feature is reported as supported.
+//
+///Thread Safety
+///-------------
+// Thread safe.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Selecting a Kernel
+/// - - - - - - - - - - - - - -
+// Suppose we have a portable function, and a faster kernel that requires both
+// SSE4.2 and POPCNT instructions.  We select the kernel only if the CPU
+// supports both:
+//..
+//  const bool useKernel = bdlde::Simd_CpuFeatures::isSupported(
+//                                      bdlde::Simd_CpuFeatures::e_SSE4_2
+//                                    | bdlde::Simd_CpuFeatures::e_POPCNT);
+//..
+// Note that 'isSupported' returns 'false' on platforms other than x86.
+
+namespace BloombergLP {
+namespace bdlde {
+
+                          // =======================
+                          // struct Simd_CpuFeatures
+                          // =======================
+
+struct Simd_CpuFeatures {
+    // This 'struct' provides a namespace for functions that detect the
+    // instruction set extensions supported by the CPU on which the process is
+    // running.
+
+    // TYPES
+    enum Feature {
+        // Instruction set extensions used by the kernels of 'bdlde'.
+
+        e_SSSE3  = 0x01,  // Supplemental SSE3
+        e_SSE4_1 = 0x02,  // SSE4.1
+        e_SSE4_2 = 0x04,  // SSE4.2
+        e_POPCNT = 0x08,  // population count
+        e_PCLMUL = 0x10,  // carry-less multiplication
+        e_AVX2   = 0x20,  // AVX2, with OS support for 'ymm' registers
+        e_SHA    = 0x40   // SHA extensions
+    };
+
+    // CLASS METHODS
+    static int features();
+        // Return the combination of 'Feature' values supported by the CPU on
+        // which this process is running.
+
+    static bool isSupported(int featureMask);
+        // Return 'true' if every 'Feature' value in the specified
+        // 'featureMask' is supported by the CPU on which this process is
+        // running, and 'false' otherwise.
+};
+
+// ============================================================================
+//                          INLINE DEFINITIONS
+// ============================================================================
+
+                          // -----------------------
+                          // struct Simd_CpuFeatures
+                          // -----------------------
+
+// CLASS METHODS
+inline
+bool Simd_CpuFeatures::isSupported(int featureMask)
+{
+    return featureMask == (features() & featureMask);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
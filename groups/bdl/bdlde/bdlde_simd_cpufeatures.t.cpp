@@ -0,0 +1,276 @@
+// bdlde_simd_cpufeatures.t.cpp                                       -*-C++-*-
+#include <bdlde_simd_cpufeatures.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_platform.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                 TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test reports the instruction set extensions supported
+// by the CPU on which the test driver runs, which we cannot know in advance.
+// We can, however, verify that the result is stable, that 'isSupported' is
+// consistent with 'features', and that every extension the compiler was
+// allowed to use when building the test driver (which is evidently running)
+// is reported as supported.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] int features();
+// [ 2] bool isSupported(int featureMask);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlde::Simd_CpuFeatures Obj;
+
+const int k_ALL_FEATURES = Obj::e_SSSE3
+                         | Obj::e_SSE4_1
+                         | Obj::e_SSE4_2
+                         | Obj::e_POPCNT
+                         | Obj::e_PCLMUL
+                         | Obj::e_AVX2
+                         | Obj::e_SHA;
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test    = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    bool verbose = argc > 2;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 3: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, replace
+        //:   leading comment characters with spaces, and replace 'assert' with
+        //:   'ASSERT'.  (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Selecting a Kernel
+/// - - - - - - - - - - - - - -
+// Suppose we have a portable function, and a faster kernel that requires both
+// SSE4.2 and POPCNT instructions.  We select the kernel only if the CPU
+// supports both:
+//..
+    const bool useKernel = bdlde::Simd_CpuFeatures::isSupported(
+                                        bdlde::Simd_CpuFeatures::e_SSE4_2
+                                      | bdlde::Simd_CpuFeatures::e_POPCNT);
+//..
+// Note that 'isSupported' returns 'false' on platforms other than x86.
+
+#if !defined(BSLS_PLATFORM_CPU_X86) && !defined(BSLS_PLATFORM_CPU_X86_64)
+        ASSERT(!useKernel);
+#endif
+        if (verbose) {
+            P(useKernel);
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'features' AND 'isSupported'
+        //
+        // Concerns:
+        //: 1 'features' returns only 'Feature' values, and the same value on
+        //:   every call.
+        //:
+        //: 2 'isSupported' returns 'true' exactly when every feature in its
+        //:   argument is returned by 'features', and 'true' for no features.
+        //:
+        //: 3 Every extension enabled when compiling the test driver is
+        //:   reported as supported.
+        //:
+        //: 4 No feature is reported on platforms other than x86.
+        //
+        // Plan:
+        //: 1 Call 'features' repeatedly and compare the results.  (C-1)
+        //:
+        //: 2 For every combination of features, compare 'isSupported' with
+        //:   the result of 'features'.  (C-2)
+        //:
+        //: 3 For each extension whose predefined compiler macro is defined,
+        //:   verify that the corresponding feature is reported.  (C-3)
+        //:
+        //: 4 On other platforms, verify that 'features' returns 0.  (C-4)
+        //
+        // Testing:
+        //   int features();
+        //   bool isSupported(int featureMask);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'features' AND 'isSupported'" << endl
+                          << "====================================" << endl;
+
+        const int FEATURES = Obj::features();
+
+        if (verbose) {
+            P(FEATURES);
+        }
+
+        ASSERTV(FEATURES, 0 == (FEATURES & ~k_ALL_FEATURES));
+        for (int i = 0; i < 10; ++i) {
+            ASSERTV(i, FEATURES == Obj::features());
+        }
+
+        for (int mask = 0; mask <= k_ALL_FEATURES; ++mask) {
+            if (mask & ~k_ALL_FEATURES) {
+                continue;
+            }
+            const bool EXP = mask == (FEATURES & mask);
+            ASSERTV(mask, FEATURES, EXP == Obj::isSupported(mask));
+        }
+        ASSERT(Obj::isSupported(0));
+
+#if defined(__SSSE3__)
+        ASSERT(Obj::isSupported(Obj::e_SSSE3));
+#endif
+#if defined(__SSE4_1__)
+        ASSERT(Obj::isSupported(Obj::e_SSE4_1));
+#endif
+#if defined(__SSE4_2__)
+        ASSERT(Obj::isSupported(Obj::e_SSE4_2));
+#endif
+#if defined(__POPCNT__)
+        ASSERT(Obj::isSupported(Obj::e_POPCNT));
+#endif
+#if defined(__PCLMUL__)
+        ASSERT(Obj::isSupported(Obj::e_PCLMUL));
+#endif
+#if defined(__AVX2__)
+        ASSERT(Obj::isSupported(Obj::e_AVX2));
+#endif
+#if defined(__SHA__)
+        ASSERT(Obj::isSupported(Obj::e_SHA));
+#endif
+
+#if !defined(BSLS_PLATFORM_CPU_X86) && !defined(BSLS_PLATFORM_CPU_X86_64)
+        ASSERTV(FEATURES, 0 == FEATURES);
+#endif
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Detect the features, and check each one with 'isSupported'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        const int FEATURES = Obj::features();
+
+        for (int feature = 1; feature <= k_ALL_FEATURES; feature <<= 1) {
+            const bool EXP = 0 != (FEATURES & feature);
+
+            ASSERTV(feature, FEATURES, EXP == Obj::isSupported(feature));
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -12,17 +12,30 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(bdlde_utf8util_cpp,"$Id$ $CSID$")
 
+#include <bdlde_simd_cpufeatures.h>
+
 #include <bsla_fallthrough.h>
 #include <bsls_assert.h>
+#include <bsls_atomicoperations.h>
 #include <bsls_performancehint.h>
 #include <bsls_platform.h>
+#include <bsls_types.h>
 
+#include <bsl_climits.h>
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
 #include <bsl_fstream.h>
 #include <bsl_ios.h>
 #include <bsl_streambuf.h>
 
+#if defined(BSLS_PLATFORM_CPU_X86_64)                                         \
+ && (defined(BSLS_PLATFORM_CMP_CLANG)                                         \
+  || (defined(BSLS_PLATFORM_CMP_GNU) && BSLS_PLATFORM_CMP_VERSION >= 40900))
+#define U_VECTORIZED_KERNELS
+    // Vectorized validity kernels, selected at run time, are available.
+#include <immintrin.h>
+#endif
+
 // LOCAL MACROS
 
 #define UNLIKELY(EXPRESSION) BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(EXPRESSION)
@@ -167,6 +180,462 @@ int get4ByteValue(const char *pc)
                                |  (pc[3] & k_CONT_VALUE_MASK);
 }
 
+                        // ---------------------------
+                        // Vectorized Validity Kernels
+                        // ---------------------------
+
+// The functions in this section identify, 64 bytes at a time, a prefix of a
+// UTF-8 string that is known to consist entirely of complete, valid code
+// points, so that the scalar state machines of this component need only be
+// run on whatever follows that prefix.  Any error in the input stops the
+// vectorized scan short of the block containing the error, so error codes and
+// error positions are always determined by the scalar code.
+//
+// The validity check on non-ASCII blocks follows the lookup algorithm of
+// Keiser and Lemire ("Validating UTF-8 In Less Than One Instruction Per
+// Byte", 2021): three 16-entry tables, indexed by the high nibble of the
+// previous byte, the low nibble of the previous byte, and the high nibble of
+// the current byte, each map to a bit set of the error classes that are
+// possible for that nibble, and the bitwise-and of the three lookups is
+// non-zero exactly when the pair of bytes is erroneous.  A separate check,
+// using saturating subtraction, verifies that the bytes 2 and 3 positions
+// after each 3- and 4-byte lead byte are continuation bytes.  Blocks
+// consisting entirely of ASCII skip the lookups altogether.
+//
+// Kernels are selected at run time based on the capabilities of the CPU: an
+// AVX2 kernel processes 32 bytes per instruction, an SSE4.2 kernel 16 bytes
+// per instruction, and, when neither is available, no prefix is skipped and
+// the scalar code validates the entire input.
+
+
+namespace {
+
+enum {
+    k_KERNEL_UNKNOWN = 0,  // kernel not yet selected
+    k_KERNEL_SCALAR  = 1,  // no vectorized kernel available
+    k_KERNEL_SSE4    = 2,  // 16 bytes per instruction
+    k_KERNEL_AVX2    = 3   // 32 bytes per instruction
+};
+
+bsls::AtomicOperations::AtomicTypes::Int s_kernel;
+    // The kernel used by 'validPrefix', or 'k_KERNEL_UNKNOWN' if it has not
+    // been selected yet.  Note that, as selection is idempotent, concurrent
+    // first calls may race to set this value without harm.
+
+bsls::Types::size_type completePrefix(bsls::Types::IntPtr *numCodePoints,
+                                      const char          *string,
+                                      const char          *end)
+    // Return the number of bytes in the longest prefix of the specified
+    // 'string' that ends at or before the specified 'end' and does not end in
+    // the middle of a multi-byte sequence, and decrement the specified
+    // 'numCodePoints' if the lead byte of such a sequence is excluded.  The
+    // behavior is undefined unless '[string, end)' contains valid UTF-8 except
+    // that its final sequence may be incomplete, and '*numCodePoints' counts
+    // the non-continuation bytes in that range.
+{
+    for (const char *pc = end; pc > string && end - pc < 3; ) {
+        --pc;
+        if (isNotContinuation(*pc)) {
+            if (pc + utf8Size(*pc) > end) {
+                --*numCodePoints;
+                return pc - string;                                   // RETURN
+            }
+            break;
+        }
+    }
+
+    return end - string;
+}
+
+#if defined(U_VECTORIZED_KERNELS)
+
+enum {
+    // Error classes of the Keiser-Lemire lookup algorithm.  Each class is a
+    // property of a pair of adjacent bytes.
+
+    k_TOO_SHORT      = 1 << 0,  // lead byte not followed by continuation
+    k_TOO_LONG       = 1 << 1,  // ASCII byte followed by continuation
+    k_OVERLONG_3     = 1 << 2,  // 3-byte sequence is overlong
+    k_TOO_LARGE      = 1 << 3,  // value exceeds 0x10ffff
+    k_SURROGATE_PAIR = 1 << 4,  // 3-byte sequence encodes a surrogate
+    k_OVERLONG_2     = 1 << 5,  // 2-byte sequence is overlong
+    k_TOO_LARGE_1000 = 1 << 6,  // value exceeds 0x10ffff (0xf4 0x90 and up)
+    k_OVERLONG_4     = 1 << 6,  // 4-byte sequence is overlong
+    k_TWO_CONTS      = 1 << 7,  // two continuations in a row
+
+    k_CARRY          = k_TOO_SHORT | k_TOO_LONG | k_TWO_CONTS
+};
+
+const unsigned char k_BYTE_1_HIGH[16] = {
+    // Error classes possible given the high nibble of the first byte.
+
+    k_TOO_LONG, k_TOO_LONG, k_TOO_LONG, k_TOO_LONG,         // 0xxx
+    k_TOO_LONG, k_TOO_LONG, k_TOO_LONG, k_TOO_LONG,
+    k_TWO_CONTS, k_TWO_CONTS, k_TWO_CONTS, k_TWO_CONTS,     // 10xx
+    k_TOO_SHORT | k_OVERLONG_2,                             // 1100
+    k_TOO_SHORT,                                            // 1101
+    k_TOO_SHORT | k_OVERLONG_3 | k_SURROGATE_PAIR,          // 1110
+    k_TOO_SHORT | k_TOO_LARGE | k_TOO_LARGE_1000 | k_OVERLONG_4
+                                                            // 1111
+};
+
+const unsigned char k_BYTE_1_LOW[16] = {
+    // Error classes possible given the low nibble of the first byte.
+
+    k_CARRY | k_OVERLONG_3 | k_OVERLONG_2 | k_OVERLONG_4,   // 0000
+    k_CARRY | k_OVERLONG_2,                                 // 0001
+    k_CARRY,                                                // 0010
+    k_CARRY,                                                // 0011
+    k_CARRY | k_TOO_LARGE,                                  // 0100
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,               // 0101
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,               // 0110
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,               // 0111
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,               // 1000
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,               // 1001
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,               // 1010
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,               // 1011
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,               // 1100
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000 | k_SURROGATE_PAIR,
+                                                            // 1101
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000,               // 1110
+    k_CARRY | k_TOO_LARGE | k_TOO_LARGE_1000                // 1111
+};
+
+const unsigned char k_BYTE_2_HIGH[16] = {
+    // Error classes possible given the high nibble of the second byte.
+
+    k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT,     // 0xxx
+    k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT,
+    k_TOO_LONG | k_OVERLONG_2 | k_TWO_CONTS | k_OVERLONG_3 | k_TOO_LARGE_1000
+                                               | k_OVERLONG_4,   // 1000
+    k_TOO_LONG | k_OVERLONG_2 | k_TWO_CONTS | k_OVERLONG_3 | k_TOO_LARGE,
+                                                                 // 1001
+    k_TOO_LONG | k_OVERLONG_2 | k_TWO_CONTS | k_SURROGATE_PAIR | k_TOO_LARGE,
+                                                                 // 1010
+    k_TOO_LONG | k_OVERLONG_2 | k_TWO_CONTS | k_SURROGATE_PAIR | k_TOO_LARGE,
+                                                                 // 1011
+    k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT, k_TOO_SHORT      // 11xx
+};
+
+const unsigned char k_INCOMPLETE_MAX[32] = {
+    // Maximum value of each byte of a 32-byte block for no multi-byte
+    // sequence to extend beyond the end of the block.  The last 16 bytes
+    // serve the same purpose for 16-byte blocks.
+
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xdf, 0xbf
+};
+
+                            // -----------
+                            // SSE4 Kernel
+                            // -----------
+
+__attribute__((target("sse4.2,popcnt")))
+inline
+__m128i sse4CheckBlock(__m128i input, __m128i previous)
+    // Return a vector having a non-zero byte for each byte of the specified
+    // 'input' that, given the specified 'previous' block of input, is in
+    // error, and a zero vector if there is no error.
+{
+    const __m128i nibbleMask = _mm_set1_epi8(0x0f);
+
+    const __m128i prev1 = _mm_alignr_epi8(input, previous, 15);
+    const __m128i prev2 = _mm_alignr_epi8(input, previous, 14);
+    const __m128i prev3 = _mm_alignr_epi8(input, previous, 13);
+
+    const __m128i byte1High = _mm_shuffle_epi8(
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(k_BYTE_1_HIGH)),
+            _mm_and_si128(_mm_srli_epi16(prev1, 4), nibbleMask));
+    const __m128i byte1Low  = _mm_shuffle_epi8(
+             _mm_loadu_si128(reinterpret_cast<const __m128i *>(k_BYTE_1_LOW)),
+             _mm_and_si128(prev1, nibbleMask));
+    const __m128i byte2High = _mm_shuffle_epi8(
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(k_BYTE_2_HIGH)),
+            _mm_and_si128(_mm_srli_epi16(input, 4), nibbleMask));
+
+    const __m128i special = _mm_and_si128(_mm_and_si128(byte1High, byte1Low),
+                                          byte2High);
+
+    const __m128i isThird  = _mm_subs_epu8(prev2, _mm_set1_epi8(0xe0 - 0x80));
+    const __m128i isFourth = _mm_subs_epu8(prev3, _mm_set1_epi8(0xf0 - 0x80));
+    const __m128i must23   = _mm_and_si128(_mm_or_si128(isThird, isFourth),
+                                           _mm_set1_epi8(char(0x80)));
+
+    return _mm_xor_si128(must23, special);
+}
+
+__attribute__((target("sse4.2,popcnt")))
+bsls::Types::size_type validPrefixSse4(bsls::Types::IntPtr    *numCodePoints,
+                                       const char             *string,
+                                       bsls::Types::size_type  length,
+                                       bsls::Types::IntPtr     maxCodePoints)
+    // Return the length of a prefix of the specified 'string' having the
+    // specified 'length' that consists of at most the specified
+    // 'maxCodePoints' complete, valid UTF-8 code points, and load the number
+    // of code points in that prefix into the specified 'numCodePoints'.  Use
+    // 16-byte SSE4.2 instructions.
+{
+    const __m128i incompleteMax = _mm_loadu_si128(
+                 reinterpret_cast<const __m128i *>(k_INCOMPLETE_MAX + 16));
+    const __m128i continuationMax = _mm_set1_epi8(-64);
+
+    const char          *pc    = string;
+    const char *const    end   = string
+                               + (length & ~bsls::Types::size_type(63));
+    bsls::Types::IntPtr  count = 0;
+
+    __m128i previous   = _mm_setzero_si128();
+    __m128i incomplete = _mm_setzero_si128();
+
+    while (pc < end && count + 64 <= maxCodePoints) {
+        const __m128i in0 = _mm_loadu_si128(
+                                   reinterpret_cast<const __m128i *>(pc));
+        const __m128i in1 = _mm_loadu_si128(
+                                   reinterpret_cast<const __m128i *>(pc + 16));
+        const __m128i in2 = _mm_loadu_si128(
+                                   reinterpret_cast<const __m128i *>(pc + 32));
+        const __m128i in3 = _mm_loadu_si128(
+                                   reinterpret_cast<const __m128i *>(pc + 48));
+
+        const __m128i any = _mm_or_si128(_mm_or_si128(in0, in1),
+                                         _mm_or_si128(in2, in3));
+
+        if (0 == _mm_movemask_epi8(any)) {
+            // ASCII only: valid unless a sequence was left incomplete.
+
+            if (!_mm_testz_si128(incomplete, incomplete)) {
+                break;
+            }
+            count += 64;
+        }
+        else {
+            __m128i error = sse4CheckBlock(in0, previous);
+            error = _mm_or_si128(error, sse4CheckBlock(in1, in0));
+            error = _mm_or_si128(error, sse4CheckBlock(in2, in1));
+            error = _mm_or_si128(error, sse4CheckBlock(in3, in2));
+            if (!_mm_testz_si128(error, error)) {
+                break;
+            }
+            incomplete = _mm_subs_epu8(in3, incompleteMax);
+
+            // Continuation bytes are those less than -64 when signed.
+
+            const bsls::Types::Uint64 mask =
+                 static_cast<bsls::Types::Uint64>(static_cast<unsigned>(
+                    _mm_movemask_epi8(_mm_cmpgt_epi8(continuationMax, in0))))
+              | static_cast<bsls::Types::Uint64>(static_cast<unsigned>(
+                    _mm_movemask_epi8(_mm_cmpgt_epi8(continuationMax, in1))))
+                                                                         << 16
+              | static_cast<bsls::Types::Uint64>(static_cast<unsigned>(
+                    _mm_movemask_epi8(_mm_cmpgt_epi8(continuationMax, in2))))
+                                                                         << 32
+              | static_cast<bsls::Types::Uint64>(static_cast<unsigned>(
+                    _mm_movemask_epi8(_mm_cmpgt_epi8(continuationMax, in3))))
+                                                                         << 48;
+            count += 64 - __builtin_popcountll(mask);
+        }
+        previous  = in3;
+        pc       += 64;
+    }
+
+    *numCodePoints = count;
+    return completePrefix(numCodePoints, string, pc);
+}
+
+                            // -----------
+                            // AVX2 Kernel
+                            // -----------
+
+__attribute__((target("avx2,popcnt")))
+inline
+__m256i avx2Prev(__m256i input, __m256i previous, int n)
+    // Return 'input' shifted up by the specified 'n' bytes, with the last 'n'
+    // bytes of the specified 'previous' shifted in.  The behavior is
+    // undefined unless 'n' is a compile-time constant in the range '[1 .. 3]'.
+{
+    const __m256i straddle = _mm256_permute2x128_si256(previous, input, 0x21);
+
+    switch (n) {
+      case 1: return _mm256_alignr_epi8(input, straddle, 15);         // RETURN
+      case 2: return _mm256_alignr_epi8(input, straddle, 14);         // RETURN
+      default: break;
+    }
+    return _mm256_alignr_epi8(input, straddle, 13);
+}
+
+__attribute__((target("avx2,popcnt")))
+inline
+__m256i avx2CheckBlock(__m256i input, __m256i previous)
+    // Return a vector having a non-zero byte for each byte of the specified
+    // 'input' that, given the specified 'previous' block of input, is in
+    // error, and a zero vector if there is no error.
+{
+    const __m256i nibbleMask = _mm256_set1_epi8(0x0f);
+
+    const __m256i prev1 = avx2Prev(input, previous, 1);
+    const __m256i prev2 = avx2Prev(input, previous, 2);
+    const __m256i prev3 = avx2Prev(input, previous, 3);
+
+    const __m256i byte1High = _mm256_shuffle_epi8(
+        _mm256_broadcastsi128_si256(
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(k_BYTE_1_HIGH))),
+        _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibbleMask));
+    const __m256i byte1Low  = _mm256_shuffle_epi8(
+        _mm256_broadcastsi128_si256(
+             _mm_loadu_si128(reinterpret_cast<const __m128i *>(k_BYTE_1_LOW))),
+        _mm256_and_si256(prev1, nibbleMask));
+    const __m256i byte2High = _mm256_shuffle_epi8(
+        _mm256_broadcastsi128_si256(
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(k_BYTE_2_HIGH))),
+        _mm256_and_si256(_mm256_srli_epi16(input, 4), nibbleMask));
+
+    const __m256i special = _mm256_and_si256(
+                                      _mm256_and_si256(byte1High, byte1Low),
+                                      byte2High);
+
+    const __m256i isThird  = _mm256_subs_epu8(prev2,
+                                              _mm256_set1_epi8(0xe0 - 0x80));
+    const __m256i isFourth = _mm256_subs_epu8(prev3,
+                                              _mm256_set1_epi8(0xf0 - 0x80));
+    const __m256i must23   = _mm256_and_si256(
+                                         _mm256_or_si256(isThird, isFourth),
+                                         _mm256_set1_epi8(char(0x80)));
+
+    return _mm256_xor_si256(must23, special);
+}
+
+__attribute__((target("avx2,popcnt")))
+bsls::Types::size_type validPrefixAvx2(bsls::Types::IntPtr    *numCodePoints,
+                                       const char             *string,
+                                       bsls::Types::size_type  length,
+                                       bsls::Types::IntPtr     maxCodePoints)
+    // Return the length of a prefix of the specified 'string' having the
+    // specified 'length' that consists of at most the specified
+    // 'maxCodePoints' complete, valid UTF-8 code points, and load the number
+    // of code points in that prefix into the specified 'numCodePoints'.  Use
+    // 32-byte AVX2 instructions.
+{
+    const __m256i incompleteMax = _mm256_loadu_si256(
+                        reinterpret_cast<const __m256i *>(k_INCOMPLETE_MAX));
+    const __m256i continuationMax = _mm256_set1_epi8(-64);
+
+    const char          *pc    = string;
+    const char *const    end   = string
+                               + (length & ~bsls::Types::size_type(63));
+    bsls::Types::IntPtr  count = 0;
+
+    __m256i previous   = _mm256_setzero_si256();
+    __m256i incomplete = _mm256_setzero_si256();
+
+    while (pc < end && count + 64 <= maxCodePoints) {
+        const __m256i in0 = _mm256_loadu_si256(
+                                   reinterpret_cast<const __m256i *>(pc));
+        const __m256i in1 = _mm256_loadu_si256(
+                                   reinterpret_cast<const __m256i *>(pc + 32));
+
+        if (0 == _mm256_movemask_epi8(_mm256_or_si256(in0, in1))) {
+            // ASCII only: valid unless a sequence was left incomplete.
+
+            if (!_mm256_testz_si256(incomplete, incomplete)) {
+                break;
+            }
+            count += 64;
+        }
+        else {
+            const __m256i error = _mm256_or_si256(
+                                              avx2CheckBlock(in0, previous),
+                                              avx2CheckBlock(in1, in0));
+            if (!_mm256_testz_si256(error, error)) {
+                break;
+            }
+            incomplete = _mm256_subs_epu8(in1, incompleteMax);
+
+            // Continuation bytes are those less than -64 when signed.
+
+            const bsls::Types::Uint64 mask =
+                 static_cast<bsls::Types::Uint64>(static_cast<unsigned>(
+                    _mm256_movemask_epi8(
+                                 _mm256_cmpgt_epi8(continuationMax, in0))))
+              | static_cast<bsls::Types::Uint64>(static_cast<unsigned>(
+                    _mm256_movemask_epi8(
+                                 _mm256_cmpgt_epi8(continuationMax, in1))))
+                                                                         << 32;
+            count += 64 - __builtin_popcountll(mask);
+        }
+        previous  = in1;
+        pc       += 64;
+    }
+
+    *numCodePoints = count;
+    return completePrefix(numCodePoints, string, pc);
+}
+
+#endif  // U_VECTORIZED_KERNELS
+
+int selectKernel()
+    // Return the fastest kernel supported by the CPU on which this process is
+    // running.
+{
+#if defined(U_VECTORIZED_KERNELS)
+    typedef bdlde::Simd_CpuFeatures Features;
+
+    if (!Features::isSupported(Features::e_SSE4_2 | Features::e_POPCNT)) {
+        return k_KERNEL_SCALAR;                                       // RETURN
+    }
+
+    return Features::isSupported(Features::e_AVX2) ? k_KERNEL_AVX2
+                                                   : k_KERNEL_SSE4;
+#else
+    return k_KERNEL_SCALAR;
+#endif
+}
+
+bsls::Types::size_type validPrefix(bsls::Types::IntPtr    *numCodePoints,
+                                   const char             *string,
+                                   bsls::Types::size_type  length,
+                                   bsls::Types::IntPtr     maxCodePoints)
+    // Return the length of a prefix of the specified 'string' having the
+    // specified 'length' that consists of at most the specified
+    // 'maxCodePoints' complete, valid UTF-8 code points, and load the number
+    // of code points in that prefix into the specified 'numCodePoints'.  The
+    // returned prefix is empty if no vectorized kernel is available or if
+    // 'string' is too short to benefit from one.  Note that the prefix is not
+    // necessarily the longest valid prefix of 'string'.
+{
+    int kernel = bsls::AtomicOperations::getIntRelaxed(&s_kernel);
+    if (UNLIKELY(k_KERNEL_UNKNOWN == kernel)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        kernel = selectKernel();
+        bsls::AtomicOperations::setIntRelaxed(&s_kernel, kernel);
+    }
+
+    switch (kernel) {
+#if defined(U_VECTORIZED_KERNELS)
+      case k_KERNEL_AVX2: {
+        return validPrefixAvx2(numCodePoints,
+                               string,
+                               length,
+                               maxCodePoints);                        // RETURN
+      }
+      case k_KERNEL_SSE4: {
+        return validPrefixSse4(numCodePoints,
+                               string,
+                               length,
+                               maxCodePoints);                        // RETURN
+      }
+#endif
+      default: break;
+    }
+
+    *numCodePoints = 0;
+    return 0;
+}
+
+}  // close unnamed namespace
+
 static
 int validateAndCountCodePoints(const char **invalidString, const char *string)
     // Return the number of Unicode code points in the specified 'string' if it
@@ -330,10 +799,18 @@ static int validateAndCountCodePoints(const char             **invalidString,
         return 0;                                                     // RETURN
     }
 
-    const char       *pc     = string;
+    // Skip the prefix that a vectorized kernel, if any, has found to be
+    // valid.  Note that any error is located by the scalar code below.
+
+    bsls::Types::IntPtr prefixCount;
+    const char         *pc = string + validPrefix(&prefixCount,
+                                                  string,
+                                                  length,
+                                                  INT_MAX);
+
     const char *const pcEnd4 = string + length - 4;
 
-    int count = 0;
+    int count = static_cast<int>(prefixCount);
 
     while (pc <= pcEnd4) {
         switch (static_cast<unsigned char>(*pc) >> 4) {
@@ -770,6 +1247,11 @@ Utf8Util::IntPtr Utf8Util::advanceIfValid(int         *status,
 
     const char * const endOfInput = string + length;
 
+    // Skip the prefix that a vectorized kernel, if any, has found to be
+    // valid.
+
+    string += validPrefix(&ret, string, length, numCodePoints);
+
     // Note that we keep 'string' pointing to the beginning of the Unicode code
     // point being processed, and only advance it to the next code point
     // between iterations.
@@ -19,6 +19,7 @@
 #include <bsls_log.h>
 #include <bsls_platform.h>
 #include <bsls_review.h>
+#include <bsls_stopwatch.h>
 #include <bsls_systemtime.h>
 #include <bsls_timeinterval.h>
 #include <bsls_types.h>
@@ -96,6 +97,13 @@ using bsl::size_t;
 //: o Test case 14 is negative testing.
 //:
 //: o Test cases 15, 16, and 17 are USAGE EXAMPLES.
+//:
+//: o Test case 19 tests the vectorized validation of 64-byte blocks against
+//:   the scalar code, with valid and invalid sequences placed at every
+//:   position relative to block boundaries.
+//:
+//: o Test case -3 measures validation throughput on ASCII-only, mixed, and
+//:   CJK-heavy input.
 //
 //-----------------------------------------------------------------------------
 // To fit functions on one line, 'typedef const char cchar'.
@@ -166,8 +174,10 @@ using bsl::size_t;
 // [15] USAGE EXAMPLE 1
 // [16] USAGE EXAMPLE 2
 // [17] USAGE EXAMPLE 3
+// [19] CONCERN: vectorized validation across block boundaries
 // [-1] random number generator
 // [-2] 'utf8Encode', 'decode'
+// [-3] PERFORMANCE: VALIDATION THROUGHPUT
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -3561,6 +3571,148 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 19: {
+        // --------------------------------------------------------------------
+        // VECTORIZED BLOCK BOUNDARIES
+        //
+        // Concerns:
+        //: 1 The vectorized kernels that validate 64-byte blocks of input
+        //:   yield the same results as the scalar code, whatever the position
+        //:   of a valid or invalid sequence relative to a block boundary.
+        //:
+        //: 2 Sequences straddling a block boundary, and sequences left
+        //:   incomplete at the end of the last full block, are handled
+        //:   properly.
+        //:
+        //: 3 'advanceIfValid' stops after exactly the requested number of code
+        //:   points when that number ends within a run of blocks that the
+        //:   kernel would otherwise skip.
+        //
+        // Plan:
+        //: 1 For backgrounds of ASCII, 2-byte, 3-byte, and 4-byte code points,
+        //:   and for a table of valid and invalid sequences, insert each
+        //:   sequence at every code point boundary of backgrounds of several
+        //:   lengths around multiples of 64 bytes.
+        //:
+        //: 2 Compare the results of the length-based 'isValid',
+        //:   'numCodePointsIfValid', and 'advanceIfValid' with those of the
+        //:   null-terminated overloads, which are implemented without
+        //:   vectorized kernels.  (C-1..3)
+        //
+        // Testing:
+        //   CONCERN: vectorized validation across block boundaries
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "VECTORIZED BLOCK BOUNDARIES\n"
+                             "===========================\n";
+
+        static const char *const BACKGROUNDS[] = {
+            "a", "\xc3\xa9", "\xe4\xb8\xad", "\xf0\x9f\x98\x80"
+        };
+        enum { k_NUM_BACKGROUNDS = sizeof BACKGROUNDS / sizeof *BACKGROUNDS };
+
+        static const char *const SEQUENCES[] = {
+            "",                       // nothing
+            "\xc3\xa9",               // valid 2-byte
+            "\xe4\xb8\xad",           // valid 3-byte
+            "\xf0\x9f\x98\x80",       // valid 4-byte
+            "\xf4\x8f\xbf\xbf",       // valid, 0x10ffff
+            "\x80",                   // unexpected continuation
+            "\xc3",                   // truncated 2-byte
+            "\xe4\xb8",               // truncated 3-byte
+            "\xf0\x9f\x98",           // truncated 4-byte
+            "\xc3\xa9\xa9",           // extra continuation
+            "\xc1\xbf",               // overlong 2-byte
+            "\xe0\x9f\xbf",           // overlong 3-byte
+            "\xf0\x8f\xbf\xbf",       // overlong 4-byte
+            "\xed\xa0\x80",           // surrogate
+            "\xf4\x90\x80\x80",       // larger than 0x10ffff
+            "\xf8\x88\x80\x80\x80",   // invalid initial octet
+            "\xff",                   // invalid initial octet
+        };
+        enum { k_NUM_SEQUENCES = sizeof SEQUENCES / sizeof *SEQUENCES };
+
+        static const int LENGTHS[] = { 16, 21, 32, 33, 43, 64, 65, 100, 128 };
+        enum { k_NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS };
+
+        for (int ti = 0; ti < k_NUM_BACKGROUNDS; ++ti) {
+            const bsl::string unit(BACKGROUNDS[ti]);
+
+            for (int tj = 0; tj < k_NUM_LENGTHS; ++tj) {
+                const int NUM_UNITS = LENGTHS[tj] * 4 / (int)unit.length();
+
+                for (int tk = 0; tk < k_NUM_SEQUENCES; ++tk) {
+                    const char *SEQ = SEQUENCES[tk];
+
+                    for (int pos = 0; pos <= NUM_UNITS; ++pos) {
+                        bsl::string str;
+                        for (int ii = 0; ii < NUM_UNITS; ++ii) {
+                            if (ii == pos) {
+                                str += SEQ;
+                            }
+                            str += unit;
+                        }
+                        if (NUM_UNITS == pos) {
+                            str += SEQ;
+                        }
+
+                        const char *EXP_INVALID = 0;
+                        const Obj::IntPtr EXP_COUNT =
+                                      Obj::numCodePointsIfValid(&EXP_INVALID,
+                                                                str.c_str());
+
+                        const char *invalid = 0;
+                        const bool  valid   = Obj::isValid(&invalid,
+                                                           str.data(),
+                                                           str.length());
+                        ASSERTV(ti, tj, tk, pos, (0 <= EXP_COUNT) == valid);
+                        ASSERTV(ti, tj, tk, pos,
+                                valid || EXP_INVALID == invalid);
+
+                        invalid = 0;
+                        const Obj::IntPtr count = Obj::numCodePointsIfValid(
+                                                                 &invalid,
+                                                                 str.data(),
+                                                                 str.length());
+                        ASSERTV(ti, tj, tk, pos, EXP_COUNT, count,
+                                EXP_COUNT == count);
+                        ASSERTV(ti, tj, tk, pos,
+                                valid || EXP_INVALID == invalid);
+
+                        for (int numCodePoints = 0;
+                             numCodePoints <= 2 * NUM_UNITS + 2;
+                             numCodePoints += 7) {
+                            int         expStatus;
+                            const char *expResult;
+                            const Obj::IntPtr EXP_ADVANCED =
+                                              Obj::advanceIfValid(
+                                                                &expStatus,
+                                                                &expResult,
+                                                                str.c_str(),
+                                                                numCodePoints);
+
+                            int         status;
+                            const char *result;
+                            const Obj::IntPtr advanced =
+                                              Obj::advanceIfValid(
+                                                                &status,
+                                                                &result,
+                                                                str.data(),
+                                                                str.length(),
+                                                                numCodePoints);
+
+                            ASSERTV(ti, tj, tk, pos, numCodePoints,
+                                    EXP_ADVANCED == advanced);
+                            ASSERTV(ti, tj, tk, pos, numCodePoints,
+                                    expResult == result);
+                            ASSERTV(ti, tj, tk, pos, numCodePoints,
+                                    (0 == expStatus) == (0 == status));
+                        }
+                    }
+                }
+            }
+        }
+      } break;
       case 18: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 3: 'readIfValid'
@@ -7022,6 +7174,104 @@ int main(int argc, char *argv[])
             ASSERT(bsl::strlen(str.c_str()) == str.length());
         }
       } break;
+      case -3: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: VALIDATION THROUGHPUT
+        //
+        // Concerns:
+        //: 1 Report the throughput of validating ASCII-only, mixed, and
+        //:   CJK-heavy input, exercising respectively the ASCII fast path,
+        //:   frequent transitions between it and the full check, and the full
+        //:   check alone.
+        //
+        // Plan:
+        //: 1 Build 1 MB strings of each kind of input, and time repeated calls
+        //:   to the length-based 'isValid', 'numCodePointsIfValid', and
+        //:   'advanceIfValid' on each.
+        //
+        // Testing:
+        //   PERFORMANCE: VALIDATION THROUGHPUT
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "PERFORMANCE: VALIDATION THROUGHPUT\n"
+                             "==================================\n";
+
+        enum { k_SIZE = 1 << 20 };
+
+        const int numIterations = argc > 2 ? bsl::atoi(argv[2]) : 200;
+
+        static const char prose[] = "The quick brown fox jumps over the lazy "
+                                    "dog. ";
+        static const char cjk[]   = "\xe4\xb8\xad\xe5\x8d\x8e\xe4\xba\xba"
+                                    "\xe6\xb0\x91\xe5\x85\xb1\xe5\x92\x8c"
+                                    "\xe5\x9b\xbd\xef\xbc\x8c";
+
+        bsl::string ascii, mixed, heavy;
+        while (ascii.length() < k_SIZE) {
+            ascii += prose;
+        }
+        while (mixed.length() < k_SIZE) {
+            mixed += prose;
+            mixed += "\xc3\xa9t\xc3\xa9 \xce\xb1\xce\xb2 ";
+            mixed += prose;
+            mixed += cjk;
+        }
+        while (heavy.length() < k_SIZE) {
+            heavy += cjk;
+            heavy += "\xf0\x9f\x98\x80 ";
+        }
+
+        const bsl::string *const INPUTS[] = { &ascii, &mixed, &heavy };
+        const char        *const NAMES[]  = { "ASCII", "mixed", "CJK" };
+
+        for (int ti = 0; ti < 3; ++ti) {
+            const bsl::string& input = *INPUTS[ti];
+
+            ASSERT(Obj::isValid(input.data(), input.length()));
+
+            for (int tj = 0; tj < 3; ++tj) {
+                bsls::Stopwatch timer;
+                timer.start();
+
+                Obj::IntPtr sum = 0;
+                for (int ii = 0; ii < numIterations; ++ii) {
+                    const char *invalid;
+                    switch (tj) {
+                      case 0: {
+                        sum += Obj::isValid(&invalid,
+                                            input.data(),
+                                            input.length());
+                      } break;
+                      case 1: {
+                        sum += Obj::numCodePointsIfValid(&invalid,
+                                                         input.data(),
+                                                         input.length());
+                      } break;
+                      default: {
+                        int status;
+                        sum += Obj::advanceIfValid(&status,
+                                                   &invalid,
+                                                   input.data(),
+                                                   input.length(),
+                                                   input.length());
+                      } break;
+                    }
+                }
+
+                timer.stop();
+                ASSERT(0 < sum);
+
+                static const char *const FUNCS[] = {
+                    "isValid", "numCodePointsIfValid", "advanceIfValid"
+                };
+                const double bytes = static_cast<double>(input.length())
+                                   * numIterations;
+
+                cout << NAMES[ti] << ' ' << FUNCS[tj] << ": "
+                     << bytes / timer.elapsedTime() / 1e6 << " MB/s\n";
+            }
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
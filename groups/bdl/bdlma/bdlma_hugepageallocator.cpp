@@ -0,0 +1,560 @@
+// bdlma_hugepageallocator.cpp                                        -*-C++-*-
+#include <bdlma_hugepageallocator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlma_hugepageallocator_cpp,"$Id$ $CSID$")
+
+#include <bslmt_lockguard.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_exceptionutil.h>      // 'BSLS_THROW'
+#include <bsls_performancehint.h>
+#include <bsls_platform.h>
+
+#include <bsl_climits.h>             // 'CHAR_BIT'
+#include <bsl_cstddef.h>             // 'bsl::size_t'
+#include <bsl_new.h>                 // 'bsl::bad_alloc'
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+#include <windows.h>        // 'GetSystemInfo', 'VirtualAlloc', 'VirtualFree'
+
+#else
+
+#include <sys/mman.h>       // 'madvise', 'mmap', 'munmap'
+#include <unistd.h>         // 'sysconf', 'syscall'
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+#include <sys/syscall.h>    // 'SYS_get_mempolicy', 'SYS_mbind'
+#endif
+
+#ifndef MAP_ANONYMOUS
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+
+#endif
+
+namespace BloombergLP {
+namespace {
+
+typedef bsls::Types::size_type size_type;
+
+// The values of the following constants are those of the Linux kernel
+// interface ('<linux/mempolicy.h>'), whose headers may not be installed.
+
+const int k_MPOL_BIND           = 2;       // 'MPOL_BIND'
+const int k_MPOL_INTERLEAVE     = 3;       // 'MPOL_INTERLEAVE'
+const int k_MPOL_F_MEMS_ALLOWED = 1 << 2;  // 'MPOL_F_MEMS_ALLOWED'
+const int k_MAP_HUGE_2MB        = 21 << 26;
+                                     // 'MAP_HUGE_2MB', i.e., 'log2(2 MiB)'
+                                     // shifted by 'MAP_HUGE_SHIFT'
+
+const size_type k_MAX_SHARED_SIZE =
+                               bdlma::HugePageAllocator::k_HUGE_PAGE_SIZE / 4;
+    // largest request carved from a shared region
+
+enum {
+    k_MAX_NUMA_NODES = 4096,  // nodes representable in a node mask
+
+    k_BITS_PER_LONG  = sizeof(unsigned long) * CHAR_BIT,
+
+    k_NUM_MASK_WORDS = k_MAX_NUMA_NODES / k_BITS_PER_LONG
+};
+
+// HELPER FUNCTIONS
+
+size_type getSystemPageSize()
+    // Return the size (in bytes) of a system memory page.
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwPageSize;
+
+#else
+
+    return static_cast<size_type>(sysconf(_SC_PAGESIZE));
+
+#endif
+}
+
+size_type roundUp(size_type size, size_type alignment)
+    // Return the specified 'size' rounded up to the least multiple of the
+    // specified 'alignment'.  The behavior is undefined unless 'alignment' is
+    // a power of two.
+{
+    return (size + alignment - 1) & ~(alignment - 1);
+}
+
+void *systemMap(void      **base,
+                size_type  *mappedSize,
+                size_type   size,
+                size_type   alignment)
+    // Map from the system a range of memory of the specified 'size' (in
+    // bytes) aligned to the specified 'alignment', load into the specified
+    // 'base' and 'mappedSize' the address and size of the memory to return to
+    // the system in order to unmap the range, and return the address of the
+    // range, or 0 if the system has no memory available.  The behavior is
+    // undefined unless 'size' is a multiple of the system page size and
+    // 'alignment' is a power of two.
+{
+    const size_type pageSize = getSystemPageSize();
+    const size_type padding  = alignment > pageSize ? alignment : 0;
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+    // Reserve enough address space to align the range, and commit only the
+    // range itself.  Windows can release only a whole reservation.
+
+    char *reserved = static_cast<char *>(VirtualAlloc(0,
+                                                      size + padding,
+                                                      MEM_RESERVE,
+                                                      PAGE_NOACCESS));
+    if (!reserved) {
+        return 0;                                                     // RETURN
+    }
+
+    char *address = reinterpret_cast<char *>(
+                    roundUp(reinterpret_cast<size_type>(reserved), alignment));
+
+    if (!VirtualAlloc(address, size, MEM_COMMIT, PAGE_READWRITE)) {
+        VirtualFree(reserved, 0, MEM_RELEASE);
+        return 0;                                                     // RETURN
+    }
+
+    *base       = reserved;
+    *mappedSize = size + padding;
+    return address;
+
+#else
+
+    // Map enough memory to align the range, and unmap the excess at either
+    // end.
+
+    void *mapped = mmap(0,
+                        size + padding,
+                        PROT_READ | PROT_WRITE,
+                        MAP_ANONYMOUS | MAP_PRIVATE,
+                        -1,
+                        0);
+
+    if (MAP_FAILED == mapped) {
+        return 0;                                                     // RETURN
+    }
+
+    char *begin   = static_cast<char *>(mapped);
+    char *address = reinterpret_cast<char *>(
+                       roundUp(reinterpret_cast<size_type>(begin), alignment));
+
+    if (padding) {
+        if (address != begin) {
+            munmap(begin, address - begin);
+        }
+        const size_type tail = padding - (address - begin);
+        if (tail) {
+            munmap(address + size, tail);
+        }
+    }
+
+    *base       = address;
+    *mappedSize = size;
+    return address;
+
+#endif
+}
+
+void systemUnmap(void *base, size_type size)
+    // Return to the system the range of memory at the specified 'base' having
+    // the specified 'size' (in bytes).  The behavior is undefined unless
+    // 'base' and 'size' were loaded by 'systemMap' or describe a mapping
+    // returned by 'mapHugeTlb', and the range has not already been unmapped.
+{
+    BSLS_ASSERT(base);
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+    VirtualFree(base, 0, MEM_RELEASE);
+    (void)size;
+
+#else
+
+    // On some of our platforms, 'munmap' takes a 'char*' argument, while on
+    // others it takes a 'void*'.  Casting to 'char*', which will work in both
+    // cases.
+
+    munmap(static_cast<char *>(base), size);
+
+#endif
+}
+
+void *mapHugeTlb(size_type size)
+    // Map from the system a range of memory of the specified 'size' (in
+    // bytes) backed by pre-reserved 2 MiB huge pages, and return its address,
+    // or 0 if no such huge pages are available.  The behavior is undefined
+    // unless 'size' is a multiple of 2 MiB.
+{
+#if defined(BSLS_PLATFORM_OS_LINUX) && defined(MAP_HUGETLB)
+
+    void *address = mmap(0,
+                         size,
+                         PROT_READ | PROT_WRITE,
+                         MAP_ANONYMOUS | MAP_PRIVATE | MAP_HUGETLB
+                                                             | k_MAP_HUGE_2MB,
+                         -1,
+                         0);
+
+    return MAP_FAILED == address ? 0 : address;
+
+#else
+
+    (void)size;
+    (void)k_MAP_HUGE_2MB;
+    return 0;
+
+#endif
+}
+
+int adviseHugePages(void *address, size_type size)
+    // Advise the system to back the range of memory at the specified
+    // 'address' having the specified 'size' (in bytes) by transparent huge
+    // pages.  Return 0 on success, and a non-zero value otherwise.
+{
+#if defined(BSLS_PLATFORM_OS_LINUX) && defined(MADV_HUGEPAGE)
+
+    return madvise(address, size, MADV_HUGEPAGE);
+
+#else
+
+    (void)address;
+    (void)size;
+    return -1;
+
+#endif
+}
+
+int applyNumaPolicy(void                *address,
+                    size_type            size,
+                    int                  mode,
+                    bsls::Types::Uint64  nodeMask)
+    // Place the pages of the range of memory at the specified 'address'
+    // having the specified 'size' (in bytes) according to the specified
+    // 'mode', one of 'k_MPOL_BIND' and 'k_MPOL_INTERLEAVE', on the nodes of
+    // the specified 'nodeMask', or, if 'nodeMask' is 0, on every node
+    // available to the process.  Return 0 on success, and a non-zero value
+    // otherwise.  The behavior is undefined unless no page of the range has
+    // been touched.
+{
+#if defined(BSLS_PLATFORM_OS_LINUX) && defined(SYS_mbind)                    \
+                                    && defined(SYS_get_mempolicy)
+
+    unsigned long mask[k_NUM_MASK_WORDS] = { 0 };
+
+    if (0 == nodeMask) {
+        int policy;
+        if (0 != syscall(SYS_get_mempolicy,
+                         &policy,
+                         mask,
+                         k_MAX_NUMA_NODES + 1,
+                         0,
+                         k_MPOL_F_MEMS_ALLOWED)) {
+            return -1;                                                // RETURN
+        }
+    }
+    else {
+        for (int node = 0; node < 64; ++node) {
+            if (nodeMask & (static_cast<bsls::Types::Uint64>(1) << node)) {
+                mask[node / k_BITS_PER_LONG] |=
+                                           1UL << (node % k_BITS_PER_LONG);
+            }
+        }
+    }
+
+    return static_cast<int>(syscall(SYS_mbind,
+                                    address,
+                                    size,
+                                    mode,
+                                    mask,
+                                    k_MAX_NUMA_NODES + 1,
+                                    0));
+
+#else
+
+    (void)address;
+    (void)size;
+    (void)mode;
+    (void)nodeMask;
+    return -1;
+
+#endif
+}
+
+}  // close unnamed namespace
+
+namespace bdlma {
+
+                     // ================================
+                     // struct HugePageAllocator::Region
+                     // ================================
+
+struct HugePageAllocator::Region {
+    // This 'struct' is the header of a shared region, from which small blocks
+    // are carved.  A region is aligned to 'k_HUGE_PAGE_SIZE', and its first
+    // block follows the header.
+
+    // CLASS DATA
+    static const size_type k_HEADER_SIZE;  // offset of the first block
+
+    // DATA
+    size_type d_offset;     // offset of the next block to be carved
+    int       d_numBlocks;  // number of blocks carved and not deallocated
+};
+
+const size_type HugePageAllocator::Region::k_HEADER_SIZE =
+                              bsls::AlignmentUtil::roundUpToMaximalAlignment(
+                                                              sizeof(Region));
+
+                          // -----------------------
+                          // class HugePageAllocator
+                          // -----------------------
+
+// CLASS DATA
+const bsls::Types::size_type HugePageAllocator::k_HUGE_PAGE_SIZE;
+
+// PRIVATE MANIPULATORS
+void *HugePageAllocator::map(bsls::Types::size_type size,
+                             bsls::Types::size_type alignment)
+{
+    void      *address      = 0;
+    void      *base         = 0;
+    size_type  mappedSize   = 0;
+    bool       hugePagesMet = true;
+
+    if (e_EXPLICIT_HUGE_PAGES == d_pageMode) {
+        address = mapHugeTlb(size);
+        if (address) {
+            base       = address;
+            mappedSize = size;
+        }
+        else {
+            hugePagesMet = false;
+        }
+    }
+
+    if (!address) {
+        address = systemMap(&base, &mappedSize, size, alignment);
+        if (!address) {
+            return 0;                                                 // RETURN
+        }
+
+        // Fall back to transparent huge pages in 'e_EXPLICIT_HUGE_PAGES'
+        // mode, but count the mapping once only.
+
+        if (e_STANDARD_PAGES != d_pageMode
+         && 0 != adviseHugePages(address, size)) {
+            hugePagesMet = false;
+        }
+    }
+
+    if (!hugePagesMet) {
+        ++d_numHugePageFallbacks;
+    }
+
+    // Apply the NUMA policy before any page of the range is touched.
+
+    if (e_NUMA_DEFAULT != d_numaPolicy) {
+        const int mode = e_NUMA_BIND == d_numaPolicy ? k_MPOL_BIND
+                                                     : k_MPOL_INTERLEAVE;
+        if (0 != applyNumaPolicy(address, size, mode, d_numaNodeMask)) {
+            ++d_numNumaPolicyFailures;
+        }
+    }
+
+    Mapping mapping;
+    mapping.d_base_p   = base;
+    mapping.d_size     = mappedSize;
+    mapping.d_numBytes = size;
+
+    BSLS_TRY {
+        d_mappings.insert(MappingMap::value_type(address, mapping));
+    }
+    BSLS_CATCH(...) {
+        systemUnmap(base, mappedSize);
+        BSLS_RETHROW;
+    }
+
+    d_numBytesMapped.addRelaxed(
+                         static_cast<bsls::Types::Int64>(mapping.d_numBytes));
+
+    return address;
+}
+
+void HugePageAllocator::unmap(const void *address)
+{
+    MappingMap::iterator it = d_mappings.find(address);
+
+    BSLS_ASSERT(d_mappings.end() != it);
+
+    systemUnmap(it->second.d_base_p, it->second.d_size);
+
+    d_numBytesMapped.addRelaxed(-static_cast<bsls::Types::Int64>(
+                                                      it->second.d_numBytes));
+    d_mappings.erase(it);
+}
+
+// CREATORS
+HugePageAllocator::HugePageAllocator(PageMode          pageMode,
+                                     bslma::Allocator *basicAllocator)
+: d_pageMode(pageMode)
+, d_numaPolicy(e_NUMA_DEFAULT)
+, d_numaNodeMask(0)
+, d_mappings(basicAllocator)
+, d_region_p(0)
+, d_numBytesMapped(0)
+, d_numHugePageFallbacks(0)
+, d_numNumaPolicyFailures(0)
+{
+}
+
+HugePageAllocator::HugePageAllocator(PageMode             pageMode,
+                                     NumaPolicy           numaPolicy,
+                                     bsls::Types::Uint64  numaNodeMask,
+                                     bslma::Allocator    *basicAllocator)
+: d_pageMode(pageMode)
+, d_numaPolicy(numaPolicy)
+, d_numaNodeMask(numaNodeMask)
+, d_mappings(basicAllocator)
+, d_region_p(0)
+, d_numBytesMapped(0)
+, d_numHugePageFallbacks(0)
+, d_numNumaPolicyFailures(0)
+{
+    BSLS_ASSERT(e_NUMA_BIND != numaPolicy || 0 != numaNodeMask);
+}
+
+HugePageAllocator::~HugePageAllocator()
+{
+    for (MappingMap::iterator it = d_mappings.begin();
+         it != d_mappings.end();
+         ++it) {
+        systemUnmap(it->second.d_base_p, it->second.d_size);
+    }
+}
+
+// MANIPULATORS
+void *HugePageAllocator::allocate(bsls::Types::size_type size)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == size)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return 0;                                                     // RETURN
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    void *result;
+
+    if (size > k_MAX_SHARED_SIZE) {
+        const size_type pageSize = e_STANDARD_PAGES == d_pageMode
+                                 ? getSystemPageSize()
+                                 : k_HUGE_PAGE_SIZE;
+
+        result = map(roundUp(size, pageSize), pageSize);
+    }
+    else {
+        const size_type blockSize =
+                          bsls::AlignmentUtil::roundUpToMaximalAlignment(size);
+
+        result = 0;
+
+        if (!d_region_p
+         || d_region_p->d_offset + blockSize > k_HUGE_PAGE_SIZE) {
+            void *address = map(k_HUGE_PAGE_SIZE, k_HUGE_PAGE_SIZE);
+            if (address) {
+                // The current region is unmapped when its last block is
+                // deallocated, or now if it has none.
+
+                if (d_region_p && 0 == d_region_p->d_numBlocks) {
+                    unmap(d_region_p);
+                }
+
+                d_region_p = new (address) Region();
+                d_region_p->d_offset    = Region::k_HEADER_SIZE;
+                d_region_p->d_numBlocks = 0;
+            }
+        }
+
+        if (d_region_p
+         && d_region_p->d_offset + blockSize <= k_HUGE_PAGE_SIZE) {
+            result = reinterpret_cast<char *>(d_region_p)
+                                                        + d_region_p->d_offset;
+
+            d_region_p->d_offset += blockSize;
+            ++d_region_p->d_numBlocks;
+        }
+    }
+
+    if (!result) {
+#ifdef BDE_BUILD_TARGET_EXC
+        BSLS_THROW(bsl::bad_alloc());
+#else
+        return 0;                                                     // RETURN
+#endif
+    }
+
+    return result;
+}
+
+void HugePageAllocator::deallocate(void *address)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == address)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return;                                                       // RETURN
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    // A dedicated mapping is recorded under the address of its block, while
+    // a block carved from a shared region never starts a region.
+
+    if (d_mappings.end() != d_mappings.find(address)) {
+        unmap(address);
+        return;                                                       // RETURN
+    }
+
+    Region *region = reinterpret_cast<Region *>(
+                            reinterpret_cast<bsls::Types::UintPtr>(address)
+                                                    & ~(k_HUGE_PAGE_SIZE - 1));
+
+    BSLS_ASSERT(0 < region->d_numBlocks);
+
+    if (0 == --region->d_numBlocks) {
+        if (region == d_region_p) {
+            // Reuse the current region from its start.
+
+            region->d_offset = Region::k_HEADER_SIZE;
+        }
+        else {
+            unmap(region);
+        }
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
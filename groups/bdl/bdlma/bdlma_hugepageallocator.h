@@ -0,0 +1,426 @@
+// bdlma_hugepageallocator.h                                          -*-C++-*-
+#ifndef INCLUDED_BDLMA_HUGEPAGEALLOCATOR
+#define INCLUDED_BDLMA_HUGEPAGEALLOCATOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an allocator of huge-page, NUMA-placed system memory.
+//
+//@CLASSES:
+//  bdlma::HugePageAllocator: allocator mapping huge pages from the system
+//
+//@SEE_ALSO: bdlma_guardingallocator, bdlma_sequentialallocator,
+//           bdlma_multipool
+//
+//@DESCRIPTION: This component provides a concrete allocation mechanism,
+// 'bdlma::HugePageAllocator', that implements the 'bslma::Allocator' protocol
+// by mapping memory directly from the operating system, backed by huge pages
+// and placed on NUMA nodes as configured at construction:
+//..
+//   ,------------------------.
+//  ( bdlma::HugePageAllocator )
+//   `------------------------'
+//               |         ctor/dtor
+//               |         numBytesMapped
+//               |         numHugePageFallbacks
+//               |         numNumaPolicyFailures
+//               |         numaNodeMask
+//               |         numaPolicy
+//               |         pageMode
+//               V
+//      ,----------------.
+//     ( bslma::Allocator )
+//      `----------------'
+//                         allocate
+//                         deallocate
+//..
+// A 'bdlma::HugePageAllocator' is intended to be the upstream allocator of
+// the arena allocators of this package, such as 'bdlma::SequentialAllocator',
+// 'bdlma::Pool', and 'bdlma::Multipool', that obtain large chunks of memory
+// infrequently and dispense them in small pieces.  Memory backed by 2 MiB
+// huge pages, rather than 4 KiB pages, needs 512 times fewer TLB entries,
+// which markedly reduces TLB misses for large in-memory data sets.  Memory
+// placed on the NUMA node of the threads that use it avoids the latency of
+// remote memory accesses.
+//
+///Page Modes
+///----------
+// The 'PageMode' supplied at construction determines the pages that back the
+// mapped memory:
+//
+//: 'e_STANDARD_PAGES':
+//:   Memory is backed by pages of the system page size.
+//:
+//: 'e_TRANSPARENT_HUGE_PAGES':
+//:   Memory is mapped at 2 MiB boundaries, in multiples of 2 MiB, and is
+//:   advised to be backed by transparent huge pages ('madvise' with
+//:   'MADV_HUGEPAGE').  The kernel backs the memory by huge pages as they
+//:   become available, which requires transparent huge pages to be enabled in
+//:   'madvise' or 'always' mode.
+//:
+//: 'e_EXPLICIT_HUGE_PAGES':
+//:   Memory is mapped from the pool of pre-reserved 2 MiB huge pages
+//:   ('mmap' with 'MAP_HUGETLB').  If the pool is exhausted, or not
+//:   configured, the mapping falls back to transparent huge pages.
+//
+// Huge pages are supported on Linux only; on other platforms, every mode
+// maps standard pages.  Each mapping for which huge pages were requested but
+// not obtained increments the count returned by 'numHugePageFallbacks'.
+//
+///NUMA Policies
+///-------------
+// The 'NumaPolicy' supplied at construction determines the NUMA nodes on
+// which the pages of the mapped memory are placed:
+//
+//: 'e_NUMA_DEFAULT':
+//:   Pages are placed by the policy of the thread that first touches them,
+//:   which by default is the node local to that thread.
+//:
+//: 'e_NUMA_BIND':
+//:   Pages are placed only on the nodes of the node mask supplied at
+//:   construction ('mbind' with 'MPOL_BIND').
+//:
+//: 'e_NUMA_INTERLEAVE':
+//:   Pages are interleaved across the nodes of the node mask supplied at
+//:   construction, or across all nodes available to the process if the mask
+//:   is 0 ('mbind' with 'MPOL_INTERLEAVE').
+//
+// NUMA policies are supported on Linux only.  A policy that can not be
+// applied to a mapping (e.g., because the system does not support NUMA, or
+// because the node mask names no available node) leaves the default policy
+// in effect for that mapping, and increments the count returned by
+// 'numNumaPolicyFailures'.
+//
+///Mappings and Regions
+///--------------------
+// A request for more than a quarter of the huge page size (512 KiB) is
+// satisfied by a dedicated mapping, rounded up to a multiple of the huge page
+// size (or of the system page size in 'e_STANDARD_PAGES' mode), that is
+// returned to the system when the block is deallocated.  Smaller requests are
+// carved, maximally aligned, from a shared region of the huge page size,
+// which is returned to the system once all of the blocks carved from it are
+// deallocated and the allocator has moved on to a new region.  Hence, the
+// initial, small chunks obtained by an arena allocator do not each consume a
+// huge page.
+//
+// Note that the allocator is intended to supply large chunks of memory,
+// infrequently: each call to 'allocate' or 'deallocate' acquires a mutex, and
+// a dedicated mapping costs a system call.
+//
+// The destructor returns to the system all memory mapped by the allocator,
+// including memory that is still allocated.
+//
+///Thread Safety
+///-------------
+// The 'bdlma::HugePageAllocator' class is fully thread-safe (see
+// 'bsldoc_glossary').
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Backing an Arena by Huge Pages
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose that we build a large, read-mostly table of order records in
+// memory, using an arena allocator that obtains its memory in large chunks.
+// Lookups into the table touch memory at random, so that with standard pages
+// most of them miss the TLB.
+//
+// First, we define the record stored in the table:
+//..
+//  struct OrderRecord {
+//      bsls::Types::Int64 d_orderId;
+//      double             d_price;
+//      int                d_quantity;
+//  };
+//..
+// Then, we create a huge-page allocator that places its memory on the NUMA
+// node 0, on which (we assume) the threads using the table run:
+//..
+//  typedef bdlma::HugePageAllocator HPA;
+//
+//  HPA hugePageAllocator(HPA::e_TRANSPARENT_HUGE_PAGES,
+//                        HPA::e_NUMA_BIND,
+//                        1);  // node mask designating node 0
+//..
+// Next, we create the arena allocator, supplying the huge-page allocator as
+// its upstream allocator.  Once the arena grows past its initial chunks, each
+// chunk it obtains is a dedicated mapping of one or more huge pages:
+//..
+//  bdlma::SequentialAllocator arena(&hugePageAllocator);
+//..
+// Then, we create our table, using the arena:
+//..
+//  bsl::vector<OrderRecord *> table(&arena);
+//
+//  for (int i = 0; i < 100000; ++i) {
+//      OrderRecord *record = new (arena) OrderRecord();
+//      record->d_orderId  = i;
+//      record->d_price    = 100.0 + i % 100;
+//      record->d_quantity = i % 1000;
+//      table.push_back(record);
+//  }
+//..
+// Finally, we observe that the memory of the table was mapped by the
+// huge-page allocator:
+//..
+//  assert(0 < hugePageAllocator.numBytesMapped());
+//..
+// Note that whether the memory is actually backed by huge pages, and placed
+// on node 0, depends on the configuration of the system; the
+// 'numHugePageFallbacks' and 'numNumaPolicyFailures' accessors report the
+// mappings for which either request could not be honored.
+
+#include <bdlscm_version.h>
+
+#include <bslma_allocator.h>
+
+#include <bslmt_mutex.h>
+
+#include <bsls_atomic.h>
+#include <bsls_keyword.h>
+#include <bsls_types.h>
+
+#include <bsl_unordered_map.h>
+
+namespace BloombergLP {
+namespace bdlma {
+
+                          // =======================
+                          // class HugePageAllocator
+                          // =======================
+
+class HugePageAllocator : public bslma::Allocator {
+    // This class defines a concrete thread-safe allocator mechanism that
+    // implements the 'bslma::Allocator' protocol by mapping memory from the
+    // operating system, backed by the pages indicated by the 'PageMode', and
+    // placed on NUMA nodes according to the 'NumaPolicy', supplied at
+    // construction.  Small requests are carved from shared regions of the
+    // huge page size.  The destructor returns all mapped memory to the
+    // system.
+
+  public:
+    // TYPES
+    enum PageMode {
+        // Enumerate the pages that may back the memory mapped by a
+        // 'HugePageAllocator'.
+
+        e_STANDARD_PAGES,          // pages of the system page size
+        e_TRANSPARENT_HUGE_PAGES,  // transparent huge pages ('MADV_HUGEPAGE')
+        e_EXPLICIT_HUGE_PAGES      // reserved huge pages ('MAP_HUGETLB')
+    };
+
+    enum NumaPolicy {
+        // Enumerate the policies placing the memory mapped by a
+        // 'HugePageAllocator' on NUMA nodes.
+
+        e_NUMA_DEFAULT,    // the policy of the thread first touching a page
+        e_NUMA_BIND,       // only the nodes of the node mask
+        e_NUMA_INTERLEAVE  // interleaved across the nodes of the node mask
+    };
+
+    // CLASS DATA
+    static const bsls::Types::size_type k_HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+        // size (in bytes) of a huge page, and of a shared region
+
+  private:
+    // PRIVATE TYPES
+    struct Region;
+        // Header of a shared region, from which small blocks are carved.
+
+    struct Mapping {
+        // This 'struct' describes a range of memory mapped from the system.
+
+        void                   *d_base_p;  // address to unmap
+        bsls::Types::size_type  d_size;    // size (in bytes) to unmap
+
+        bsls::Types::size_type  d_numBytes;
+                                           // size (in bytes) counted by
+                                           // 'numBytesMapped'
+    };
+
+    typedef bsl::unordered_map<const void *, Mapping> MappingMap;
+        // Map from the address of a dedicated block, or of a shared region,
+        // to the range of memory mapped for it.
+
+    // DATA
+    PageMode               d_pageMode;               // pages backing memory
+
+    NumaPolicy             d_numaPolicy;             // placement of memory
+
+    bsls::Types::Uint64    d_numaNodeMask;           // nodes of
+                                                     // 'd_numaPolicy'
+
+    MappingMap             d_mappings;               // all mapped memory
+
+    Region                *d_region_p;               // current shared region,
+                                                     // or 0 if there is none
+
+    bsls::AtomicInt64      d_numBytesMapped;         // size of all mappings
+
+    bsls::AtomicInt64      d_numHugePageFallbacks;   // mappings without
+                                                     // requested huge pages
+
+    bsls::AtomicInt64      d_numNumaPolicyFailures;  // mappings without
+                                                     // requested placement
+
+    bslmt::Mutex           d_mutex;                  // guards 'd_mappings'
+                                                     // and the regions
+
+  private:
+    // NOT IMPLEMENTED
+    HugePageAllocator(const HugePageAllocator&);
+    HugePageAllocator& operator=(const HugePageAllocator&);
+
+    // PRIVATE MANIPULATORS
+    void *map(bsls::Types::size_type size, bsls::Types::size_type alignment);
+        // Map from the system a range of memory of the specified 'size' (in
+        // bytes), aligned to the specified 'alignment', apply to it the page
+        // mode and NUMA policy of this allocator, record the mapping in
+        // 'd_mappings', and return its address, or 0 if the system has no
+        // memory available.  The behavior is undefined unless 'd_mutex' is
+        // locked, 'size' is a multiple of the system page size, and
+        // 'alignment' is a power of two.
+
+    void unmap(const void *address);
+        // Return to the system the range of memory at the specified 'address'
+        // mapped by 'map', and remove its record from 'd_mappings'.  The
+        // behavior is undefined unless 'd_mutex' is locked and 'address' was
+        // returned by 'map' and has not already been unmapped.
+
+  public:
+    // CREATORS
+    explicit
+    HugePageAllocator(PageMode          pageMode = e_TRANSPARENT_HUGE_PAGES,
+                      bslma::Allocator *basicAllocator = 0);
+    HugePageAllocator(PageMode             pageMode,
+                      NumaPolicy           numaPolicy,
+                      bsls::Types::Uint64  numaNodeMask,
+                      bslma::Allocator    *basicAllocator = 0);
+        // Create a huge-page allocator.  Optionally specify a 'pageMode'
+        // indicating the pages that back the memory it maps.  If 'pageMode'
+        // is not specified, memory is backed by transparent huge pages.
+        // Optionally specify a 'numaPolicy' and 'numaNodeMask', in which bit
+        // 'i' designates the NUMA node 'i', indicating the nodes on which the
+        // memory it maps is placed.  If 'numaPolicy' is not specified,
+        // 'e_NUMA_DEFAULT' is used.  Optionally specify a 'basicAllocator'
+        // used to supply memory for the bookkeeping of mappings.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless 'e_NUMA_BIND != numaPolicy'
+        // or '0 != numaNodeMask'.  Note that a 'numaNodeMask' of 0 with
+        // 'e_NUMA_INTERLEAVE' designates every node available to the process.
+
+    virtual ~HugePageAllocator();
+        // Destroy this allocator object, and return to the system all memory
+        // it mapped, including memory that is still allocated.
+
+    // MANIPULATORS
+    virtual void *allocate(bsls::Types::size_type size) BSLS_KEYWORD_OVERRIDE;
+        // Return a newly-allocated maximally-aligned block of memory of at
+        // least the specified 'size' (in bytes), mapped from the system as
+        // indicated at construction.  If 'size' is 0, no memory is allocated
+        // and 0 is returned.  If 'size' exceeds a quarter of
+        // 'k_HUGE_PAGE_SIZE', the block is a dedicated mapping aligned to the
+        // page size of the page mode.  If the system has no memory available,
+        // throw 'bsl::bad_alloc' if exceptions are enabled, or return 0
+        // otherwise.
+
+    virtual void deallocate(void *address) BSLS_KEYWORD_OVERRIDE;
+        // Return the memory block at the specified 'address' back to this
+        // allocator.  If 'address' is 0, this method has no effect.  A
+        // dedicated mapping is returned to the system immediately, and a
+        // shared region once all of the blocks carved from it have been
+        // deallocated and it is no longer the current region.  The behavior
+        // is undefined unless 'address' was returned by 'allocate' on this
+        // object and has not already been deallocated.
+
+    // ACCESSORS
+    bsls::Types::Int64 numBytesMapped() const;
+        // Return the total size (in bytes) of the memory currently mapped by
+        // this allocator.
+
+    bsls::Types::Int64 numHugePageFallbacks() const;
+        // Return the number of mappings for which this allocator requested,
+        // but did not obtain, huge pages ('e_EXPLICIT_HUGE_PAGES') or the
+        // advice to use transparent huge pages ('e_TRANSPARENT_HUGE_PAGES').
+
+    bsls::Types::Int64 numNumaPolicyFailures() const;
+        // Return the number of mappings to which this allocator failed to
+        // apply its NUMA policy.
+
+    NumaPolicy numaPolicy() const;
+        // Return the NUMA policy of this allocator.
+
+    bsls::Types::Uint64 numaNodeMask() const;
+        // Return the NUMA node mask of this allocator.
+
+    PageMode pageMode() const;
+        // Return the page mode of this allocator.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                          // -----------------------
+                          // class HugePageAllocator
+                          // -----------------------
+
+// ACCESSORS
+inline
+bsls::Types::Int64 HugePageAllocator::numBytesMapped() const
+{
+    return d_numBytesMapped.loadRelaxed();
+}
+
+inline
+bsls::Types::Int64 HugePageAllocator::numHugePageFallbacks() const
+{
+    return d_numHugePageFallbacks.loadRelaxed();
+}
+
+inline
+bsls::Types::Int64 HugePageAllocator::numNumaPolicyFailures() const
+{
+    return d_numNumaPolicyFailures.loadRelaxed();
+}
+
+inline
+HugePageAllocator::NumaPolicy HugePageAllocator::numaPolicy() const
+{
+    return d_numaPolicy;
+}
+
+inline
+bsls::Types::Uint64 HugePageAllocator::numaNodeMask() const
+{
+    return d_numaNodeMask;
+}
+
+inline
+HugePageAllocator::PageMode HugePageAllocator::pageMode() const
+{
+    return d_pageMode;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,937 @@
+// bdlma_hugepageallocator.t.cpp                                      -*-C++-*-
+#include <bdlma_hugepageallocator.h>
+
+#include <bdlma_sequentialallocator.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_threadutil.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_asserttest.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+#include <sys/syscall.h>    // 'SYS_get_mempolicy'
+#include <unistd.h>         // 'syscall'
+#endif
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// 'bdlma::HugePageAllocator' maps memory from the operating system, carving
+// small requests from shared regions and satisfying large requests with
+// dedicated mappings.  The primary concerns are that 'allocate' returns
+// distinct, usable, and suitably aligned blocks, that the memory mapped is
+// returned to the system as the blocks are deallocated, as reported by
+// 'numBytesMapped', and that the page mode and NUMA policy are applied to, or
+// reported as not applied to, every mapping.  Note that the availability of
+// huge pages and NUMA nodes depends on the system running the test, so that
+// the test only verifies the effect of the policies that were reported as
+// applied.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] HugePageAllocator(PageMode pageMode, Allocator *basicAllocator);
+// [ 2] HugePageAllocator(PageMode, NumaPolicy, Uint64 mask, Allocator *);
+// [ 2] ~HugePageAllocator();
+//
+// MANIPULATORS
+// [ 3] void *allocate(bsls::Types::size_type size);
+// [ 3] void deallocate(void *address);
+// [ 4] void *allocate(bsls::Types::size_type size);
+// [ 4] void deallocate(void *address);
+//
+// ACCESSORS
+// [ 3] bsls::Types::Int64 numBytesMapped() const;
+// [ 5] bsls::Types::Int64 numHugePageFallbacks() const;
+// [ 5] bsls::Types::Int64 numNumaPolicyFailures() const;
+// [ 2] NumaPolicy numaPolicy() const;
+// [ 2] bsls::Types::Uint64 numaNodeMask() const;
+// [ 2] PageMode pageMode() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] USAGE EXAMPLE
+// [ 5] CONCERN: The page mode and NUMA policy apply to every mapping.
+// [ 6] CONCERN: The 'allocate' and 'deallocate' methods are thread-safe.
+// [ *] CONCERN: In no case does memory come from the global allocator.
+
+// ============================================================================
+//                    STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL VARIABLES / TYPEDEFS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bdlma::HugePageAllocator Obj;
+typedef bsls::Types::Int64       Int64;
+typedef bsls::Types::UintPtr     UintPtr;
+
+static const Int64 HUGE_PAGE_SIZE = Obj::k_HUGE_PAGE_SIZE;
+static const Int64 MAX_SHARED     = Obj::k_HUGE_PAGE_SIZE / 4;
+
+static const int MAX_ALIGN = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+
+// ============================================================================
+//                  HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static
+bool isAligned(const void *address, Int64 alignment)
+    // Return 'true' if the specified 'address' is aligned to the specified
+    // 'alignment', and 'false' otherwise.
+{
+    return 0 == reinterpret_cast<UintPtr>(address) % alignment;
+}
+
+static
+void fillAndVerify(void *address, Int64 size, char value)
+    // Fill the specified 'size' bytes at the specified 'address' with the
+    // specified 'value', and verify that every byte was written.
+{
+    char *begin = static_cast<char *>(address);
+    bsl::memset(begin, value, static_cast<bsl::size_t>(size));
+    for (Int64 i = 0; i < size; i += 997) {
+        ASSERTV(i, value == begin[i]);
+    }
+    ASSERT(value == begin[size - 1]);
+}
+
+static
+int numaPolicyOf(void *address)
+    // Return the NUMA policy ('MPOL_*' value) of the page at the specified
+    // 'address', or -1 if it can not be determined.
+{
+#if defined(BSLS_PLATFORM_OS_LINUX) && defined(SYS_get_mempolicy)
+    int           mode = -1;
+    unsigned long mask[64] = { 0 };
+
+    const int k_MPOL_F_ADDR = 1 << 1;
+
+    if (0 != syscall(SYS_get_mempolicy,
+                     &mode,
+                     mask,
+                     sizeof mask * 8 + 1,
+                     address,
+                     k_MPOL_F_ADDR)) {
+        return -1;                                                    // RETURN
+    }
+    return mode;
+#else
+    (void)address;
+    return -1;
+#endif
+}
+
+namespace TestCase6 {
+
+struct ThreadArgs {
+    // This 'struct' provides the arguments to 'allocateAndVerify'.
+
+    Obj *d_obj_p;  // allocator under test
+    int  d_id;     // distinct identifier of the thread
+};
+
+extern "C" void *allocateAndVerify(void *arg)
+    // Allocate blocks of varying sizes from the allocator indicated by the
+    // specified 'arg', referring to a 'ThreadArgs' object, fill each block
+    // with the identifier of the thread, then verify and deallocate them.
+{
+    ThreadArgs *args = static_cast<ThreadArgs *>(arg);
+    Obj        *obj  = args->d_obj_p;
+    const int   id   = args->d_id;
+
+    static const Int64 SIZES[] = { 1, 100, 4000, 64 * 1024, 300 * 1024,
+                                   600 * 1024, 3 * 1024 * 1024 };
+    const int NUM_SIZES = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+    enum { k_NUM_BLOCKS = 3 * NUM_SIZES };
+
+    char  *blocks[k_NUM_BLOCKS];
+    Int64  sizes[k_NUM_BLOCKS];
+
+    for (int round = 0; round < 20; ++round) {
+        for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+            sizes[i]  = SIZES[(i + id + round) % NUM_SIZES];
+            blocks[i] = static_cast<char *>(obj->allocate(sizes[i]));
+            bsl::memset(blocks[i], id, static_cast<bsl::size_t>(sizes[i]));
+        }
+
+        for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+            const char *p = blocks[i];
+            if (id != p[0] || id != p[sizes[i] - 1]) {
+                ASSERTV(id, i, sizes[i], !"Block overwritten");
+            }
+            obj->deallocate(blocks[i]);
+        }
+    }
+    return 0;
+}
+
+}  // close namespace TestCase6
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace Usage {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Backing an Arena by Huge Pages
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose that we build a large, read-mostly table of order records in
+// memory, using an arena allocator that obtains its memory in large chunks.
+// Lookups into the table touch memory at random, so that with standard pages
+// most of them miss the TLB.
+//
+// First, we define the record stored in the table:
+//..
+    struct OrderRecord {
+        bsls::Types::Int64 d_orderId;
+        double             d_price;
+        int                d_quantity;
+    };
+//..
+
+}  // close namespace Usage
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)     veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator         defaultAllocator("default",
+                                                  veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        using namespace Usage;
+
+// Then, we create a huge-page allocator that places its memory on the NUMA
+// node 0, on which (we assume) the threads using the table run:
+//..
+    typedef bdlma::HugePageAllocator HPA;
+
+    HPA hugePageAllocator(HPA::e_TRANSPARENT_HUGE_PAGES,
+                          HPA::e_NUMA_BIND,
+                          1);  // node mask designating node 0
+//..
+// Next, we create the arena allocator, supplying the huge-page allocator as
+// its upstream allocator.  Once the arena grows past its initial chunks, each
+// chunk it obtains is a dedicated mapping of one or more huge pages:
+//..
+    bdlma::SequentialAllocator arena(&hugePageAllocator);
+//..
+// Then, we create our table, using the arena:
+//..
+    bsl::vector<OrderRecord *> table(&arena);
+
+    for (int i = 0; i < 100000; ++i) {
+        OrderRecord *record = new (arena) OrderRecord();
+        record->d_orderId  = i;
+        record->d_price    = 100.0 + i % 100;
+        record->d_quantity = i % 1000;
+        table.push_back(record);
+    }
+//..
+// Finally, we observe that the memory of the table was mapped by the
+// huge-page allocator:
+//..
+    ASSERT(0 < hugePageAllocator.numBytesMapped());
+//..
+// Note that whether the memory is actually backed by huge pages, and placed
+// on node 0, depends on the configuration of the system; the
+// 'numHugePageFallbacks' and 'numNumaPolicyFailures' accessors report the
+// mappings for which either request could not be honored.
+
+        if (veryVerbose) {
+            P_(hugePageAllocator.numBytesMapped());
+            P_(hugePageAllocator.numHugePageFallbacks());
+            P(hugePageAllocator.numNumaPolicyFailures());
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY TEST
+        //
+        // Concerns:
+        //: 1 Concurrent calls to 'allocate' and 'deallocate', for blocks
+        //:   carved from shared regions and for dedicated mappings, never
+        //:   return a block in use.
+        //:
+        //: 2 Once every block is deallocated, at most one shared region
+        //:   remains mapped.
+        //
+        // Plan:
+        //: 1 In several threads, allocate blocks of varying sizes, fill each
+        //:   block with a value distinct to the thread, then verify the
+        //:   contents of every block and deallocate it.  (C-1)
+        //:
+        //: 2 Verify 'numBytesMapped' once the threads are joined.  (C-2)
+        //
+        // Testing:
+        //   CONCERN: The 'allocate' and 'deallocate' methods are thread-safe.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY TEST" << endl
+                          << "================" << endl;
+
+        enum { k_NUM_THREADS = 8 };
+
+        Obj mX;  const Obj& X = mX;
+
+        bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+        TestCase6::ThreadArgs     args[k_NUM_THREADS];
+
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            args[i].d_obj_p = &mX;
+            args[i].d_id    = i + 1;
+            ASSERT(0 == bslmt::ThreadUtil::create(
+                                              &handles[i],
+                                              &TestCase6::allocateAndVerify,
+                                              &args[i]));
+        }
+        for (int i = 0; i < k_NUM_THREADS; ++i) {
+            bslmt::ThreadUtil::join(handles[i]);
+        }
+
+        ASSERTV(X.numBytesMapped(), HUGE_PAGE_SIZE >= X.numBytesMapped());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // PAGE MODES AND NUMA POLICIES
+        //
+        // Concerns:
+        //: 1 In every page mode and NUMA policy, the memory mapped is usable.
+        //:
+        //: 2 A mapping for which huge pages were requested, but not obtained,
+        //:   is counted once by 'numHugePageFallbacks', and no mapping is
+        //:   counted in 'e_STANDARD_PAGES' mode.
+        //:
+        //: 3 A mapping to which the NUMA policy could not be applied is
+        //:   counted by 'numNumaPolicyFailures', and no mapping is counted
+        //:   for 'e_NUMA_DEFAULT'.
+        //:
+        //: 4 A NUMA policy that was applied is in effect for the memory
+        //:   mapped.
+        //
+        // Plan:
+        //: 1 For every page mode and NUMA policy, allocate and fill a block
+        //:   carved from a shared region and a dedicated block, and verify
+        //:   the counts of fallbacks and failures against the number of
+        //:   mappings.  (C-1..3)
+        //:
+        //: 2 On Linux, if the NUMA policy was applied to every mapping,
+        //:   verify the policy of the blocks using 'get_mempolicy'.  (C-4)
+        //
+        // Testing:
+        //   bsls::Types::Int64 numHugePageFallbacks() const;
+        //   bsls::Types::Int64 numNumaPolicyFailures() const;
+        //   CONCERN: The page mode and NUMA policy apply to every mapping.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PAGE MODES AND NUMA POLICIES" << endl
+                          << "============================" << endl;
+
+        const Obj::PageMode MODES[] = { Obj::e_STANDARD_PAGES,
+                                        Obj::e_TRANSPARENT_HUGE_PAGES,
+                                        Obj::e_EXPLICIT_HUGE_PAGES };
+        const int NUM_MODES = static_cast<int>(sizeof MODES / sizeof *MODES);
+
+        const struct {
+            int                 d_line;
+            Obj::NumaPolicy     d_policy;
+            bsls::Types::Uint64 d_mask;
+            int                 d_mpol;    // expected 'MPOL_*' value
+        } DATA[] = {
+            //LINE  POLICY                  MASK  MPOL
+            //----  ----------------------  ----  ----
+            { L_,   Obj::e_NUMA_DEFAULT,       0,   -1 },
+            { L_,   Obj::e_NUMA_BIND,          1,    2 },
+            { L_,   Obj::e_NUMA_INTERLEAVE,    0,    3 },
+            { L_,   Obj::e_NUMA_INTERLEAVE,    1,    3 },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int mi = 0; mi < NUM_MODES; ++mi) {
+            const Obj::PageMode MODE = MODES[mi];
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int                 LINE   = DATA[ti].d_line;
+                const Obj::NumaPolicy     POLICY = DATA[ti].d_policy;
+                const bsls::Types::Uint64 MASK   = DATA[ti].d_mask;
+                const int                 MPOL   = DATA[ti].d_mpol;
+
+                Obj mX(MODE, POLICY, MASK);  const Obj& X = mX;
+
+                void *small = mX.allocate(1000);
+                void *large = mX.allocate(5 * 1024 * 1024);
+
+                const Int64 NUM_MAPPINGS = 2;
+
+                fillAndVerify(small, 1000, 'a');
+                fillAndVerify(large, 5 * 1024 * 1024, 'b');
+
+                if (veryVerbose) {
+                    T_ P_(LINE) P_(MODE) P_(X.numHugePageFallbacks())
+                    P(X.numNumaPolicyFailures())
+                }
+
+                ASSERTV(LINE, MODE, 0 <= X.numHugePageFallbacks());
+                ASSERTV(LINE, MODE, NUM_MAPPINGS >= X.numHugePageFallbacks());
+                if (Obj::e_STANDARD_PAGES == MODE) {
+                    ASSERTV(LINE, 0 == X.numHugePageFallbacks());
+                }
+
+                ASSERTV(LINE, MODE, 0 <= X.numNumaPolicyFailures());
+                ASSERTV(LINE, MODE, NUM_MAPPINGS >= X.numNumaPolicyFailures());
+                if (Obj::e_NUMA_DEFAULT == POLICY) {
+                    ASSERTV(LINE, 0 == X.numNumaPolicyFailures());
+                }
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+                if (Obj::e_NUMA_DEFAULT != POLICY
+                 && 0 == X.numNumaPolicyFailures()) {
+                    ASSERTV(LINE, MODE, numaPolicyOf(small),
+                            MPOL == numaPolicyOf(small));
+                    ASSERTV(LINE, MODE, numaPolicyOf(large),
+                            MPOL == numaPolicyOf(large));
+                }
+#else
+                (void)MPOL;
+                (void)numaPolicyOf;
+#endif
+
+                mX.deallocate(large);
+                mX.deallocate(small);
+            }
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // DEDICATED MAPPINGS
+        //
+        // Concerns:
+        //: 1 A request for more than a quarter of 'k_HUGE_PAGE_SIZE' is
+        //:   satisfied by a dedicated mapping of the request rounded up to a
+        //:   multiple of 'k_HUGE_PAGE_SIZE' in the huge page modes, and of
+        //:   the system page size in 'e_STANDARD_PAGES' mode.
+        //:
+        //: 2 A dedicated block is aligned to 'k_HUGE_PAGE_SIZE' in the huge
+        //:   page modes.
+        //:
+        //: 3 A dedicated mapping is returned to the system on deallocation.
+        //
+        // Plan:
+        //: 1 For sizes around the threshold and around multiples of the huge
+        //:   page size, allocate a block, fill it, and verify its alignment
+        //:   and the change in 'numBytesMapped'.  (C-1..2)
+        //:
+        //: 2 Deallocate the block, and verify 'numBytesMapped'.  (C-3)
+        //
+        // Testing:
+        //   void *allocate(bsls::Types::size_type size);
+        //   void deallocate(void *address);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "DEDICATED MAPPINGS" << endl
+                          << "==================" << endl;
+
+        const Int64 SIZES[] = {
+            MAX_SHARED + 1,
+            HUGE_PAGE_SIZE - 1,
+            HUGE_PAGE_SIZE,
+            HUGE_PAGE_SIZE + 1,
+            3 * HUGE_PAGE_SIZE + 100,
+            16 * HUGE_PAGE_SIZE
+        };
+        const int NUM_SIZES = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+        for (int mode = 0; mode < 2; ++mode) {
+            const Obj::PageMode MODE = 0 == mode
+                                     ? Obj::e_STANDARD_PAGES
+                                     : Obj::e_TRANSPARENT_HUGE_PAGES;
+
+            const Int64 PAGE_SIZE = Obj::e_STANDARD_PAGES == MODE
+                                  ? 4096
+                                  : HUGE_PAGE_SIZE;
+
+            Obj mX(MODE);  const Obj& X = mX;
+
+            for (int ti = 0; ti < NUM_SIZES; ++ti) {
+                const Int64 SIZE = SIZES[ti];
+                const Int64 EXP  = (SIZE + PAGE_SIZE - 1) / PAGE_SIZE
+                                                                  * PAGE_SIZE;
+
+                if (veryVerbose) { T_ P_(MODE) P_(SIZE) P(EXP) }
+
+                void *p = mX.allocate(SIZE);
+
+                ASSERTV(MODE, SIZE, isAligned(p, PAGE_SIZE));
+                ASSERTV(MODE, SIZE, EXP, X.numBytesMapped(),
+                        EXP == X.numBytesMapped());
+
+                fillAndVerify(p, SIZE, 'x');
+
+                mX.deallocate(p);
+                ASSERTV(MODE, SIZE, 0 == X.numBytesMapped());
+            }
+
+            // Several dedicated mappings are independent.
+
+            void *p1 = mX.allocate(MAX_SHARED + 1);
+            void *p2 = mX.allocate(2 * HUGE_PAGE_SIZE);
+            void *p3 = mX.allocate(MAX_SHARED + 1);
+
+            fillAndVerify(p1, MAX_SHARED + 1, '1');
+            fillAndVerify(p2, 2 * HUGE_PAGE_SIZE, '2');
+            fillAndVerify(p3, MAX_SHARED + 1, '3');
+
+            mX.deallocate(p2);
+            ASSERTV(MODE, '1' == *static_cast<char *>(p1));
+            ASSERTV(MODE, '3' == *static_cast<char *>(p3));
+
+            mX.deallocate(p1);
+            mX.deallocate(p3);
+            ASSERTV(MODE, 0 == X.numBytesMapped());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // SHARED REGIONS
+        //
+        // Concerns:
+        //: 1 'allocate' returns, for a request of at most a quarter of
+        //:   'k_HUGE_PAGE_SIZE', a maximally-aligned block of at least the
+        //:   requested size, carved from a shared region, and distinct from
+        //:   every block in use.
+        //:
+        //: 2 'allocate(0)' returns 0, and 'deallocate(0)' has no effect.
+        //:
+        //: 3 The current region is reused once all of its blocks are
+        //:   deallocated.
+        //:
+        //: 4 A region that is not current is returned to the system once all
+        //:   of its blocks are deallocated, and a new region replaces a
+        //:   current region having no blocks.
+        //
+        // Plan:
+        //: 1 Allocate blocks of many sizes, fill them, and verify their
+        //:   alignment, that they do not overlap, and that one region is
+        //:   mapped.  (C-1)
+        //:
+        //: 2 Verify 'allocate(0)' and 'deallocate(0)' directly.  (C-2)
+        //:
+        //: 3 Deallocate every block, and verify that the next allocation
+        //:   reuses the region.  (C-3)
+        //:
+        //: 4 Allocate blocks until a second region is mapped, deallocate the
+        //:   blocks of the first region, and verify 'numBytesMapped'.  (C-4)
+        //
+        // Testing:
+        //   void *allocate(bsls::Types::size_type size);
+        //   void deallocate(void *address);
+        //   bsls::Types::Int64 numBytesMapped() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SHARED REGIONS" << endl
+                          << "==============" << endl;
+
+        if (verbose) cout << "\nTesting sizes and alignment." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(0 == X.numBytesMapped());
+
+            bsl::vector<char *> blocks;
+            bsl::vector<int>    sizes;
+
+            for (int size = 1; size <= 2000; size += 7) {
+                char *p = static_cast<char *>(mX.allocate(size));
+
+                ASSERTV(size, isAligned(p, MAX_ALIGN));
+                ASSERTV(size, HUGE_PAGE_SIZE == X.numBytesMapped());
+
+                bsl::memset(p, size & 0xff, size);
+
+                for (bsl::size_t i = 0; i < blocks.size(); ++i) {
+                    ASSERTV(size, i, p + size <= blocks[i]
+                                  || blocks[i] + sizes[i] <= p);
+                }
+                blocks.push_back(p);
+                sizes.push_back(size);
+            }
+
+            char *p = static_cast<char *>(mX.allocate(MAX_SHARED));
+            ASSERT(isAligned(p, MAX_ALIGN));
+            bsl::memset(p, 0x7f, static_cast<bsl::size_t>(MAX_SHARED));
+            ASSERT(HUGE_PAGE_SIZE == X.numBytesMapped());
+
+            for (bsl::size_t i = 0; i < blocks.size(); ++i) {
+                for (int j = 0; j < sizes[i]; ++j) {
+                    if ((sizes[i] & 0xff) != (blocks[i][j] & 0xff)) {
+                        ASSERTV(i, j, !"Block overwritten");
+                        break;
+                    }
+                }
+                mX.deallocate(blocks[i]);
+            }
+            mX.deallocate(p);
+
+            ASSERT(HUGE_PAGE_SIZE == X.numBytesMapped());
+        }
+
+        if (verbose) cout << "\nTesting 'allocate(0)' and 'deallocate(0)'."
+                          << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(0 == mX.allocate(0));
+            mX.deallocate(0);
+
+            ASSERT(0 == X.numBytesMapped());
+        }
+
+        if (verbose) cout << "\nTesting region reuse." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+
+            void *p = mX.allocate(100);
+            mX.deallocate(p);
+
+            void *q = mX.allocate(100);
+            ASSERTV(p, q, p == q);
+            ASSERT(HUGE_PAGE_SIZE == X.numBytesMapped());
+
+            mX.deallocate(q);
+        }
+
+        if (verbose) cout << "\nTesting region retirement." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+
+            // Fill the first region with four blocks of 'MAX_SHARED' minus
+            // the region header, so that a fifth block requires a second
+            // region.
+
+            const Int64 SIZE = MAX_SHARED - 64;
+
+            void *first[4];
+            for (int i = 0; i < 4; ++i) {
+                first[i] = mX.allocate(SIZE);
+            }
+            ASSERT(HUGE_PAGE_SIZE == X.numBytesMapped());
+
+            void *second = mX.allocate(SIZE);
+            ASSERT(2 * HUGE_PAGE_SIZE == X.numBytesMapped());
+
+            for (int i = 0; i < 4; ++i) {
+                ASSERTV(i, 2 * HUGE_PAGE_SIZE == X.numBytesMapped());
+                mX.deallocate(first[i]);
+            }
+            ASSERT(HUGE_PAGE_SIZE == X.numBytesMapped());
+
+            // The current region, once it has no blocks, is reused from its
+            // beginning.
+
+            mX.deallocate(second);
+            ASSERT(HUGE_PAGE_SIZE == X.numBytesMapped());
+
+            void *third = mX.allocate(SIZE);
+            ASSERTV(second, third, second == third);
+            ASSERT(HUGE_PAGE_SIZE == X.numBytesMapped());
+
+            mX.deallocate(third);
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 The default constructor creates an allocator mapping transparent
+        //:   huge pages with the default NUMA policy.
+        //:
+        //: 2 The other constructor creates an allocator having the specified
+        //:   page mode, NUMA policy, and node mask.
+        //:
+        //: 3 Memory for bookkeeping is obtained from the allocator supplied at
+        //:   construction, or the default allocator if none is supplied.
+        //:
+        //: 4 The destructor returns all mapped memory to the system, and all
+        //:   bookkeeping memory to its allocator, even if blocks remain
+        //:   allocated.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create allocators with every constructor, and verify the
+        //:   accessors.  (C-1..2)
+        //:
+        //: 2 Allocate dedicated blocks with and without a supplied allocator,
+        //:   and verify the source of the bookkeeping memory.  (C-3)
+        //:
+        //: 3 Destroy allocators having outstanding blocks, and verify that
+        //:   no bookkeeping memory remains in use.  (C-4)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   HugePageAllocator(PageMode pageMode, Allocator *basicAllocator);
+        //   HugePageAllocator(PageMode, NumaPolicy, Uint64 mask, Allocator *);
+        //   ~HugePageAllocator();
+        //   NumaPolicy numaPolicy() const;
+        //   bsls::Types::Uint64 numaNodeMask() const;
+        //   PageMode pageMode() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND BASIC ACCESSORS" << endl
+                          << "============================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(Obj::e_TRANSPARENT_HUGE_PAGES == X.pageMode());
+            ASSERT(Obj::e_NUMA_DEFAULT           == X.numaPolicy());
+            ASSERT(0                             == X.numaNodeMask());
+            ASSERT(0                             == X.numBytesMapped());
+            ASSERT(0                             == X.numHugePageFallbacks());
+            ASSERT(0                             == X.numNumaPolicyFailures());
+
+            mX.allocate(HUGE_PAGE_SIZE);
+            ASSERT(0 < defaultAllocator.numBlocksInUse());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+        {
+            Obj mX(Obj::e_STANDARD_PAGES, &oa);  const Obj& X = mX;
+
+            ASSERT(Obj::e_STANDARD_PAGES == X.pageMode());
+            ASSERT(Obj::e_NUMA_DEFAULT   == X.numaPolicy());
+            ASSERT(0                     == X.numaNodeMask());
+
+            mX.allocate(HUGE_PAGE_SIZE);
+            mX.allocate(10);
+            ASSERT(0 <  oa.numBlocksInUse());
+            ASSERT(0 == defaultAllocator.numBlocksInUse());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        {
+            Obj mX(Obj::e_EXPLICIT_HUGE_PAGES, Obj::e_NUMA_INTERLEAVE, 5, &oa);
+            const Obj& X = mX;
+
+            ASSERT(Obj::e_EXPLICIT_HUGE_PAGES == X.pageMode());
+            ASSERT(Obj::e_NUMA_INTERLEAVE     == X.numaPolicy());
+            ASSERT(5                          == X.numaNodeMask());
+
+            mX.allocate(3 * HUGE_PAGE_SIZE);
+            ASSERT(0 <  oa.numBlocksInUse());
+            ASSERT(0 == defaultAllocator.numBlocksInUse());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        {
+            Obj mX(Obj::e_TRANSPARENT_HUGE_PAGES, Obj::e_NUMA_BIND, 1);
+            const Obj& X = mX;
+
+            ASSERT(Obj::e_TRANSPARENT_HUGE_PAGES == X.pageMode());
+            ASSERT(Obj::e_NUMA_BIND              == X.numaPolicy());
+            ASSERT(1                             == X.numaNodeMask());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(Obj(Obj::e_STANDARD_PAGES, Obj::e_NUMA_BIND, 1));
+            ASSERT_PASS(Obj(Obj::e_STANDARD_PAGES, Obj::e_NUMA_INTERLEAVE, 0));
+            ASSERT_PASS(Obj(Obj::e_STANDARD_PAGES, Obj::e_NUMA_DEFAULT, 0));
+            ASSERT_FAIL(Obj(Obj::e_STANDARD_PAGES, Obj::e_NUMA_BIND, 0));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Allocate and deallocate small and large blocks, and verify that
+        //:   they are usable and that the memory mapped is returned.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj mX;  const Obj& X = mX;
+
+        void *p1 = mX.allocate(1);
+        void *p2 = mX.allocate(1000);
+        void *p3 = mX.allocate(10 * 1024 * 1024);
+
+        fillAndVerify(p1, 1, 'a');
+        fillAndVerify(p2, 1000, 'b');
+        fillAndVerify(p3, 10 * 1024 * 1024, 'c');
+
+        ASSERT(p1 != p2);
+        ASSERT(HUGE_PAGE_SIZE + 10 * 1024 * 1024 == X.numBytesMapped());
+
+        mX.deallocate(p3);
+        ASSERT(HUGE_PAGE_SIZE == X.numBytesMapped());
+
+        mX.deallocate(p2);
+        mX.deallocate(p1);
+        ASSERT(HUGE_PAGE_SIZE == X.numBytesMapped());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------------------------------------------------------
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,365 @@
+// bdlma_sizeclassmultipoolallocator.cpp                              -*-C++-*-
+#include <bdlma_sizeclassmultipoolallocator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlma_sizeclassmultipoolallocator_cpp,"$Id$ $CSID$")
+
+#include <bdlb_bitutil.h>
+
+#include <bslma_autodestructor.h>
+#include <bslma_deallocatorproctor.h>
+#include <bslma_default.h>
+
+#include <bsls_performancehint.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstring.h>
+#include <bsl_new.h>
+
+namespace BloombergLP {
+namespace bdlma {
+
+namespace {
+
+// TYPES
+enum {
+    k_DEFAULT_CLASSES_PER_DOUBLING = 4,     // default number of classes per
+                                            // doubling
+
+    k_MAX_CLASSES_PER_DOUBLING     = 16,    // largest number of classes per
+                                            // doubling
+
+    k_DEFAULT_MAX_BLOCK_SIZE       = 4096,  // default largest pooled size
+
+    k_DEFAULT_MAX_CHUNK_SIZE       = 32,    // default maximum number of
+                                            // blocks per chunk
+
+    k_MAX_LOOKUP_SIZE              = 4096,  // largest size found in the
+                                            // lookup table
+
+    k_QUANTUM = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT
+                                            // spacing of the smallest classes
+};
+
+const bsls::Types::size_type k_MAX_MAX_BLOCK_SIZE = 1 << 30;
+    // largest value of 'maxPooledBlockSize' supported
+
+template <int VALUE>
+struct Log2 {
+    // This 'struct' provides the base-2 logarithm of the specified 'VALUE',
+    // which must be a power of two.
+
+    enum { value = 1 + Log2<VALUE / 2>::value };
+};
+
+template <>
+struct Log2<1> {
+    enum { value = 0 };
+};
+
+const int k_LOG2_QUANTUM = Log2<k_QUANTUM>::value;
+
+}  // close unnamed namespace
+
+                     // ---------------------------------
+                     // class SizeClassMultipoolAllocator
+                     // ---------------------------------
+
+// PRIVATE MANIPULATORS
+void SizeClassMultipoolAllocator::initialize(
+                            int                          numClassesPerDoubling,
+                            bsls::Types::size_type       maxPooledBlockSize,
+                            bsls::BlockGrowth::Strategy  growthStrategy,
+                            int                          maxBlocksPerChunk)
+{
+    BSLS_ASSERT(1 <= numClassesPerDoubling);
+    BSLS_ASSERT(numClassesPerDoubling <= k_MAX_CLASSES_PER_DOUBLING);
+    BSLS_ASSERT(0 == (numClassesPerDoubling & (numClassesPerDoubling - 1)));
+    BSLS_ASSERT(1 <= maxPooledBlockSize);
+    BSLS_ASSERT(maxPooledBlockSize <= k_MAX_MAX_BLOCK_SIZE);
+    BSLS_ASSERT(1 <= maxBlocksPerChunk);
+
+    d_log2ClassesPerDoubling = bdlb::BitUtil::numTrailingUnsetBits(
+                          static_cast<bsl::uint32_t>(numClassesPerDoubling));
+
+    d_numClasses    = computeClassIndex(maxPooledBlockSize) + 1;
+    d_maxBlockSize  = computeClassSize(d_numClasses - 1);
+    d_maxLookupSize = bsl::min<bsls::Types::size_type>(d_maxBlockSize,
+                                                       k_MAX_LOOKUP_SIZE);
+
+    // Build the lookup table.  The class of every size in the range
+    // '((i - 1) * k_QUANTUM, i * k_QUANTUM]' is that of 'i * k_QUANTUM', as
+    // the size of every class is a multiple of 'k_QUANTUM'.
+
+    const int numEntries = static_cast<int>(d_maxLookupSize / k_QUANTUM) + 1;
+
+    d_sizeToClass_p = static_cast<unsigned char *>(
+                                        d_allocator_p->allocate(numEntries));
+
+    bslma::DeallocatorProctor<bslma::Allocator> autoTableDeallocator(
+                                                               d_sizeToClass_p,
+                                                               d_allocator_p);
+
+    d_sizeToClass_p[0] = 0;
+    for (int i = 1; i < numEntries; ++i) {
+        const int index = computeClassIndex(i * k_QUANTUM);
+
+        BSLS_ASSERT(index <= 255);
+
+        d_sizeToClass_p[i] = static_cast<unsigned char>(index);
+    }
+
+    d_statistics_p = static_cast<ClassStatistics *>(
+                        d_allocator_p->allocate((d_numClasses + 1)
+                                                * sizeof *d_statistics_p));
+
+    bslma::DeallocatorProctor<bslma::Allocator> autoStatisticsDeallocator(
+                                                                d_statistics_p,
+                                                                d_allocator_p);
+
+    bsl::memset(d_statistics_p,
+                0,
+                (d_numClasses + 1) * sizeof *d_statistics_p);
+
+    d_pools_p = static_cast<Pool *>(
+                    d_allocator_p->allocate(d_numClasses * sizeof *d_pools_p));
+
+    bslma::DeallocatorProctor<bslma::Allocator> autoPoolsDeallocator(
+                                                                d_pools_p,
+                                                                d_allocator_p);
+    bslma::AutoDestructor<Pool> autoDtor(d_pools_p, 0);
+
+    for (int i = 0; i < d_numClasses; ++i, ++autoDtor) {
+        new (d_pools_p + i) Pool(computeClassSize(i) + sizeof(Header),
+                                 growthStrategy,
+                                 maxBlocksPerChunk,
+                                 d_allocator_p);
+    }
+
+    autoDtor.release();
+    autoPoolsDeallocator.release();
+    autoStatisticsDeallocator.release();
+    autoTableDeallocator.release();
+}
+
+// PRIVATE ACCESSORS
+int SizeClassMultipoolAllocator::computeClassIndex(
+                                            bsls::Types::size_type size) const
+{
+    BSLS_ASSERT(1 <= size);
+
+    const int log2Base = d_log2ClassesPerDoubling + k_LOG2_QUANTUM;
+
+    const bsl::uint64_t last = static_cast<bsl::uint64_t>(size) - 1;
+
+    if (last < (static_cast<bsl::uint64_t>(1) << log2Base)) {
+        // The first classes are spaced by the quantum.
+
+        return static_cast<int>(last >> k_LOG2_QUANTUM);              // RETURN
+    }
+
+    // The doubling '(2^h, 2^(h+1)]' containing 'size' is divided into classes
+    // spaced '2^(h - d_log2ClassesPerDoubling)' bytes apart, and follows
+    // 'h - log2Base' doublings of 'numClassesPerDoubling()' classes each.
+
+    const int h     = 63 - bdlb::BitUtil::numLeadingUnsetBits(last);
+    const int shift = h - d_log2ClassesPerDoubling;
+
+    return ((h - log2Base) << d_log2ClassesPerDoubling)
+                                          + static_cast<int>(last >> shift);
+}
+
+bsls::Types::size_type SizeClassMultipoolAllocator::computeClassSize(
+                                                          int classIndex) const
+{
+    BSLS_ASSERT(0 <= classIndex);
+
+    const int numClassesPerDoubling = 1 << d_log2ClassesPerDoubling;
+
+    if (classIndex < numClassesPerDoubling) {
+        return (classIndex + 1) * k_QUANTUM;                          // RETURN
+    }
+
+    const int doubling = (classIndex - numClassesPerDoubling)
+                                                   >> d_log2ClassesPerDoubling;
+    const int position = classIndex & (numClassesPerDoubling - 1);
+
+    const bsls::Types::size_type base =
+             static_cast<bsls::Types::size_type>(numClassesPerDoubling)
+                                                       * k_QUANTUM << doubling;
+
+    return base + (position + 1) * (base >> d_log2ClassesPerDoubling);
+}
+
+// CREATORS
+SizeClassMultipoolAllocator::SizeClassMultipoolAllocator(
+                                              bslma::Allocator *basicAllocator)
+: d_blockList(basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    initialize(k_DEFAULT_CLASSES_PER_DOUBLING,
+               k_DEFAULT_MAX_BLOCK_SIZE,
+               bsls::BlockGrowth::BSLS_GEOMETRIC,
+               k_DEFAULT_MAX_CHUNK_SIZE);
+}
+
+SizeClassMultipoolAllocator::SizeClassMultipoolAllocator(
+                                       int               numClassesPerDoubling,
+                                       bslma::Allocator *basicAllocator)
+: d_blockList(basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    initialize(numClassesPerDoubling,
+               k_DEFAULT_MAX_BLOCK_SIZE,
+               bsls::BlockGrowth::BSLS_GEOMETRIC,
+               k_DEFAULT_MAX_CHUNK_SIZE);
+}
+
+SizeClassMultipoolAllocator::SizeClassMultipoolAllocator(
+                                 int                     numClassesPerDoubling,
+                                 bsls::Types::size_type  maxPooledBlockSize,
+                                 bslma::Allocator       *basicAllocator)
+: d_blockList(basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    initialize(numClassesPerDoubling,
+               maxPooledBlockSize,
+               bsls::BlockGrowth::BSLS_GEOMETRIC,
+               k_DEFAULT_MAX_CHUNK_SIZE);
+}
+
+SizeClassMultipoolAllocator::SizeClassMultipoolAllocator(
+                          int                          numClassesPerDoubling,
+                          bsls::Types::size_type       maxPooledBlockSize,
+                          bsls::BlockGrowth::Strategy  growthStrategy,
+                          int                          maxBlocksPerChunk,
+                          bslma::Allocator            *basicAllocator)
+: d_blockList(basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    initialize(numClassesPerDoubling,
+               maxPooledBlockSize,
+               growthStrategy,
+               maxBlocksPerChunk);
+}
+
+SizeClassMultipoolAllocator::~SizeClassMultipoolAllocator()
+{
+    BSLS_ASSERT(d_pools_p);
+    BSLS_ASSERT(d_statistics_p);
+    BSLS_ASSERT(d_sizeToClass_p);
+    BSLS_ASSERT(1 <= d_numClasses);
+    BSLS_ASSERT(d_allocator_p);
+
+    d_blockList.release();
+    for (int i = 0; i < d_numClasses; ++i) {
+        d_pools_p[i].release();
+        d_pools_p[i].~Pool();
+    }
+    d_allocator_p->deallocate(d_pools_p);
+    d_allocator_p->deallocate(d_statistics_p);
+    d_allocator_p->deallocate(d_sizeToClass_p);
+}
+
+// MANIPULATORS
+void *SizeClassMultipoolAllocator::allocate(bsls::Types::size_type size)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == size)) {
+        return 0;                                                     // RETURN
+    }
+
+    const int index = classIndex(size);
+
+    Header *p;
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(index < d_numClasses)) {
+        p = static_cast<Header *>(d_pools_p[index].allocate());
+    }
+    else {
+        // The requested size is large and will not be pooled.
+
+        p = static_cast<Header *>(d_blockList.allocate(size
+                                                            + sizeof(Header)));
+    }
+
+    p->d_header.d_info.d_size     = size;
+    p->d_header.d_info.d_classIdx = index;
+
+    ClassStatistics& statistics = d_statistics_p[index];
+
+    ++statistics.d_numRequests;
+    statistics.d_numBytesRequested += size;
+    ++statistics.d_numBlocksInUse;
+    statistics.d_numBytesInUse     += size;
+
+    return p + 1;
+}
+
+void SizeClassMultipoolAllocator::deallocate(void *address)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == address)) {
+        return;                                                       // RETURN
+    }
+
+    Header *h = static_cast<Header *>(address) - 1;
+
+    const int index = h->d_header.d_info.d_classIdx;
+
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index <= d_numClasses);
+
+    ClassStatistics& statistics = d_statistics_p[index];
+
+    --statistics.d_numBlocksInUse;
+    statistics.d_numBytesInUse -= h->d_header.d_info.d_size;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(index < d_numClasses)) {
+        d_pools_p[index].deallocate(h);
+    }
+    else {
+        d_blockList.deallocate(h);
+    }
+}
+
+void SizeClassMultipoolAllocator::release()
+{
+    for (int i = 0; i < d_numClasses; ++i) {
+        d_pools_p[i].release();
+    }
+    d_blockList.release();
+
+    for (int i = 0; i <= d_numClasses; ++i) {
+        d_statistics_p[i].d_numBlocksInUse = 0;
+        d_statistics_p[i].d_numBytesInUse  = 0;
+    }
+}
+
+void SizeClassMultipoolAllocator::reserveCapacity(
+                                           bsls::Types::size_type size,
+                                           int                    numBlocks)
+{
+    BSLS_ASSERT(size <= d_maxBlockSize);
+    BSLS_ASSERT(0    <= numBlocks);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(size)) {
+        d_pools_p[classIndex(size)].reserveCapacity(numBlocks);
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
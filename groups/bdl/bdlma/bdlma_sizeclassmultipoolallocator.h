@@ -0,0 +1,542 @@
+// bdlma_sizeclassmultipoolallocator.h                                -*-C++-*-
+#ifndef INCLUDED_BDLMA_SIZECLASSMULTIPOOLALLOCATOR
+#define INCLUDED_BDLMA_SIZECLASSMULTIPOOLALLOCATOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an allocator pooling memory in geometric size classes.
+//
+//@CLASSES:
+//  bdlma::SizeClassMultipoolAllocator: multipool allocator with size classes
+//
+//@SEE_ALSO: bdlma_multipoolallocator, bdlma_pool
+//
+//@DESCRIPTION: This component provides an allocator,
+// 'bdlma::SizeClassMultipoolAllocator', that implements the
+// 'bdlma::ManagedAllocator' protocol and, like 'bdlma::MultipoolAllocator',
+// dispenses memory from an array of 'bdlma::Pool' objects, each managing
+// maximally-aligned memory blocks of a unique size, or from a separately
+// managed list of memory blocks for requests too large to be pooled.  Unlike
+// 'bdlma::MultipoolAllocator', whose pools manage block sizes that are
+// successive powers of two, this allocator divides each doubling of the block
+// size into a configurable number of *size* *classes*, and keeps per-class
+// statistics of the memory requested from each class.
+//
+// The inheritance hierarchy for 'bdlma::SizeClassMultipoolAllocator' is as
+// follows:
+//..
+//   ,----------------------------------.
+//  ( bdlma::SizeClassMultipoolAllocator )
+//   `----------------------------------'
+//                   |       ctor/dtor
+//                   |       reserveCapacity
+//                   |       classIndex
+//                   |       classSize
+//                   |       maxPooledBlockSize
+//                   |       numClasses
+//                   |       numClassesPerDoubling
+//                   |       (statistics accessors)
+//                   V
+//       ,-----------------------.
+//      ( bdlma::ManagedAllocator )
+//       `-----------------------'
+//                   |       release
+//                   V
+//          ,----------------.
+//         ( bslma::Allocator )
+//          `----------------'
+//                           allocate
+//                           deallocate
+//..
+//
+///Size Classes
+///------------
+// Power-of-two pools waste up to half of every block: a request for 65 bytes
+// is satisfied from the pool of 128-byte blocks.  A
+// 'bdlma::SizeClassMultipoolAllocator' configured with 'K' classes per
+// doubling (where 'K' is a power of two not greater than 16) uses block sizes
+// that are multiples of the quantum 'Q', the maximal alignment of the
+// platform (16 bytes on typical 64-bit platforms):
+//: o The first 'K' classes have sizes 'Q', '2 * Q', ..., 'K * Q'.
+//:
+//: o Each following doubling, from 'B' to '2 * B' (starting from 'B = K * Q'),
+//:   is divided into 'K' classes whose sizes are spaced 'B / K' bytes apart.
+//
+// For example, with 'K = 4' and 'Q = 16', the classes up to 512 bytes have the
+// sizes:
+//..
+//  16  32  48  64  80  96  112  128  160  192  224  256  320  384  448  512
+//..
+// so that a request for 65 bytes is satisfied from an 80-byte block, and no
+// block exceeds the size requested by more than '100 / K' percent (beyond the
+// rounding to the quantum).  Specifying 'K = 1' yields power-of-two classes
+// like those of 'bdlma::MultipoolAllocator'.
+//
+// The class of a request is found in a lookup table for requests of up to 4096
+// bytes, and computed from the position of the most-significant bit of the
+// size for larger requests; neither path involves a search.  Every block also
+// carries a header of 'bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT' bytes, as do
+// the blocks of 'bdlma::MultipoolAllocator'.
+//
+///Configuration at Construction
+///-----------------------------
+// When creating a 'bdlma::SizeClassMultipoolAllocator', clients can optionally
+// configure:
+//
+//: 1 CLASSES PER DOUBLING -- the number of size classes in each doubling of
+//:   the block size (4 by default).
+//:
+//: 2 MAX POOLED BLOCK SIZE -- the size of the largest request to be pooled
+//:   (4096 bytes by default), rounded up to the size of a class.  Larger
+//:   requests are satisfied directly by the underlying allocator.
+//:
+//: 3 GROWTH STRATEGY and MAX BLOCKS PER CHUNK -- the replenishment policy of
+//:   every pool, with the same meaning and defaults as for
+//:   'bdlma::MultipoolAllocator'.
+//:
+//: 4 BASIC ALLOCATOR -- the allocator used to supply memory.  If not
+//:   specified, the currently installed default allocator is used.
+//
+///Statistics
+///----------
+// The allocator counts, for every size class, the number of requests it has
+// satisfied, the number of bytes they requested, and the number of blocks and
+// requested bytes currently in use.  The difference between the memory held
+// by the blocks of a class that are in use and the memory requested for them,
+// reported by 'numBytesWasted', is the internal fragmentation of the class.
+// Requests too large to be pooled are counted under the pseudo-class index
+// 'numClasses()'.  The counters are maintained with plain (non-atomic)
+// arithmetic, and reflect neither the block headers nor the unused blocks
+// held by the pools.
+//
+///Thread Safety
+///-------------
+// 'bdlma::SizeClassMultipoolAllocator' is *not* thread-safe: concurrent
+// access to an object must be synchronized by the client.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Reducing the Footprint of a Cache
+/// - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a cache holds many small objects whose sizes are just above a
+// power of two, such as the 72-byte records defined below:
+//..
+//  struct CacheRecord {
+//      // This 'struct' represents an entry of a cache.
+//
+//      bsls::Types::Int64 d_key;
+//      char               d_payload[64];
+//  };
+//..
+// First, we allocate 10,000 records from a 'bdlma::MultipoolAllocator' and
+// from a 'bdlma::SizeClassMultipoolAllocator', each obtaining its memory from
+// a 'bslma::TestAllocator' that measures the memory used:
+//..
+//  enum { k_NUM_RECORDS = 10000 };
+//
+//  bslma::TestAllocator multipoolUpstream;
+//  bslma::TestAllocator sizeClassUpstream;
+//
+//  bdlma::MultipoolAllocator          multipool(&multipoolUpstream);
+//  bdlma::SizeClassMultipoolAllocator sizeClass(&sizeClassUpstream);
+//
+//  for (int i = 0; i < k_NUM_RECORDS; ++i) {
+//      multipool.allocate(sizeof(CacheRecord));
+//      sizeClass.allocate(sizeof(CacheRecord));
+//  }
+//..
+// Then, we observe that the power-of-two pools hold each 72-byte record in a
+// 128-byte block, whereas the size classes hold it in a block of at most 80
+// bytes (exactly 80 bytes on platforms whose maximal alignment is 16), which,
+// counting the block headers, saves about a third of the memory:
+//..
+//  const int                    index = sizeClass.classIndex(
+//                                                        sizeof(CacheRecord));
+//  const bsls::Types::size_type size  = sizeClass.classSize(index);
+//
+//  assert(sizeof(CacheRecord) <= size);
+//  assert(80                  >= size);
+//
+//  assert(sizeClassUpstream.numBytesInUse() * 10
+//                                    < multipoolUpstream.numBytesInUse() * 7);
+//..
+// Finally, we inspect the statistics of the class, which show the number of
+// bytes lost to rounding the records up to the size of the class:
+//..
+//  assert(k_NUM_RECORDS == sizeClass.numRequests(index));
+//  assert(k_NUM_RECORDS == sizeClass.numBlocksInUse(index));
+//
+//  const bsls::Types::Int64 recordSize = sizeof(CacheRecord);
+//  const bsls::Types::Int64 blockSize  = size;
+//
+//  assert(k_NUM_RECORDS * recordSize == sizeClass.numBytesInUse(index));
+//  assert(k_NUM_RECORDS * (blockSize - recordSize)
+//                                         == sizeClass.numBytesWasted(index));
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlma_blocklist.h>
+#include <bdlma_managedallocator.h>
+#include <bdlma_pool.h>
+
+#include <bslma_allocator.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_blockgrowth.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace bdlma {
+
+                     // =================================
+                     // class SizeClassMultipoolAllocator
+                     // =================================
+
+class SizeClassMultipoolAllocator : public ManagedAllocator {
+    // This class implements the 'bdlma::ManagedAllocator' protocol to provide
+    // an allocator that maintains an array of 'bdlma::Pool' objects managing
+    // memory blocks of geometrically spaced size classes, several classes per
+    // doubling of the block size, and that keeps per-class statistics of the
+    // memory requested.  Requests larger than the largest class are satisfied
+    // from a separately managed list of memory blocks.  Both the 'release'
+    // method and the destructor release all memory currently allocated via
+    // the object.  This class is *not* thread-safe.
+
+    // PRIVATE TYPES
+    struct Header {
+        // This 'struct' provides header information for each allocated memory
+        // block: the index of the class from which the block was dispensed,
+        // or the number of classes if the block is not pooled, and the size
+        // requested for the block.
+
+        union {
+            struct {
+                bsls::Types::size_type d_size;      // requested size
+                int                    d_classIdx;  // class of the block
+            }                          d_info;
+
+            bsls::AlignmentUtil::MaxAlignedType
+                                       d_dummy;     // force maximum alignment
+        } d_header;
+    };
+
+    struct ClassStatistics {
+        // This 'struct' holds the statistics of one size class.
+
+        bsls::Types::Int64 d_numRequests;        // requests satisfied
+        bsls::Types::Int64 d_numBytesRequested;  // bytes requested in total
+        bsls::Types::Int64 d_numBlocksInUse;     // blocks in use
+        bsls::Types::Int64 d_numBytesInUse;      // requested bytes in use
+    };
+
+    // DATA
+    Pool                   *d_pools_p;           // array of 'd_numClasses'
+                                                 // pools, one per class
+
+    ClassStatistics        *d_statistics_p;      // array of
+                                                 // 'd_numClasses + 1'
+                                                 // statistics, the last for
+                                                 // blocks not pooled
+
+    unsigned char          *d_sizeToClass_p;     // class of each request
+                                                 // size, in quanta, of up to
+                                                 // 'd_maxLookupSize' bytes
+
+    int                     d_numClasses;        // number of size classes
+
+    int                     d_log2ClassesPerDoubling;
+                                                 // base-2 logarithm of the
+                                                 // number of classes per
+                                                 // doubling
+
+    bsls::Types::size_type  d_maxLookupSize;     // largest size found in
+                                                 // 'd_sizeToClass_p'
+
+    bsls::Types::size_type  d_maxBlockSize;      // size of the largest class
+
+    BlockList               d_blockList;         // memory manager for "large"
+                                                 // memory blocks
+
+    bslma::Allocator       *d_allocator_p;       // memory allocator (held,
+                                                 // not owned)
+
+  private:
+    // PRIVATE MANIPULATORS
+    void initialize(int                          numClassesPerDoubling,
+                    bsls::Types::size_type       maxPooledBlockSize,
+                    bsls::BlockGrowth::Strategy  growthStrategy,
+                    int                          maxBlocksPerChunk);
+        // Initialize this allocator with the specified
+        // 'numClassesPerDoubling', 'maxPooledBlockSize', 'growthStrategy',
+        // and 'maxBlocksPerChunk'.
+
+    // PRIVATE ACCESSORS
+    int computeClassIndex(bsls::Types::size_type size) const;
+        // Return the index of the smallest class whose size is not less than
+        // the specified 'size', computed without the lookup table.  The
+        // behavior is undefined unless '1 <= size'.
+
+    bsls::Types::size_type computeClassSize(int classIndex) const;
+        // Return the size of the class having the specified 'classIndex'.
+        // The behavior is undefined unless '0 <= classIndex'.
+
+  private:
+    // NOT IMPLEMENTED
+    SizeClassMultipoolAllocator(const SizeClassMultipoolAllocator&);
+    SizeClassMultipoolAllocator& operator=(
+                                           const SizeClassMultipoolAllocator&);
+
+  public:
+    // CREATORS
+    explicit
+    SizeClassMultipoolAllocator(bslma::Allocator *basicAllocator = 0);
+    explicit
+    SizeClassMultipoolAllocator(int               numClassesPerDoubling,
+                                bslma::Allocator *basicAllocator = 0);
+    SizeClassMultipoolAllocator(int                     numClassesPerDoubling,
+                                bsls::Types::size_type  maxPooledBlockSize,
+                                bslma::Allocator       *basicAllocator = 0);
+    SizeClassMultipoolAllocator(
+                          int                          numClassesPerDoubling,
+                          bsls::Types::size_type       maxPooledBlockSize,
+                          bsls::BlockGrowth::Strategy  growthStrategy,
+                          int                          maxBlocksPerChunk,
+                          bslma::Allocator            *basicAllocator = 0);
+        // Create a size-class multipool allocator.  Optionally specify
+        // 'numClassesPerDoubling', the number of size classes dividing each
+        // doubling of the block size; if 'numClassesPerDoubling' is not
+        // specified, 4 is used.  Optionally specify 'maxPooledBlockSize', the
+        // size (in bytes) of the largest request to be pooled, which is
+        // rounded up to the size of a class; if 'maxPooledBlockSize' is not
+        // specified, 4096 is used.  Optionally specify a 'growthStrategy'
+        // indicating whether the number of blocks allocated at once to
+        // replenish a pool should be either fixed or grow geometrically,
+        // starting with 1, and a 'maxBlocksPerChunk' indicating the maximum
+        // number of blocks to be allocated at once; if they are not
+        // specified, geometric growth capped at an implementation-defined
+        // maximum is used.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  The behavior is undefined unless
+        // 'numClassesPerDoubling' is a power of two not greater than 16,
+        // '1 <= maxPooledBlockSize <= 1 << 30', and '1 <= maxBlocksPerChunk'.
+
+    virtual ~SizeClassMultipoolAllocator();
+        // Destroy this allocator.  All memory allocated from this allocator
+        // is released.
+
+    // MANIPULATORS
+    virtual void *allocate(bsls::Types::size_type size);
+        // Return the address of a contiguous block of maximally-aligned memory
+        // of (at least) the specified 'size' (in bytes).  If 'size' is 0, no
+        // memory is allocated and 0 is returned.  If
+        // 'size > maxPooledBlockSize()', the memory allocation is managed
+        // directly by the underlying allocator, and will not be pooled, but
+        // will be deallocated when the 'release' method is called, or when
+        // this object is destroyed.
+
+    virtual void deallocate(void *address);
+        // Return the memory block at the specified 'address' back to this
+        // allocator.  If 'address' is 0, this function has no effect.  The
+        // behavior is undefined unless 'address' was allocated using this
+        // allocator object and has not already been deallocated.
+
+    virtual void release();
+        // Release all memory currently allocated through this allocator, and
+        // reset the statistics of the blocks in use.  Note that the numbers
+        // of requests and of bytes requested are not reset.
+
+    void reserveCapacity(bsls::Types::size_type size, int numBlocks);
+        // Reserve memory from this allocator to satisfy memory requests for at
+        // least the specified 'numBlocks' having the specified 'size' (in
+        // bytes) before the pool replenishes.  If 'size' is 0, this method has
+        // no effect.  The behavior is undefined unless
+        // 'size <= maxPooledBlockSize()' and '0 <= numBlocks'.
+
+    // ACCESSORS
+    int classIndex(bsls::Types::size_type size) const;
+        // Return the index of the size class from which a request for the
+        // specified 'size' (in bytes) is satisfied, or 'numClasses()' if
+        // 'size > maxPooledBlockSize()'.  The behavior is undefined unless
+        // '1 <= size'.
+
+    bsls::Types::size_type classSize(int classIndex) const;
+        // Return the size (in bytes) of the blocks of the class having the
+        // specified 'classIndex'.  The behavior is undefined unless
+        // '0 <= classIndex < numClasses()'.
+
+    bsls::Types::size_type maxPooledBlockSize() const;
+        // Return the maximum size of memory blocks that are pooled by this
+        // allocator, which is the size of its largest class.
+
+    int numClasses() const;
+        // Return the number of size classes of this allocator.
+
+    int numClassesPerDoubling() const;
+        // Return the number of size classes dividing each doubling of the
+        // block size.
+
+                                  // Statistics
+
+    bsls::Types::Int64 numBlocksInUse(int classIndex) const;
+        // Return the number of blocks of the class having the specified
+        // 'classIndex' that are currently in use.  The behavior is undefined
+        // unless '0 <= classIndex <= numClasses()'.  Note that the blocks
+        // that are not pooled are counted under the index 'numClasses()'.
+
+    bsls::Types::Int64 numBytesInUse(int classIndex) const;
+        // Return the number of bytes requested for the blocks of the class
+        // having the specified 'classIndex' that are currently in use.  The
+        // behavior is undefined unless '0 <= classIndex <= numClasses()'.
+
+    bsls::Types::Int64 numBytesRequested(int classIndex) const;
+        // Return the total number of bytes requested from the class having
+        // the specified 'classIndex' since this allocator was created.  The
+        // behavior is undefined unless '0 <= classIndex <= numClasses()'.
+
+    bsls::Types::Int64 numBytesWasted(int classIndex) const;
+        // Return the number of bytes of the blocks in use of the class having
+        // the specified 'classIndex' that exceed the sizes requested for
+        // them, i.e., the internal fragmentation of the class.  The behavior
+        // is undefined unless '0 <= classIndex < numClasses()'.
+
+    bsls::Types::Int64 numRequests(int classIndex) const;
+        // Return the number of requests satisfied from the class having the
+        // specified 'classIndex' since this allocator was created.  The
+        // behavior is undefined unless '0 <= classIndex <= numClasses()'.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                     // ---------------------------------
+                     // class SizeClassMultipoolAllocator
+                     // ---------------------------------
+
+// ACCESSORS
+inline
+int SizeClassMultipoolAllocator::classIndex(bsls::Types::size_type size) const
+{
+    BSLS_ASSERT(1 <= size);
+
+    if (size <= d_maxLookupSize) {
+        return d_sizeToClass_p[(size
+                                + bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT - 1)
+                               / bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT];
+                                                                      // RETURN
+    }
+    if (size > d_maxBlockSize) {
+        return d_numClasses;                                          // RETURN
+    }
+    return computeClassIndex(size);
+}
+
+inline
+bsls::Types::size_type SizeClassMultipoolAllocator::classSize(
+                                                          int classIndex) const
+{
+    BSLS_ASSERT(0 <= classIndex);
+    BSLS_ASSERT(classIndex < d_numClasses);
+
+    return computeClassSize(classIndex);
+}
+
+inline
+bsls::Types::size_type SizeClassMultipoolAllocator::maxPooledBlockSize() const
+{
+    return d_maxBlockSize;
+}
+
+inline
+int SizeClassMultipoolAllocator::numClasses() const
+{
+    return d_numClasses;
+}
+
+inline
+int SizeClassMultipoolAllocator::numClassesPerDoubling() const
+{
+    return 1 << d_log2ClassesPerDoubling;
+}
+
+                                  // Statistics
+
+inline
+bsls::Types::Int64
+SizeClassMultipoolAllocator::numBlocksInUse(int classIndex) const
+{
+    BSLS_ASSERT(0 <= classIndex);
+    BSLS_ASSERT(classIndex <= d_numClasses);
+
+    return d_statistics_p[classIndex].d_numBlocksInUse;
+}
+
+inline
+bsls::Types::Int64
+SizeClassMultipoolAllocator::numBytesInUse(int classIndex) const
+{
+    BSLS_ASSERT(0 <= classIndex);
+    BSLS_ASSERT(classIndex <= d_numClasses);
+
+    return d_statistics_p[classIndex].d_numBytesInUse;
+}
+
+inline
+bsls::Types::Int64
+SizeClassMultipoolAllocator::numBytesRequested(int classIndex) const
+{
+    BSLS_ASSERT(0 <= classIndex);
+    BSLS_ASSERT(classIndex <= d_numClasses);
+
+    return d_statistics_p[classIndex].d_numBytesRequested;
+}
+
+inline
+bsls::Types::Int64
+SizeClassMultipoolAllocator::numBytesWasted(int classIndex) const
+{
+    BSLS_ASSERT(0 <= classIndex);
+    BSLS_ASSERT(classIndex < d_numClasses);
+
+    const ClassStatistics& statistics = d_statistics_p[classIndex];
+
+    return static_cast<bsls::Types::Int64>(computeClassSize(classIndex))
+                                                * statistics.d_numBlocksInUse
+                                                - statistics.d_numBytesInUse;
+}
+
+inline
+bsls::Types::Int64
+SizeClassMultipoolAllocator::numRequests(int classIndex) const
+{
+    BSLS_ASSERT(0 <= classIndex);
+    BSLS_ASSERT(classIndex <= d_numClasses);
+
+    return d_statistics_p[classIndex].d_numRequests;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1025 @@
+// bdlma_sizeclassmultipoolallocator.t.cpp                            -*-C++-*-
+#include <bdlma_sizeclassmultipoolallocator.h>
+
+#include <bdlma_multipoolallocator.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_asserttest.h>
+#include <bsls_blockgrowth.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// 'bdlma::SizeClassMultipoolAllocator' dispenses memory from an array of
+// pools, one per size class, and from a list of blocks for requests too large
+// to be pooled.  The primary concerns are that the size classes are those
+// documented for every supported number of classes per doubling, that every
+// request is satisfied from the smallest class not smaller than the request,
+// that the blocks dispensed are distinct, usable, and maximally aligned, that
+// the per-class statistics account for every request, and that 'release' and
+// the destructor return all memory to the underlying allocator.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] SizeClassMultipoolAllocator(Allocator *basicAllocator = 0);
+// [ 2] SizeClassMultipoolAllocator(int classesPerDoubling, Allocator *);
+// [ 2] SizeClassMultipoolAllocator(int, size_type maxSize, Allocator *);
+// [ 2] SizeClassMultipoolAllocator(int, size_type, Strategy, int, A *);
+// [ 2] ~SizeClassMultipoolAllocator();
+//
+// MANIPULATORS
+// [ 4] void *allocate(bsls::Types::size_type size);
+// [ 4] void deallocate(void *address);
+// [ 6] void release();
+// [ 6] void reserveCapacity(bsls::Types::size_type size, int numBlocks);
+//
+// ACCESSORS
+// [ 3] int classIndex(bsls::Types::size_type size) const;
+// [ 3] bsls::Types::size_type classSize(int classIndex) const;
+// [ 2] bsls::Types::size_type maxPooledBlockSize() const;
+// [ 2] int numClasses() const;
+// [ 2] int numClassesPerDoubling() const;
+// [ 5] bsls::Types::Int64 numBlocksInUse(int classIndex) const;
+// [ 5] bsls::Types::Int64 numBytesInUse(int classIndex) const;
+// [ 5] bsls::Types::Int64 numBytesRequested(int classIndex) const;
+// [ 5] bsls::Types::Int64 numBytesWasted(int classIndex) const;
+// [ 5] bsls::Types::Int64 numRequests(int classIndex) const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] USAGE EXAMPLE
+// [ *] CONCERN: In no case does memory come from the global allocator.
+
+// ============================================================================
+//                    STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL VARIABLES / TYPEDEFS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bdlma::SizeClassMultipoolAllocator Obj;
+typedef bsls::Types::Int64                 Int64;
+typedef bsls::Types::size_type             size_type;
+typedef bsls::Types::UintPtr               UintPtr;
+
+static const int MAX_ALIGN = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+
+static const int CLASSES_PER_DOUBLING[] = { 1, 2, 4, 8, 16 };
+static const int NUM_CLASSES_PER_DOUBLING = static_cast<int>(
+               sizeof CLASSES_PER_DOUBLING / sizeof *CLASSES_PER_DOUBLING);
+
+// ============================================================================
+//                  HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static
+size_type expectedClassSize(int classIndex, int classesPerDoubling)
+    // Return the size of the class having the specified 'classIndex' of an
+    // allocator having the specified 'classesPerDoubling', computed by
+    // enumerating the classes as documented in the component header.
+{
+    size_type size    = 0;
+    size_type spacing = MAX_ALIGN;
+    size_type base    = static_cast<size_type>(classesPerDoubling) * MAX_ALIGN;
+
+    for (int i = 0; i <= classIndex; ++i) {
+        if (size == base) {
+            spacing  = base / classesPerDoubling;
+            base    *= 2;
+        }
+        size += spacing;
+    }
+    return size;
+}
+
+static
+bool isMaxAligned(const void *address)
+    // Return 'true' if the specified 'address' is maximally aligned, and
+    // 'false' otherwise.
+{
+    return 0 == (reinterpret_cast<UintPtr>(address) & (MAX_ALIGN - 1));
+}
+
+// ============================================================================
+//                            USAGE EXAMPLE TYPES
+// ----------------------------------------------------------------------------
+
+namespace Usage {
+
+struct CacheRecord {
+    // This 'struct' represents an entry of a cache.
+
+    bsls::Types::Int64 d_key;
+    char               d_payload[64];
+};
+
+}  // close namespace Usage
+
+// ============================================================================
+//                              MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)     veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator         defaultAllocator("default",
+                                                  veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        using Usage::CacheRecord;
+
+///Example 1: Reducing the Footprint of a Cache
+/// - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a cache holds many small objects whose sizes are just above a
+// power of two, such as the 72-byte records defined below:
+//..
+//  struct CacheRecord {
+//      // This 'struct' represents an entry of a cache.
+//
+//      bsls::Types::Int64 d_key;
+//      char               d_payload[64];
+//  };
+//..
+// First, we allocate 10,000 records from a 'bdlma::MultipoolAllocator' and
+// from a 'bdlma::SizeClassMultipoolAllocator', each obtaining its memory from
+// a 'bslma::TestAllocator' that measures the memory used:
+//..
+    enum { k_NUM_RECORDS = 10000 };
+
+    bslma::TestAllocator multipoolUpstream;
+    bslma::TestAllocator sizeClassUpstream;
+
+    bdlma::MultipoolAllocator          multipool(&multipoolUpstream);
+    bdlma::SizeClassMultipoolAllocator sizeClass(&sizeClassUpstream);
+
+    for (int i = 0; i < k_NUM_RECORDS; ++i) {
+        multipool.allocate(sizeof(CacheRecord));
+        sizeClass.allocate(sizeof(CacheRecord));
+    }
+//..
+// Then, we observe that the power-of-two pools hold each 72-byte record in a
+// 128-byte block, whereas the size classes hold it in a block of at most 80
+// bytes (exactly 80 bytes on platforms whose maximal alignment is 16), which,
+// counting the block headers, saves about a third of the memory:
+//..
+    const int                    index = sizeClass.classIndex(
+                                                          sizeof(CacheRecord));
+    const bsls::Types::size_type size  = sizeClass.classSize(index);
+
+    ASSERT(sizeof(CacheRecord) <= size);
+    ASSERT(80                  >= size);
+
+    ASSERT(sizeClassUpstream.numBytesInUse() * 10
+                                      < multipoolUpstream.numBytesInUse() * 7);
+//..
+// Finally, we inspect the statistics of the class, which show the number of
+// bytes lost to rounding the records up to the size of the class:
+//..
+    ASSERT(k_NUM_RECORDS == sizeClass.numRequests(index));
+    ASSERT(k_NUM_RECORDS == sizeClass.numBlocksInUse(index));
+
+    const bsls::Types::Int64 recordSize = sizeof(CacheRecord);
+    const bsls::Types::Int64 blockSize  = size;
+
+    ASSERT(k_NUM_RECORDS * recordSize == sizeClass.numBytesInUse(index));
+    ASSERT(k_NUM_RECORDS * (blockSize - recordSize)
+                                           == sizeClass.numBytesWasted(index));
+//..
+
+        if (veryVerbose) {
+            P_(multipoolUpstream.numBytesInUse());
+            P(sizeClassUpstream.numBytesInUse());
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // 'release' AND 'reserveCapacity'
+        //
+        // Concerns:
+        //: 1 'release' returns all pooled and non-pooled memory to the
+        //:   underlying allocator, and resets the statistics of the blocks in
+        //:   use but not the numbers of requests and of bytes requested.
+        //:
+        //: 2 The allocator remains usable after 'release'.
+        //:
+        //: 3 'reserveCapacity' reserves blocks of the class of the specified
+        //:   size, so that that many requests do not allocate from the
+        //:   underlying allocator.
+        //:
+        //: 4 'reserveCapacity' has no effect for a size of 0.
+        //:
+        //: 5 The destructor returns all memory to the underlying allocator,
+        //:   even if blocks remain allocated.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Allocate pooled and non-pooled blocks, 'release' the allocator,
+        //:   and verify the memory in use by the underlying allocator and the
+        //:   statistics.  Then allocate again.  (C-1..2)
+        //:
+        //: 2 Reserve capacity for a class, and verify that allocating that
+        //:   many blocks of the class does not allocate from the underlying
+        //:   allocator.  (C-3..4)
+        //:
+        //: 3 Destroy an allocator having outstanding blocks, and verify that
+        //:   no memory remains in use.  (C-5)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-6)
+        //
+        // Testing:
+        //   void release();
+        //   void reserveCapacity(bsls::Types::size_type size, int numBlocks);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'release' AND 'reserveCapacity'" << endl
+                          << "===============================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        if (verbose) cout << "\nTesting 'release'." << endl;
+        {
+            Obj mX(4, 1024, &oa);  const Obj& X = mX;
+
+            const Int64 numBlocksInitial = oa.numBlocksInUse();
+
+            for (int i = 1; i <= 2000; ++i) {
+                mX.allocate(i);
+            }
+            ASSERT(numBlocksInitial < oa.numBlocksInUse());
+
+            mX.release();
+            ASSERTV(oa.numBlocksInUse(),
+                    numBlocksInitial == oa.numBlocksInUse());
+
+            Int64 numRequests = 0;
+            Int64 numBytes    = 0;
+            for (int c = 0; c <= X.numClasses(); ++c) {
+                LOOP_ASSERT(c, 0 == X.numBlocksInUse(c));
+                LOOP_ASSERT(c, 0 == X.numBytesInUse(c));
+                numRequests += X.numRequests(c);
+                numBytes    += X.numBytesRequested(c);
+            }
+            ASSERT(2000                == numRequests);
+            ASSERT(2000 * 2001 / 2     == numBytes);
+
+            void *p = mX.allocate(100);
+            ASSERT(p);
+            bsl::memset(p, 0xa5, 100);
+            ASSERT(1 == X.numBlocksInUse(X.classIndex(100)));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting 'reserveCapacity'." << endl;
+        {
+            Obj mX(4, 1024, &oa);
+
+            mX.reserveCapacity(0, 100);
+            const Int64 numBlocks = oa.numBlocksTotal();
+
+            mX.reserveCapacity(200, 100);
+            ASSERT(numBlocks < oa.numBlocksTotal());
+
+            const Int64 numBlocksReserved = oa.numBlocksTotal();
+            for (int i = 0; i < 100; ++i) {
+                mX.allocate(193 + i % 32);
+            }
+            ASSERTV(oa.numBlocksTotal(),
+                    numBlocksReserved == oa.numBlocksTotal());
+
+            mX.allocate(200);
+            ASSERT(numBlocksReserved < oa.numBlocksTotal());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(4, 1024, &oa);
+
+            ASSERT_PASS(mX.reserveCapacity(1024, 0));
+            ASSERT_FAIL(mX.reserveCapacity(1025, 1));
+            ASSERT_FAIL(mX.reserveCapacity(16, -1));
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // STATISTICS
+        //
+        // Concerns:
+        //: 1 Every request is counted under the class from which it is
+        //:   satisfied, with the number of bytes requested.
+        //:
+        //: 2 The blocks and bytes in use are decremented when the blocks are
+        //:   deallocated, and the numbers of requests and of bytes requested
+        //:   are not.
+        //:
+        //: 3 The wasted bytes of a class are the difference between the size
+        //:   of its blocks in use and the bytes requested for them.
+        //:
+        //: 4 The requests too large to be pooled are counted under the index
+        //:   'numClasses()'.
+        //:
+        //: 5 Requests for 0 bytes are not counted.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Allocate blocks of every size up to beyond the largest class,
+        //:   and verify the statistics of every class against values computed
+        //:   independently.  Then deallocate every other block, and verify the
+        //:   statistics again.  (C-1..5)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid class indices.  (C-6)
+        //
+        // Testing:
+        //   bsls::Types::Int64 numBlocksInUse(int classIndex) const;
+        //   bsls::Types::Int64 numBytesInUse(int classIndex) const;
+        //   bsls::Types::Int64 numBytesRequested(int classIndex) const;
+        //   bsls::Types::Int64 numBytesWasted(int classIndex) const;
+        //   bsls::Types::Int64 numRequests(int classIndex) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "STATISTICS" << endl
+                          << "==========" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        for (int ti = 0; ti < NUM_CLASSES_PER_DOUBLING; ++ti) {
+            const int K = CLASSES_PER_DOUBLING[ti];
+
+            if (veryVerbose) { T_ P(K) }
+
+            Obj mX(K, 512, &oa);  const Obj& X = mX;
+
+            const int NUM_CLASSES = X.numClasses();
+            const int MAX_SIZE    = static_cast<int>(X.maxPooledBlockSize())
+                                                                         + 100;
+
+            bsl::vector<Int64> requests(NUM_CLASSES + 1, 0, &oa);
+            bsl::vector<Int64> bytes(NUM_CLASSES + 1, 0, &oa);
+            bsl::vector<Int64> blocksInUse(NUM_CLASSES + 1, 0, &oa);
+            bsl::vector<Int64> bytesInUse(NUM_CLASSES + 1, 0, &oa);
+            bsl::vector<void *> blocks(&oa);
+
+            ASSERT(0 == mX.allocate(0));
+
+            for (int size = 1; size <= MAX_SIZE; ++size) {
+                const int c = X.classIndex(size);
+
+                blocks.push_back(mX.allocate(size));
+                ++requests[c];
+                bytes[c] += size;
+                ++blocksInUse[c];
+                bytesInUse[c] += size;
+            }
+
+            for (int c = 0; c <= NUM_CLASSES; ++c) {
+                LOOP2_ASSERT(K, c, requests[c]    == X.numRequests(c));
+                LOOP2_ASSERT(K, c, bytes[c]       == X.numBytesRequested(c));
+                LOOP2_ASSERT(K, c, blocksInUse[c] == X.numBlocksInUse(c));
+                LOOP2_ASSERT(K, c, bytesInUse[c]  == X.numBytesInUse(c));
+            }
+            ASSERT(100 == X.numRequests(NUM_CLASSES));
+
+            for (int size = 1; size <= MAX_SIZE; size += 2) {
+                const int c = X.classIndex(size);
+
+                mX.deallocate(blocks[size - 1]);
+                --blocksInUse[c];
+                bytesInUse[c] -= size;
+            }
+
+            for (int c = 0; c <= NUM_CLASSES; ++c) {
+                LOOP2_ASSERT(K, c, requests[c]    == X.numRequests(c));
+                LOOP2_ASSERT(K, c, bytes[c]       == X.numBytesRequested(c));
+                LOOP2_ASSERT(K, c, blocksInUse[c] == X.numBlocksInUse(c));
+                LOOP2_ASSERT(K, c, bytesInUse[c]  == X.numBytesInUse(c));
+
+                if (c < NUM_CLASSES) {
+                    const Int64 EXP = static_cast<Int64>(X.classSize(c))
+                                                               * blocksInUse[c]
+                                                               - bytesInUse[c];
+
+                    LOOP3_ASSERT(K, c, EXP, EXP == X.numBytesWasted(c));
+                    LOOP2_ASSERT(K, c, 0 <= X.numBytesWasted(c));
+                }
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(&oa);  const Obj& X = mX;
+
+            const int N = X.numClasses();
+
+            ASSERT_FAIL(X.numRequests(-1));
+            ASSERT_PASS(X.numRequests(N));
+            ASSERT_FAIL(X.numRequests(N + 1));
+            ASSERT_FAIL(X.numBytesRequested(-1));
+            ASSERT_PASS(X.numBytesRequested(N));
+            ASSERT_FAIL(X.numBytesRequested(N + 1));
+            ASSERT_FAIL(X.numBlocksInUse(-1));
+            ASSERT_PASS(X.numBlocksInUse(N));
+            ASSERT_FAIL(X.numBlocksInUse(N + 1));
+            ASSERT_FAIL(X.numBytesInUse(-1));
+            ASSERT_PASS(X.numBytesInUse(N));
+            ASSERT_FAIL(X.numBytesInUse(N + 1));
+            ASSERT_FAIL(X.numBytesWasted(-1));
+            ASSERT_PASS(X.numBytesWasted(N - 1));
+            ASSERT_FAIL(X.numBytesWasted(N));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'allocate' AND 'deallocate'
+        //
+        // Concerns:
+        //: 1 'allocate' returns distinct, writable, maximally-aligned blocks
+        //:   of at least the requested size, both for pooled and non-pooled
+        //:   requests.
+        //:
+        //: 2 'allocate' returns 0 for a request of 0 bytes, and 'deallocate'
+        //:   has no effect for a null address.
+        //:
+        //: 3 A deallocated block is reused for the next request of its class.
+        //:
+        //: 4 Non-pooled blocks are returned to the underlying allocator when
+        //:   they are deallocated.
+        //:
+        //: 5 All memory comes from the allocator supplied at construction.
+        //
+        // Plan:
+        //: 1 For every number of classes per doubling, allocate blocks of
+        //:   every size up to beyond the largest class, fill every block with
+        //:   a distinct pattern, and verify the alignment of every block and
+        //:   the patterns of every block after all are filled.  (C-1, 5)
+        //:
+        //: 2 Allocate 0 bytes and deallocate a null address.  (C-2)
+        //:
+        //: 3 Deallocate a pooled block and allocate a block of a different
+        //:   size of the same class.  (C-3)
+        //:
+        //: 4 Allocate and deallocate a non-pooled block, and verify the number
+        //:   of blocks in use by the underlying allocator.  (C-4)
+        //
+        // Testing:
+        //   void *allocate(bsls::Types::size_type size);
+        //   void deallocate(void *address);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'allocate' AND 'deallocate'" << endl
+                          << "===========================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        for (int ti = 0; ti < NUM_CLASSES_PER_DOUBLING; ++ti) {
+            const int K = CLASSES_PER_DOUBLING[ti];
+
+            if (veryVerbose) { T_ P(K) }
+
+            Obj mX(K, 1024, &oa);  const Obj& X = mX;
+
+            const int MAX_SIZE = static_cast<int>(X.maxPooledBlockSize())
+                                                                         + 300;
+
+            bsl::vector<char *> blocks(&oa);
+
+            for (int size = 1; size <= MAX_SIZE; ++size) {
+                char *p = static_cast<char *>(mX.allocate(size));
+
+                LOOP2_ASSERT(K, size, p);
+                LOOP2_ASSERT(K, size, isMaxAligned(p));
+
+                bsl::memset(p, size & 0xff, size);
+                blocks.push_back(p);
+            }
+
+            for (int size = 1; size <= MAX_SIZE; ++size) {
+                const char *p = blocks[size - 1];
+
+                for (int j = 0; j < size; ++j) {
+                    if ((size & 0xff) != static_cast<unsigned char>(p[j])) {
+                        LOOP3_ASSERT(K, size, j, 0);
+                        break;
+                    }
+                }
+            }
+
+            for (int size = 1; size <= MAX_SIZE; ++size) {
+                mX.deallocate(blocks[size - 1]);
+            }
+            ASSERT(0 == defaultAllocator.numBlocksTotal());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting 0-sized requests." << endl;
+        {
+            Obj mX(&oa);
+
+            const Int64 numBlocks = oa.numBlocksTotal();
+
+            ASSERT(0 == mX.allocate(0));
+            mX.deallocate(0);
+            ASSERT(numBlocks == oa.numBlocksTotal());
+        }
+
+        if (verbose) cout << "\nTesting reuse of pooled blocks." << endl;
+        {
+            Obj mX(4, &oa);  const Obj& X = mX;
+
+            ASSERT(X.classIndex(65) == X.classIndex(80));
+
+            void *p = mX.allocate(65);
+            mX.deallocate(p);
+            ASSERT(p == mX.allocate(80));
+        }
+
+        if (verbose) cout << "\nTesting non-pooled blocks." << endl;
+        {
+            Obj mX(4, 256, &oa);  const Obj& X = mX;
+
+            const Int64 numBlocks = oa.numBlocksInUse();
+
+            void *p = mX.allocate(X.maxPooledBlockSize() + 1);
+            ASSERT(numBlocks + 1 == oa.numBlocksInUse());
+            ASSERT(isMaxAligned(p));
+            ASSERT(1 == X.numBlocksInUse(X.numClasses()));
+
+            mX.deallocate(p);
+            ASSERT(numBlocks == oa.numBlocksInUse());
+            ASSERT(0 == X.numBlocksInUse(X.numClasses()));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'classIndex' AND 'classSize'
+        //
+        // Concerns:
+        //: 1 The class sizes are those documented: the first 'K' classes
+        //:   spaced by the maximal alignment, and 'K' classes per doubling
+        //:   thereafter.
+        //:
+        //: 2 Every class size is a multiple of the maximal alignment.
+        //:
+        //: 3 'classIndex' returns the smallest class whose size is not less
+        //:   than the specified size, whether it is found in the lookup table
+        //:   or computed.
+        //:
+        //: 4 'classIndex' returns 'numClasses()' for sizes exceeding
+        //:   'maxPooledBlockSize()'.
+        //:
+        //: 5 No class size exceeds the size of the preceding class by more
+        //:   than its '1 / K' fraction, beyond the first 'K' classes.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For every number of classes per doubling 'K', create allocators
+        //:   with several maximum pooled sizes, including sizes pooled beyond
+        //:   the range of the lookup table, and verify every class size
+        //:   against an independent enumeration of the classes.  (C-1..2, 5)
+        //:
+        //: 2 For every size up to beyond the largest class, verify that the
+        //:   class returned by 'classIndex' is the smallest class not smaller
+        //:   than the size.  (C-3..4)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-6)
+        //
+        // Testing:
+        //   int classIndex(bsls::Types::size_type size) const;
+        //   bsls::Types::size_type classSize(int classIndex) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'classIndex' AND 'classSize'" << endl
+                          << "============================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        if (verbose) cout << "\nTesting the documented classes." << endl;
+        {
+            Obj mX(4, 512, &oa);  const Obj& X = mX;
+
+            if (16 == MAX_ALIGN) {
+                static const int EXP[] = {  16,  32,  48,  64,  80,  96, 112,
+                                           128, 160, 192, 224, 256, 320, 384,
+                                           448, 512 };
+                const int NUM_EXP = static_cast<int>(sizeof EXP / sizeof *EXP);
+
+                ASSERTV(X.numClasses(), NUM_EXP == X.numClasses());
+                for (int c = 0; c < NUM_EXP; ++c) {
+                    LOOP_ASSERT(c, static_cast<size_type>(EXP[c])
+                                                            == X.classSize(c));
+                }
+                ASSERT(X.classIndex(80) == X.classIndex(65));
+            }
+        }
+
+        static const size_type MAX_SIZES[] = { 1, 100, 4096, 5000, 70000 };
+        const int NUM_MAX_SIZES = static_cast<int>(
+                                       sizeof MAX_SIZES / sizeof *MAX_SIZES);
+
+        for (int ti = 0; ti < NUM_CLASSES_PER_DOUBLING; ++ti) {
+            const int K = CLASSES_PER_DOUBLING[ti];
+
+            for (int tj = 0; tj < NUM_MAX_SIZES; ++tj) {
+                const size_type MAX = MAX_SIZES[tj];
+
+                if (veryVerbose) { T_ P_(K) P(MAX) }
+
+                Obj mX(K, MAX, &oa);  const Obj& X = mX;
+
+                const int       NUM_CLASSES = X.numClasses();
+                const size_type MAX_POOLED  = X.maxPooledBlockSize();
+
+                ASSERT(K == X.numClassesPerDoubling());
+                ASSERT(MAX <= MAX_POOLED);
+                ASSERT(MAX_POOLED == X.classSize(NUM_CLASSES - 1));
+                ASSERT(1 == NUM_CLASSES || MAX > X.classSize(NUM_CLASSES - 2));
+
+                for (int c = 0; c < NUM_CLASSES; ++c) {
+                    const size_type SIZE = X.classSize(c);
+
+                    LOOP3_ASSERT(K, MAX, c,
+                                 expectedClassSize(c, K) == SIZE);
+                    LOOP3_ASSERT(K, MAX, c, 0 == SIZE % MAX_ALIGN);
+
+                    if (K <= c) {
+                        const size_type PREV = X.classSize(c - 1);
+
+                        LOOP3_ASSERT(K, MAX, c, PREV < SIZE);
+                        LOOP3_ASSERT(K, MAX, c, (SIZE - PREV) * K <= PREV);
+                    }
+                }
+
+                for (size_type size = 1; size <= MAX_POOLED + 200; ++size) {
+                    const int c = X.classIndex(size);
+
+                    if (size > MAX_POOLED) {
+                        LOOP3_ASSERT(K, MAX, size, NUM_CLASSES == c);
+                        continue;
+                    }
+
+                    LOOP3_ASSERT(K, MAX, size, 0 <= c && c < NUM_CLASSES);
+                    LOOP3_ASSERT(K, MAX, size, size <= X.classSize(c));
+                    LOOP3_ASSERT(K, MAX, size,
+                                 0 == c || X.classSize(c - 1) < size);
+                }
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(&oa);  const Obj& X = mX;
+
+            const int N = X.numClasses();
+
+            ASSERT_FAIL(X.classIndex(0));
+            ASSERT_PASS(X.classIndex(1));
+            ASSERT_FAIL(X.classSize(-1));
+            ASSERT_PASS(X.classSize(0));
+            ASSERT_PASS(X.classSize(N - 1));
+            ASSERT_FAIL(X.classSize(N));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 The default constructor creates an allocator having 4 classes per
+        //:   doubling and pooling requests of up to 4096 bytes.
+        //:
+        //: 2 The other constructors create an allocator having the specified
+        //:   number of classes per doubling and maximum pooled size, rounded
+        //:   up to the size of a class.
+        //:
+        //: 3 Memory is obtained from the allocator supplied at construction,
+        //:   or the default allocator if none is supplied.
+        //:
+        //: 4 The growth strategy and maximum blocks per chunk apply to every
+        //:   pool.
+        //:
+        //: 5 The destructor returns all memory to its allocator, even if
+        //:   blocks remain allocated.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create allocators with every constructor, with and without a
+        //:   supplied allocator, and verify the accessors and the source of
+        //:   the memory.  (C-1..3)
+        //:
+        //: 2 Create an allocator with a fixed growth strategy and a maximum
+        //:   of 5 blocks per chunk, and verify the number of blocks allocated
+        //:   from the underlying allocator as a class is replenished.  (C-4)
+        //:
+        //: 3 Destroy allocators having outstanding blocks, and verify that
+        //:   no memory remains in use.  (C-5)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-6)
+        //
+        // Testing:
+        //   SizeClassMultipoolAllocator(Allocator *basicAllocator = 0);
+        //   SizeClassMultipoolAllocator(int classesPerDoubling, Allocator *);
+        //   SizeClassMultipoolAllocator(int, size_type maxSize, Allocator *);
+        //   SizeClassMultipoolAllocator(int, size_type, Strategy, int, A *);
+        //   ~SizeClassMultipoolAllocator();
+        //   bsls::Types::size_type maxPooledBlockSize() const;
+        //   int numClasses() const;
+        //   int numClassesPerDoubling() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND BASIC ACCESSORS" << endl
+                          << "============================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(4    == X.numClassesPerDoubling());
+            ASSERT(4096 == X.maxPooledBlockSize());
+            ASSERT(0    <  defaultAllocator.numBlocksInUse());
+
+            mX.allocate(10000);
+            mX.allocate(100);
+        }
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            ASSERT(4    == X.numClassesPerDoubling());
+            ASSERT(4096 == X.maxPooledBlockSize());
+            ASSERT(0    <  oa.numBlocksInUse());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        {
+            Obj mX(8, &oa);  const Obj& X = mX;
+
+            ASSERT(8    == X.numClassesPerDoubling());
+            ASSERT(4096 == X.maxPooledBlockSize());
+        }
+        {
+            Obj mX(2, 1000, &oa);  const Obj& X = mX;
+
+            ASSERT(2    == X.numClassesPerDoubling());
+            ASSERT(1024 == X.maxPooledBlockSize());
+
+            mX.allocate(1000);
+            mX.allocate(1025);
+        }
+        {
+            Obj mX(1, 1, &oa);  const Obj& X = mX;
+
+            ASSERT(1         == X.numClassesPerDoubling());
+            ASSERT(1         == X.numClasses());
+            ASSERT(MAX_ALIGN == static_cast<int>(X.maxPooledBlockSize()));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting the growth strategy." << endl;
+        {
+            Obj mX(4, 4096, bsls::BlockGrowth::BSLS_CONSTANT, 5, &oa);
+            const Obj& X = mX;
+
+            ASSERT(4    == X.numClassesPerDoubling());
+            ASSERT(4096 == X.maxPooledBlockSize());
+
+            const Int64 numBlocks = oa.numBlocksTotal();
+
+            mX.allocate(100);
+            ASSERT(numBlocks + 1 == oa.numBlocksTotal());
+
+            for (int i = 1; i < 5; ++i) {
+                mX.allocate(100);
+            }
+            ASSERT(numBlocks + 1 == oa.numBlocksTotal());
+
+            mX.allocate(100);
+            ASSERT(numBlocks + 2 == oa.numBlocksTotal());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_FAIL(Obj( 0,         &oa));
+            ASSERT_PASS(Obj( 1,         &oa));
+            ASSERT_FAIL(Obj( 3,         &oa));
+            ASSERT_PASS(Obj(16,         &oa));
+            ASSERT_FAIL(Obj(32,         &oa));
+            ASSERT_FAIL(Obj(-4,         &oa));
+            ASSERT_FAIL(Obj( 4, 0,      &oa));
+            ASSERT_PASS(Obj( 4, 1 << 20, &oa));
+            ASSERT_FAIL(Obj( 4, (1 << 30) + 1, &oa));
+            ASSERT_FAIL(Obj(4, 64, bsls::BlockGrowth::BSLS_CONSTANT, 0, &oa));
+            ASSERT_PASS(Obj(4, 64, bsls::BlockGrowth::BSLS_CONSTANT, 1, &oa));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Allocate and deallocate pooled and non-pooled blocks, and verify
+        //:   the statistics.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            const int c65 = X.classIndex(65);
+
+            void *p1 = mX.allocate(65);
+            void *p2 = mX.allocate(65);
+            void *p3 = mX.allocate(100000);
+
+            ASSERT(p1);
+            ASSERT(p2);
+            ASSERT(p3);
+            ASSERT(p1 != p2);
+            ASSERT(65 <= X.classSize(c65));
+            ASSERT(X.numClasses() == X.classIndex(100000));
+
+            ASSERT(2      == X.numRequests(c65));
+            ASSERT(130    == X.numBytesInUse(c65));
+            ASSERT(1      == X.numRequests(X.numClasses()));
+            ASSERT(100000 == X.numBytesInUse(X.numClasses()));
+
+            mX.deallocate(p1);
+            mX.deallocate(p3);
+
+            ASSERT(1      == X.numBlocksInUse(c65));
+            ASSERT(65     == X.numBytesInUse(c65));
+            ASSERT(130    == X.numBytesRequested(c65));
+            ASSERT(0      == X.numBlocksInUse(X.numClasses()));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
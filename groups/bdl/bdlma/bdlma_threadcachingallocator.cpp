@@ -0,0 +1,618 @@
+// bdlma_threadcachingallocator.cpp                                   -*-C++-*-
+#include <bdlma_threadcachingallocator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlma_threadcachingallocator_cpp,"$Id$ $CSID$")
+
+#include <bdlb_bitutil.h>
+
+#include <bslma_default.h>
+
+#include <bslmt_lockguard.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_exceptionutil.h>
+#include <bsls_performancehint.h>
+#include <bsls_spinlock.h>
+
+#include <bsl_cstdint.h>
+
+#include <new>           // placement 'new'
+
+namespace BloombergLP {
+namespace bdlma {
+namespace {
+
+// LOCAL CONSTANTS
+enum {
+    k_DEFAULT_NUM_POOLS  = 10,    // default number of pools
+
+    k_MAX_NUM_POOLS      = 28,    // maximum number of pools
+
+    k_MIN_BLOCK_SIZE     = 8,     // block size of the first pool
+
+    k_MAGAZINE_BYTES     = 8192,  // approximate number of bytes spanned by
+                                  // the blocks of a magazine
+
+    k_MIN_MAGAZINE_SIZE  = 2,     // minimum number of blocks in a magazine
+
+    k_MAX_MAGAZINE_SIZE  = 64,    // maximum number of blocks in a magazine
+
+    k_CACHE_LINE_SIZE    = 64     // padding separating the depots of
+                                  // adjacent pools
+};
+
+                                // ============
+                                // struct Block
+                                // ============
+
+struct Block {
+    // This 'struct' provides the header preceding every memory block
+    // dispensed by a 'ThreadCachingAllocator'.  The header stores the index
+    // of the pool of the block, and, while the block is free and heads a
+    // magazine in a depot, the size of that magazine and the next magazine in
+    // the depot.  While a block is free, its first word (following the
+    // header) holds the address of the next block in its magazine.
+
+    union {
+        struct {
+            Block *d_nextMagazine_p;  // next magazine in the depot, if this
+                                      // block heads a magazine in a depot
+
+            int    d_numBlocks;       // number of blocks in the magazine, if
+                                      // this block heads a magazine in a
+                                      // depot
+
+            int    d_poolIdx;         // pool of this block, or -1 for a
+                                      // "large" block
+        } d_data;
+
+        bsls::AlignmentUtil::MaxAlignedType
+                   d_dummy;           // force maximum alignment
+    } d_header;
+};
+
+inline
+Block **nextBlock(Block *block)
+    // Return the address of the link to the next free block in the magazine
+    // holding the specified free 'block'.
+{
+    return reinterpret_cast<Block **>(block + 1);
+}
+
+}  // close unnamed namespace
+
+                  // =======================================
+                  // struct ThreadCachingAllocator::Magazine
+                  // =======================================
+
+struct ThreadCachingAllocator::Magazine {
+    // This 'struct' provides a list of free blocks of a single pool, linked
+    // through the first word of each block.
+
+    // DATA
+    Block *d_head_p;     // first free block, or 0 if empty
+    int    d_numBlocks;  // number of free blocks in the list
+
+    // MANIPULATORS
+    void push(Block *block)
+        // Add the specified 'block' to the front of this magazine.
+    {
+        *nextBlock(block) = d_head_p;
+        d_head_p          = block;
+        ++d_numBlocks;
+    }
+
+    Block *pop()
+        // Remove the block at the front of this magazine, and return its
+        // address.  The behavior is undefined unless this magazine is not
+        // empty.
+    {
+        BSLS_ASSERT_SAFE(d_head_p);
+
+        Block *block = d_head_p;
+        d_head_p     = *nextBlock(block);
+        --d_numBlocks;
+        return block;
+    }
+};
+
+                    // ====================================
+                    // struct ThreadCachingAllocator::Depot
+                    // ====================================
+
+struct ThreadCachingAllocator::Depot {
+    // This 'struct' provides the store, shared by all threads, of magazines of
+    // free blocks of a single pool.  Magazines are linked through the header
+    // of their first block.
+
+    // DATA
+    bsls::SpinLock d_lock;                         // synchronize access to
+                                                   // 'd_magazines_p'
+
+    Block         *d_magazines_p;                  // stack of magazines
+
+    const int      d_magazineSize;                 // maximum number of blocks
+                                                   // in a magazine
+
+    const int      d_blockSize;                    // distance between blocks
+                                                   // carved from a chunk,
+                                                   // including the header
+
+    char           d_padding[k_CACHE_LINE_SIZE];   // separate from the depot
+                                                   // of the next pool
+
+    // CREATORS
+    Depot(int magazineSize, int blockSize)
+        // Create an empty depot of magazines having the specified
+        // 'magazineSize' blocks of the specified 'blockSize'.
+    : d_lock(bsls::SpinLock::s_unlocked)
+    , d_magazines_p(0)
+    , d_magazineSize(magazineSize)
+    , d_blockSize(blockSize)
+    {
+    }
+
+    // MANIPULATORS
+    void deposit(const Magazine& magazine)
+        // Add the specified 'magazine', which must not be empty, to this
+        // depot.
+    {
+        BSLS_ASSERT_SAFE(magazine.d_head_p);
+
+        Block *head = magazine.d_head_p;
+        head->d_header.d_data.d_numBlocks = magazine.d_numBlocks;
+
+        bsls::SpinLockGuard guard(&d_lock);
+
+        head->d_header.d_data.d_nextMagazine_p = d_magazines_p;
+        d_magazines_p                          = head;
+    }
+
+    bool withdraw(Magazine *magazine)
+        // Load into the specified 'magazine' a magazine removed from this
+        // depot, and return 'true', if this depot is not empty; otherwise
+        // return 'false' with no effect.
+    {
+        Block *head;
+        {
+            bsls::SpinLockGuard guard(&d_lock);
+
+            head = d_magazines_p;
+            if (!head) {
+                return false;                                         // RETURN
+            }
+            d_magazines_p = head->d_header.d_data.d_nextMagazine_p;
+        }
+        magazine->d_head_p    = head;
+        magazine->d_numBlocks = head->d_header.d_data.d_numBlocks;
+        return true;
+    }
+};
+
+                 // ==========================================
+                 // struct ThreadCachingAllocator::ThreadCache
+                 // ==========================================
+
+struct ThreadCachingAllocator::ThreadCache {
+    // This 'struct' provides the cache of a single thread, holding up to two
+    // magazines of free blocks of each pool.  A cache is followed in memory by
+    // its array of bins, one per pool.
+
+    // TYPES
+    struct Bin {
+        // The magazines of free blocks of a single pool held by a thread.
+
+        Magazine d_loaded;    // magazine from which blocks are allocated,
+                              // and to which blocks are deallocated
+
+        Magazine d_previous;  // either empty or full magazine exchanged with
+                              // 'd_loaded' when it is empty or full
+
+        int      d_capacity;  // number of blocks in a full magazine
+    };
+
+    // DATA
+    ThreadCachingAllocator *d_allocator_p;  // allocator owning this cache
+
+    ThreadCache            *d_next_p;       // next cache created by
+                                            // 'd_allocator_p'
+
+    Bin                    *d_bins_p;       // array of bins, one per pool
+
+    bool                    d_inUse;        // 'true' if held by a thread
+};
+
+                  // =======================================
+                  // struct ThreadCachingAllocator_CacheUtil
+                  // =======================================
+
+struct ThreadCachingAllocator_CacheUtil {
+    // This component-private 'struct' provides a namespace for the function
+    // run on the exit of a thread holding a thread cache.
+
+    // CLASS METHODS
+    static void releaseThreadCache(void *cache)
+        // Return the specified 'cache', of type
+        // 'ThreadCachingAllocator::ThreadCache', to the allocator owning it.
+    {
+        ThreadCachingAllocator::ThreadCache *threadCache =
+                   static_cast<ThreadCachingAllocator::ThreadCache *>(cache);
+
+        threadCache->d_allocator_p->releaseThreadCache(threadCache);
+    }
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+extern "C" {
+
+static void bdlma_ThreadCachingAllocator_releaseThreadCache(void *cache)
+    // Return the specified 'cache' to the 'bdlma::ThreadCachingAllocator'
+    // owning it.  This function is registered as the destructor of the
+    // thread-specific key of each 'bdlma::ThreadCachingAllocator'.
+{
+    BloombergLP::bdlma::ThreadCachingAllocator_CacheUtil::releaseThreadCache(
+                                                                        cache);
+}
+
+}  // extern "C"
+
+namespace BloombergLP {
+namespace bdlma {
+
+                       // ----------------------------
+                       // class ThreadCachingAllocator
+                       // ----------------------------
+
+// PRIVATE MANIPULATORS
+ThreadCachingAllocator::ThreadCache *
+ThreadCachingAllocator::acquireThreadCache()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    for (ThreadCache *cache = d_caches_p; cache; cache = cache->d_next_p) {
+        if (!cache->d_inUse) {
+            cache->d_inUse = true;
+            ++d_numThreadCaches;
+            return cache;                                             // RETURN
+        }
+    }
+
+    void *memory = 0;
+    BSLS_TRY {
+        memory = d_allocator_p->allocate(
+                  sizeof(ThreadCache) + d_numPools * sizeof(ThreadCache::Bin));
+    }
+    BSLS_CATCH(...) {
+        return 0;                                                     // RETURN
+    }
+
+    ThreadCache *cache = static_cast<ThreadCache *>(memory);
+
+    cache->d_allocator_p = this;
+    cache->d_next_p      = d_caches_p;
+    cache->d_bins_p      = reinterpret_cast<ThreadCache::Bin *>(cache + 1);
+    cache->d_inUse       = true;
+
+    for (int i = 0; i < d_numPools; ++i) {
+        ThreadCache::Bin& bin = cache->d_bins_p[i];
+
+        bin.d_loaded.d_head_p      = 0;
+        bin.d_loaded.d_numBlocks   = 0;
+        bin.d_previous.d_head_p    = 0;
+        bin.d_previous.d_numBlocks = 0;
+        bin.d_capacity             = d_depots_p[i].d_magazineSize;
+    }
+
+    d_caches_p = cache;
+    ++d_numThreadCaches;
+
+    return cache;
+}
+
+void ThreadCachingAllocator::fillMagazine(Magazine *magazine, int pool)
+{
+    BSLS_ASSERT_SAFE(0 == magazine->d_numBlocks);
+
+    Depot& depot = d_depots_p[pool];
+
+    if (depot.withdraw(magazine)) {
+        return;                                                       // RETURN
+    }
+
+    const int blockSize = depot.d_blockSize;
+    const int numBlocks = depot.d_magazineSize;
+
+    char *chunk;
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        chunk = static_cast<char *>(d_chunks.allocate(
+                       static_cast<bsls::Types::size_type>(blockSize) *
+                                                                  numBlocks));
+    }
+
+    magazine->d_head_p    = 0;
+    magazine->d_numBlocks = 0;
+
+    for (int i = numBlocks - 1; 0 <= i; --i) {
+        Block *block = reinterpret_cast<Block *>(chunk + i * blockSize);
+
+        block->d_header.d_data.d_poolIdx = pool;
+        magazine->push(block);
+    }
+}
+
+void ThreadCachingAllocator::initialize()
+{
+    BSLS_ASSERT(1 <= d_numPools);
+    BSLS_ASSERT(d_numPools <= k_MAX_NUM_POOLS);
+
+    d_maxBlockSize = static_cast<bsls::Types::size_type>(k_MIN_BLOCK_SIZE)
+                                                          << (d_numPools - 1);
+
+    d_depots_p = static_cast<Depot *>(
+                          d_allocator_p->allocate(d_numPools * sizeof(Depot)));
+
+    for (int i = 0; i < d_numPools; ++i) {
+        const int blockSize = static_cast<int>(
+                               bsls::AlignmentUtil::roundUpToMaximalAlignment(
+                                     sizeof(Block) + (k_MIN_BLOCK_SIZE << i)));
+
+        int magazineSize = k_MAGAZINE_BYTES / blockSize;
+        if (magazineSize < k_MIN_MAGAZINE_SIZE) {
+            magazineSize = k_MIN_MAGAZINE_SIZE;
+        }
+        else if (magazineSize > k_MAX_MAGAZINE_SIZE) {
+            magazineSize = k_MAX_MAGAZINE_SIZE;
+        }
+
+        new (d_depots_p + i) Depot(magazineSize, blockSize);
+    }
+
+    d_hasKey = 0 == bslmt::ThreadUtil::createKey(
+                             &d_key,
+                             &bdlma_ThreadCachingAllocator_releaseThreadCache);
+}
+
+ThreadCachingAllocator::ThreadCache *ThreadCachingAllocator::localCache()
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!d_hasKey)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return 0;                                                     // RETURN
+    }
+
+    ThreadCache *cache = static_cast<ThreadCache *>(
+                                       bslmt::ThreadUtil::getSpecific(d_key));
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!cache)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        cache = acquireThreadCache();
+        if (cache && 0 != bslmt::ThreadUtil::setSpecific(d_key, cache)) {
+            releaseThreadCache(cache);
+            cache = 0;
+        }
+    }
+
+    return cache;
+}
+
+void ThreadCachingAllocator::releaseThreadCache(ThreadCache *cache)
+{
+    for (int i = 0; i < d_numPools; ++i) {
+        ThreadCache::Bin& bin = cache->d_bins_p[i];
+
+        if (bin.d_loaded.d_numBlocks) {
+            d_depots_p[i].deposit(bin.d_loaded);
+            bin.d_loaded.d_head_p    = 0;
+            bin.d_loaded.d_numBlocks = 0;
+        }
+        if (bin.d_previous.d_numBlocks) {
+            d_depots_p[i].deposit(bin.d_previous);
+            bin.d_previous.d_head_p    = 0;
+            bin.d_previous.d_numBlocks = 0;
+        }
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    cache->d_inUse = false;
+    --d_numThreadCaches;
+}
+
+// PRIVATE ACCESSORS
+int ThreadCachingAllocator::findPool(bsls::Types::size_type size) const
+{
+    BSLS_ASSERT_SAFE(0 < size);
+    BSLS_ASSERT_SAFE(size <= d_maxBlockSize);
+
+    return 31 - bdlb::BitUtil::numLeadingUnsetBits(static_cast<bsl::uint32_t>(
+                                ((size + k_MIN_BLOCK_SIZE - 1) >> 3) * 2 - 1));
+}
+
+// CREATORS
+ThreadCachingAllocator::ThreadCachingAllocator(
+                                              bslma::Allocator *basicAllocator)
+: d_depots_p(0)
+, d_numPools(k_DEFAULT_NUM_POOLS)
+, d_maxBlockSize(0)
+, d_key()
+, d_hasKey(false)
+, d_caches_p(0)
+, d_numThreadCaches(0)
+, d_chunks(basicAllocator)
+, d_blockList(basicAllocator)
+, d_mutex()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    initialize();
+}
+
+ThreadCachingAllocator::ThreadCachingAllocator(
+                                              int               numPools,
+                                              bslma::Allocator *basicAllocator)
+: d_depots_p(0)
+, d_numPools(numPools)
+, d_maxBlockSize(0)
+, d_key()
+, d_hasKey(false)
+, d_caches_p(0)
+, d_numThreadCaches(0)
+, d_chunks(basicAllocator)
+, d_blockList(basicAllocator)
+, d_mutex()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    initialize();
+}
+
+ThreadCachingAllocator::~ThreadCachingAllocator()
+{
+    if (d_hasKey) {
+        bslmt::ThreadUtil::deleteKey(d_key);
+    }
+
+    ThreadCache *cache = d_caches_p;
+    while (cache) {
+        ThreadCache *next = cache->d_next_p;
+        d_allocator_p->deallocate(cache);
+        cache = next;
+    }
+
+    for (int i = 0; i < d_numPools; ++i) {
+        d_depots_p[i].~Depot();
+    }
+    d_allocator_p->deallocate(d_depots_p);
+}
+
+// MANIPULATORS
+void *ThreadCachingAllocator::allocate(bsls::Types::size_type size)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == size)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return 0;                                                     // RETURN
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(size > d_maxBlockSize)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        // The requested size is large and will not be pooled.
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        Block *block = static_cast<Block *>(
+                                 d_blockList.allocate(size + sizeof(Block)));
+
+        block->d_header.d_data.d_poolIdx = -1;
+
+        return block + 1;                                             // RETURN
+    }
+
+    const int    pool  = findPool(size);
+    ThreadCache *cache = localCache();
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!cache)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        Magazine magazine = { 0, 0 };
+        fillMagazine(&magazine, pool);
+
+        Block *block = magazine.pop();
+        if (magazine.d_numBlocks) {
+            d_depots_p[pool].deposit(magazine);
+        }
+        return block + 1;                                             // RETURN
+    }
+
+    ThreadCache::Bin& bin = cache->d_bins_p[pool];
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == bin.d_loaded.d_numBlocks)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        if (bin.d_previous.d_numBlocks) {
+            bin.d_loaded               = bin.d_previous;
+            bin.d_previous.d_head_p    = 0;
+            bin.d_previous.d_numBlocks = 0;
+        }
+        else {
+            fillMagazine(&bin.d_loaded, pool);
+        }
+    }
+
+    return bin.d_loaded.pop() + 1;
+}
+
+void ThreadCachingAllocator::deallocate(void *address)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == address)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return;                                                       // RETURN
+    }
+
+    Block     *block = static_cast<Block *>(address) - 1;
+    const int  pool  = block->d_header.d_data.d_poolIdx;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(-1 == pool)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        d_blockList.deallocate(block);
+        return;                                                       // RETURN
+    }
+
+    BSLS_ASSERT_SAFE(0 <= pool);
+    BSLS_ASSERT_SAFE(pool < d_numPools);
+
+    ThreadCache *cache = localCache();
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!cache)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        Magazine magazine = { 0, 0 };
+        magazine.push(block);
+        d_depots_p[pool].deposit(magazine);
+        return;                                                       // RETURN
+    }
+
+    ThreadCache::Bin& bin = cache->d_bins_p[pool];
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(bin.d_loaded.d_numBlocks ==
+                                              bin.d_capacity)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        // 'd_loaded' is full: retire 'd_previous' to the depot if it is
+        // full too, and start a new magazine.
+
+        if (bin.d_previous.d_numBlocks) {
+            d_depots_p[pool].deposit(bin.d_previous);
+        }
+        bin.d_previous           = bin.d_loaded;
+        bin.d_loaded.d_head_p    = 0;
+        bin.d_loaded.d_numBlocks = 0;
+    }
+
+    bin.d_loaded.push(block);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
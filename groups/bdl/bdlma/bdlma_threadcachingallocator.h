@@ -0,0 +1,385 @@
+// bdlma_threadcachingallocator.h                                     -*-C++-*-
+#ifndef INCLUDED_BDLMA_THREADCACHINGALLOCATOR
+#define INCLUDED_BDLMA_THREADCACHINGALLOCATOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a multipool allocator with per-thread block caches.
+//
+//@CLASSES:
+//  bdlma::ThreadCachingAllocator: pooling allocator with per-thread caches
+//
+//@SEE_ALSO: bdlma_concurrentmultipoolallocator, bdlma_concurrentpool
+//
+//@DESCRIPTION: This component provides a thread-safe allocator,
+// 'bdlma::ThreadCachingAllocator', that implements the 'bslma::Allocator'
+// protocol and, like 'bdlma::ConcurrentMultipoolAllocator', dispenses memory
+// blocks from a configurable number of pools, each managing blocks of a
+// unique size.  The block size of the first pool is 8 bytes, with the block
+// size of each successive pool doubling.  Requests larger than the block size
+// of the last pool are satisfied by the allocator supplied at construction.
+//..
+//   ,-----------------------------.
+//  ( bdlma::ThreadCachingAllocator )
+//   `-----------------------------'
+//                  |         ctor/dtor
+//                  |         maxPooledBlockSize
+//                  |         numPools
+//                  |         numThreadCaches
+//                  V
+//          ,----------------.
+//         ( bslma::Allocator )
+//          `----------------'
+//                            allocate
+//                            deallocate
+//..
+// Unlike the pools of 'bdlma::ConcurrentMultipool', which every thread
+// updates through a single atomic free-list head per block size, the pools of
+// a 'bdlma::ThreadCachingAllocator' give each thread that uses the allocator a
+// private cache of free blocks for every block size.  Allocation and
+// deallocation are satisfied from, and returned to, the cache of the calling
+// thread without any synchronization, so that threads do not contend on a
+// shared cache line in the common case.
+//
+///Magazines and the Depot
+///-----------------------
+// The free blocks of each cache are held in *magazines*: lists of up to a
+// fixed number of blocks, where that number is chosen (per block size) so
+// that a magazine spans several kilobytes.  Each thread holds at most two
+// magazines per block size, so the memory retained by a thread's cache is
+// bounded.  When both magazines of a thread are full, a deallocation moves
+// one full magazine to a *depot* shared by all threads; when both are empty,
+// an allocation takes a magazine from the depot, or, if the depot is empty,
+// carves a new magazine from a chunk obtained from the allocator supplied at
+// construction.  The depot is synchronized with a spin lock, which is taken
+// once per magazine, and not once per block.
+//
+// Blocks need not be returned to the thread that allocated them.  In a
+// producer-consumer pattern, the consumer's deallocations fill its own
+// magazines, which it hands to the depot one whole magazine at a time, and the
+// producer's allocations take whole magazines from the depot.  A block freed
+// by another thread thus costs no more than a block freed by its allocating
+// thread.
+//
+// When a thread exits, the magazines in its cache are moved to the depot, and
+// the cache is retained for reuse by a thread created later.  Memory obtained
+// from the allocator supplied at construction is returned only when the
+// 'bdlma::ThreadCachingAllocator' is destroyed.
+//
+///Thread Safety
+///-------------
+// The 'allocate' and 'deallocate' methods of 'bdlma::ThreadCachingAllocator'
+// are fully thread-safe (see 'bsldoc_glossary'), provided that the allocator
+// supplied at construction is fully thread-safe.  An allocator must not be
+// destroyed while other threads may still use it, or may be exiting after
+// having used it.
+//
+// Each 'bdlma::ThreadCachingAllocator' object reserves a thread-specific
+// storage key (see 'bslmt_threadutil') for its lifetime.  If no key is
+// available at construction, the object operates correctly without
+// per-thread caches, allocating from and deallocating to the depot directly.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Passing Messages Between Threads
+///- - - - - - - - - - - - - - - - - - - - - -
+// A 'bdlma::ThreadCachingAllocator' suits workloads in which many threads
+// allocate and free small objects concurrently, including objects freed by a
+// thread other than the one that allocated them.  In this example, a producer
+// thread allocates messages that a consumer thread frees.
+//
+// First, we define the message type and a simple queue that the producer uses
+// to hand messages to the consumer:
+//..
+//  struct Message {
+//      int  d_sequenceNumber;
+//      char d_payload[52];
+//  };
+//
+//  struct MessageQueue {
+//      bslmt::Mutex                   d_mutex;
+//      bslmt::Condition               d_condition;
+//      bsl::deque<Message *>          d_messages;
+//      bdlma::ThreadCachingAllocator *d_allocator_p;
+//  };
+//..
+// Next, we define the consumer, which frees every message it receives, and
+// stops on receipt of a null message:
+//..
+//  extern "C" void *consume(void *arg)
+//  {
+//      MessageQueue *queue = static_cast<MessageQueue *>(arg);
+//
+//      while (true) {
+//          Message *message;
+//          {
+//              bslmt::LockGuard<bslmt::Mutex> guard(&queue->d_mutex);
+//              while (queue->d_messages.empty()) {
+//                  queue->d_condition.wait(&queue->d_mutex);
+//              }
+//              message = queue->d_messages.front();
+//              queue->d_messages.pop_front();
+//          }
+//          if (!message) {
+//              break;
+//          }
+//          queue->d_allocator_p->deleteObject(message);
+//      }
+//      return 0;
+//  }
+//..
+// Then, we create the allocator and the queue, and start the consumer:
+//..
+//  bdlma::ThreadCachingAllocator allocator;
+//
+//  MessageQueue queue;
+//  queue.d_allocator_p = &allocator;
+//
+//  bslmt::ThreadUtil::Handle handle;
+//  bslmt::ThreadUtil::create(&handle, consume, &queue);
+//..
+// Now, the producer allocates the messages.  Once the consumer has returned a
+// magazine of messages to the depot, the producer reuses those blocks:
+//..
+//  for (int i = 0; i < 1000; ++i) {
+//      Message *message = new (allocator) Message();
+//      message->d_sequenceNumber = i;
+//
+//      bslmt::LockGuard<bslmt::Mutex> guard(&queue.d_mutex);
+//      queue.d_messages.push_back(message);
+//      queue.d_condition.signal();
+//  }
+//..
+// Finally, we stop the consumer, and wait for it to exit:
+//..
+//  {
+//      bslmt::LockGuard<bslmt::Mutex> guard(&queue.d_mutex);
+//      queue.d_messages.push_back(0);
+//      queue.d_condition.signal();
+//  }
+//  bslmt::ThreadUtil::join(handle);
+//
+//  assert(1 == allocator.numThreadCaches());
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlma_blocklist.h>
+#include <bdlma_infrequentdeleteblocklist.h>
+
+#include <bslma_allocator.h>
+
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace bdlma {
+
+struct ThreadCachingAllocator_CacheUtil;
+
+                       // ============================
+                       // class ThreadCachingAllocator
+                       // ============================
+
+class ThreadCachingAllocator : public bslma::Allocator {
+    // This class implements the 'bslma::Allocator' protocol to provide a
+    // thread-safe allocator that dispenses memory blocks from a configurable
+    // number of pools, each managing blocks of a unique size, and that gives
+    // each thread using it a bounded private cache of free blocks for each
+    // pool.  Requests for blocks larger than the block size of the last pool
+    // are satisfied from a separately managed list of memory blocks.  The
+    // destructor releases all memory allocated via this object.
+
+    // PRIVATE TYPES
+    struct Depot;
+        // Shared store of magazines of free blocks for a single pool.
+
+    struct Magazine;
+        // List of free blocks of a single pool.
+
+    struct ThreadCache;
+        // Per-thread cache of magazines of free blocks for every pool.
+
+    // DATA
+    Depot                     *d_depots_p;      // array of 'd_numPools'
+                                                // depots, one per pool
+
+    int                        d_numPools;      // number of pools
+
+    bsls::Types::size_type     d_maxBlockSize;  // block size of the last
+                                                // pool; always a power of 2
+
+    bslmt::ThreadUtil::Key     d_key;           // key of the thread cache of
+                                                // each thread
+
+    bool                       d_hasKey;        // 'true' if 'd_key' was
+                                                // created
+
+    ThreadCache               *d_caches_p;      // list of every thread cache
+                                                // created by this object
+
+    bsls::AtomicInt            d_numThreadCaches;
+                                                // number of thread caches in
+                                                // use by a thread
+
+    InfrequentDeleteBlockList  d_chunks;        // chunks from which
+                                                // magazines are carved
+
+    BlockList                  d_blockList;     // memory manager for "large"
+                                                // memory blocks
+
+    bslmt::Mutex               d_mutex;         // synchronize access to
+                                                // 'd_caches_p', 'd_chunks',
+                                                // and 'd_blockList'
+
+    bslma::Allocator          *d_allocator_p;   // memory allocator (held, not
+                                                // owned)
+
+    // FRIENDS
+    friend struct ThreadCachingAllocator_CacheUtil;
+
+  private:
+    // NOT IMPLEMENTED
+    ThreadCachingAllocator(const ThreadCachingAllocator&);
+    ThreadCachingAllocator& operator=(const ThreadCachingAllocator&);
+
+  private:
+    // PRIVATE MANIPULATORS
+    ThreadCache *acquireThreadCache();
+        // Return the address of a thread cache, not in use by any other
+        // thread, for the calling thread to use, reusing a cache released by
+        // an exited thread if one is available, or 0 if no cache can be
+        // created.
+
+    void fillMagazine(Magazine *magazine, int pool);
+        // Load into the specified 'magazine', which must be empty, a magazine
+        // of free blocks of the specified 'pool', taken from the depot of
+        // 'pool' if it is not empty, and carved from a newly allocated chunk
+        // otherwise.
+
+    void initialize();
+        // Allocate the depots of this object, and create the key of its
+        // thread caches.
+
+    ThreadCache *localCache();
+        // Return the address of the thread cache of the calling thread,
+        // acquiring one if the calling thread has none, or 0 if the calling
+        // thread cannot obtain a cache.
+
+    void releaseThreadCache(ThreadCache *cache);
+        // Move every magazine of the specified 'cache' to the depots of this
+        // object, and make 'cache' available for reuse by another thread.
+
+    // PRIVATE ACCESSORS
+    int findPool(bsls::Types::size_type size) const;
+        // Return the index of the pool in this object for an allocation
+        // request of the specified 'size' (in bytes).  The behavior is
+        // undefined unless '0 < size <= maxPooledBlockSize()'.
+
+  public:
+    // CREATORS
+    explicit
+    ThreadCachingAllocator(bslma::Allocator *basicAllocator = 0);
+    explicit
+    ThreadCachingAllocator(int numPools, bslma::Allocator *basicAllocator = 0);
+        // Create a thread-caching allocator.  Optionally specify 'numPools',
+        // indicating the number of internally maintained pools; the block
+        // size of the first pool is 8 bytes, with the block size of each
+        // additional pool successively doubling.  If 'numPools' is not
+        // specified, an implementation-defined number of pools 'N' --
+        // covering memory blocks ranging in size from '2^3 = 8' to '2^(N+2)'
+        // -- are maintained.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  The behavior is undefined unless
+        // '1 <= numPools <= 28' and 'basicAllocator' is fully thread-safe.
+
+    virtual ~ThreadCachingAllocator();
+        // Destroy this allocator, and release all memory allocated via this
+        // object.  The behavior is undefined if another thread uses this
+        // object, or exits after having used this object, during its
+        // destruction.
+
+    // MANIPULATORS
+    virtual void *allocate(bsls::Types::size_type size);
+        // Return the address of a contiguous block of maximally-aligned memory
+        // of (at least) the specified 'size' (in bytes).  If 'size' is 0, no
+        // memory is allocated and 0 is returned.  If
+        // 'size <= maxPooledBlockSize()', the block is taken from the cache of
+        // the calling thread for the pool managing blocks of the smallest size
+        // not less than 'size'.
+
+    virtual void deallocate(void *address);
+        // Return the memory block at the specified 'address' back to this
+        // allocator.  If 'address' is 0, this function has no effect.  The
+        // behavior is undefined unless 'address' was allocated using this
+        // allocator object and has not already been deallocated.  Note that
+        // 'address' may have been allocated by a thread other than the calling
+        // thread.
+
+    // ACCESSORS
+    bsls::Types::size_type maxPooledBlockSize() const;
+        // Return the largest block size managed by the pools of this
+        // allocator.
+
+    int numPools() const;
+        // Return the number of pools managed by this allocator.
+
+    int numThreadCaches() const;
+        // Return the number of threads that currently hold a cache of this
+        // allocator.  Note that a thread holds a cache from its first use of
+        // this allocator until it exits.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                       // ----------------------------
+                       // class ThreadCachingAllocator
+                       // ----------------------------
+
+// ACCESSORS
+inline
+bsls::Types::size_type ThreadCachingAllocator::maxPooledBlockSize() const
+{
+    return d_maxBlockSize;
+}
+
+inline
+int ThreadCachingAllocator::numPools() const
+{
+    return d_numPools;
+}
+
+inline
+int ThreadCachingAllocator::numThreadCaches() const
+{
+    return d_numThreadCaches.loadRelaxed();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,900 @@
+// bdlma_threadcachingallocator.t.cpp                                 -*-C++-*-
+#include <bdlma_threadcachingallocator.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_condition.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_deque.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// 'bdlma::ThreadCachingAllocator' is a thread-safe pooling allocator that
+// keeps a bounded cache of free blocks per thread, exchanging whole magazines
+// of blocks with a depot shared by all threads.  The primary concerns are that
+// 'allocate' returns distinct, maximally-aligned blocks of sufficient size,
+// that blocks are reused once deallocated, including blocks deallocated by
+// another thread, that the caches of exited threads are reused, and that the
+// destructor returns all memory to the allocator supplied at construction.
+// We make heavy use of 'bslma::TestAllocator' to observe the memory obtained
+// from the underlying allocator.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] ThreadCachingAllocator(Allocator *ba = 0);
+// [ 2] ThreadCachingAllocator(int numPools, Allocator *ba = 0);
+// [ 2] ~ThreadCachingAllocator();
+//
+// MANIPULATORS
+// [ 3] void *allocate(bsls::Types::size_type size);
+// [ 3] void deallocate(void *address);
+//
+// ACCESSORS
+// [ 2] bsls::Types::size_type maxPooledBlockSize() const;
+// [ 2] int numPools() const;
+// [ 4] int numThreadCaches() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// [ 4] CONCERN: Blocks freed by one thread are reused by another thread.
+// [ 4] CONCERN: The caches of exited threads are reused.
+// [ 5] CONCERN: The 'allocate' and 'deallocate' methods are thread-safe.
+// [ *] CONCERN: In no case does memory come from the global allocator.
+
+// ============================================================================
+//                    STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL VARIABLES / TYPEDEFS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bdlma::ThreadCachingAllocator Obj;
+
+static const bsls::Types::size_type MAX_ALIGN =
+                                       bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+
+// ============================================================================
+//                  HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static
+bool isMaximallyAligned(const void *address)
+    // Return 'true' if the specified 'address' is maximally aligned, and
+    // 'false' otherwise.
+{
+    return 0 == reinterpret_cast<bsls::Types::UintPtr>(address) % MAX_ALIGN;
+}
+
+namespace TestCase4 {
+
+struct ThreadInfo {
+    Obj            *d_obj_p;     // allocator under test
+    int             d_size;      // size of each block
+    int             d_numBlocks; // number of blocks
+    bsl::vector<void *>
+                   *d_blocks_p;  // blocks allocated or to deallocate
+};
+
+extern "C" void *allocateBlocks(void *arg)
+{
+    ThreadInfo *info = static_cast<ThreadInfo *>(arg);
+
+    for (int i = 0; i < info->d_numBlocks; ++i) {
+        void *p = info->d_obj_p->allocate(info->d_size);
+        bsl::memset(p, 0xa5, info->d_size);
+        (*info->d_blocks_p)[i] = p;
+    }
+    return arg;
+}
+
+extern "C" void *deallocateBlocks(void *arg)
+{
+    ThreadInfo *info = static_cast<ThreadInfo *>(arg);
+
+    for (int i = 0; i < info->d_numBlocks; ++i) {
+        info->d_obj_p->deallocate((*info->d_blocks_p)[i]);
+    }
+    return arg;
+}
+
+}  // close namespace TestCase4
+
+namespace TestCase5 {
+
+enum {
+    k_NUM_PAIRS      = 4,     // number of producer-consumer pairs
+    k_NUM_MESSAGES   = 20000, // messages sent by each producer
+    k_QUEUE_CAPACITY = 256    // maximum messages in flight per pair
+};
+
+struct Channel {
+    // A bounded queue of blocks passed from a producer to a consumer.
+
+    bslmt::Mutex      d_mutex;
+    bslmt::Condition  d_notEmpty;
+    bslmt::Condition  d_notFull;
+    bsl::deque<int *> d_queue;
+    Obj              *d_obj_p;
+    bslmt::Barrier   *d_barrier_p;
+    int               d_numErrors;
+};
+
+static
+int sizeOf(int sequenceNumber)
+    // Return the size, in bytes, of the block carrying the specified
+    // 'sequenceNumber'.  Sizes cycle through every pool, and occasionally
+    // exceed the largest pooled block size.
+{
+    static const int SIZES[] = { 4, 8, 24, 40, 100, 250, 600, 1200, 4096,
+                                 5000 };
+    return SIZES[sequenceNumber % (sizeof SIZES / sizeof *SIZES)];
+}
+
+extern "C" void *producer(void *arg)
+{
+    Channel *channel = static_cast<Channel *>(arg);
+
+    channel->d_barrier_p->wait();
+
+    for (int i = 0; i < k_NUM_MESSAGES; ++i) {
+        const int  size  = sizeOf(i);
+        int       *block = static_cast<int *>(
+                                            channel->d_obj_p->allocate(size));
+
+        const int n = size / static_cast<int>(sizeof(int));
+        for (int j = 0; j < n; ++j) {
+            block[j] = i;
+        }
+
+        // Allocate and free a short-lived block locally as well.
+
+        void *local = channel->d_obj_p->allocate(sizeOf(i + 3));
+        bsl::memset(local, 0x5a, sizeOf(i + 3));
+        channel->d_obj_p->deallocate(local);
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&channel->d_mutex);
+        while (channel->d_queue.size() >= k_QUEUE_CAPACITY) {
+            channel->d_notFull.wait(&channel->d_mutex);
+        }
+        channel->d_queue.push_back(block);
+        channel->d_notEmpty.signal();
+    }
+    return arg;
+}
+
+extern "C" void *consumer(void *arg)
+{
+    Channel *channel = static_cast<Channel *>(arg);
+
+    channel->d_barrier_p->wait();
+
+    for (int i = 0; i < k_NUM_MESSAGES; ++i) {
+        int *block;
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&channel->d_mutex);
+            while (channel->d_queue.empty()) {
+                channel->d_notEmpty.wait(&channel->d_mutex);
+            }
+            block = channel->d_queue.front();
+            channel->d_queue.pop_front();
+            channel->d_notFull.signal();
+        }
+
+        const int n = sizeOf(i) / static_cast<int>(sizeof(int));
+        for (int j = 0; j < n; ++j) {
+            if (block[j] != i) {
+                ++channel->d_numErrors;
+                break;
+            }
+        }
+        channel->d_obj_p->deallocate(block);
+    }
+    return arg;
+}
+
+}  // close namespace TestCase5
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace UsageExample {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Passing Messages Between Threads
+///- - - - - - - - - - - - - - - - - - - - - -
+// A 'bdlma::ThreadCachingAllocator' suits workloads in which many threads
+// allocate and free small objects concurrently, including objects freed by a
+// thread other than the one that allocated them.  In this example, a producer
+// thread allocates messages that a consumer thread frees.
+//
+// First, we define the message type and a simple queue that the producer uses
+// to hand messages to the consumer:
+//..
+    struct Message {
+        int  d_sequenceNumber;
+        char d_payload[52];
+    };
+
+    struct MessageQueue {
+        bslmt::Mutex                   d_mutex;
+        bslmt::Condition               d_condition;
+        bsl::deque<Message *>          d_messages;
+        bdlma::ThreadCachingAllocator *d_allocator_p;
+    };
+//..
+// Next, we define the consumer, which frees every message it receives, and
+// stops on receipt of a null message:
+//..
+    extern "C" void *consume(void *arg)
+    {
+        MessageQueue *queue = static_cast<MessageQueue *>(arg);
+
+        while (true) {
+            Message *message;
+            {
+                bslmt::LockGuard<bslmt::Mutex> guard(&queue->d_mutex);
+                while (queue->d_messages.empty()) {
+                    queue->d_condition.wait(&queue->d_mutex);
+                }
+                message = queue->d_messages.front();
+                queue->d_messages.pop_front();
+            }
+            if (!message) {
+                break;
+            }
+            queue->d_allocator_p->deleteObject(message);
+        }
+        return 0;
+    }
+//..
+
+}  // close namespace UsageExample
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4; (void)veryVeryVerbose;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        using namespace UsageExample;
+
+// Then, we create the allocator and the queue, and start the consumer:
+//..
+    bdlma::ThreadCachingAllocator allocator;
+
+    MessageQueue queue;
+    queue.d_allocator_p = &allocator;
+
+    bslmt::ThreadUtil::Handle handle;
+    bslmt::ThreadUtil::create(&handle, consume, &queue);
+//..
+// Now, the producer allocates the messages.  Once the consumer has returned a
+// magazine of messages to the depot, the producer reuses those blocks:
+//..
+    for (int i = 0; i < 1000; ++i) {
+        Message *message = new (allocator) Message();
+        message->d_sequenceNumber = i;
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&queue.d_mutex);
+        queue.d_messages.push_back(message);
+        queue.d_condition.signal();
+    }
+//..
+// Finally, we stop the consumer, and wait for it to exit:
+//..
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&queue.d_mutex);
+        queue.d_messages.push_back(0);
+        queue.d_condition.signal();
+    }
+    bslmt::ThreadUtil::join(handle);
+
+    ASSERT(1 == allocator.numThreadCaches());
+//..
+
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY TEST
+        //
+        // Concerns:
+        //: 1 Concurrent calls to 'allocate' and 'deallocate', including
+        //:   deallocation of blocks allocated by other threads, never return
+        //:   a block in use.
+        //:
+        //: 2 All memory is returned to the underlying allocator on
+        //:   destruction.
+        //
+        // Plan:
+        //: 1 Run several pairs of threads, in which one thread allocates
+        //:   blocks of varying sizes, fills them with a sequence number, and
+        //:   passes them through a bounded queue to the other thread, which
+        //:   verifies the contents of each block and deallocates it.  Each
+        //:   producer also allocates and deallocates short-lived blocks.
+        //:   (C-1)
+        //:
+        //: 2 Verify that the test allocator supplied at construction has no
+        //:   outstanding memory after the allocator is destroyed.  (C-2)
+        //
+        // Testing:
+        //   CONCERN: The 'allocate' and 'deallocate' methods are thread-safe.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY TEST" << endl
+                          << "================" << endl;
+
+        using namespace TestCase5;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        {
+            Obj mX(&oa);
+
+            bslmt::Barrier barrier(2 * k_NUM_PAIRS);
+
+            Channel channels[k_NUM_PAIRS];
+
+            bslmt::ThreadUtil::Handle producers[k_NUM_PAIRS];
+            bslmt::ThreadUtil::Handle consumers[k_NUM_PAIRS];
+
+            for (int i = 0; i < k_NUM_PAIRS; ++i) {
+                channels[i].d_obj_p     = &mX;
+                channels[i].d_barrier_p = &barrier;
+                channels[i].d_numErrors = 0;
+
+                ASSERT(0 == bslmt::ThreadUtil::create(&producers[i],
+                                                      producer,
+                                                      &channels[i]));
+                ASSERT(0 == bslmt::ThreadUtil::create(&consumers[i],
+                                                      consumer,
+                                                      &channels[i]));
+            }
+
+            for (int i = 0; i < k_NUM_PAIRS; ++i) {
+                bslmt::ThreadUtil::join(producers[i]);
+                bslmt::ThreadUtil::join(consumers[i]);
+
+                ASSERTV(i, channels[i].d_numErrors,
+                        0 == channels[i].d_numErrors);
+                ASSERTV(i, channels[i].d_queue.empty());
+            }
+
+            ASSERTV(mX.numThreadCaches(), 0 == mX.numThreadCaches());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CROSS-THREAD REUSE
+        //
+        // Concerns:
+        //: 1 Blocks deallocated by a thread other than the thread that
+        //:   allocated them are reused by subsequent allocations of other
+        //:   threads, without obtaining more memory from the underlying
+        //:   allocator.
+        //:
+        //: 2 A thread acquires a cache on its first use of the allocator, and
+        //:   releases it on exit, when 'numThreadCaches' reflects the change.
+        //:
+        //: 3 The cache of an exited thread is reused by a thread created
+        //:   later.
+        //
+        // Plan:
+        //: 1 In one thread, allocate many blocks of one size.  In a second
+        //:   thread, deallocate them.  In a third thread, allocate the same
+        //:   number of blocks of the same size, and verify that no memory is
+        //:   obtained from the test allocator supplied at construction.
+        //:   (C-1, 3)
+        //:
+        //: 2 Verify 'numThreadCaches' before and after the calling thread
+        //:   uses the allocator, and after each other thread exits.  (C-2)
+        //
+        // Testing:
+        //   int numThreadCaches() const;
+        //   CONCERN: Blocks freed by one thread are reused by another thread.
+        //   CONCERN: The caches of exited threads are reused.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CROSS-THREAD REUSE" << endl
+                          << "==================" << endl;
+
+        using namespace TestCase4;
+
+        const int SIZES[]   = { 1, 8, 64, 200, 1024, 4096 };
+        const int NUM_SIZES = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+        const int NUM_BLOCKS = 1000;
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int SIZE = SIZES[ti];
+
+            if (veryVerbose) { T_ P(SIZE) }
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            {
+                Obj mX(&oa);  const Obj& X = mX;
+
+                ASSERTV(SIZE, 0 == X.numThreadCaches());
+
+                bsl::vector<void *> blocks(NUM_BLOCKS, &oa);
+
+                ThreadInfo info = { &mX, SIZE, NUM_BLOCKS, &blocks };
+
+                bslmt::ThreadUtil::Handle handle;
+
+                ASSERT(0 == bslmt::ThreadUtil::create(&handle,
+                                                      allocateBlocks,
+                                                      &info));
+                bslmt::ThreadUtil::join(handle);
+                ASSERTV(SIZE, 0 == X.numThreadCaches());
+
+                for (int i = 0; i < NUM_BLOCKS; ++i) {
+                    for (int j = 0; j < i; ++j) {
+                        if (blocks[i] == blocks[j]) {
+                            ASSERTV(SIZE, i, j, blocks[i] != blocks[j]);
+                        }
+                    }
+                }
+
+                ASSERT(0 == bslmt::ThreadUtil::create(&handle,
+                                                      deallocateBlocks,
+                                                      &info));
+                bslmt::ThreadUtil::join(handle);
+                ASSERTV(SIZE, 0 == X.numThreadCaches());
+
+                const bsls::Types::Int64 NUM_BLOCKS_TOTAL =
+                                                          oa.numBlocksTotal();
+
+                ASSERT(0 == bslmt::ThreadUtil::create(&handle,
+                                                      allocateBlocks,
+                                                      &info));
+                bslmt::ThreadUtil::join(handle);
+                ASSERTV(SIZE, 0 == X.numThreadCaches());
+
+                ASSERTV(SIZE, NUM_BLOCKS_TOTAL, oa.numBlocksTotal(),
+                        NUM_BLOCKS_TOTAL == oa.numBlocksTotal());
+
+                // The calling thread acquires a cache on first use.
+
+                void *p = mX.allocate(SIZE);
+                ASSERTV(SIZE, 1 == X.numThreadCaches());
+                mX.deallocate(p);
+                ASSERTV(SIZE, 1 == X.numThreadCaches());
+
+                for (int i = 0; i < NUM_BLOCKS; ++i) {
+                    mX.deallocate(blocks[i]);
+                }
+            }
+            ASSERTV(SIZE, oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // ALLOCATE AND DEALLOCATE
+        //
+        // Concerns:
+        //: 1 'allocate' returns a maximally-aligned block of at least the
+        //:   requested size, distinct from every block in use, for both
+        //:   pooled and "large" sizes.
+        //:
+        //: 2 'allocate(0)' returns 0, and 'deallocate(0)' has no effect.
+        //:
+        //: 3 A block deallocated by the calling thread is reused by the next
+        //:   allocation of a block from the same pool.
+        //:
+        //: 4 Memory for pooled blocks is obtained from the underlying
+        //:   allocator a magazine at a time, and "large" blocks are returned
+        //:   to the underlying allocator on deallocation.
+        //:
+        //: 5 The memory retained by the cache of a thread is bounded.
+        //
+        // Plan:
+        //: 1 For every size up to twice 'maxPooledBlockSize', allocate a
+        //:   block, fill it, and verify its alignment and that it does not
+        //:   overlap the previously allocated blocks.  (C-1)
+        //:
+        //: 2 Verify 'allocate(0)' and 'deallocate(0)' directly.  (C-2)
+        //:
+        //: 3 Deallocate a block, and verify that the next allocation of the
+        //:   same size returns the same address.  (C-3)
+        //:
+        //: 4 Monitor the blocks obtained from the test allocator supplied at
+        //:   construction for pooled and "large" allocations.  (C-4)
+        //:
+        //: 5 Allocate and deallocate many blocks of one size in two threads
+        //:   alternately, and verify that the number of blocks obtained from
+        //:   the underlying allocator stays bounded.  (C-5)
+        //
+        // Testing:
+        //   void *allocate(bsls::Types::size_type size);
+        //   void deallocate(void *address);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ALLOCATE AND DEALLOCATE" << endl
+                          << "=======================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        if (verbose) cout << "\nTesting sizes and alignment." << endl;
+        {
+            Obj mX(3, &oa);  const Obj& X = mX;
+
+            const int MAX_SIZE = 2 * static_cast<int>(X.maxPooledBlockSize());
+
+            bsl::vector<char *> blocks(&oa);
+            bsl::vector<int>    sizes(&oa);
+
+            for (int size = 1; size <= MAX_SIZE; ++size) {
+                char *p = static_cast<char *>(mX.allocate(size));
+
+                ASSERTV(size, p);
+                ASSERTV(size, isMaximallyAligned(p));
+
+                bsl::memset(p, size & 0xff, size);
+
+                for (bsl::size_t i = 0; i < blocks.size(); ++i) {
+                    ASSERTV(size, i, p + size <= blocks[i]
+                                  || blocks[i] + sizes[i] <= p);
+                }
+                blocks.push_back(p);
+                sizes.push_back(size);
+            }
+
+            for (bsl::size_t i = 0; i < blocks.size(); ++i) {
+                for (int j = 0; j < sizes[i]; ++j) {
+                    if ((sizes[i] & 0xff) != (blocks[i][j] & 0xff)) {
+                        ASSERTV(i, j, !"Block overwritten");
+                        break;
+                    }
+                }
+                mX.deallocate(blocks[i]);
+            }
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting 'allocate(0)' and 'deallocate(0)'."
+                          << endl;
+        {
+            Obj mX(&oa);
+
+            const bsls::Types::Int64 NUM_BLOCKS = oa.numBlocksTotal();
+
+            ASSERT(0 == mX.allocate(0));
+            mX.deallocate(0);
+
+            ASSERT(NUM_BLOCKS == oa.numBlocksTotal());
+        }
+
+        if (verbose) cout << "\nTesting reuse and underlying allocations."
+                          << endl;
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            void *p = mX.allocate(24);
+
+            // The first allocation obtains a thread cache and a chunk.
+
+            const bsls::Types::Int64 NUM_BLOCKS = oa.numBlocksTotal();
+
+            mX.deallocate(p);
+            void *q = mX.allocate(17);
+            ASSERTV(p, q, p == q);
+
+            for (int i = 0; i < 10; ++i) {
+                void *r = mX.allocate(32);
+                mX.deallocate(r);
+            }
+            ASSERTV(NUM_BLOCKS, oa.numBlocksTotal(),
+                    NUM_BLOCKS == oa.numBlocksTotal());
+
+            const bsls::Types::size_type LARGE = X.maxPooledBlockSize() + 1;
+
+            void *large = mX.allocate(LARGE);
+            ASSERTV(NUM_BLOCKS + 1 == oa.numBlocksTotal());
+            ASSERT(isMaximallyAligned(large));
+
+            const bsls::Types::Int64 IN_USE = oa.numBlocksInUse();
+            mX.deallocate(large);
+            ASSERTV(IN_USE - 1 == oa.numBlocksInUse());
+
+            mX.deallocate(q);
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting that thread caches are bounded."
+                          << endl;
+        {
+            Obj mX(&oa);
+
+            const int NUM_BLOCKS = 5000;
+
+            bsl::vector<void *> blocks(NUM_BLOCKS, &oa);
+
+            TestCase4::ThreadInfo info = { &mX, 64, NUM_BLOCKS, &blocks };
+
+            TestCase4::allocateBlocks(&info);
+
+            // The first round also obtains a cache for the other thread.
+
+            bsls::Types::Int64 numBlocksTotal = 0;
+
+            for (int round = 0; round < 4; ++round) {
+                bslmt::ThreadUtil::Handle handle;
+
+                ASSERT(0 == bslmt::ThreadUtil::create(
+                                                   &handle,
+                                                   TestCase4::deallocateBlocks,
+                                                   &info));
+                bslmt::ThreadUtil::join(handle);
+
+                TestCase4::allocateBlocks(&info);
+
+                // Every block freed by the other thread was returned to the
+                // depot, either as it overflowed its cache or when it exited.
+
+                if (0 == round) {
+                    numBlocksTotal = oa.numBlocksTotal();
+                }
+                ASSERTV(round, numBlocksTotal, oa.numBlocksTotal(),
+                        numBlocksTotal == oa.numBlocksTotal());
+            }
+
+            TestCase4::deallocateBlocks(&info);
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 The default constructor creates an allocator having an
+        //:   implementation-defined number of pools, and 'numPools' and
+        //:   'maxPooledBlockSize' report the configuration.
+        //:
+        //: 2 The 'numPools' constructor creates the specified number of pools,
+        //:   the largest managing blocks of size '2^(numPools + 2)'.
+        //:
+        //: 3 Memory is obtained from the allocator supplied at construction,
+        //:   or the default allocator if none is supplied.
+        //:
+        //: 4 The destructor returns all memory to the underlying allocator,
+        //:   even if blocks remain allocated.
+        //
+        // Plan:
+        //: 1 Create allocators with and without 'numPools', and verify the
+        //:   accessors.  (C-1..2)
+        //:
+        //: 2 Install a test allocator as the default allocator, and verify
+        //:   the source of memory for allocators created with and without an
+        //:   allocator.  (C-3)
+        //:
+        //: 3 Allocate blocks of several sizes without deallocating them, and
+        //:   verify that the test allocator supplied at construction has no
+        //:   outstanding memory after the allocator is destroyed.  (C-4)
+        //
+        // Testing:
+        //   ThreadCachingAllocator(Allocator *ba = 0);
+        //   ThreadCachingAllocator(int numPools, Allocator *ba = 0);
+        //   ~ThreadCachingAllocator();
+        //   bsls::Types::size_type maxPooledBlockSize() const;
+        //   int numPools() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND BASIC ACCESSORS" << endl
+                          << "============================" << endl;
+
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(10   == X.numPools());
+            ASSERT(4096 == X.maxPooledBlockSize());
+            ASSERT(0    == X.numThreadCaches());
+            ASSERT(0    <  da.numBlocksInUse());
+        }
+        ASSERT(0 == da.numBlocksInUse());
+
+        const bsls::Types::Int64 NUM_DEFAULT_BLOCKS = da.numBlocksTotal();
+
+        for (int numPools = 1; numPools <= 16; ++numPools) {
+            {
+                Obj mX(numPools, &oa);  const Obj& X = mX;
+
+                ASSERTV(numPools, numPools == X.numPools());
+                ASSERTV(numPools, (8u << (numPools - 1)) ==
+                                                      X.maxPooledBlockSize());
+                ASSERTV(numPools, 0 < oa.numBlocksInUse());
+                ASSERTV(numPools,
+                        NUM_DEFAULT_BLOCKS == da.numBlocksTotal());
+
+                for (bsls::Types::size_type size = 1;
+                     size <= 2 * X.maxPooledBlockSize();
+                     size *= 3) {
+                    mX.allocate(size);
+                }
+            }
+            ASSERTV(numPools, 0 == oa.numBlocksInUse());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Allocate and deallocate blocks of several sizes, and verify that
+        //:   they are usable and that all memory is returned on destruction.
+        //:   (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            Obj mX(&oa);
+
+            void *p1 = mX.allocate(1);     bsl::memset(p1, 0xff, 1);
+            void *p2 = mX.allocate(100);   bsl::memset(p2, 0xff, 100);
+            void *p3 = mX.allocate(10000); bsl::memset(p3, 0xff, 10000);
+
+            ASSERT(p1 != p2);
+            ASSERT(p2 != p3);
+
+            mX.deallocate(p2);
+            mX.deallocate(p1);
+            mX.deallocate(p3);
+
+            ASSERT(p2 == mX.allocate(100));
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,753 @@
+// bdlmt_workstealingthreadpool.cpp                                   -*-C++-*-
+
+#include <bdlmt_workstealingthreadpool.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlmt_workstealingthreadpool_cpp,"$Id$ $CSID$")
+
+#include <bslma_deallocatorproctor.h>
+#include <bslma_default.h>
+
+#include <bslmt_lockguard.h>
+
+#include <bsls_assert.h>
+#include <bsls_performancehint.h>
+#include <bsls_timeutil.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_new.h>
+
+///Implementation Notes
+///--------------------
+// Every pending job is held in a 'Node' allocated from 'd_nodePool'; the
+// deques and the injection queue hold only 'Node' pointers, which allows the
+// deque to be lock-free (a thief that loses the race for an element never
+// touches the job it did not take).
+//
+// Two counters, 'd_numPendingJobs' and 'd_numActiveThreads', drive both the
+// sleeping of idle threads and 'drain'.  A job is counted as pending from
+// just before it is made visible in a deque or the injection queue until just
+// after the thread that took it has incremented 'd_numActiveThreads', so the
+// sum of the two counters never spuriously drops to zero while a job exists,
+// and 'd_numPendingJobs' is never negative.
+//
+// An enqueuing thread increments 'd_numPendingJobs' *before* checking
+// 'd_enabled', and 'drain' clears 'd_enabled' before checking
+// 'd_numPendingJobs'.  Because both sequences use sequentially consistent
+// operations, either the enqueuing thread observes that queuing is disabled
+// (and rejects the job), or 'drain' observes the pending job (and waits for
+// it to complete).  A rejected job is uncounted, and, if that leaves no
+// pending or active job, 'd_drainCondition' is signaled, as when a job
+// completes.
+//
+// A thread that finds no work increments 'd_numSleeping' and then re-checks
+// 'd_numPendingJobs' while holding 'd_mutex' before waiting on
+// 'd_wakeCondition'; an enqueuing thread increments 'd_numPendingJobs' and
+// then checks 'd_numSleeping', acquiring 'd_mutex' to signal if it is
+// non-zero.  Because both sequences use sequentially consistent operations,
+// at least one of the two threads observes the other's update, so a wake-up
+// can not be lost.
+
+namespace BloombergLP {
+namespace bdlmt {
+namespace {
+
+enum {
+    k_NUM_SPINS = 64  // number of attempts to find a job before sleeping
+};
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+void initBlockSetImp(sigset_t *blockSet)
+    // Load into the specified 'blockSet' all signals except the synchronous
+    // ones.
+{
+    sigfillset(blockSet);
+
+    const int synchronousSignals[] = {
+        SIGBUS,
+        SIGFPE,
+        SIGILL,
+        SIGSEGV,
+        SIGSYS,
+        SIGABRT,
+        SIGTRAP,
+    #if !defined(BSLS_PLATFORM_OS_CYGWIN) || defined(SIGIOT)
+        SIGIOT
+    #endif
+    };
+
+    const int SIZE = sizeof synchronousSignals / sizeof *synchronousSignals;
+
+    for (int i = 0; i < SIZE; ++i) {
+        sigdelset(blockSet, synchronousSignals[i]);
+    }
+}
+#endif
+
+inline
+unsigned int nextRandom(unsigned int *state)
+    // Advance the specified xorshift 'state' and return its new value.
+{
+    unsigned int x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+}  // close unnamed namespace
+
+                     // ----------------------------------
+                     // class WorkStealingThreadPool_Deque
+                     // ----------------------------------
+
+// CREATORS
+WorkStealingThreadPool_Deque::WorkStealingThreadPool_Deque(
+                                              int               capacity,
+                                              bslma::Allocator *basicAllocator)
+: d_top(0)
+, d_topPad()
+, d_bottom(0)
+, d_bottomPad()
+, d_slots_p(0)
+, d_mask(capacity - 1)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < capacity);
+    BSLS_ASSERT(0 == (capacity & (capacity - 1)));
+
+    d_slots_p = static_cast<AtomicPointer *>(
+                   d_allocator_p->allocate(sizeof(AtomicPointer) * capacity));
+
+    for (int i = 0; i < capacity; ++i) {
+        AtomicOp::initPointer(d_slots_p + i, 0);
+    }
+}
+
+WorkStealingThreadPool_Deque::~WorkStealingThreadPool_Deque()
+{
+    d_allocator_p->deallocate(d_slots_p);
+}
+
+// MANIPULATORS
+int WorkStealingThreadPool_Deque::tryPushBottom(void *value)
+{
+    BSLS_ASSERT_SAFE(value);
+
+    const bsls::Types::Int64 bottom = d_bottom.loadRelaxed();
+    const bsls::Types::Int64 top    = d_top.loadAcquire();
+
+    if (bottom - top > d_mask) {
+        return -1;                                                    // RETURN
+    }
+
+    AtomicOp::setPtrRelaxed(d_slots_p + (bottom & d_mask), value);
+    d_bottom.storeRelease(bottom + 1);
+    return 0;
+}
+
+void *WorkStealingThreadPool_Deque::tryPopBottom()
+{
+    const bsls::Types::Int64 bottom = d_bottom.loadRelaxed() - 1;
+
+    // The store to 'd_bottom' must be ordered before the load of 'd_top';
+    // both are sequentially consistent.
+
+    d_bottom = bottom;
+    bsls::Types::Int64 top = d_top;
+
+    if (top > bottom) {
+        // Empty.
+
+        d_bottom.storeRelaxed(bottom + 1);
+        return 0;                                                     // RETURN
+    }
+
+    void *value = AtomicOp::getPtrRelaxed(d_slots_p + (bottom & d_mask));
+
+    if (top == bottom) {
+        // Last element: race against thieves for it.
+
+        if (top != d_top.testAndSwap(top, top + 1)) {
+            value = 0;
+        }
+        d_bottom.storeRelaxed(bottom + 1);
+    }
+    return value;
+}
+
+void *WorkStealingThreadPool_Deque::trySteal()
+{
+    // The load of 'd_top' must be ordered before the load of 'd_bottom'; both
+    // are sequentially consistent.
+
+    bsls::Types::Int64       top    = d_top;
+    const bsls::Types::Int64 bottom = d_bottom;
+
+    if (top >= bottom) {
+        return 0;                                                     // RETURN
+    }
+
+    void *value = AtomicOp::getPtrAcquire(d_slots_p + (top & d_mask));
+
+    if (top != d_top.testAndSwap(top, top + 1)) {
+        return 0;                                                     // RETURN
+    }
+    return value;
+}
+
+                    // ------------------------------------
+                    // struct WorkStealingThreadPool::Node
+                    // ------------------------------------
+
+struct WorkStealingThreadPool::Node {
+    // DATA
+    Job d_job;  // job to execute
+
+    // CREATORS
+    Node(const Job& job, bslma::Allocator *basicAllocator)
+    : d_job(bsl::allocator_arg, basicAllocator, job)
+    {
+    }
+
+    Node(bslmf::MovableRef<Job> job, bslma::Allocator *basicAllocator)
+    : d_job(bsl::allocator_arg,
+            basicAllocator,
+            bslmf::MovableRefUtil::move(job))
+    {
+    }
+};
+
+                   // --------------------------------------
+                   // struct WorkStealingThreadPool::Worker
+                   // --------------------------------------
+
+struct WorkStealingThreadPool::Worker {
+    // DATA
+    WorkStealingThreadPool_Deque  d_deque;        // jobs owned by this worker
+
+    WorkStealingThreadPool       *d_pool_p;       // owning pool
+
+    unsigned int                  d_randomState;  // state used to select
+                                                  // victims
+
+    // CREATORS
+    Worker(WorkStealingThreadPool *pool,
+           int                     index,
+           int                     dequeCapacity,
+           bslma::Allocator       *basicAllocator)
+    : d_deque(dequeCapacity, basicAllocator)
+    , d_pool_p(pool)
+    , d_randomState(2654435761U * static_cast<unsigned int>(index + 1))
+    {
+    }
+};
+
+                        // ----------------------------
+                        // class WorkStealingThreadPool
+                        // ----------------------------
+
+// PUBLIC CLASS DATA
+const int WorkStealingThreadPool::k_DEFAULT_DEQUE_CAPACITY;
+
+// PRIVATE MANIPULATORS
+void WorkStealingThreadPool::deleteNode(Node *node)
+{
+    node->~Node();
+    d_nodePool.deallocate(node);
+}
+
+int WorkStealingThreadPool::doEnqueueJob(Node *node)
+{
+    Worker *worker = static_cast<Worker *>(
+                                 bslmt::ThreadUtil::getSpecific(d_workerKey));
+    if (worker && this != worker->d_pool_p) {
+        worker = 0;
+    }
+
+    // The job is counted as pending before 'd_enabled' is checked, so that a
+    // concurrent 'drain' either waits for the job or causes it to be rejected
+    // (see the implementation notes).  While the pool is being drained, the
+    // jobs it executes may still enqueue jobs (e.g., to recursively decompose
+    // their work).
+
+    ++d_numPendingJobs;
+
+    if (!d_enabled && !(worker && 0 < d_numDrainers)) {
+        deleteNode(node);
+
+        if (0 == --d_numPendingJobs && 0 == d_numActiveThreads) {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+            d_drainCondition.broadcast();
+        }
+        return -1;                                                    // RETURN
+    }
+
+    if (!worker || 0 != worker->d_deque.tryPushBottom(node)) {
+        pushInjectionQueue(node);
+    }
+
+    if (0 < d_numSleeping) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        d_wakeCondition.signal();
+    }
+    return 0;
+}
+
+void WorkStealingThreadPool::executeJob(Node *node)
+{
+    ++d_numActiveThreads;
+    --d_numPendingJobs;
+
+    bsls::Types::Int64 start  = bsls::TimeUtil::getTimer();
+    node->d_job();
+    bsls::Types::Int64 finish = bsls::TimeUtil::getTimer();
+
+    // The job must be destroyed before the job is considered complete (its
+    // bound arguments may refer to objects destroyed after 'drain').
+
+    deleteNode(node);
+
+    bsls::Types::Int64 lastResetTime = d_lastResetTime.loadRelaxed();
+    d_callbackTime.addRelaxed(finish - (start < lastResetTime
+                                        ? lastResetTime
+                                        : start));
+
+    if (0 == --d_numActiveThreads && 0 == d_numPendingJobs) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        d_drainCondition.broadcast();
+    }
+}
+
+WorkStealingThreadPool::Node *WorkStealingThreadPool::findJob(Worker *worker)
+{
+    Node *node = static_cast<Node *>(worker->d_deque.tryPopBottom());
+    if (node) {
+        return node;                                                  // RETURN
+    }
+
+    node = popInjectionQueue();
+    if (node) {
+        return node;                                                  // RETURN
+    }
+
+    const int numWorkers = static_cast<int>(d_workers.size());
+    if (1 < numWorkers) {
+        const int first = static_cast<int>(
+               nextRandom(&worker->d_randomState) % (unsigned int) numWorkers);
+
+        for (int i = 0; i < numWorkers; ++i) {
+            Worker *victim = d_workers[(first + i) % numWorkers];
+            if (victim != worker && !victim->d_deque.isEmpty()) {
+                node = static_cast<Node *>(victim->d_deque.trySteal());
+                if (node) {
+                    return node;                                      // RETURN
+                }
+            }
+        }
+    }
+    return 0;
+}
+
+void WorkStealingThreadPool::initialize(int dequeCapacity)
+{
+    int rc = bslmt::ThreadUtil::createKey(&d_workerKey, 0);
+    BSLS_ASSERT_OPT(0 == rc);  (void)rc;
+
+    d_workers.reserve(d_numThreads);
+    for (int i = 0; i < d_numThreads; ++i) {
+        d_workers.push_back(new (*d_allocator_p) Worker(this,
+                                                        i,
+                                                        dequeCapacity,
+                                                        d_allocator_p));
+    }
+
+    // Force all threads to be joinable.
+
+    d_threadAttributes.setDetachedState(
+                                   bslmt::ThreadAttributes::e_CREATE_JOINABLE);
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    initBlockSetImp(&d_blockSet);
+#endif
+}
+
+WorkStealingThreadPool::Node *WorkStealingThreadPool::popInjectionQueue()
+{
+    if (0 == d_injectionSize.loadAcquire()) {
+        return 0;                                                     // RETURN
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_injectionMutex);
+
+    if (d_injectionQueue.empty()) {
+        return 0;                                                     // RETURN
+    }
+
+    Node *node = d_injectionQueue.front();
+    d_injectionQueue.pop_front();
+    d_injectionSize.storeRelease(static_cast<int>(d_injectionQueue.size()));
+    return node;
+}
+
+void WorkStealingThreadPool::pushInjectionQueue(Node *node)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_injectionMutex);
+
+    d_injectionQueue.push_back(node);
+    d_injectionSize.storeRelease(static_cast<int>(d_injectionQueue.size()));
+}
+
+void WorkStealingThreadPool::removeAllJobs()
+{
+    // Remove jobs from the deques by stealing them, since this thread does not
+    // own any of the deques.
+
+    for (bsl::size_t i = 0; i < d_workers.size(); ++i) {
+        while (!d_workers[i]->d_deque.isEmpty()) {
+            Node *node = static_cast<Node *>(d_workers[i]->d_deque.trySteal());
+            if (node) {
+                --d_numPendingJobs;
+                deleteNode(node);
+            }
+        }
+    }
+
+    while (Node *node = popInjectionQueue()) {
+        --d_numPendingJobs;
+        deleteNode(node);
+    }
+}
+
+int WorkStealingThreadPool::startNewThread(int index)
+{
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    // Block all asynchronous signals.
+
+    sigset_t oldset;
+    pthread_sigmask(SIG_BLOCK, &d_blockSet, &oldset);
+#endif
+
+    int rc = d_threadGroup.addThread(
+                  bdlf::BindUtil::bind(&WorkStealingThreadPool::workerThread,
+                                       this,
+                                       index),
+                  d_threadAttributes);
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    // Restore the mask.
+
+    pthread_sigmask(SIG_SETMASK, &oldset, &d_blockSet);
+#endif
+
+    return rc;
+}
+
+void WorkStealingThreadPool::stopThreads()
+{
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        if (e_RUNNING != d_state) {
+            return;                                                   // RETURN
+        }
+        d_state = e_STOPPING;
+        d_wakeCondition.broadcast();
+    }
+
+    d_threadGroup.joinAll();
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+    d_state = e_STOPPED;
+}
+
+void WorkStealingThreadPool::workerThread(int index)
+{
+    Worker *worker = d_workers[index];
+    bslmt::ThreadUtil::setSpecific(d_workerKey, worker);
+
+    while (true) {
+        Node *node = 0;
+        for (int i = 0; !node && i < k_NUM_SPINS; ++i) {
+            node = findJob(worker);
+            if (!node) {
+                if (e_RUNNING != d_state.loadRelaxed()) {
+                    break;
+                }
+                bslmt::ThreadUtil::yield();
+            }
+        }
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(node)) {
+            executeJob(node);
+            continue;
+        }
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        if (e_RUNNING != d_state) {
+            break;
+        }
+
+        ++d_numSleeping;
+        while (0 == d_numPendingJobs && e_RUNNING == d_state) {
+            d_wakeCondition.wait(&d_mutex);
+        }
+        --d_numSleeping;
+    }
+
+    bslmt::ThreadUtil::setSpecific(d_workerKey, 0);
+}
+
+// CREATORS
+WorkStealingThreadPool::WorkStealingThreadPool(
+                                              int               numThreads,
+                                              bslma::Allocator *basicAllocator)
+: d_workers(basicAllocator)
+, d_injectionQueue(basicAllocator)
+, d_injectionSize(0)
+, d_nodePool(sizeof(Node), basicAllocator)
+, d_numPendingJobs(0)
+, d_numActiveThreads(0)
+, d_numSleeping(0)
+, d_enabled(0)
+, d_numDrainers(0)
+, d_state(e_STOPPED)
+, d_threadGroup(basicAllocator)
+, d_threadAttributes(basicAllocator)
+, d_numThreads(numThreads)
+, d_lastResetTime(bsls::TimeUtil::getTimer())  // now
+, d_callbackTime(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(1 <= numThreads);
+
+    initialize(k_DEFAULT_DEQUE_CAPACITY);
+}
+
+WorkStealingThreadPool::WorkStealingThreadPool(
+                             const bslmt::ThreadAttributes&  threadAttributes,
+                             int                             numThreads,
+                             bslma::Allocator               *basicAllocator)
+: d_workers(basicAllocator)
+, d_injectionQueue(basicAllocator)
+, d_injectionSize(0)
+, d_nodePool(sizeof(Node), basicAllocator)
+, d_numPendingJobs(0)
+, d_numActiveThreads(0)
+, d_numSleeping(0)
+, d_enabled(0)
+, d_numDrainers(0)
+, d_state(e_STOPPED)
+, d_threadGroup(basicAllocator)
+, d_threadAttributes(threadAttributes, basicAllocator)
+, d_numThreads(numThreads)
+, d_lastResetTime(bsls::TimeUtil::getTimer())  // now
+, d_callbackTime(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(1 <= numThreads);
+
+    initialize(k_DEFAULT_DEQUE_CAPACITY);
+}
+
+WorkStealingThreadPool::WorkStealingThreadPool(
+                             const bslmt::ThreadAttributes&  threadAttributes,
+                             int                             numThreads,
+                             int                             dequeCapacity,
+                             bslma::Allocator               *basicAllocator)
+: d_workers(basicAllocator)
+, d_injectionQueue(basicAllocator)
+, d_injectionSize(0)
+, d_nodePool(sizeof(Node), basicAllocator)
+, d_numPendingJobs(0)
+, d_numActiveThreads(0)
+, d_numSleeping(0)
+, d_enabled(0)
+, d_numDrainers(0)
+, d_state(e_STOPPED)
+, d_threadGroup(basicAllocator)
+, d_threadAttributes(threadAttributes, basicAllocator)
+, d_numThreads(numThreads)
+, d_lastResetTime(bsls::TimeUtil::getTimer())  // now
+, d_callbackTime(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(1 <= numThreads);
+    BSLS_ASSERT(0 <  dequeCapacity);
+    BSLS_ASSERT(0 == (dequeCapacity & (dequeCapacity - 1)));
+
+    initialize(dequeCapacity);
+}
+
+WorkStealingThreadPool::~WorkStealingThreadPool()
+{
+    shutdown();
+
+    for (bsl::size_t i = 0; i < d_workers.size(); ++i) {
+        d_allocator_p->deleteObject(d_workers[i]);
+    }
+    bslmt::ThreadUtil::deleteKey(d_workerKey);
+}
+
+// MANIPULATORS
+void WorkStealingThreadPool::drain()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+    d_enabled = 0;
+    ++d_numDrainers;
+
+    while ((e_RUNNING == d_state && 0 != d_numPendingJobs)
+        || 0 != d_numActiveThreads) {
+        d_drainCondition.wait(&d_mutex);
+    }
+
+    --d_numDrainers;
+}
+
+int WorkStealingThreadPool::enqueueJob(const Job& functor)
+{
+    if (!functor) {
+        // Abort here if the 'functor' is "unset".  This prevents a crash
+        // inside 'workerThread' (where the context of 'functor' would be
+        // lost).
+
+        BSLS_ASSERT(0);
+        bsl::abort();  // abort (for when 'assert' is removed by optimization)
+    }
+
+    void *memory = d_nodePool.allocate();
+
+    bslma::DeallocatorProctor<bdlma::ConcurrentPool> proctor(memory,
+                                                             &d_nodePool);
+
+    Node *node = new (memory) Node(functor, d_allocator_p);
+
+    proctor.release();
+
+    return doEnqueueJob(node);
+}
+
+int WorkStealingThreadPool::enqueueJob(bslmf::MovableRef<Job> functor)
+{
+    if (!bslmf::MovableRefUtil::access(functor)) {
+        // Abort here if the 'functor' is "unset".  This prevents a crash
+        // inside 'workerThread' (where the context of 'functor' would be
+        // lost).
+
+        BSLS_ASSERT(0);
+        bsl::abort();  // abort (for when 'assert' is removed by optimization)
+    }
+
+    void *memory = d_nodePool.allocate();
+
+    bslma::DeallocatorProctor<bdlma::ConcurrentPool> proctor(memory,
+                                                             &d_nodePool);
+
+    Node *node = new (memory) Node(bslmf::MovableRefUtil::move(functor),
+                                   d_allocator_p);
+
+    proctor.release();
+
+    return doEnqueueJob(node);
+}
+
+double WorkStealingThreadPool::resetPercentBusy()
+{
+    bsls::Types::Int64 now           = bsls::TimeUtil::getTimer();
+    bsls::Types::Int64 lastResetTime = d_lastResetTime.swap(now);
+    const double callbackTime = static_cast<double>(d_callbackTime.swap(0));
+
+    // On some platforms, the "nanosecond" timers can be too coarse and no time
+    // is perceived to elapse; this sets the minimum elapsed time to 1ns.
+
+    double interval = static_cast<double>(now - lastResetTime);
+    interval = 0 != interval ? interval : 1;
+
+    return 100.0 / d_numThreads * callbackTime / interval;
+}
+
+void WorkStealingThreadPool::shutdown()
+{
+    d_enabled = 0;
+    removeAllJobs();
+    stopThreads();
+
+    // Jobs enqueued by jobs that were running during 'removeAllJobs' may
+    // remain; remove them now that no processing thread is running.
+
+    removeAllJobs();
+}
+
+int WorkStealingThreadPool::start()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    if (e_STOPPING == d_state) {
+        // Another thread is stopping the processing threads; none can be
+        // started until it is done.
+
+        return -1;                                                    // RETURN
+    }
+
+    if (e_STOPPED == d_state) {
+        d_state = e_RUNNING;
+
+        for (int i = 0; i < d_numThreads; ++i) {
+            if (0 != startNewThread(i)) {
+                d_state = e_STOPPING;
+                d_wakeCondition.broadcast();
+                guard.release()->unlock();
+
+                d_threadGroup.joinAll();
+
+                bslmt::LockGuard<bslmt::Mutex> stateGuard(&d_mutex);
+                d_state = e_STOPPED;
+                return -1;                                            // RETURN
+            }
+        }
+    }
+
+    d_enabled = 1;
+    return 0;
+}
+
+void WorkStealingThreadPool::stop()
+{
+    drain();
+    stopThreads();
+}
+
+// ACCESSORS
+double WorkStealingThreadPool::percentBusy() const
+{
+    bsls::Types::Int64 last = d_lastResetTime;
+    double interval = static_cast<double>(bsls::TimeUtil::getTimer() - last);
+
+    // On some platforms, the "nanosecond" timers can be too coarse and no time
+    // is perceived to elapse; this sets the minimum elapsed time to 1ns.
+
+    interval = 0 != interval ? interval : 1;
+
+    double ratio = static_cast<double>(d_callbackTime) / interval;
+    return 100.0 / d_numThreads * ratio;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
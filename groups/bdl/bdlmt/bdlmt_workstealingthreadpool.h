@@ -0,0 +1,621 @@
+// bdlmt_workstealingthreadpool.h                                     -*-C++-*-
+
+#ifndef INCLUDED_BDLMT_WORKSTEALINGTHREADPOOL
+#define INCLUDED_BDLMT_WORKSTEALINGTHREADPOOL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a fixed-size thread pool using per-thread work stealing.
+//
+//@CLASSES:
+//  bdlmt::WorkStealingThreadPool: fixed-size work-stealing thread pool
+//
+//@SEE_ALSO: bdlmt_threadpool, bdlmt_fixedthreadpool
+//
+//@DESCRIPTION: This component defines a thread pool,
+// 'bdlmt::WorkStealingThreadPool', that distributes user-defined functions
+// ("jobs") to a fixed number of processing threads without funneling every
+// job through a single shared queue.  The pool is intended as a drop-in
+// replacement for 'bdlmt::ThreadPool' (and 'bdlmt::FixedThreadPool') in
+// applications that submit very large numbers of short jobs from many
+// threads, where the single mutex guarding the shared queue of those pools
+// limits throughput.
+//
+// Each processing thread owns a bounded double-ended queue of pending jobs
+// (a Chase-Lev "work-stealing" deque).  A job enqueued by a processing thread
+// of the pool (i.e., a job enqueued from within another job) is pushed onto
+// the bottom of that thread's own deque without any locking, and is
+// subsequently popped from the same end by the owning thread.  A job enqueued
+// by any other thread is placed on a shared "injection" queue.  When a
+// processing thread finds its own deque empty, it takes a job from the
+// injection queue or, failing that, "steals" a job from the top of the deque
+// of another processing thread, visiting the other threads starting from a
+// randomly chosen one.  A processing thread that finds no work anywhere
+// blocks until a new job is enqueued.  If the deque of a processing thread is
+// full, jobs it enqueues overflow to the injection queue.
+//
+// The manipulators 'enqueueJob', 'drain', 'start', 'stop', and 'shutdown',
+// and the accessors 'enabled', 'numActiveThreads', 'numPendingJobs', and
+// 'percentBusy', have the same contracts as the identically named methods of
+// 'bdlmt::ThreadPool', so that a 'bdlmt::WorkStealingThreadPool' can be
+// substituted for a 'bdlmt::ThreadPool' with a fixed number of threads.  The
+// one exception is that, while 'drain' (or 'stop') waits for the pending jobs
+// to complete, jobs executed by the pool may still enqueue further jobs, so
+// that recursively decomposed work (see {Usage}) runs to completion.
+//
+///Job Ordering
+///------------
+// Unlike 'bdlmt::ThreadPool', a 'bdlmt::WorkStealingThreadPool' makes no
+// guarantee about the relative order in which pending jobs are started.  In
+// particular, jobs enqueued by a processing thread are started by that thread
+// in last-in, first-out order (which favors cache locality for recursively
+// decomposed work), while stolen jobs are taken in first-in, first-out order.
+// Clients requiring jobs to be started in the order they were enqueued should
+// use 'bdlmt::ThreadPool' or 'bdlmt::FixedThreadPool'.
+//
+///Thread Safety
+///-------------
+// The 'bdlmt::WorkStealingThreadPool' class is both *fully thread-safe*
+// (i.e., all non-creator methods can correctly execute concurrently), and is
+// *thread-enabled* (i.e., the class does not function correctly in a
+// non-multi-threading environment).  See 'bsldoc_glossary' for complete
+// definitions of *fully thread-safe* and *thread-enabled*.  Note that the
+// manipulators 'drain', 'stop', and 'shutdown' must not be invoked from
+// within a job executed by the pool.
+//
+///Synchronous Signals on Unix
+///---------------------------
+// As with the other thread pools in this package, all the threads in a
+// 'bdlmt::WorkStealingThreadPool' block all asynchronous signals on Unix
+// platforms (i.e., all signals except 'SIGBUS', 'SIGFPE', 'SIGILL',
+// 'SIGSEGV', 'SIGSYS', 'SIGABRT', 'SIGTRAP', and 'SIGIOT').
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Recursive Parallel Summation
+///- - - - - - - - - - - - - - - - - - - -
+// Work-stealing pools are well suited to "divide-and-conquer" algorithms in
+// which a job splits its input and enqueues the pieces as new jobs.  In this
+// example we sum the elements of an array by recursively splitting the array
+// until the pieces are small enough to be summed directly.
+//
+// First, we define the state shared by all of the jobs, and the job function
+// itself.  Each job either sums its range directly or enqueues two new jobs,
+// one for each half of the range.  Because the new jobs are enqueued from a
+// processing thread of the pool, they are placed on that thread's own deque
+// and are taken by other threads only when those threads run out of work:
+//..
+//  struct SumState {
+//      bdlmt::WorkStealingThreadPool *d_pool_p;
+//      const int                     *d_data_p;
+//      bsls::AtomicInt64              d_sum;
+//  };
+//
+//  void sumRange(SumState *state, int begin, int end)
+//      // Add the sum of the elements of 'state->d_data_p' in the range
+//      // '[begin .. end)' to 'state->d_sum', splitting the work into further
+//      // jobs on 'state->d_pool_p' if the range is large.
+//  {
+//      enum { k_GRAIN = 1024 };
+//
+//      if (end - begin <= k_GRAIN) {
+//          bsls::Types::Int64 sum = 0;
+//          for (int i = begin; i < end; ++i) {
+//              sum += state->d_data_p[i];
+//          }
+//          state->d_sum.add(sum);
+//          return;                                                   // RETURN
+//      }
+//
+//      const int middle = begin + (end - begin) / 2;
+//
+//      state->d_pool_p->enqueueJob(
+//                   bdlf::BindUtil::bind(&sumRange, state, begin, middle));
+//      state->d_pool_p->enqueueJob(
+//                   bdlf::BindUtil::bind(&sumRange, state, middle, end));
+//  }
+//..
+// Then, we create a pool having four processing threads and start it:
+//..
+//  bdlmt::WorkStealingThreadPool pool(4);
+//  int rc = pool.start();
+//  assert(0 == rc);
+//..
+// Next, we create some data and enqueue the root job:
+//..
+//  bsl::vector<int> data(100000, 3);
+//
+//  SumState state;
+//  state.d_pool_p = &pool;
+//  state.d_data_p = data.data();
+//
+//  pool.enqueueJob(bdlf::BindUtil::bind(&sumRange,
+//                                       &state,
+//                                       0,
+//                                       static_cast<int>(data.size())));
+//..
+// Finally, we wait for all the jobs, including the ones enqueued by other
+// jobs, to complete, and verify the result.  Note that 'drain' disables the
+// pool, so 'start' must be invoked before submitting further jobs:
+//..
+//  pool.drain();
+//  assert(300000 == state.d_sum);
+//  assert(0      == pool.numPendingJobs());
+//..
+
+#include <bdlscm_version.h>
+
+#include <bdlma_concurrentpool.h>
+
+#include <bdlf_bind.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_condition.h>
+#include <bslmt_mutex.h>
+#include <bslmt_platform.h>
+#include <bslmt_threadattributes.h>
+#include <bslmt_threadgroup.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+#include <bsls_atomicoperations.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_deque.h>
+#include <bsl_functional.h>
+#include <bsl_vector.h>
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+#include <bsl_c_signal.h>              // 'sigset_t'
+#endif
+
+namespace BloombergLP {
+namespace bdlmt {
+
+extern "C" typedef void (*WorkStealingThreadPoolJobFunc)(void *);
+    // This type declares the prototype for functions that are suitable to be
+    // specified 'bdlmt::WorkStealingThreadPool::enqueueJob'.
+
+                     // ==================================
+                     // class WorkStealingThreadPool_Deque
+                     // ==================================
+
+class WorkStealingThreadPool_Deque {
+    // This component-private class implements a bounded, lock-free,
+    // single-owner, multiple-thief double-ended queue of non-null 'void *'
+    // values, following "Correct and Efficient Work-Stealing for Weak Memory
+    // Models" (Le, Pop, Cohen, and Zappa Nardelli, 2013).  Only the owning
+    // thread may invoke 'tryPushBottom' and 'tryPopBottom'; any thread may
+    // invoke 'trySteal'.
+
+    // PRIVATE TYPES
+    typedef bsls::AtomicOperations                       AtomicOp;
+    typedef bsls::AtomicOperations::AtomicTypes::Pointer AtomicPointer;
+
+    enum {
+        k_PADDING = bslmt::Platform::e_CACHE_LINE_SIZE
+                                                  - sizeof(bsls::AtomicInt64)
+    };
+
+    // DATA
+    bsls::AtomicInt64  d_top;          // index of the next element to steal
+
+    const char         d_topPad[k_PADDING];
+                                       // padding to prevent false sharing
+
+    bsls::AtomicInt64  d_bottom;       // index one past the most recently
+                                       // pushed element
+
+    const char         d_bottomPad[k_PADDING];
+                                       // padding to prevent false sharing
+
+    AtomicPointer     *d_slots_p;      // circular array of elements
+
+    bsls::Types::Int64 d_mask;         // 'capacity - 1'
+
+    bslma::Allocator  *d_allocator_p;  // memory allocator (held, not owned)
+
+    // NOT IMPLEMENTED
+    WorkStealingThreadPool_Deque(const WorkStealingThreadPool_Deque&);
+    WorkStealingThreadPool_Deque& operator=(
+                                          const WorkStealingThreadPool_Deque&);
+
+  public:
+    // CREATORS
+    WorkStealingThreadPool_Deque(int               capacity,
+                                 bslma::Allocator *basicAllocator);
+        // Create an empty deque able to hold the specified 'capacity'
+        // elements, using the specified 'basicAllocator' to supply memory.
+        // The behavior is undefined unless 'capacity' is a positive power of
+        // two.
+
+    ~WorkStealingThreadPool_Deque();
+        // Destroy this object.
+
+    // MANIPULATORS
+    int tryPushBottom(void *value);
+        // Push the specified 'value' onto the bottom of this deque.  Return 0
+        // on success, and a non-zero value (with no effect) if this deque is
+        // full.  The behavior is undefined unless this method is invoked by
+        // the owning thread and '0 != value'.
+
+    void *tryPopBottom();
+        // Remove the element at the bottom of this deque and return it, or
+        // return 0 if this deque is empty.  The behavior is undefined unless
+        // this method is invoked by the owning thread.
+
+    void *trySteal();
+        // Remove the element at the top of this deque and return it, or
+        // return 0 if this deque is empty or the removal lost a race with
+        // another thread.
+
+    // ACCESSORS
+    bool isEmpty() const;
+        // Return 'true' if this deque was observed to be empty, and 'false'
+        // otherwise.  Note that the result is a snapshot that may be out of
+        // date by the time it is examined.
+};
+
+                        // ============================
+                        // class WorkStealingThreadPool
+                        // ============================
+
+class WorkStealingThreadPool {
+    // This class implements a fixed-size thread pool in which each processing
+    // thread has its own queue of pending jobs, and idle threads steal jobs
+    // from the queues of busy threads.
+
+  public:
+    // TYPES
+    typedef bsl::function<void()> Job;
+
+  private:
+    // PRIVATE TYPES
+    struct Node;
+        // Storage for a pending job (defined in the implementation file).
+
+    struct Worker;
+        // State of one processing thread (defined in the implementation
+        // file).
+
+    enum State {
+        e_STOPPED,  // no processing threads are running
+        e_RUNNING,  // processing threads are running
+        e_STOPPING  // processing threads have been asked to exit
+    };
+
+    // DATA
+    bsl::vector<Worker *>   d_workers;         // per-thread state, one entry
+                                               // for each processing thread
+
+    bsl::deque<Node *>      d_injectionQueue;  // jobs enqueued from outside
+                                               // the pool, or that overflowed
+                                               // a worker's deque
+
+    bslmt::Mutex            d_injectionMutex;  // guards 'd_injectionQueue'
+
+    bsls::AtomicInt         d_injectionSize;   // number of elements in
+                                               // 'd_injectionQueue', read
+                                               // without the lock
+
+    bdlma::ConcurrentPool   d_nodePool;        // supplies 'Node' objects
+
+    bsls::AtomicInt         d_numPendingJobs;  // number of jobs being
+                                               // enqueued, or enqueued but
+                                               // not yet taken by a thread
+
+    bsls::AtomicInt         d_numActiveThreads;
+                                               // number of threads currently
+                                               // executing a job
+
+    bsls::AtomicInt         d_numSleeping;     // number of threads blocked on
+                                               // 'd_wakeCondition'
+
+    bsls::AtomicInt         d_enabled;         // 1 if queuing is enabled, 0
+                                               // otherwise
+
+    bsls::AtomicInt         d_numDrainers;     // number of threads in 'drain';
+                                               // while positive, processing
+                                               // threads may enqueue jobs
+                                               // even if queuing is disabled
+
+    bsls::AtomicInt         d_state;           // 'State' of the processing
+                                               // threads
+
+    mutable bslmt::Mutex    d_mutex;           // guards state transitions and
+                                               // the two conditions below
+
+    bslmt::Condition        d_wakeCondition;   // signaled when a job is
+                                               // enqueued and a thread is
+                                               // asleep
+
+    bslmt::Condition        d_drainCondition;  // signaled when there are no
+                                               // pending and no active jobs
+
+    bslmt::ThreadUtil::Key  d_workerKey;       // thread-specific key mapping a
+                                               // processing thread to its
+                                               // 'Worker'
+
+    bslmt::ThreadGroup      d_threadGroup;     // processing threads
+
+    bslmt::ThreadAttributes d_threadAttributes;
+                                               // attributes used when
+                                               // creating processing threads
+
+    const int               d_numThreads;      // number of processing threads
+
+    bsls::AtomicInt64       d_lastResetTime;   // last reset time of
+                                               // percent-busy metric in
+                                               // nanoseconds from some
+                                               // arbitrary but fixed point in
+                                               // time
+
+    bsls::AtomicInt64       d_callbackTime;    // the total time spent running
+                                               // jobs across all threads, in
+                                               // nanoseconds
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    sigset_t                d_blockSet;        // set of signals to be blocked
+                                               // in managed threads
+#endif
+
+    bslma::Allocator       *d_allocator_p;     // memory allocator (held, not
+                                               // owned)
+
+    // PRIVATE MANIPULATORS
+    void deleteNode(Node *node);
+        // Destroy the job held by the specified 'node' and return 'node' to
+        // the node pool.
+
+    int doEnqueueJob(Node *node);
+        // Make the job held by the specified 'node' available to the
+        // processing threads, and wake a sleeping thread if there is one.
+        // Return 0 on success, and a non-zero value (after releasing 'node')
+        // if queuing is disabled.
+
+    void executeJob(Node *node);
+        // Execute, and then release, the job held by the specified 'node',
+        // updating the busy-time and activity statistics of this pool.
+
+    Node *findJob(Worker *worker);
+        // Return a node taken from the deque of the specified 'worker', from
+        // the injection queue, or stolen from the deque of another worker (in
+        // that order of preference), or 0 if no job was found.
+
+    void initialize(int dequeCapacity);
+        // Create the per-thread state of this pool, each having a deque with
+        // the specified 'dequeCapacity', and initialize the set of signals to
+        // be blocked in the managed threads.
+
+    Node *popInjectionQueue();
+        // Remove and return the node at the front of the injection queue, or
+        // return 0 if it is empty.
+
+    void pushInjectionQueue(Node *node);
+        // Append the specified 'node' to the injection queue.
+
+    void removeAllJobs();
+        // Remove and destroy all pending jobs.
+
+    int startNewThread(int index);
+        // Spawn the processing thread having the specified 'index'.  Return 0
+        // on success, and a non-zero value otherwise.
+
+    void stopThreads();
+        // Ask all processing threads to exit and join them.  Note that pending
+        // jobs are not executed by the exiting threads.
+
+    void workerThread(int index);
+        // The main function executed by the processing thread having the
+        // specified 'index'.
+
+    // NOT IMPLEMENTED
+    WorkStealingThreadPool(const WorkStealingThreadPool&);
+    WorkStealingThreadPool& operator=(const WorkStealingThreadPool&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(WorkStealingThreadPool,
+                                   bslma::UsesBslmaAllocator);
+
+    // PUBLIC CLASS DATA
+    static const int k_DEFAULT_DEQUE_CAPACITY = 1024;
+        // Default capacity of the deque owned by each processing thread.
+
+    // CREATORS
+    explicit
+    WorkStealingThreadPool(int               numThreads,
+                           bslma::Allocator *basicAllocator = 0);
+    WorkStealingThreadPool(const bslmt::ThreadAttributes&  threadAttributes,
+                           int                             numThreads,
+                           bslma::Allocator               *basicAllocator = 0);
+    WorkStealingThreadPool(const bslmt::ThreadAttributes&  threadAttributes,
+                           int                             numThreads,
+                           int                             dequeCapacity,
+                           bslma::Allocator               *basicAllocator = 0);
+        // Create a thread pool with the specified 'numThreads' processing
+        // threads.  Optionally specify 'threadAttributes' used to create the
+        // processing threads.  Optionally specify a 'dequeCapacity'
+        // indicating the maximum number of jobs that may be held by the deque
+        // of each processing thread; if 'dequeCapacity' is not specified,
+        // 'k_DEFAULT_DEQUE_CAPACITY' is used.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless '1 <= numThreads' and 'dequeCapacity' is a
+        // positive power of two.  Note that the newly created pool is
+        // disabled and has no running threads; 'start' must be called before
+        // jobs are enqueued.
+
+    ~WorkStealingThreadPool();
+        // Call 'shutdown()' and destroy this thread pool.
+
+    // MANIPULATORS
+    void drain();
+        // Disable queuing on this thread pool and wait until all pending jobs
+        // complete.  Use 'start' to re-enable queuing.  Note that, until all
+        // pending jobs complete, jobs executed by this pool may still enqueue
+        // further jobs, which are also waited for.
+
+    int enqueueJob(const Job& functor);
+    int enqueueJob(bslmf::MovableRef<Job> functor);
+        // Enqueue the specified 'functor' to be executed by a processing
+        // thread.  If this method is invoked from a processing thread of this
+        // pool, the job is enqueued on that thread's own deque.  Return 0 if
+        // enqueued successfully, and a non-zero value if queuing is currently
+        // disabled (unless this method is invoked from a processing thread of
+        // this pool while 'drain' is in progress).  The behavior is undefined
+        // unless 'functor' is not "unset".
+
+    int enqueueJob(WorkStealingThreadPoolJobFunc function, void *userData);
+        // Enqueue the specified 'function' to be executed by a processing
+        // thread.  The specified 'userData' pointer will be passed to the
+        // function by the processing thread.  Return 0 if enqueued
+        // successfully, and a non-zero value if queuing is currently disabled.
+
+    double resetPercentBusy();
+        // Atomically report the percentage of wall time spent by each thread
+        // of this thread pool executing jobs since the last reset time, and
+        // set the reset time to now.  The creation of the thread pool is
+        // considered a first reset time.  This value is calculated as
+        //..
+        //           sum(jobExecutionTime)       100%
+        //  P_busy = --------------------   x ----------
+        //            timeSinceLastReset      numThreads
+        //..
+
+    void shutdown();
+        // Disable queuing on this thread pool, cancel all queued jobs, and
+        // shut down all processing threads (after all active jobs complete).
+
+    int start();
+        // Enable queuing on this thread pool and spawn 'numThreads()'
+        // processing threads.  Return 0 on success, and a non-zero value
+        // otherwise.  If 'numThreads()' threads were not successfully
+        // started, all threads are stopped.  Note that this method fails,
+        // without effect, if it is called while another thread is stopping
+        // the processing threads.
+
+    void stop();
+        // Disable queuing on this thread pool and wait until all pending jobs
+        // (including jobs enqueued by those jobs) complete, then shut down all
+        // processing threads.
+
+    // ACCESSORS
+    int enabled() const;
+        // Return the state (enabled or not) of the thread pool.
+
+    int numActiveThreads() const;
+        // Return a snapshot of the number of threads that are currently
+        // processing a job.
+
+    int numPendingJobs() const;
+        // Return a snapshot of the number of jobs that are currently queued,
+        // but not yet being processed.
+
+    int numThreads() const;
+        // Return the number of processing threads passed to this thread pool
+        // at construction.
+
+    int numThreadsStarted() const;
+        // Return a snapshot of the number of processing threads currently
+        // started by this thread pool.
+
+    double percentBusy() const;
+        // Return the percentage of wall time spent by each thread of this
+        // thread pool executing jobs since the last reset time.  The creation
+        // of the thread pool is considered a first reset time.  This value is
+        // calculated as
+        //..
+        //           sum(jobExecutionTime)       100%
+        //  P_busy = --------------------   x ----------
+        //            timeSinceLastReset      numThreads
+        //..
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                     // ----------------------------------
+                     // class WorkStealingThreadPool_Deque
+                     // ----------------------------------
+
+// ACCESSORS
+inline
+bool WorkStealingThreadPool_Deque::isEmpty() const
+{
+    return d_bottom.loadAcquire() <= d_top.loadAcquire();
+}
+
+                        // ----------------------------
+                        // class WorkStealingThreadPool
+                        // ----------------------------
+
+// MANIPULATORS
+inline
+int WorkStealingThreadPool::enqueueJob(WorkStealingThreadPoolJobFunc  function,
+                                       void                          *userData)
+{
+    return enqueueJob(bdlf::BindUtil::bindR<void>(function, userData));
+}
+
+// ACCESSORS
+inline
+int WorkStealingThreadPool::enabled() const
+{
+    return d_enabled.loadRelaxed();
+}
+
+inline
+int WorkStealingThreadPool::numActiveThreads() const
+{
+    return d_numActiveThreads.loadRelaxed();
+}
+
+inline
+int WorkStealingThreadPool::numPendingJobs() const
+{
+    return d_numPendingJobs.loadRelaxed();
+}
+
+inline
+int WorkStealingThreadPool::numThreads() const
+{
+    return d_numThreads;
+}
+
+inline
+int WorkStealingThreadPool::numThreadsStarted() const
+{
+    return d_threadGroup.numThreads();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,836 @@
+// bdlmt_workstealingthreadpool.t.cpp                                 -*-C++-*-
+
+#include <bdlmt_workstealingthreadpool.h>
+
+#include <bdlf_bind.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadgroup.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+using bsl::flush;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test is a thread pool whose processing threads each own
+// a lock-free work-stealing deque.  The component-private deque is tested
+// first, single-threaded and then with concurrent thieves, verifying that
+// each element is removed exactly once.  The pool is then tested for the
+// contracts it shares with 'bdlmt::ThreadPool': every successfully enqueued
+// job runs exactly once, 'drain' waits for jobs enqueued by other jobs (and
+// for jobs enqueued concurrently by other threads that are not rejected),
+// 'stop' runs all pending jobs, 'shutdown' discards pending jobs, and a
+// disabled pool rejects jobs.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 3] WorkStealingThreadPool(int, bslma::Allocator *);
+// [ 3] WorkStealingThreadPool(const ThreadAttributes&, int, Allocator *);
+// [ 3] WorkStealingThreadPool(const ThreadAttributes&, int, int, Alloc *);
+// [ 3] ~WorkStealingThreadPool();
+//
+// MANIPULATORS
+// [ 3] int start();
+// [ 3] int enqueueJob(const Job&);
+// [ 3] int enqueueJob(bslmf::MovableRef<Job>);
+// [ 3] int enqueueJob(WorkStealingThreadPoolJobFunc, void *);
+// [ 4] void drain();
+// [ 7] void drain();
+// [ 5] void stop();
+// [ 5] void shutdown();
+// [ 6] double resetPercentBusy();
+//
+// ACCESSORS
+// [ 3] int enabled() const;
+// [ 3] int numThreads() const;
+// [ 3] int numThreadsStarted() const;
+// [ 4] int numActiveThreads() const;
+// [ 4] int numPendingJobs() const;
+// [ 6] double percentBusy() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 2] WorkStealingThreadPool_Deque
+// [ 8] USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                GLOBAL TYPEDEFS/CONSTANTS/VARIABLES FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlmt::WorkStealingThreadPool       Obj;
+typedef bdlmt::WorkStealingThreadPool_Deque Deque;
+typedef bsls::Types::Int64                  Int64;
+
+enum { k_NUM_VALUES = 200000 };
+
+char g_values[k_NUM_VALUES + 1];  // addresses used as deque elements
+
+static int verbose;
+static int veryVerbose;
+static int veryVeryVerbose;
+
+// ============================================================================
+//                  HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+void incrementCounter(bsls::AtomicInt *counter)
+    // Increment the specified 'counter'.
+{
+    ++*counter;
+}
+
+extern "C" void incrementCounterC(void *counter)
+    // Increment the 'bsls::AtomicInt' addressed by the specified 'counter'.
+{
+    ++*static_cast<bsls::AtomicInt *>(counter);
+}
+
+void sleepAndIncrement(bsls::AtomicInt *counter, int milliseconds)
+    // Sleep for the specified 'milliseconds' and then increment the specified
+    // 'counter'.
+{
+    bslmt::ThreadUtil::microSleep(milliseconds * 1000);
+    ++*counter;
+}
+
+void fanOut(Obj *pool, bsls::AtomicInt *counter, int depth)
+    // Increment the specified 'counter' and, if the specified 'depth' is
+    // positive, enqueue two further 'fanOut' jobs of depth 'depth - 1' on the
+    // specified 'pool'.
+{
+    ++*counter;
+    if (0 < depth) {
+        pool->enqueueJob(bdlf::BindUtil::bind(&fanOut,
+                                              pool,
+                                              counter,
+                                              depth - 1));
+        pool->enqueueJob(bdlf::BindUtil::bind(&fanOut,
+                                              pool,
+                                              counter,
+                                              depth - 1));
+    }
+}
+
+void produceJobs(Obj *pool, bsls::AtomicInt *counter, int numJobs)
+    // Enqueue the specified 'numJobs' jobs on the specified 'pool', each of
+    // which increments the specified 'counter', alternating between the
+    // functor and the function/user-data overloads of 'enqueueJob'.
+{
+    for (int i = 0; i < numJobs; ++i) {
+        if (i % 2) {
+            Obj::Job job(bdlf::BindUtil::bind(&incrementCounter, counter));
+            ASSERT(0 == pool->enqueueJob(bslmf::MovableRefUtil::move(job)));
+        }
+        else {
+            ASSERT(0 == pool->enqueueJob(&incrementCounterC, counter));
+        }
+    }
+}
+
+void enqueueUntilRejected(Obj             *pool,
+                          bsls::AtomicInt *numAccepted,
+                          bsls::AtomicInt *numExecuted,
+                          bslmt::Barrier  *barrier)
+    // Wait on the specified 'barrier', then enqueue on the specified 'pool'
+    // jobs incrementing the specified 'numExecuted' until a job is rejected,
+    // incrementing the specified 'numAccepted' for each job that is accepted.
+{
+    barrier->wait();
+
+    while (0 == pool->enqueueJob(bdlf::BindUtil::bind(&incrementCounter,
+                                                      numExecuted))) {
+        ++*numAccepted;
+    }
+}
+
+void stealAll(Deque           *deque,
+              bsls::AtomicInt *seen,
+              bsls::AtomicInt *numTaken,
+              bsls::AtomicInt *done)
+    // Repeatedly steal from the specified 'deque', incrementing the element
+    // of the specified 'seen' array addressed by each stolen value and the
+    // specified 'numTaken', until the specified 'done' is set and 'deque' is
+    // empty.
+{
+    while (!*done || !deque->isEmpty()) {
+        void *value = deque->trySteal();
+        if (value) {
+            ++seen[static_cast<char *>(value) - g_values - 1];
+            ++*numTaken;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace {
+
+struct SumState {
+    bdlmt::WorkStealingThreadPool *d_pool_p;
+    const int                     *d_data_p;
+    bsls::AtomicInt64              d_sum;
+};
+
+void sumRange(SumState *state, int begin, int end)
+    // Add the sum of the elements of 'state->d_data_p' in the range
+    // '[begin .. end)' to 'state->d_sum', splitting the work into further
+    // jobs on 'state->d_pool_p' if the range is large.
+{
+    enum { k_GRAIN = 1024 };
+
+    if (end - begin <= k_GRAIN) {
+        bsls::Types::Int64 sum = 0;
+        for (int i = begin; i < end; ++i) {
+            sum += state->d_data_p[i];
+        }
+        state->d_sum.add(sum);
+        return;                                                       // RETURN
+    }
+
+    const int middle = begin + (end - begin) / 2;
+
+    state->d_pool_p->enqueueJob(
+                      bdlf::BindUtil::bind(&sumRange, state, begin, middle));
+    state->d_pool_p->enqueueJob(
+                      bdlf::BindUtil::bind(&sumRange, state, middle, end));
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    bslma::TestAllocator ta("test", veryVeryVerbose);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        bdlmt::WorkStealingThreadPool pool(4, &ta);
+        int rc = pool.start();
+        ASSERT(0 == rc);
+
+        bsl::vector<int> data(100000, 3);
+
+        SumState state;
+        state.d_pool_p = &pool;
+        state.d_data_p = data.data();
+
+        pool.enqueueJob(bdlf::BindUtil::bind(&sumRange,
+                                             &state,
+                                             0,
+                                             static_cast<int>(data.size())));
+
+        pool.drain();
+        ASSERT(300000 == state.d_sum);
+        ASSERT(0      == pool.numPendingJobs());
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING 'drain' WITH CONCURRENT EXTERNAL ENQUEUERS
+        //
+        // Concerns:
+        //: 1 'drain' returns (does not hang) while threads that are not
+        //:   processing threads of the pool are enqueuing jobs.
+        //:
+        //: 2 Every job accepted by 'enqueueJob' concurrently with 'drain' has
+        //:   completed when 'drain' returns, and no job runs afterwards.
+        //:
+        //: 3 'numPendingJobs' is 0 after 'drain' returns.
+        //
+        // Plan:
+        //: 1 Repeatedly, start several threads that enqueue jobs until one is
+        //:   rejected, and call 'drain' concurrently, after a varying delay.
+        //:   Verify that the number of jobs executed when 'drain' returns is
+        //:   the number of jobs accepted, and does not change once the
+        //:   enqueuing threads have been joined.  (C-1..3)
+        //
+        // Testing:
+        //   void drain();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'drain' WITH CONCURRENT EXTERNAL "
+                          << "ENQUEUERS" << endl
+                          << "========================================="
+                          << "=========" << endl;
+
+        const int NUM_ENQUEUERS  = 4;
+        const int NUM_ITERATIONS = 200;
+
+        for (int i = 0; i < NUM_ITERATIONS; ++i) {
+            Obj mX(4, &ta);  const Obj& X = mX;
+
+            ASSERT(0 == mX.start());
+
+            bsls::AtomicInt numAccepted(0);
+            bsls::AtomicInt numExecuted(0);
+
+            bslmt::Barrier     barrier(NUM_ENQUEUERS + 1);
+            bslmt::ThreadGroup enqueuers(&ta);
+            for (int j = 0; j < NUM_ENQUEUERS; ++j) {
+                enqueuers.addThread(bdlf::BindUtil::bind(
+                                                     &enqueueUntilRejected,
+                                                     &mX,
+                                                     &numAccepted,
+                                                     &numExecuted,
+                                                     &barrier));
+            }
+
+            barrier.wait();
+            bslmt::ThreadUtil::microSleep(i % 10 * 100);
+
+            mX.drain();
+
+            const int numExecutedAtDrain = numExecuted;
+
+            ASSERTV(i, X.numPendingJobs(),   0 == X.numPendingJobs());
+            ASSERTV(i, X.numActiveThreads(), 0 == X.numActiveThreads());
+
+            enqueuers.joinAll();
+
+            ASSERTV(i, numAccepted, numExecutedAtDrain,
+                    numAccepted == numExecutedAtDrain);
+            ASSERTV(i, numExecuted, numExecutedAtDrain,
+                    numExecuted == numExecutedAtDrain);
+            ASSERTV(i, X.numPendingJobs(), 0 == X.numPendingJobs());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING 'percentBusy' AND 'resetPercentBusy'
+        //
+        // Concerns:
+        //: 1 'percentBusy' is approximately zero for an idle pool.
+        //:
+        //: 2 'percentBusy' reflects time spent executing jobs, normalized by
+        //:   the number of threads.
+        //:
+        //: 3 'resetPercentBusy' returns the busy percentage and resets it.
+        //
+        // Plan:
+        //: 1 Run one sleeping job on each thread of a two-thread pool and
+        //:   verify the reported percentage is within broad bounds.  (C-1..3)
+        //
+        // Testing:
+        //   double percentBusy() const;
+        //   double resetPercentBusy();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'percentBusy' AND 'resetPercentBusy'"
+                          << endl
+                          << "============================================"
+                          << endl;
+
+        Obj mX(2, &ta);  const Obj& X = mX;
+
+        ASSERT(0 == mX.start());
+        bslmt::ThreadUtil::microSleep(20 * 1000);
+        ASSERTV(X.percentBusy(), X.percentBusy() < 10.0);
+
+        mX.resetPercentBusy();
+
+        bsls::AtomicInt counter(0);
+        for (int i = 0; i < 2; ++i) {
+            mX.enqueueJob(bdlf::BindUtil::bind(&sleepAndIncrement,
+                                               &counter,
+                                               100));
+        }
+        mX.drain();
+        ASSERT(2 == counter);
+
+        double busy = X.percentBusy();
+        ASSERTV(busy, 20.0 < busy);
+        ASSERTV(busy, 100.5 > busy);
+
+        double reset = mX.resetPercentBusy();
+        ASSERTV(busy, reset, reset >= busy * 0.5);
+        ASSERTV(X.percentBusy(), X.percentBusy() < 10.0);
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'stop' AND 'shutdown'
+        //
+        // Concerns:
+        //: 1 'stop' executes all pending jobs, disables the pool, and joins
+        //:   the processing threads.
+        //:
+        //: 2 'shutdown' discards pending jobs, and joins the processing
+        //:   threads after active jobs complete.
+        //:
+        //: 3 The pool can be restarted after 'stop' and 'shutdown'.
+        //:
+        //: 4 No memory is leaked by discarded jobs.
+        //
+        // Plan:
+        //: 1 Enqueue many sleeping jobs on a pool with few threads, call
+        //:   'stop', and verify all jobs ran.  (C-1)
+        //:
+        //: 2 Repeat, calling 'shutdown' instead, and verify fewer jobs ran.
+        //:   Restart the pool in between.  (C-2..4)
+        //
+        // Testing:
+        //   void stop();
+        //   void shutdown();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'stop' AND 'shutdown'" << endl
+                          << "=============================" << endl;
+
+        enum { k_NUM_JOBS = 40 };
+
+        Obj mX(2, &ta);  const Obj& X = mX;
+
+        bsls::AtomicInt counter(0);
+
+        ASSERT(0 == mX.start());
+        for (int i = 0; i < k_NUM_JOBS; ++i) {
+            ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&sleepAndIncrement,
+                                                           &counter,
+                                                           1)));
+        }
+        mX.stop();
+        ASSERTV(counter, k_NUM_JOBS == counter);
+        ASSERT(0 == X.enabled());
+        ASSERT(0 == X.numThreadsStarted());
+        ASSERT(0 != mX.enqueueJob(bdlf::BindUtil::bind(&incrementCounter,
+                                                       &counter)));
+
+        counter = 0;
+        ASSERT(0 == mX.start());
+        for (int i = 0; i < k_NUM_JOBS; ++i) {
+            ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&sleepAndIncrement,
+                                                           &counter,
+                                                           10)));
+        }
+        mX.shutdown();
+        ASSERTV(counter, k_NUM_JOBS > counter);
+        ASSERT(0 == X.enabled());
+        ASSERT(0 == X.numThreadsStarted());
+        ASSERT(0 == X.numPendingJobs());
+        ASSERT(0 == X.numActiveThreads());
+
+        ASSERT(0 == mX.start());
+        counter = 0;
+        ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&incrementCounter,
+                                                       &counter)));
+        mX.stop();
+        ASSERT(1 == counter);
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'drain' WITH JOBS ENQUEUED BY JOBS
+        //
+        // Concerns:
+        //: 1 Jobs enqueued from within a job (which are pushed onto the
+        //:   worker's own deque) are executed, including those stolen by
+        //:   other threads.
+        //:
+        //: 2 'drain' waits until all such jobs have completed.
+        //:
+        //: 3 A worker's deque overflowing to the injection queue loses no
+        //:   jobs.
+        //
+        // Plan:
+        //: 1 Enqueue a job that recursively fans out into a binary tree of
+        //:   jobs, using pools of varying thread counts and small deque
+        //:   capacities, drain, and verify the number of jobs run.  (C-1..3)
+        //
+        // Testing:
+        //   void drain();
+        //   int numActiveThreads() const;
+        //   int numPendingJobs() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'drain' WITH JOBS ENQUEUED BY JOBS"
+                          << endl
+                          << "=========================================="
+                          << endl;
+
+        const int DEPTH = 14;
+        const int EXPECTED = (1 << (DEPTH + 1)) - 1;
+
+        const int THREADS[]    = { 1, 2, 4, 8 };
+        const int CAPACITIES[] = { 1, 4, 1024 };
+
+        for (int ti = 0; ti < 4; ++ti) {
+            for (int ci = 0; ci < 3; ++ci) {
+                bslmt::ThreadAttributes attributes;
+                Obj mX(attributes, THREADS[ti], CAPACITIES[ci], &ta);
+                const Obj& X = mX;
+
+                ASSERT(0 == mX.start());
+
+                bsls::AtomicInt counter(0);
+                ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&fanOut,
+                                                               &mX,
+                                                               &counter,
+                                                               DEPTH)));
+                mX.drain();
+
+                ASSERTV(THREADS[ti], CAPACITIES[ci], counter,
+                        EXPECTED == counter);
+                ASSERT(0 == X.numPendingJobs());
+                ASSERT(0 == X.numActiveThreads());
+                ASSERT(0 == X.enabled());
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING CREATORS, 'start', AND 'enqueueJob'
+        //
+        // Concerns:
+        //: 1 A newly created pool is disabled and has no threads.
+        //:
+        //: 2 'start' enables the pool and starts 'numThreads()' threads.
+        //:
+        //: 3 Every job enqueued, from any number of external threads and
+        //:   through any 'enqueueJob' overload, is executed exactly once.
+        //:
+        //: 4 All memory comes from the supplied allocator.
+        //
+        // Plan:
+        //: 1 Create pools with each constructor and verify initial state.
+        //:
+        //: 2 Enqueue jobs concurrently from several threads and verify the
+        //:   total count after 'drain'.  (C-1..4)
+        //
+        // Testing:
+        //   WorkStealingThreadPool(int, bslma::Allocator *);
+        //   WorkStealingThreadPool(const ThreadAttributes&, int, Allocator *);
+        //   WorkStealingThreadPool(const ThreadAttributes&, int, int, Alloc*);
+        //   ~WorkStealingThreadPool();
+        //   int start();
+        //   int enqueueJob(const Job&);
+        //   int enqueueJob(bslmf::MovableRef<Job>);
+        //   int enqueueJob(WorkStealingThreadPoolJobFunc, void *);
+        //   int enabled() const;
+        //   int numThreads() const;
+        //   int numThreadsStarted() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING CREATORS, 'start', AND 'enqueueJob'"
+                          << endl
+                          << "==========================================="
+                          << endl;
+
+        enum { k_NUM_PRODUCERS = 4, k_NUM_JOBS = 10000 };
+
+        for (int ci = 0; ci < 3; ++ci) {
+            bslmt::ThreadAttributes attributes;
+
+            Obj *mX_p = 0;
+            switch (ci) {
+              case 0: mX_p = new (ta) Obj(3, &ta);                    break;
+              case 1: mX_p = new (ta) Obj(attributes, 3, &ta);        break;
+              case 2: mX_p = new (ta) Obj(attributes, 3, 16, &ta);    break;
+            }
+            Obj& mX = *mX_p;  const Obj& X = mX;
+
+            ASSERT(0 == X.enabled());
+            ASSERT(3 == X.numThreads());
+            ASSERT(0 == X.numThreadsStarted());
+
+            bsls::AtomicInt counter(0);
+            ASSERT(0 != mX.enqueueJob(bdlf::BindUtil::bind(&incrementCounter,
+                                                           &counter)));
+
+            ASSERT(0 == mX.start());
+            ASSERT(0 != X.enabled());
+            ASSERT(3 == X.numThreadsStarted());
+            ASSERT(0 == mX.start());  // redundant 'start' is harmless
+            ASSERT(3 == X.numThreadsStarted());
+
+            {
+                bslmt::ThreadGroup producers(&ta);
+                for (int i = 0; i < k_NUM_PRODUCERS; ++i) {
+                    producers.addThread(bdlf::BindUtil::bind(&produceJobs,
+                                                             &mX,
+                                                             &counter,
+                                                             k_NUM_JOBS));
+                }
+                producers.joinAll();
+            }
+            mX.drain();
+
+            ASSERTV(ci, counter, k_NUM_PRODUCERS * k_NUM_JOBS == counter);
+
+            ta.deleteObject(mX_p);
+            ASSERT(0 == ta.numBlocksInUse());
+            ASSERT(0 == defaultAllocator.numBlocksInUse());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'WorkStealingThreadPool_Deque'
+        //
+        // Concerns:
+        //: 1 Elements popped by the owner are returned in LIFO order, and
+        //:   elements stolen are returned in FIFO order.
+        //:
+        //: 2 'tryPushBottom' fails when the deque is full.
+        //:
+        //: 3 When the owner pushes and pops concurrently with several
+        //:   thieves, every element is removed exactly once.
+        //
+        // Plan:
+        //: 1 Push and remove elements from a single thread.  (C-1..2)
+        //:
+        //: 2 Run an owner that pushes and pops against several stealing
+        //:   threads and count how many times each element is seen.  (C-3)
+        //
+        // Testing:
+        //   WorkStealingThreadPool_Deque
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'WorkStealingThreadPool_Deque'" << endl
+                          << "======================================" << endl;
+
+        char *const BASE = g_values;
+        {
+            Deque mX(4, &ta);
+
+            ASSERT(mX.isEmpty());
+            ASSERT(0 == mX.tryPopBottom());
+            ASSERT(0 == mX.trySteal());
+
+            for (int i = 1; i <= 4; ++i) {
+                ASSERT(0 == mX.tryPushBottom(BASE + i));
+            }
+            ASSERT(0 != mX.tryPushBottom(BASE + 5));
+            ASSERT(!mX.isEmpty());
+
+            ASSERT(BASE + 1 == mX.trySteal());
+            ASSERT(BASE + 4 == mX.tryPopBottom());
+            ASSERT(0 == mX.tryPushBottom(BASE + 6));
+            ASSERT(0 == mX.tryPushBottom(BASE + 7));
+            ASSERT(0 != mX.tryPushBottom(BASE + 8));
+            ASSERT(BASE + 2 == mX.trySteal());
+            ASSERT(BASE + 7 == mX.tryPopBottom());
+            ASSERT(BASE + 6 == mX.tryPopBottom());
+            ASSERT(BASE + 3 == mX.tryPopBottom());
+            ASSERT(0 == mX.tryPopBottom());
+            ASSERT(mX.isEmpty());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        enum { k_NUM_THIEVES = 3 };
+        {
+            Deque mX(64, &ta);
+
+            bsls::AtomicInt *seen = new bsls::AtomicInt[k_NUM_VALUES];
+            bsls::AtomicInt              numTaken(0);
+            bsls::AtomicInt              done(0);
+
+            bslmt::ThreadGroup thieves(&ta);
+            thieves.addThreads(bdlf::BindUtil::bind(&stealAll,
+                                                    &mX,
+                                                    seen,
+                                                    &numTaken,
+                                                    &done),
+                               k_NUM_THIEVES);
+
+            for (int i = 0; i < k_NUM_VALUES; ++i) {
+                while (0 != mX.tryPushBottom(BASE + i + 1)) {
+                    void *value = mX.tryPopBottom();
+                    if (value) {
+                        ++seen[static_cast<char *>(value) - BASE - 1];
+                        ++numTaken;
+                    }
+                }
+                if (0 == i % 3) {
+                    void *value = mX.tryPopBottom();
+                    if (value) {
+                        ++seen[static_cast<char *>(value) - BASE - 1];
+                        ++numTaken;
+                    }
+                }
+            }
+            done = 1;
+            thieves.joinAll();
+
+            ASSERTV(numTaken, k_NUM_VALUES == numTaken);
+            for (int i = 0; i < k_NUM_VALUES; ++i) {
+                ASSERTV(i, seen[i], 1 == seen[i]);
+            }
+            delete [] seen;
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Start a pool, enqueue jobs, drain, and stop.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bsls::AtomicInt counter(0);
+        {
+            Obj mX(4, &ta);
+
+            ASSERT(0 == mX.start());
+            for (int i = 0; i < 1000; ++i) {
+                ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(
+                                                           &incrementCounter,
+                                                           &counter)));
+            }
+            mX.drain();
+            ASSERT(1000 == counter);
+            ASSERT(0 != mX.enqueueJob(bdlf::BindUtil::bind(&incrementCounter,
+                                                           &counter)));
+            ASSERT(0 == mX.start());
+            ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&incrementCounter,
+                                                           &counter)));
+            mX.stop();
+            ASSERT(1001 == counter);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
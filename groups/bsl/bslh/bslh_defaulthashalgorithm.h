@@ -314,6 +314,15 @@ class DefaultHashAlgorithm {
     typedef InternalHashAlgorithm::result_type result_type;
         // Typedef indicating the value type returned by this algorithm.
 
+    // CLASS METHODS
+    static result_type hashBytes(const void *data, size_t numBytes);
+        // Return the hash that a default constructed 'DefaultHashAlgorithm'
+        // would return from 'computeHash()' after incorporating the specified
+        // 'data', of at least the specified 'numBytes', without maintaining
+        // the incremental state of an object.  The behaviour is undefined
+        // unless 'data' points to a valid memory location with at least
+        // 'numBytes' bytes of initialized memory or 'numBytes' is zero.
+
     // CREATORS
     DefaultHashAlgorithm();
         // Create a 'bslh::DefaultHashAlgorithm', default constructing the
@@ -349,6 +358,15 @@ class DefaultHashAlgorithm {
 //                            INLINE DEFINITIONS
 // ============================================================================
 
+// CLASS METHODS
+inline
+DefaultHashAlgorithm::result_type
+DefaultHashAlgorithm::hashBytes(const void *data, size_t numBytes)
+{
+    BSLS_ASSERT(0 != data || 0 == numBytes);
+    return InternalHashAlgorithm::hashBytes(data, numBytes);
+}
+
 // CREATORS
 inline
 DefaultHashAlgorithm::DefaultHashAlgorithm()
@@ -36,6 +36,9 @@ using namespace bslh;
 // [ 2] DefaultHashAlgorithm();
 // [ 2] ~DefaultHashAlgorithm();
 //
+// CLASS METHODS
+// [ 3] static result_type hashBytes(const void *data, size_t numBytes);
+//
 // MANIPULATORS
 // [ 3] void operator()(void const* key, size_t len);
 // [ 3] result_type computeHash();
@@ -489,17 +492,25 @@ int main(int argc, char *argv[])
         //: 3 The output of calling 'operator()' and then 'computeHash()'
         //:   matches the output of the underlying hashing algorithm.
         //:
-        //: 4 'operator()' does a BSLS_ASSERT for null pointers and non-zero
-        //:   length, and not for null pointers and zero length.
+        //: 4 'operator()' and 'hashBytes' do a BSLS_ASSERT for null pointers
+        //:   and non-zero length, and not for null pointers and zero length.
+        //:
+        //: 5 'hashBytes' returns the value computed by 'operator()' and
+        //:   'computeHash()' for the same bytes.
         //
         // Plan:
         //: 1 Hash a number of values with 'bslh::DefaultHashAlgorithm' and
         //:   'bslh::SpookyHashAlgorithm' and verify that the outputs match.
         //:   (C-1,2,3)
         //:
-        //: 2 Call 'operator()' with a null pointer. (C-4)
+        //: 2 Call 'operator()' and 'hashBytes' with a null pointer. (C-4)
+        //:
+        //: 3 Hash byte sequences of every length up to 300 with 'hashBytes'
+        //:   and with the incremental interface, and verify the results
+        //:   match. (C-5)
         //
         // Testing:
+        //   static result_type hashBytes(const void *data, size_t numBytes);
         //   void operator()(void const* key, size_t len);
         //   result_type computeHash();
         // --------------------------------------------------------------------
@@ -570,6 +581,24 @@ int main(int argc, char *argv[])
             }
         }
 
+        if (verbose) printf("Hash byte sequences of every length up to 300"
+                            " with 'hashBytes' and compare with the result of"
+                            " the incremental interface. (C-5)\n");
+        {
+            char data[300];
+            for (int i = 0; i < 300; ++i) {
+                data[i] = static_cast<char>(i * 131 + 7);
+            }
+
+            for (int length = 0; length <= 300; ++length) {
+                Obj hash;
+                hash(data, length);
+
+                LOOP_ASSERT(length, hash.computeHash() ==
+                                                 Obj::hashBytes(data, length));
+            }
+        }
+
         if (verbose) printf("Call 'operator()' with null pointers. (C-4)\n");
         {
             const char data[5] = {'a', 'b', 'c', 'd', 'e'};
@@ -579,6 +608,10 @@ int main(int argc, char *argv[])
             ASSERT_FAIL(Obj()(   0, 5));
             ASSERT_PASS(Obj()(   0, 0));
             ASSERT_PASS(Obj()(data, 5));
+
+            ASSERT_FAIL(Obj::hashBytes(   0, 5));
+            ASSERT_PASS(Obj::hashBytes(   0, 0));
+            ASSERT_PASS(Obj::hashBytes(data, 5));
         }
 
       } break;
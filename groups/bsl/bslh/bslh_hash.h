@@ -77,6 +77,28 @@ BSLS_IDENT("$Id: $")
 // representation.  The algorithm will then incorporate the type into its
 // internal state and return a finalized hash when requested.
 //
+///Hashing Contiguous Data
+///-----------------------
+// Hashing algorithms produce the same hash regardless of how their input is
+// divided among calls to the function call operator, so a range of objects
+// whose 'hashAppend' would pass the algorithm exactly the bytes of each object
+// can instead be passed to the algorithm in a single call.  This component
+// provides the free function 'hashAppendRange', which hashes a contiguous
+// range of objects in a single call to the algorithm if the element type is
+// an integral type other than 'bool', and otherwise calls 'hashAppend' on each
+// element in turn.  Contiguous containers, such as 'bsl::vector', and the
+// 'hashAppend' overloads for arrays provided by this component use
+// 'hashAppendRange'.  Note that ranges of enumerated, pointer, and
+// user-defined types are always hashed element by element, so that any
+// 'hashAppend' overload supplied for the element type is honored.
+//
+// In addition, 'bslh::Hash::operator()' computes the hash of a single key of
+// integral type (other than 'bool') with no call to 'hashAppend' and, for the
+// algorithms provided by the 'bslh' package, through the algorithm's
+// 'hashBytes' class method, which computes the hash without the incremental
+// state required to support the function call operator.  The resulting hash
+// is the same as that computed by the incremental interface.
+//
 ///Hashing Algorithms
 ///------------------
 // There are algorithms implemented in the 'bslh' package that can be passed in
@@ -408,8 +430,11 @@ BSLS_IDENT("$Id: $")
 #include <bslscm_version.h>
 
 #include <bslh_defaulthashalgorithm.h>
+#include <bslh_spookyhashalgorithm.h>
+#include <bslh_wyhashincrementalalgorithm.h>
 
 #include <bslmf_enableif.h>
+#include <bslmf_integralconstant.h>
 #include <bslmf_isbitwisemoveable.h>
 #include <bslmf_isenum.h>
 #include <bslmf_isfloatingpoint.h>
@@ -428,6 +453,123 @@ namespace BloombergLP {
 
 namespace bslh {
 
+                      // ================================
+                      // struct bslh::Hash_IsFixedSizeKey
+                      // ================================
+
+template <class TYPE>
+struct Hash_IsFixedSizeKey
+: bsl::integral_constant<bool,
+                         bsl::is_integral<TYPE>::value &&
+                        !bsl::is_same<TYPE, bool>::value> {
+    // This component-private metafunction derives from 'bsl::true_type' if
+    // 'hashAppend' for the (template parameter) 'TYPE' passes exactly the
+    // bytes of its argument to the hashing algorithm in a single call, and
+    // from 'bsl::false_type' otherwise.  Only integral types other than
+    // 'bool' qualify: 'hashAppend' normalizes 'bool' and floating point
+    // values, and users may overload 'hashAppend' for enumerated, pointer,
+    // and class types, so a key or a range of objects of any other type is
+    // hashed by calling 'hashAppend'.
+};
+
+                         // =========================
+                         // struct bslh::Hash_OneShot
+                         // =========================
+
+template <class HASH_ALGORITHM>
+struct Hash_OneShot {
+    // This component-private 'struct' provides a namespace for a function
+    // that computes the hash of a contiguous sequence of bytes using a default
+    // constructed (template parameter) 'HASH_ALGORITHM'.  This primary
+    // template uses the incremental interface of the algorithm, and is
+    // specialized below for algorithms that provide a 'hashBytes' class
+    // method.
+
+    // CLASS METHODS
+    static typename HASH_ALGORITHM::result_type hashBytes(const void *data,
+                                                          size_t numBytes);
+        // Return the hash of the specified 'data' having the specified
+        // 'numBytes' computed by a default constructed 'HASH_ALGORITHM'.
+};
+
+template <>
+struct Hash_OneShot<DefaultHashAlgorithm> {
+    // This specialization of 'Hash_OneShot' computes the hash using the
+    // 'hashBytes' class method of 'DefaultHashAlgorithm'.
+
+    // CLASS METHODS
+    static DefaultHashAlgorithm::result_type hashBytes(const void *data,
+                                                       size_t      numBytes);
+        // Return the hash of the specified 'data' having the specified
+        // 'numBytes' computed by a default constructed
+        // 'DefaultHashAlgorithm'.
+};
+
+template <>
+struct Hash_OneShot<SpookyHashAlgorithm> {
+    // This specialization of 'Hash_OneShot' computes the hash using the
+    // 'hashBytes' class method of 'SpookyHashAlgorithm'.
+
+    // CLASS METHODS
+    static SpookyHashAlgorithm::result_type hashBytes(const void *data,
+                                                      size_t      numBytes);
+        // Return the hash of the specified 'data' having the specified
+        // 'numBytes' computed by a default constructed 'SpookyHashAlgorithm'.
+};
+
+template <>
+struct Hash_OneShot<WyHashIncrementalAlgorithm> {
+    // This specialization of 'Hash_OneShot' computes the hash using the
+    // 'hashBytes' class method of 'WyHashIncrementalAlgorithm'.
+
+    // CLASS METHODS
+    static WyHashIncrementalAlgorithm::result_type hashBytes(
+                                                         const void *data,
+                                                         size_t      numBytes);
+        // Return the hash of the specified 'data' having the specified
+        // 'numBytes' computed by a default constructed
+        // 'WyHashIncrementalAlgorithm'.
+};
+
+                            // ======================
+                            // struct bslh::Hash_Util
+                            // ======================
+
+struct Hash_Util {
+    // This component-private 'struct' provides a namespace for the
+    // implementation of 'bslh::Hash::operator()' and 'hashAppendRange',
+    // selected at compile time by the properties of the hashed type.
+
+    // CLASS METHODS
+    template <class HASH_ALGORITHM, class TYPE>
+    static void hashAppendRange(HASH_ALGORITHM&  hashAlg,
+                                const TYPE      *data,
+                                size_t           numElements,
+                                bsl::true_type);
+    template <class HASH_ALGORITHM, class TYPE>
+    static void hashAppendRange(HASH_ALGORITHM&  hashAlg,
+                                const TYPE      *data,
+                                size_t           numElements,
+                                bsl::false_type);
+        // Pass the specified 'numElements' objects at the specified 'data'
+        // into the specified 'hashAlg', in a single call if the last argument
+        // is of type 'bsl::true_type', and by calling 'hashAppend' on each
+        // element otherwise.
+
+    template <class HASH_ALGORITHM, class TYPE>
+    static typename HASH_ALGORITHM::result_type computeHash(
+                                                        const TYPE& key,
+                                                        bsl::true_type);
+    template <class HASH_ALGORITHM, class TYPE>
+    static typename HASH_ALGORITHM::result_type computeHash(
+                                                        const TYPE& key,
+                                                        bsl::false_type);
+        // Return the hash of the specified 'key' computed by a default
+        // constructed (template parameter) 'HASH_ALGORITHM', directly from
+        // the bytes of 'key' if the last argument is of type
+        // 'bsl::true_type', and by calling 'hashAppend' otherwise.
+};
+
                           // ================
                           // class bslh::Hash
                           // ================
@@ -558,20 +700,34 @@ void hashAppend(HASH_ALGORITHM& hashAlg, TYPE (&input)[N]);
     // Passes the specified 'input' into the specified 'hashAlg' to be combined
     // into the internal state of the algorithm which is used to produce the
     // resulting hash value.  Note that the elements in 'input' will be hashed
-    // one at a time by calling 'hashAppend' because the (template parameter)
-    // 'TYPE' might not be hashable as a contiguous sequence of bytes.  Also
-    // note that this 'hashAppend' exists because some platforms don't
-    // recognize that adding a const qualifier is a better match for arrays
-    // than decaying to a pointer and using the 'hashAppend' function for
-    // pointers.
+    // by 'hashAppendRange', which hashes them one at a time by calling
+    // 'hashAppend' unless the (template parameter) 'TYPE' is an integral
+    // type other than 'bool'.  Also note that this 'hashAppend' exists
+    // because some platforms don't recognize that adding a const qualifier is
+    // a better match for arrays than decaying to a pointer and using the
+    // 'hashAppend' function for pointers.
 
 template <class HASH_ALGORITHM, class TYPE, size_t N>
 void hashAppend(HASH_ALGORITHM& hashAlg, const TYPE (&input)[N]);
     // Passes the specified 'input' into the specified 'hashAlg' to be combined
     // into the internal state of the algorithm which is used to produce the
     // resulting hash value.  Note that the elements in 'input' will be hashed
-    // one at a time by calling 'hashAppend' because the (template parameter)
-    // 'TYPE' might not be hashable as a contiguous sequence of bytes.
+    // by 'hashAppendRange', which hashes them one at a time by calling
+    // 'hashAppend' unless the (template parameter) 'TYPE' is an integral
+    // type other than 'bool'.
+
+template <class HASH_ALGORITHM, class TYPE>
+void hashAppendRange(HASH_ALGORITHM&  hashAlg,
+                     const TYPE      *data,
+                     size_t           numElements);
+    // Passes the specified 'numElements' objects of the (template parameter)
+    // 'TYPE' at the specified 'data' into the specified 'hashAlg' to be
+    // combined into the internal state of the algorithm which is used to
+    // produce the resulting hash value.  If 'TYPE' is an integral type other
+    // than 'bool', the bytes of the range are passed to 'hashAlg' in a single
+    // call; otherwise 'hashAppend' is called on each element in turn.  The
+    // behavior is undefined unless 'data' refers to at least 'numElements'
+    // objects or 'numElements' is zero.
 
 }  // close package namespace
 
@@ -579,6 +735,98 @@ void hashAppend(HASH_ALGORITHM& hashAlg, const TYPE (&input)[N]);
 //                            INLINE DEFINITIONS
 // ============================================================================
 
+                         // -------------------------
+                         // struct bslh::Hash_OneShot
+                         // -------------------------
+
+// CLASS METHODS
+template <class HASH_ALGORITHM>
+inline
+typename HASH_ALGORITHM::result_type
+bslh::Hash_OneShot<HASH_ALGORITHM>::hashBytes(const void *data,
+                                              size_t      numBytes)
+{
+    HASH_ALGORITHM hashAlg;
+    hashAlg(data, numBytes);
+    return hashAlg.computeHash();
+}
+
+inline
+bslh::DefaultHashAlgorithm::result_type
+bslh::Hash_OneShot<bslh::DefaultHashAlgorithm>::hashBytes(
+                                                         const void *data,
+                                                         size_t      numBytes)
+{
+    return DefaultHashAlgorithm::hashBytes(data, numBytes);
+}
+
+inline
+bslh::SpookyHashAlgorithm::result_type
+bslh::Hash_OneShot<bslh::SpookyHashAlgorithm>::hashBytes(
+                                                         const void *data,
+                                                         size_t      numBytes)
+{
+    return SpookyHashAlgorithm::hashBytes(data, numBytes);
+}
+
+inline
+bslh::WyHashIncrementalAlgorithm::result_type
+bslh::Hash_OneShot<bslh::WyHashIncrementalAlgorithm>::hashBytes(
+                                                         const void *data,
+                                                         size_t      numBytes)
+{
+    return WyHashIncrementalAlgorithm::hashBytes(data, numBytes);
+}
+
+                            // ----------------------
+                            // struct bslh::Hash_Util
+                            // ----------------------
+
+// CLASS METHODS
+template <class HASH_ALGORITHM, class TYPE>
+inline
+void bslh::Hash_Util::hashAppendRange(HASH_ALGORITHM&  hashAlg,
+                                      const TYPE      *data,
+                                      size_t           numElements,
+                                      bsl::true_type)
+{
+    hashAlg(data, sizeof(TYPE) * numElements);
+}
+
+template <class HASH_ALGORITHM, class TYPE>
+inline
+void bslh::Hash_Util::hashAppendRange(HASH_ALGORITHM&  hashAlg,
+                                      const TYPE      *data,
+                                      size_t           numElements,
+                                      bsl::false_type)
+{
+    for (size_t i = 0; i < numElements; ++i) {
+        hashAppend(hashAlg, data[i]);
+    }
+}
+
+template <class HASH_ALGORITHM, class TYPE>
+inline
+typename HASH_ALGORITHM::result_type
+bslh::Hash_Util::computeHash(const TYPE& key, bsl::true_type)
+{
+    return Hash_OneShot<HASH_ALGORITHM>::hashBytes(&key, sizeof(key));
+}
+
+template <class HASH_ALGORITHM, class TYPE>
+inline
+typename HASH_ALGORITHM::result_type
+bslh::Hash_Util::computeHash(const TYPE& key, bsl::false_type)
+{
+    HASH_ALGORITHM hashAlg;
+    hashAppend(hashAlg, key);
+    return hashAlg.computeHash();
+}
+
+                          // ----------------
+                          // class bslh::Hash
+                          // ----------------
+
 // ACCESSORS
 template <class HASH_ALGORITHM>
 template <class TYPE>
@@ -586,9 +834,10 @@ inline
 typename bslh::Hash<HASH_ALGORITHM>::result_type
 bslh::Hash<HASH_ALGORITHM>::operator()(TYPE const& key) const
 {
-    HASH_ALGORITHM hashAlg;
-    hashAppend(hashAlg, key);
-    return static_cast<result_type>(hashAlg.computeHash());
+    return static_cast<result_type>(
+              Hash_Util::computeHash<HASH_ALGORITHM>(
+                                key,
+                                typename Hash_IsFixedSizeKey<TYPE>::type()));
 }
 
 // FREE FUNCTIONS
@@ -709,20 +958,26 @@ template <class HASH_ALGORITHM, class TYPE, size_t N>
 inline
 void bslh::hashAppend(HASH_ALGORITHM& hashAlg, TYPE (&input)[N])
 {
-
-    for (size_t i = 0; i < N; ++i) {
-        hashAppend(hashAlg, input[i]);
-    }
+    hashAppendRange(hashAlg, input, N);
 }
 
-
 template <class HASH_ALGORITHM, class TYPE, size_t N>
 inline
 void bslh::hashAppend(HASH_ALGORITHM& hashAlg, const TYPE (&input)[N])
 {
-    for (size_t i = 0; i < N; ++i) {
-        hashAppend(hashAlg, input[i]);
-    }
+    hashAppendRange(hashAlg, input, N);
+}
+
+template <class HASH_ALGORITHM, class TYPE>
+inline
+void bslh::hashAppendRange(HASH_ALGORITHM&  hashAlg,
+                           const TYPE      *data,
+                           size_t           numElements)
+{
+    Hash_Util::hashAppendRange(hashAlg,
+                               data,
+                               numElements,
+                               typename Hash_IsFixedSizeKey<TYPE>::type());
 }
 
 // ============================================================================
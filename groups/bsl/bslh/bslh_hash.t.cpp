@@ -3,6 +3,10 @@
 #include <bslh_defaultseededhashalgorithm.h>
 #include <bslh_siphashalgorithm.h>
 #include <bslh_spookyhashalgorithm.h>
+#include <bslh_wyhashincrementalalgorithm.h>
+
+#include <bslmf_isbitwiseequalitycomparable.h>
+#include <bslmf_nestedtraitdeclaration.h>
 
 #include <bsls_alignmentfromtype.h>
 #include <bsls_assert.h>
@@ -72,9 +76,11 @@ using namespace bslh;
 // [ 3] void hashAppend(HASHALG& hashAlg, const TYPE (&input)[N]);
 // [ 3] void hashAppend(HASHALG& hashAlg, const void *input);
 // [ 3] void hashAppend(HASHALG& hashAlg, RT (*input)(ARGS...));
+// [ 8] void hashAppendRange(HASHALG&, const TYPE *, size_t);
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 8] USAGE EXAMPLE
+// [ 9] USAGE EXAMPLE
+// [ 8] CONCERN: integral keys are hashed through 'hashBytes'
 // [ 6] IsBitwiseMovable trait
 // [ 6] is_trivially_copyable trait
 // [ 6] is_trivially_default_constructible trait
@@ -620,6 +626,136 @@ class MockAccumulatingHashingAlgorithm {
     }
 };
 
+class MockCountingHashingAlgorithm {
+    // This class implements a mock hashing algorithm that counts the calls to
+    // its function call operator and the bytes passed to them.
+
+    int    d_numCalls;  // Number of calls to 'operator()'
+    size_t d_length;    // Total length of the data we were asked to hash
+
+  public:
+    MockCountingHashingAlgorithm()
+    : d_numCalls(0)
+    , d_length(0)
+        // Create a new 'MockCountingHashingAlgorithm'
+    {
+    }
+
+    void operator()(const void *, size_t length)
+        // Count a call passing the specified 'length' bytes.
+    {
+        ++d_numCalls;
+        d_length += length;
+    }
+
+    int numCalls() const
+        // Return the number of calls to 'operator()'.
+    {
+        return d_numCalls;
+    }
+
+    size_t getLength() const
+        // Return the total number of bytes passed to 'operator()'.
+    {
+        return d_length;
+    }
+};
+
+enum TestEnum {
+    // This enumeration provides values of an enumerated type.
+
+    e_A,
+    e_B,
+    e_C
+};
+
+struct PlainPair {
+    // This 'struct' holds two 'int' members, and is not marked as bitwise
+    // EqualityComparable.
+
+    int d_first;
+    int d_second;
+};
+
+template <class HASH_ALGORITHM>
+void hashAppend(HASH_ALGORITHM& hashAlg, const PlainPair& pair)
+    // Pass the members of the specified 'pair' to the specified 'hashAlg'.
+{
+    using bslh::hashAppend;
+    hashAppend(hashAlg, pair.d_first);
+    hashAppend(hashAlg, pair.d_second);
+}
+
+struct BitwisePair {
+    // This 'struct' holds two 'int' members, and is marked as bitwise
+    // EqualityComparable.
+
+    BSLMF_NESTED_TRAIT_DECLARATION(BitwisePair,
+                                   bslmf::IsBitwiseEqualityComparable);
+
+    int d_first;
+    int d_second;
+};
+
+template <class HASH_ALGORITHM>
+void hashAppend(HASH_ALGORITHM& hashAlg, const BitwisePair& pair)
+    // Pass the members of the specified 'pair' to the specified 'hashAlg' in
+    // reverse order, so that the bytes passed differ from the object
+    // representation of 'pair'.
+{
+    using bslh::hashAppend;
+    hashAppend(hashAlg, pair.d_second);
+    hashAppend(hashAlg, pair.d_first);
+}
+
+template <class HASH_ALGORITHM, class TYPE>
+bool isHashedIncrementally(const TYPE& key)
+    // Return 'true' if 'bslh::Hash<HASH_ALGORITHM>' returns for the specified
+    // 'key' the hash computed by passing its bytes to the incremental
+    // interface of a default constructed (template parameter)
+    // 'HASH_ALGORITHM', and 'false' otherwise.
+{
+    typedef bslh::Hash<HASH_ALGORITHM> Hasher;
+
+    HASH_ALGORITHM hashAlg;
+    hashAlg(&key, sizeof key);
+
+    return Hasher()(key) ==
+                   static_cast<typename Hasher::result_type>(
+                                                       hashAlg.computeHash());
+}
+
+template <class HASH_ALGORITHM>
+void testFixedSizeKeys(int line)
+    // Verify that 'bslh::Hash<HASH_ALGORITHM>' returns, for keys of several
+    // integral types, the hash computed by the incremental interface of the
+    // (template parameter) 'HASH_ALGORITHM', using the specified 'line' in
+    // 'ASSERTV'.
+{
+    const long long VALUES[] = { 0, 1, -1, 42, 0x7fffffffLL, -123456789LL,
+                                 0x0123456789abcdefLL };
+    const int       NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+    for (int i = 0; i < NUM_VALUES; ++i) {
+        const char               C   = static_cast<char>(VALUES[i]);
+        const short              S   = static_cast<short>(VALUES[i]);
+        const int                I   = static_cast<int>(VALUES[i]);
+        const unsigned int       U   = static_cast<unsigned int>(VALUES[i]);
+        const long               L   = static_cast<long>(VALUES[i]);
+        const long long          LL  = VALUES[i];
+        const unsigned long long ULL =
+                                   static_cast<unsigned long long>(VALUES[i]);
+
+        ASSERTV(line, i, isHashedIncrementally<HASH_ALGORITHM>(C));
+        ASSERTV(line, i, isHashedIncrementally<HASH_ALGORITHM>(S));
+        ASSERTV(line, i, isHashedIncrementally<HASH_ALGORITHM>(I));
+        ASSERTV(line, i, isHashedIncrementally<HASH_ALGORITHM>(U));
+        ASSERTV(line, i, isHashedIncrementally<HASH_ALGORITHM>(L));
+        ASSERTV(line, i, isHashedIncrementally<HASH_ALGORITHM>(LL));
+        ASSERTV(line, i, isHashedIncrementally<HASH_ALGORITHM>(ULL));
+    }
+}
+
 template<class TYPE>
 class TestDriver {
     // This class implements a test driver that can run tests on any type.
@@ -847,7 +983,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:
-      case 8: {
+      case 9: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   The hashing algorithm can be applied to user defined types which
@@ -901,6 +1037,154 @@ int main(int argc, char *argv[])
         ASSERT(!hashTable.contains(Box(Point(0, 0), 0, 0)));
         ASSERT(!hashTable.contains(Box(Point(3, 3), 3, 3)));
 
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // TESTING CONTIGUOUS HASHING
+        //   Ranges of objects that can be hashed as a contiguous sequence of
+        //   bytes are passed to the hashing algorithm in a single call, and
+        //   integral keys are hashed without the incremental interface of the
+        //   algorithm.
+        //
+        // Concerns:
+        //: 1 'hashAppendRange' passes a range of integral type to the
+        //:   algorithm in a single call covering every byte of the range.
+        //:
+        //: 2 'hashAppendRange' calls 'hashAppend' on each element of a range
+        //:   of 'bool' and floating point types, so that their values are
+        //:   normalized, and of enumerated, pointer, and class types (even
+        //:   those having the 'bslmf::IsBitwiseEqualityComparable' trait),
+        //:   so that a user-supplied 'hashAppend' is honored.
+        //:
+        //: 3 'hashAppendRange' on an empty range has no effect.
+        //:
+        //: 4 'hashAppend' on an array passes the same bytes to the algorithm
+        //:   as calling 'hashAppend' on each element, including a
+        //:   user-supplied 'hashAppend'.
+        //:
+        //: 5 'bslh::Hash::operator()' returns, for an integral key, the hash
+        //:   computed by the incremental interface of the algorithm.
+        //
+        // Plan:
+        //: 1 Call 'hashAppendRange' with a counting mock algorithm on ranges
+        //:   of various types, and verify the number of calls and the number
+        //:   of bytes passed. (C-1..3)
+        //:
+        //: 2 Call 'hashAppend' on arrays of 'int', of 'double' (including
+        //:   both 0.0 and -0.0), and of a bitwise EqualityComparable class
+        //:   type with its own 'hashAppend', with an accumulating mock
+        //:   algorithm, and compare the bytes with those passed by calling
+        //:   'hashAppend' on each element. (C-4)
+        //:
+        //: 3 For the algorithms provided by 'bslh', compare the hash of keys
+        //:   of several integral types with the hash computed by the
+        //:   incremental interface. (C-5)
+        //
+        // Testing:
+        //   void hashAppendRange(HASHALG&, const TYPE *, size_t);
+        //   CONCERN: integral keys are hashed through 'hashBytes'
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING CONTIGUOUS HASHING"
+                            "\n==========================\n");
+
+        if (verbose) printf("Call 'hashAppendRange' on ranges of various"
+                            " types. (C-1..3)\n");
+        {
+            const int         INTS[]     = { 1, 2, 3, 4, 5 };
+            const TestEnum    ENUMS[]    = { e_A, e_B, e_C };
+            const char *const POINTERS[] = { "a", "b" };
+            const BitwisePair BITWISE[]  = { { 1, 2 }, { 3, 4 }, { 5, 6 } };
+            const PlainPair   PLAIN[]    = { { 1, 2 }, { 3, 4 }, { 5, 6 } };
+            const bool        BOOLS[]    = { true, false, true, true };
+            const double      DOUBLES[]  = { 0.0, -0.0, 1.5 };
+
+            {
+                MockCountingHashingAlgorithm alg;
+                hashAppendRange(alg, INTS, 5);
+                ASSERTV(alg.numCalls(), 1 == alg.numCalls());
+                ASSERTV(alg.getLength(), sizeof INTS == alg.getLength());
+            }
+            {
+                MockCountingHashingAlgorithm alg;
+                hashAppendRange(alg, ENUMS, 3);
+                ASSERTV(alg.numCalls(), 3 == alg.numCalls());
+                ASSERTV(alg.getLength(), sizeof ENUMS == alg.getLength());
+            }
+            {
+                MockCountingHashingAlgorithm alg;
+                hashAppendRange(alg, POINTERS, 2);
+                ASSERTV(alg.numCalls(), 2 == alg.numCalls());
+                ASSERTV(alg.getLength(), sizeof POINTERS == alg.getLength());
+            }
+            {
+                MockCountingHashingAlgorithm alg;
+                hashAppendRange(alg, BITWISE, 3);
+                ASSERTV(alg.numCalls(), 6 == alg.numCalls());
+                ASSERTV(alg.getLength(), sizeof BITWISE == alg.getLength());
+            }
+            {
+                MockCountingHashingAlgorithm alg;
+                hashAppendRange(alg, PLAIN, 3);
+                ASSERTV(alg.numCalls(), 6 == alg.numCalls());
+                ASSERTV(alg.getLength(), sizeof PLAIN == alg.getLength());
+            }
+            {
+                MockCountingHashingAlgorithm alg;
+                hashAppendRange(alg, BOOLS, 4);
+                ASSERTV(alg.numCalls(), 4 == alg.numCalls());
+            }
+            {
+                MockCountingHashingAlgorithm alg;
+                hashAppendRange(alg, DOUBLES, 3);
+                ASSERTV(alg.numCalls(), 3 == alg.numCalls());
+            }
+            {
+                MockCountingHashingAlgorithm alg;
+                hashAppendRange(alg, INTS, 0);
+                hashAppendRange(alg, PLAIN, 0);
+                hashAppendRange(alg, static_cast<const int *>(0), 0);
+                ASSERTV(alg.getLength(), 0 == alg.getLength());
+            }
+        }
+
+        if (verbose) printf("Call 'hashAppend' on arrays and compare with"
+                            " calling 'hashAppend' on each element. (C-4)\n");
+        {
+            const int         INTS[]    = { 1, -2, 3, 0x7fffffff, 5 };
+            const double      DOUBLES[] = { 0.0, -0.0, 1.5 };
+            const BitwisePair BITWISE[] = { { 1, 2 }, { 3, 4 } };
+
+            MockAccumulatingHashingAlgorithm arrayAlg;
+            MockAccumulatingHashingAlgorithm elementAlg;
+
+            hashAppend(arrayAlg, INTS);
+            hashAppend(arrayAlg, DOUBLES);
+            hashAppend(arrayAlg, BITWISE);
+            for (int i = 0; i < 5; ++i) {
+                hashAppend(elementAlg, INTS[i]);
+            }
+            for (int i = 0; i < 3; ++i) {
+                hashAppend(elementAlg, DOUBLES[i]);
+            }
+            for (int i = 0; i < 2; ++i) {
+                hashAppend(elementAlg, BITWISE[i]);
+            }
+
+            ASSERT(arrayAlg.getLength() == elementAlg.getLength());
+            ASSERT(0 == memcmp(arrayAlg.getData(),
+                               elementAlg.getData(),
+                               arrayAlg.getLength()));
+        }
+
+        if (verbose) printf("Compare the hash of integral keys with the hash"
+                            " computed by the incremental interface. (C-5)\n");
+        {
+            testFixedSizeKeys<DefaultHashAlgorithm>(L_);
+            testFixedSizeKeys<SpookyHashAlgorithm>(L_);
+            testFixedSizeKeys<WyHashIncrementalAlgorithm>(L_);
+        }
+
       } break;
       case 7: {
         // --------------------------------------------------------------------
@@ -330,6 +330,15 @@ class SpookyHashAlgorithm {
     // CONSTANTS
     enum { k_SEED_LENGTH = 16 }; // Seed length in bytes.
 
+    // CLASS METHODS
+    static result_type hashBytes(const void *data, size_t numBytes);
+        // Return the hash that a default constructed 'SpookyHashAlgorithm'
+        // would return from 'computeHash()' after incorporating the specified
+        // 'data', of at least the specified 'numBytes', without maintaining
+        // the incremental state of an object.  The behaviour is undefined
+        // unless 'data' points to a valid memory location with at least
+        // 'numBytes' bytes of initialized memory or 'numBytes' is zero.
+
     // CREATORS
     SpookyHashAlgorithm();
         // Create a 'SpookyHashAlgorithm' using a default initial seed.
@@ -370,6 +379,20 @@ class SpookyHashAlgorithm {
 //                            INLINE DEFINITIONS
 // ============================================================================
 
+// CLASS METHODS
+inline
+SpookyHashAlgorithm::result_type
+SpookyHashAlgorithm::hashBytes(const void *data, size_t numBytes)
+{
+    BSLS_ASSERT(0 != data || 0 == numBytes);
+
+    // These are the seeds supplied by the default constructor.
+
+    bsls::Types::Uint64 h1 = 1, h2 = 2;
+    SpookyHashAlgorithmImp::hash128(data, numBytes, &h1, &h2);
+    return h1;
+}
+
 // CREATORS
 inline
 SpookyHashAlgorithm::SpookyHashAlgorithm()
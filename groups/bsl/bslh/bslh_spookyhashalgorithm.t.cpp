@@ -42,6 +42,9 @@ using namespace bslh;
 // [ 2] SpookyHashAlgorithm(const char *seed);
 // [ 2] ~SpookyHashAlgorithm();
 //
+// CLASS METHODS
+// [ 3] static result_type hashBytes(const void *data, size_t numBytes);
+//
 // MANIPULATORS
 // [ 3] void operator()(void const* key, size_t len);
 // [ 3] result_type computeHash();
@@ -551,8 +554,11 @@ int main(int argc, char *argv[])
         //: 4 'computeHash()' and returns the appropriate value
         //:   according to the SpookyHash specification.
         //:
-        //: 5 'operator()' does a BSLS_ASSERT for null pointers and non-zero
-        //:   length, and not for null pointers and zero length.
+        //: 5 'operator()' and 'hashBytes' do a BSLS_ASSERT for null pointers
+        //:   and non-zero length, and not for null pointers and zero length.
+        //:
+        //: 6 'hashBytes' returns the value computed by 'operator()' and
+        //:   'computeHash()' for the same bytes.
         //
         // Plan:
         //: 1 Insert various lengths of c-strings into the algorithm both all
@@ -566,9 +572,14 @@ int main(int argc, char *argv[])
         //: 3 Check the output of 'computeHash()' against the expected results
         //:   from a known good version of the algorithm. (C-4)
         //:
-        //: 4 Call 'operator()' with a null pointer. (C-5)
+        //: 4 Call 'operator()' and 'hashBytes' with a null pointer. (C-5)
+        //:
+        //: 5 Hash byte sequences of every length up to 300 with 'hashBytes'
+        //:   and with the incremental interface, and verify the results
+        //:   match. (C-6)
         //
         // Testing:
+        //   static result_type hashBytes(const void *data, size_t numBytes);
         //   void operator()(void const* key, size_t len);
         //   result_type computeHash();
         // --------------------------------------------------------------------
@@ -703,6 +714,24 @@ int main(int argc, char *argv[])
             }
         }
 
+        if (verbose) printf("Hash byte sequences of every length up to 300"
+                            " with 'hashBytes' and compare with the result of"
+                            " the incremental interface. (C-6)\n");
+        {
+            char data[300];
+            for (int i = 0; i < 300; ++i) {
+                data[i] = static_cast<char>(i * 131 + 7);
+            }
+
+            for (int length = 0; length <= 300; ++length) {
+                Obj hash;
+                hash(data, length);
+
+                LOOP_ASSERT(length, hash.computeHash() ==
+                                                 Obj::hashBytes(data, length));
+            }
+        }
+
         if (verbose) printf("Call 'operator()' with null pointers. (C-5)\n");
         {
             const char data[5] = {'a', 'b', 'c', 'd', 'e'};
@@ -712,6 +741,10 @@ int main(int argc, char *argv[])
             ASSERT_FAIL(Obj().operator()(   0, 5));
             ASSERT_PASS(Obj().operator()(   0, 0));
             ASSERT_PASS(Obj().operator()(data, 5));
+
+            ASSERT_FAIL(Obj::hashBytes(   0, 5));
+            ASSERT_PASS(Obj::hashBytes(   0, 0));
+            ASSERT_PASS(Obj::hashBytes(data, 5));
         }
 
       } break;
@@ -0,0 +1,73 @@
+// bslh_wyhashincrementalalgorithm.cpp                                -*-C++-*-
+#include <bslh_wyhashincrementalalgorithm.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+namespace BloombergLP {
+
+namespace bslh {
+
+                     // --------------------------------------
+                     // class bslh::WyHashIncrementalAlgorithm
+                     // --------------------------------------
+
+// PRIVATE MANIPULATORS
+void WyHashIncrementalAlgorithm::consume(const unsigned char *data,
+                                         size_t               numBytes)
+{
+    BSLS_ASSERT(numBytes + d_bufferLength >= k_REPEAT_LENGTH);
+
+    // Complete and consume the buffered round, if any.  Its last
+    // 'k_TAIL_LENGTH' bytes are then moved to the front of the buffer, where
+    // 'computeHash' may reread them.
+
+    if (d_bufferLength) {
+        const size_t numFill = k_REPEAT_LENGTH - d_bufferLength;
+
+        memcpy(d_buffer + k_TAIL_LENGTH + d_bufferLength, data, numFill);
+        consumeRound(d_buffer + k_TAIL_LENGTH);
+        memcpy(d_buffer, d_buffer + k_REPEAT_LENGTH, k_TAIL_LENGTH);
+
+        data           += numFill;
+        numBytes       -= numFill;
+        d_bufferLength  = 0;
+    }
+
+    // Consume whole rounds directly from the input.
+
+    if (numBytes >= k_REPEAT_LENGTH) {
+        do {
+            consumeRound(data);
+            data     += k_REPEAT_LENGTH;
+            numBytes -= k_REPEAT_LENGTH;
+        } while (numBytes >= k_REPEAT_LENGTH);
+
+        memcpy(d_buffer, data - k_TAIL_LENGTH, k_TAIL_LENGTH);
+    }
+
+    if (numBytes) {
+        memcpy(d_buffer + k_TAIL_LENGTH, data, numBytes);
+        d_bufferLength = numBytes;
+    }
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
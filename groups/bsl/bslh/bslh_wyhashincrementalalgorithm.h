@@ -0,0 +1,760 @@
+// bslh_wyhashincrementalalgorithm.h                                  -*-C++-*-
+#ifndef INCLUDED_BSLH_WYHASHINCREMENTALALGORITHM
+#define INCLUDED_BSLH_WYHASHINCREMENTALALGORITHM
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an implementation of the WyHash algorithm final v4.
+//
+//@CLASSES:
+//  bslh::WyHashIncrementalAlgorithm: functor implementing WyHash
+//
+//@SEE_ALSO: bslh_hash, bslh_seededhash, bslh_spookyhashalgorithm
+//
+//@DESCRIPTION: 'bslh::WyHashIncrementalAlgorithm' implements the WyHash
+// algorithm by Wang Yi (final version 4).  WyHash is a general purpose
+// algorithm built on a 64x64->128-bit multiply-and-fold mixing step, which
+// makes it one of the fastest algorithms of its quality on the short keys (up
+// to a few dozen bytes) that dominate hash table lookups.  For more
+// information, see: https://github.com/wangyi-fudan/wyhash
+//
+// The canonical implementation of WyHash computes the hash of a single
+// contiguous byte sequence whose length is known up front.  This class
+// provides the incremental interface required of 'bslh' algorithms: bytes may
+// be supplied through any number of calls to 'operator()', and the value
+// returned by 'computeHash' is identical to the canonical hash of the
+// concatenation of those bytes.
+//
+// This class satisfies the requirements for regular 'bslh' hashing algorithms
+// and seeded 'bslh' hashing algorithms, defined in 'bslh_hash.h' and
+// 'bslh_seededhash.h' respectively.  More information can be found in the
+// package level documentation for 'bslh' (internal users can also find
+// information here {TEAM BDE:USING MODULAR HASHING<GO>})
+//
+///Security
+///--------
+// In this context "security" refers to the ability of the algorithm to produce
+// hashes that are not predictable by an attacker.  There are *no* security
+// guarantees made by 'bslh::WyHashIncrementalAlgorithm', meaning attackers may
+// be able to engineer keys that will cause a Denial of Service (DoS) attack in
+// hash tables using this algorithm, even if they do not know the seed.  If
+// security is required, an algorithm that documents better secure properties
+// should be used, such as 'bslh::SipHashAlgorithm'.
+//
+///Speed
+///-----
+// This algorithm will compute a hash on the order of O(n) where 'n' is the
+// length of the input data.  Keys of up to 16 bytes are hashed with two
+// multiplications, and longer keys with one multiplication per 16 bytes, so
+// the per-key cost for the key sizes typical of hash tables is substantially
+// lower than that of 'bslh::SpookyHashAlgorithm' and
+// 'bslh::SipHashAlgorithm'.  Note that the 128-bit product is computed with a
+// single instruction on 64-bit platforms with compiler support, and with four
+// 32-bit multiplications otherwise.
+//
+///Hash Distribution
+///-----------------
+// Output hashes will be well distributed and will avalanche, which means
+// changing one bit of the input will change approximately 50% of the output
+// bits.  This will prevent similar values from funneling to the same hash or
+// bucket.  WyHash passes the SMHasher test suite.
+//
+///Hash Consistency
+///----------------
+// This hash algorithm is endian-independent.  The hashes produced for a given
+// seed and a given sequence of bytes will be the same on big-endian and
+// little-endian platforms.  However, if the bytes hashed are the object
+// representation of a value having internal structure, such as an integral or
+// floating-point value, they are likely ordered in different ways depending on
+// the platform, and thus will not hash to the same value.
+//
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example: Creating and Using a Hash Table
+/// - - - - - - - - - - - - - - - - - - - -
+// Suppose we have any array of types that define 'operator==', and we want a
+// fast way to find out if values are contained in the array.  We can create a
+// 'HashTable' data structure that is capable of looking up values in O(1)
+// time.
+//
+// Further suppose that we will be storing futures (the financial instruments)
+// in this table.  Since futures have standardized names, we don't have to
+// worry about any malicious values causing collisions.  We will want to use a
+// general purpose hashing algorithm with a good hash distribution and good
+// speed.  This algorithm will need to be in the form of a hash functor -- an
+// object that will take objects stored in our array as input, and yield a
+// 64-bit int value.  The functor can pass the attributes of the 'TYPE' that
+// are salient to hashing into the hashing algorithm, and then return the hash
+// that is produced.
+//
+// We can use the result of the hash function to index into our array of
+// 'buckets'.  Each 'bucket' is simply a pointer to a value in our original
+// array of 'TYPE' objects.
+//
+// First, we define our 'HashTable' template class, with the two type
+// parameters: 'TYPE' (the type being referenced) and 'HASHER' (a functor that
+// produces the hash).
+//..
+//  template <class TYPE, class HASHER>
+//  class HashTable {
+//      // This class template implements a hash table providing fast lookup of
+//      // an external, non-owned, array of values of (template parameter)
+//      // 'TYPE'.
+//      //
+//      // The (template parameter) 'TYPE' shall have a transitive, symmetric
+//      // 'operator==' function.  There is no requirement that it have any
+//      // kind of creator defined.
+//      //
+//      // The 'HASHER' template parameter type must be a functor with a method
+//      // having the following signature:
+//      //..
+//      //  size_t operator()(TYPE)  const;
+//      //                   -OR-
+//      //  size_t operator()(const TYPE&) const;
+//      //..
+//      // and 'HASHER' shall have a publicly accessible default constructor
+//      // and destructor.
+//      //
+//      // Note that this hash table has numerous simplifications because we
+//      // know the size of the array and never have to resize the table.
+//
+//      // DATA
+//      const TYPE       *d_values;          // Array of values table is to
+//                                           // hold
+//      size_t            d_numValues;       // Length of 'd_values'.
+//      const TYPE      **d_bucketArray;     // Contains ptrs into 'd_values'
+//      size_t            d_bucketArrayMask; // Will always be '2^N - 1'.
+//      HASHER            d_hasher;          // User supplied hashing algorithm
+//
+//    private:
+//      // PRIVATE ACCESSORS
+//      bool lookup(size_t      *idx,
+//                  const TYPE&  value,
+//                  size_t       hashValue) const;
+//          // Look up the specified 'value', having the specified 'hashValue',
+//          // and load its index in 'd_bucketArray' into the specified 'idx'.
+//          // If not found, return the vacant entry in 'd_bucketArray' where
+//          // it should be inserted.  Return 'true' if 'value' is found and
+//          // 'false' otherwise.
+//
+//    public:
+//      // CREATORS
+//      HashTable(const TYPE *valuesArray,
+//                size_t      numValues);
+//          // Create a hash table referring to the specified 'valuesArray'
+//          // having length of the specified 'numValues'.  No value in
+//          // 'valuesArray' shall have the same value as any of the other
+//          // values in 'valuesArray'
+//
+//      ~HashTable();
+//          // Free up memory used by this hash table.
+//
+//      // ACCESSORS
+//      bool contains(const TYPE& value) const;
+//          // Return true if the specified 'value' is found in the table and
+//          // false otherwise.
+//  };
+//..
+// Then, we define a 'Future' class, which holds a c-string 'name', char
+// 'callMonth', and short 'callYear'.
+//..
+//  class Future {
+//      // This class identifies a future contract.  It tracks the name, call
+//      // month and year of the contract it represents, and allows equality
+//      // comparison.
+//
+//      // DATA
+//      const char *d_name;    // held, not owned
+//      const char  d_callMonth;
+//      const short d_callYear;
+//
+//    public:
+//      // CREATORS
+//      Future(const char *name, const char callMonth, const short callYear)
+//      : d_name(name), d_callMonth(callMonth), d_callYear(callYear)
+//          // Create a 'Future' object out of the specified 'name',
+//          // 'callMonth', and 'callYear'.
+//      {}
+//
+//      Future() : d_name(""), d_callMonth('\0'), d_callYear(0)
+//          // Create a 'Future' with default values.
+//      {}
+//
+//      // ACCESSORS
+//      const char * getMonth() const
+//          // Return the month that this future expires.
+//      {
+//          return &d_callMonth;
+//      }
+//
+//      const char * getName() const
+//          // Return the name of this future
+//      {
+//          return d_name;
+//      }
+//
+//      const short * getYear() const
+//          // Return the year that this future expires
+//      {
+//          return &d_callYear;
+//      }
+//
+//      bool operator==(const Future& other) const
+//          // Compare this to the specified 'other' object and return true if
+//          // they are equal
+//      {
+//          return (!strcmp(d_name, other.d_name))  &&
+//             d_callMonth == other.d_callMonth &&
+//             d_callYear  == other.d_callYear;
+//      }
+//  };
+//
+//  bool operator!=(const Future& lhs, const Future& rhs)
+//      // Compare compare the specified 'lhs' and 'rhs' objects and return
+//      // true if they are not equal
+//  {
+//      return !(lhs == rhs);
+//  }
+//..
+// Next, we need a hash functor for 'Future'.  We are going to use the
+// 'WyHashIncrementalAlgorithm' because it is a fast, general purpose hashing
+// algorithm that will provide an easy way to combine the attributes of
+// 'Future' objects that are salient to hashing into one reasonable hash that
+// will distribute the items evenly throughout the hash table.
+//..
+//  struct HashFuture {
+//      // This struct is a functor that will apply the
+//      // 'WyHashIncrementalAlgorithm' to objects of type 'Future'.
+//
+//      size_t operator()(const Future& future) const
+//          // Return the hash of the of the specified 'future'.  Note that
+//          // this uses the 'WyHashIncrementalAlgorithm' to quickly combine
+//          // the attributes of 'Future' objects that are salient to hashing
+//          // into a hash suitable for a hash table.
+//      {
+//          bslh::WyHashIncrementalAlgorithm hash;
+//
+//          hash(future.getName(),  strlen(future.getName()));
+//          hash(future.getMonth(), sizeof(char));
+//          hash(future.getYear(),  sizeof(short));
+//
+//          return static_cast<size_t>(hash.computeHash());
+//      }
+//  };
+//..
+// Then, we want to actually use our hash table on 'Future' objects.  We create
+// an array of 'Future's based on data that was originally from some external
+// source:
+//..
+//  Future futures[] = { Future("Swiss Franc", 'F', 2014),
+//                       Future("US Dollar", 'G', 2015),
+//                       Future("Canadian Dollar", 'Z', 2014),
+//                       Future("British Pound", 'M', 2015),
+//                       Future("Deutsche Mark", 'X', 2016),
+//                       Future("Eurodollar", 'Q', 2017)};
+//  enum { NUM_FUTURES = sizeof futures / sizeof *futures };
+//..
+// Next, we create our HashTable 'hashTable'.  We pass the functor that we
+// defined above as the second argument:
+//..
+//  HashTable<Future, HashFuture> hashTable(futures, NUM_FUTURES);
+//..
+// Now, we verify that each element in our array registers with count:
+//..
+//  for ( int i = 0; i < 6; ++i) {
+//      assert(hashTable.contains(futures[i]));
+//  }
+//..
+// Finally, we verify that futures not in our original array are correctly
+// identified as not being in the set:
+//..
+//  assert(!hashTable.contains(Future("French Franc", 'N', 2019)));
+//  assert(!hashTable.contains(Future("Swiss Franc", 'X', 2014)));
+//  assert(!hashTable.contains(Future("US Dollar", 'F', 2014)));
+//..
+//
+///Changes
+///-------
+// The third party code is the 'wyhash' function of 'wyhash.h' (final version
+// 4), restructured into this class.  Changes made to the original code
+// include:
+//
+//: 1 Adding 'BloombergLP' and 'bslh' namespaces
+//:
+//: 2 Splitting 'wyhash' into a constructor, an incremental 'operator()', and
+//:   'computeHash', buffering input so that the result is independent of how
+//:   the input is divided among calls to 'operator()'
+//:
+//: 3 Removed the 'WYHASH_CONDOM' and 'WYHASH_32BIT_MUM' configuration
+//:   options, retaining their default behavior
+//:
+//: 4 Replaced the 128-bit multiply with 'bsls' platform checks
+//:
+//: 5 Changed the seed to be supplied as 'k_SEED_LENGTH' bytes, read in
+//:   little-endian order
+//:
+//: 6 Whitespace changes and comments to meet BDE standards
+//
+///Third-Party Documentation
+///-------------------------
+//------------------------------- wyhash.h ------------------------------------
+//
+// This is free and unencumbered software released into the public domain
+// under The Unlicense (http://unlicense.org/)
+//
+// main repo: https://github.com/wangyi-fudan/wyhash
+//
+// author: Wang Yi <godspeed_china@yeah.net>
+//
+// contributors: Reini Urban, Dietrich Epp, Joshua Haberman, Tommy Ettinger,
+// Daniel Lemire, Otmar Ertl, cocowalla, leo-yuriev, Diego Barrios Romero,
+// paulie-g, dumblob, Yann Collet, ivte-ms, hyb, James Z.M. Gao, easyaspi314
+// (Devin), TheOneric
+//
+//-----------------------------------------------------------------------------
+
+#include <bslscm_version.h>
+
+#include <bslmf_isbitwisemoveable.h>
+
+#include <bsls_assert.h>
+#include <bsls_byteorder.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <stddef.h>  // for 'size_t'
+#include <string.h>  // for 'memcpy'
+
+#if defined(BSLS_PLATFORM_CMP_MSVC) && defined(BSLS_PLATFORM_CPU_X86_64)
+#include <intrin.h>  // for '_umul128'
+#endif
+
+namespace BloombergLP {
+
+namespace bslh {
+
+                     // ======================================
+                     // class bslh::WyHashIncrementalAlgorithm
+                     // ======================================
+
+class WyHashIncrementalAlgorithm {
+    // This class wraps an implementation of the "WyHash" hash algorithm in an
+    // interface that is usable in the modular hashing system in 'bslh'.
+
+  private:
+    // PRIVATE TYPES
+    typedef bsls::Types::Uint64 Uint64;
+        // Typedef for a 64-bit integer type used in the hashing algorithm.
+
+    enum {
+        k_REPEAT_LENGTH = 48,  // bytes consumed by one round of the main loop
+        k_TAIL_LENGTH   = 16,  // bytes of consumed input that the final step
+                               // may reread
+        k_BUFFER_LENGTH = k_TAIL_LENGTH + k_REPEAT_LENGTH
+    };
+
+    // DATA
+    Uint64 d_seed;
+    Uint64 d_see1;
+    Uint64 d_see2;
+        // Stores the intermediate state of the three lanes of the algorithm
+        // as values are accumulated.
+
+    union {
+        Uint64        d_alignment;
+            // Provides alignment.
+
+        unsigned char d_buffer[k_BUFFER_LENGTH];
+            // The first 'k_TAIL_LENGTH' bytes hold the last bytes of the most
+            // recently consumed round of input, and the following
+            // 'd_bufferLength' bytes hold input not yet consumed.
+    };
+
+    size_t d_bufferLength;
+        // The number of bytes of input not yet consumed.
+
+    Uint64 d_totalLength;
+        // The total length of all data that has been passed into the
+        // algorithm.
+
+    // NOT IMPLEMENTED
+    WyHashIncrementalAlgorithm(const WyHashIncrementalAlgorithm&);
+                                                                  // = delete;
+        // Do not allow copy construction.
+
+    WyHashIncrementalAlgorithm& operator=(const WyHashIncrementalAlgorithm&);
+                                                                  // = delete;
+        // Do not allow assignment.
+
+    // PRIVATE CLASS METHODS
+    static Uint64 finalize(Uint64 a, Uint64 b, Uint64 seed, Uint64 length);
+        // Return the hash of input having the specified 'length' given the
+        // specified 'a' and 'b' words read from the end of the input and the
+        // specified 'seed' lane of the algorithm state.
+
+    static Uint64 mix(Uint64 lhs, Uint64 rhs);
+        // Return the exclusive-or of the low and high halves of the 128-bit
+        // product of the specified 'lhs' and 'rhs'.
+
+    static void multiply(Uint64 *lhs, Uint64 *rhs);
+        // Load into the specified 'lhs' and 'rhs' the low and high halves,
+        // respectively, of the 128-bit product of their values.
+
+    static Uint64 read3(const unsigned char *data, size_t numBytes);
+        // Return a 64-bit value built from the first, middle, and last of the
+        // specified 'numBytes' bytes at the specified 'data'.  The behavior is
+        // undefined unless '1 <= numBytes <= 3'.
+
+    static Uint64 read4(const unsigned char *data);
+        // Return the 32-bit little-endian value at the specified 'data'.
+
+    static Uint64 read8(const unsigned char *data);
+        // Return the 64-bit little-endian value at the specified 'data'.
+
+    static void readShort(Uint64              *a,
+                          Uint64              *b,
+                          const unsigned char *data,
+                          size_t               numBytes);
+        // Load into the specified 'a' and 'b' the words that the algorithm
+        // reads from the specified 'data' having the specified 'numBytes'.
+        // The behavior is undefined unless 'numBytes <= 16'.
+
+    static Uint64 secret(int index);
+        // Return the element at the specified 'index' of the default secret
+        // of the canonical implementation.  The behavior is undefined unless
+        // '0 <= index < 4'.
+
+    // PRIVATE MANIPULATORS
+    void consume(const unsigned char *data, size_t numBytes);
+        // Incorporate the specified 'data', having the specified 'numBytes',
+        // into the internal state of the algorithm, consuming every full
+        // round of input and buffering the remainder.  The behavior is
+        // undefined unless 'numBytes + d_bufferLength >= k_REPEAT_LENGTH'.
+
+    void consumeRound(const unsigned char *data);
+        // Incorporate the 'k_REPEAT_LENGTH' bytes at the specified 'data'
+        // into the internal state of the algorithm.
+
+    void initialize(Uint64 seed);
+        // Set the internal state of the algorithm to its initial value for
+        // the specified 'seed'.
+
+  public:
+    // TYPES
+    typedef Uint64 result_type;
+        // Typedef indicating the value type returned by this algorithm.
+
+    // CONSTANTS
+    enum { k_SEED_LENGTH = 8 }; // Seed length in bytes.
+
+    // CLASS METHODS
+    static result_type hashBytes(const void *data, size_t numBytes);
+        // Return the hash that a default constructed
+        // 'WyHashIncrementalAlgorithm' would return from 'computeHash()' after
+        // incorporating the specified 'data', of at least the specified
+        // 'numBytes', without maintaining the incremental state of an object.
+        // The behaviour is undefined unless 'data' points to a valid memory
+        // location with at least 'numBytes' bytes of initialized memory or
+        // 'numBytes' is zero.  Note that input of at most 16 bytes is hashed
+        // in a fixed, short sequence of operations.
+
+    // CREATORS
+    WyHashIncrementalAlgorithm();
+        // Create a 'bslh::WyHashIncrementalAlgorithm' using a default initial
+        // seed.
+
+    explicit WyHashIncrementalAlgorithm(const char *seed);
+        // Create a 'bslh::WyHashIncrementalAlgorithm', seeded with a 64-bit
+        // ('k_SEED_LENGTH' bytes) seed pointed to by the specified 'seed'.
+        // Each bit of the supplied seed will contribute to the final hash
+        // produced by 'computeHash()'.  The behaviour is undefined unless
+        // 'seed' points to at least 8 bytes of initialized memory.
+
+    //! ~WyHashIncrementalAlgorithm() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    void operator()(const void *data, size_t numBytes);
+        // Incorporate the specified 'data', of at least the specified
+        // 'numBytes', into the internal state of the hashing algorithm.  Every
+        // bit of data incorporated into the internal state of the algorithm
+        // will contribute to the final hash produced by 'computeHash()'.  The
+        // same hash value will be produced regardless of whether a sequence of
+        // bytes is passed in all at once or through multiple calls to this
+        // member function.  Input where 'numBytes' is 0 will have no effect on
+        // the internal state of the algorithm.  The behaviour is undefined
+        // unless 'data' points to a valid memory location with at least
+        // 'numBytes' bytes of initialized memory or 'numBytes' is zero.
+
+    result_type computeHash();
+        // Return the finalized version of the hash that has been accumulated.
+        // Note that this changes the internal state of the object, so calling
+        // 'computeHash()' multiple times in a row will return different
+        // results, and only the first result returned will match the expected
+        // result of the algorithm.  Also note that a value will be returned,
+        // even if data has not been passed into 'operator()'
+};
+
+// ============================================================================
+//                  INLINE AND TEMPLATE FUNCTION DEFINITIONS
+// ============================================================================
+
+// PRIVATE CLASS METHODS
+inline
+WyHashIncrementalAlgorithm::Uint64
+WyHashIncrementalAlgorithm::finalize(Uint64 a,
+                                     Uint64 b,
+                                     Uint64 seed,
+                                     Uint64 length)
+{
+    a ^= secret(1);
+    b ^= seed;
+    multiply(&a, &b);
+    return mix(a ^ secret(0) ^ length, b ^ secret(1));
+}
+
+inline
+WyHashIncrementalAlgorithm::Uint64
+WyHashIncrementalAlgorithm::mix(Uint64 lhs, Uint64 rhs)
+{
+    multiply(&lhs, &rhs);
+    return lhs ^ rhs;
+}
+
+inline
+void WyHashIncrementalAlgorithm::multiply(Uint64 *lhs, Uint64 *rhs)
+{
+#if defined(BSLS_PLATFORM_CMP_MSVC) && defined(BSLS_PLATFORM_CPU_X86_64)
+    *lhs = _umul128(*lhs, *rhs, rhs);
+#elif defined(__SIZEOF_INT128__)
+    __extension__ typedef unsigned __int128 Uint128;
+
+    const Uint128 product = static_cast<Uint128>(*lhs) * *rhs;
+    *lhs = static_cast<Uint64>(product);
+    *rhs = static_cast<Uint64>(product >> 64);
+#else
+    const Uint64 ha = *lhs >> 32;
+    const Uint64 hb = *rhs >> 32;
+    const Uint64 la = static_cast<unsigned int>(*lhs);
+    const Uint64 lb = static_cast<unsigned int>(*rhs);
+
+    const Uint64 rh  = ha * hb;
+    const Uint64 rm0 = ha * lb;
+    const Uint64 rm1 = hb * la;
+    const Uint64 rl  = la * lb;
+    const Uint64 t   = rl + (rm0 << 32);
+    Uint64       c   = t < rl;
+    const Uint64 lo  = t + (rm1 << 32);
+    c += lo < t;
+
+    *lhs = lo;
+    *rhs = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+#endif
+}
+
+inline
+WyHashIncrementalAlgorithm::Uint64
+WyHashIncrementalAlgorithm::read3(const unsigned char *data, size_t numBytes)
+{
+    BSLS_ASSERT_SAFE(1 <= numBytes && numBytes <= 3);
+
+    return static_cast<Uint64>(data[0]) << 16
+         | static_cast<Uint64>(data[numBytes >> 1]) << 8
+         | data[numBytes - 1];
+}
+
+inline
+WyHashIncrementalAlgorithm::Uint64
+WyHashIncrementalAlgorithm::read4(const unsigned char *data)
+{
+    unsigned int value;
+    memcpy(&value, data, sizeof value);
+    return BSLS_BYTEORDER_LE_U32_TO_HOST(value);
+}
+
+inline
+WyHashIncrementalAlgorithm::Uint64
+WyHashIncrementalAlgorithm::read8(const unsigned char *data)
+{
+    Uint64 value;
+    memcpy(&value, data, sizeof value);
+    return BSLS_BYTEORDER_LE_U64_TO_HOST(value);
+}
+
+inline
+void WyHashIncrementalAlgorithm::readShort(Uint64              *a,
+                                           Uint64              *b,
+                                           const unsigned char *data,
+                                           size_t               numBytes)
+{
+    BSLS_ASSERT_SAFE(numBytes <= 16);
+
+    if (numBytes >= 4) {
+        const size_t middle = (numBytes >> 3) << 2;
+        *a = read4(data) << 32 | read4(data + middle);
+        *b = read4(data + numBytes - 4) << 32
+           | read4(data + numBytes - 4 - middle);
+    }
+    else if (numBytes > 0) {
+        *a = read3(data, numBytes);
+        *b = 0;
+    }
+    else {
+        *a = *b = 0;
+    }
+}
+
+inline
+WyHashIncrementalAlgorithm::Uint64
+WyHashIncrementalAlgorithm::secret(int index)
+{
+    BSLS_ASSERT_SAFE(0 <= index && index < 4);
+
+    static const Uint64 k_SECRET[4] = { 0x2d358dccaa6c78a5ULL,
+                                        0x8bb84b93962eacc9ULL,
+                                        0x4b33a62ed433d4a3ULL,
+                                        0x4d5a2da51de1aa47ULL };
+    return k_SECRET[index];
+}
+
+// PRIVATE MANIPULATORS
+inline
+void WyHashIncrementalAlgorithm::consumeRound(const unsigned char *data)
+{
+    d_seed = mix(read8(data)      ^ secret(1), read8(data +  8) ^ d_seed);
+    d_see1 = mix(read8(data + 16) ^ secret(2), read8(data + 24) ^ d_see1);
+    d_see2 = mix(read8(data + 32) ^ secret(3), read8(data + 40) ^ d_see2);
+}
+
+inline
+void WyHashIncrementalAlgorithm::initialize(Uint64 seed)
+{
+    d_seed         = seed ^ mix(seed ^ secret(0), secret(1));
+    d_see1         = d_seed;
+    d_see2         = d_seed;
+    d_bufferLength = 0;
+    d_totalLength  = 0;
+}
+
+// CLASS METHODS
+inline
+WyHashIncrementalAlgorithm::result_type
+WyHashIncrementalAlgorithm::hashBytes(const void *data, size_t numBytes)
+{
+    BSLS_ASSERT(0 != data || 0 == numBytes);
+
+    if (numBytes <= 16) {
+        // The seed lane is that of the default seed, 0, which the compiler
+        // can evaluate at compile time.
+
+        Uint64 a;
+        Uint64 b;
+        readShort(&a, &b, static_cast<const unsigned char *>(data), numBytes);
+        return finalize(a, b, mix(secret(0), secret(1)), numBytes);   // RETURN
+    }
+
+    WyHashIncrementalAlgorithm hash;
+    hash(data, numBytes);
+    return hash.computeHash();
+}
+
+// CREATORS
+inline
+WyHashIncrementalAlgorithm::WyHashIncrementalAlgorithm()
+{
+    initialize(0);
+}
+
+inline
+WyHashIncrementalAlgorithm::WyHashIncrementalAlgorithm(const char *seed)
+{
+    BSLS_ASSERT_SAFE(seed);
+
+    initialize(read8(reinterpret_cast<const unsigned char *>(seed)));
+}
+
+// MANIPULATORS
+inline
+void WyHashIncrementalAlgorithm::operator()(const void *data, size_t numBytes)
+{
+    BSLS_ASSERT(0 != data || 0 == numBytes);
+
+    d_totalLength += numBytes;
+
+    if (numBytes < k_REPEAT_LENGTH - d_bufferLength) {
+        if (numBytes) {
+            memcpy(d_buffer + k_TAIL_LENGTH + d_bufferLength, data, numBytes);
+            d_bufferLength += numBytes;
+        }
+        return;                                                       // RETURN
+    }
+
+    consume(static_cast<const unsigned char *>(data), numBytes);
+}
+
+inline
+WyHashIncrementalAlgorithm::result_type
+WyHashIncrementalAlgorithm::computeHash()
+{
+    const unsigned char *data = d_buffer + k_TAIL_LENGTH;
+    Uint64               a;
+    Uint64               b;
+
+    if (d_totalLength <= 16) {
+        readShort(&a, &b, data, d_bufferLength);
+    }
+    else {
+        if (d_totalLength >= k_REPEAT_LENGTH) {
+            d_seed ^= d_see1 ^ d_see2;
+        }
+
+        // If the total length is a multiple of 'k_REPEAT_LENGTH', this
+        // rereads the tail of the last round consumed.
+
+        size_t length = d_bufferLength;
+        while (length > 16) {
+            d_seed = mix(read8(data) ^ secret(1), read8(data + 8) ^ d_seed);
+            data   += 16;
+            length -= 16;
+        }
+        a = read8(data + length - 16);
+        b = read8(data + length - 8);
+    }
+
+    return finalize(a, b, d_seed, d_totalLength);
+}
+
+}  // close package namespace
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+namespace bslmf {
+template <>
+struct IsBitwiseMoveable<bslh::WyHashIncrementalAlgorithm>
+    : bsl::true_type {};
+}  // close namespace bslmf
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
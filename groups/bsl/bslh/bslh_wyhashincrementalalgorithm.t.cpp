@@ -0,0 +1,1188 @@
+// bslh_wyhashincrementalalgorithm.t.cpp                              -*-C++-*-
+#include <bslh_wyhashincrementalalgorithm.h>
+
+#include <bslh_siphashalgorithm.h>
+#include <bslh_spookyhashalgorithm.h>
+
+#include <bslmf_isbitwisemoveable.h>
+#include <bslmf_issame.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_platform.h>
+#include <bsls_stopwatch.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+using namespace bslh;
+
+//=============================================================================
+//                                  TEST PLAN
+//-----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test is a 'bslh' hashing algorithm.  The basic test plan
+// is to compare the output of the function call operator with the expected
+// output generated by a known-good implementation of the hashing algorithm,
+// both for input supplied all at once and for the same input divided among
+// many calls.  The component will also be tested for conformance to the
+// requirements on 'bslh' hashing algorithms, outlined in the 'bslh' package
+// level documentation.
+//-----------------------------------------------------------------------------
+// TYPEDEF
+// [ 4] typedef bsls::Types::Uint64 result_type;
+//
+// CONSTANTS
+// [ 5] enum { k_SEED_LENGTH = 8 };
+//
+// CREATORS
+// [ 2] WyHashIncrementalAlgorithm();
+// [ 2] WyHashIncrementalAlgorithm(const char *seed);
+// [ 2] ~WyHashIncrementalAlgorithm();
+//
+// CLASS METHODS
+// [ 3] static result_type hashBytes(const void *data, size_t numBytes);
+//
+// MANIPULATORS
+// [ 3] void operator()(void const* key, size_t len);
+// [ 3] result_type computeHash();
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] Trait IsBitwiseMoveable
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE: PER-KEY COST COMPARED TO SPOOKYHASH AND SIPHASH
+//-----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BSL ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BSL TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P            BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_           BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  PRINTF FORMAT MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ZU BSLS_BSLTESTUTIL_FORMAT_ZU
+
+//=============================================================================
+//                             USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example: Creating and Using a Hash Table
+/// - - - - - - - - - - - - - - - - - - - -
+// Suppose we have any array of types that define 'operator==', and we want a
+// fast way to find out if values are contained in the array.  We can create a
+// 'HashTable' data structure that is capable of looking up values in O(1)
+// time.
+//
+// Further suppose that we will be storing futures (the financial instruments)
+// in this table.  Since futures have standardized names, we don't have to
+// worry about any malicious values causing collisions.  We will want to use a
+// general purpose hashing algorithm with a good hash distribution and good
+// speed.  This algorithm will need to be in the form of a hash functor -- an
+// object that will take objects stored in our array as input, and yield a
+// 64-bit int value.  The functor can pass the attributes of the 'TYPE' that
+// are salient to hashing into the hashing algorithm, and then return the hash
+// that is produced.
+//
+// We can use the result of the hash function to index into our array of
+// 'buckets'.  Each 'bucket' is simply a pointer to a value in our original
+// array of 'TYPE' objects.
+//
+// First, we define our 'HashTable' template class, with the two type
+// parameters: 'TYPE' (the type being referenced) and 'HASHER' (a functor that
+// produces the hash).
+
+    template <class TYPE, class HASHER>
+    class HashTable {
+        // This class template implements a hash table providing fast lookup of
+        // an external, non-owned, array of values of (template parameter)
+        // 'TYPE'.
+        //
+        // The (template parameter) 'TYPE' shall have a transitive, symmetric
+        // 'operator==' function.  There is no requirement that it have any
+        // kind of creator defined.
+        //
+        // The 'HASHER' template parameter type must be a functor with a method
+        // having the following signature:
+        //..
+        //  size_t operator()(TYPE)  const;
+        //                   -OR-
+        //  size_t operator()(const TYPE&) const;
+        //..
+        // and 'HASHER' shall have a publicly accessible default constructor
+        // and destructor.
+        //
+        // Note that this hash table has numerous simplifications because we
+        // know the size of the array and never have to resize the table.
+
+        // DATA
+        const TYPE       *d_values;          // Array of values table is to
+                                             // hold
+        size_t            d_numValues;       // Length of 'd_values'.
+        const TYPE      **d_bucketArray;     // Contains ptrs into 'd_values'
+        size_t            d_bucketArrayMask; // Will always be '2^N - 1'.
+        HASHER            d_hasher;          // User supplied hashing algorithm
+
+
+      private:
+        // PRIVATE ACCESSORS
+        bool lookup(size_t      *idx,
+                    const TYPE&  value,
+                    size_t       hashValue) const;
+            // Look up the specified 'value', having the specified 'hashValue',
+            // and load its index in 'd_bucketArray' into the specified 'idx'.
+            // If not found, return the vacant entry in 'd_bucketArray' where
+            // it should be inserted.  Return 'true' if 'value' is found and
+            // 'false' otherwise.
+
+      public:
+        // CREATORS
+        HashTable(const TYPE *valuesArray,
+                  size_t      numValues);
+            // Create a hash table referring to the specified 'valuesArray'
+            // having length of the specified 'numValues'.  No value in
+            // 'valuesArray' shall have the same value as any of the other
+            // values in 'valuesArray'
+
+        ~HashTable();
+            // Free up memory used by this hash table.
+
+        // ACCESSORS
+        bool contains(const TYPE& value) const;
+            // Return true if the specified 'value' is found in the table and
+            // false otherwise.
+    };
+
+// Then, we define a 'Future' class, which holds a c-string 'name', char
+// 'callMonth', and short 'callYear'.
+
+    class Future {
+        // This class identifies a future contract.  It tracks the name, call
+        // month and year of the contract it represents, and allows equality
+        // comparison.
+
+        // DATA
+        const char *d_name;    // held, not owned
+        const char  d_callMonth;
+        const short d_callYear;
+
+      public:
+        // CREATORS
+        Future(const char *name, const char callMonth, const short callYear)
+        : d_name(name), d_callMonth(callMonth), d_callYear(callYear)
+            // Create a 'Future' object out of the specified 'name',
+            // 'callMonth', and 'callYear'.
+        {}
+
+        Future() : d_name(""), d_callMonth('\0'), d_callYear(0)
+            // Create a 'Future' with default values.
+        {}
+
+        // ACCESSORS
+        const char * getMonth() const
+            // Return the month that this future expires.
+        {
+            return &d_callMonth;
+        }
+
+        const char * getName() const
+            // Return the name of this future
+        {
+            return d_name;
+        }
+
+        const short * getYear() const
+            // Return the year that this future expires
+        {
+            return &d_callYear;
+        }
+
+        bool operator==(const Future& other) const
+            // Compare this to the specified 'other' object and return true if
+            // they are equal
+        {
+            return (!strcmp(d_name, other.d_name))  &&
+               d_callMonth == other.d_callMonth &&
+               d_callYear  == other.d_callYear;
+        }
+    };
+
+    bool operator!=(const Future& lhs, const Future& rhs)
+        // Compare compare the specified 'lhs' and 'rhs' objects and return
+        // true if they are not equal
+    {
+        return !(lhs == rhs);
+    }
+
+// Next, we need a hash functor for 'Future'.  We are going to use the
+// 'WyHashIncrementalAlgorithm' because it is a fast, general purpose hashing
+// algorithm that will provide an easy way to combine the attributes of
+// 'Future' objects that are salient to hashing into one reasonable hash that
+// will distribute the items evenly throughout the hash table.
+
+    struct HashFuture {
+        // This struct is a functor that will apply the
+        // 'WyHashIncrementalAlgorithm' to objects of type 'Future'.
+
+        size_t operator()(const Future& future) const
+            // Return the hash of the of the specified 'future'.  Note that
+            // this uses the 'WyHashIncrementalAlgorithm' to quickly combine
+            // the attributes of 'Future' objects that are salient to hashing
+            // into a hash suitable for a hash table.
+        {
+            bslh::WyHashIncrementalAlgorithm hash;
+
+            hash(future.getName(),  strlen(future.getName()));
+            hash(future.getMonth(), sizeof(char));
+            hash(future.getYear(),  sizeof(short));
+
+            return static_cast<size_t>(hash.computeHash());
+        }
+    };
+
+//=============================================================================
+//                     ELIDED USAGE EXAMPLE IMPLEMENTATIONS
+//-----------------------------------------------------------------------------
+
+// PRIVATE ACCESSORS
+template <class TYPE, class HASHER>
+bool HashTable<TYPE, HASHER>::lookup(size_t      *idx,
+                                     const TYPE&  value,
+                                     size_t       hashValue) const
+{
+    const TYPE *ptr;
+    for (*idx = hashValue & d_bucketArrayMask; (ptr = d_bucketArray[*idx]);
+                                   *idx = (*idx + 1) & d_bucketArrayMask) {
+        if (value == *ptr) {
+            return true;                                              // RETURN
+        }
+    }
+    // value was not found in table
+
+    return false;
+}
+
+// CREATORS
+template <class TYPE, class HASHER>
+HashTable<TYPE, HASHER>::HashTable(const TYPE *valuesArray,
+                                   size_t      numValues)
+: d_values(valuesArray)
+, d_numValues(numValues)
+, d_hasher()
+{
+    size_t bucketArrayLength = 4;
+    while (bucketArrayLength < numValues * 4) {
+        bucketArrayLength *= 2;
+
+    }
+    d_bucketArrayMask = bucketArrayLength - 1;
+    d_bucketArray = new const TYPE *[bucketArrayLength];
+    memset(d_bucketArray,  0, bucketArrayLength * sizeof(TYPE *));
+
+    for (unsigned i = 0; i < numValues; ++i) {
+        const TYPE& value = d_values[i];
+        size_t idx;
+        bool result = lookup(&idx, value, d_hasher(value));
+        BSLS_ASSERT_OPT(!result);
+        d_bucketArray[idx] = &d_values[i];
+    }
+}
+
+template <class TYPE, class HASHER>
+HashTable<TYPE, HASHER>::~HashTable()
+{
+    delete [] d_bucketArray;
+}
+
+// ACCESSORS
+template <class TYPE, class HASHER>
+bool HashTable<TYPE, HASHER>::contains(const TYPE& value) const
+{
+    size_t idx;
+    return lookup(&idx, value, d_hasher(value));
+}
+
+
+//=============================================================================
+//                     GLOBAL TYPEDEFS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef WyHashIncrementalAlgorithm Obj;
+typedef BloombergLP::bsls::Types::Uint64 Uint64;
+
+//=============================================================================
+//                     GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+namespace {
+
+void makeSeed(char *seed, Uint64 value)
+    // Load into the specified 'seed' the 'Obj::k_SEED_LENGTH' bytes of the
+    // specified 'value' in little-endian order, so that 'seed' represents
+    // 'value' as the canonical implementation interprets it.
+{
+    for (int i = 0; i < Obj::k_SEED_LENGTH; ++i) {
+        seed[i] = static_cast<char>(value >> (8 * i));
+    }
+}
+
+Uint64 hashInPieces(const char         *data,
+                    size_t              length,
+                    const char         *seed,
+                    const unsigned int *pieceLengths,
+                    int                 numPieceLengths)
+    // Return the hash of the specified 'data' having the specified 'length'
+    // computed using the specified 'seed' by an 'Obj' that is passed
+    // successive pieces of 'data' whose lengths cycle through the specified
+    // 'pieceLengths' having the specified 'numPieceLengths' elements.
+{
+    Obj    hash(seed);
+    size_t offset = 0;
+    for (int i = 0; offset < length; i = (i + 1) % numPieceLengths) {
+        size_t numBytes = pieceLengths[i];
+        if (numBytes > length - offset) {
+            numBytes = length - offset;
+        }
+        hash(data + offset, numBytes);
+        offset += numBytes;
+    }
+    return hash.computeHash();
+}
+
+template <class HASH_ALGORITHM>
+double nanosecondsPerKey(const char *seed,
+                         const char *keys,
+                         size_t      keyLength,
+                         int         numKeys,
+                         int         numIterations,
+                         Uint64     *sink)
+    // Return the average number of nanoseconds taken to hash, with a newly
+    // created object of (template parameter) 'HASH_ALGORITHM' constructed
+    // with the specified 'seed', each of the specified 'numKeys' consecutive
+    // keys at the specified 'keys', each having the specified 'keyLength',
+    // the specified 'numIterations' times.  Accumulate the hashes into the
+    // specified 'sink' so that they are not optimized away.
+{
+    bsls::Stopwatch timer;
+    timer.start();
+    for (int i = 0; i < numIterations; ++i) {
+        for (int j = 0; j < numKeys; ++j) {
+            HASH_ALGORITHM hash(seed);
+            hash(keys + j * keyLength, keyLength);
+            *sink += hash.computeHash();
+        }
+    }
+    timer.stop();
+
+    const double numHashes = static_cast<double>(numIterations) * numKeys;
+
+    return timer.accumulatedWallTime() * 1e9 / numHashes;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVeryVeryVerbose;  // suppress warning
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   The hashing algorithm can be used to create more powerful
+        //   components such as functors that can be used to power hash tables.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("USAGE EXAMPLE\n"
+                            "=============\n");
+
+// Then, we want to actually use our hash table on 'Future' objects.  We create
+// an array of 'Future's based on data that was originally from some external
+// source:
+
+        Future futures[] = { Future("Swiss Franc", 'F', 2014),
+                             Future("US Dollar", 'G', 2015),
+                             Future("Canadian Dollar", 'Z', 2014),
+                             Future("British Pound", 'M', 2015),
+                             Future("Deutsche Mark", 'X', 2016),
+                             Future("Eurodollar", 'Q', 2017)};
+        enum { NUM_FUTURES = sizeof futures / sizeof *futures };
+
+// Next, we create our HashTable 'hashTable'.  We pass the functor that we
+// defined above as the second argument:
+
+        HashTable<Future, HashFuture> hashTable(futures, NUM_FUTURES);
+
+// Now, we verify that each element in our array registers with count:
+        for ( int i = 0; i < 6; ++i) {
+            ASSERT(hashTable.contains(futures[i]));
+        }
+
+// Finally, we verify that futures not in our original array are correctly
+// identified as not being in the set:
+
+        ASSERT(!hashTable.contains(Future("French Franc", 'N', 2019)));
+        ASSERT(!hashTable.contains(Future("Swiss Franc", 'X', 2014)));
+        ASSERT(!hashTable.contains(Future("US Dollar", 'F', 2014)));
+
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING BDE TYPE TRAITS
+        //   The class is bitwise movable and should have a trait that
+        //   indicates that.
+        //
+        // Concerns:
+        //: 1 The class is marked as 'IsBitwiseMoveable'.
+        //
+        // Plan:
+        //: 1 ASSERT the presence of the trait using the 'bslalg::HasTrait'
+        //:   metafunction. (C-1)
+        //
+        // Testing:
+        //   Trait IsBitwiseMoveable
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING BDE TYPE TRAITS"
+                            "\n=======================\n");
+
+        if (verbose) printf("ASSERT the presence of the trait using the"
+                            " 'bslalg::HasTrait' metafunction. (C-1)\n");
+        {
+            ASSERT(bslmf::IsBitwiseMoveable<Obj>::value);
+        }
+
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'k_SEED_LENGTH'
+        //   The class is a seeded algorithm and should expose a
+        //   'k_SEED_LENGTH' enum.
+        //
+        // Concerns:
+        //: 1 'k_SEED_LENGTH' is publicly accessible.
+        //:
+        //: 2 'k_SEED_LENGTH' is set to 8.
+        //
+        // Plan:
+        //: 1 Access 'k_SEED_LENGTH' and ASSERT it is equal to the expected
+        //:   value. (C-1,2)
+        //
+        // Testing:
+        //   enum { k_SEED_LENGTH = 8 };
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'k_SEED_LENGTH'"
+                            "\n=======================\n");
+
+        if (verbose) printf("Access 'k_SEED_LENGTH' and ASSERT it is equal to"
+                            " the expected value. (C-1,2)\n");
+        {
+            ASSERT(8 == WyHashIncrementalAlgorithm::k_SEED_LENGTH);
+        }
+
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'result_type' TYPEDEF
+        //   Verify that the class offers the result_type typedef that needs to
+        //   be exposed by all 'bslh' hashing algorithms
+        //
+        // Concerns:
+        //: 1 The typedef 'result_type' is publicly accessible and an alias for
+        //:   'bsls::Types::Uint64'.
+        //:
+        //: 2 'computeHash()' returns 'result_type'
+        //
+        // Plan:
+        //: 1 ASSERT the typedef is accessible and is the correct type using
+        //:   'bslmf::IsSame'. (C-1)
+        //:
+        //: 2 Declare the expected signature of 'computeHash()' and then assign
+        //:   to it.  If it compiles, the test passes. (C-2)
+        //
+        // Testing:
+        //   typedef bsls::Types::Uint64 result_type;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'result_type' TYPEDEF"
+                            "\n=============================\n");
+
+        if (verbose) printf("ASSERT the typedef is accessible and is the"
+                            " correct type using 'bslmf::IsSame'. (C-1)\n");
+        {
+            ASSERT((bslmf::IsSame<bsls::Types::Uint64,
+                                  Obj::result_type>::VALUE));
+        }
+
+        if (verbose) printf("Declare the expected signature of 'computeHash()'"
+                            " and then assign to it.  If it compiles, the test"
+                            " passes. (C-2)\n");
+        {
+            Obj::result_type (Obj::*expectedSignature) ();
+
+            expectedSignature = &Obj::computeHash;
+            (void)expectedSignature;
+        }
+
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'operator()' AND 'computeHash()'
+        //   Verify the class provides an overload for the function call
+        //   operator that can be called with some bytes and a length.  Verify
+        //   that calling 'operator()' will permute the algorithm's internal
+        //   state as specified by WyHash.  Verify that 'computeHash()' returns
+        //   the final value specified by the canonical WyHash implementation.
+        //
+        // Concerns:
+        //: 1 The function call operator is callable.
+        //:
+        //: 2 Given the same bytes, the function call operator will permute the
+        //:   internal state of the algorithm in the same way, regardless of
+        //:   whether the bytes are passed in all at once or in pieces, and in
+        //:   particular regardless of where the pieces begin and end relative
+        //:   to the 48-byte rounds and the 16-byte tail.
+        //:
+        //: 3 Byte sequences passed in to 'operator()' with a length of 0 will
+        //:   not contribute to the final hash
+        //:
+        //: 4 'computeHash()' returns the appropriate value according to the
+        //:   WyHash specification, for inputs handled by each of the short
+        //:   (at most 16 bytes), medium, and multi-round paths.
+        //:
+        //: 5 The seed supplied at construction is interpreted as a
+        //:   little-endian 64-bit value, as by the canonical implementation.
+        //:
+        //: 6 'operator()' and 'hashBytes' do a BSLS_ASSERT for null pointers
+        //:   and non-zero length, and not for null pointers and zero length.
+        //:
+        //: 7 'hashBytes' returns the value computed by 'operator()' and
+        //:   'computeHash()' for the same bytes.
+        //
+        // Plan:
+        //: 1 Insert various lengths of strings into the algorithm both all at
+        //:   once and char by char using 'operator()'.  Assert that the
+        //:   algorithm produces the same result in both cases. (C-1,2)
+        //:
+        //: 2 Hash strings all at once and with multiple calls to 'operator()'
+        //:   with length 0.  Assert that both methods of hashing strings
+        //:   produce the same values.(C-3)
+        //:
+        //: 3 Check the output of 'computeHash()' against the expected results
+        //:   from a known good version of the algorithm. (C-4)
+        //:
+        //: 4 Hash the test vectors published with the canonical implementation
+        //:   using their seeds, and check the results. (C-5)
+        //:
+        //: 5 For every length up to 200 bytes, hash pseudo-random data passed
+        //:   in pieces whose lengths cycle through a table of lengths chosen
+        //:   to straddle the internal buffer boundaries, and verify the result
+        //:   matches the hash of the same data passed all at once. (C-2)
+        //:
+        //: 6 Call 'operator()' and 'hashBytes' with a null pointer. (C-6)
+        //:
+        //: 7 Hash byte sequences of every length up to 300 with 'hashBytes'
+        //:   and with the incremental interface, and verify the results
+        //:   match. (C-7)
+        //
+        // Testing:
+        //   static result_type hashBytes(const void *data, size_t numBytes);
+        //   void operator()(void const* key, size_t len);
+        //   result_type computeHash();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'operator()' AND 'computeHash()'"
+                            "\n========================================\n");
+
+        // The input hashed for each entry of 'DATA' is the first 'd_length'
+        // characters of 'k_PATTERN'.  Note that the algorithm reads its input
+        // in little-endian order on all platforms, so the expected hashes do
+        // not depend on the byte order of the platform.
+
+        static const char k_PATTERN[] =
+                     "12345678901234567890123456789012345678901234567890"
+                     "12345678901234567890123456789012345678901234567890"
+                     "12345678901234567890123456789";
+
+        static const struct {
+            int                  d_line;
+            int                  d_length;
+            bsls::Types::Uint64  d_expectedHash;
+        } DATA[] = {
+        // LINE LENGTH                  HASH
+         {  L_,     1, 14530020785791580170ULL,},
+         {  L_,     2,  9843717798896708226ULL,},
+         {  L_,     3,  3129789143644569579ULL,},
+         {  L_,     4,  9479618551612963370ULL,},
+         {  L_,     5,  3963873508453707620ULL,},
+         {  L_,     6, 16880224817819365153ULL,},
+         {  L_,     7, 17238209688330046621ULL,},
+         {  L_,     8, 16884480881891038673ULL,},
+         {  L_,     9,  6986004815908187255ULL,},
+         {  L_,    10,  2651239019635830564ULL,},
+         {  L_,    11,  5996526293929543982ULL,},
+         {  L_,    12, 13076667019151633514ULL,},
+         {  L_,    13,  4070803974053074645ULL,},
+         {  L_,    14,  3279594353762576381ULL,},
+         {  L_,    15,  8716315145871469487ULL,},
+         {  L_,    16,    78302340168896960ULL,},
+         {  L_,    17, 18192345620073581257ULL,},
+         {  L_,    18, 10867889578446987524ULL,},
+         {  L_,    19, 12410676863811293513ULL,},
+         {  L_,    20, 17014185259216636145ULL,},
+         {  L_,    47,  7514951151243846900ULL,},
+         {  L_,    48, 14189321265015293397ULL,},
+         {  L_,    49,   682460268813566671ULL,},
+         {  L_,    63,  2862071464175699316ULL,},
+         {  L_,    64,  8326121566116328028ULL,},
+         {  L_,    65, 13188876861203402168ULL,},
+         {  L_,    96, 13629640816055253465ULL,},
+         {  L_,   100,  3510819735449810951ULL,},
+         {  L_,   128,  1576441521825223309ULL,},
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        if (verbose) printf("Insert various lengths of strings into the"
+                            " algorithm both all at once and char by char"
+                            " using 'operator()'.  Assert that the algorithm"
+                            " produces the same result in both cases. (C-1,2)"
+                            "\n");
+        {
+            for (int i = 0; i != NUM_DATA; ++i) {
+                const int   LINE   = DATA[i].d_line;
+                const int   LENGTH = DATA[i].d_length;
+                const char *VALUE  = k_PATTERN;
+
+                if (veryVerbose) printf("Hashing: %.*s\n", LENGTH, VALUE);
+
+                Obj contiguousHash;
+                Obj dispirateHash;
+
+                contiguousHash(VALUE, LENGTH);
+                for (int j = 0; j < LENGTH; ++j){
+                    if (veryVeryVerbose) printf("Hashing by char: %c\n",
+                                                                     VALUE[j]);
+                    dispirateHash(&VALUE[j], sizeof(char));
+                }
+
+                LOOP_ASSERT(LINE, contiguousHash.computeHash() ==
+                                                  dispirateHash.computeHash());
+            }
+        }
+
+        if (verbose) printf("Hash strings all at once and with multiple"
+                            " calls to 'operator()' with length 0.  Assert"
+                            " that both methods of hashing strings produce"
+                            " the same values.(C-3)\n");
+        {
+            for (int i = 0; i != NUM_DATA; ++i) {
+                const int   LINE   = DATA[i].d_line;
+                const int   LENGTH = DATA[i].d_length;
+                const char *VALUE  = k_PATTERN;
+
+                if (veryVerbose) printf("Hashing: %.*s\n", LENGTH, VALUE);
+
+                Obj contiguousHash;
+                Obj dispirateHash;
+
+                contiguousHash(VALUE, LENGTH);
+                for (int j = 0; j < LENGTH; ++j){
+                    if (veryVeryVerbose) printf("Hashing by char: %c\n",
+                                                                     VALUE[j]);
+                    dispirateHash(&VALUE[j], sizeof(char));
+                    dispirateHash(VALUE, 0);
+                }
+
+                LOOP_ASSERT(LINE, contiguousHash.computeHash() ==
+                                                  dispirateHash.computeHash());
+            }
+        }
+
+        if (verbose) printf("Check the output of 'computeHash()' against the"
+                            " expected results from a known good version of"
+                            " the algorithm. (C-4)\n");
+        {
+            for (int i = 0; i != NUM_DATA; ++i) {
+                const int                LINE   = DATA[i].d_line;
+                const int                LENGTH = DATA[i].d_length;
+                const char              *VALUE  = k_PATTERN;
+                const unsigned long long HASH   = DATA[i].d_expectedHash;
+
+                if (veryVerbose) printf("Hashing: %.*s, Expecting: %llu\n",
+                                        LENGTH,
+                                        VALUE,
+                                        HASH);
+
+                Obj hash;
+                hash(VALUE, LENGTH);
+                LOOP_ASSERT(LINE, hash.computeHash() == HASH);
+            }
+        }
+
+        if (verbose) printf("Hash the test vectors published with the"
+                            " canonical implementation using their seeds, and"
+                            " check the results. (C-5)\n");
+        {
+            static const struct {
+                int                  d_line;
+                const char          *d_value;
+                bsls::Types::Uint64  d_expectedHash;
+            } VECTORS[] = {
+                // LINE  SEED: INDEX, VALUE
+                //       HASH
+                { L_, "",
+                  0x93228a4de0eec5a2ULL },
+                { L_, "a",
+                  0xc5bac3db178713c4ULL },
+                { L_, "abc",
+                  0xa97f2f7b1d9b3314ULL },
+                { L_, "message digest",
+                  0x786d1f1df3801df4ULL },
+                { L_, "abcdefghijklmnopqrstuvwxyz",
+                  0xdca5a8138ad37c87ULL },
+                { L_, "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz"
+                      "0123456789",
+                  0xb9e734f117cfaf70ULL },
+                { L_, "12345678901234567890123456789012345678901234567890"
+                      "123456789012345678901234567890",
+                  0x6cc5eab49a92d617ULL },
+            };
+            const int NUM_VECTORS = sizeof VECTORS / sizeof *VECTORS;
+
+            for (int i = 0; i != NUM_VECTORS; ++i) {
+                const int                LINE  = VECTORS[i].d_line;
+                const char              *VALUE = VECTORS[i].d_value;
+                const unsigned long long HASH  = VECTORS[i].d_expectedHash;
+
+                if (veryVerbose) printf("Hashing: %s, Seed: %d\n", VALUE, i);
+
+                char seed[Obj::k_SEED_LENGTH];
+                makeSeed(seed, i);
+
+                Obj hash(seed);
+                hash(VALUE, strlen(VALUE));
+                LOOP_ASSERT(LINE, hash.computeHash() == HASH);
+            }
+        }
+
+        if (verbose) printf("Hash pseudo-random data in pieces whose lengths"
+                            " straddle the internal buffer boundaries and"
+                            " verify the result matches the hash of the same"
+                            " data passed all at once. (C-2)\n");
+        {
+            static const unsigned int PIECES[][4] = {
+                {  1,  1,  1,  1 },
+                {  3,  5,  7, 11 },
+                { 15, 16, 17,  1 },
+                { 47,  1, 48,  2 },
+                { 49, 13, 95,  4 },
+                { 31, 64, 17, 50 },
+                {  0, 97,  0,  5 },
+            };
+            const int NUM_PIECES = sizeof PIECES / sizeof *PIECES;
+
+            enum { k_MAX_LENGTH = 200 };
+
+            char         data[k_MAX_LENGTH];
+            unsigned int state = 12345;
+            for (int i = 0; i < k_MAX_LENGTH; ++i) {
+                state   = state * 1103515245 + 12345;
+                data[i] = static_cast<char>(state >> 16);
+            }
+
+            char seed[Obj::k_SEED_LENGTH];
+            makeSeed(seed, 0x0123456789abcdefULL);
+
+            for (int length = 0; length <= k_MAX_LENGTH; ++length) {
+                Obj wholeHash(seed);
+                wholeHash(data, length);
+                const Uint64 EXPECTED = wholeHash.computeHash();
+
+                for (int i = 0; i < NUM_PIECES; ++i) {
+                    const Uint64 RESULT = hashInPieces(data,
+                                                       length,
+                                                       seed,
+                                                       PIECES[i],
+                                                       4);
+                    LOOP2_ASSERT(length, i, EXPECTED == RESULT);
+                }
+            }
+        }
+
+        if (verbose) printf("Hash byte sequences of every length up to 300"
+                            " with 'hashBytes' and compare with the result of"
+                            " the incremental interface. (C-7)\n");
+        {
+            char data[300];
+            for (int i = 0; i < 300; ++i) {
+                data[i] = static_cast<char>(i * 131 + 7);
+            }
+
+            for (int length = 0; length <= 300; ++length) {
+                Obj hash;
+                hash(data, length);
+
+                LOOP_ASSERT(length, hash.computeHash() ==
+                                                 Obj::hashBytes(data, length));
+            }
+        }
+
+        if (verbose) printf("Call 'operator()' with null pointers. (C-6)\n");
+        {
+            const char data[5] = {'a', 'b', 'c', 'd', 'e'};
+
+            bsls::AssertTestHandlerGuard guard;
+
+            ASSERT_FAIL(Obj().operator()(   0, 5));
+            ASSERT_PASS(Obj().operator()(   0, 0));
+            ASSERT_PASS(Obj().operator()(data, 5));
+
+            ASSERT_FAIL(Obj::hashBytes(   0, 5));
+            ASSERT_PASS(Obj::hashBytes(   0, 0));
+            ASSERT_PASS(Obj::hashBytes(data, 5));
+        }
+
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING CREATORS
+        //   Ensure that the implicit destructor as well as the explicit
+        //   default and parameterized constructors are publicly callable.
+        //   Verify that the algorithm can be instantiated with or without a
+        //   seed.  Note that a null pointer is not tested here, because there
+        //   is no way to perform a BSLS_ASSERT before dereferenceing the
+        //   pointer (without a performance penalty).
+        //
+        // Concerns:
+        //: 1 Objects can be created using the default constructor.
+        //:
+        //: 2 Objects can be created using the parameterized constructor.
+        //:
+        //: 3 Objects can be destroyed.
+        //:
+        //: 4 A default constructed object produces the same hashes as one
+        //:   constructed with an all-zero seed, and a different seed produces
+        //:   different hashes.
+        //
+        // Plan:
+        //: 1 Create a default constructed 'WyHashIncrementalAlgorithm' and
+        //:   allow it to leave scope to be destroyed. (C-1,3)
+        //:
+        //: 2 Call the parameterized constructor with a seed. (C-2)
+        //:
+        //: 3 Hash the same data with default constructed objects and objects
+        //:   constructed with all-zero and non-zero seeds, and compare the
+        //:   results. (C-4)
+        //
+        // Testing:
+        //   WyHashIncrementalAlgorithm();
+        //   WyHashIncrementalAlgorithm(const char *seed);
+        //   ~WyHashIncrementalAlgorithm();
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            printf("\nTESTING CREATORS"
+                   "\n================\n");
+
+        if (verbose) printf("Create a default constructed"
+                            " 'WyHashIncrementalAlgorithm' and allow it to"
+                            " leave scope to be destroyed. (C-1,3)\n");
+        {
+            Obj alg1;
+        }
+
+        if (verbose) printf("Call the parameterized constructor with a seed."
+                            " (C-2)\n");
+        {
+            Uint64 array[1] = {0};
+            Obj alg1(reinterpret_cast<const char *>(array));
+        }
+
+        if (verbose) printf("Hash the same data with default constructed"
+                            " objects and objects constructed with all-zero"
+                            " and non-zero seeds, and compare the results."
+                            " (C-4)\n");
+        {
+            const char *VALUE = "Hello World";
+
+            char zeroSeed[Obj::k_SEED_LENGTH];
+            char otherSeed[Obj::k_SEED_LENGTH];
+            makeSeed(zeroSeed, 0);
+            makeSeed(otherSeed, 1);
+
+            Obj defaultHash;
+            Obj zeroHash(zeroSeed);
+            Obj otherHash(otherSeed);
+
+            defaultHash(VALUE, strlen(VALUE));
+            zeroHash(VALUE, strlen(VALUE));
+            otherHash(VALUE, strlen(VALUE));
+
+            const Uint64 DEFAULT_RESULT = defaultHash.computeHash();
+            ASSERT(DEFAULT_RESULT == zeroHash.computeHash());
+            ASSERT(DEFAULT_RESULT != otherHash.computeHash());
+        }
+
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an instance of 'bslh::WyHashIncrementalAlgorithm'. (C-1)
+        //:
+        //: 2 Verify different hashes are produced for different c-strings.
+        //:   (C-1)
+        //:
+        //: 3 Verify the same hashes are produced for the same c-strings. (C-1)
+        //:
+        //: 4 Verify different hashes are produced for different 'int's. (C-1)
+        //:
+        //: 5 Verify the same hashes are produced for the same 'int's. (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        if (verbose) printf(
+                           "Instantiate 'bslh::WyHashIncrementalAlgorithm'\n");
+        {
+            WyHashIncrementalAlgorithm hashAlg;
+        }
+
+        if (verbose) printf("Verify different hashes are produced for"
+                            " different c-strings.\n");
+        {
+            WyHashIncrementalAlgorithm hashAlg1;
+            WyHashIncrementalAlgorithm hashAlg2;
+            const char * str1 = "Hello World";
+            const char * str2 = "Goodbye World";
+            hashAlg1(str1, strlen(str1));
+            hashAlg2(str2, strlen(str2));
+            ASSERT(hashAlg1.computeHash() != hashAlg2.computeHash());
+        }
+
+        if (verbose) printf("Verify the same hashes are produced for the same"
+                            " c-strings.\n");
+        {
+            WyHashIncrementalAlgorithm hashAlg1;
+            WyHashIncrementalAlgorithm hashAlg2;
+            const char * str1 = "Hello World";
+            const char * str2 = "Hello World";
+            hashAlg1(str1, strlen(str1));
+            hashAlg2(str2, strlen(str2));
+            ASSERT(hashAlg1.computeHash() == hashAlg2.computeHash());
+        }
+
+        if (verbose) printf("Verify different hashes are produced for"
+                            " different 'int's.\n");
+        {
+            WyHashIncrementalAlgorithm hashAlg1;
+            WyHashIncrementalAlgorithm hashAlg2;
+            int int1 = 123456;
+            int int2 = 654321;
+            hashAlg1(&int1, sizeof(int));
+            hashAlg2(&int2, sizeof(int));
+            ASSERT(hashAlg1.computeHash() != hashAlg2.computeHash());
+        }
+
+        if (verbose) printf("Verify the same hashes are produced for the same"
+                            " 'int's.\n");
+        {
+            WyHashIncrementalAlgorithm hashAlg1;
+            WyHashIncrementalAlgorithm hashAlg2;
+            int int1 = 123456;
+            int int2 = 123456;
+            hashAlg1(&int1, sizeof(int));
+            hashAlg2(&int2, sizeof(int));
+            ASSERT(hashAlg1.computeHash() == hashAlg2.computeHash());
+        }
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: PER-KEY COST COMPARED TO SPOOKYHASH AND SIPHASH
+        //
+        // Concerns:
+        //: 1 Hashing a short key, such as an integer or a short string, with
+        //:   'WyHashIncrementalAlgorithm' is faster than doing so with
+        //:   'SpookyHashAlgorithm' or 'SipHashAlgorithm'.
+        //
+        // Plan:
+        //: 1 For each of several key lengths, time creating an algorithm,
+        //:   hashing one key, and computing the hash, for each algorithm, and
+        //:   report the average number of nanoseconds per key.  The number of
+        //:   iterations may be specified as the second argument.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: PER-KEY COST COMPARED TO SPOOKYHASH AND SIPHASH
+        // --------------------------------------------------------------------
+
+        printf("\nPERFORMANCE: PER-KEY COST COMPARED TO SPOOKYHASH AND SIPHASH"
+               "\n============================================================"
+               "\n");
+
+        const int numIterations = argc > 2 ? atoi(argv[2]) : 2000;
+
+        enum { k_NUM_KEYS = 1024, k_MAX_KEY_LENGTH = 256 };
+
+        static char  keys[k_NUM_KEYS * k_MAX_KEY_LENGTH];
+        unsigned int state = 12345;
+        for (int i = 0; i < k_NUM_KEYS * k_MAX_KEY_LENGTH; ++i) {
+            state   = state * 1103515245 + 12345;
+            keys[i] = static_cast<char>(state >> 16);
+        }
+
+        static const size_t KEY_LENGTHS[] = { 4, 8, 16, 32, 64, 256 };
+        const int NUM_KEY_LENGTHS = sizeof KEY_LENGTHS / sizeof *KEY_LENGTHS;
+
+        // A seed long enough for every algorithm being compared.
+
+        const char seed[16] = { 0 };
+
+        Uint64 sink = 0;
+
+        printf("%8s %12s %12s %12s\n", "length", "wyhash", "spooky", "sip");
+        for (int i = 0; i < NUM_KEY_LENGTHS; ++i) {
+            const size_t LENGTH = KEY_LENGTHS[i];
+
+            const double wy     = nanosecondsPerKey<Obj>(seed,
+                                                         keys,
+                                                         LENGTH,
+                                                         k_NUM_KEYS,
+                                                         numIterations,
+                                                         &sink);
+            const double spooky = nanosecondsPerKey<SpookyHashAlgorithm>(
+                                                                 seed,
+                                                                 keys,
+                                                                 LENGTH,
+                                                                 k_NUM_KEYS,
+                                                                 numIterations,
+                                                                 &sink);
+            const double sip    = nanosecondsPerKey<SipHashAlgorithm>(
+                                                                 seed,
+                                                                 keys,
+                                                                 LENGTH,
+                                                                 k_NUM_KEYS,
+                                                                 numIterations,
+                                                                 &sink);
+
+            printf("%8u %10.2fns %10.2fns %10.2fns\n",
+                   static_cast<unsigned int>(LENGTH),
+                   wy,
+                   spooky,
+                   sip);
+        }
+
+        if (veryVerbose) printf("(sink: %llu)\n", sink);
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
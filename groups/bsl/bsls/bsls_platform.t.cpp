@@ -39,6 +39,7 @@ using namespace BloombergLP;
 // [ 2] BSLS_PLATFORM_IS_BIG_ENDIAN
 // [ 3] BSLS_PLATFORM_NO_64_BIT_LITERALS
 // [ 5] BSLS_PLATFORM_CPU_SSE*
+// [ 5] BSLS_PLATFORM_CPU_AVX2
 // ============================================================================
 
 // ============================================================================
@@ -1647,6 +1648,7 @@ int main(int argc, char *argv[])
         //
         // Testing
         //   BSLS_PLATFORM_CPU_SSE*
+        //   BSLS_PLATFORM_CPU_AVX2
         // --------------------------------------------------------------------
 
         if (verbose) printf("\nTESTING SSE MACROS"
@@ -1677,6 +1679,14 @@ int main(int argc, char *argv[])
         #else
             ASSERT(0 == ((info[2] >>  0) & 0x1));
         #endif
+
+        // AVX2 is enabled only by compiler options (e.g., '-mavx2'), so we
+        // can verify only that a build that uses AVX2 runs on a CPU having it.
+
+        #ifdef BSLS_PLATFORM_CPU_AVX2
+            cpuid(info, 0x00000007);
+            ASSERT(1 == ((info[1] >>  5) & 0x1));
+        #endif
       } break;
       case 4: {
         // --------------------------------------------------------------------
@@ -168,6 +168,47 @@ BSLS_IDENT("$Id: $")
 // basic exception guarantee.  There are similar concerns for the 'COMPARATOR'
 // predicate.
 //
+///Incremental Rehash
+///------------------
+// By default, an insertion that would exceed the 'maxLoadFactor' re-indexes
+// every element into a new, larger array of buckets before returning, which
+// takes time linear in the size of the table.  If incremental rehashing is
+// enabled (see 'setIncrementalRehashEnabled'), such an insertion instead
+// exactly doubles the number of buckets, and the re-indexing work is spread
+// over the insertions made between two such growths.
+//
+// This relies on the elements of each bucket being kept in "split order":
+// when the number of buckets, 'N', doubles, the elements of the bucket at
+// index 'i' move either to the bucket at index 'i' or to the bucket at index
+// 'i + N' of the new array, depending on the bit of their hash code divided
+// by 'N' that is the lowest.  Ordering the elements of a bucket by the
+// bit-reversed value of their hash code divided by 'N' places the elements
+// moving to the bucket at index 'i' before those moving to the bucket at
+// index 'i + N', and orders each half in the same way for the next doubling.
+// Each insertion places its element at its position in split order within
+// its bucket, and also splits a few buckets, at a rate ensuring that every
+// bucket is split before the array must grow: splitting the bucket at index
+// 'i' locates its first element moving to the upper half of the array (the
+// "split point" of the bucket), and records the two halves of the bucket as
+// the buckets at indices 'i' and 'i + N' of the next, twice larger, array of
+// buckets.  Insertions and removals keep the buckets of the next array
+// already recorded up to date.  Growing the array then only replaces the
+// array of buckets with the next one, without computing any hash code,
+// without relinking any element, and without visiting any bucket.
+// 'completeRehash' splits every remaining bucket.  Note that, while the next
+// array is being built, this hash-table holds both arrays of buckets, as a
+// non-incremental rehash does while it is in progress.
+//
+// Hence, whether or not incremental rehashing is enabled, every element is
+// indexed by a single array of buckets at all times, so that the bucket
+// interface ('bucketAtIndex', 'bucketIndexForKey', and
+// 'countElementsInBucket') is always valid, and an insertion that grows the
+// array does not invalidate iterators.  Enabling incremental rehashing on a
+// non-empty table, and any operation explicitly rehashing the table
+// ('rehashForNumBuckets', 'reserveForNumElements', and 'setMaxLoadFactor')
+// while it is enabled, re-indexes all the elements at once, and reorders
+// them into split order.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.  The
@@ -1946,9 +1987,32 @@ class HashTable {
                                          // rehash is required (computed from
                                          // 'd_maxLoadFactor')
     float               d_maxLoadFactor; // maximum permitted load factor
+    bool                d_incrementalRehash;
+                                         // 'true' if the elements of each
+                                         // bucket are kept in split order, and
+                                         // growing the bucket array on
+                                         // insertion only splits each bucket
+    bslalg::HashTableBucket
+                       *d_nextBuckets_p; // array of twice as many buckets as
+                                         // 'd_anchor', holding at indices 'i'
+                                         // and 'i + numBuckets()' the two
+                                         // halves of the bucket at index 'i'
+                                         // of 'd_anchor' for each
+                                         // 'i < d_numSplitPoints' (the other
+                                         // buckets being uninitialized), or 0
+    SizeType            d_numSplitPoints;// number of leading buckets split
+                                         // into 'd_nextBuckets_p'
 
   private:
     // PRIVATE MANIPULATORS
+    void advanceRehash();
+        // If incremental rehashing is enabled, split enough buckets, in
+        // order, into the next array of buckets that every bucket is split by
+        // the time the number of elements in this table reaches
+        // 'rehashThreshold'.  This method must be called before each
+        // insertion.  If the 'hasher' throws, this table is left unchanged,
+        // except for the buckets already split.
+
     void copyDataStructure(bslalg::BidirectionalLink *cursor);
         // Copy the sequence of elements from the list starting at the
         // specified 'cursor' and having 'size' elements.  Allocate a bucket
@@ -1960,6 +2024,44 @@ class HashTable {
         // for the 'size' and other attributes that may not be consistent with
         // the class invariants until after this method is called.
 
+    void computeNextSplitPoint();
+        // Compute the split point of the bucket at index 'd_numSplitPoints',
+        // allocating the next array of buckets if needed, record the two
+        // halves of the bucket in the next array of buckets, and increment
+        // 'd_numSplitPoints'.  If the 'hasher' throws, this table is left
+        // unchanged, except for the allocation of the next array of buckets.
+        // The behavior is undefined unless incremental rehashing is enabled
+        // and 'd_numSplitPoints < numBuckets()'.
+
+    void destroySplitPoints();
+        // Deallocate the next array of buckets, if any, so that no bucket is
+        // split.
+
+    void growBucketArray();
+        // Increase the number of buckets of this table so that it can hold at
+        // least one more element without exceeding 'maxLoadFactor'.  If
+        // incremental rehashing is enabled and this table is not empty, split
+        // any remaining bucket, and exactly double the number of buckets by
+        // replacing the array of buckets with the next one, in constant time
+        // if every bucket was already split; otherwise, rehash all the
+        // elements into the new array.  If this function tries
+        // to allocate a number of buckets larger than can be represented by
+        // this hash-table's 'SizeType', a 'std::length_error' exception is
+        // thrown.
+
+    void insertNode(bslalg::BidirectionalLink *node,
+                    native_std::size_t         hashCode,
+                    bslalg::BidirectionalLink *position);
+        // Insert the specified 'node', having the specified 'hashCode', into
+        // this table immediately before the specified 'position', or, if
+        // 'position' is 0, at the back of its bucket if incremental rehashing
+        // is enabled, and at the front of its bucket otherwise, and update
+        // the split point of that bucket, if known.  This method does not
+        // increment 'd_size'.  The behavior is undefined unless 'position' is
+        // 0 or is an element of the bucket of 'node', and, if incremental
+        // rehashing is enabled, inserting 'node' there preserves the split
+        // order of that bucket (see 'findSplitOrderPosition').
+
     void moveDataStructure(bslalg::BidirectionalLink *cursor);
         // Recreate the sequence of elements from the list starting at the
         // specified 'cursor' and having (member) 'd_size' elements, ensuring
@@ -2020,6 +2122,12 @@ class HashTable {
         // with a new value, or when the hash table is going out of scope and
         // the extra bookkeeping is not necessary.
 
+    void sortBucketsInSplitOrder(bslalg::HashTableAnchor *anchor);
+        // Reorder the elements of each bucket of the specified 'anchor' into
+        // split order, using a stable sort.  If the 'hasher' throws, the
+        // elements of 'anchor' are left correctly indexed, but not in split
+        // order.
+
     // PRIVATE ACCESSORS
     template <class DEDUCED_KEY>
     bslalg::BidirectionalLink *find(DEDUCED_KEY&       key,
@@ -2033,6 +2141,16 @@ class HashTable {
         // recomputing it, eliminating some redundant computation for the
         // public methods.
 
+    bslalg::BidirectionalLink *findSplitOrderPosition(
+                                           native_std::size_t hashCode) const;
+        // Return the address of the first element of the bucket for the
+        // specified 'hashCode' that follows, in split order, the elements
+        // having 'hashCode', or 0 if there is no such element or incremental
+        // rehashing is disabled.  Note that inserting an element having
+        // 'hashCode' immediately before the returned element, or at the back
+        // of its bucket if 0 is returned, preserves the split order of that
+        // bucket.
+
     bslalg::HashTableBucket *getBucketAddress(SizeType bucketIndex) const;
         // Return the address of the bucket at the specified 'bucketIndex' in
         // bucket array of this hash table.  The behavior is undefined unless
@@ -2371,6 +2489,14 @@ class HashTable {
         // only to ensure backward compatibility with existing clients; use the
         // 'emplaceWithHint' method instead.
 
+    void completeRehash();
+        // Split every bucket that remains to be split, if an incremental
+        // rehash is in progress (see {Incremental Rehash}), so that the next
+        // growth of the array of buckets takes constant time.  If the
+        // 'hasher' throws, this hash-table is left unchanged, except for the
+        // buckets already split, and the incremental rehash remains in
+        // progress.
+
     void rehashForNumBuckets(SizeType newNumBuckets);
         // Re-organize this hash-table to have at least the specified
         // 'newNumBuckets', preserving the invariant
@@ -2414,6 +2540,18 @@ class HashTable {
         // hash-table in a valid, but otherwise unspecified (and potentially
         // empty), state.
 
+    void setIncrementalRehashEnabled(bool value);
+        // Set whether growing the array of buckets of this hash-table when an
+        // insertion would exceed 'maxLoadFactor' spreads the re-indexing of
+        // the elements over the subsequent insertions (see
+        // {Incremental Rehash}) to the specified 'value'.  If 'value' is
+        // 'true' and incremental rehashing was disabled, re-index all the
+        // elements of this hash-table into split order, which, like a rehash,
+        // invalidates iterators (but not references or pointers to elements).
+        // If the 'hasher' throws, this hash-table is left in a valid, but
+        // otherwise unspecified (and potentially empty), state.  Incremental
+        // rehashing is disabled by default.
+
     void setMaxLoadFactor(float newMaxLoadFactor);
         // Set the maximum load factor permitted by this hash table to the
         // specified 'newMaxLoadFactor', where load factor is the statistical
@@ -2500,6 +2638,21 @@ class HashTable {
         // first such element (from the contiguous sequence of elements having
         // the same key).
 
+    template <class ITERATOR>
+    void findMany(ITERATOR      *results,
+                  const KeyType *keys,
+                  SizeType       numKeys) const;
+        // Load into each of the specified 'numKeys' elements of the specified
+        // 'results' array an object of the (template parameter) type
+        // 'ITERATOR' constructed from the value 'find' returns for the
+        // corresponding element of the specified 'keys' array.  The lookups
+        // are performed in batches whose memory accesses overlap: the keys of
+        // a batch are hashed and their buckets prefetched, then the first
+        // node of each bucket is prefetched, and only then are the keys
+        // compared.  The behavior is undefined unless 'results' and 'keys'
+        // each have at least 'numKeys' elements.  'ITERATOR' shall be
+        // explicitly constructible from 'bslalg::BidirectionalLink *'.
+
     bslalg::BidirectionalLink *findEndOfRange(
                                        bslalg::BidirectionalLink *first) const;
         // Return the address of the first node after any nodes holding a value
@@ -2574,6 +2727,17 @@ class HashTable {
         // Return a reference providing non-modifiable access to the hash
         // functor used by this hash-table.
 
+    bool isIncrementalRehashEnabled() const;
+        // Return 'true' if growing the array of buckets of this hash-table on
+        // insertion spreads the re-indexing of the elements over the
+        // subsequent insertions (see {Incremental Rehash}), and 'false'
+        // otherwise.
+
+    bool isRehashInProgress() const;
+        // Return 'true' if incremental rehashing is enabled and some buckets
+        // of this hash-table remain to be split before the array of buckets
+        // next grows (see {Incremental Rehash}), and 'false' otherwise.
+
     float loadFactor() const;
         // Return the current load factor for this table.  The load factor is
         // the statistical mean number of elements per bucket.
@@ -2785,6 +2949,19 @@ struct HashTable_ImpDetails {
         // should not change the expected values computed for regular allocator
         // usage of the component as validated by the test driver.
 
+    static bool isBeforeInSplitOrder(size_t lhsHashCode,
+                                     size_t rhsHashCode,
+                                     size_t numBuckets);
+        // Return 'true' if an element having the specified 'lhsHashCode'
+        // precedes, in the split order of a bucket of an array having the
+        // specified 'numBuckets', an element having the specified
+        // 'rhsHashCode', and 'false' otherwise.  An element precedes another
+        // in split order if the bit-reversed value of its hash code divided by
+        // 'numBuckets' is less than that of the other element, so that, when
+        // 'numBuckets' doubles, the elements of a bucket staying at the same
+        // index precede those moving to the upper half of the array.  The
+        // behavior is undefined unless '0 < numBuckets'.
+
     static size_t nextPrime(size_t n);
         // Return the next prime number greater-than or equal to the specified
         // 'n' in the increasing sequence of primes chosen to disperse hash
@@ -2820,6 +2997,15 @@ struct HashTable_Util {
         // way to assert in general that the value of a generic type passed to
         // a function is not a null pointer value.
 
+    template<class ALLOCATOR>
+    static bslalg::HashTableBucket *allocateBucketArray(
+                                  native_std::size_t  bucketArraySize,
+                                  const ALLOCATOR&    allocator);
+        // Return the address of an uninitialized array of the specified
+        // 'bucketArraySize' buckets, allocated by the specified 'allocator',
+        // to be destroyed by 'destroyBucketArray'.  The behavior is undefined
+        // unless '1 < bucketArraySize'.
+
     template<class ALLOCATOR>
     static void destroyBucketArray(bslalg::HashTableBucket *data,
                                    native_std::size_t       bucketArraySize,
@@ -3269,6 +3455,28 @@ void HashTable_ArrayProctor<FACTORY>::release()
     d_anchor_p = 0;
 }
 
+                    // --------------------------
+                    // class HashTable_ImpDetails
+                    // --------------------------
+
+inline
+bool HashTable_ImpDetails::isBeforeInSplitOrder(size_t lhsHashCode,
+                                                size_t rhsHashCode,
+                                                size_t numBuckets)
+{
+    BSLS_ASSERT_SAFE(0 < numBuckets);
+
+    const size_t lhs = lhsHashCode / numBuckets;
+    const size_t rhs = rhsHashCode / numBuckets;
+
+    // Comparing the bit-reversed values amounts to testing the lowest bit in
+    // which 'lhs' and 'rhs' differ.
+
+    const size_t diff = lhs ^ rhs;
+
+    return 0 != diff && 0 == (lhs & (diff & (~diff + 1)));
+}
+
                     // --------------------
                     // class HashTable_Util
                     // --------------------
@@ -3297,6 +3505,35 @@ void HashTable_Util::assertNotNullPointer(TYPE * & ptr)
     BSLS_ASSERT(ptr);
 }
 
+template <class ALLOCATOR>
+inline
+bslalg::HashTableBucket *HashTable_Util::allocateBucketArray(
+                                      native_std::size_t  bucketArraySize,
+                                      const ALLOCATOR&    allocator)
+{
+    BSLS_ASSERT_SAFE(1 < bucketArraySize);
+
+    typedef ::bsl::allocator_traits<ALLOCATOR>               ParamAllocTraits;
+    typedef typename ParamAllocTraits::template
+                      rebind_traits<bslalg::HashTableBucket> BucketAllocTraits;
+    typedef typename BucketAllocTraits::allocator_type       ArrayAllocator;
+    typedef ::bsl::allocator_traits<ArrayAllocator>       ArrayAllocatorTraits;
+    typedef typename ArrayAllocatorTraits::size_type         SizeType;
+
+    BSLS_ASSERT_SAFE(
+               bucketArraySize <= native_std::numeric_limits<SizeType>::max());
+
+    ArrayAllocator reboundAllocator(allocator);
+
+    if (ArrayAllocatorTraits::max_size(reboundAllocator) < bucketArraySize) {
+        bsls::BslExceptionUtil::throwBadAlloc();
+    }
+
+    return ArrayAllocatorTraits::allocate(
+                                      reboundAllocator,
+                                      static_cast<SizeType>(bucketArraySize));
+}
+
 template <class ALLOCATOR>
 inline
 void HashTable_Util::destroyBucketArray(
@@ -3556,6 +3793,9 @@ HashTable(const ALLOCATOR& basicAllocator)
 , d_size()
 , d_capacity()
 , d_maxLoadFactor(1.0)
+, d_incrementalRehash(false)
+, d_nextBuckets_p(0)
+, d_numSplitPoints(0)
 {
     BSLMF_ASSERT(!bsl::is_pointer<HASHER>::value &&
                  !bsl::is_pointer<COMPARATOR>::value);
@@ -3574,6 +3814,9 @@ HashTable(const HASHER&     hash,
 , d_size()
 , d_capacity(0)
 , d_maxLoadFactor(initialMaxLoadFactor)
+, d_incrementalRehash(false)
+, d_nextBuckets_p(0)
+, d_numSplitPoints(0)
 {
     BSLS_ASSERT_SAFE(0.0f < initialMaxLoadFactor);
 
@@ -3607,6 +3850,9 @@ HashTable(const HashTable& original)
 , d_size(original.d_size)
 , d_capacity(0)
 , d_maxLoadFactor(original.d_maxLoadFactor)
+, d_incrementalRehash(original.d_incrementalRehash)
+, d_nextBuckets_p(0)
+, d_numSplitPoints(0)
 {
     if (0 < d_size) {
         d_parameters.nodeFactory().reserveNodes(original.d_size);
@@ -3623,6 +3869,9 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::HashTable(
 , d_size()
 , d_capacity()
 , d_maxLoadFactor(1.0)
+, d_incrementalRehash(false)
+, d_nextBuckets_p(0)
+, d_numSplitPoints(0)
 {
     HashTable& lvalue = original;
     using std::swap;
@@ -3630,6 +3879,9 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::HashTable(
     swap(d_size,          lvalue.d_size);
     swap(d_capacity,      lvalue.d_capacity);
     swap(d_maxLoadFactor, lvalue.d_maxLoadFactor);
+    swap(d_incrementalRehash, lvalue.d_incrementalRehash);
+    swap(d_nextBuckets_p,     lvalue.d_nextBuckets_p);
+    swap(d_numSplitPoints,    lvalue.d_numSplitPoints);
 }
 
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
@@ -3641,6 +3893,9 @@ HashTable(const HashTable& original, const ALLOCATOR& basicAllocator)
 , d_size(original.d_size)
 , d_capacity(0)
 , d_maxLoadFactor(original.d_maxLoadFactor)
+, d_incrementalRehash(original.d_incrementalRehash)
+, d_nextBuckets_p(0)
+, d_numSplitPoints(0)
 {
     if (0 < d_size) {
         d_parameters.nodeFactory().reserveNodes(original.d_size);
@@ -3659,6 +3914,9 @@ HashTable(bslmf::MovableRef<HashTable> original,
 , d_size()
 , d_capacity()
 , d_maxLoadFactor(1.0)
+, d_incrementalRehash(false)
+, d_nextBuckets_p(0)
+, d_numSplitPoints(0)
 {
     HashTable& lvalue = original;
     if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
@@ -3670,15 +3928,20 @@ HashTable(bslmf::MovableRef<HashTable> original,
         swap(d_size,          lvalue.d_size);
         swap(d_capacity,      lvalue.d_capacity);
         swap(d_maxLoadFactor, lvalue.d_maxLoadFactor);
+        swap(d_incrementalRehash, lvalue.d_incrementalRehash);
+        swap(d_nextBuckets_p,     lvalue.d_nextBuckets_p);
+        swap(d_numSplitPoints,    lvalue.d_numSplitPoints);
     }
     else {
         d_size = lvalue.d_size;
         d_maxLoadFactor = lvalue.d_maxLoadFactor;
+        d_incrementalRehash = lvalue.d_incrementalRehash;
         if (0 < d_size) {
             // 'original' left in the default state
             bslalg::HashTableAnchor anchor(
                            HashTable_ImpDetails::defaultBucketAddress(), 1, 0);
             using std::swap;
+            lvalue.destroySplitPoints();
             swap(anchor, lvalue.d_anchor);
 
             lvalue.d_size = 0;
@@ -3722,6 +3985,94 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::~HashTable()
 }
 
 // PRIVATE MANIPULATORS
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::advanceRehash()
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                   !d_incrementalRehash || d_numSplitPoints == numBuckets())) {
+        return;                                                       // RETURN
+    }
+
+    // Split enough buckets, in order, that every bucket is split by the time
+    // the remaining insertions allowed by 'd_capacity' are made.  Note that
+    // removals only slow down the computation.
+
+    const SizeType numRemainingBuckets = this->numBuckets()
+                                       - d_numSplitPoints;
+    const SizeType numRemainingInsertions = d_size < d_capacity
+                                          ? d_capacity - d_size
+                                          : 1;
+
+    SizeType numToCompute = numRemainingBuckets / numRemainingInsertions;
+    if (numRemainingBuckets % numRemainingInsertions) {
+        ++numToCompute;
+    }
+
+    for (; 0 < numToCompute; --numToCompute) {
+        this->computeNextSplitPoint();
+    }
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::computeNextSplitPoint()
+{
+    BSLS_ASSERT_SAFE(d_incrementalRehash);
+    BSLS_ASSERT_SAFE(d_numSplitPoints < this->numBuckets());
+
+    const native_std::size_t numBuckets = d_anchor.bucketArraySize();
+
+    // The next array of buckets is not initialized, so that allocating it
+    // takes constant time: each of its buckets is set when the bucket of this
+    // table it is split from is split.
+
+    if (!d_nextBuckets_p) {
+        d_nextBuckets_p = HashTable_Util::allocateBucketArray(
+                                                           numBuckets * 2,
+                                                           this->allocator());
+    }
+
+    // The elements of a bucket moving to the upper half of the array of
+    // buckets follow, in split order, those staying in the lower half.
+
+    const bslalg::HashTableBucket& bucket =
+                             d_anchor.bucketArrayAddress()[d_numSplitPoints];
+
+    bslalg::BidirectionalLink *splitPoint = 0;
+    if (bucket.first()) {
+        bslalg::BidirectionalLink *const end = bucket.last()->nextLink();
+        for (bslalg::BidirectionalLink *cursor = bucket.first();
+             end != cursor;
+             cursor = cursor->nextLink()) {
+            if ((this->hashCodeForNode(cursor) / numBuckets) & 1) {
+                splitPoint = cursor;
+                break;
+            }
+        }
+    }
+
+    bslalg::HashTableBucket& lower = d_nextBuckets_p[d_numSplitPoints];
+    bslalg::HashTableBucket& upper =
+                                d_nextBuckets_p[d_numSplitPoints + numBuckets];
+
+    if (!splitPoint) {
+        lower.setFirstAndLast(bucket.first(), bucket.last());
+        upper.reset();
+    }
+    else {
+        if (splitPoint != bucket.first()) {
+            lower.setFirstAndLast(bucket.first(), splitPoint->previousLink());
+        }
+        else {
+            lower.reset();
+        }
+        upper.setFirstAndLast(splitPoint, bucket.last());
+    }
+
+    ++d_numSplitPoints;
+}
+
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 void
 HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::copyDataStructure(
@@ -3769,11 +4120,118 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::copyDataStructure(
     }
     while (0 != (cursor = cursor->nextLink()));
 
+    if (d_incrementalRehash) {
+        this->sortBucketsInSplitOrder(&d_anchor);
+    }
+
     // release the proctor
 
     arrayProctor.release();
 }
 
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::destroySplitPoints()
+{
+    if (d_nextBuckets_p) {
+        HashTable_Util::destroyBucketArray(d_nextBuckets_p,
+                                           d_anchor.bucketArraySize() * 2,
+                                           this->allocator());
+        d_nextBuckets_p = 0;
+    }
+    d_numSplitPoints = 0;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::growBucketArray()
+{
+    const native_std::size_t numBuckets    = d_anchor.bucketArraySize();
+    const native_std::size_t newNumBuckets = numBuckets * 2;
+    const double             newCapacity   =
+                     static_cast<double>(newNumBuckets) * d_maxLoadFactor;
+
+    if (!d_incrementalRehash
+     || 0 == d_size
+     || HashTable_ImpDetails::defaultBucketAddress() ==
+                                                d_anchor.bucketArrayAddress()
+     || newNumBuckets / 2 != numBuckets
+     || newCapacity < static_cast<double>(d_size) + 1.0) {
+        this->rehashForNumBuckets(this->numBuckets() * 2);
+        return;                                                       // RETURN
+    }
+
+    // Every bucket is normally split before the table must grow, unless the
+    // 'hasher' threw, or there were few insertions since incremental
+    // rehashing was enabled.
+
+    this->completeRehash();
+
+    // The next array of buckets indexes every element: it replaces the
+    // current one, and the buckets of the array following it remain to be
+    // split by subsequent insertions.  No element is relinked.
+
+    HashTable_Util::destroyBucketArray(d_anchor.bucketArrayAddress(),
+                                       numBuckets,
+                                       this->allocator());
+    d_anchor.setBucketArrayAddressAndSize(d_nextBuckets_p, newNumBuckets);
+    d_nextBuckets_p  = 0;
+    d_numSplitPoints = 0;
+
+    const double maxCapacity = static_cast<double>(
+                                  native_std::numeric_limits<SizeType>::max());
+    d_capacity = newCapacity < maxCapacity
+               ? static_cast<SizeType>(newCapacity)
+               : native_std::numeric_limits<SizeType>::max();
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertNode(
+                                          bslalg::BidirectionalLink *node,
+                                          native_std::size_t         hashCode,
+                                          bslalg::BidirectionalLink *position)
+{
+    BSLS_ASSERT_SAFE(node);
+
+    typedef bslalg::HashTableImpUtil ImpUtil;
+
+    if (position) {
+        ImpUtil::insertAtPosition(&d_anchor, node, hashCode, position);
+    }
+    else if (d_incrementalRehash) {
+        ImpUtil::insertAtBackOfBucket(&d_anchor, node, hashCode);
+    }
+    else {
+        ImpUtil::insertAtFrontOfBucket(&d_anchor, node, hashCode);
+    }
+
+    if (d_numSplitPoints) {
+        const native_std::size_t numBuckets = d_anchor.bucketArraySize();
+
+        if (ImpUtil::computeBucketIndex(hashCode, numBuckets)
+                                                          < d_numSplitPoints) {
+            // The bucket of 'node' is already split.  As its elements are in
+            // split order, each half of the bucket is contiguous, and 'node'
+            // is inserted either inside its half, or at one of its ends.
+
+            const native_std::size_t nextIndex =
+                         ImpUtil::computeBucketIndex(hashCode, numBuckets * 2);
+            bslalg::HashTableBucket& half      = d_nextBuckets_p[nextIndex];
+
+            if (!half.first()) {
+                half.setFirstAndLast(node, node);
+            }
+            else if (node->nextLink() == half.first()) {
+                half.setFirst(node);
+            }
+            else if (node->previousLink() == half.last()) {
+                half.setLast(node);
+            }
+        }
+    }
+}
+
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 void
 HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::moveDataStructure(
@@ -3821,6 +4279,10 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::moveDataStructure(
     }
     while (0 != (cursor = cursor->nextLink()));
 
+    if (d_incrementalRehash) {
+        this->sortBucketsInSplitOrder(&d_anchor);
+    }
+
     // release the proctor
 
     arrayProctor.release();
@@ -3841,6 +4303,9 @@ quickSwapExchangeAllocators(HashTable *other)
     swap(d_size,          other->d_size);
     swap(d_capacity,      other->d_capacity);
     swap(d_maxLoadFactor, other->d_maxLoadFactor);
+    swap(d_incrementalRehash, other->d_incrementalRehash);
+    swap(d_nextBuckets_p,     other->d_nextBuckets_p);
+    swap(d_numSplitPoints,    other->d_numSplitPoints);
 }
 
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
@@ -3858,6 +4323,9 @@ quickSwapRetainAllocators(HashTable *other)
     swap(d_size,          other->d_size);
     swap(d_capacity,      other->d_capacity);
     swap(d_maxLoadFactor, other->d_maxLoadFactor);
+    swap(d_incrementalRehash, other->d_incrementalRehash);
+    swap(d_nextBuckets_p,     other->d_nextBuckets_p);
+    swap(d_numSplitPoints,    other->d_numSplitPoints);
 }
 
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
@@ -3948,10 +4416,19 @@ rehashIntoExactlyNumBuckets(SizeType newNumBuckets, SizeType capacity)
                                           &newAnchor,
                                           this->d_anchor.listRootAddress(),
                                           this->d_parameters.hasher());
+
+        if (d_incrementalRehash) {
+            this->sortBucketsInSplitOrder(&newAnchor);
+        }
     }
 
     cleanUpIfUserHashThrows.dismiss();
 
+    // The split points of the previous array of buckets do not apply to the
+    // new one.
+
+    this->destroySplitPoints();
+
     d_anchor.swap(newAnchor);
     d_capacity = capacity;
 }
@@ -3962,6 +4439,7 @@ void
 HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::removeAllAndDeallocate()
 {
     this->removeAllImp();
+    this->destroySplitPoints();
     HashTable_Util::destroyBucketArray(d_anchor.bucketArrayAddress(),
                                        d_anchor.bucketArraySize(),
                                        this->allocator());
@@ -3988,6 +4466,62 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::removeAllImp()
     }
 }
 
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::sortBucketsInSplitOrder(
+                                             bslalg::HashTableAnchor *anchor)
+{
+    BSLS_ASSERT_SAFE(anchor);
+
+    typedef bslalg::HashTableImpUtil  ImpUtil;
+    typedef bslalg::BidirectionalLink BidirectionalLink;
+
+    const native_std::size_t numBuckets  = anchor->bucketArraySize();
+    bslalg::HashTableBucket *bucketArray = anchor->bucketArrayAddress();
+
+    for (native_std::size_t i = 0; i < numBuckets; ++i) {
+        bslalg::HashTableBucket& bucket = bucketArray[i];
+        if (bucket.first() == bucket.last()) {
+            continue;                                               // CONTINUE
+        }
+
+        // Insertion sort, comparing each element with the last element of
+        // the sorted prefix of the bucket first, so that sorting a bucket
+        // already in split order computes each hash code once.  Elements
+        // having the same hash code, and in particular equivalent keys, keep
+        // their relative order.
+
+        native_std::size_t lastHashCode = this->hashCodeForNode(
+                                                              bucket.first());
+
+        BidirectionalLink *const end    = bucket.last()->nextLink();
+        BidirectionalLink       *cursor = bucket.first()->nextLink();
+        while (end != cursor) {
+            BidirectionalLink        *next     = cursor->nextLink();
+            const native_std::size_t  hashCode = this->hashCodeForNode(cursor);
+
+            if (!HashTable_ImpDetails::isBeforeInSplitOrder(hashCode,
+                                                            lastHashCode,
+                                                            numBuckets)) {
+                lastHashCode = hashCode;
+            }
+            else {
+                BidirectionalLink *position = bucket.first();
+                while (!HashTable_ImpDetails::isBeforeInSplitOrder(
+                                              hashCode,
+                                              this->hashCodeForNode(position),
+                                              numBuckets)) {
+                    position = position->nextLink();
+                }
+
+                ImpUtil::remove(anchor, cursor, hashCode);
+                ImpUtil::insertAtPosition(anchor, cursor, hashCode, position);
+            }
+            cursor = next;
+        }
+    }
+}
+
 // PRIVATE ACCESSORS
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 template <class DEDUCED_KEY>
@@ -4004,6 +4538,38 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::find(
                                                      hashValue);
 }
 
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::findSplitOrderPosition(
+                                            native_std::size_t hashCode) const
+{
+    if (!d_incrementalRehash) {
+        return 0;                                                     // RETURN
+    }
+
+    const native_std::size_t       numBuckets = d_anchor.bucketArraySize();
+    const bslalg::HashTableBucket& bucket     =
+                d_anchor.bucketArrayAddress()[
+                   bslalg::HashTableImpUtil::computeBucketIndex(hashCode,
+                                                                numBuckets)];
+    if (!bucket.first()) {
+        return 0;                                                     // RETURN
+    }
+
+    bslalg::BidirectionalLink *const end = bucket.last()->nextLink();
+    for (bslalg::BidirectionalLink *cursor = bucket.first();
+         end != cursor;
+         cursor = cursor->nextLink()) {
+        if (HashTable_ImpDetails::isBeforeInSplitOrder(
+                                                hashCode,
+                                                this->hashCodeForNode(cursor),
+                                                numBuckets)) {
+            return cursor;                                            // RETURN
+        }
+    }
+    return 0;
+}
+
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 inline
 bslalg::HashTableBucket *
@@ -4086,7 +4652,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplace(
     // potentially improve the 'find' time.
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growBucketArray();
     }
 
     // Next we must create the node from the constructor arguments provided.
@@ -4110,12 +4676,12 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplace(
                                       ImpUtil::extractKey<KEY_CONFIG>(newNode),
                                       hashCode);
 
+    this->advanceRehash();
+
     if (!position) {
-        ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
-    }
-    else {
-        ImpUtil::insertAtPosition(&d_anchor, newNode, hashCode, position);
+        position = this->findSplitOrderPosition(hashCode);
     }
+    this->insertNode(newNode, hashCode, position);
     nodeProctor.release();
 
     ++d_size;
@@ -4136,7 +4702,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceWithHint(
     // potentially improve the potential 'find' time later.
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growBucketArray();
     }
 
     // Next we must create the node from the constructor arguments provided.
@@ -4161,12 +4727,12 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceWithHint(
         hint = this->find(ImpUtil::extractKey<KEY_CONFIG>(newNode), hashCode);
     }
 
+    this->advanceRehash();
+
     if (!hint) {
-        ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
-    }
-    else {
-        ImpUtil::insertAtPosition(&d_anchor, newNode, hashCode, hint);
+        hint = this->findSplitOrderPosition(hashCode);
     }
+    this->insertNode(newNode, hashCode, hint);
     nodeProctor.release();
 
     ++d_size;
@@ -4189,7 +4755,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
     // potentially improve the potential 'find' time later.
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growBucketArray();
     }
 
     // Next we must create the node from the constructor arguments provided.
@@ -4216,10 +4782,13 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
     if(!position) {
         if (d_size >= d_capacity) {
-            this->rehashForNumBuckets(numBuckets() * 2);
+            this->growBucketArray();
         }
+        this->advanceRehash();
 
-        ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
+        this->insertNode(newNode,
+                         hashCode,
+                         this->findSplitOrderPosition(hashCode));
         nodeProctor.release();
 
         ++d_size;
@@ -4239,8 +4808,12 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertIfMissing(
     bslalg::BidirectionalLink *position = this->find(key, hashCode);
     if (!position) {
         if (d_size >= d_capacity) {
-            this->rehashForNumBuckets(numBuckets() * 2);
+            this->growBucketArray();
         }
+        this->advanceRehash();
+
+        bslalg::BidirectionalLink *splitOrderPosition =
+                                      this->findSplitOrderPosition(hashCode);
 
         typedef typename ValueType::second_type MappedType;
 
@@ -4264,9 +4837,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertIfMissing(
                                                        defaultMapped.object());
 #endif
 
-        bslalg::HashTableImpUtil::insertAtFrontOfBucket(&d_anchor,
-                                                        position,
-                                                        hashCode);
+        this->insertNode(position, hashCode, splitOrderPosition);
         ++d_size;
     }
     return position;
@@ -4290,13 +4861,15 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertIfMissing(
 
     if(!position) {
         if (d_size >= d_capacity) {
-            this->rehashForNumBuckets(numBuckets() * 2);
+            this->growBucketArray();
         }
+        this->advanceRehash();
+
+        bslalg::BidirectionalLink *splitOrderPosition =
+                                      this->findSplitOrderPosition(hashCode);
 
         position = d_parameters.nodeFactory().emplaceIntoNewNode(value);
-        bslalg::HashTableImpUtil::insertAtFrontOfBucket(&d_anchor,
-                                                        position,
-                                                        hashCode);
+        this->insertNode(position, hashCode, splitOrderPosition);
         ++d_size;
     }
 
@@ -4323,14 +4896,16 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertIfMissing(
 
     if(!position) {
         if (d_size >= d_capacity) {
-            this->rehashForNumBuckets(numBuckets() * 2);
+            this->growBucketArray();
         }
+        this->advanceRehash();
+
+        bslalg::BidirectionalLink *splitOrderPosition =
+                                      this->findSplitOrderPosition(hashCode);
 
         position = d_parameters.nodeFactory().emplaceIntoNewNode(
                                                        MoveUtil::move(lvalue));
-        bslalg::HashTableImpUtil::insertAtFrontOfBucket(&d_anchor,
-                                                        position,
-                                                        hashCode);
+        this->insertNode(position, hashCode, splitOrderPosition);
         ++d_size;
     }
 
@@ -4374,6 +4949,19 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insert(
                            BSLS_COMPILERFEATURES_FORWARD(SOURCE_TYPE, value));
 }
 
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::completeRehash()
+{
+    if (!this->isRehashInProgress()) {
+        return;                                                       // RETURN
+    }
+
+    while (d_numSplitPoints < this->numBuckets()) {
+        this->computeNextSplitPoint();
+    }
+}
+
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 void
 HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::rehashForNumBuckets(
@@ -4405,11 +4993,39 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::remove(
     BSLS_ASSERT_SAFE(node->previousLink()
                   || d_anchor.listRootAddress() == node);
 
+    typedef bslalg::HashTableImpUtil ImpUtil;
+
     bslalg::BidirectionalLink *result = node->nextLink();
 
-    bslalg::HashTableImpUtil::remove(&d_anchor,
-                                     node,
-                                     hashCodeForNode(node));
+    const native_std::size_t hashCode = hashCodeForNode(node);
+
+    if (d_numSplitPoints) {
+        const native_std::size_t numBuckets = d_anchor.bucketArraySize();
+
+        if (ImpUtil::computeBucketIndex(hashCode, numBuckets)
+                                                          < d_numSplitPoints) {
+            // The bucket of 'node' is already split: remove 'node' from its
+            // half, which is contiguous.
+
+            const native_std::size_t nextIndex =
+                         ImpUtil::computeBucketIndex(hashCode, numBuckets * 2);
+            bslalg::HashTableBucket& half      = d_nextBuckets_p[nextIndex];
+
+            if (node == half.first()) {
+                if (node == half.last()) {
+                    half.reset();
+                }
+                else {
+                    half.setFirst(node->nextLink());
+                }
+            }
+            else if (node == half.last()) {
+                half.setLast(node->previousLink());
+            }
+        }
+    }
+
+    ImpUtil::remove(&d_anchor, node, hashCode);
     --d_size;
 
     d_parameters.nodeFactory().deleteNode(static_cast<NodeType *>(node));
@@ -4427,6 +5043,8 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::removeAll()
                  0,
                  sizeof(bslalg::HashTableBucket) * d_anchor.bucketArraySize());
 
+    this->destroySplitPoints();
+
     d_anchor.setListRootAddress(0);
     d_size = 0;
 }
@@ -4458,6 +5076,27 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::reserveForNumElements(
     }
 }
 
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::
+setIncrementalRehashEnabled(bool value)
+{
+    if (value == d_incrementalRehash) {
+        return;                                                       // RETURN
+    }
+
+    d_incrementalRehash = value;
+
+    if (!value) {
+        this->destroySplitPoints();
+    }
+    else if (0 < d_size) {
+        // Re-index the elements into split order.
+
+        this->rehashIntoExactlyNumBuckets(this->numBuckets(), d_capacity);
+    }
+}
+
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 inline
 void HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::setMaxLoadFactor(
@@ -4582,6 +5221,50 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::find(
                                              d_parameters.hashCodeForKey(key));
 }
 
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class ITERATOR>
+void HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::findMany(
+                                                ITERATOR      *results,
+                                                const KeyType *keys,
+                                                SizeType       numKeys) const
+{
+    enum { k_BATCH_SIZE = 16 };  // number of lookups whose memory accesses
+                                 // are overlapped
+
+    native_std::size_t             hashCodes[k_BATCH_SIZE];
+    const bslalg::HashTableBucket *buckets[k_BATCH_SIZE];
+
+    while (numKeys) {
+        const SizeType numBatch = numKeys < k_BATCH_SIZE
+                                ? numKeys
+                                : static_cast<SizeType>(k_BATCH_SIZE);
+
+        for (SizeType i = 0; i < numBatch; ++i) {
+            hashCodes[i] = d_parameters.hashCodeForKey(keys[i]);
+            buckets[i]   = d_anchor.bucketArrayAddress()
+                         + bslalg::HashTableImpUtil::computeBucketIndex(
+                                             hashCodes[i],
+                                             d_anchor.bucketArraySize());
+
+            bsls::PerformanceHint::prefetchForReading(buckets[i]);
+        }
+
+        for (SizeType i = 0; i < numBatch; ++i) {
+            if (buckets[i]->first()) {
+                bsls::PerformanceHint::prefetchForReading(buckets[i]->first());
+            }
+        }
+
+        for (SizeType i = 0; i < numBatch; ++i) {
+            results[i] = ITERATOR(find(keys[i], hashCodes[i]));
+        }
+
+        results += numBatch;
+        keys    += numBatch;
+        numKeys -= numBatch;
+    }
+}
+
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 bslalg::BidirectionalLink *
 HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::findEndOfRange(
@@ -4782,6 +5465,26 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::hasher() const
     return d_parameters.originalHasher();
 }
 
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+bool
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::
+isIncrementalRehashEnabled() const
+{
+    return d_incrementalRehash;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+bool
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::
+isRehashInProgress() const
+{
+    return d_incrementalRehash
+        && 0 < d_size
+        && d_numSplitPoints < this->numBuckets();
+}
+
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 inline
 float HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::loadFactor() const
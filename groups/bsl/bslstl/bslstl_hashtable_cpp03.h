@@ -423,9 +423,32 @@ class HashTable {
                                          // rehash is required (computed from
                                          // 'd_maxLoadFactor')
     float               d_maxLoadFactor; // maximum permitted load factor
+    bool                d_incrementalRehash;
+                                         // 'true' if the elements of each
+                                         // bucket are kept in split order, and
+                                         // growing the bucket array on
+                                         // insertion only splits each bucket
+    bslalg::HashTableBucket
+                       *d_nextBuckets_p; // array of twice as many buckets as
+                                         // 'd_anchor', holding at indices 'i'
+                                         // and 'i + numBuckets()' the two
+                                         // halves of the bucket at index 'i'
+                                         // of 'd_anchor' for each
+                                         // 'i < d_numSplitPoints' (the other
+                                         // buckets being uninitialized), or 0
+    SizeType            d_numSplitPoints;// number of leading buckets split
+                                         // into 'd_nextBuckets_p'
 
   private:
     // PRIVATE MANIPULATORS
+    void advanceRehash();
+        // If incremental rehashing is enabled, split enough buckets, in
+        // order, into the next array of buckets that every bucket is split by
+        // the time the number of elements in this table reaches
+        // 'rehashThreshold'.  This method must be called before each
+        // insertion.  If the 'hasher' throws, this table is left unchanged,
+        // except for the buckets already split.
+
     void copyDataStructure(bslalg::BidirectionalLink *cursor);
         // Copy the sequence of elements from the list starting at the
         // specified 'cursor' and having 'size' elements.  Allocate a bucket
@@ -437,6 +460,44 @@ class HashTable {
         // for the 'size' and other attributes that may not be consistent with
         // the class invariants until after this method is called.
 
+    void computeNextSplitPoint();
+        // Compute the split point of the bucket at index 'd_numSplitPoints',
+        // allocating the next array of buckets if needed, record the two
+        // halves of the bucket in the next array of buckets, and increment
+        // 'd_numSplitPoints'.  If the 'hasher' throws, this table is left
+        // unchanged, except for the allocation of the next array of buckets.
+        // The behavior is undefined unless incremental rehashing is enabled
+        // and 'd_numSplitPoints < numBuckets()'.
+
+    void destroySplitPoints();
+        // Deallocate the next array of buckets, if any, so that no bucket is
+        // split.
+
+    void growBucketArray();
+        // Increase the number of buckets of this table so that it can hold at
+        // least one more element without exceeding 'maxLoadFactor'.  If
+        // incremental rehashing is enabled and this table is not empty, split
+        // any remaining bucket, and exactly double the number of buckets by
+        // replacing the array of buckets with the next one, in constant time
+        // if every bucket was already split; otherwise, rehash all the
+        // elements into the new array.  If this function tries
+        // to allocate a number of buckets larger than can be represented by
+        // this hash-table's 'SizeType', a 'std::length_error' exception is
+        // thrown.
+
+    void insertNode(bslalg::BidirectionalLink *node,
+                    native_std::size_t         hashCode,
+                    bslalg::BidirectionalLink *position);
+        // Insert the specified 'node', having the specified 'hashCode', into
+        // this table immediately before the specified 'position', or, if
+        // 'position' is 0, at the back of its bucket if incremental rehashing
+        // is enabled, and at the front of its bucket otherwise, and update
+        // the split point of that bucket, if known.  This method does not
+        // increment 'd_size'.  The behavior is undefined unless 'position' is
+        // 0 or is an element of the bucket of 'node', and, if incremental
+        // rehashing is enabled, inserting 'node' there preserves the split
+        // order of that bucket (see 'findSplitOrderPosition').
+
     void moveDataStructure(bslalg::BidirectionalLink *cursor);
         // Recreate the sequence of elements from the list starting at the
         // specified 'cursor' and having (member) 'd_size' elements, ensuring
@@ -497,6 +558,12 @@ class HashTable {
         // with a new value, or when the hash table is going out of scope and
         // the extra bookkeeping is not necessary.
 
+    void sortBucketsInSplitOrder(bslalg::HashTableAnchor *anchor);
+        // Reorder the elements of each bucket of the specified 'anchor' into
+        // split order, using a stable sort.  If the 'hasher' throws, the
+        // elements of 'anchor' are left correctly indexed, but not in split
+        // order.
+
     // PRIVATE ACCESSORS
     template <class DEDUCED_KEY>
     bslalg::BidirectionalLink *find(DEDUCED_KEY&       key,
@@ -510,6 +577,16 @@ class HashTable {
         // recomputing it, eliminating some redundant computation for the
         // public methods.
 
+    bslalg::BidirectionalLink *findSplitOrderPosition(
+                                           native_std::size_t hashCode) const;
+        // Return the address of the first element of the bucket for the
+        // specified 'hashCode' that follows, in split order, the elements
+        // having 'hashCode', or 0 if there is no such element or incremental
+        // rehashing is disabled.  Note that inserting an element having
+        // 'hashCode' immediately before the returned element, or at the back
+        // of its bucket if 0 is returned, preserves the split order of that
+        // bucket.
+
     bslalg::HashTableBucket *getBucketAddress(SizeType bucketIndex) const;
         // Return the address of the bucket at the specified 'bucketIndex' in
         // bucket array of this hash table.  The behavior is undefined unless
@@ -1284,6 +1361,14 @@ class HashTable {
         // only to ensure backward compatibility with existing clients; use the
         // 'emplaceWithHint' method instead.
 
+    void completeRehash();
+        // Split every bucket that remains to be split, if an incremental
+        // rehash is in progress (see {Incremental Rehash}), so that the next
+        // growth of the array of buckets takes constant time.  If the
+        // 'hasher' throws, this hash-table is left unchanged, except for the
+        // buckets already split, and the incremental rehash remains in
+        // progress.
+
     void rehashForNumBuckets(SizeType newNumBuckets);
         // Re-organize this hash-table to have at least the specified
         // 'newNumBuckets', preserving the invariant
@@ -1327,6 +1412,18 @@ class HashTable {
         // hash-table in a valid, but otherwise unspecified (and potentially
         // empty), state.
 
+    void setIncrementalRehashEnabled(bool value);
+        // Set whether growing the array of buckets of this hash-table when an
+        // insertion would exceed 'maxLoadFactor' spreads the re-indexing of
+        // the elements over the subsequent insertions (see
+        // {Incremental Rehash}) to the specified 'value'.  If 'value' is
+        // 'true' and incremental rehashing was disabled, re-index all the
+        // elements of this hash-table into split order, which, like a rehash,
+        // invalidates iterators (but not references or pointers to elements).
+        // If the 'hasher' throws, this hash-table is left in a valid, but
+        // otherwise unspecified (and potentially empty), state.  Incremental
+        // rehashing is disabled by default.
+
     void setMaxLoadFactor(float newMaxLoadFactor);
         // Set the maximum load factor permitted by this hash table to the
         // specified 'newMaxLoadFactor', where load factor is the statistical
@@ -1413,6 +1510,21 @@ class HashTable {
         // first such element (from the contiguous sequence of elements having
         // the same key).
 
+    template <class ITERATOR>
+    void findMany(ITERATOR      *results,
+                  const KeyType *keys,
+                  SizeType       numKeys) const;
+        // Load into each of the specified 'numKeys' elements of the specified
+        // 'results' array an object of the (template parameter) type
+        // 'ITERATOR' constructed from the value 'find' returns for the
+        // corresponding element of the specified 'keys' array.  The lookups
+        // are performed in batches whose memory accesses overlap: the keys of
+        // a batch are hashed and their buckets prefetched, then the first
+        // node of each bucket is prefetched, and only then are the keys
+        // compared.  The behavior is undefined unless 'results' and 'keys'
+        // each have at least 'numKeys' elements.  'ITERATOR' shall be
+        // explicitly constructible from 'bslalg::BidirectionalLink *'.
+
     bslalg::BidirectionalLink *findEndOfRange(
                                        bslalg::BidirectionalLink *first) const;
         // Return the address of the first node after any nodes holding a value
@@ -1487,6 +1599,17 @@ class HashTable {
         // Return a reference providing non-modifiable access to the hash
         // functor used by this hash-table.
 
+    bool isIncrementalRehashEnabled() const;
+        // Return 'true' if growing the array of buckets of this hash-table on
+        // insertion spreads the re-indexing of the elements over the
+        // subsequent insertions (see {Incremental Rehash}), and 'false'
+        // otherwise.
+
+    bool isRehashInProgress() const;
+        // Return 'true' if incremental rehashing is enabled and some buckets
+        // of this hash-table remain to be split before the array of buckets
+        // next grows (see {Incremental Rehash}), and 'false' otherwise.
+
     float loadFactor() const;
         // Return the current load factor for this table.  The load factor is
         // the statistical mean number of elements per bucket.
@@ -1698,6 +1821,19 @@ struct HashTable_ImpDetails {
         // should not change the expected values computed for regular allocator
         // usage of the component as validated by the test driver.
 
+    static bool isBeforeInSplitOrder(size_t lhsHashCode,
+                                     size_t rhsHashCode,
+                                     size_t numBuckets);
+        // Return 'true' if an element having the specified 'lhsHashCode'
+        // precedes, in the split order of a bucket of an array having the
+        // specified 'numBuckets', an element having the specified
+        // 'rhsHashCode', and 'false' otherwise.  An element precedes another
+        // in split order if the bit-reversed value of its hash code divided by
+        // 'numBuckets' is less than that of the other element, so that, when
+        // 'numBuckets' doubles, the elements of a bucket staying at the same
+        // index precede those moving to the upper half of the array.  The
+        // behavior is undefined unless '0 < numBuckets'.
+
     static size_t nextPrime(size_t n);
         // Return the next prime number greater-than or equal to the specified
         // 'n' in the increasing sequence of primes chosen to disperse hash
@@ -1733,6 +1869,15 @@ struct HashTable_Util {
         // way to assert in general that the value of a generic type passed to
         // a function is not a null pointer value.
 
+    template<class ALLOCATOR>
+    static bslalg::HashTableBucket *allocateBucketArray(
+                                  native_std::size_t  bucketArraySize,
+                                  const ALLOCATOR&    allocator);
+        // Return the address of an uninitialized array of the specified
+        // 'bucketArraySize' buckets, allocated by the specified 'allocator',
+        // to be destroyed by 'destroyBucketArray'.  The behavior is undefined
+        // unless '1 < bucketArraySize'.
+
     template<class ALLOCATOR>
     static void destroyBucketArray(bslalg::HashTableBucket *data,
                                    native_std::size_t       bucketArraySize,
@@ -2182,6 +2327,28 @@ void HashTable_ArrayProctor<FACTORY>::release()
     d_anchor_p = 0;
 }
 
+                    // --------------------------
+                    // class HashTable_ImpDetails
+                    // --------------------------
+
+inline
+bool HashTable_ImpDetails::isBeforeInSplitOrder(size_t lhsHashCode,
+                                                size_t rhsHashCode,
+                                                size_t numBuckets)
+{
+    BSLS_ASSERT_SAFE(0 < numBuckets);
+
+    const size_t lhs = lhsHashCode / numBuckets;
+    const size_t rhs = rhsHashCode / numBuckets;
+
+    // Comparing the bit-reversed values amounts to testing the lowest bit in
+    // which 'lhs' and 'rhs' differ.
+
+    const size_t diff = lhs ^ rhs;
+
+    return 0 != diff && 0 == (lhs & (diff & (~diff + 1)));
+}
+
                     // --------------------
                     // class HashTable_Util
                     // --------------------
@@ -2210,6 +2377,35 @@ void HashTable_Util::assertNotNullPointer(TYPE * & ptr)
     BSLS_ASSERT(ptr);
 }
 
+template <class ALLOCATOR>
+inline
+bslalg::HashTableBucket *HashTable_Util::allocateBucketArray(
+                                      native_std::size_t  bucketArraySize,
+                                      const ALLOCATOR&    allocator)
+{
+    BSLS_ASSERT_SAFE(1 < bucketArraySize);
+
+    typedef ::bsl::allocator_traits<ALLOCATOR>               ParamAllocTraits;
+    typedef typename ParamAllocTraits::template
+                      rebind_traits<bslalg::HashTableBucket> BucketAllocTraits;
+    typedef typename BucketAllocTraits::allocator_type       ArrayAllocator;
+    typedef ::bsl::allocator_traits<ArrayAllocator>       ArrayAllocatorTraits;
+    typedef typename ArrayAllocatorTraits::size_type         SizeType;
+
+    BSLS_ASSERT_SAFE(
+               bucketArraySize <= native_std::numeric_limits<SizeType>::max());
+
+    ArrayAllocator reboundAllocator(allocator);
+
+    if (ArrayAllocatorTraits::max_size(reboundAllocator) < bucketArraySize) {
+        bsls::BslExceptionUtil::throwBadAlloc();
+    }
+
+    return ArrayAllocatorTraits::allocate(
+                                      reboundAllocator,
+                                      static_cast<SizeType>(bucketArraySize));
+}
+
 template <class ALLOCATOR>
 inline
 void HashTable_Util::destroyBucketArray(
@@ -2469,6 +2665,9 @@ HashTable(const ALLOCATOR& basicAllocator)
 , d_size()
 , d_capacity()
 , d_maxLoadFactor(1.0)
+, d_incrementalRehash(false)
+, d_nextBuckets_p(0)
+, d_numSplitPoints(0)
 {
     BSLMF_ASSERT(!bsl::is_pointer<HASHER>::value &&
                  !bsl::is_pointer<COMPARATOR>::value);
@@ -2487,6 +2686,9 @@ HashTable(const HASHER&     hash,
 , d_size()
 , d_capacity(0)
 , d_maxLoadFactor(initialMaxLoadFactor)
+, d_incrementalRehash(false)
+, d_nextBuckets_p(0)
+, d_numSplitPoints(0)
 {
     BSLS_ASSERT_SAFE(0.0f < initialMaxLoadFactor);
 
@@ -2520,6 +2722,9 @@ HashTable(const HashTable& original)
 , d_size(original.d_size)
 , d_capacity(0)
 , d_maxLoadFactor(original.d_maxLoadFactor)
+, d_incrementalRehash(original.d_incrementalRehash)
+, d_nextBuckets_p(0)
+, d_numSplitPoints(0)
 {
     if (0 < d_size) {
         d_parameters.nodeFactory().reserveNodes(original.d_size);
@@ -2536,6 +2741,9 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::HashTable(
 , d_size()
 , d_capacity()
 , d_maxLoadFactor(1.0)
+, d_incrementalRehash(false)
+, d_nextBuckets_p(0)
+, d_numSplitPoints(0)
 {
     HashTable& lvalue = original;
     using std::swap;
@@ -2543,6 +2751,9 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::HashTable(
     swap(d_size,          lvalue.d_size);
     swap(d_capacity,      lvalue.d_capacity);
     swap(d_maxLoadFactor, lvalue.d_maxLoadFactor);
+    swap(d_incrementalRehash, lvalue.d_incrementalRehash);
+    swap(d_nextBuckets_p,     lvalue.d_nextBuckets_p);
+    swap(d_numSplitPoints,    lvalue.d_numSplitPoints);
 }
 
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
@@ -2554,6 +2765,9 @@ HashTable(const HashTable& original, const ALLOCATOR& basicAllocator)
 , d_size(original.d_size)
 , d_capacity(0)
 , d_maxLoadFactor(original.d_maxLoadFactor)
+, d_incrementalRehash(original.d_incrementalRehash)
+, d_nextBuckets_p(0)
+, d_numSplitPoints(0)
 {
     if (0 < d_size) {
         d_parameters.nodeFactory().reserveNodes(original.d_size);
@@ -2572,6 +2786,9 @@ HashTable(bslmf::MovableRef<HashTable> original,
 , d_size()
 , d_capacity()
 , d_maxLoadFactor(1.0)
+, d_incrementalRehash(false)
+, d_nextBuckets_p(0)
+, d_numSplitPoints(0)
 {
     HashTable& lvalue = original;
     if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
@@ -2583,15 +2800,20 @@ HashTable(bslmf::MovableRef<HashTable> original,
         swap(d_size,          lvalue.d_size);
         swap(d_capacity,      lvalue.d_capacity);
         swap(d_maxLoadFactor, lvalue.d_maxLoadFactor);
+        swap(d_incrementalRehash, lvalue.d_incrementalRehash);
+        swap(d_nextBuckets_p,     lvalue.d_nextBuckets_p);
+        swap(d_numSplitPoints,    lvalue.d_numSplitPoints);
     }
     else {
         d_size = lvalue.d_size;
         d_maxLoadFactor = lvalue.d_maxLoadFactor;
+        d_incrementalRehash = lvalue.d_incrementalRehash;
         if (0 < d_size) {
             // 'original' left in the default state
             bslalg::HashTableAnchor anchor(
                            HashTable_ImpDetails::defaultBucketAddress(), 1, 0);
             using std::swap;
+            lvalue.destroySplitPoints();
             swap(anchor, lvalue.d_anchor);
 
             lvalue.d_size = 0;
@@ -2635,6 +2857,94 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::~HashTable()
 }
 
 // PRIVATE MANIPULATORS
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::advanceRehash()
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                   !d_incrementalRehash || d_numSplitPoints == numBuckets())) {
+        return;                                                       // RETURN
+    }
+
+    // Split enough buckets, in order, that every bucket is split by the time
+    // the remaining insertions allowed by 'd_capacity' are made.  Note that
+    // removals only slow down the computation.
+
+    const SizeType numRemainingBuckets = this->numBuckets()
+                                       - d_numSplitPoints;
+    const SizeType numRemainingInsertions = d_size < d_capacity
+                                          ? d_capacity - d_size
+                                          : 1;
+
+    SizeType numToCompute = numRemainingBuckets / numRemainingInsertions;
+    if (numRemainingBuckets % numRemainingInsertions) {
+        ++numToCompute;
+    }
+
+    for (; 0 < numToCompute; --numToCompute) {
+        this->computeNextSplitPoint();
+    }
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::computeNextSplitPoint()
+{
+    BSLS_ASSERT_SAFE(d_incrementalRehash);
+    BSLS_ASSERT_SAFE(d_numSplitPoints < this->numBuckets());
+
+    const native_std::size_t numBuckets = d_anchor.bucketArraySize();
+
+    // The next array of buckets is not initialized, so that allocating it
+    // takes constant time: each of its buckets is set when the bucket of this
+    // table it is split from is split.
+
+    if (!d_nextBuckets_p) {
+        d_nextBuckets_p = HashTable_Util::allocateBucketArray(
+                                                           numBuckets * 2,
+                                                           this->allocator());
+    }
+
+    // The elements of a bucket moving to the upper half of the array of
+    // buckets follow, in split order, those staying in the lower half.
+
+    const bslalg::HashTableBucket& bucket =
+                             d_anchor.bucketArrayAddress()[d_numSplitPoints];
+
+    bslalg::BidirectionalLink *splitPoint = 0;
+    if (bucket.first()) {
+        bslalg::BidirectionalLink *const end = bucket.last()->nextLink();
+        for (bslalg::BidirectionalLink *cursor = bucket.first();
+             end != cursor;
+             cursor = cursor->nextLink()) {
+            if ((this->hashCodeForNode(cursor) / numBuckets) & 1) {
+                splitPoint = cursor;
+                break;
+            }
+        }
+    }
+
+    bslalg::HashTableBucket& lower = d_nextBuckets_p[d_numSplitPoints];
+    bslalg::HashTableBucket& upper =
+                                d_nextBuckets_p[d_numSplitPoints + numBuckets];
+
+    if (!splitPoint) {
+        lower.setFirstAndLast(bucket.first(), bucket.last());
+        upper.reset();
+    }
+    else {
+        if (splitPoint != bucket.first()) {
+            lower.setFirstAndLast(bucket.first(), splitPoint->previousLink());
+        }
+        else {
+            lower.reset();
+        }
+        upper.setFirstAndLast(splitPoint, bucket.last());
+    }
+
+    ++d_numSplitPoints;
+}
+
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 void
 HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::copyDataStructure(
@@ -2682,11 +2992,118 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::copyDataStructure(
     }
     while (0 != (cursor = cursor->nextLink()));
 
+    if (d_incrementalRehash) {
+        this->sortBucketsInSplitOrder(&d_anchor);
+    }
+
     // release the proctor
 
     arrayProctor.release();
 }
 
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::destroySplitPoints()
+{
+    if (d_nextBuckets_p) {
+        HashTable_Util::destroyBucketArray(d_nextBuckets_p,
+                                           d_anchor.bucketArraySize() * 2,
+                                           this->allocator());
+        d_nextBuckets_p = 0;
+    }
+    d_numSplitPoints = 0;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::growBucketArray()
+{
+    const native_std::size_t numBuckets    = d_anchor.bucketArraySize();
+    const native_std::size_t newNumBuckets = numBuckets * 2;
+    const double             newCapacity   =
+                     static_cast<double>(newNumBuckets) * d_maxLoadFactor;
+
+    if (!d_incrementalRehash
+     || 0 == d_size
+     || HashTable_ImpDetails::defaultBucketAddress() ==
+                                                d_anchor.bucketArrayAddress()
+     || newNumBuckets / 2 != numBuckets
+     || newCapacity < static_cast<double>(d_size) + 1.0) {
+        this->rehashForNumBuckets(this->numBuckets() * 2);
+        return;                                                       // RETURN
+    }
+
+    // Every bucket is normally split before the table must grow, unless the
+    // 'hasher' threw, or there were few insertions since incremental
+    // rehashing was enabled.
+
+    this->completeRehash();
+
+    // The next array of buckets indexes every element: it replaces the
+    // current one, and the buckets of the array following it remain to be
+    // split by subsequent insertions.  No element is relinked.
+
+    HashTable_Util::destroyBucketArray(d_anchor.bucketArrayAddress(),
+                                       numBuckets,
+                                       this->allocator());
+    d_anchor.setBucketArrayAddressAndSize(d_nextBuckets_p, newNumBuckets);
+    d_nextBuckets_p  = 0;
+    d_numSplitPoints = 0;
+
+    const double maxCapacity = static_cast<double>(
+                                  native_std::numeric_limits<SizeType>::max());
+    d_capacity = newCapacity < maxCapacity
+               ? static_cast<SizeType>(newCapacity)
+               : native_std::numeric_limits<SizeType>::max();
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertNode(
+                                          bslalg::BidirectionalLink *node,
+                                          native_std::size_t         hashCode,
+                                          bslalg::BidirectionalLink *position)
+{
+    BSLS_ASSERT_SAFE(node);
+
+    typedef bslalg::HashTableImpUtil ImpUtil;
+
+    if (position) {
+        ImpUtil::insertAtPosition(&d_anchor, node, hashCode, position);
+    }
+    else if (d_incrementalRehash) {
+        ImpUtil::insertAtBackOfBucket(&d_anchor, node, hashCode);
+    }
+    else {
+        ImpUtil::insertAtFrontOfBucket(&d_anchor, node, hashCode);
+    }
+
+    if (d_numSplitPoints) {
+        const native_std::size_t numBuckets = d_anchor.bucketArraySize();
+
+        if (ImpUtil::computeBucketIndex(hashCode, numBuckets)
+                                                          < d_numSplitPoints) {
+            // The bucket of 'node' is already split.  As its elements are in
+            // split order, each half of the bucket is contiguous, and 'node'
+            // is inserted either inside its half, or at one of its ends.
+
+            const native_std::size_t nextIndex =
+                         ImpUtil::computeBucketIndex(hashCode, numBuckets * 2);
+            bslalg::HashTableBucket& half      = d_nextBuckets_p[nextIndex];
+
+            if (!half.first()) {
+                half.setFirstAndLast(node, node);
+            }
+            else if (node->nextLink() == half.first()) {
+                half.setFirst(node);
+            }
+            else if (node->previousLink() == half.last()) {
+                half.setLast(node);
+            }
+        }
+    }
+}
+
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 void
 HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::moveDataStructure(
@@ -2734,6 +3151,10 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::moveDataStructure(
     }
     while (0 != (cursor = cursor->nextLink()));
 
+    if (d_incrementalRehash) {
+        this->sortBucketsInSplitOrder(&d_anchor);
+    }
+
     // release the proctor
 
     arrayProctor.release();
@@ -2754,6 +3175,9 @@ quickSwapExchangeAllocators(HashTable *other)
     swap(d_size,          other->d_size);
     swap(d_capacity,      other->d_capacity);
     swap(d_maxLoadFactor, other->d_maxLoadFactor);
+    swap(d_incrementalRehash, other->d_incrementalRehash);
+    swap(d_nextBuckets_p,     other->d_nextBuckets_p);
+    swap(d_numSplitPoints,    other->d_numSplitPoints);
 }
 
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
@@ -2771,6 +3195,9 @@ quickSwapRetainAllocators(HashTable *other)
     swap(d_size,          other->d_size);
     swap(d_capacity,      other->d_capacity);
     swap(d_maxLoadFactor, other->d_maxLoadFactor);
+    swap(d_incrementalRehash, other->d_incrementalRehash);
+    swap(d_nextBuckets_p,     other->d_nextBuckets_p);
+    swap(d_numSplitPoints,    other->d_numSplitPoints);
 }
 
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
@@ -2861,10 +3288,19 @@ rehashIntoExactlyNumBuckets(SizeType newNumBuckets, SizeType capacity)
                                           &newAnchor,
                                           this->d_anchor.listRootAddress(),
                                           this->d_parameters.hasher());
+
+        if (d_incrementalRehash) {
+            this->sortBucketsInSplitOrder(&newAnchor);
+        }
     }
 
     cleanUpIfUserHashThrows.dismiss();
 
+    // The split points of the previous array of buckets do not apply to the
+    // new one.
+
+    this->destroySplitPoints();
+
     d_anchor.swap(newAnchor);
     d_capacity = capacity;
 }
@@ -2875,6 +3311,7 @@ void
 HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::removeAllAndDeallocate()
 {
     this->removeAllImp();
+    this->destroySplitPoints();
     HashTable_Util::destroyBucketArray(d_anchor.bucketArrayAddress(),
                                        d_anchor.bucketArraySize(),
                                        this->allocator());
@@ -2901,6 +3338,62 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::removeAllImp()
     }
 }
 
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::sortBucketsInSplitOrder(
+                                             bslalg::HashTableAnchor *anchor)
+{
+    BSLS_ASSERT_SAFE(anchor);
+
+    typedef bslalg::HashTableImpUtil  ImpUtil;
+    typedef bslalg::BidirectionalLink BidirectionalLink;
+
+    const native_std::size_t numBuckets  = anchor->bucketArraySize();
+    bslalg::HashTableBucket *bucketArray = anchor->bucketArrayAddress();
+
+    for (native_std::size_t i = 0; i < numBuckets; ++i) {
+        bslalg::HashTableBucket& bucket = bucketArray[i];
+        if (bucket.first() == bucket.last()) {
+            continue;                                               // CONTINUE
+        }
+
+        // Insertion sort, comparing each element with the last element of
+        // the sorted prefix of the bucket first, so that sorting a bucket
+        // already in split order computes each hash code once.  Elements
+        // having the same hash code, and in particular equivalent keys, keep
+        // their relative order.
+
+        native_std::size_t lastHashCode = this->hashCodeForNode(
+                                                              bucket.first());
+
+        BidirectionalLink *const end    = bucket.last()->nextLink();
+        BidirectionalLink       *cursor = bucket.first()->nextLink();
+        while (end != cursor) {
+            BidirectionalLink        *next     = cursor->nextLink();
+            const native_std::size_t  hashCode = this->hashCodeForNode(cursor);
+
+            if (!HashTable_ImpDetails::isBeforeInSplitOrder(hashCode,
+                                                            lastHashCode,
+                                                            numBuckets)) {
+                lastHashCode = hashCode;
+            }
+            else {
+                BidirectionalLink *position = bucket.first();
+                while (!HashTable_ImpDetails::isBeforeInSplitOrder(
+                                              hashCode,
+                                              this->hashCodeForNode(position),
+                                              numBuckets)) {
+                    position = position->nextLink();
+                }
+
+                ImpUtil::remove(anchor, cursor, hashCode);
+                ImpUtil::insertAtPosition(anchor, cursor, hashCode, position);
+            }
+            cursor = next;
+        }
+    }
+}
+
 // PRIVATE ACCESSORS
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 template <class DEDUCED_KEY>
@@ -2917,6 +3410,38 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::find(
                                                      hashValue);
 }
 
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::findSplitOrderPosition(
+                                            native_std::size_t hashCode) const
+{
+    if (!d_incrementalRehash) {
+        return 0;                                                     // RETURN
+    }
+
+    const native_std::size_t       numBuckets = d_anchor.bucketArraySize();
+    const bslalg::HashTableBucket& bucket     =
+                d_anchor.bucketArrayAddress()[
+                   bslalg::HashTableImpUtil::computeBucketIndex(hashCode,
+                                                                numBuckets)];
+    if (!bucket.first()) {
+        return 0;                                                     // RETURN
+    }
+
+    bslalg::BidirectionalLink *const end = bucket.last()->nextLink();
+    for (bslalg::BidirectionalLink *cursor = bucket.first();
+         end != cursor;
+         cursor = cursor->nextLink()) {
+        if (HashTable_ImpDetails::isBeforeInSplitOrder(
+                                                hashCode,
+                                                this->hashCodeForNode(cursor),
+                                                numBuckets)) {
+            return cursor;                                            // RETURN
+        }
+    }
+    return 0;
+}
+
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 inline
 bslalg::HashTableBucket *
@@ -3005,7 +3530,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplace(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growBucketArray();
     }
 
 
@@ -3024,12 +3549,12 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplace(
                                       ImpUtil::extractKey<KEY_CONFIG>(newNode),
                                       hashCode);
 
+    this->advanceRehash();
+
     if (!position) {
-        ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
-    }
-    else {
-        ImpUtil::insertAtPosition(&d_anchor, newNode, hashCode, position);
+        position = this->findSplitOrderPosition(hashCode);
     }
+    this->insertNode(newNode, hashCode, position);
     nodeProctor.release();
 
     ++d_size;
@@ -3049,7 +3574,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplace(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growBucketArray();
     }
 
 
@@ -3068,12 +3593,12 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplace(
                                       ImpUtil::extractKey<KEY_CONFIG>(newNode),
                                       hashCode);
 
+    this->advanceRehash();
+
     if (!position) {
-        ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
-    }
-    else {
-        ImpUtil::insertAtPosition(&d_anchor, newNode, hashCode, position);
+        position = this->findSplitOrderPosition(hashCode);
     }
+    this->insertNode(newNode, hashCode, position);
     nodeProctor.release();
 
     ++d_size;
@@ -3095,7 +3620,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplace(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growBucketArray();
     }
 
 
@@ -3115,12 +3640,12 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplace(
                                       ImpUtil::extractKey<KEY_CONFIG>(newNode),
                                       hashCode);
 
+    this->advanceRehash();
+
     if (!position) {
-        ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
-    }
-    else {
-        ImpUtil::insertAtPosition(&d_anchor, newNode, hashCode, position);
+        position = this->findSplitOrderPosition(hashCode);
     }
+    this->insertNode(newNode, hashCode, position);
     nodeProctor.release();
 
     ++d_size;
@@ -3144,7 +3669,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplace(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growBucketArray();
     }
 
 
@@ -3165,12 +3690,12 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplace(
                                       ImpUtil::extractKey<KEY_CONFIG>(newNode),
                                       hashCode);
 
+    this->advanceRehash();
+
     if (!position) {
-        ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
-    }
-    else {
-        ImpUtil::insertAtPosition(&d_anchor, newNode, hashCode, position);
+        position = this->findSplitOrderPosition(hashCode);
     }
+    this->insertNode(newNode, hashCode, position);
     nodeProctor.release();
 
     ++d_size;
@@ -3196,7 +3721,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplace(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growBucketArray();
     }
 
 
@@ -3218,12 +3743,12 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplace(
                                       ImpUtil::extractKey<KEY_CONFIG>(newNode),
                                       hashCode);
 
+    this->advanceRehash();
+
     if (!position) {
-        ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
-    }
-    else {
-        ImpUtil::insertAtPosition(&d_anchor, newNode, hashCode, position);
+        position = this->findSplitOrderPosition(hashCode);
     }
+    this->insertNode(newNode, hashCode, position);
     nodeProctor.release();
 
     ++d_size;
@@ -3251,7 +3776,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplace(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growBucketArray();
     }
 
 
@@ -3274,12 +3799,12 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplace(
                                       ImpUtil::extractKey<KEY_CONFIG>(newNode),
                                       hashCode);
 
+    this->advanceRehash();
+
     if (!position) {
-        ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
-    }
-    else {
-        ImpUtil::insertAtPosition(&d_anchor, newNode, hashCode, position);
+        position = this->findSplitOrderPosition(hashCode);
     }
+    this->insertNode(newNode, hashCode, position);
     nodeProctor.release();
 
     ++d_size;
@@ -3309,7 +3834,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplace(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growBucketArray();
     }
 
 
@@ -3333,12 +3858,12 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplace(
                                       ImpUtil::extractKey<KEY_CONFIG>(newNode),
                                       hashCode);
 
+    this->advanceRehash();
+
     if (!position) {
-        ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
-    }
-    else {
-        ImpUtil::insertAtPosition(&d_anchor, newNode, hashCode, position);
+        position = this->findSplitOrderPosition(hashCode);
     }
+    this->insertNode(newNode, hashCode, position);
     nodeProctor.release();
 
     ++d_size;
@@ -3370,7 +3895,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplace(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growBucketArray();
     }
 
 
@@ -3395,12 +3920,12 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplace(
                                       ImpUtil::extractKey<KEY_CONFIG>(newNode),
                                       hashCode);
 
+    this->advanceRehash();
+
     if (!position) {
-        ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
-    }
-    else {
-        ImpUtil::insertAtPosition(&d_anchor, newNode, hashCode, position);
+        position = this->findSplitOrderPosition(hashCode);
     }
+    this->insertNode(newNode, hashCode, position);
     nodeProctor.release();
 
     ++d_size;
@@ -3434,7 +3959,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplace(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growBucketArray();
     }
 
 
@@ -3460,12 +3985,12 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplace(
                                       ImpUtil::extractKey<KEY_CONFIG>(newNode),
                                       hashCode);
 
+    this->advanceRehash();
+
     if (!position) {
-        ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
-    }
-    else {
-        ImpUtil::insertAtPosition(&d_anchor, newNode, hashCode, position);
+        position = this->findSplitOrderPosition(hashCode);
     }
+    this->insertNode(newNode, hashCode, position);
     nodeProctor.release();
 
     ++d_size;
@@ -3501,7 +4026,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplace(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growBucketArray();
     }
 
 
@@ -3528,12 +4053,12 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplace(
                                       ImpUtil::extractKey<KEY_CONFIG>(newNode),
                                       hashCode);
 
+    this->advanceRehash();
+
     if (!position) {
-        ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
-    }
-    else {
-        ImpUtil::insertAtPosition(&d_anchor, newNode, hashCode, position);
+        position = this->findSplitOrderPosition(hashCode);
     }
+    this->insertNode(newNode, hashCode, position);
     nodeProctor.release();
 
     ++d_size;
@@ -3571,7 +4096,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplace(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growBucketArray();
     }
 
 
@@ -3599,12 +4124,12 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplace(
                                       ImpUtil::extractKey<KEY_CONFIG>(newNode),
                                       hashCode);
 
+    this->advanceRehash();
+
     if (!position) {
-        ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
-    }
-    else {
-        ImpUtil::insertAtPosition(&d_anchor, newNode, hashCode, position);
+        position = this->findSplitOrderPosition(hashCode);
     }
+    this->insertNode(newNode, hashCode, position);
     nodeProctor.release();
 
     ++d_size;
@@ -3624,7 +4149,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceWithHint(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growBucketArray();
     }
 
 
@@ -3645,12 +4170,12 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceWithHint(
         hint = this->find(ImpUtil::extractKey<KEY_CONFIG>(newNode), hashCode);
     }
 
+    this->advanceRehash();
+
     if (!hint) {
-        ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
-    }
-    else {
-        ImpUtil::insertAtPosition(&d_anchor, newNode, hashCode, hint);
+        hint = this->findSplitOrderPosition(hashCode);
     }
+    this->insertNode(newNode, hashCode, hint);
     nodeProctor.release();
 
     ++d_size;
@@ -3671,7 +4196,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceWithHint(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growBucketArray();
     }
 
 
@@ -3692,12 +4217,12 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceWithHint(
         hint = this->find(ImpUtil::extractKey<KEY_CONFIG>(newNode), hashCode);
     }
 
+    this->advanceRehash();
+
     if (!hint) {
-        ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
-    }
-    else {
-        ImpUtil::insertAtPosition(&d_anchor, newNode, hashCode, hint);
+        hint = this->findSplitOrderPosition(hashCode);
     }
+    this->insertNode(newNode, hashCode, hint);
     nodeProctor.release();
 
     ++d_size;
@@ -3720,7 +4245,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceWithHint(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growBucketArray();
     }
 
 
@@ -3742,12 +4267,12 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceWithHint(
         hint = this->find(ImpUtil::extractKey<KEY_CONFIG>(newNode), hashCode);
     }
 
+    this->advanceRehash();
+
     if (!hint) {
-        ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
-    }
-    else {
-        ImpUtil::insertAtPosition(&d_anchor, newNode, hashCode, hint);
+        hint = this->findSplitOrderPosition(hashCode);
     }
+    this->insertNode(newNode, hashCode, hint);
     nodeProctor.release();
 
     ++d_size;
@@ -3772,7 +4297,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceWithHint(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growBucketArray();
     }
 
 
@@ -3795,12 +4320,12 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceWithHint(
         hint = this->find(ImpUtil::extractKey<KEY_CONFIG>(newNode), hashCode);
     }
 
+    this->advanceRehash();
+
     if (!hint) {
-        ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
-    }
-    else {
-        ImpUtil::insertAtPosition(&d_anchor, newNode, hashCode, hint);
+        hint = this->findSplitOrderPosition(hashCode);
     }
+    this->insertNode(newNode, hashCode, hint);
     nodeProctor.release();
 
     ++d_size;
@@ -3827,7 +4352,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceWithHint(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growBucketArray();
     }
 
 
@@ -3851,12 +4376,12 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceWithHint(
         hint = this->find(ImpUtil::extractKey<KEY_CONFIG>(newNode), hashCode);
     }
 
+    this->advanceRehash();
+
     if (!hint) {
-        ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
-    }
-    else {
-        ImpUtil::insertAtPosition(&d_anchor, newNode, hashCode, hint);
+        hint = this->findSplitOrderPosition(hashCode);
     }
+    this->insertNode(newNode, hashCode, hint);
     nodeProctor.release();
 
     ++d_size;
@@ -3885,7 +4410,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceWithHint(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growBucketArray();
     }
 
 
@@ -3910,12 +4435,12 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceWithHint(
         hint = this->find(ImpUtil::extractKey<KEY_CONFIG>(newNode), hashCode);
     }
 
+    this->advanceRehash();
+
     if (!hint) {
-        ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
-    }
-    else {
-        ImpUtil::insertAtPosition(&d_anchor, newNode, hashCode, hint);
+        hint = this->findSplitOrderPosition(hashCode);
     }
+    this->insertNode(newNode, hashCode, hint);
     nodeProctor.release();
 
     ++d_size;
@@ -3946,7 +4471,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceWithHint(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growBucketArray();
     }
 
 
@@ -3972,12 +4497,12 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceWithHint(
         hint = this->find(ImpUtil::extractKey<KEY_CONFIG>(newNode), hashCode);
     }
 
+    this->advanceRehash();
+
     if (!hint) {
-        ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
-    }
-    else {
-        ImpUtil::insertAtPosition(&d_anchor, newNode, hashCode, hint);
+        hint = this->findSplitOrderPosition(hashCode);
     }
+    this->insertNode(newNode, hashCode, hint);
     nodeProctor.release();
 
     ++d_size;
@@ -4010,7 +4535,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceWithHint(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growBucketArray();
     }
 
 
@@ -4037,12 +4562,12 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceWithHint(
         hint = this->find(ImpUtil::extractKey<KEY_CONFIG>(newNode), hashCode);
     }
 
+    this->advanceRehash();
+
     if (!hint) {
-        ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
-    }
-    else {
-        ImpUtil::insertAtPosition(&d_anchor, newNode, hashCode, hint);
+        hint = this->findSplitOrderPosition(hashCode);
     }
+    this->insertNode(newNode, hashCode, hint);
     nodeProctor.release();
 
     ++d_size;
@@ -4077,7 +4602,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceWithHint(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growBucketArray();
     }
 
 
@@ -4105,12 +4630,12 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceWithHint(
         hint = this->find(ImpUtil::extractKey<KEY_CONFIG>(newNode), hashCode);
     }
 
+    this->advanceRehash();
+
     if (!hint) {
-        ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
-    }
-    else {
-        ImpUtil::insertAtPosition(&d_anchor, newNode, hashCode, hint);
+        hint = this->findSplitOrderPosition(hashCode);
     }
+    this->insertNode(newNode, hashCode, hint);
     nodeProctor.release();
 
     ++d_size;
@@ -4147,7 +4672,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceWithHint(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growBucketArray();
     }
 
 
@@ -4176,12 +4701,12 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceWithHint(
         hint = this->find(ImpUtil::extractKey<KEY_CONFIG>(newNode), hashCode);
     }
 
+    this->advanceRehash();
+
     if (!hint) {
-        ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
-    }
-    else {
-        ImpUtil::insertAtPosition(&d_anchor, newNode, hashCode, hint);
+        hint = this->findSplitOrderPosition(hashCode);
     }
+    this->insertNode(newNode, hashCode, hint);
     nodeProctor.release();
 
     ++d_size;
@@ -4220,7 +4745,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceWithHint(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growBucketArray();
     }
 
 
@@ -4250,12 +4775,12 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceWithHint(
         hint = this->find(ImpUtil::extractKey<KEY_CONFIG>(newNode), hashCode);
     }
 
+    this->advanceRehash();
+
     if (!hint) {
-        ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
-    }
-    else {
-        ImpUtil::insertAtPosition(&d_anchor, newNode, hashCode, hint);
+        hint = this->findSplitOrderPosition(hashCode);
     }
+    this->insertNode(newNode, hashCode, hint);
     nodeProctor.release();
 
     ++d_size;
@@ -4277,7 +4802,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growBucketArray();
     }
 
 
@@ -4300,10 +4825,13 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
     if(!position) {
         if (d_size >= d_capacity) {
-            this->rehashForNumBuckets(numBuckets() * 2);
+            this->growBucketArray();
         }
+        this->advanceRehash();
 
-        ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
+        this->insertNode(newNode,
+                         hashCode,
+                         this->findSplitOrderPosition(hashCode));
         nodeProctor.release();
 
         ++d_size;
@@ -4328,7 +4856,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growBucketArray();
     }
 
 
@@ -4351,10 +4879,13 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
     if(!position) {
         if (d_size >= d_capacity) {
-            this->rehashForNumBuckets(numBuckets() * 2);
+            this->growBucketArray();
         }
+        this->advanceRehash();
 
-        ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
+        this->insertNode(newNode,
+                         hashCode,
+                         this->findSplitOrderPosition(hashCode));
         nodeProctor.release();
 
         ++d_size;
@@ -4381,7 +4912,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growBucketArray();
     }
 
 
@@ -4405,10 +4936,13 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
     if(!position) {
         if (d_size >= d_capacity) {
-            this->rehashForNumBuckets(numBuckets() * 2);
+            this->growBucketArray();
         }
+        this->advanceRehash();
 
-        ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
+        this->insertNode(newNode,
+                         hashCode,
+                         this->findSplitOrderPosition(hashCode));
         nodeProctor.release();
 
         ++d_size;
@@ -4437,7 +4971,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growBucketArray();
     }
 
 
@@ -4462,10 +4996,13 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
     if(!position) {
         if (d_size >= d_capacity) {
-            this->rehashForNumBuckets(numBuckets() * 2);
+            this->growBucketArray();
         }
+        this->advanceRehash();
 
-        ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
+        this->insertNode(newNode,
+                         hashCode,
+                         this->findSplitOrderPosition(hashCode));
         nodeProctor.release();
 
         ++d_size;
@@ -4496,7 +5033,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growBucketArray();
     }
 
 
@@ -4522,10 +5059,13 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
     if(!position) {
         if (d_size >= d_capacity) {
-            this->rehashForNumBuckets(numBuckets() * 2);
+            this->growBucketArray();
         }
+        this->advanceRehash();
 
-        ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
+        this->insertNode(newNode,
+                         hashCode,
+                         this->findSplitOrderPosition(hashCode));
         nodeProctor.release();
 
         ++d_size;
@@ -4558,7 +5098,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growBucketArray();
     }
 
 
@@ -4585,10 +5125,13 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
     if(!position) {
         if (d_size >= d_capacity) {
-            this->rehashForNumBuckets(numBuckets() * 2);
+            this->growBucketArray();
         }
+        this->advanceRehash();
 
-        ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
+        this->insertNode(newNode,
+                         hashCode,
+                         this->findSplitOrderPosition(hashCode));
         nodeProctor.release();
 
         ++d_size;
@@ -4623,7 +5166,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growBucketArray();
     }
 
 
@@ -4651,10 +5194,13 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
     if(!position) {
         if (d_size >= d_capacity) {
-            this->rehashForNumBuckets(numBuckets() * 2);
+            this->growBucketArray();
         }
+        this->advanceRehash();
 
-        ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
+        this->insertNode(newNode,
+                         hashCode,
+                         this->findSplitOrderPosition(hashCode));
         nodeProctor.release();
 
         ++d_size;
@@ -4691,7 +5237,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growBucketArray();
     }
 
 
@@ -4720,10 +5266,13 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
     if(!position) {
         if (d_size >= d_capacity) {
-            this->rehashForNumBuckets(numBuckets() * 2);
+            this->growBucketArray();
         }
+        this->advanceRehash();
 
-        ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
+        this->insertNode(newNode,
+                         hashCode,
+                         this->findSplitOrderPosition(hashCode));
         nodeProctor.release();
 
         ++d_size;
@@ -4762,7 +5311,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growBucketArray();
     }
 
 
@@ -4792,10 +5341,13 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
     if(!position) {
         if (d_size >= d_capacity) {
-            this->rehashForNumBuckets(numBuckets() * 2);
+            this->growBucketArray();
         }
+        this->advanceRehash();
 
-        ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
+        this->insertNode(newNode,
+                         hashCode,
+                         this->findSplitOrderPosition(hashCode));
         nodeProctor.release();
 
         ++d_size;
@@ -4836,7 +5388,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growBucketArray();
     }
 
 
@@ -4867,10 +5419,13 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
     if(!position) {
         if (d_size >= d_capacity) {
-            this->rehashForNumBuckets(numBuckets() * 2);
+            this->growBucketArray();
         }
+        this->advanceRehash();
 
-        ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
+        this->insertNode(newNode,
+                         hashCode,
+                         this->findSplitOrderPosition(hashCode));
         nodeProctor.release();
 
         ++d_size;
@@ -4913,7 +5468,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growBucketArray();
     }
 
 
@@ -4945,10 +5500,13 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
     if(!position) {
         if (d_size >= d_capacity) {
-            this->rehashForNumBuckets(numBuckets() * 2);
+            this->growBucketArray();
         }
+        this->advanceRehash();
 
-        ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
+        this->insertNode(newNode,
+                         hashCode,
+                         this->findSplitOrderPosition(hashCode));
         nodeProctor.release();
 
         ++d_size;
@@ -4972,7 +5530,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplace(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growBucketArray();
     }
 
 
@@ -4991,12 +5549,12 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplace(
                                       ImpUtil::extractKey<KEY_CONFIG>(newNode),
                                       hashCode);
 
+    this->advanceRehash();
+
     if (!position) {
-        ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
-    }
-    else {
-        ImpUtil::insertAtPosition(&d_anchor, newNode, hashCode, position);
+        position = this->findSplitOrderPosition(hashCode);
     }
+    this->insertNode(newNode, hashCode, position);
     nodeProctor.release();
 
     ++d_size;
@@ -5015,7 +5573,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceWithHint(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growBucketArray();
     }
 
 
@@ -5036,12 +5594,12 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceWithHint(
         hint = this->find(ImpUtil::extractKey<KEY_CONFIG>(newNode), hashCode);
     }
 
+    this->advanceRehash();
+
     if (!hint) {
-        ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
-    }
-    else {
-        ImpUtil::insertAtPosition(&d_anchor, newNode, hashCode, hint);
+        hint = this->findSplitOrderPosition(hashCode);
     }
+    this->insertNode(newNode, hashCode, hint);
     nodeProctor.release();
 
     ++d_size;
@@ -5062,7 +5620,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
 
     if (d_size >= d_capacity) {
-        this->rehashForNumBuckets(numBuckets() * 2);
+        this->growBucketArray();
     }
 
 
@@ -5085,10 +5643,13 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::emplaceIfMissing(
 
     if(!position) {
         if (d_size >= d_capacity) {
-            this->rehashForNumBuckets(numBuckets() * 2);
+            this->growBucketArray();
         }
+        this->advanceRehash();
 
-        ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
+        this->insertNode(newNode,
+                         hashCode,
+                         this->findSplitOrderPosition(hashCode));
         nodeProctor.release();
 
         ++d_size;
@@ -5109,8 +5670,12 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertIfMissing(
     bslalg::BidirectionalLink *position = this->find(key, hashCode);
     if (!position) {
         if (d_size >= d_capacity) {
-            this->rehashForNumBuckets(numBuckets() * 2);
+            this->growBucketArray();
         }
+        this->advanceRehash();
+
+        bslalg::BidirectionalLink *splitOrderPosition =
+                                      this->findSplitOrderPosition(hashCode);
 
         typedef typename ValueType::second_type MappedType;
 
@@ -5134,9 +5699,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertIfMissing(
                                                        defaultMapped.object());
 #endif
 
-        bslalg::HashTableImpUtil::insertAtFrontOfBucket(&d_anchor,
-                                                        position,
-                                                        hashCode);
+        this->insertNode(position, hashCode, splitOrderPosition);
         ++d_size;
     }
     return position;
@@ -5160,13 +5723,15 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertIfMissing(
 
     if(!position) {
         if (d_size >= d_capacity) {
-            this->rehashForNumBuckets(numBuckets() * 2);
+            this->growBucketArray();
         }
+        this->advanceRehash();
+
+        bslalg::BidirectionalLink *splitOrderPosition =
+                                      this->findSplitOrderPosition(hashCode);
 
         position = d_parameters.nodeFactory().emplaceIntoNewNode(value);
-        bslalg::HashTableImpUtil::insertAtFrontOfBucket(&d_anchor,
-                                                        position,
-                                                        hashCode);
+        this->insertNode(position, hashCode, splitOrderPosition);
         ++d_size;
     }
 
@@ -5193,14 +5758,16 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertIfMissing(
 
     if(!position) {
         if (d_size >= d_capacity) {
-            this->rehashForNumBuckets(numBuckets() * 2);
+            this->growBucketArray();
         }
+        this->advanceRehash();
+
+        bslalg::BidirectionalLink *splitOrderPosition =
+                                      this->findSplitOrderPosition(hashCode);
 
         position = d_parameters.nodeFactory().emplaceIntoNewNode(
                                                        MoveUtil::move(lvalue));
-        bslalg::HashTableImpUtil::insertAtFrontOfBucket(&d_anchor,
-                                                        position,
-                                                        hashCode);
+        this->insertNode(position, hashCode, splitOrderPosition);
         ++d_size;
     }
 
@@ -5244,6 +5811,19 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insert(
                            BSLS_COMPILERFEATURES_FORWARD(SOURCE_TYPE, value));
 }
 
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::completeRehash()
+{
+    if (!this->isRehashInProgress()) {
+        return;                                                       // RETURN
+    }
+
+    while (d_numSplitPoints < this->numBuckets()) {
+        this->computeNextSplitPoint();
+    }
+}
+
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 void
 HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::rehashForNumBuckets(
@@ -5275,11 +5855,39 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::remove(
     BSLS_ASSERT_SAFE(node->previousLink()
                   || d_anchor.listRootAddress() == node);
 
+    typedef bslalg::HashTableImpUtil ImpUtil;
+
     bslalg::BidirectionalLink *result = node->nextLink();
 
-    bslalg::HashTableImpUtil::remove(&d_anchor,
-                                     node,
-                                     hashCodeForNode(node));
+    const native_std::size_t hashCode = hashCodeForNode(node);
+
+    if (d_numSplitPoints) {
+        const native_std::size_t numBuckets = d_anchor.bucketArraySize();
+
+        if (ImpUtil::computeBucketIndex(hashCode, numBuckets)
+                                                          < d_numSplitPoints) {
+            // The bucket of 'node' is already split: remove 'node' from its
+            // half, which is contiguous.
+
+            const native_std::size_t nextIndex =
+                         ImpUtil::computeBucketIndex(hashCode, numBuckets * 2);
+            bslalg::HashTableBucket& half      = d_nextBuckets_p[nextIndex];
+
+            if (node == half.first()) {
+                if (node == half.last()) {
+                    half.reset();
+                }
+                else {
+                    half.setFirst(node->nextLink());
+                }
+            }
+            else if (node == half.last()) {
+                half.setLast(node->previousLink());
+            }
+        }
+    }
+
+    ImpUtil::remove(&d_anchor, node, hashCode);
     --d_size;
 
     d_parameters.nodeFactory().deleteNode(static_cast<NodeType *>(node));
@@ -5297,6 +5905,8 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::removeAll()
                  0,
                  sizeof(bslalg::HashTableBucket) * d_anchor.bucketArraySize());
 
+    this->destroySplitPoints();
+
     d_anchor.setListRootAddress(0);
     d_size = 0;
 }
@@ -5328,6 +5938,27 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::reserveForNumElements(
     }
 }
 
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::
+setIncrementalRehashEnabled(bool value)
+{
+    if (value == d_incrementalRehash) {
+        return;                                                       // RETURN
+    }
+
+    d_incrementalRehash = value;
+
+    if (!value) {
+        this->destroySplitPoints();
+    }
+    else if (0 < d_size) {
+        // Re-index the elements into split order.
+
+        this->rehashIntoExactlyNumBuckets(this->numBuckets(), d_capacity);
+    }
+}
+
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 inline
 void HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::setMaxLoadFactor(
@@ -5452,6 +6083,50 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::find(
                                              d_parameters.hashCodeForKey(key));
 }
 
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class ITERATOR>
+void HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::findMany(
+                                                ITERATOR      *results,
+                                                const KeyType *keys,
+                                                SizeType       numKeys) const
+{
+    enum { k_BATCH_SIZE = 16 };  // number of lookups whose memory accesses
+                                 // are overlapped
+
+    native_std::size_t             hashCodes[k_BATCH_SIZE];
+    const bslalg::HashTableBucket *buckets[k_BATCH_SIZE];
+
+    while (numKeys) {
+        const SizeType numBatch = numKeys < k_BATCH_SIZE
+                                ? numKeys
+                                : static_cast<SizeType>(k_BATCH_SIZE);
+
+        for (SizeType i = 0; i < numBatch; ++i) {
+            hashCodes[i] = d_parameters.hashCodeForKey(keys[i]);
+            buckets[i]   = d_anchor.bucketArrayAddress()
+                         + bslalg::HashTableImpUtil::computeBucketIndex(
+                                             hashCodes[i],
+                                             d_anchor.bucketArraySize());
+
+            bsls::PerformanceHint::prefetchForReading(buckets[i]);
+        }
+
+        for (SizeType i = 0; i < numBatch; ++i) {
+            if (buckets[i]->first()) {
+                bsls::PerformanceHint::prefetchForReading(buckets[i]->first());
+            }
+        }
+
+        for (SizeType i = 0; i < numBatch; ++i) {
+            results[i] = ITERATOR(find(keys[i], hashCodes[i]));
+        }
+
+        results += numBatch;
+        keys    += numBatch;
+        numKeys -= numBatch;
+    }
+}
+
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 bslalg::BidirectionalLink *
 HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::findEndOfRange(
@@ -5652,6 +6327,26 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::hasher() const
     return d_parameters.originalHasher();
 }
 
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+bool
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::
+isIncrementalRehashEnabled() const
+{
+    return d_incrementalRehash;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+bool
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::
+isRehashInProgress() const
+{
+    return d_incrementalRehash
+        && 0 < d_size
+        && d_numSplitPoints < this->numBuckets();
+}
+
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 inline
 float HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::loadFactor() const
@@ -6,9 +6,11 @@
 #include <bslstl_hashtable.h>
 #include <bslstl_hashtableiterator.h>  // usage example
 #include <bslstl_iterator.h>           // 'distance', in usage example
+#include <bslstl_pair.h>
 
 #include <bslalg_bidirectionallink.h>
 #include <bslalg_bidirectionallinklistutil.h>
+#include <bslalg_bidirectionalnode.h>
 #include <bslalg_swaputil.h>
 
 #include <bslma_default.h>
@@ -24,6 +26,7 @@
 #include <bslmf_isfunction.h>
 #include <bslmf_istriviallycopyable.h>
 #include <bslmf_istriviallydefaultconstructible.h>
+#include <bslmf_movableref.h>
 #include <bslmf_removeconst.h>
 
 #include <bsls_assert.h>
@@ -165,8 +168,10 @@ using bslstl::CallableVariable;
 //*[17] Link *insertIfMissing(const KeyType& key);
 // [  ] remove(bslalg::BidirectionalLink *node);
 // [ 2] removeAll();
+// [17] completeRehash();
 //*[11] rehashForNumBuckets(SizeType newNumBuckets);
 //*[12] reserveForNumElements(SizeType numElements);
+// [17] setIncrementalRehashEnabled(bool value);
 //*[14] setMaxLoadFactor(float loadFactor);
 // [ 8] swap(HashTable& other);
 //
@@ -174,6 +179,8 @@ using bslstl::CallableVariable;
 // [ 4] allocator() const;
 // [ 4] comparator() const;
 // [ 4] hasher() const;
+// [17] isIncrementalRehashEnabled() const;
+// [17] isRehashInProgress() const;
 // [ 4] size() const;
 //*[19] maxSize() const;
 // [ 4] numBuckets() const;
@@ -642,6 +649,161 @@ struct IsBslAllocator<bsl::allocator<TYPE> > : bsl::true_type {};
 
 struct TestException : native_std::exception{};
 
+//- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+                       // ===============================
+                       // struct IncrementalRehashConfig
+                       // ===============================
+
+struct IncrementalRehashConfig {
+    // This 'struct' provides a 'KEY_CONFIG' for a map-like hash-table of
+    // 'int' keys, in which the 'second' member of each element records the
+    // order of insertion of elements sharing the same key.
+
+    typedef int                 KeyType;
+    typedef bsl::pair<int, int> ValueType;
+
+    static const KeyType& extractKey(const ValueType& value)
+        // Return a reference providing non-modifiable access to the key of
+        // the specified 'value'.
+    {
+        return value.first;
+    }
+};
+
+template <class HASH_TABLE>
+bool verifyIncrementalRehashGroups(const HASH_TABLE& object,
+                                   int               numKeys,
+                                   int               numPerKey)
+    // Return 'true' if the specified 'object' holds exactly the specified
+    // 'numPerKey' elements for each key in the range '[0 .. numKeys)', the
+    // elements of each key form a contiguous sequence in the list of
+    // 'object', that sequence holds the most recently inserted element first,
+    // and 'find' returns the first element of each such sequence; and return
+    // 'false' otherwise.  The behavior is undefined unless the 'second' member
+    // of each element with a given key is distinct, and increases in order of
+    // insertion.
+{
+    typedef bslalg::BidirectionalNode<bsl::pair<int, int> > Node;
+
+    if (object.size() != static_cast<size_t>(numKeys * numPerKey)) {
+        return false;                                                 // RETURN
+    }
+
+    int key = -1;
+    int count = 0;
+    int previous = INT_MAX;
+    bslalg::BidirectionalLink *cursor = object.elementListRoot();
+    while (cursor) {
+        const bsl::pair<int, int>& value =
+                                     static_cast<Node *>(cursor)->value();
+        if (value.first != key) {
+            if (-1 != key && numPerKey != count) {
+                return false;                                         // RETURN
+            }
+            if (value.first < 0 || value.first >= numKeys
+             || object.find(value.first) != cursor) {
+                return false;                                         // RETURN
+            }
+            key      = value.first;
+            count    = 0;
+            previous = INT_MAX;
+        }
+        if (value.second >= previous) {
+            return false;                                             // RETURN
+        }
+        previous = value.second;
+        ++count;
+        cursor = cursor->nextLink();
+    }
+    return 0 == numKeys || numPerKey == count;
+}
+
+template <class HASH_TABLE>
+bool verifyIncrementalRehashBuckets(const HASH_TABLE& object)
+    // Return 'true' if every element of the specified 'object' lies in the
+    // bucket for its key, the counts of elements in the buckets of 'object'
+    // sum to 'object.size()', and, if incremental rehashing is enabled on
+    // 'object', the elements of each bucket are in split order; and return
+    // 'false' otherwise.
+{
+    typedef bslalg::BidirectionalNode<bsl::pair<int, int> > Node;
+
+    const size_t numBuckets = object.numBuckets();
+
+    size_t total = 0;
+    for (size_t i = 0; i != numBuckets; ++i) {
+        const bslalg::HashTableBucket& bucket = object.bucketAtIndex(i);
+        total += object.countElementsInBucket(i);
+
+        size_t previousHashCode = 0;
+        for (bslalg::BidirectionalLink *cursor = bucket.first();
+             cursor;
+             cursor = cursor == bucket.last() ? 0 : cursor->nextLink()) {
+            const int key = static_cast<Node *>(cursor)->value().first;
+            if (object.bucketIndexForKey(key) != i) {
+                return false;                                         // RETURN
+            }
+
+            const size_t hashCode = object.hasher()(key);
+            if (object.isIncrementalRehashEnabled()
+             && cursor != bucket.first()
+             && bslstl::HashTable_ImpDetails::isBeforeInSplitOrder(
+                                                           hashCode,
+                                                           previousHashCode,
+                                                           numBuckets)) {
+                return false;                                         // RETURN
+            }
+            previousHashCode = hashCode;
+        }
+    }
+    return total == object.size();
+}
+
+template <class HASH_TABLE>
+int recordIncrementalRehashList(bslalg::BidirectionalLink **links,
+                                int                         maxNumLinks,
+                                const HASH_TABLE&           object)
+    // Load into the specified 'links' array, of the specified 'maxNumLinks'
+    // capacity, the addresses of the elements of the specified 'object' in
+    // list order, and return the number of elements.  The behavior is
+    // undefined unless 'object.size() <= maxNumLinks'.
+{
+    int numLinks = 0;
+    for (bslalg::BidirectionalLink *cursor = object.elementListRoot();
+         cursor;
+         cursor = cursor->nextLink()) {
+        BSLS_ASSERT(numLinks < maxNumLinks);
+        links[numLinks++] = cursor;
+    }
+    return numLinks;
+}
+
+template <class HASH_TABLE>
+bool verifyIncrementalRehashList(bslalg::BidirectionalLink *const *links,
+                                 int                               numLinks,
+                                 bslalg::BidirectionalLink        *newLink,
+                                 const HASH_TABLE&                 object)
+    // Return 'true' if the list of elements of the specified 'object' holds,
+    // in order, the specified 'numLinks' elements of the specified 'links'
+    // array, and the specified 'newLink' at any position, and 'false'
+    // otherwise.
+{
+    int index = 0;
+    for (bslalg::BidirectionalLink *cursor = object.elementListRoot();
+         cursor;
+         cursor = cursor->nextLink()) {
+        if (newLink == cursor) {
+            continue;                                               // CONTINUE
+        }
+        if (index == numLinks || links[index] != cursor) {
+            return false;                                             // RETURN
+        }
+        ++index;
+    }
+    return numLinks == index && object.size() == size_t(numLinks + 1);
+}
+
 //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 
                        // ===============================
@@ -3965,6 +4127,425 @@ void mainTestCase16()
     TestDriver_AwkwardMaplike::testCase16();
 }
 
+static
+void mainTestCase17()
+    // --------------------------------------------------------------------
+    // TESTING INCREMENTAL REHASH
+    //
+    // Concerns:
+    //: 1 Incremental rehashing is disabled by default, and
+    //:   'setIncrementalRehashEnabled' sets the value reported by
+    //:   'isIncrementalRehashEnabled'.
+    //:
+    //: 2 Enabling incremental rehashing on a non-empty hash-table re-indexes
+    //:   its elements into split order.
+    //:
+    //: 3 Once incremental rehashing is enabled, each growth of the array of
+    //:   buckets exactly doubles the number of buckets, and leaves a rehash
+    //:   in progress that completes before the next growth.  The growth
+    //:   itself allocates no array of buckets, as it adopts the array built
+    //:   by the preceding insertions.
+    //:
+    //: 4 No insertion, including an insertion growing the array of buckets,
+    //:   relinks the existing elements, so that iterators remain valid.
+    //:
+    //: 5 The bucket interface is valid at all times, and the elements of
+    //:   each bucket remain in split order.
+    //:
+    //: 6 Elements with equivalent keys remain contiguous, in the order
+    //:   required by 'insert'.
+    //:
+    //: 7 'remove' of any element, including while a rehash is in progress,
+    //:   preserves the order of the remaining elements, and the following
+    //:   growths of the array of buckets index every element correctly.
+    //:
+    //: 8 'completeRehash', and disabling incremental rehashing, end the
+    //:   rehash in progress without changing the elements or the buckets.
+    //:
+    //: 9 Copying, moving, swapping, clearing, and explicitly rehashing a
+    //:   hash-table while a rehash is in progress produce valid hash-tables,
+    //:   and no memory is leaked.
+    //:
+    //:10 If the hasher throws, the hash-table is left in a valid state and
+    //:   no memory is leaked.
+    //
+    // Plan:
+    //: 1 Create a hash-table and verify the default value of the attribute,
+    //:   then set and verify each value.  (C-1)
+    //:
+    //: 2 Enable incremental rehashing on a hash-table holding elements, and
+    //:   verify its buckets with a helper function that also checks the
+    //:   split order of each bucket.  (C-2)
+    //:
+    //: 3 Insert several elements for each of a range of keys into a
+    //:   hash-table with incremental rehashing enabled.  Before each
+    //:   insertion, record the list of elements, and after it verify that
+    //:   the list holds the same elements in the same order, plus the new
+    //:   one, verify the buckets, and verify the number of buckets after each
+    //:   growth, and that an insertion growing the array deallocates only
+    //:   the previous array, and allocates at most the storage of its
+    //:   element and the array of buckets of the next growth.  Verify the
+    //:   contents and order of the hash-table with a helper function that
+    //:   walks the list of elements and calls 'find' for each key.  (C-3..6)
+    //:
+    //: 4 Alternate removals and insertions, verifying the buckets after each
+    //:   operation, across several growths.  (C-7)
+    //:
+    //: 5 Call 'completeRehash' and 'setIncrementalRehashEnabled(false)' on
+    //:   hash-tables with a rehash in progress, and verify the list and the
+    //:   buckets.  (C-8)
+    //:
+    //: 6 Apply each operation in C-9 to a hash-table with a rehash in
+    //:   progress, verify the resulting hash-tables, and verify that no
+    //:   memory is leaked.  (C-9)
+    //:
+    //: 7 Use a hasher that throws after a configurable number of calls, and
+    //:   verify that, after the exception, the elements of the hash-table are
+    //:   all found.  (C-10)
+    //
+    // Testing:
+    //   completeRehash();
+    //   setIncrementalRehashEnabled(bool value);
+    //   isIncrementalRehashEnabled() const;
+    //   isRehashInProgress() const;
+    // --------------------------------------------------------------------
+{
+    typedef bsl::pair<int, int>                              Value;
+    typedef bslalg::BidirectionalNode<Value>                 Node;
+    typedef bslstl::HashTable<IncrementalRehashConfig,
+                              bsl::hash<int>,
+                              bsl::equal_to<int>,
+                              bsl::allocator<Value> >        Obj;
+
+    const int NUM_KEYS    = 300;
+    const int NUM_PER_KEY = 3;
+    const int MAX_LINKS   = 4 * NUM_KEYS * NUM_PER_KEY;
+
+    static bslalg::BidirectionalLink *links[MAX_LINKS];
+
+    if (verbose) printf("\nTesting the attribute"
+                        "\n---------------------\n");
+    {
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mX(bsl::hash<int>(), bsl::equal_to<int>(), 0, 1.0f, &oa);
+        const Obj& X = mX;
+
+        ASSERT(false == X.isIncrementalRehashEnabled());
+        ASSERT(false == X.isRehashInProgress());
+
+        mX.setIncrementalRehashEnabled(true);
+        ASSERT(true  == X.isIncrementalRehashEnabled());
+        ASSERT(false == X.isRehashInProgress());
+
+        mX.setIncrementalRehashEnabled(false);
+        ASSERT(false == X.isIncrementalRehashEnabled());
+
+        // Without incremental rehashing, no growth leaves a rehash in
+        // progress.
+
+        for (int i = 0; i != NUM_KEYS; ++i) {
+            mX.insert(Value(i * 7, 0));
+            ASSERTV(i, false == X.isRehashInProgress());
+        }
+        ASSERT(verifyIncrementalRehashBuckets(X));
+
+        // Enabling incremental rehashing re-indexes the elements into split
+        // order.
+
+        const size_t NUM_BUCKETS = X.numBuckets();
+
+        mX.setIncrementalRehashEnabled(true);
+        ASSERT(true == X.isIncrementalRehashEnabled());
+        ASSERT(NUM_BUCKETS == X.numBuckets());
+        ASSERT(NUM_KEYS == static_cast<int>(X.size()));
+        ASSERT(verifyIncrementalRehashBuckets(X));
+    }
+
+    if (verbose) printf("\nTesting insertion during a rehash"
+                        "\n---------------------------------\n");
+    {
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mX(bsl::hash<int>(), bsl::equal_to<int>(), 0, 1.0f, &oa);
+        const Obj& X = mX;
+        mX.setIncrementalRehashEnabled(true);
+
+        int numGrowths = 0;
+        int numGrowthsInProgress = 0;
+        for (int j = 0; j != NUM_PER_KEY; ++j) {
+            for (int i = 0; i != NUM_KEYS; ++i) {
+                const size_t numBuckets = X.numBuckets();
+                const bool   inProgress = X.isRehashInProgress();
+                const int    numLinks   = recordIncrementalRehashList(
+                                                                 links,
+                                                                 MAX_LINKS,
+                                                                 X);
+
+                const bsls::Types::Int64 NUM_ALLOCS   = oa.numAllocations();
+                const bsls::Types::Int64 NUM_DEALLOCS = oa.numDeallocations();
+
+                bslalg::BidirectionalLink *newLink = mX.insert(Value(i, j));
+
+                ASSERTV(i, j, verifyIncrementalRehashList(links,
+                                                          numLinks,
+                                                          newLink,
+                                                          X));
+                ASSERTV(i, j, verifyIncrementalRehashBuckets(X));
+
+                if (X.numBuckets() != numBuckets) {
+                    ++numGrowths;
+                    if (inProgress) {
+                        ++numGrowthsInProgress;
+                    }
+                    if (1 < numBuckets) {
+                        ASSERTV(i, j, numBuckets, X.numBuckets(),
+                                2 * numBuckets == X.numBuckets());
+                        ASSERTV(i, j, X.isRehashInProgress());
+                        ASSERTV(i, j, NUM_ALLOCS, oa.numAllocations(),
+                                NUM_ALLOCS + 2 >= oa.numAllocations());
+                        ASSERTV(i, j, NUM_DEALLOCS, oa.numDeallocations(),
+                                NUM_DEALLOCS + 1 == oa.numDeallocations());
+                    }
+                }
+                if (0 == j) {
+                    ASSERTV(i, verifyIncrementalRehashGroups(X, i + 1, 1));
+                }
+            }
+            ASSERTV(j, verifyIncrementalRehashGroups(X, NUM_KEYS, j + 1));
+        }
+        ASSERTV(numGrowths, 3 < numGrowths);
+        ASSERTV(numGrowthsInProgress, 0 == numGrowthsInProgress);
+
+        // Removals preserve the order of the remaining elements, and keep the
+        // split points for the following growths up to date.
+
+        int key = NUM_KEYS;
+        for (int i = 0; i != 2 * NUM_KEYS; ++i) {
+            if (i % 3) {
+                mX.remove(X.find(i % NUM_KEYS));
+                mX.insert(Value(i % NUM_KEYS, NUM_PER_KEY + i));
+            }
+            else {
+                for (int j = 0; j != NUM_PER_KEY; ++j) {
+                    mX.insert(Value(key, j));
+                }
+                ++key;
+            }
+            ASSERTV(i, verifyIncrementalRehashBuckets(X));
+        }
+        ASSERT(verifyIncrementalRehashGroups(X, key, NUM_PER_KEY));
+        ASSERT(verifyIncrementalRehashBuckets(X));
+    }
+
+    if (verbose) printf("\nTesting operations during a rehash"
+                        "\n----------------------------------\n");
+    for (int op = 0; op != 9; ++op) {
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator sa("other",   veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        Obj mX(bsl::hash<int>(), bsl::equal_to<int>(), 0, 1.0f, &oa);
+        const Obj& X = mX;
+        mX.setIncrementalRehashEnabled(true);
+
+        // Fill, then grow, so that a rehash is in progress.
+
+        int numKeys = 0;
+        for (int j = 0; j != NUM_PER_KEY; ++j) {
+            for (int i = 0; i != NUM_KEYS; ++i) {
+                mX.insert(Value(i, j));
+            }
+        }
+        numKeys = NUM_KEYS;
+        while (!X.isRehashInProgress()) {
+            for (int j = 0; j != NUM_PER_KEY; ++j) {
+                mX.insert(Value(numKeys, j));
+            }
+            ++numKeys;
+        }
+        ASSERTV(op, verifyIncrementalRehashGroups(X, numKeys, NUM_PER_KEY));
+        ASSERTV(op, verifyIncrementalRehashBuckets(X));
+
+        switch (op) {
+          case 0: {
+            const size_t NUM_BUCKETS = X.numBuckets();
+            const int    NUM_LINKS   = recordIncrementalRehashList(links,
+                                                                   MAX_LINKS,
+                                                                   X);
+
+            mX.completeRehash();
+            ASSERTV(op, !X.isRehashInProgress());
+            ASSERTV(op, X.isIncrementalRehashEnabled());
+            ASSERTV(op, NUM_BUCKETS == X.numBuckets());
+            ASSERTV(op, verifyIncrementalRehashList(links,
+                                                    NUM_LINKS - 1,
+                                                    links[NUM_LINKS - 1],
+                                                    X));
+            ASSERTV(op, verifyIncrementalRehashBuckets(X));
+          } break;
+          case 1: {
+            const size_t NUM_BUCKETS = X.numBuckets();
+            const int    NUM_LINKS   = recordIncrementalRehashList(links,
+                                                                   MAX_LINKS,
+                                                                   X);
+
+            mX.setIncrementalRehashEnabled(false);
+            ASSERTV(op, !X.isRehashInProgress());
+            ASSERTV(op, NUM_BUCKETS == X.numBuckets());
+            ASSERTV(op, verifyIncrementalRehashList(links,
+                                                    NUM_LINKS - 1,
+                                                    links[NUM_LINKS - 1],
+                                                    X));
+            ASSERTV(op, verifyIncrementalRehashBuckets(X));
+          } break;
+          case 2: {
+            // Remove the middle element of every key, then the first.
+
+            for (int i = 0; i != numKeys; ++i) {
+                mX.remove(X.find(i)->nextLink());
+                ASSERTV(op, i, verifyIncrementalRehashBuckets(X));
+            }
+            for (int i = 0; i != numKeys; ++i) {
+                mX.remove(X.find(i));
+            }
+            ASSERTV(op, verifyIncrementalRehashGroups(X, numKeys, 1));
+            ASSERTV(op, verifyIncrementalRehashBuckets(X));
+
+            // Grow twice more.
+
+            const size_t NUM_BUCKETS = X.numBuckets();
+            for (int i = numKeys; X.numBuckets() < 4 * NUM_BUCKETS; ++i) {
+                mX.insert(Value(i, 0));
+            }
+            ASSERTV(op, verifyIncrementalRehashBuckets(X));
+          } break;
+          case 3: {
+            Obj mY(X, &sa);  const Obj& Y = mY;
+            ASSERTV(op, X == Y);
+            ASSERTV(op, Y.isIncrementalRehashEnabled());
+            ASSERTV(op, verifyIncrementalRehashBuckets(Y));
+          } break;
+          case 4: {
+            Obj mY(bslmf::MovableRefUtil::move(mX));  const Obj& Y = mY;
+            ASSERTV(op, Y.isRehashInProgress());
+            ASSERTV(op, verifyIncrementalRehashGroups(Y,
+                                                      numKeys,
+                                                      NUM_PER_KEY));
+            mY.completeRehash();
+            ASSERTV(op, verifyIncrementalRehashBuckets(Y));
+          } break;
+          case 5: {
+            Obj mY(bslmf::MovableRefUtil::move(mX), &sa);
+            const Obj& Y = mY;
+            ASSERTV(op, Y.isIncrementalRehashEnabled());
+            ASSERTV(op, verifyIncrementalRehashGroups(Y,
+                                                      numKeys,
+                                                      NUM_PER_KEY));
+            ASSERTV(op, verifyIncrementalRehashBuckets(Y));
+          } break;
+          case 6: {
+            Obj mY(bsl::hash<int>(), bsl::equal_to<int>(), 0, 1.0f, &oa);
+            const Obj& Y = mY;
+            mY.insert(Value(0, 0));
+
+            mX.swap(mY);
+            ASSERTV(op, !X.isRehashInProgress());
+            ASSERTV(op,  Y.isRehashInProgress());
+            ASSERTV(op, verifyIncrementalRehashGroups(X, 1, 1));
+            ASSERTV(op, verifyIncrementalRehashGroups(Y,
+                                                      numKeys,
+                                                      NUM_PER_KEY));
+            mY.insert(Value(numKeys, 0));
+            ASSERTV(op, 0 != Y.find(numKeys));
+            ASSERTV(op, verifyIncrementalRehashBuckets(Y));
+          } break;
+          case 7: {
+            mX.removeAll();
+            ASSERTV(op, !X.isRehashInProgress());
+            ASSERTV(op, 0 == X.size());
+            for (int i = 0; i != NUM_KEYS; ++i) {
+                mX.insert(Value(i, 0));
+            }
+            ASSERTV(op, verifyIncrementalRehashGroups(X, NUM_KEYS, 1));
+            ASSERTV(op, verifyIncrementalRehashBuckets(X));
+          } break;
+          case 8: {
+            // The split points of a new array of buckets remain to be
+            // computed.
+
+            mX.rehashForNumBuckets(X.numBuckets() * 2);
+            ASSERTV(op, X.isRehashInProgress());
+            ASSERTV(op, verifyIncrementalRehashGroups(X,
+                                                      numKeys,
+                                                      NUM_PER_KEY));
+            ASSERTV(op, verifyIncrementalRehashBuckets(X));
+          } break;
+          default: {
+            ASSERTV(op, !"Bad operation");
+          }
+        }
+        ASSERTV(op, da.numBlocksInUse(), 0 == da.numBlocksInUse());
+    }
+
+#if defined(BDE_BUILD_TARGET_EXC)
+    if (verbose) printf("\nTesting exceptions thrown by the hasher"
+                        "\n---------------------------------------\n");
+    {
+        typedef bslstl::HashTable<IncrementalRehashConfig,
+                                  ThrowingHashFunctor<int>,
+                                  bsl::equal_to<int>,
+                                  bsl::allocator<Value> > ThrowingObj;
+
+        for (size_t interval = 2; interval < 40; interval += 3) {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            ThrowingHashFunctor<int> throwing;
+            throwing.setThrowInterval(interval);
+
+            ThrowingObj mZ(throwing, bsl::equal_to<int>(), 0, 1.0f, &oa);
+            const ThrowingObj& Z = mZ;
+            mZ.setIncrementalRehashEnabled(true);
+
+            int numInserted = 0;
+            int numThrows   = 0;
+            for (int i = 0; i != NUM_KEYS; ++i) {
+                try {
+                    mZ.insert(Value(i, 0));
+                    ++numInserted;
+                }
+                catch (const TestException&) {
+                    ++numThrows;
+                }
+                ASSERTV(interval, i, Z.size() == size_t(numInserted));
+            }
+            ASSERTV(interval, 0 < numThrows);
+
+            int numFound = 0;
+            for (bslalg::BidirectionalLink *cursor = Z.elementListRoot();
+                 cursor;
+                 cursor = cursor->nextLink()) {
+                const int key = static_cast<Node *>(cursor)->value().first;
+
+                bslalg::BidirectionalLink *found = 0;
+                for (int attempt = 0; !found && attempt != 2; ++attempt) {
+                    try {
+                        found = Z.find(key);
+                    }
+                    catch (const TestException&) {
+                    }
+                }
+                ASSERTV(interval, key, cursor == found);
+                ++numFound;
+            }
+            ASSERTV(interval, numFound, numInserted, numFound == numInserted);
+        }
+    }
+#endif
+}
+
 #if 0  // Planned test cases, not yet implemented
 static
 void mainTestCase16()
@@ -4141,6 +4722,7 @@ int main(int argc, char *argv[])
 // BDE_VERIFY pragma: -TP05 // Test doc is in delegated functions
 // BDE_VERIFY pragma: -TP17 // No test-banners in a delegating switch statement
     switch (test) { case 0:
+      case 17: { mainTestCase17(); } break;
       case 16: { mainTestCase16(); } break;
       case 15: { mainTestCase15(); } break;
       case 14: { mainTestCase14(); } break;
@@ -204,6 +204,8 @@ BSLS_IDENT("$Id: $")
 //  'distance(ai1,ai2)' - number of elements in the range '[ai1 .. ai2)'
 //  'distance({*})'     - number of elements in the initializer list
 //  'z'                 - floating point value representing a load factor
+//  'ri', 'ki', 'c'     - array of 'c' iterators of 'a', and array of 'c'
+//                        objects of type 'K'
 //
 //  +----------------------------------------------------+--------------------+
 //  | Operation                                          | Complexity         |
@@ -319,6 +321,9 @@ BSLS_IDENT("$Id: $")
 //  | a.find(k)                                          | Average: O[1]      |
 //  |                                                    | Worst:   O[n]      |
 //  +----------------------------------------------------+--------------------+
+//  | a.findMany(ri, ki, c)                              | Average: O[c]      |
+//  |                                                    | Worst:   O[n * c]  |
+//  +----------------------------------------------------+--------------------+
 //  | a.count(k)                                         | Average: O[1]      |
 //  |                                                    | Worst:   O[n]      |
 //  +----------------------------------------------------+--------------------+
@@ -345,6 +350,12 @@ BSLS_IDENT("$Id: $")
 //  | a.reserve(k)                                       | Average: O[n]      |
 //  |                                                    | Worst:   O[n^2]    |
 //  +----------------------------------------------------+--------------------+
+//  | a.setIncrementalRehashEnabled(bool)                | O[1] if disabling  |
+//  |                                                    |   or 'a' is empty, |
+//  |                                                    |   otherwise O[n]   |
+//  +----------------------------------------------------+--------------------+
+//  | a.completeRehash()                                 | O[n]               |
+//  +----------------------------------------------------+--------------------+
 //..
 //
 ///Iterator, Pointer, and Reference Invalidation
@@ -361,6 +372,20 @@ BSLS_IDENT("$Id: $")
 // iterator is not an iterator referring to any element in the container, it
 // may be invalidated by any non-'const' method.
 //
+// If incremental rehashing is enabled (see 'setIncrementalRehashEnabled'), an
+// insertion growing the array of buckets does not redistribute the elements,
+// and so does not invalidate iterators.  Instead, the elements of each bucket
+// are kept ordered so that doubling the number of buckets only splits each
+// bucket in two, and the insertions made before the array grows split a few
+// buckets each into the next, twice larger, array of buckets, which the
+// growing insertion then adopts in constant time.  This bounds the time taken
+// by any one insertion, at the cost of each insertion computing the hash
+// codes of the elements of a few buckets, and of the next array of buckets
+// being held, in addition to the current one, between two growths.  Note
+// that the number of buckets is then a prime number times a power of two, so
+// that a hash functor whose low-order bits are poorly distributed causes more
+// collisions than otherwise.
+//
 ///Unordered Map Configuration
 ///---------------------------
 // The unordered map has interfaces that can provide insight into and control
@@ -1465,6 +1490,21 @@ class unordered_map {
         // 'key', if such an entry exists, and the past-the-end iterator
         // ('end') otherwise.
 
+    void findMany(iterator       *results,
+                  const key_type *keys,
+                  size_type       numKeys);
+        // Load into each of the specified 'numKeys' elements of the specified
+        // 'results' array an iterator providing modifiable access to the
+        // 'value_type' object in this unordered map with a key equivalent to
+        // the corresponding element of the specified 'keys' array, if such an
+        // entry exists, and the past-the-end iterator ('end') otherwise.  The
+        // behavior is undefined unless 'results' and 'keys' each have at least
+        // 'numKeys' elements.  Note that the result is the same as invoking
+        // 'find' for each key, but the memory accesses of several lookups are
+        // overlapped, which is typically faster for unordered maps that do
+        // not fit in cache.  Also note that this method is an extension to
+        // the C++ standard.
+
     pair<iterator, bool> insert(const value_type& value);
         // Insert the specified 'value' into this unordered map if the key (the
         // 'first' element) of the object referred to by 'value' does not
@@ -1674,6 +1714,29 @@ class unordered_map {
         // numElements'.  Also note that this operation has no effect if
         // 'numElements <= size()'.
 
+    void completeRehash();
+        // Split each bucket of this unordered map into the array of buckets
+        // adopted when its array of buckets next grows, if an incremental
+        // rehash is in progress (see 'setIncrementalRehashEnabled'), so that
+        // this growth takes constant time.  Note that this method is an
+        // extension to the C++ standard.
+
+    void setIncrementalRehashEnabled(bool value);
+        // Set whether an insertion causing this unordered map to grow its
+        // array of buckets redistributes the elements into the new array
+        // incrementally to the specified 'value'.  If 'value' is 'true', such
+        // an insertion exactly doubles the number of buckets in constant time
+        // by adopting an array of buckets built by the preceding insertions,
+        // each of which splits a bounded number of buckets into that array;
+        // otherwise, such an insertion redistributes every element before
+        // returning.  Incremental rehashing is disabled by default.  Enabling
+        // it on a non-empty unordered map redistributes every element, which,
+        // like 'rehash', invalidates iterators (but not pointers or references
+        // to elements).  While it is enabled, no insertion invalidates
+        // iterators, and the methods taking a bucket index ('begin(index)',
+        // 'end(index)', and 'bucket_size') may be called at any time.  Note
+        // that this method is an extension to the C++ standard.
+
     void swap(unordered_map& other) BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false);
         // Exchange the value of this object as well as its hasher,
         // key-equality functor, and 'max_load_factor' with those of the
@@ -1835,6 +1898,21 @@ class unordered_map {
         // the specified 'key', if such an entry exists, and the past-the-end
         // iterator ('end') otherwise.
 
+    void findMany(const_iterator *results,
+                  const key_type *keys,
+                  size_type       numKeys) const;
+        // Load into each of the specified 'numKeys' elements of the specified
+        // 'results' array an iterator providing non-modifiable access to the
+        // 'value_type' object in this unordered map with a key equivalent to
+        // the corresponding element of the specified 'keys' array, if such an
+        // entry exists, and the past-the-end iterator ('end') otherwise.  The
+        // behavior is undefined unless 'results' and 'keys' each have at least
+        // 'numKeys' elements.  Note that the result is the same as invoking
+        // 'find' for each key, but the memory accesses of several lookups are
+        // overlapped, which is typically faster for unordered maps that do
+        // not fit in cache.  Also note that this method is an extension to
+        // the C++ standard.
+
     allocator_type get_allocator() const BSLS_KEYWORD_NOEXCEPT;
         // Return (a copy of) the allocator used for memory allocation by this
         // unordered map.
@@ -1856,6 +1934,18 @@ class unordered_map {
         // an increased number of collisions, thus resulting in a loss of
         // performance.
 
+    bool isIncrementalRehashEnabled() const;
+        // Return 'true' if an insertion causing this unordered map to grow its
+        // array of buckets redistributes the elements incrementally, and
+        // 'false' otherwise (see 'setIncrementalRehashEnabled').  Note that
+        // this method is an extension to the C++ standard.
+
+    bool isRehashInProgress() const;
+        // Return 'true' if some buckets of this unordered map remain to be
+        // split by an incremental rehash before its array of buckets next
+        // grows, and 'false' otherwise (see 'setIncrementalRehashEnabled').
+        // Note that this method is an extension to the C++ standard.
+
     float max_load_factor() const BSLS_KEYWORD_NOEXCEPT;
         // Return the maximum load factor allowed for this unordered map.  Note
         // that if an insert operation would cause the load factor to exceed
@@ -2389,6 +2479,16 @@ unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::find(const key_type& key)
     return iterator(d_impl.find(key));
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::findMany(
+                                                     iterator       *results,
+                                                     const key_type *keys,
+                                                     size_type       numKeys)
+{
+    d_impl.findMany(results, keys, numKeys);
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
 inline
 pair<typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator,
@@ -2491,6 +2591,23 @@ unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::reserve(
     d_impl.reserveForNumElements(numElements);
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::completeRehash()
+{
+    d_impl.completeRehash();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::
+setIncrementalRehashEnabled(bool value)
+{
+    d_impl.setIncrementalRehashEnabled(value);
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
 inline
 void
@@ -2684,6 +2801,16 @@ unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::find(
     return const_iterator(d_impl.find(key));
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::findMany(
+                                               const_iterator *results,
+                                               const key_type *keys,
+                                               size_type       numKeys) const
+{
+    d_impl.findMany(results, keys, numKeys);
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
 inline
 ALLOCATOR
@@ -2716,6 +2843,24 @@ unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::load_factor() const
     return d_impl.loadFactor();
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+bool
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::
+isIncrementalRehashEnabled() const
+{
+    return d_impl.isIncrementalRehashEnabled();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+bool
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::
+isRehashInProgress() const
+{
+    return d_impl.isRehashInProgress();
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
 inline
 float
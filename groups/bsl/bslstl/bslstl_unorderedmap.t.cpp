@@ -179,6 +179,8 @@ using bsl::pair;
 // [13] pair<const_iter, const_iter> equal_range(const KEY&) const;
 // [ 4] iterator find(const KEY& key);
 // [ 4] const_iterator find(const KEY& key) const;
+// [41] void findMany(iterator *, const KEY *, size_type);
+// [41] void findMany(const_iterator *, const KEY *, size_type) const;
 //
 // non-local iterators:
 // [14] iterator begin();
@@ -218,6 +220,10 @@ using bsl::pair;
 // [35] float max_load_factor() const;
 // [35] void rehash(size_type);
 // [35] void reserve(size_type);
+// [42] void completeRehash();
+// [42] void setIncrementalRehashEnabled(bool);
+// [42] bool isIncrementalRehashEnabled() const;
+// [42] bool isRehashInProgress() const;
 //
 // functor access:
 // [ 2] HASH hash_function() const;
@@ -225,7 +231,7 @@ using bsl::pair;
 //
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [40] USAGE EXAMPLE
+// [43] USAGE EXAMPLE
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
 // [ 3] int  ggg(Obj *, const char *, bool verbose = true);
@@ -10436,7 +10442,7 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:
-      case 40: {
+      case 43: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -10456,6 +10462,9 @@ int main(int argc, char *argv[])
                             "\n=============\n");
         usage();
       } break;
+      case 42: // falls through
+      case 41: // falls through
+      case 40: // falls through
       case 39: // falls through
       case 38: // falls through
       case 37: // falls through
@@ -795,6 +795,21 @@ class unordered_map {
         // 'key', if such an entry exists, and the past-the-end iterator
         // ('end') otherwise.
 
+    void findMany(iterator       *results,
+                  const key_type *keys,
+                  size_type       numKeys);
+        // Load into each of the specified 'numKeys' elements of the specified
+        // 'results' array an iterator providing modifiable access to the
+        // 'value_type' object in this unordered map with a key equivalent to
+        // the corresponding element of the specified 'keys' array, if such an
+        // entry exists, and the past-the-end iterator ('end') otherwise.  The
+        // behavior is undefined unless 'results' and 'keys' each have at least
+        // 'numKeys' elements.  Note that the result is the same as invoking
+        // 'find' for each key, but the memory accesses of several lookups are
+        // overlapped, which is typically faster for unordered maps that do
+        // not fit in cache.  Also note that this method is an extension to
+        // the C++ standard.
+
     pair<iterator, bool> insert(const value_type& value);
         // Insert the specified 'value' into this unordered map if the key (the
         // 'first' element) of the object referred to by 'value' does not
@@ -1004,6 +1019,29 @@ class unordered_map {
         // numElements'.  Also note that this operation has no effect if
         // 'numElements <= size()'.
 
+    void completeRehash();
+        // Split each bucket of this unordered map into the array of buckets
+        // adopted when its array of buckets next grows, if an incremental
+        // rehash is in progress (see 'setIncrementalRehashEnabled'), so that
+        // this growth takes constant time.  Note that this method is an
+        // extension to the C++ standard.
+
+    void setIncrementalRehashEnabled(bool value);
+        // Set whether an insertion causing this unordered map to grow its
+        // array of buckets redistributes the elements into the new array
+        // incrementally to the specified 'value'.  If 'value' is 'true', such
+        // an insertion exactly doubles the number of buckets in constant time
+        // by adopting an array of buckets built by the preceding insertions,
+        // each of which splits a bounded number of buckets into that array;
+        // otherwise, such an insertion redistributes every element before
+        // returning.  Incremental rehashing is disabled by default.  Enabling
+        // it on a non-empty unordered map redistributes every element, which,
+        // like 'rehash', invalidates iterators (but not pointers or references
+        // to elements).  While it is enabled, no insertion invalidates
+        // iterators, and the methods taking a bucket index ('begin(index)',
+        // 'end(index)', and 'bucket_size') may be called at any time.  Note
+        // that this method is an extension to the C++ standard.
+
     void swap(unordered_map& other) BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false);
         // Exchange the value of this object as well as its hasher,
         // key-equality functor, and 'max_load_factor' with those of the
@@ -1165,6 +1203,21 @@ class unordered_map {
         // the specified 'key', if such an entry exists, and the past-the-end
         // iterator ('end') otherwise.
 
+    void findMany(const_iterator *results,
+                  const key_type *keys,
+                  size_type       numKeys) const;
+        // Load into each of the specified 'numKeys' elements of the specified
+        // 'results' array an iterator providing non-modifiable access to the
+        // 'value_type' object in this unordered map with a key equivalent to
+        // the corresponding element of the specified 'keys' array, if such an
+        // entry exists, and the past-the-end iterator ('end') otherwise.  The
+        // behavior is undefined unless 'results' and 'keys' each have at least
+        // 'numKeys' elements.  Note that the result is the same as invoking
+        // 'find' for each key, but the memory accesses of several lookups are
+        // overlapped, which is typically faster for unordered maps that do
+        // not fit in cache.  Also note that this method is an extension to
+        // the C++ standard.
+
     allocator_type get_allocator() const BSLS_KEYWORD_NOEXCEPT;
         // Return (a copy of) the allocator used for memory allocation by this
         // unordered map.
@@ -1186,6 +1239,18 @@ class unordered_map {
         // an increased number of collisions, thus resulting in a loss of
         // performance.
 
+    bool isIncrementalRehashEnabled() const;
+        // Return 'true' if an insertion causing this unordered map to grow its
+        // array of buckets redistributes the elements incrementally, and
+        // 'false' otherwise (see 'setIncrementalRehashEnabled').  Note that
+        // this method is an extension to the C++ standard.
+
+    bool isRehashInProgress() const;
+        // Return 'true' if some buckets of this unordered map remain to be
+        // split by an incremental rehash before its array of buckets next
+        // grows, and 'false' otherwise (see 'setIncrementalRehashEnabled').
+        // Note that this method is an extension to the C++ standard.
+
     float max_load_factor() const BSLS_KEYWORD_NOEXCEPT;
         // Return the maximum load factor allowed for this unordered map.  Note
         // that if an insert operation would cause the load factor to exceed
@@ -2432,6 +2497,16 @@ unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::find(const key_type& key)
     return iterator(d_impl.find(key));
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::findMany(
+                                                     iterator       *results,
+                                                     const key_type *keys,
+                                                     size_type       numKeys)
+{
+    d_impl.findMany(results, keys, numKeys);
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
 inline
 pair<typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator,
@@ -2534,6 +2609,23 @@ unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::reserve(
     d_impl.reserveForNumElements(numElements);
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::completeRehash()
+{
+    d_impl.completeRehash();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::
+setIncrementalRehashEnabled(bool value)
+{
+    d_impl.setIncrementalRehashEnabled(value);
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
 inline
 void
@@ -2727,6 +2819,16 @@ unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::find(
     return const_iterator(d_impl.find(key));
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::findMany(
+                                               const_iterator *results,
+                                               const key_type *keys,
+                                               size_type       numKeys) const
+{
+    d_impl.findMany(results, keys, numKeys);
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
 inline
 ALLOCATOR
@@ -2759,6 +2861,24 @@ unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::load_factor() const
     return d_impl.loadFactor();
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+bool
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::
+isIncrementalRehashEnabled() const
+{
+    return d_impl.isIncrementalRehashEnabled();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+bool
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::
+isRehashInProgress() const
+{
+    return d_impl.isRehashInProgress();
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
 inline
 float
@@ -181,6 +181,8 @@ using bsl::pair;
 // [13] pair<const_iter, const_iter> equal_range(const KEY&) const;
 // [ 4] iterator find(const KEY& key);
 // [ 4] const_iterator find(const KEY& key) const;
+// [41] void findMany(iterator *, const KEY *, size_type);
+// [41] void findMany(const_iterator *, const KEY *, size_type) const;
 //
 // non-local iterators:
 // [14] iterator begin();
@@ -220,6 +222,10 @@ using bsl::pair;
 // [35] float max_load_factor() const;
 // [35] void rehash(size_type);
 // [35] void reserve(size_type);
+// [42] void completeRehash();
+// [42] void setIncrementalRehashEnabled(bool);
+// [42] bool isIncrementalRehashEnabled() const;
+// [42] bool isRehashInProgress() const;
 //
 // functor access:
 // [ 2] HASH hash_function() const;
@@ -8291,6 +8297,289 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:
+      case 42: {
+        // --------------------------------------------------------------------
+        // TESTING INCREMENTAL REHASH
+        //
+        // Concerns:
+        //: 1 Incremental rehashing is disabled by default, and
+        //:   'setIncrementalRehashEnabled' sets the value reported by
+        //:   'isIncrementalRehashEnabled'.
+        //:
+        //: 2 With incremental rehashing enabled, growth of the map leaves a
+        //:   rehash in progress, during which every element is found by
+        //:   'find', 'count', and 'operator[]'.
+        //:
+        //: 3 No insertion, including one growing the map, invalidates
+        //:   iterators or changes the order of iteration of the elements
+        //:   already in the map.
+        //:
+        //: 4 The bucket interface is consistent with 'find' at all times.
+        //:
+        //: 5 'erase' during a rehash in progress returns the iterator to the
+        //:   element following the erased element.
+        //:
+        //: 6 'completeRehash', and disabling incremental rehashing, end the
+        //:   rehash in progress.
+        //
+        // Plan:
+        //: 1 Verify the default value of the attribute, then set and verify
+        //:   each value.  (C-1)
+        //:
+        //: 2 Insert a range of keys into a map with incremental rehashing
+        //:   enabled.  Before each insertion, record the keys in iteration
+        //:   order and an iterator to the first element, and after it verify
+        //:   that iterating from that iterator visits the recorded keys in
+        //:   order, skipping the new key.  After each growth, verify that a
+        //:   rehash is in progress, that every key inserted so far is found,
+        //:   and that each key lies in the bucket reported by 'bucket', which
+        //:   counts as many elements as 'bucket_size' reports.  (C-2..4)
+        //:
+        //: 3 Erase every third element of a map with a rehash in progress,
+        //:   comparing the iterator returned against the iterator following
+        //:   the erased element, saved before the erasure.  (C-5)
+        //:
+        //: 4 End the rehash in progress with each method, and verify the
+        //:   bucket interface again.  (C-4, 6)
+        //
+        // Testing:
+        //   void completeRehash();
+        //   void setIncrementalRehashEnabled(bool);
+        //   bool isIncrementalRehashEnabled() const;
+        //   bool isRehashInProgress() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING INCREMENTAL REHASH"
+                            "\n==========================\n");
+
+        typedef bsl::unordered_map<int, int> Obj;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        const int N = 1000;
+
+        int keys[N];
+
+        for (int ti = 0; ti < 2; ++ti) {
+            const bool COMPLETE = 0 == ti;
+
+            if (veryVerbose) { T_ P(COMPLETE) }
+
+            Obj mX(&oa);  const Obj& X = mX;
+
+            ASSERTV(ti, false == X.isIncrementalRehashEnabled());
+            ASSERTV(ti, false == X.isRehashInProgress());
+
+            mX.setIncrementalRehashEnabled(true);
+            ASSERTV(ti, true  == X.isIncrementalRehashEnabled());
+
+            int numGrowths = 0;
+            for (int i = 0; i < N; ++i) {
+                const Obj::size_type NUM_BUCKETS = X.bucket_count();
+                const Obj::iterator  FIRST       = mX.begin();
+
+                int numKeys = 0;
+                for (Obj::const_iterator it = X.begin(); it != X.end(); ++it) {
+                    keys[numKeys++] = it->first;
+                }
+
+                mX[i] = i;
+
+                int index = 0;
+                for (Obj::iterator it = FIRST; it != mX.end(); ++it) {
+                    if (i == it->first) {
+                        continue;
+                    }
+                    ASSERTV(ti, i, index, index < numKeys);
+                    if (index < numKeys) {
+                        ASSERTV(ti, i, index, keys[index] == it->first);
+                    }
+                    ++index;
+                }
+                ASSERTV(ti, i, index, numKeys, index == numKeys);
+
+                if (X.bucket_count() == NUM_BUCKETS || 1 == NUM_BUCKETS) {
+                    continue;
+                }
+                ++numGrowths;
+
+                ASSERTV(ti, i, X.isRehashInProgress());
+                ASSERTV(ti, i, 2 * NUM_BUCKETS == X.bucket_count());
+
+                for (int j = 0; j <= i; ++j) {
+                    ASSERTV(ti, i, j, X.end() != X.find(j));
+                    ASSERTV(ti, i, j, 1 == X.count(j));
+                    ASSERTV(ti, i, j, j == mX[j]);
+                }
+                ASSERTV(ti, i, static_cast<Obj::size_type>(i + 1) == X.size());
+
+                Obj::size_type total = 0;
+                for (Obj::size_type b = 0; b < X.bucket_count(); ++b) {
+                    Obj::size_type count = 0;
+                    for (Obj::const_local_iterator it = X.begin(b);
+                         it != X.end(b);
+                         ++it, ++count) {
+                        ASSERTV(ti, b, it->first, b == X.bucket(it->first));
+                    }
+                    ASSERTV(ti, b, count, count == X.bucket_size(b));
+                    total += count;
+                }
+                ASSERTV(ti, total, X.size(), X.size() == total);
+            }
+            ASSERTV(ti, numGrowths, 0 < numGrowths);
+
+            while (!X.isRehashInProgress()) {
+                mX[static_cast<int>(X.size())] = 0;
+            }
+
+            int index = 0;
+            for (Obj::iterator it = mX.begin(); it != mX.end(); ++index) {
+                if (0 == index % 3) {
+                    Obj::iterator next = it;
+                    ++next;
+                    it = mX.erase(it);
+                    ASSERTV(ti, index, next == it);
+                }
+                else {
+                    ++it;
+                }
+            }
+            ASSERTV(ti, X.isRehashInProgress());
+
+            if (COMPLETE) {
+                mX.completeRehash();
+                ASSERTV(ti, X.isIncrementalRehashEnabled());
+            }
+            else {
+                mX.setIncrementalRehashEnabled(false);
+                ASSERTV(ti, !X.isIncrementalRehashEnabled());
+            }
+            ASSERTV(ti, !X.isRehashInProgress());
+
+            Obj::size_type total = 0;
+            for (Obj::size_type b = 0; b < X.bucket_count(); ++b) {
+                total += X.bucket_size(b);
+                for (Obj::const_local_iterator it = X.begin(b);
+                     it != X.end(b);
+                     ++it) {
+                    ASSERTV(ti, b, it->first, b == X.bucket(it->first));
+                    ASSERTV(ti, b, it->first, X.find(it->first)->first
+                                                                == it->first);
+                }
+            }
+            ASSERTV(ti, total, X.size(), X.size() == total);
+        }
+      } break;
+      case 41: {
+        // --------------------------------------------------------------------
+        // TESTING 'findMany'
+        //
+        // Concerns:
+        //: 1 Each element of the results of 'findMany' is the iterator that
+        //:   'find' returns for the corresponding key, for keys both present
+        //:   and absent.
+        //:
+        //: 2 'findMany' modifies exactly 'numKeys' elements of the results.
+        //:
+        //: 3 'findMany' is correct for batches of any length, including 0 and
+        //:   lengths that are not multiples of the internal batch size.
+        //:
+        //: 4 'findMany' is correct for empty maps.
+        //:
+        //: 5 The modifiable overload provides modifiable access to the found
+        //:   elements.
+        //:
+        //: 6 'findMany' allocates no memory.
+        //
+        // Plan:
+        //: 1 For maps of varying sizes, populated with the even keys, look up
+        //:   batches of varying lengths of the keys from -1 up to and
+        //:   including twice the size of the map with both overloads of
+        //:   'findMany', and verify that each result equals the result of
+        //:   'find', and that the element following the batch is not
+        //:   modified.  (C-1..4)
+        //:
+        //: 2 Modify the mapped value through each iterator found by the
+        //:   modifiable overload and verify the modification.  (C-5)
+        //:
+        //: 3 Verify no memory is allocated by the lookups.  (C-6)
+        //
+        // Testing:
+        //   void findMany(iterator *, const KEY *, size_type);
+        //   void findMany(const_iterator *, const KEY *, size_type) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'findMany'"
+                            "\n==================\n");
+
+        typedef bsl::unordered_map<int, int> Obj;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        const int SIZES[] = { 0, 1, 15, 16, 17, 33, 100 };
+        enum { NUM_SIZES = sizeof SIZES / sizeof *SIZES };
+
+        const int LENGTHS[] = { 0, 1, 2, 15, 16, 17, 31, 32, 33 };
+        enum { NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS };
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int N        = SIZES[ti];
+            const int NUM_KEYS = 2 * N + 2;
+
+            if (veryVerbose) { T_ P(N) }
+
+            Obj mX(&oa);  const Obj& X = mX;
+
+            for (int i = 0; i < N; ++i) {
+                mX.insert(Obj::value_type(2 * i, i));
+            }
+
+            bsl::vector<int> keys(&sa);
+            for (int i = -1; i <= 2 * N; ++i) {
+                keys.push_back(i);
+            }
+
+            bsl::vector<Obj::iterator>       results(NUM_KEYS + 1, &sa);
+            bsl::vector<Obj::const_iterator> cresults(NUM_KEYS + 1, &sa);
+
+            for (int tj = 0; tj <= NUM_LENGTHS; ++tj) {
+                const int LENGTH = tj < NUM_LENGTHS
+                                 ? (LENGTHS[tj] < NUM_KEYS
+                                    ? LENGTHS[tj]
+                                    : NUM_KEYS)
+                                 : NUM_KEYS;
+
+                bslma::TestAllocatorMonitor oam(&oa);
+
+                for (int i = 0; i <= NUM_KEYS; ++i) {
+                    results[i]  = mX.begin();
+                    cresults[i] = X.begin();
+                }
+
+                mX.findMany(results.data(), keys.data(), LENGTH);
+                X.findMany(cresults.data(), keys.data(), LENGTH);
+
+                for (int i = 0; i < LENGTH; ++i) {
+                    ASSERTV(N, LENGTH, i, mX.find(keys[i]) == results[i]);
+                    ASSERTV(N, LENGTH, i, X.find(keys[i])  == cresults[i]);
+                }
+                ASSERTV(N, LENGTH, mX.begin() == results[LENGTH]);
+                ASSERTV(N, LENGTH, X.begin()  == cresults[LENGTH]);
+
+                ASSERTV(N, LENGTH, oam.isTotalSame());
+            }
+
+            mX.findMany(results.data(), keys.data(), NUM_KEYS);
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                if (mX.end() != results[i]) {
+                    results[i]->second = -keys[i];
+
+                    ASSERTV(N, i, -keys[i] == X.find(keys[i])->second);
+                }
+            }
+        }
+      } break;
       case 40: {
         // --------------------------------------------------------------------
         // TESTING TRANSPARENT COMPARATOR
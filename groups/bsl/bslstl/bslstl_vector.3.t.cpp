@@ -2,8 +2,12 @@
 #define BSLSTL_VECTOR_0T_AS_INCLUDE
 #include <bslstl_vector.0.t.cpp>
 
+#include <bslh_defaulthashalgorithm.h>
 #include <bslh_hash.h>
 
+#include <bslmf_isbitwiseequalitycomparable.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
 // ============================================================================
 //                                 TEST PLAN
 // ----------------------------------------------------------------------------
@@ -435,6 +439,32 @@ bool operator!=(const HI<TYPE, BITS>& lhs, const HI<TYPE, BITS>& rhs)
     return !(lhs == rhs);
 }
 
+                      // ================================
+                      // struct BitwiseEqualityComparable
+                      // ================================
+
+struct BitwiseEqualityComparable {
+    // This 'struct' holds two 'int' members, is marked as bitwise
+    // EqualityComparable, and is supplied with a 'hashAppend' that does not
+    // pass the object representation to the hashing algorithm.
+
+    BSLMF_NESTED_TRAIT_DECLARATION(BitwiseEqualityComparable,
+                                   bslmf::IsBitwiseEqualityComparable);
+
+    int d_first;
+    int d_second;
+};
+
+template <class HASHALG>
+void hashAppend(HASHALG& hashAlg, const BitwiseEqualityComparable& object)
+    // Pass the members of the specified 'object' to the specified 'hashAlg' in
+    // reverse order.
+{
+    using bslh::hashAppend;
+    hashAppend(hashAlg, object.d_second);
+    hashAppend(hashAlg, object.d_first);
+}
+
                     // TEST DRIVER PART 3 TRAITS HELPERS
 
 template <class TYPE>
@@ -4731,6 +4761,36 @@ int main(int argc, char *argv[])
                       bsltf::TemplateTestFacility::ObjectPtr,
                       bsltf::TemplateTestFacility::FunctionPtr,
                       const char *);
+
+        if (verbose) printf("\tVerify that the 'hashAppend' of a bitwise"
+                            " EqualityComparable element type is used.\n");
+        {
+            typedef BitwiseEqualityComparable Element;
+
+            const Element VALUES[] = { { 1, 2 }, { 3, 4 }, { 5, 6 } };
+            enum { NUM_VALUES = sizeof VALUES / sizeof *VALUES };
+
+            bsl::vector<Element> mX(VALUES, VALUES + NUM_VALUES);
+            const bsl::vector<Element>& X = mX;
+
+            bslh::DefaultHashAlgorithm elementAlg;
+            hashAppend(elementAlg, X.size());
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                hashAppend(elementAlg, VALUES[i]);
+            }
+
+            const std::size_t SIZE = X.size();
+
+            bslh::DefaultHashAlgorithm bytesAlg;
+            bytesAlg(&SIZE, sizeof SIZE);
+            bytesAlg(VALUES, sizeof VALUES);
+
+            const std::size_t EXP =
+                       static_cast<std::size_t>(elementAlg.computeHash());
+
+            ASSERT(EXP == bslh::Hash<>()(X));
+            ASSERT(EXP != static_cast<std::size_t>(bytesAlg.computeHash()));
+        }
       } break;
       case 33: {
         // --------------------------------------------------------------------
@@ -3797,11 +3797,8 @@ inline
 void hashAppend(HASHALG& hashAlg, const vector<VALUE_TYPE, ALLOCATOR>& input)
 {
     using ::BloombergLP::bslh::hashAppend;
-    typedef typename vector<VALUE_TYPE, ALLOCATOR>::const_iterator ci_t;
     hashAppend(hashAlg, input.size());
-    for (ci_t b = input.begin(), e = input.end(); b != e; ++b) {
-        hashAppend(hashAlg, *b);
-    }
+    ::BloombergLP::bslh::hashAppendRange(hashAlg, input.data(), input.size());
 }
 
 